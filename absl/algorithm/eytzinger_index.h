@@ -0,0 +1,152 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// -----------------------------------------------------------------------------
+// File: eytzinger_index.h
+// -----------------------------------------------------------------------------
+//
+// This header file defines `absl::EytzingerIndex<T>`, an immutable search
+// index built from a sorted range. The elements are stored in breadth-first
+// (Eytzinger) order -- the node at index `k` has its children at `2k` and
+// `2k + 1` -- so each step of a search lands near the top of the array while
+// the search is shallow and, deeper down, the next elements to compare
+// against are computable and prefetchable before they are needed. Combined
+// with a branchless descent, this makes `lower_bound()` several times faster
+// than binary search over a plain sorted array once the data far exceeds the
+// cache, where `std::lower_bound` pays a full cache miss per comparison.
+//
+// The index does not support mutation; rebuild it to change the contents.
+// Elements must be copyable and default-constructible. For data that fits in
+// cache, or for code that also needs insertion, iteration from an arbitrary
+// position, or ranged scans, a plain sorted vector with `absl::c_lower_bound`
+// or an `absl::btree_set` remains the better choice.
+//
+// Example:
+//
+//   std::vector<int64_t> sorted_ids = LoadIds();        // sorted ascending
+//   absl::EytzingerIndex<int64_t> index(sorted_ids.begin(), sorted_ids.end());
+//   const int64_t* found = index.lower_bound(42);
+//   if (found != nullptr && *found == 42) { ... }
+
+#ifndef ABSL_ALGORITHM_EYTZINGER_INDEX_H_
+#define ABSL_ALGORITHM_EYTZINGER_INDEX_H_
+
+#include <cassert>
+#include <cstddef>
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "absl/base/config.h"
+#include "absl/base/prefetch.h"
+#include "absl/numeric/bits.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+template <typename T, typename Compare = std::less<T>>
+class EytzingerIndex {
+ public:
+  using value_type = T;
+  using size_type = size_t;
+
+  EytzingerIndex() = default;
+
+  // Builds the index from `[first, last)`, which must be sorted with respect
+  // to `comp`. Runs in linear time (plus the copy of the elements).
+  template <typename ForwardIterator>
+  EytzingerIndex(ForwardIterator first, ForwardIterator last,
+                 Compare comp = Compare())
+      : comp_(std::move(comp)) {
+    assert(std::is_sorted(first, last, comp_));
+    const size_t n = static_cast<size_t>(std::distance(first, last));
+    heap_.resize(n + 1);  // 1-based; heap_[0] is unused.
+    FillInOrder(first, 1);
+  }
+
+  size_type size() const { return heap_.empty() ? 0 : heap_.size() - 1; }
+  bool empty() const { return size() == 0; }
+
+  // EytzingerIndex::lower_bound()
+  //
+  // Returns a pointer to the first element (in sorted order) that is not
+  // less than `value`, or null if every element is less than `value`. The
+  // returned pointer is valid for the lifetime of the index.
+  const T* lower_bound(const T& value) const {
+    const size_t n = size();
+    size_t k = 1;
+    while (k <= n) {
+      // The node's great-grandchildren start at `8k`; their parents at `4k`
+      // occupy two adjacent nodes, so one prefetch two levels down covers
+      // both possible outcomes of the next comparison. The clamp keeps the
+      // address inside the array on the last levels.
+      PrefetchToLocalCache(heap_.data() + (std::min)(k << 2, n));
+      // Branchless descent: go right iff heap_[k] < value.
+      k = (k << 1) + static_cast<size_t>(comp_(heap_[k], value));
+    }
+    // The lower bound is the ancestor reached by undoing every trailing
+    // "right" turn plus one "left" turn; `k` of zero means every element
+    // compared less than `value`.
+    k >>= static_cast<unsigned>(countr_zero(~k)) + 1;
+    return k == 0 ? nullptr : &heap_[k];
+  }
+
+  // EytzingerIndex::contains()
+  //
+  // Returns whether an element equivalent to `value` is present.
+  bool contains(const T& value) const {
+    const T* found = lower_bound(value);
+    return found != nullptr && !comp_(value, *found);
+  }
+
+  // EytzingerIndex::copy_sorted()
+  //
+  // Copies the elements to `out` in sorted order (an in-order traversal of
+  // the layout) and returns the final output iterator.
+  template <typename OutputIterator>
+  OutputIterator copy_sorted(OutputIterator out) const {
+    return CopySubtree(1, out);
+  }
+
+ private:
+  // Fills the subtree rooted at `k` from `it` by in-order traversal, which
+  // visits the nodes in ascending sorted order.
+  template <typename ForwardIterator>
+  void FillInOrder(ForwardIterator& it, size_t k) {
+    if (k >= heap_.size()) return;
+    FillInOrder(it, 2 * k);
+    heap_[k] = *it;
+    ++it;
+    FillInOrder(it, 2 * k + 1);
+  }
+
+  template <typename OutputIterator>
+  OutputIterator CopySubtree(size_t k, OutputIterator out) const {
+    if (k >= heap_.size()) return out;
+    out = CopySubtree(2 * k, out);
+    *out = heap_[k];
+    ++out;
+    return CopySubtree(2 * k + 1, out);
+  }
+
+  std::vector<T> heap_;
+  Compare comp_;
+};
+
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_ALGORITHM_EYTZINGER_INDEX_H_
@@ -0,0 +1,114 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/algorithm/eytzinger_index.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+using ::testing::ElementsAre;
+
+TEST(EytzingerIndexTest, EmptyIndex) {
+  absl::EytzingerIndex<int> index;
+  EXPECT_TRUE(index.empty());
+  EXPECT_EQ(index.size(), 0);
+  EXPECT_EQ(index.lower_bound(0), nullptr);
+  EXPECT_FALSE(index.contains(0));
+
+  std::vector<int> empty;
+  absl::EytzingerIndex<int> from_range(empty.begin(), empty.end());
+  EXPECT_TRUE(from_range.empty());
+  EXPECT_EQ(from_range.lower_bound(0), nullptr);
+}
+
+TEST(EytzingerIndexTest, LowerBoundMatchesStdLowerBound) {
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<int> dist(0, 9999);
+  for (int size : {1, 2, 3, 7, 8, 100, 1000}) {
+    std::vector<int> sorted;
+    for (int i = 0; i < size; ++i) sorted.push_back(dist(gen));
+    std::sort(sorted.begin(), sorted.end());
+
+    absl::EytzingerIndex<int> index(sorted.begin(), sorted.end());
+    ASSERT_EQ(index.size(), sorted.size());
+
+    for (int i = 0; i < 1000; ++i) {
+      const int query = dist(gen);
+      auto expected = std::lower_bound(sorted.begin(), sorted.end(), query);
+      const int* actual = index.lower_bound(query);
+      if (expected == sorted.end()) {
+        EXPECT_EQ(actual, nullptr) << "size " << size << " query " << query;
+      } else {
+        ASSERT_NE(actual, nullptr) << "size " << size << " query " << query;
+        EXPECT_EQ(*actual, *expected) << "size " << size << " query " << query;
+      }
+    }
+  }
+}
+
+TEST(EytzingerIndexTest, Contains) {
+  std::vector<int> sorted = {2, 4, 6, 8, 10};
+  absl::EytzingerIndex<int> index(sorted.begin(), sorted.end());
+  for (int value : sorted) {
+    EXPECT_TRUE(index.contains(value)) << value;
+    EXPECT_FALSE(index.contains(value + 1)) << value + 1;
+  }
+  EXPECT_FALSE(index.contains(0));
+}
+
+TEST(EytzingerIndexTest, CopySortedRoundTrips) {
+  std::vector<int> sorted = {1, 2, 3, 5, 8, 13, 21, 34, 55, 89};
+  absl::EytzingerIndex<int> index(sorted.begin(), sorted.end());
+  std::vector<int> restored;
+  index.copy_sorted(std::back_inserter(restored));
+  EXPECT_EQ(restored, sorted);
+}
+
+TEST(EytzingerIndexTest, CustomComparator) {
+  std::vector<int> descending = {9, 7, 5, 3, 1};
+  absl::EytzingerIndex<int, std::greater<int>> index(descending.begin(),
+                                                     descending.end());
+  const int* found = index.lower_bound(6);
+  ASSERT_NE(found, nullptr);
+  EXPECT_EQ(*found, 5);  // First element not greater than 6.
+  EXPECT_EQ(index.lower_bound(0), nullptr);
+  EXPECT_TRUE(index.contains(7));
+  EXPECT_FALSE(index.contains(6));
+}
+
+TEST(EytzingerIndexTest, StringElements) {
+  std::vector<std::string> sorted = {"ant", "bee", "cat", "dog", "emu"};
+  absl::EytzingerIndex<std::string> index(sorted.begin(), sorted.end());
+  const std::string* found = index.lower_bound("bat");
+  ASSERT_NE(found, nullptr);
+  EXPECT_EQ(*found, "bee");
+  EXPECT_TRUE(index.contains("dog"));
+  EXPECT_FALSE(index.contains("fox"));
+
+  std::vector<std::string> restored;
+  index.copy_sorted(std::back_inserter(restored));
+  EXPECT_THAT(restored, ElementsAre("ant", "bee", "cat", "dog", "emu"));
+}
+
+}  // namespace
@@ -0,0 +1,202 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// -----------------------------------------------------------------------------
+// File: parallel_container.h
+// -----------------------------------------------------------------------------
+//
+// This header file provides parallel variants of a few container-based
+// algorithms from absl/algorithm/container.h. Each function takes an
+// `absl::ThreadPool` on which the work is run, chunks the input into
+// contiguous grains large enough to amortize scheduling overhead, and blocks
+// until the whole operation completes. Inputs too small to benefit from
+// parallelism are processed serially on the calling thread.
+//
+// The containers must provide random access iterators. The supplied callable
+// or comparator is copied into every chunk's task and invoked concurrently,
+// so it must be safe to run on multiple threads at once and must not throw.
+// Because these functions block the calling thread until the pool has
+// finished, they must not be invoked from one of `pool`'s own threads.
+
+#ifndef ABSL_ALGORITHM_PARALLEL_CONTAINER_H_
+#define ABSL_ALGORITHM_PARALLEL_CONTAINER_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "absl/algorithm/container.h"
+#include "absl/base/config.h"
+#include "absl/synchronization/blocking_counter.h"
+#include "absl/synchronization/thread_pool.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+namespace container_algorithm_internal {
+
+// Minimum number of elements in a chunk handed to a pool thread. Chunks
+// below this size cost more to schedule than they save by running elsewhere.
+constexpr ptrdiff_t kParallelGrainSize = 2048;
+
+// Returns the chunk boundaries for running `size` elements on `pool`:
+// offsets 0 == b[0] < b[1] < ... < b[k] == size. Aims for a few chunks per
+// worker (so that uneven chunks still balance through stealing) without going
+// below the grain size.
+inline std::vector<ptrdiff_t> ParallelChunkBoundaries(ThreadPool& pool,
+                                                      ptrdiff_t size) {
+  const ptrdiff_t max_chunks = static_cast<ptrdiff_t>(pool.NumThreads()) * 4;
+  ptrdiff_t chunk_size = std::max(kParallelGrainSize,
+                                  (size + max_chunks - 1) / max_chunks);
+  std::vector<ptrdiff_t> boundaries;
+  for (ptrdiff_t offset = 0; offset < size; offset += chunk_size) {
+    boundaries.push_back(offset);
+  }
+  boundaries.push_back(size);
+  return boundaries;
+}
+
+// Schedules `task(begin, end)` on `pool` for every chunk of `[0, size)` and
+// blocks until all chunks have run.
+template <typename ChunkTask>
+void ParallelChunkedRun(ThreadPool& pool, ptrdiff_t size, ChunkTask task) {
+  const std::vector<ptrdiff_t> boundaries =
+      ParallelChunkBoundaries(pool, size);
+  const size_t num_chunks = boundaries.size() - 1;
+  absl::BlockingCounter done(static_cast<int>(num_chunks));
+  for (size_t i = 0; i < num_chunks; ++i) {
+    pool.Schedule([task, &boundaries, &done, i] {
+      task(boundaries[i], boundaries[i + 1]);
+      done.DecrementCount();
+    });
+  }
+  done.Wait();
+}
+
+}  // namespace container_algorithm_internal
+
+// c_parallel_for_each()
+//
+// Parallel variant of `absl::c_for_each()`: applies a copy of `f` to each
+// element of `c`, running contiguous chunks of the container on `pool`.
+// Blocks until every element has been processed. Unlike `c_for_each()`, no
+// function object is returned, since each chunk operates on its own copy.
+template <typename C, typename Function>
+void c_parallel_for_each(ThreadPool& pool, C&& c, Function f) {
+  auto begin = container_algorithm_internal::c_begin(c);
+  const ptrdiff_t size = container_algorithm_internal::c_end(c) - begin;
+  if (size < 2 * container_algorithm_internal::kParallelGrainSize ||
+      pool.NumThreads() < 2) {
+    std::for_each(begin, container_algorithm_internal::c_end(c), std::move(f));
+    return;
+  }
+  container_algorithm_internal::ParallelChunkedRun(
+      pool, size, [begin, f](ptrdiff_t chunk_begin, ptrdiff_t chunk_end) {
+        std::for_each(begin + chunk_begin, begin + chunk_end, f);
+      });
+}
+
+// c_parallel_transform()
+//
+// Parallel variant of the unary-operation form of `absl::c_transform()`:
+// applies a copy of `unary_op` to each element of `input`, writing results
+// through `output`, which must be a random access iterator referring to a
+// range with room for all results that is safe to write concurrently (e.g.
+// into a presized vector). Returns the iterator past the last written result.
+template <typename InputSequence, typename OutputIterator, typename UnaryOp>
+OutputIterator c_parallel_transform(ThreadPool& pool,
+                                    const InputSequence& input,
+                                    OutputIterator output, UnaryOp unary_op) {
+  auto begin = container_algorithm_internal::c_begin(input);
+  const ptrdiff_t size = container_algorithm_internal::c_end(input) - begin;
+  if (size < 2 * container_algorithm_internal::kParallelGrainSize ||
+      pool.NumThreads() < 2) {
+    return std::transform(begin, container_algorithm_internal::c_end(input),
+                          output, std::move(unary_op));
+  }
+  container_algorithm_internal::ParallelChunkedRun(
+      pool, size,
+      [begin, output, unary_op](ptrdiff_t chunk_begin, ptrdiff_t chunk_end) {
+        std::transform(begin + chunk_begin, begin + chunk_end,
+                       output + chunk_begin, unary_op);
+      });
+  return output + size;
+}
+
+// c_parallel_sort()
+//
+// Parallel variant of `absl::c_sort()`: sorts contiguous chunks of `c` on
+// `pool` and then merges adjacent sorted runs in parallel rounds. The sort is
+// not stable. Blocks until the container is fully sorted.
+template <typename C, typename LessThan>
+void c_parallel_sort(ThreadPool& pool, C& c, LessThan comp) {
+  auto begin = container_algorithm_internal::c_begin(c);
+  const ptrdiff_t size = container_algorithm_internal::c_end(c) - begin;
+  if (size < 2 * container_algorithm_internal::kParallelGrainSize ||
+      pool.NumThreads() < 2) {
+    std::sort(begin, container_algorithm_internal::c_end(c), std::move(comp));
+    return;
+  }
+
+  // Sort each chunk independently.
+  std::vector<ptrdiff_t> runs =
+      container_algorithm_internal::ParallelChunkBoundaries(pool, size);
+  {
+    const size_t num_chunks = runs.size() - 1;
+    absl::BlockingCounter done(static_cast<int>(num_chunks));
+    for (size_t i = 0; i < num_chunks; ++i) {
+      pool.Schedule([begin, &runs, &done, comp, i] {
+        std::sort(begin + runs[i], begin + runs[i + 1], comp);
+        done.DecrementCount();
+      });
+    }
+    done.Wait();
+  }
+
+  // Merge adjacent runs pairwise until one sorted run remains. Each round
+  // halves the number of runs and merges independent pairs in parallel.
+  while (runs.size() > 2) {
+    const size_t num_merges = (runs.size() - 1) / 2;
+    absl::BlockingCounter done(static_cast<int>(num_merges));
+    std::vector<ptrdiff_t> next_runs;
+    next_runs.push_back(runs[0]);
+    for (size_t i = 0; i + 2 < runs.size(); i += 2) {
+      pool.Schedule([begin, &runs, &done, comp, i] {
+        std::inplace_merge(begin + runs[i], begin + runs[i + 1],
+                           begin + runs[i + 2], comp);
+        done.DecrementCount();
+      });
+      next_runs.push_back(runs[i + 2]);
+    }
+    // An odd trailing run is carried into the next round unmerged.
+    if (next_runs.back() != runs.back()) next_runs.push_back(runs.back());
+    done.Wait();
+    runs = std::move(next_runs);
+  }
+}
+
+// Overload of c_parallel_sort() using the default `operator<` comparison.
+template <typename C>
+void c_parallel_sort(ThreadPool& pool, C& c) {
+  c_parallel_sort(pool, c,
+                  std::less<typename std::iterator_traits<
+                      container_algorithm_internal::ContainerIter<C>>::
+                                value_type>());
+}
+
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_ALGORITHM_PARALLEL_CONTAINER_H_
@@ -0,0 +1,103 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/algorithm/parallel_container.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "absl/synchronization/thread_pool.h"
+
+namespace {
+
+std::vector<int> ShuffledInts(size_t n) {
+  std::vector<int> v(n);
+  for (size_t i = 0; i < n; ++i) v[i] = static_cast<int>(i);
+  std::mt19937 gen(42);
+  std::shuffle(v.begin(), v.end(), gen);
+  return v;
+}
+
+TEST(ParallelForEach, VisitsEveryElementOnce) {
+  absl::ThreadPool pool(4);
+  for (size_t size : {size_t{0}, size_t{100}, size_t{100000}}) {
+    SCOPED_TRACE(size);
+    std::vector<std::atomic<int>> counts(size);
+    std::vector<int> input(size);
+    for (size_t i = 0; i < size; ++i) input[i] = static_cast<int>(i);
+
+    absl::c_parallel_for_each(pool, input, [&counts](int value) {
+      counts[static_cast<size_t>(value)].fetch_add(1,
+                                                   std::memory_order_relaxed);
+    });
+
+    for (size_t i = 0; i < size; ++i) {
+      ASSERT_EQ(counts[i].load(std::memory_order_relaxed), 1) << i;
+    }
+  }
+}
+
+TEST(ParallelTransform, MatchesSerialTransform) {
+  absl::ThreadPool pool(4);
+  for (size_t size : {size_t{0}, size_t{100}, size_t{100000}}) {
+    SCOPED_TRACE(size);
+    std::vector<int> input = ShuffledInts(size);
+    std::vector<int> output(size);
+
+    auto end = absl::c_parallel_transform(pool, input, output.begin(),
+                                          [](int x) { return 2 * x + 1; });
+    EXPECT_EQ(end, output.end());
+
+    std::vector<int> expected(size);
+    std::transform(input.begin(), input.end(), expected.begin(),
+                   [](int x) { return 2 * x + 1; });
+    EXPECT_EQ(output, expected);
+  }
+}
+
+TEST(ParallelSort, SortsLikeSerialSort) {
+  absl::ThreadPool pool(4);
+  for (size_t size : {size_t{0}, size_t{1}, size_t{100}, size_t{5000},
+                      size_t{100000}, size_t{1000001}}) {
+    SCOPED_TRACE(size);
+    std::vector<int> v = ShuffledInts(size);
+    absl::c_parallel_sort(pool, v);
+    EXPECT_TRUE(std::is_sorted(v.begin(), v.end()));
+    // All original elements are still present.
+    for (size_t i = 0; i < size; ++i) {
+      ASSERT_EQ(v[i], static_cast<int>(i));
+    }
+  }
+}
+
+TEST(ParallelSort, CustomComparator) {
+  absl::ThreadPool pool(4);
+  std::vector<int> v = ShuffledInts(100000);
+  absl::c_parallel_sort(pool, v, std::greater<int>());
+  EXPECT_TRUE(std::is_sorted(v.begin(), v.end(), std::greater<int>()));
+}
+
+TEST(ParallelSort, SinglethreadedPoolFallsBackToSerial) {
+  absl::ThreadPool pool(1);
+  std::vector<int> v = ShuffledInts(100000);
+  absl::c_parallel_sort(pool, v);
+  EXPECT_TRUE(std::is_sorted(v.begin(), v.end()));
+}
+
+}  // namespace
@@ -0,0 +1,213 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// -----------------------------------------------------------------------------
+// File: reduce.h
+// -----------------------------------------------------------------------------
+//
+// This header file defines reduction kernels over contiguous arithmetic data:
+// `absl::MinOf()`, `absl::MaxOf()`, `absl::MinMaxOf()`, `absl::SumOf()`, and
+// the index-returning `absl::MinIndexOf()` / `absl::MaxIndexOf()`.
+//
+// `absl::c_min_element()` and `absl::c_accumulate()` are specified element by
+// element: each iteration depends on the previous one, and for floating-point
+// data the summation order is part of the contract. Compilers therefore may
+// not vectorize them. The kernels here instead reduce into several
+// independent accumulators, which fixes a reassociated evaluation order in
+// the source itself and lets compilers emit straight SIMD code for the loop.
+//
+// Semantics to be aware of:
+//
+//   * `MinOf()`, `MaxOf()`, `MinMaxOf()`, `MinIndexOf()`, and `MaxIndexOf()`
+//     require a non-empty span.
+//   * `SumOf()` accumulates in `T`: integer sums wrap or overflow exactly as
+//     `x += v` would, and floating-point sums are evaluated in a different
+//     (but fixed) order than `absl::c_accumulate()`, so the rounding may
+//     differ from a strictly sequential sum.
+//   * If a floating-point span contains NaNs, the results are unspecified.
+//   * The index variants return the position of the first extreme element.
+//
+// Example:
+//
+//   std::vector<float> column = LoadColumn();
+//   auto range = absl::MinMaxOf(absl::MakeConstSpan(column));
+//   float width = range.second - range.first;
+
+#ifndef ABSL_ALGORITHM_REDUCE_H_
+#define ABSL_ALGORITHM_REDUCE_H_
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "absl/base/config.h"
+#include "absl/base/macros.h"
+#include "absl/types/span.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+// MinOf()
+//
+// Returns the smallest value in `values`, which must be non-empty.
+template <typename T,
+          typename std::enable_if<std::is_arithmetic<T>::value, int>::type = 0>
+T MinOf(absl::Span<const T> values) {
+  ABSL_HARDENING_ASSERT(!values.empty());
+  const T* p = values.data();
+  const size_t n = values.size();
+  // Four independent accumulators: each lane carries no dependency on the
+  // others, so the loop vectorizes and the dependency chain shrinks 4x.
+  T m0 = p[0];
+  T m1 = p[0];
+  T m2 = p[0];
+  T m3 = p[0];
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    m0 = p[i + 0] < m0 ? p[i + 0] : m0;
+    m1 = p[i + 1] < m1 ? p[i + 1] : m1;
+    m2 = p[i + 2] < m2 ? p[i + 2] : m2;
+    m3 = p[i + 3] < m3 ? p[i + 3] : m3;
+  }
+  for (; i < n; ++i) {
+    m0 = p[i] < m0 ? p[i] : m0;
+  }
+  m0 = m1 < m0 ? m1 : m0;
+  m2 = m3 < m2 ? m3 : m2;
+  return m2 < m0 ? m2 : m0;
+}
+
+// MaxOf()
+//
+// Returns the largest value in `values`, which must be non-empty.
+template <typename T,
+          typename std::enable_if<std::is_arithmetic<T>::value, int>::type = 0>
+T MaxOf(absl::Span<const T> values) {
+  ABSL_HARDENING_ASSERT(!values.empty());
+  const T* p = values.data();
+  const size_t n = values.size();
+  T m0 = p[0];
+  T m1 = p[0];
+  T m2 = p[0];
+  T m3 = p[0];
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    m0 = p[i + 0] > m0 ? p[i + 0] : m0;
+    m1 = p[i + 1] > m1 ? p[i + 1] : m1;
+    m2 = p[i + 2] > m2 ? p[i + 2] : m2;
+    m3 = p[i + 3] > m3 ? p[i + 3] : m3;
+  }
+  for (; i < n; ++i) {
+    m0 = p[i] > m0 ? p[i] : m0;
+  }
+  m0 = m1 > m0 ? m1 : m0;
+  m2 = m3 > m2 ? m3 : m2;
+  return m2 > m0 ? m2 : m0;
+}
+
+// MinMaxOf()
+//
+// Returns `{MinOf(values), MaxOf(values)}` in a single pass over the data.
+// `values` must be non-empty.
+template <typename T,
+          typename std::enable_if<std::is_arithmetic<T>::value, int>::type = 0>
+std::pair<T, T> MinMaxOf(absl::Span<const T> values) {
+  ABSL_HARDENING_ASSERT(!values.empty());
+  const T* p = values.data();
+  const size_t n = values.size();
+  T lo0 = p[0];
+  T lo1 = p[0];
+  T hi0 = p[0];
+  T hi1 = p[0];
+  size_t i = 0;
+  for (; i + 2 <= n; i += 2) {
+    lo0 = p[i + 0] < lo0 ? p[i + 0] : lo0;
+    lo1 = p[i + 1] < lo1 ? p[i + 1] : lo1;
+    hi0 = p[i + 0] > hi0 ? p[i + 0] : hi0;
+    hi1 = p[i + 1] > hi1 ? p[i + 1] : hi1;
+  }
+  for (; i < n; ++i) {
+    lo0 = p[i] < lo0 ? p[i] : lo0;
+    hi0 = p[i] > hi0 ? p[i] : hi0;
+  }
+  lo0 = lo1 < lo0 ? lo1 : lo0;
+  hi0 = hi1 > hi0 ? hi1 : hi0;
+  return {lo0, hi0};
+}
+
+// SumOf()
+//
+// Returns the sum of `values`, accumulated in `T`. Returns `T{}` for an
+// empty span.
+template <typename T,
+          typename std::enable_if<std::is_arithmetic<T>::value, int>::type = 0>
+T SumOf(absl::Span<const T> values) {
+  const T* p = values.data();
+  const size_t n = values.size();
+  T s0{};
+  T s1{};
+  T s2{};
+  T s3{};
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    s0 += p[i + 0];
+    s1 += p[i + 1];
+    s2 += p[i + 2];
+    s3 += p[i + 3];
+  }
+  for (; i < n; ++i) {
+    s0 += p[i];
+  }
+  return static_cast<T>(static_cast<T>(s0 + s1) + static_cast<T>(s2 + s3));
+}
+
+// MinIndexOf()
+//
+// Returns the index of the first occurrence of the smallest value in
+// `values`, which must be non-empty.
+template <typename T,
+          typename std::enable_if<std::is_arithmetic<T>::value, int>::type = 0>
+size_t MinIndexOf(absl::Span<const T> values) {
+  // Tracking the index inside the reduction would serialize it; find the
+  // value with the vector kernel, then locate its first occurrence with a
+  // second vectorizable scan. The scan is bounded so that a NaN result
+  // (which compares unequal to everything) yields an unspecified index
+  // rather than reading past the end.
+  const T m = MinOf(values);
+  const T* p = values.data();
+  const size_t n = values.size();
+  size_t i = 0;
+  while (i + 1 < n && p[i] != m) ++i;
+  return i;
+}
+
+// MaxIndexOf()
+//
+// Returns the index of the first occurrence of the largest value in
+// `values`, which must be non-empty.
+template <typename T,
+          typename std::enable_if<std::is_arithmetic<T>::value, int>::type = 0>
+size_t MaxIndexOf(absl::Span<const T> values) {
+  const T m = MaxOf(values);
+  const T* p = values.data();
+  const size_t n = values.size();
+  size_t i = 0;
+  while (i + 1 < n && p[i] != m) ++i;
+  return i;
+}
+
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_ALGORITHM_REDUCE_H_
@@ -0,0 +1,140 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/algorithm/reduce.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "absl/types/span.h"
+
+namespace {
+
+TEST(Reduce, MinMaxOfSmallSpans) {
+  // Cover every size around the unrolled-block boundaries so the scalar tail
+  // of each kernel is exercised.
+  std::mt19937 gen(17);
+  std::uniform_int_distribution<int> dist(-1000, 1000);
+  for (size_t size = 1; size <= 130; ++size) {
+    std::vector<int> v(size);
+    for (int& x : v) x = dist(gen);
+    const auto span = absl::MakeConstSpan(v);
+    ASSERT_EQ(absl::MinOf(span), *std::min_element(v.begin(), v.end()))
+        << size;
+    ASSERT_EQ(absl::MaxOf(span), *std::max_element(v.begin(), v.end()))
+        << size;
+    const auto min_max = absl::MinMaxOf(span);
+    ASSERT_EQ(min_max.first, absl::MinOf(span)) << size;
+    ASSERT_EQ(min_max.second, absl::MaxOf(span)) << size;
+  }
+}
+
+TEST(Reduce, MinMaxOfExtremesInTail) {
+  // The extreme values land in the scalar tail, not the unrolled body.
+  std::vector<int64_t> v(67, 5);
+  v[65] = -100;
+  v[66] = 100;
+  const auto span = absl::MakeConstSpan(v);
+  EXPECT_EQ(absl::MinOf(span), -100);
+  EXPECT_EQ(absl::MaxOf(span), 100);
+  EXPECT_EQ(absl::MinMaxOf(span), (std::pair<int64_t, int64_t>(-100, 100)));
+}
+
+TEST(Reduce, MinMaxOfUnsigned) {
+  std::vector<uint32_t> v = {7, 0, 4294967295u, 3};
+  EXPECT_EQ(absl::MinOf(absl::MakeConstSpan(v)), 0u);
+  EXPECT_EQ(absl::MaxOf(absl::MakeConstSpan(v)), 4294967295u);
+}
+
+TEST(Reduce, MinMaxOfFloat) {
+  std::mt19937 gen(29);
+  std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+  std::vector<float> v(1000);
+  for (float& x : v) x = dist(gen);
+  const auto span = absl::MakeConstSpan(v);
+  EXPECT_EQ(absl::MinOf(span), *std::min_element(v.begin(), v.end()));
+  EXPECT_EQ(absl::MaxOf(span), *std::max_element(v.begin(), v.end()));
+}
+
+TEST(Reduce, SumOf) {
+  EXPECT_EQ(absl::SumOf(absl::Span<const int>()), 0);
+  EXPECT_EQ(absl::SumOf(absl::MakeConstSpan(std::vector<int>{42})), 42);
+  for (size_t size : {size_t{3}, size_t{4}, size_t{100}, size_t{101}}) {
+    std::vector<int64_t> v(size);
+    std::iota(v.begin(), v.end(), int64_t{1});
+    EXPECT_EQ(absl::SumOf(absl::MakeConstSpan(v)),
+              static_cast<int64_t>(size * (size + 1) / 2))
+        << size;
+  }
+}
+
+TEST(Reduce, SumOfDoubleMatchesSequentialSumClosely) {
+  std::mt19937 gen(43);
+  std::uniform_real_distribution<double> dist(0.0, 1.0);
+  std::vector<double> v(10000);
+  for (double& x : v) x = dist(gen);
+  const double sequential = std::accumulate(v.begin(), v.end(), 0.0);
+  const double sum = absl::SumOf(absl::MakeConstSpan(v));
+  // The accumulation order differs, so allow for rounding differences.
+  EXPECT_NEAR(sum, sequential, 1e-9 * std::abs(sequential));
+}
+
+TEST(Reduce, IndexVariantsReturnFirstOccurrence) {
+  std::vector<int> v = {3, 1, 4, 1, 5, 9, 2, 6, 5, 9};
+  EXPECT_EQ(absl::MinIndexOf(absl::MakeConstSpan(v)), 1u);
+  EXPECT_EQ(absl::MaxIndexOf(absl::MakeConstSpan(v)), 5u);
+
+  std::vector<double> single = {2.5};
+  EXPECT_EQ(absl::MinIndexOf(absl::MakeConstSpan(single)), 0u);
+  EXPECT_EQ(absl::MaxIndexOf(absl::MakeConstSpan(single)), 0u);
+}
+
+TEST(Reduce, IndexVariantsStayInBoundsOnNaN) {
+  // The result is unspecified when the span contains NaN, but the lookup must
+  // not read past the end of the buffer.
+  const double nan = std::nan("");
+  std::vector<double> v = {1.0, nan, 3.0, nan, 2.0};
+  EXPECT_LT(absl::MinIndexOf(absl::MakeConstSpan(v)), v.size());
+  EXPECT_LT(absl::MaxIndexOf(absl::MakeConstSpan(v)), v.size());
+
+  std::vector<double> all_nan = {nan, nan, nan};
+  EXPECT_LT(absl::MinIndexOf(absl::MakeConstSpan(all_nan)), all_nan.size());
+  EXPECT_LT(absl::MaxIndexOf(absl::MakeConstSpan(all_nan)), all_nan.size());
+}
+
+TEST(Reduce, IndexVariantsMatchStdOnRandomData) {
+  std::mt19937 gen(59);
+  std::uniform_int_distribution<int> dist(0, 50);  // plenty of duplicates
+  for (size_t size : {size_t{1}, size_t{7}, size_t{64}, size_t{1000}}) {
+    std::vector<int> v(size);
+    for (int& x : v) x = dist(gen);
+    const auto span = absl::MakeConstSpan(v);
+    EXPECT_EQ(absl::MinIndexOf(span),
+              static_cast<size_t>(
+                  std::min_element(v.begin(), v.end()) - v.begin()))
+        << size;
+    EXPECT_EQ(absl::MaxIndexOf(span),
+              static_cast<size_t>(
+                  std::max_element(v.begin(), v.end()) - v.begin()))
+        << size;
+  }
+}
+
+}  // namespace
@@ -16,6 +16,7 @@
 #ifndef ABSL_BASE_INTERNAL_ENDIAN_H_
 #define ABSL_BASE_INTERNAL_ENDIAN_H_
 
+#include <cstddef>
 #include <cstdint>
 #include <cstdlib>
 
@@ -69,6 +70,29 @@ inline uint16_t gbswap_16(uint16_t host_int) {
 #endif
 }
 
+// Byteswaps each of the `len` words starting at `p` in place.  The simple
+// loops are written so that compilers recognize them as bulk byteswaps and
+// vectorize them into byte-shuffle instructions (e.g. pshufb on x86, rev on
+// ARM), so converting a large buffer runs at memory bandwidth rather than
+// one scalar bswap per word.
+inline void gbswap_16_array(absl::Nonnull<uint16_t *> p, size_t len) {
+  for (size_t i = 0; i < len; i++) {
+    p[i] = gbswap_16(p[i]);
+  }
+}
+
+inline void gbswap_32_array(absl::Nonnull<uint32_t *> p, size_t len) {
+  for (size_t i = 0; i < len; i++) {
+    p[i] = gbswap_32(p[i]);
+  }
+}
+
+inline void gbswap_64_array(absl::Nonnull<uint64_t *> p, size_t len) {
+  for (size_t i = 0; i < len; i++) {
+    p[i] = gbswap_64(p[i]);
+  }
+}
+
 #ifdef ABSL_IS_LITTLE_ENDIAN
 
 // Portable definitions for htonl (host-to-network) and friends on little-endian
@@ -160,6 +184,47 @@ inline int64_t ToHost(int64_t x) {
   return bit_cast<int64_t>(ToHost64(bit_cast<uint64_t>(x)));
 }
 
+// Bulk conversion functions: each of the `len` words starting at `p` is
+// converted in place between little-endian and host order, e.g. to decode a
+// whole buffer of little-endian words from the wire at once.  On
+// little-endian hosts these compile to nothing; otherwise they vectorize
+// (see gbswap_*_array()).
+inline void FromHost16(absl::Nonnull<uint16_t *> p, size_t len) {
+#ifdef ABSL_IS_BIG_ENDIAN
+  gbswap_16_array(p, len);
+#else
+  (void)p;
+  (void)len;
+#endif
+}
+inline void ToHost16(absl::Nonnull<uint16_t *> p, size_t len) {
+  FromHost16(p, len);
+}
+
+inline void FromHost32(absl::Nonnull<uint32_t *> p, size_t len) {
+#ifdef ABSL_IS_BIG_ENDIAN
+  gbswap_32_array(p, len);
+#else
+  (void)p;
+  (void)len;
+#endif
+}
+inline void ToHost32(absl::Nonnull<uint32_t *> p, size_t len) {
+  FromHost32(p, len);
+}
+
+inline void FromHost64(absl::Nonnull<uint64_t *> p, size_t len) {
+#ifdef ABSL_IS_BIG_ENDIAN
+  gbswap_64_array(p, len);
+#else
+  (void)p;
+  (void)len;
+#endif
+}
+inline void ToHost64(absl::Nonnull<uint64_t *> p, size_t len) {
+  FromHost64(p, len);
+}
+
 // Functions to do unaligned loads and stores in little-endian order.
 inline uint16_t Load16(absl::Nonnull<const void *> p) {
   return ToHost16(ABSL_INTERNAL_UNALIGNED_LOAD16(p));
@@ -250,6 +315,47 @@ inline int64_t ToHost(int64_t x) {
   return bit_cast<int64_t>(ToHost64(bit_cast<uint64_t>(x)));
 }
 
+// Bulk conversion functions: each of the `len` words starting at `p` is
+// converted in place between big-endian and host order, e.g. to decode a
+// whole buffer of big-endian words from the wire at once.  On big-endian
+// hosts these compile to nothing; otherwise they vectorize (see
+// gbswap_*_array()).
+inline void FromHost16(absl::Nonnull<uint16_t *> p, size_t len) {
+#ifdef ABSL_IS_LITTLE_ENDIAN
+  gbswap_16_array(p, len);
+#else
+  (void)p;
+  (void)len;
+#endif
+}
+inline void ToHost16(absl::Nonnull<uint16_t *> p, size_t len) {
+  FromHost16(p, len);
+}
+
+inline void FromHost32(absl::Nonnull<uint32_t *> p, size_t len) {
+#ifdef ABSL_IS_LITTLE_ENDIAN
+  gbswap_32_array(p, len);
+#else
+  (void)p;
+  (void)len;
+#endif
+}
+inline void ToHost32(absl::Nonnull<uint32_t *> p, size_t len) {
+  FromHost32(p, len);
+}
+
+inline void FromHost64(absl::Nonnull<uint64_t *> p, size_t len) {
+#ifdef ABSL_IS_LITTLE_ENDIAN
+  gbswap_64_array(p, len);
+#else
+  (void)p;
+  (void)len;
+#endif
+}
+inline void ToHost64(absl::Nonnull<uint64_t *> p, size_t len) {
+  FromHost64(p, len);
+}
+
 // Functions to do unaligned loads and stores in big-endian order.
 inline uint16_t Load16(absl::Nonnull<const void *> p) {
   return ToHost16(ABSL_INTERNAL_UNALIGNED_LOAD16(p));
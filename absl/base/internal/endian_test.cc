@@ -157,6 +157,59 @@ TEST(EndianessTest, Uint64) {
   GBSwapHelper(GenerateRandomIntegers<uint64_t>(kNumValuesToTest), &Swap64);
 }
 
+// Test a bulk in-place swapper against the corresponding scalar swapper,
+// using several lengths so both the vectorized body and any scalar remainder
+// of the bulk loop are exercised.
+template <typename T, typename ArraySwapper, typename ScalarSwapper>
+void GBSwapArrayHelper(const ArraySwapper& array_swapper,
+                       const ScalarSwapper& scalar_swapper) {
+  std::mt19937_64 rng(kRandomSeed);
+  for (size_t len : {size_t{0}, size_t{1}, size_t{3}, size_t{17},
+                     size_t{4096}, size_t{100003}}) {
+    std::vector<T> actual(len);
+    for (T& value : actual) {
+      value = static_cast<T>(rng());
+    }
+    std::vector<T> expected = actual;
+    array_swapper(actual.data(), actual.size());
+    for (T& value : expected) {
+      value = scalar_swapper(value);
+    }
+    ASSERT_EQ(actual, expected) << "length " << len;
+  }
+}
+
+TEST(EndianessTest, Uint16Array) {
+  GBSwapArrayHelper<uint16_t>(&gbswap_16_array, &gbswap_16);
+}
+
+TEST(EndianessTest, Uint32Array) {
+  GBSwapArrayHelper<uint32_t>(&gbswap_32_array, &gbswap_32);
+}
+
+TEST(EndianessTest, Uint64Array) {
+  GBSwapArrayHelper<uint64_t>(&gbswap_64_array, &gbswap_64);
+}
+
+TEST(EndianessTest, BulkHostConversions) {
+  std::vector<uint64_t> values = GenerateRandomIntegers<uint64_t>(1000);
+
+  std::vector<uint64_t> little = values;
+  little_endian::FromHost64(little.data(), little.size());
+  std::vector<uint64_t> big = values;
+  big_endian::FromHost64(big.data(), big.size());
+  for (size_t i = 0; i < values.size(); ++i) {
+    ASSERT_EQ(little[i], little_endian::FromHost64(values[i]));
+    ASSERT_EQ(big[i], big_endian::FromHost64(values[i]));
+  }
+
+  // The conversions are involutions: ToHost undoes FromHost.
+  little_endian::ToHost64(little.data(), little.size());
+  big_endian::ToHost64(big.data(), big.size());
+  EXPECT_EQ(little, values);
+  EXPECT_EQ(big, values);
+}
+
 TEST(EndianessTest, ghtonll_gntohll) {
   // Test that absl::ghtonl compiles correctly
   uint32_t test = 0x01234567;
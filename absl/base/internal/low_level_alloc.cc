@@ -518,96 +518,103 @@ void LowLevelAlloc::Free(void *v) {
   }
 }
 
-// allocates and returns a block of size bytes, to be freed with Free()
-// L < arena->mu
-static void *DoAllocWithArena(size_t request, LowLevelAlloc::Arena *arena) {
-  void *result = nullptr;
-  if (request != 0) {
-    AllocList *s;  // will point to region that satisfies request
-    ArenaLock section(arena);
-    // round up with header
-    size_t req_rnd =
-        RoundUp(CheckedAdd(request, sizeof(s->header)), arena->round_up);
-    for (;;) {  // loop until we find a suitable region
-      // find the minimum levels that a block of this size must have
-      int i = LLA_SkiplistLevels(req_rnd, arena->min_size, nullptr) - 1;
-      if (i < arena->freelist.levels) {        // potential blocks exist
-        AllocList *before = &arena->freelist;  // predecessor of s
-        while ((s = Next(i, before, arena)) != nullptr &&
-               s->header.size < req_rnd) {
-          before = s;
-        }
-        if (s != nullptr) {  // we found a region
-          break;
-        }
+// Allocates and returns a block of req_rnd bytes (already rounded up and
+// including the header), to be freed with Free().
+// L >= arena->mu; may temporarily release and reacquire the lock around mmap.
+static void *DoAllocLocked(size_t req_rnd, LowLevelAlloc::Arena *arena) {
+  AllocList *s;  // will point to region that satisfies request
+  for (;;) {     // loop until we find a suitable region
+    // find the minimum levels that a block of this size must have
+    int i = LLA_SkiplistLevels(req_rnd, arena->min_size, nullptr) - 1;
+    if (i < arena->freelist.levels) {        // potential blocks exist
+      AllocList *before = &arena->freelist;  // predecessor of s
+      while ((s = Next(i, before, arena)) != nullptr &&
+             s->header.size < req_rnd) {
+        before = s;
       }
-      // we unlock before mmap() both because mmap() may call a callback hook,
-      // and because it may be slow.
-      arena->mu.Unlock();
-      // mmap generous 64K chunks to decrease
-      // the chances/impact of fragmentation:
-      size_t new_pages_size = RoundUp(req_rnd, arena->pagesize * 16);
-      void *new_pages;
+      if (s != nullptr) {  // we found a region
+        break;
+      }
+    }
+    // we unlock before mmap() both because mmap() may call a callback hook,
+    // and because it may be slow.
+    arena->mu.Unlock();
+    // mmap generous 64K chunks to decrease
+    // the chances/impact of fragmentation:
+    size_t new_pages_size = RoundUp(req_rnd, arena->pagesize * 16);
+    void *new_pages;
 #ifdef _WIN32
-      new_pages = VirtualAlloc(nullptr, new_pages_size,
-                               MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
-      ABSL_RAW_CHECK(new_pages != nullptr, "VirtualAlloc failed");
+    new_pages = VirtualAlloc(nullptr, new_pages_size,
+                             MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+    ABSL_RAW_CHECK(new_pages != nullptr, "VirtualAlloc failed");
 #else
 #ifndef ABSL_LOW_LEVEL_ALLOC_ASYNC_SIGNAL_SAFE_MISSING
-      if ((arena->flags & LowLevelAlloc::kAsyncSignalSafe) != 0) {
-        new_pages = base_internal::DirectMmap(nullptr, new_pages_size,
-            PROT_WRITE|PROT_READ, MAP_ANONYMOUS|MAP_PRIVATE, -1, 0);
-      } else {
-        new_pages = mmap(nullptr, new_pages_size, PROT_WRITE | PROT_READ,
-                         MAP_ANONYMOUS | MAP_PRIVATE, -1, 0);
-      }
-#else
+    if ((arena->flags & LowLevelAlloc::kAsyncSignalSafe) != 0) {
+      new_pages = base_internal::DirectMmap(nullptr, new_pages_size,
+          PROT_WRITE|PROT_READ, MAP_ANONYMOUS|MAP_PRIVATE, -1, 0);
+    } else {
       new_pages = mmap(nullptr, new_pages_size, PROT_WRITE | PROT_READ,
                        MAP_ANONYMOUS | MAP_PRIVATE, -1, 0);
+    }
+#else
+    new_pages = mmap(nullptr, new_pages_size, PROT_WRITE | PROT_READ,
+                     MAP_ANONYMOUS | MAP_PRIVATE, -1, 0);
 #endif  // ABSL_LOW_LEVEL_ALLOC_ASYNC_SIGNAL_SAFE_MISSING
-      if (new_pages == MAP_FAILED) {
-        ABSL_RAW_LOG(FATAL, "mmap error: %d", errno);
-      }
+    if (new_pages == MAP_FAILED) {
+      ABSL_RAW_LOG(FATAL, "mmap error: %d", errno);
+    }
 
 #ifdef __linux__
 #if defined(PR_SET_VMA) && defined(PR_SET_VMA_ANON_NAME)
-      // Attempt to name the allocated address range in /proc/$PID/smaps on
-      // Linux.
-      //
-      // This invocation of prctl() may fail if the Linux kernel was not
-      // configured with the CONFIG_ANON_VMA_NAME option.  This is OK since
-      // the naming of arenas is primarily a debugging aid.
-      prctl(PR_SET_VMA, PR_SET_VMA_ANON_NAME, new_pages, new_pages_size,
-            "absl");
+    // Attempt to name the allocated address range in /proc/$PID/smaps on
+    // Linux.
+    //
+    // This invocation of prctl() may fail if the Linux kernel was not
+    // configured with the CONFIG_ANON_VMA_NAME option.  This is OK since
+    // the naming of arenas is primarily a debugging aid.
+    prctl(PR_SET_VMA, PR_SET_VMA_ANON_NAME, new_pages, new_pages_size,
+          "absl");
 #endif
 #endif  // __linux__
 #endif  // _WIN32
-      arena->mu.Lock();
-      s = reinterpret_cast<AllocList *>(new_pages);
-      s->header.size = new_pages_size;
-      // Pretend the block is allocated; call AddToFreelist() to free it.
-      s->header.magic = Magic(kMagicAllocated, &s->header);
-      s->header.arena = arena;
-      AddToFreelist(&s->levels, arena);  // insert new region into free list
-    }
-    AllocList *prev[kMaxLevel];
-    LLA_SkiplistDelete(&arena->freelist, s, prev);  // remove from free list
-    // s points to the first free region that's big enough
-    if (CheckedAdd(req_rnd, arena->min_size) <= s->header.size) {
-      // big enough to split
-      AllocList *n =
-          reinterpret_cast<AllocList *>(req_rnd + reinterpret_cast<char *>(s));
-      n->header.size = s->header.size - req_rnd;
-      n->header.magic = Magic(kMagicAllocated, &n->header);
-      n->header.arena = arena;
-      s->header.size = req_rnd;
-      AddToFreelist(&n->levels, arena);
-    }
+    arena->mu.Lock();
+    s = reinterpret_cast<AllocList *>(new_pages);
+    s->header.size = new_pages_size;
+    // Pretend the block is allocated; call AddToFreelist() to free it.
     s->header.magic = Magic(kMagicAllocated, &s->header);
-    ABSL_RAW_CHECK(s->header.arena == arena, "");
-    arena->allocation_count++;
+    s->header.arena = arena;
+    AddToFreelist(&s->levels, arena);  // insert new region into free list
+  }
+  AllocList *prev[kMaxLevel];
+  LLA_SkiplistDelete(&arena->freelist, s, prev);  // remove from free list
+  // s points to the first free region that's big enough
+  if (CheckedAdd(req_rnd, arena->min_size) <= s->header.size) {
+    // big enough to split
+    AllocList *n =
+        reinterpret_cast<AllocList *>(req_rnd + reinterpret_cast<char *>(s));
+    n->header.size = s->header.size - req_rnd;
+    n->header.magic = Magic(kMagicAllocated, &n->header);
+    n->header.arena = arena;
+    s->header.size = req_rnd;
+    AddToFreelist(&n->levels, arena);
+  }
+  s->header.magic = Magic(kMagicAllocated, &s->header);
+  ABSL_RAW_CHECK(s->header.arena == arena, "");
+  arena->allocation_count++;
+  return &s->levels;
+}
+
+// allocates and returns a block of size bytes, to be freed with Free()
+// L < arena->mu
+static void *DoAllocWithArena(size_t request, LowLevelAlloc::Arena *arena) {
+  void *result = nullptr;
+  if (request != 0) {
+    ArenaLock section(arena);
+    // round up with header
+    size_t req_rnd = RoundUp(CheckedAdd(request, sizeof(AllocList::Header)),
+                             arena->round_up);
+    result = DoAllocLocked(req_rnd, arena);
     section.Leave();
-    result = &s->levels;
   }
   ABSL_ANNOTATE_MEMORY_IS_UNINITIALIZED(result, request);
   return result;
@@ -624,6 +631,238 @@ void *LowLevelAlloc::AllocWithArena(size_t request, Arena *arena) {
   return result;
 }
 
+// ---------------------------------------------------------------------------
+// Thread cache implementation
+//
+// Each thread keeps small per-size-class freelists ("magazines") of recently
+// freed blocks.  A cache hit reuses a block without touching the arena lock;
+// misses refill from the arena in batches, and overfull magazines return half
+// their blocks to the arena in one locked section, so the lock is acquired
+// once per batch rather than once per block.  Cached blocks keep their
+// headers intact (size, arena, allocated magic), so a cached block can always
+// fall back to the ordinary Free() path.
+//
+// The cache is bypassed entirely for arenas created with kAsyncSignalSafe: a
+// signal handler could interrupt the owning thread mid-update and observe a
+// magazine in an inconsistent state, so those arenas keep the existing
+// signal-blocking locked path unchanged.
+
+#ifdef ABSL_HAVE_THREAD_LOCAL
+
+namespace {
+
+// All block sizes are multiples of this; it is the smallest possible
+// round_up of any arena.  Magazines are indexed by size / kCacheGranularity.
+constexpr size_t kCacheGranularity = 16;
+
+// Largest block (including header) served from the thread cache.  Larger
+// requests go straight to the arena.
+constexpr size_t kMaxCachedBlockBytes = 512;
+
+// An allocation may return a block with up to min_size - round_up bytes of
+// slack when the remainder was too small to split off; magazines must cover
+// those sizes too.  min_size == 2 * round_up <= 64 on all platforms.
+constexpr size_t kMaxCacheSlack = 64;
+
+constexpr int kCacheBins =
+    static_cast<int>((kMaxCachedBlockBytes + kMaxCacheSlack) /
+                     kCacheGranularity);
+
+// Blocks held in one magazine before half of them are returned to the arena.
+constexpr int kCacheBinCapacity = 32;
+
+// Blocks fetched from the arena on a cache miss.
+constexpr int kCacheRefillCount = 8;
+
+// Arenas a single thread may cache blocks for at once; frees to further
+// arenas fall back to the ordinary locked path.
+constexpr int kCacheArenas = 4;
+
+// Returns the header of the block whose client region starts at v.
+AllocList::Header *BlockHeader(void *v) {
+  return &reinterpret_cast<AllocList *>(reinterpret_cast<char *>(v) -
+                                        sizeof(AllocList::Header))
+              ->header;
+}
+
+// Returns a batch of cached blocks to their arena in one locked section.
+void ReturnBatchToArena(LowLevelAlloc::Arena *arena, void **batch, int n) {
+  ArenaLock section(arena);
+  for (int i = 0; i < n; i++) {
+    AddToFreelist(batch[i], arena);
+    ABSL_RAW_CHECK(arena->allocation_count > 0, "nothing in arena to free");
+    arena->allocation_count--;
+  }
+  section.Leave();
+}
+
+class ThreadCache {
+ public:
+  constexpr ThreadCache() = default;
+  ~ThreadCache() { Flush(); }
+
+  // Returns a block of req_rnd bytes (including header) from arena, serving
+  // it from this thread's magazine when possible.
+  void *Alloc(size_t request, size_t req_rnd, LowLevelAlloc::Arena *arena) {
+    Shard *shard = FindShard(arena);
+    if (shard == nullptr) {  // all shards in use by other arenas
+      return DoAllocWithArena(request, arena);
+    }
+    Bin *bin = &shard->bins[req_rnd / kCacheGranularity];
+    if (bin->head == nullptr) {
+      // Miss: refill from the arena under a single lock acquisition.  The
+      // first block satisfies the request; the rest are binned by their
+      // exact size (a block may be larger than req_rnd when the remainder
+      // was too small to split off).
+      void *batch[kCacheRefillCount];
+      {
+        ArenaLock section(arena);
+        for (int i = 0; i < kCacheRefillCount; i++) {
+          batch[i] = DoAllocLocked(req_rnd, arena);
+        }
+        section.Leave();
+      }
+      for (int i = 1; i < kCacheRefillCount; i++) {
+        Push(&shard->bins[BlockHeader(batch[i])->size / kCacheGranularity],
+             batch[i]);
+      }
+      ABSL_ANNOTATE_MEMORY_IS_UNINITIALIZED(batch[0], request);
+      return batch[0];
+    }
+    void *v = Pop(bin);
+    ABSL_ANNOTATE_MEMORY_IS_UNINITIALIZED(v, request);
+    return v;
+  }
+
+  // Caches the block whose client region starts at v.  Returns false if the
+  // block cannot be cached (too large, or no shard available for its arena),
+  // in which case the caller must free it through the arena.
+  bool Free(void *v, LowLevelAlloc::Arena *arena) {
+    AllocList::Header *header = BlockHeader(v);
+    size_t index = header->size / kCacheGranularity;
+    if (index >= kCacheBins) return false;
+    Shard *shard = FindShard(arena);
+    if (shard == nullptr) return false;
+    ABSL_RAW_CHECK(header->magic == Magic(kMagicAllocated, header),
+                   "bad magic number in FreeWithThreadCache()");
+    Bin *bin = &shard->bins[index];
+    Push(bin, v);
+    if (bin->count >= kCacheBinCapacity) {
+      // Overfull: return half of the magazine in one locked section.
+      void *batch[kCacheBinCapacity / 2];
+      for (int i = 0; i < kCacheBinCapacity / 2; i++) {
+        batch[i] = Pop(bin);
+      }
+      ReturnBatchToArena(arena, batch, kCacheBinCapacity / 2);
+    }
+    return true;
+  }
+
+  // Returns every cached block to its arena and releases all shards.
+  void Flush() {
+    for (Shard &shard : shards_) {
+      if (shard.arena == nullptr) continue;
+      for (Bin &bin : shard.bins) {
+        void *batch[kCacheBinCapacity];
+        int n = 0;
+        while (bin.head != nullptr) {
+          batch[n++] = Pop(&bin);
+        }
+        if (n != 0) ReturnBatchToArena(shard.arena, batch, n);
+      }
+      shard.arena = nullptr;
+    }
+  }
+
+ private:
+  // A magazine of free blocks of one size, linked through their first word.
+  struct Bin {
+    void *head = nullptr;
+    int count = 0;
+  };
+
+  // The magazines for one arena.
+  struct Shard {
+    LowLevelAlloc::Arena *arena = nullptr;
+    Bin bins[kCacheBins];
+  };
+
+  // Returns this thread's shard for arena, claiming an unused shard slot if
+  // necessary, or nullptr if all slots belong to other arenas.
+  Shard *FindShard(LowLevelAlloc::Arena *arena) {
+    for (Shard &shard : shards_) {
+      if (shard.arena == arena) return &shard;
+    }
+    for (Shard &shard : shards_) {
+      if (shard.arena == nullptr) {
+        shard.arena = arena;
+        return &shard;
+      }
+    }
+    return nullptr;
+  }
+
+  static void Push(Bin *bin, void *v) {
+    *reinterpret_cast<void **>(v) = bin->head;
+    bin->head = v;
+    bin->count++;
+  }
+
+  static void *Pop(Bin *bin) {
+    void *v = bin->head;
+    bin->head = *reinterpret_cast<void **>(v);
+    bin->count--;
+    return v;
+  }
+
+  Shard shards_[kCacheArenas];
+};
+
+thread_local ThreadCache thread_cache;
+
+// Returns true if blocks from arena may pass through the thread cache.
+bool ArenaIsCacheable(LowLevelAlloc::Arena *arena) {
+#ifndef ABSL_LOW_LEVEL_ALLOC_ASYNC_SIGNAL_SAFE_MISSING
+  return (arena->flags & LowLevelAlloc::kAsyncSignalSafe) == 0;
+#else
+  (void)arena;
+  return true;
+#endif
+}
+
+}  // namespace
+
+#endif  // ABSL_HAVE_THREAD_LOCAL
+
+void *LowLevelAlloc::AllocWithThreadCache(size_t request, Arena *arena) {
+  ABSL_RAW_CHECK(arena != nullptr, "must pass a valid arena");
+#ifdef ABSL_HAVE_THREAD_LOCAL
+  if (request != 0 && ArenaIsCacheable(arena)) {
+    size_t req_rnd = RoundUp(CheckedAdd(request, sizeof(AllocList::Header)),
+                             arena->round_up);
+    if (req_rnd <= kMaxCachedBlockBytes) {
+      return thread_cache.Alloc(request, req_rnd, arena);
+    }
+  }
+#endif
+  return DoAllocWithArena(request, arena);
+}
+
+void LowLevelAlloc::FreeWithThreadCache(void *v) {
+  if (v == nullptr) return;
+#ifdef ABSL_HAVE_THREAD_LOCAL
+  Arena *arena = BlockHeader(v)->arena;
+  if (ArenaIsCacheable(arena) && thread_cache.Free(v, arena)) return;
+#endif
+  Free(v);
+}
+
+void LowLevelAlloc::FlushThreadCache() {
+#ifdef ABSL_HAVE_THREAD_LOCAL
+  thread_cache.Flush();
+#endif
+}
+
 }  // namespace base_internal
 ABSL_NAMESPACE_END
 }  // namespace absl
@@ -85,6 +85,27 @@ class LowLevelAlloc {
   // into special section,
   // so that MallocHook::GetCallerStackTrace can function accurately.
 
+  // Variants of AllocWithArena() and Free() that keep small per-thread
+  // freelists ("magazines") of recently freed blocks, refilled in batches
+  // from the arena, so that most calls complete without acquiring the arena
+  // lock.  Blocks allocated with either variant may be freed with either
+  // Free() or FreeWithThreadCache(); the cached variants only add a fast
+  // path.  Arenas created with kAsyncSignalSafe bypass the cache (a signal
+  // handler could observe a thread's cache mid-update) and keep their
+  // async-signal-safety guarantees, as do requests too large to cache and
+  // platforms without thread_local support.
+  //
+  // Cached blocks count as allocated for DeleteArena() purposes: every
+  // thread that used the cache with an arena must call FlushThreadCache()
+  // (or exit, which flushes implicitly) before that arena can be deleted.
+  static void *AllocWithThreadCache(size_t request, Arena *arena)
+      ABSL_ATTRIBUTE_SECTION(malloc_hook);
+  static void FreeWithThreadCache(void *s)
+      ABSL_ATTRIBUTE_SECTION(malloc_hook);
+
+  // Returns every block cached by the calling thread to its arena.
+  static void FlushThreadCache();
+
   // Create a new arena.
   // The root metadata for the new arena is allocated in the
   // meta_data_arena; the DefaultArena() can be passed for meta_data_arena.
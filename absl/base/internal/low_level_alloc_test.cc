@@ -144,12 +144,82 @@ static void Test(bool use_new_arena, bool call_malloc_hook, int n) {
   }
 }
 
+// Exercise the thread-cached interface from several threads at once:
+// allocate and free blocks small enough to pass through the per-thread
+// magazines, mix in the uncached Alloc/Free paths (blocks may be allocated
+// by one interface and freed by the other), and check that DeleteArena()
+// succeeds once every thread has flushed its cache.
+static void TestThreadCache(int n) {
+  LowLevelAlloc::Arena *arena = LowLevelAlloc::NewArena(0);
+  std::thread threads[4];
+  int tid = 0;
+  for (std::thread &t : threads) {
+    t = std::thread([arena, n, tid]() {
+      // rand() is not required to be thread-safe; use a local generator.
+      uint32_t seed = 0x12345 + static_cast<uint32_t>(tid);
+      auto next_rand = [&seed]() {
+        seed = seed * 1103515245 + 12345;
+        return static_cast<int>((seed >> 16) & 0x7fff);
+      };
+      typedef absl::node_hash_map<int, BlockDesc> AllocMap;
+      AllocMap allocated;
+      AllocMap::iterator it;
+      BlockDesc block_desc;
+      for (int i = 0; i != n; i++) {
+        if ((next_rand() & 1) == 0) {  // add a block
+          // mostly cacheable sizes, occasionally too large for the cache
+          block_desc.len = (next_rand() & 7) == 0 ? (next_rand() & 0x3fff)
+                                                  : (next_rand() & 0x1ff);
+          block_desc.ptr = reinterpret_cast<char *>(
+              (next_rand() & 3) == 0
+                  ? LowLevelAlloc::AllocWithArena(block_desc.len, arena)
+                  : LowLevelAlloc::AllocWithThreadCache(block_desc.len,
+                                                        arena));
+          RandomizeBlockDesc(&block_desc);
+          int rnd = next_rand();
+          it = allocated.find(rnd);
+          if (it != allocated.end()) {  // key conflict: free the older block
+            CheckBlockDesc(it->second);
+            LowLevelAlloc::FreeWithThreadCache(it->second.ptr);
+            it->second = block_desc;
+          } else {
+            allocated[rnd] = block_desc;
+          }
+        } else {  // remove a block
+          it = allocated.begin();
+          if (it != allocated.end()) {
+            CheckBlockDesc(it->second);
+            if ((next_rand() & 3) == 0) {
+              LowLevelAlloc::Free(it->second.ptr);
+            } else {
+              LowLevelAlloc::FreeWithThreadCache(it->second.ptr);
+            }
+            allocated.erase(it);
+          }
+        }
+      }
+      while ((it = allocated.begin()) != allocated.end()) {
+        CheckBlockDesc(it->second);
+        LowLevelAlloc::FreeWithThreadCache(it->second.ptr);
+        allocated.erase(it);
+      }
+      LowLevelAlloc::FlushThreadCache();
+    });
+    tid++;
+  }
+  for (std::thread &t : threads) {
+    t.join();
+  }
+  TEST_ASSERT(LowLevelAlloc::DeleteArena(arena));
+}
+
 // LowLevelAlloc is designed to be safe to call before main().
 static struct BeforeMain {
   BeforeMain() {
     Test(false, false, 50000);
     Test(true, false, 50000);
     Test(true, true, 50000);
+    TestThreadCache(50000);
   }
 } before_main;
 
@@ -381,6 +381,220 @@ double NominalCPUFrequency() {
   return nominal_cpu_frequency;
 }
 
+#if defined(__linux__)
+
+// Reads a small sysfs file into `buf`, NUL-terminating it. Returns false if
+// the file cannot be read.
+static bool ReadSmallTextFile(const char *file, char *buf, size_t buf_size) {
+#if defined(_POSIX_C_SOURCE)
+  const int file_mode = (O_RDONLY | O_CLOEXEC);
+#else
+  const int file_mode = O_RDONLY;
+#endif
+  int fd = open(file, file_mode);
+  if (fd == -1) return false;
+  ssize_t len;
+  do {
+    len = read(fd, buf, buf_size - 1);
+  } while (len < 0 && errno == EINTR);
+  close(fd);
+  if (len <= 0) return false;
+  buf[len] = '\0';
+  return true;
+}
+
+// Parses a sysfs cache size string such as "32K" or "8M" into bytes.
+// Returns 0 on parse failure.
+static size_t ParseCacheSize(const char *s) {
+  char *end;
+  const long value = strtol(s, &end, 10);
+  if (end == s || value <= 0) return 0;
+  size_t bytes = static_cast<size_t>(value);
+  if (*end == 'K') {
+    bytes *= 1024;
+  } else if (*end == 'M') {
+    bytes *= 1024 * 1024;
+  } else if (*end == 'G') {
+    bytes *= 1024 * 1024 * 1024;
+  }
+  return bytes;
+}
+
+// Counts the CPUs named by a sysfs CPU list such as "0-3,8-11,16".
+static int CountCpusInList(const char *s) {
+  int count = 0;
+  const char *p = s;
+  while (true) {
+    char *end;
+    const long first = strtol(p, &end, 10);
+    if (end == p || first < 0) break;
+    long last = first;
+    if (*end == '-') {
+      p = end + 1;
+      last = strtol(p, &end, 10);
+      if (end == p || last < first) break;
+    }
+    count += static_cast<int>(last - first + 1);
+    if (*end != ',') break;
+    p = end + 1;
+  }
+  return count;
+}
+
+static CacheGeometry ReadCacheGeometry() {
+  CacheGeometry geometry = {};
+  int llc_level = 0;
+  char path[128];
+  char buf[1024];
+  // cpu0's view of the cache hierarchy; caches are assumed homogeneous.
+  for (int index = 0; index < 16; index++) {
+    snprintf(path, sizeof(path),
+             "/sys/devices/system/cpu/cpu0/cache/index%d/type", index);
+    if (!ReadSmallTextFile(path, buf, sizeof(buf))) break;
+    // Instruction caches do not affect data blocking decisions.
+    if (strncmp(buf, "Data", 4) != 0 && strncmp(buf, "Unified", 7) != 0) {
+      continue;
+    }
+    snprintf(path, sizeof(path),
+             "/sys/devices/system/cpu/cpu0/cache/index%d/level", index);
+    long level = 0;
+    if (!ReadLongFromFile(path, &level) || level <= 0) continue;
+    snprintf(path, sizeof(path),
+             "/sys/devices/system/cpu/cpu0/cache/index%d/size", index);
+    size_t cache_size = 0;
+    if (ReadSmallTextFile(path, buf, sizeof(buf))) {
+      cache_size = ParseCacheSize(buf);
+    }
+    snprintf(path, sizeof(path),
+             "/sys/devices/system/cpu/cpu0/cache/index%d/coherency_line_size",
+             index);
+    long line_size = 0;
+    if (ReadLongFromFile(path, &line_size) && line_size > 0) {
+      geometry.cache_line_size = static_cast<size_t>(line_size);
+    }
+    if (level == 1) {
+      geometry.l1d_cache_size = cache_size;
+    } else if (level == 2) {
+      geometry.l2_cache_size = cache_size;
+    }
+    if (level >= llc_level) {
+      llc_level = static_cast<int>(level);
+      geometry.llc_cache_size = cache_size;
+      snprintf(path, sizeof(path),
+               "/sys/devices/system/cpu/cpu0/cache/index%d/shared_cpu_list",
+               index);
+      if (ReadSmallTextFile(path, buf, sizeof(buf))) {
+        geometry.num_cpus_sharing_llc = CountCpusInList(buf);
+      }
+    }
+  }
+  return geometry;
+}
+
+#elif defined(__APPLE__)
+
+static CacheGeometry ReadCacheGeometry() {
+  CacheGeometry geometry = {};
+  const struct {
+    const char *name;
+    size_t *field;
+  } kEntries[] = {
+      {"hw.l1dcachesize", &geometry.l1d_cache_size},
+      {"hw.l2cachesize", &geometry.l2_cache_size},
+      {"hw.l3cachesize", &geometry.llc_cache_size},
+      {"hw.cachelinesize", &geometry.cache_line_size},
+  };
+  for (const auto &entry : kEntries) {
+    int64_t value = 0;
+    size_t value_size = sizeof(value);
+    if (sysctlbyname(entry.name, &value, &value_size, nullptr, 0) == 0 &&
+        value > 0) {
+      *entry.field = static_cast<size_t>(value);
+    }
+  }
+  // Apple hardware has no (exposed) L3 on some models; fall back to L2 as
+  // the effective last-level cache.
+  if (geometry.llc_cache_size == 0) {
+    geometry.llc_cache_size = geometry.l2_cache_size;
+  }
+  return geometry;
+}
+
+#else
+
+// No portable way to query the cache hierarchy; report everything unknown.
+static CacheGeometry ReadCacheGeometry() { return CacheGeometry{}; }
+
+#endif
+
+ABSL_CONST_INIT static once_flag init_cache_geometry_once;
+ABSL_CONST_INIT static CacheGeometry cache_geometry = {};
+
+const CacheGeometry &GetCacheGeometry() {
+  base_internal::LowLevelCallOnce(&init_cache_geometry_once,
+                                  []() { cache_geometry = ReadCacheGeometry(); });
+  return cache_geometry;
+}
+
+// Per-CPU NUMA node cache. Sized generously so the table can live in static
+// storage; CPUs beyond the table (or unknown topologies) report node 0,
+// which is always a valid node to allocate on.
+constexpr int kMaxNumaCachedCpus = 4096;
+ABSL_CONST_INIT static once_flag init_numa_nodes_once;
+ABSL_CONST_INIT static int16_t numa_node_of_cpu[kMaxNumaCachedCpus] = {};
+
+static void InitNumaNodeOfCpu() {
+#if defined(__linux__)
+  char path[128];
+  char buf[4096];
+  for (int node = 0; node < 1024; node++) {
+    snprintf(path, sizeof(path), "/sys/devices/system/node/node%d/cpulist",
+             node);
+    if (!ReadSmallTextFile(path, buf, sizeof(buf))) break;
+    const char *p = buf;
+    while (true) {
+      char *end;
+      const long first = strtol(p, &end, 10);
+      if (end == p || first < 0) break;
+      long last = first;
+      if (*end == '-') {
+        p = end + 1;
+        last = strtol(p, &end, 10);
+        if (end == p || last < first) break;
+      }
+      for (long cpu = first; cpu <= last && cpu < kMaxNumaCachedCpus; cpu++) {
+        numa_node_of_cpu[cpu] = static_cast<int16_t>(node);
+      }
+      if (*end != ',') break;
+      p = end + 1;
+    }
+  }
+#endif
+}
+
+int NumaNodeOfCpu(int cpu) {
+  base_internal::LowLevelCallOnce(&init_numa_nodes_once, InitNumaNodeOfCpu);
+  if (cpu < 0 || cpu >= kMaxNumaCachedCpus) return 0;
+  return numa_node_of_cpu[cpu];
+}
+
+#if defined(__linux__) && !defined(SYS_getcpu) && defined(__NR_getcpu)
+#define SYS_getcpu __NR_getcpu
+#endif
+
+int CurrentNumaNode() {
+#if defined(__linux__) && defined(SYS_getcpu)
+  unsigned int cpu = 0;
+  unsigned int node = 0;
+  if (syscall(SYS_getcpu, &cpu, &node, nullptr) == 0) {
+    return static_cast<int>(node);
+  }
+  return 0;
+#else
+  return 0;
+#endif
+}
+
 #if defined(_WIN32)
 
 pid_t GetTID() {
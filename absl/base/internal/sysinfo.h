@@ -28,6 +28,7 @@
 #include <sys/types.h>
 #endif
 
+#include <cstddef>
 #include <cstdint>
 
 #include "absl/base/config.h"
@@ -45,6 +46,33 @@ double NominalCPUFrequency();
 // Number of logical processors (hyperthreads) in system. Thread-safe.
 int NumCPUs();
 
+// Sizes (in bytes) of the data caches visible to the CPU the topology was
+// read from (CPU 0), and how widely the last-level cache is shared. A field
+// is 0 when the property cannot be determined on this platform.
+struct CacheGeometry {
+  size_t l1d_cache_size;
+  size_t l2_cache_size;
+  size_t llc_cache_size;  // Last-level (typically L3) data or unified cache.
+  size_t cache_line_size;
+  int num_cpus_sharing_llc;  // Logical CPUs sharing the last-level cache.
+};
+
+// Returns the cache geometry of the machine, computed once on first use.
+// Useful for sizing blocked algorithms and sharded data structures.
+// Thread-safe.
+const CacheGeometry& GetCacheGeometry();
+
+// Returns the NUMA node that logical CPU `cpu` belongs to, or 0 if the
+// topology cannot be determined (non-Linux platforms, single-node machines,
+// or `cpu` out of range). The per-CPU mapping is computed once on first use.
+// Thread-safe.
+int NumaNodeOfCpu(int cpu);
+
+// Returns the NUMA node of the CPU the calling thread is currently running
+// on, or 0 if it cannot be determined. The thread may migrate to another
+// node at any time, so this is only a scheduling hint. Thread-safe.
+int CurrentNumaNode();
+
 // Return the thread id of the current thread, as told by the system.
 // No two currently-live threads implemented by the OS shall have the same ID.
 // Thread ids of exited threads may be reused.   Multiple user-level threads
@@ -82,6 +82,54 @@ TEST(SysinfoTest, LinuxGetTID) {
 }
 #endif
 
+TEST(SysinfoTest, GetCacheGeometry) {
+  const CacheGeometry& geometry = GetCacheGeometry();
+  // Fields are zero when unknown, so only check internal consistency and
+  // plausibility of the values that are reported.
+  if (geometry.cache_line_size != 0) {
+    EXPECT_GE(geometry.cache_line_size, 16);
+    EXPECT_EQ(geometry.cache_line_size & (geometry.cache_line_size - 1), 0)
+        << "line size should be a power of two";
+  }
+  if (geometry.l1d_cache_size != 0 && geometry.l2_cache_size != 0) {
+    EXPECT_LE(geometry.l1d_cache_size, geometry.l2_cache_size);
+  }
+  if (geometry.l2_cache_size != 0 && geometry.llc_cache_size != 0) {
+    EXPECT_LE(geometry.l2_cache_size, geometry.llc_cache_size);
+  }
+  if (geometry.num_cpus_sharing_llc != 0) {
+    EXPECT_GE(geometry.num_cpus_sharing_llc, 1);
+    EXPECT_LE(geometry.num_cpus_sharing_llc, NumCPUs());
+  }
+#ifdef __linux__
+  // Linux exposes the hierarchy through sysfs, so at least the L1 data cache
+  // should be visible.
+  EXPECT_GT(geometry.l1d_cache_size, 0);
+#endif
+  // The geometry is cached; repeated calls return the same object.
+  EXPECT_EQ(&GetCacheGeometry(), &geometry);
+}
+
+TEST(SysinfoTest, NumaNodeOfCpu) {
+  for (int cpu = 0; cpu < NumCPUs(); cpu++) {
+    EXPECT_GE(NumaNodeOfCpu(cpu), 0) << "cpu " << cpu;
+  }
+  // Out-of-range CPUs map to node 0 rather than failing.
+  EXPECT_EQ(NumaNodeOfCpu(-1), 0);
+  EXPECT_EQ(NumaNodeOfCpu(1 << 20), 0);
+}
+
+TEST(SysinfoTest, CurrentNumaNode) {
+  const int node = CurrentNumaNode();
+  EXPECT_GE(node, 0);
+  // The current node must be one some CPU maps to.
+  bool found = false;
+  for (int cpu = 0; cpu < NumCPUs() && !found; cpu++) {
+    found = NumaNodeOfCpu(cpu) == node;
+  }
+  EXPECT_TRUE(found);
+}
+
 }  // namespace
 }  // namespace base_internal
 ABSL_NAMESPACE_END
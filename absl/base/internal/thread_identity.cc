@@ -124,6 +124,12 @@ void SetCurrentThreadIdentity(ThreadIdentity* identity,
 #endif
 }
 
+int ClaimThreadIdentitySlot() {
+  static std::atomic<int> next_slot{0};
+  int slot = next_slot.fetch_add(1, std::memory_order_relaxed);
+  return slot < ThreadIdentity::kNumUserSlots ? slot : -1;
+}
+
 #if ABSL_THREAD_IDENTITY_MODE == ABSL_THREAD_IDENTITY_MODE_USE_TLS || \
     ABSL_THREAD_IDENTITY_MODE == ABSL_THREAD_IDENTITY_MODE_USE_CPP11
 
@@ -157,6 +157,18 @@ struct ThreadIdentity {
   std::atomic<int> wait_start;  // Ticker value when thread started waiting.
   std::atomic<bool> is_idle;    // Has thread become idle yet?
 
+  // Pointer-sized slots for per-thread state of libraries outside Abseil's
+  // own internals, e.g. tracing contexts.  Indices are claimed process-wide
+  // with ClaimThreadIdentitySlot() and accessed through
+  // {Get,Set}ThreadIdentitySlot().  Because they live on the structure
+  // Abseil already touches on every synchronization operation, reading a
+  // slot on a hot path costs no extra cache line over a plain thread_local
+  // on platforms where ThreadIdentity is reached faster.  Slots read as
+  // null until the thread stores into them, and are reset to null when a
+  // ThreadIdentity is reused for a new thread.
+  static constexpr int kNumUserSlots = 4;
+  void* user_slots[kNumUserSlots];
+
   ThreadIdentity* next;
 };
 
@@ -189,6 +201,30 @@ void SetCurrentThreadIdentity(ThreadIdentity* identity,
 // from that function.
 void ClearCurrentThreadIdentity();
 
+// Claims exclusive ownership of one of the ThreadIdentity::user_slots
+// indices for the lifetime of the process and returns it, or returns -1 if
+// every slot has already been claimed.  Intended to be called once at
+// startup per library that needs a slot.  Thread-safe.
+int ClaimThreadIdentitySlot();
+
+// Returns the calling thread's value for the given claimed slot, or null if
+// the thread has not stored into the slot (or has no ThreadIdentity yet).
+inline void* GetThreadIdentitySlot(int slot) {
+  ThreadIdentity* identity = CurrentThreadIdentityIfPresent();
+  return identity != nullptr ? identity->user_slots[slot] : nullptr;
+}
+
+// Stores `value` in the calling thread's entry for the given claimed slot.
+// Returns false without storing if the thread has no ThreadIdentity yet (one
+// is created by the thread's first synchronization operation, or by
+// synchronization_internal::GetOrCreateCurrentThreadIdentity()).
+inline bool SetThreadIdentitySlot(int slot, void* value) {
+  ThreadIdentity* identity = CurrentThreadIdentityIfPresent();
+  if (identity == nullptr) return false;
+  identity->user_slots[slot] = value;
+  return true;
+}
+
 // May be chosen at compile time via: -DABSL_FORCE_THREAD_IDENTITY_MODE=<mode
 // index>
 #ifdef ABSL_THREAD_IDENTITY_MODE_USE_POSIX_SETSPECIFIC
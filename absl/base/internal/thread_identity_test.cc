@@ -123,6 +123,47 @@ TEST(ThreadIdentityTest, ReusedThreadIdentityMutexTest) {
   }
 }
 
+TEST(ThreadIdentityTest, UserSlots) {
+  // Slot indices are claimed process-wide and distinct.  Claim two here;
+  // other users in this process (if any) only shrink what is left over.
+  int slot_a = ClaimThreadIdentitySlot();
+  int slot_b = ClaimThreadIdentitySlot();
+  ASSERT_GE(slot_a, 0);
+  ASSERT_GE(slot_b, 0);
+  EXPECT_NE(slot_a, slot_b);
+
+  // Unwritten slots read as null once an identity exists.
+  ASSERT_TRUE(synchronization_internal::GetOrCreateCurrentThreadIdentity() !=
+              nullptr);
+  EXPECT_EQ(GetThreadIdentitySlot(slot_a), nullptr);
+
+  int value_main = 0;
+  EXPECT_TRUE(SetThreadIdentitySlot(slot_a, &value_main));
+  EXPECT_EQ(GetThreadIdentitySlot(slot_a), &value_main);
+  EXPECT_EQ(GetThreadIdentitySlot(slot_b), nullptr);
+
+  // Each thread sees its own value, and new threads (including those reusing
+  // a recycled ThreadIdentity) start with null slots.
+  static const int kNumLoops = 3;
+  static const int kNumThreads = 8;
+  for (int iter = 0; iter < kNumLoops; iter++) {
+    std::vector<std::thread> threads;
+    for (int i = 0; i < kNumThreads; ++i) {
+      threads.push_back(std::thread([slot_a] {
+        synchronization_internal::GetOrCreateCurrentThreadIdentity();
+        EXPECT_EQ(GetThreadIdentitySlot(slot_a), nullptr);
+        int value = 0;
+        EXPECT_TRUE(SetThreadIdentitySlot(slot_a, &value));
+        EXPECT_EQ(GetThreadIdentitySlot(slot_a), &value);
+      }));
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  }
+  EXPECT_EQ(GetThreadIdentitySlot(slot_a), &value_main);
+}
+
 }  // namespace
 }  // namespace base_internal
 ABSL_NAMESPACE_END
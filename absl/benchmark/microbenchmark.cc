@@ -0,0 +1,141 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/benchmark/microbenchmark.h"
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "absl/base/config.h"
+#include "absl/base/internal/cycleclock.h"
+#include "absl/functional/function_ref.h"
+#include "absl/strings/escaping.h"
+#include "absl/strings/str_format.h"
+#include "absl/strings/string_view.h"
+#include "absl/time/clock.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+namespace {
+
+// Mean, sample standard deviation, and normal-approximation 95% confidence
+// interval of `samples`.
+MetricSummary Summarize(const std::vector<double>& samples) {
+  MetricSummary summary;
+  if (samples.empty()) return summary;
+  double sum = 0.0;
+  for (double sample : samples) sum += sample;
+  summary.mean = sum / static_cast<double>(samples.size());
+  if (samples.size() > 1) {
+    double sq_sum = 0.0;
+    for (double sample : samples) {
+      const double d = sample - summary.mean;
+      sq_sum += d * d;
+    }
+    summary.stddev = std::sqrt(sq_sum / static_cast<double>(samples.size() - 1));
+  }
+  const double half_width =
+      1.96 * summary.stddev / std::sqrt(static_cast<double>(samples.size()));
+  summary.ci95_low = summary.mean - half_width;
+  summary.ci95_high = summary.mean + half_width;
+  return summary;
+}
+
+void AppendMetricJson(std::string* out, absl::string_view name,
+                      const MetricSummary& summary) {
+  absl::StrAppendFormat(
+      out,
+      "\"%s\":{\"mean\":%.6g,\"stddev\":%.6g,\"ci95_low\":%.6g,"
+      "\"ci95_high\":%.6g}",
+      name, summary.mean, summary.stddev, summary.ci95_low, summary.ci95_high);
+}
+
+}  // namespace
+
+std::string MicrobenchmarkResult::ToJson() const {
+  std::string out;
+  absl::StrAppendFormat(
+      &out, "{\"name\":\"%s\",\"iterations\":%d,\"repetitions\":%d,",
+      absl::CEscape(name), iterations_per_repetition, repetitions);
+  absl::StrAppendFormat(&out, "\"pinned\":%s,\"metrics\":{",
+                        pinned ? "true" : "false");
+  AppendMetricJson(&out, "ns_per_iteration", ns_per_iteration);
+  out.push_back(',');
+  AppendMetricJson(&out, "cycles_per_iteration", cycles_per_iteration);
+  out.append("}}");
+  return out;
+}
+
+bool PinThreadToCpu(int cpu) {
+#ifdef __linux__
+  if (cpu < 0) return false;
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  CPU_SET(cpu, &cpu_set);
+  return sched_setaffinity(0, sizeof(cpu_set), &cpu_set) == 0;
+#else
+  static_cast<void>(cpu);
+  return false;
+#endif
+}
+
+MicrobenchmarkResult RunMicrobenchmark(absl::string_view name,
+                                       const MicrobenchmarkOptions& options,
+                                       absl::FunctionRef<void()> body) {
+  MicrobenchmarkResult result;
+  result.name = std::string(name);
+  result.iterations_per_repetition = options.iterations_per_repetition;
+  result.repetitions = options.repetitions;
+  if (options.pin_to_cpu >= 0) {
+    result.pinned = PinThreadToCpu(options.pin_to_cpu);
+  }
+
+  // One untimed warmup repetition populates caches, faults in pages, and
+  // lets the body reach a steady state before measurement.
+  for (int64_t i = 0; i < options.iterations_per_repetition; i++) {
+    body();
+  }
+
+  std::vector<double> ns_samples;
+  std::vector<double> cycle_samples;
+  ns_samples.reserve(static_cast<size_t>(options.repetitions));
+  cycle_samples.reserve(static_cast<size_t>(options.repetitions));
+  const double iterations =
+      static_cast<double>(options.iterations_per_repetition);
+  for (int rep = 0; rep < options.repetitions; rep++) {
+    const int64_t start_ns = absl::GetCurrentTimeNanos();
+    const int64_t start_cycles = base_internal::CycleClock::Now();
+    for (int64_t i = 0; i < options.iterations_per_repetition; i++) {
+      body();
+    }
+    const int64_t stop_cycles = base_internal::CycleClock::Now();
+    const int64_t stop_ns = absl::GetCurrentTimeNanos();
+    ns_samples.push_back(static_cast<double>(stop_ns - start_ns) / iterations);
+    cycle_samples.push_back(static_cast<double>(stop_cycles - start_cycles) /
+                            iterations);
+  }
+
+  result.ns_per_iteration = Summarize(ns_samples);
+  result.cycles_per_iteration = Summarize(cycle_samples);
+  return result;
+}
+
+ABSL_NAMESPACE_END
+}  // namespace absl
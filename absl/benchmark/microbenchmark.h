@@ -0,0 +1,127 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// -----------------------------------------------------------------------------
+// File: microbenchmark.h
+// -----------------------------------------------------------------------------
+//
+// This header file defines a small harness for microbenchmarks whose results
+// feed automated baseline comparison. It complements (rather than replaces)
+// the benchmark binaries under the various `absl/*` directories, which can be
+// built together with `bazel build --build_tag_filters=benchmark //absl/...`.
+// The harness contributes what those binaries lack in common:
+//
+//   * `PinThreadToCpu()` to eliminate migration noise,
+//   * timing in both wall nanoseconds and `CycleClock` cycles, the latter
+//     being invariant under frequency scaling on most hardware, and
+//   * machine-readable JSON output with a 95% confidence interval per
+//     metric, so a roll gate can reject a regression with a noise bar
+//     instead of comparing two single numbers.
+//
+// Example:
+//
+//   absl::MicrobenchmarkOptions options;
+//   options.pin_to_cpu = 0;
+//   absl::MicrobenchmarkResult result = absl::RunMicrobenchmark(
+//       "BM_InsertDense", options, [&] { map.insert({next_key(), 0}); });
+//   std::cout << result.ToJson() << "\n";
+
+#ifndef ABSL_BENCHMARK_MICROBENCHMARK_H_
+#define ABSL_BENCHMARK_MICROBENCHMARK_H_
+
+#include <cstdint>
+#include <string>
+
+#include "absl/base/config.h"
+#include "absl/functional/function_ref.h"
+#include "absl/strings/string_view.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+// MicrobenchmarkOptions
+//
+// Controls how `RunMicrobenchmark()` samples the body under test. The
+// defaults suit bodies in the nanosecond-to-microsecond range; very cheap
+// bodies may need more iterations per repetition to outlast timer
+// granularity.
+struct MicrobenchmarkOptions {
+  // Iterations of the body per timed repetition.
+  int64_t iterations_per_repetition = 100000;
+
+  // Independently timed repetitions; the confidence intervals are computed
+  // across these.
+  int repetitions = 10;
+
+  // Logical CPU to pin the calling thread to for the duration of the run,
+  // or -1 to leave the thread's affinity unchanged.
+  int pin_to_cpu = -1;
+};
+
+// MetricSummary
+//
+// Per-metric statistics over the repetitions of a run. The confidence
+// interval is a normal-approximation 95% interval on the mean.
+struct MetricSummary {
+  double mean = 0.0;
+  double stddev = 0.0;
+  double ci95_low = 0.0;
+  double ci95_high = 0.0;
+};
+
+// MicrobenchmarkResult
+//
+// The outcome of one `RunMicrobenchmark()` call.
+struct MicrobenchmarkResult {
+  std::string name;
+  int64_t iterations_per_repetition = 0;
+  int repetitions = 0;
+  bool pinned = false;  // Whether the requested CPU pinning took effect.
+
+  // Wall time per iteration, in nanoseconds.
+  MetricSummary ns_per_iteration;
+  // `CycleClock` ticks per iteration. On hardware with an invariant cycle
+  // counter this metric is unaffected by frequency scaling, which makes it
+  // the better basis for cross-run comparison.
+  MetricSummary cycles_per_iteration;
+
+  // Renders the result as a single-line JSON object, e.g.
+  //   {"name":"BM_Foo","iterations":100000,"repetitions":10,
+  //    "metrics":{"ns_per_iteration":{"mean":12.1,"stddev":0.2,
+  //                                   "ci95_low":12.0,"ci95_high":12.2},...}}
+  std::string ToJson() const;
+};
+
+// PinThreadToCpu()
+//
+// Pins the calling thread to logical CPU `cpu`. Returns false if pinning is
+// unsupported on this platform or the call fails; the thread's affinity is
+// then unchanged.
+bool PinThreadToCpu(int cpu);
+
+// RunMicrobenchmark()
+//
+// Runs `body` for `options.repetitions` timed repetitions of
+// `options.iterations_per_repetition` iterations each, optionally pinned to
+// a CPU, and returns summary statistics. The body's side effects must keep
+// its work observable (e.g. accumulate into a volatile or benchmark-owned
+// sink); this harness does not defeat dead-code elimination on its own.
+MicrobenchmarkResult RunMicrobenchmark(absl::string_view name,
+                                       const MicrobenchmarkOptions& options,
+                                       absl::FunctionRef<void()> body);
+
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_BENCHMARK_MICROBENCHMARK_H_
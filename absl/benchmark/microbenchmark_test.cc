@@ -0,0 +1,71 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/benchmark/microbenchmark.h"
+
+#include <atomic>
+#include <cstdint>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+using ::testing::HasSubstr;
+
+TEST(MicrobenchmarkTest, ProducesPlausibleStatistics) {
+  std::atomic<uint64_t> sink{0};
+  absl::MicrobenchmarkOptions options;
+  options.iterations_per_repetition = 10000;
+  options.repetitions = 5;
+  absl::MicrobenchmarkResult result = absl::RunMicrobenchmark(
+      "BM_AtomicIncrement", options,
+      [&] { sink.fetch_add(1, std::memory_order_relaxed); });
+
+  EXPECT_EQ(result.name, "BM_AtomicIncrement");
+  EXPECT_EQ(result.iterations_per_repetition, 10000);
+  EXPECT_EQ(result.repetitions, 5);
+  // 6 repetitions including warmup actually ran the body.
+  EXPECT_EQ(sink.load(), 60000u);
+  EXPECT_GT(result.ns_per_iteration.mean, 0.0);
+  EXPECT_GT(result.cycles_per_iteration.mean, 0.0);
+  EXPECT_LE(result.ns_per_iteration.ci95_low, result.ns_per_iteration.mean);
+  EXPECT_GE(result.ns_per_iteration.ci95_high, result.ns_per_iteration.mean);
+}
+
+TEST(MicrobenchmarkTest, JsonContainsAllFields) {
+  absl::MicrobenchmarkOptions options;
+  options.iterations_per_repetition = 100;
+  options.repetitions = 2;
+  int sink = 0;
+  absl::MicrobenchmarkResult result =
+      absl::RunMicrobenchmark("BM_Json\"Quoted\"", options, [&] { ++sink; });
+  const std::string json = result.ToJson();
+  EXPECT_THAT(json, HasSubstr("\"name\":\"BM_Json\\\"Quoted\\\"\""));
+  EXPECT_THAT(json, HasSubstr("\"iterations\":100"));
+  EXPECT_THAT(json, HasSubstr("\"repetitions\":2"));
+  EXPECT_THAT(json, HasSubstr("\"ns_per_iteration\""));
+  EXPECT_THAT(json, HasSubstr("\"cycles_per_iteration\""));
+  EXPECT_THAT(json, HasSubstr("\"ci95_low\""));
+  EXPECT_THAT(json, HasSubstr("\"ci95_high\""));
+}
+
+TEST(MicrobenchmarkTest, PinningIsBestEffort) {
+#ifdef __linux__
+  EXPECT_TRUE(absl::PinThreadToCpu(0));
+#endif
+  EXPECT_FALSE(absl::PinThreadToCpu(-1));
+}
+
+}  // namespace
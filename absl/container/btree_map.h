@@ -85,12 +85,19 @@ struct map_params;
 // instead specify a custom allocator `A` (which in turn requires specifying a
 // custom comparator `C`) as in `absl::btree_map<K, V, C, A>`.
 //
+// The trailing `TargetNodeSize` parameter is the size in bytes each node
+// aims for, trading tree height against per-node search and shift costs.
+// The 256-byte default is a good general-purpose choice; small entries on
+// read-heavy indexes can benefit from larger nodes, fat values from smaller
+// ones. Containers that differ only in node size are distinct types.
+//
 template <typename Key, typename Value, typename Compare = std::less<Key>,
-          typename Alloc = std::allocator<std::pair<const Key, Value>>>
+          typename Alloc = std::allocator<std::pair<const Key, Value>>,
+          int TargetNodeSize = 256>
 class ABSL_INTERNAL_ATTRIBUTE_OWNER btree_map
     : public container_internal::btree_map_container<
           container_internal::btree<container_internal::map_params<
-              Key, Value, Compare, Alloc, /*TargetNodeSize=*/256,
+              Key, Value, Compare, Alloc, TargetNodeSize,
               /*IsMulti=*/false>>> {
   using Base = typename btree_map::btree_map_container;
 
@@ -180,6 +187,16 @@ class ABSL_INTERNAL_ATTRIBUTE_OWNER btree_map
   // pointers, or iterators referring to contained elements.
   using Base::clear;
 
+  // btree_map::compact()
+  //
+  // Rewrites the tree so that every leaf node is at maximum fill, with
+  // nodes allocated in iteration order, making subsequent sequential scans
+  // close to a linear memory traversal. Takes O(size()) time and moves each
+  // element once. Invalidates any references, pointers, or iterators
+  // referring to contained elements. Compaction trades mutation speed for
+  // scan speed: the next insertion into each full leaf must split it.
+  using Base::compact;
+
   // btree_map::erase()
   //
   // Erases elements within the `btree_map`. If an erase occurs, any references,
@@ -243,6 +260,16 @@ class ABSL_INTERNAL_ATTRIBUTE_OWNER btree_map
   //   Inserts the elements within the initializer list `ilist`.
   using Base::insert;
 
+  // btree_map::bulk_load()
+  //
+  // void bulk_load(InputIterator first, InputIterator last):
+  //
+  //   Bulk-loads the presorted range [`first`, `last`) into an empty
+  //   `btree_map`, building the tree bottom-up instead of inserting
+  //   element-by-element. Requires that the map is empty and that the range
+  //   is sorted by the map's comparator and contains no duplicate keys.
+  using Base::bulk_load;
+
   // btree_map::insert_or_assign()
   //
   // Inserts an element of the specified value into the `btree_map` provided
@@ -492,8 +519,8 @@ class ABSL_INTERNAL_ATTRIBUTE_OWNER btree_map
 // absl::swap(absl::btree_map<>, absl::btree_map<>)
 //
 // Swaps the contents of two `absl::btree_map` containers.
-template <typename K, typename V, typename C, typename A>
-void swap(btree_map<K, V, C, A> &x, btree_map<K, V, C, A> &y) {
+template <typename K, typename V, typename C, typename A, int N>
+void swap(btree_map<K, V, C, A, N> &x, btree_map<K, V, C, A, N> &y) {
   return x.swap(y);
 }
 
@@ -501,9 +528,9 @@ void swap(btree_map<K, V, C, A> &x, btree_map<K, V, C, A> &y) {
 //
 // Erases all elements that satisfy the predicate pred from the container.
 // Returns the number of erased elements.
-template <typename K, typename V, typename C, typename A, typename Pred>
-typename btree_map<K, V, C, A>::size_type erase_if(
-    btree_map<K, V, C, A> &map, Pred pred) {
+template <typename K, typename V, typename C, typename A, int N, typename Pred>
+typename btree_map<K, V, C, A, N>::size_type erase_if(
+    btree_map<K, V, C, A, N> &map, Pred pred) {
   return container_internal::btree_access::erase_if(map, std::move(pred));
 }
 
@@ -523,12 +550,16 @@ typename btree_map<K, V, C, A>::size_type erase_if(
 // instead specify a custom allocator `A` (which in turn requires specifying a
 // custom comparator `C`) as in `absl::btree_multimap<K, V, C, A>`.
 //
+// The trailing `TargetNodeSize` parameter tunes the per-node byte budget;
+// see `absl::btree_map` for guidance.
+//
 template <typename Key, typename Value, typename Compare = std::less<Key>,
-          typename Alloc = std::allocator<std::pair<const Key, Value>>>
+          typename Alloc = std::allocator<std::pair<const Key, Value>>,
+          int TargetNodeSize = 256>
 class ABSL_INTERNAL_ATTRIBUTE_OWNER btree_multimap
     : public container_internal::btree_multimap_container<
           container_internal::btree<container_internal::map_params<
-              Key, Value, Compare, Alloc, /*TargetNodeSize=*/256,
+              Key, Value, Compare, Alloc, TargetNodeSize,
               /*IsMulti=*/true>>> {
   using Base = typename btree_multimap::btree_multimap_container;
 
@@ -618,6 +649,16 @@ class ABSL_INTERNAL_ATTRIBUTE_OWNER btree_multimap
   // pointers, or iterators referring to contained elements.
   using Base::clear;
 
+  // btree_multimap::compact()
+  //
+  // Rewrites the tree so that every leaf node is at maximum fill, with
+  // nodes allocated in iteration order, making subsequent sequential scans
+  // close to a linear memory traversal. Takes O(size()) time and moves each
+  // element once. Invalidates any references, pointers, or iterators
+  // referring to contained elements. Compaction trades mutation speed for
+  // scan speed: the next insertion into each full leaf must split it.
+  using Base::compact;
+
   // btree_multimap::erase()
   //
   // Erases elements within the `btree_multimap`. If an erase occurs, any
@@ -676,6 +717,16 @@ class ABSL_INTERNAL_ATTRIBUTE_OWNER btree_multimap
   //   Inserts the elements within the initializer list `ilist`.
   using Base::insert;
 
+  // btree_multimap::bulk_load()
+  //
+  // void bulk_load(InputIterator first, InputIterator last):
+  //
+  //   Bulk-loads the presorted range [`first`, `last`) into an empty
+  //   `btree_multimap`, building the tree bottom-up instead of inserting
+  //   element-by-element. Requires that the multimap is empty and that the
+  //   range is sorted by the multimap's comparator.
+  using Base::bulk_load;
+
   // btree_multimap::emplace()
   //
   // Inserts an element of the specified value by constructing it in-place
@@ -834,8 +885,8 @@ class ABSL_INTERNAL_ATTRIBUTE_OWNER btree_multimap
 // absl::swap(absl::btree_multimap<>, absl::btree_multimap<>)
 //
 // Swaps the contents of two `absl::btree_multimap` containers.
-template <typename K, typename V, typename C, typename A>
-void swap(btree_multimap<K, V, C, A> &x, btree_multimap<K, V, C, A> &y) {
+template <typename K, typename V, typename C, typename A, int N>
+void swap(btree_multimap<K, V, C, A, N> &x, btree_multimap<K, V, C, A, N> &y) {
   return x.swap(y);
 }
 
@@ -843,9 +894,9 @@ void swap(btree_multimap<K, V, C, A> &x, btree_multimap<K, V, C, A> &y) {
 //
 // Erases all elements that satisfy the predicate pred from the container.
 // Returns the number of erased elements.
-template <typename K, typename V, typename C, typename A, typename Pred>
-typename btree_multimap<K, V, C, A>::size_type erase_if(
-    btree_multimap<K, V, C, A> &map, Pred pred) {
+template <typename K, typename V, typename C, typename A, int N, typename Pred>
+typename btree_multimap<K, V, C, A, N>::size_type erase_if(
+    btree_multimap<K, V, C, A, N> &map, Pred pred) {
   return container_internal::btree_access::erase_if(map, std::move(pred));
 }
 
@@ -87,12 +87,18 @@ struct set_params;
 // requires specifying a custom comparator `C`) as in
 // `absl::btree_set<K, C, A>`.
 //
+// The trailing `TargetNodeSize` parameter is the size in bytes each node
+// aims for, trading tree height against per-node search and shift costs.
+// The 256-byte default is a good general-purpose choice; small keys on
+// read-heavy indexes can benefit from larger nodes, fat values from smaller
+// ones. Containers that differ only in node size are distinct types.
+//
 template <typename Key, typename Compare = std::less<Key>,
-          typename Alloc = std::allocator<Key>>
+          typename Alloc = std::allocator<Key>, int TargetNodeSize = 256>
 class ABSL_INTERNAL_ATTRIBUTE_OWNER btree_set
     : public container_internal::btree_set_container<
           container_internal::btree<container_internal::set_params<
-              Key, Compare, Alloc, /*TargetNodeSize=*/256,
+              Key, Compare, Alloc, TargetNodeSize,
               /*IsMulti=*/false>>> {
   using Base = typename btree_set::btree_set_container;
 
@@ -182,6 +188,16 @@ class ABSL_INTERNAL_ATTRIBUTE_OWNER btree_set
   // pointers, or iterators referring to contained elements.
   using Base::clear;
 
+  // btree_set::compact()
+  //
+  // Rewrites the tree so that every leaf node is at maximum fill, with
+  // nodes allocated in iteration order, making subsequent sequential scans
+  // close to a linear memory traversal. Takes O(size()) time and moves each
+  // element once. Invalidates any references, pointers, or iterators
+  // referring to contained elements. Compaction trades mutation speed for
+  // scan speed: the next insertion into each full leaf must split it.
+  using Base::compact;
+
   // btree_set::erase()
   //
   // Erases elements within the `btree_set`. Overloads are listed below.
@@ -243,6 +259,16 @@ class ABSL_INTERNAL_ATTRIBUTE_OWNER btree_set
   //   Inserts the elements within the initializer list `ilist`.
   using Base::insert;
 
+  // btree_set::bulk_load()
+  //
+  // void bulk_load(InputIterator first, InputIterator last):
+  //
+  //   Bulk-loads the presorted range [`first`, `last`) into an empty
+  //   `btree_set`, building the tree bottom-up instead of inserting
+  //   element-by-element. Requires that the set is empty and that the range
+  //   is sorted by the set's comparator and contains no duplicate keys.
+  using Base::bulk_load;
+
   // btree_set::emplace()
   //
   // Inserts an element of the specified value by constructing it in-place
@@ -412,8 +438,8 @@ class ABSL_INTERNAL_ATTRIBUTE_OWNER btree_set
 // absl::swap(absl::btree_set<>, absl::btree_set<>)
 //
 // Swaps the contents of two `absl::btree_set` containers.
-template <typename K, typename C, typename A>
-void swap(btree_set<K, C, A> &x, btree_set<K, C, A> &y) {
+template <typename K, typename C, typename A, int N>
+void swap(btree_set<K, C, A, N> &x, btree_set<K, C, A, N> &y) {
   return x.swap(y);
 }
 
@@ -421,8 +447,8 @@ void swap(btree_set<K, C, A> &x, btree_set<K, C, A> &y) {
 //
 // Erases all elements that satisfy the predicate pred from the container.
 // Returns the number of erased elements.
-template <typename K, typename C, typename A, typename Pred>
-typename btree_set<K, C, A>::size_type erase_if(btree_set<K, C, A> &set,
+template <typename K, typename C, typename A, int N, typename Pred>
+typename btree_set<K, C, A, N>::size_type erase_if(btree_set<K, C, A, N> &set,
                                                 Pred pred) {
   return container_internal::btree_access::erase_if(set, std::move(pred));
 }
@@ -443,12 +469,15 @@ typename btree_set<K, C, A>::size_type erase_if(btree_set<K, C, A> &set,
 // requires specifying a custom comparator `C`) as in
 // `absl::btree_multiset<K, C, A>`.
 //
+// The trailing `TargetNodeSize` parameter tunes the per-node byte budget;
+// see `absl::btree_set` for guidance.
+//
 template <typename Key, typename Compare = std::less<Key>,
-          typename Alloc = std::allocator<Key>>
+          typename Alloc = std::allocator<Key>, int TargetNodeSize = 256>
 class ABSL_INTERNAL_ATTRIBUTE_OWNER btree_multiset
     : public container_internal::btree_multiset_container<
           container_internal::btree<container_internal::set_params<
-              Key, Compare, Alloc, /*TargetNodeSize=*/256,
+              Key, Compare, Alloc, TargetNodeSize,
               /*IsMulti=*/true>>> {
   using Base = typename btree_multiset::btree_multiset_container;
 
@@ -538,6 +567,16 @@ class ABSL_INTERNAL_ATTRIBUTE_OWNER btree_multiset
   // pointers, or iterators referring to contained elements.
   using Base::clear;
 
+  // btree_multiset::compact()
+  //
+  // Rewrites the tree so that every leaf node is at maximum fill, with
+  // nodes allocated in iteration order, making subsequent sequential scans
+  // close to a linear memory traversal. Takes O(size()) time and moves each
+  // element once. Invalidates any references, pointers, or iterators
+  // referring to contained elements. Compaction trades mutation speed for
+  // scan speed: the next insertion into each full leaf must split it.
+  using Base::compact;
+
   // btree_multiset::erase()
   //
   // Erases elements within the `btree_multiset`. Overloads are listed below.
@@ -594,6 +633,16 @@ class ABSL_INTERNAL_ATTRIBUTE_OWNER btree_multiset
   //   Inserts the elements within the initializer list `ilist`.
   using Base::insert;
 
+  // btree_multiset::bulk_load()
+  //
+  // void bulk_load(InputIterator first, InputIterator last):
+  //
+  //   Bulk-loads the presorted range [`first`, `last`) into an empty
+  //   `btree_multiset`, building the tree bottom-up instead of inserting
+  //   element-by-element. Requires that the multiset is empty and that the
+  //   range is sorted by the multiset's comparator.
+  using Base::bulk_load;
+
   // btree_multiset::emplace()
   //
   // Inserts an element of the specified value by constructing it in-place
@@ -749,8 +798,8 @@ class ABSL_INTERNAL_ATTRIBUTE_OWNER btree_multiset
 // absl::swap(absl::btree_multiset<>, absl::btree_multiset<>)
 //
 // Swaps the contents of two `absl::btree_multiset` containers.
-template <typename K, typename C, typename A>
-void swap(btree_multiset<K, C, A> &x, btree_multiset<K, C, A> &y) {
+template <typename K, typename C, typename A, int N>
+void swap(btree_multiset<K, C, A, N> &x, btree_multiset<K, C, A, N> &y) {
   return x.swap(y);
 }
 
@@ -758,9 +807,9 @@ void swap(btree_multiset<K, C, A> &x, btree_multiset<K, C, A> &y) {
 //
 // Erases all elements that satisfy the predicate pred from the container.
 // Returns the number of erased elements.
-template <typename K, typename C, typename A, typename Pred>
-typename btree_multiset<K, C, A>::size_type erase_if(
-   btree_multiset<K, C, A> & set, Pred pred) {
+template <typename K, typename C, typename A, int N, typename Pred>
+typename btree_multiset<K, C, A, N>::size_type erase_if(
+   btree_multiset<K, C, A, N> & set, Pred pred) {
   return container_internal::btree_access::erase_if(set, std::move(pred));
 }
 
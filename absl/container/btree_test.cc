@@ -1233,6 +1233,67 @@ TEST(Btree, InitializerListInsert) {
   EXPECT_EQ(++it, range.second);
 }
 
+TEST(Btree, BulkLoad) {
+  constexpr size_t kSlots =
+      BtreeNodePeer::GetNumSlotsPerNode<absl::btree_set<int64_t>>();
+  // Exercise sizes around node/height boundaries, including sizes for which
+  // the input ends exactly on a value that became a separator (leaving an
+  // empty rightmost leaf for the fix-up pass to fill).
+  const std::vector<size_t> sizes = {0,
+                                     1,
+                                     kSlots - 1,
+                                     kSlots,
+                                     kSlots + 1,
+                                     2 * (kSlots + 1),
+                                     kSlots * (kSlots + 2),
+                                     (kSlots + 1) * (kSlots + 1),
+                                     100000};
+  for (const size_t size : sizes) {
+    SCOPED_TRACE(size);
+    std::vector<int64_t> values(size);
+    std::iota(values.begin(), values.end(), 0);
+
+    absl::btree_set<int64_t> set;
+    set.bulk_load(values.begin(), values.end());
+    set.verify();
+    EXPECT_EQ(set.size(), size);
+    EXPECT_THAT(set, ElementsAreArray(values));
+
+    // The loaded tree must support further mutation.
+    set.insert(-1);
+    set.insert(static_cast<int64_t>(size));
+    for (size_t i = 0; i < size; i += 2) {
+      EXPECT_EQ(set.erase(static_cast<int64_t>(i)), 1);
+    }
+    set.verify();
+    EXPECT_EQ(set.size(), size + 2 - (size + 1) / 2);
+  }
+}
+
+TEST(Btree, BulkLoadMap) {
+  std::vector<std::pair<int, int>> values;
+  for (int i = 0; i < 1000; ++i) values.emplace_back(i, i * 2);
+
+  absl::btree_map<int, int> map;
+  map.bulk_load(values.begin(), values.end());
+  map.verify();
+  EXPECT_EQ(map.size(), 1000);
+  EXPECT_EQ(map.at(500), 1000);
+  map[1000] = 2000;
+  EXPECT_EQ(map.find(1000)->second, 2000);
+}
+
+TEST(Btree, BulkLoadMultisetWithEquivalentKeys) {
+  std::vector<int> values;
+  for (int i = 0; i < 300; ++i) values.push_back(i / 3);
+
+  absl::btree_multiset<int> mset;
+  mset.bulk_load(values.begin(), values.end());
+  mset.verify();
+  EXPECT_EQ(mset.size(), 300);
+  EXPECT_EQ(mset.count(42), 3);
+}
+
 template <typename Compare, typename Key>
 void AssertKeyCompareStringAdapted() {
   using Adapted = typename key_compare_adapter<Compare, Key>::type;
@@ -1263,6 +1324,58 @@ TEST(Btree, KeyCompareAdapter) {
   AssertKeyCompareNotStringAdapted<std::greater<int>, int>();
 }
 
+// String keys with the default comparators use a binary search that skips
+// key bytes the search bounds are known to share with the lookup key. Verify
+// that search results are unchanged for keys sharing long prefixes, in both
+// comparator directions, including keys that are prefixes of other keys.
+template <typename Set>
+void TestPrefixSkipSearch() {
+  const std::string prefix(100, 'k');
+  Set s;
+  std::vector<std::string> keys;
+  for (int i = 0; i < 300; ++i) {
+    keys.push_back(absl::StrCat(prefix, i));
+  }
+  // One key that is a strict prefix of others.
+  keys.push_back(prefix);
+  for (const std::string &key : keys) s.insert(key);
+  EXPECT_EQ(s.size(), keys.size());
+
+  for (const std::string &key : keys) {
+    auto it = s.find(key);
+    ASSERT_NE(it, s.end());
+    EXPECT_EQ(*it, key);
+    // Heterogeneous lookup takes the same search path.
+    EXPECT_EQ(*s.find(absl::string_view(key)), key);
+    // Missing keys sharing the same long prefix.
+    EXPECT_EQ(s.find(absl::StrCat(key, "-absent")), s.end());
+    EXPECT_EQ(*s.lower_bound(key), key);
+  }
+  EXPECT_EQ(s.find(prefix.substr(0, 50)), s.end());
+}
+
+TEST(Btree, PrefixSkipSearchStringKeys) {
+  TestPrefixSkipSearch<absl::btree_set<std::string>>();
+  TestPrefixSkipSearch<absl::btree_set<std::string, std::greater<std::string>>>();
+  TestPrefixSkipSearch<absl::btree_set<absl::string_view>>();
+}
+
+TEST(Btree, PrefixSkipSearchMultisetEquivalentKeys) {
+  const std::string prefix(100, 'k');
+  absl::btree_multiset<std::string> mset;
+  for (int i = 0; i < 100; ++i) {
+    for (int copy = 0; copy < 3; ++copy) {
+      mset.insert(absl::StrCat(prefix, i));
+    }
+  }
+  for (int i = 0; i < 100; ++i) {
+    const std::string key = absl::StrCat(prefix, i);
+    EXPECT_EQ(mset.count(key), 3);
+    auto range = mset.equal_range(key);
+    EXPECT_EQ(std::distance(range.first, range.second), 3);
+  }
+}
+
 TEST(Btree, RValueInsert) {
   InstanceTracker tracker;
 
@@ -1353,6 +1466,40 @@ constexpr bool kAsan = true;
 constexpr bool kAsan = false;
 #endif
 
+TEST(Btree, TargetNodeSizeParameter) {
+  // The public containers accept a target node size as a trailing template
+  // parameter; bigger nodes hold more slots.
+  using SmallNodeSet = absl::btree_set<int64_t, std::less<int64_t>,
+                                       std::allocator<int64_t>, /*N=*/256>;
+  using BigNodeSet = absl::btree_set<int64_t, std::less<int64_t>,
+                                     std::allocator<int64_t>, /*N=*/512>;
+  static_assert(std::is_same<SmallNodeSet, absl::btree_set<int64_t>>::value,
+                "the default node size is 256 bytes");
+  EXPECT_GT(BtreeNodePeer::GetNumSlotsPerNode<BigNodeSet>(),
+            BtreeNodePeer::GetNumSlotsPerNode<SmallNodeSet>());
+
+  BigNodeSet set;
+  for (int i = 999; i >= 0; --i) set.insert(i);
+  EXPECT_EQ(set.size(), 1000);
+  EXPECT_TRUE(set.contains(123));
+  erase_if(set, [](int64_t v) { return v % 2 == 0; });
+  EXPECT_EQ(set.size(), 500);
+  BigNodeSet other;
+  swap(set, other);
+  EXPECT_TRUE(set.empty());
+  EXPECT_EQ(other.size(), 500);
+
+  using BigNodeMap =
+      absl::btree_map<int64_t, int64_t, std::less<int64_t>,
+                      std::allocator<std::pair<const int64_t, int64_t>>,
+                      /*N=*/512>;
+  BigNodeMap map;
+  for (int i = 0; i < 1000; ++i) map[i] = -i;
+  EXPECT_EQ(map.at(77), -77);
+  erase_if(map, [](const auto &kv) { return kv.first >= 500; });
+  EXPECT_EQ(map.size(), 500);
+}
+
 // Note: when the values in this test change, it is expected to have an impact
 // on performance.
 TEST(Btree, MovesComparisonsCopiesSwapsTracking) {
@@ -2138,6 +2285,64 @@ TEST(Btree, InsertHintNodeHandle) {
   EXPECT_EQ(it, other.begin());
 }
 
+TEST(Btree, ExtractSorted) {
+  absl::btree_map<int, std::string> m;
+  for (int i = 9; i >= 0; --i) m[i] = std::to_string(i);
+
+  std::vector<std::pair<int, std::string>> v = m.extract_sorted();
+  EXPECT_TRUE(m.empty());
+  ASSERT_THAT(v, SizeIs(10));
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_EQ(v[i].first, i);
+    EXPECT_EQ(v[i].second, std::to_string(i));
+  }
+
+  absl::btree_multiset<int> ms = {3, 1, 3, 2, 1};
+  EXPECT_THAT(ms.extract_sorted(), ElementsAre(1, 1, 2, 3, 3));
+  EXPECT_TRUE(ms.empty());
+}
+
+TEST(Btree, ExtractSortedMovesElements) {
+  InstanceTracker tracker;
+  absl::btree_set<MovableOnlyInstance> s;
+  for (int i = 0; i < 100; ++i) s.insert(MovableOnlyInstance(i));
+
+  tracker.ResetCopiesMovesSwaps();
+  std::vector<MovableOnlyInstance> v = s.extract_sorted();
+  EXPECT_TRUE(s.empty());
+  EXPECT_EQ(tracker.copies(), 0);
+  ASSERT_THAT(v, SizeIs(100));
+  for (int i = 0; i < 100; ++i) EXPECT_EQ(v[i].value(), i);
+}
+
+TEST(Btree, MergeInterleavedRuns) {
+  // Merging sorted trees advances the destination insert position
+  // monotonically; build runs of consecutive source keys so the hinted
+  // insertion path is exercised, and verify against the equivalent
+  // std::set/std::multiset merge.
+  absl::btree_set<int> dst;
+  absl::btree_set<int> src;
+  std::set<int> expected;
+  for (int i = 0; i < 1000; ++i) {
+    // Runs of 10 alternate between the trees; every 7th key is in both.
+    if (i / 10 % 2 == 0 || i % 7 == 0) dst.insert(i);
+    if (i / 10 % 2 == 1 || i % 7 == 0) src.insert(i);
+    expected.insert(i);
+  }
+  const size_t duplicates = dst.size() + src.size() - expected.size();
+  dst.merge(src);
+  EXPECT_THAT(dst, ElementsAreArray(expected));
+  EXPECT_EQ(src.size(), duplicates);
+
+  absl::btree_multiset<int> mdst(dst.begin(), dst.end());
+  absl::btree_multiset<int> msrc(expected.begin(), expected.end());
+  mdst.merge(msrc);
+  EXPECT_TRUE(msrc.empty());
+  std::multiset<int> mexpected(expected.begin(), expected.end());
+  mexpected.insert(expected.begin(), expected.end());
+  EXPECT_THAT(mdst, ElementsAreArray(mexpected));
+}
+
 struct IntCompareToCmp {
   absl::weak_ordering operator()(int a, int b) const {
     if (a < b) return absl::weak_ordering::less;
@@ -3455,6 +3660,75 @@ TEST(Btree, FieldTypeEqualsSlotType) {
   TestBasicFunctionality(set_type());
 }
 
+// Exposes the underlying tree so tests can observe node-level structure.
+struct ExposedIntSet : absl::btree_set<int> {
+  const auto &tree() const { return this->tree_; }
+};
+
+TEST(Btree, CompactPacksLeavesFully) {
+  // Random-order insertion leaves nodes partially filled; compact() must
+  // rewrite the tree down to the minimum possible number of leaves.
+  ExposedIntSet set;
+  std::vector<int> values(10000);
+  std::iota(values.begin(), values.end(), 0);
+  absl::BitGen bitgen;
+  absl::c_shuffle(values, bitgen);
+  for (int v : values) set.insert(v);
+
+  const size_t slots = BtreeNodePeer::GetNumSlotsPerNode<absl::btree_set<int>>();
+  const size_t leaves_before = set.tree().leaf_nodes();
+  set.compact();
+  set.verify();
+
+  // Sequential reinsertion fills every leaf completely except the last.
+  // Separator values live in internal nodes, so the leaf count can dip
+  // slightly below ceil(size / slots) - sandwich it instead.
+  const size_t max_leaves = (set.size() + slots - 1) / slots;
+  EXPECT_LE(set.tree().leaf_nodes(), max_leaves);
+  EXPECT_GE(set.tree().leaf_nodes() + set.tree().internal_nodes(), max_leaves);
+  EXPECT_LT(set.tree().leaf_nodes(), leaves_before);
+
+  // Contents are unchanged.
+  EXPECT_EQ(set.size(), values.size());
+  int expected = 0;
+  for (int v : set) EXPECT_EQ(v, expected++);
+}
+
+TEST(Btree, CompactPreservesMapContents) {
+  absl::btree_map<int, std::string> map;
+  for (int i = 999; i >= 0; --i) map[i] = absl::StrCat("value", i);
+  map.compact();
+  map.verify();
+  EXPECT_EQ(map.size(), 1000);
+  for (int i = 0; i < 1000; ++i) {
+    ASSERT_EQ(map[i], absl::StrCat("value", i));
+  }
+  // The map remains fully usable after compaction.
+  map[1000] = "value1000";
+  map.erase(0);
+  EXPECT_EQ(map.size(), 1000);
+}
+
+TEST(Btree, CompactPreservesMultisetDuplicates) {
+  absl::btree_multiset<int> set;
+  for (int i = 0; i < 100; ++i) {
+    set.insert(i);
+    set.insert(i);
+  }
+  set.compact();
+  set.verify();
+  EXPECT_EQ(set.size(), 200);
+  for (int i = 0; i < 100; ++i) ASSERT_EQ(set.count(i), 2);
+}
+
+TEST(Btree, CompactEmptyContainer) {
+  absl::btree_set<int> set;
+  set.compact();
+  EXPECT_TRUE(set.empty());
+  set.insert(1);
+  EXPECT_EQ(set.size(), 1);
+}
+
 }  // namespace
 }  // namespace container_internal
 ABSL_NAMESPACE_END
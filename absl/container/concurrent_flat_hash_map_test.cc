@@ -0,0 +1,206 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/container/concurrent_flat_hash_map.h"
+
+#include <cstdint>
+#include <string>
+#include <thread>  // NOLINT(build/c++11)
+#include <utility>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "absl/strings/string_view.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+namespace {
+
+using ::testing::Pair;
+using ::testing::UnorderedElementsAre;
+
+TEST(ConcurrentFlatHashMap, BasicOperations) {
+  concurrent_flat_hash_map<int, int> m;
+  EXPECT_TRUE(m.empty());
+  EXPECT_EQ(m.size(), 0);
+
+  EXPECT_TRUE(m.insert({1, 10}));
+  EXPECT_FALSE(m.insert({1, 11}));
+  EXPECT_TRUE(m.try_emplace(2, 20));
+  EXPECT_FALSE(m.try_emplace(2, 21));
+  EXPECT_EQ(m.size(), 2);
+
+  EXPECT_TRUE(m.contains(1));
+  EXPECT_EQ(m.count(1), 1);
+  EXPECT_FALSE(m.contains(3));
+
+  EXPECT_EQ(m.erase(1), 1);
+  EXPECT_EQ(m.erase(1), 0);
+  EXPECT_EQ(m.size(), 1);
+
+  m.clear();
+  EXPECT_TRUE(m.empty());
+}
+
+TEST(ConcurrentFlatHashMap, InsertOrAssign) {
+  concurrent_flat_hash_map<int, std::string> m;
+  EXPECT_TRUE(m.insert_or_assign(1, "a"));
+  EXPECT_FALSE(m.insert_or_assign(1, "b"));
+
+  std::string value;
+  const auto& cm = m;
+  EXPECT_TRUE(cm.visit(1, [&](const std::pair<const int, std::string>& p) {
+    value = p.second;
+  }));
+  EXPECT_EQ(value, "b");
+}
+
+TEST(ConcurrentFlatHashMap, VisitMutates) {
+  concurrent_flat_hash_map<int, int> m;
+  m.try_emplace(1, 10);
+  EXPECT_TRUE(
+      m.visit(1, [](std::pair<const int, int>& p) { p.second += 5; }));
+  EXPECT_FALSE(
+      m.visit(2, [](std::pair<const int, int>& p) { p.second += 5; }));
+
+  int value = 0;
+  const auto& cm = m;
+  cm.visit(1, [&](const std::pair<const int, int>& p) { value = p.second; });
+  EXPECT_EQ(value, 15);
+}
+
+TEST(ConcurrentFlatHashMap, VisitAll) {
+  concurrent_flat_hash_map<int, int> m;
+  for (int i = 0; i < 10; ++i) m.try_emplace(i, i * i);
+
+  m.visit_all([](std::pair<const int, int>& p) { ++p.second; });
+
+  std::vector<std::pair<int, int>> contents;
+  const auto& cm = m;
+  cm.visit_all([&](const std::pair<const int, int>& p) {
+    contents.push_back({p.first, p.second});
+  });
+  ASSERT_EQ(contents.size(), 10);
+  for (const auto& p : contents) {
+    EXPECT_EQ(p.second, p.first * p.first + 1);
+  }
+}
+
+TEST(ConcurrentFlatHashMap, HeterogeneousLookup) {
+  concurrent_flat_hash_map<std::string, int> m;
+  m.try_emplace("abc", 1);
+
+  // Lookups with string_view must not construct a std::string key.
+  absl::string_view key = "abc";
+  EXPECT_TRUE(m.contains(key));
+  EXPECT_TRUE(m.visit(key, [](std::pair<const std::string, int>& p) {
+    p.second = 2;
+  }));
+  EXPECT_EQ(m.erase(key), 1);
+  EXPECT_FALSE(m.contains(key));
+}
+
+TEST(ConcurrentFlatHashMap, Reserve) {
+  concurrent_flat_hash_map<int, int> m;
+  m.reserve(1 << 16);
+  for (int i = 0; i < 1000; ++i) EXPECT_TRUE(m.try_emplace(i, i));
+  EXPECT_EQ(m.size(), 1000);
+}
+
+TEST(ConcurrentFlatHashMap, ConcurrentInsertsAndReads) {
+  constexpr int kThreads = 8;
+  constexpr int kPerThread = 2000;
+  concurrent_flat_hash_map<int64_t, int64_t> m;
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&m, t] {
+      for (int i = 0; i < kPerThread; ++i) {
+        const int64_t key = static_cast<int64_t>(t) * kPerThread + i;
+        EXPECT_TRUE(m.try_emplace(key, key * 2));
+        // Read back keys written by this thread while other threads write.
+        int64_t value = 0;
+        EXPECT_TRUE(m.visit(
+            key, [&](const std::pair<const int64_t, int64_t>& p) {
+              value = p.second;
+            }));
+        EXPECT_EQ(value, key * 2);
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  EXPECT_EQ(m.size(), kThreads * kPerThread);
+  for (int64_t key = 0; key < kThreads * kPerThread; ++key) {
+    ASSERT_TRUE(m.contains(key)) << key;
+  }
+}
+
+TEST(ConcurrentFlatHashMap, ConcurrentMixedMutation) {
+  constexpr int kThreads = 8;
+  constexpr int kKeys = 128;
+  constexpr int kOpsPerThread = 5000;
+  concurrent_flat_hash_map<int, int> m;
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&m, t] {
+      for (int i = 0; i < kOpsPerThread; ++i) {
+        const int key = (t * 7919 + i) % kKeys;
+        switch (i % 4) {
+          case 0:
+            m.try_emplace(key, 0);
+            break;
+          case 1:
+            m.visit(key, [](std::pair<const int, int>& p) { ++p.second; });
+            break;
+          case 2:
+            m.contains(key);
+            break;
+          case 3:
+            m.erase(key);
+            break;
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  // Every surviving value was only ever incremented from zero.
+  const auto& cm = m;
+  cm.visit_all([&](const std::pair<const int, int>& p) {
+    EXPECT_GE(p.second, 0);
+    EXPECT_LT(p.first, kKeys);
+  });
+}
+
+TEST(ConcurrentFlatHashMap, VisitAllSeesDistinctKeys) {
+  concurrent_flat_hash_map<int, int> m;
+  m.try_emplace(1, 10);
+  m.try_emplace(2, 20);
+  m.try_emplace(3, 30);
+
+  std::vector<std::pair<int, int>> contents;
+  const auto& cm = m;
+  cm.visit_all([&](const std::pair<const int, int>& p) {
+    contents.push_back({p.first, p.second});
+  });
+  EXPECT_THAT(contents, UnorderedElementsAre(Pair(1, 10), Pair(2, 20),
+                                             Pair(3, 30)));
+}
+
+}  // namespace
+ABSL_NAMESPACE_END
+}  // namespace absl
@@ -14,9 +14,11 @@
 
 #include "absl/container/flat_hash_map.h"
 
+#include <atomic>
 #include <cstddef>
 #include <memory>
 #include <string>
+#include <thread>  // NOLINT(build/c++11)
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -452,6 +454,55 @@ TEST(Iterator, InconsistentHashEqFunctorsValidation) {
   EXPECT_DEATH_IF_SUPPORTED(insert_conflicting_elems(), crash_message);
 }
 
+// A minimal executor for parallel_for_each(); each task gets its own thread.
+struct ThreadPerTaskExecutor {
+  template <typename Task>
+  void Schedule(Task task) {
+    std::thread(std::move(task)).detach();
+  }
+};
+
+TEST(FlatHashMap, ParallelForEachVisitsEveryElement) {
+  constexpr int kNumElements = 100000;
+  absl::flat_hash_map<int, int> m;
+  for (int i = 0; i < kNumElements; ++i) m[i] = 0;
+
+  ThreadPerTaskExecutor executor;
+  std::atomic<int> visited{0};
+  m.parallel_for_each(executor, [&](std::pair<const int, int>& kv) {
+    kv.second = kv.first + 1;
+    visited.fetch_add(1, std::memory_order_relaxed);
+  });
+
+  EXPECT_EQ(visited.load(), kNumElements);
+  for (int i = 0; i < kNumElements; ++i) EXPECT_EQ(m[i], i + 1);
+}
+
+TEST(FlatHashMap, ParallelForEachConstAndSmallTables) {
+  ThreadPerTaskExecutor executor;
+  std::atomic<int> visited{0};
+  auto count = [&](const std::pair<const int, int>&) {
+    visited.fetch_add(1, std::memory_order_relaxed);
+  };
+
+  const absl::flat_hash_map<int, int> empty;
+  empty.parallel_for_each(executor, count);
+  EXPECT_EQ(visited.load(), 0);
+
+  // Small tables (including any inline representation) run on the calling
+  // thread.
+  const absl::flat_hash_map<int, int> tiny = {{1, 2}};
+  tiny.parallel_for_each(executor, count);
+  EXPECT_EQ(visited.load(), 1);
+
+  visited = 0;
+  absl::flat_hash_map<int, int> m;
+  for (int i = 0; i < 1000; ++i) m[i] = i;
+  // An explicit shard count above the group count gets clamped.
+  m.parallel_for_each(executor, count, /*shards=*/1000000);
+  EXPECT_EQ(visited.load(), 1000);
+}
+
 }  // namespace
 }  // namespace container_internal
 ABSL_NAMESPACE_END
@@ -0,0 +1,296 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// -----------------------------------------------------------------------------
+// File: frozen_flat_hash_map.h
+// -----------------------------------------------------------------------------
+//
+// Support for freezing a read-only hash map into a relocatable byte blob and
+// probing it in place — e.g. from an mmap'd file — without rebuilding the
+// table. The blob uses the swisstable layout (a control-byte array probed
+// with `Group` plus a flat slot array), so lookups against a frozen map cost
+// the same as against a live `flat_hash_map`.
+//
+// Processes that would each rebuild an identical read-only map at startup can
+// instead build it once with `FreezeFlatHashMap()`, write the bytes to a
+// file, and map it with `frozen_flat_hash_map_view`; startup hashing is
+// replaced by demand paging.
+//
+// Requirements and caveats:
+//
+// * Keys and values must be trivially copyable; the blob stores slots by
+//   memcpy and the view reads them in place.
+// * The hasher must be deterministic across processes. The default
+//   `absl::Hash` is randomized per process and MUST NOT be used; supply a
+//   stable hasher (and matching equality) explicitly.
+// * The blob is probed without the per-table salt a live table mixes into its
+//   probe sequence (the salt is derived from the control array's address,
+//   which an mmap'd blob cannot control). This makes the layout
+//   address-independent at the cost of the salt's protection against
+//   adversarial keys; do not freeze maps keyed by untrusted input.
+// * The blob must be loaded at an address aligned to
+//   `alignof(std::pair<const K, V>)`. Page-aligned mappings always qualify.
+//
+// Example:
+//
+//   absl::flat_hash_map<uint64_t, uint64_t, StableHash> m = ...;
+//   std::string blob = absl::FreezeFlatHashMap<uint64_t, uint64_t,
+//                                              StableHash>(m);
+//   // ... later, typically in another process over mmap'd bytes:
+//   auto view = absl::frozen_flat_hash_map_view<uint64_t, uint64_t,
+//                                               StableHash>::FromBytes(blob);
+//   if (view.has_value()) { const uint64_t* v = view->find(key); }
+
+#ifndef ABSL_CONTAINER_FROZEN_FLAT_HASH_MAP_H_
+#define ABSL_CONTAINER_FROZEN_FLAT_HASH_MAP_H_
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "absl/base/attributes.h"
+#include "absl/base/config.h"
+#include "absl/base/optimization.h"
+#include "absl/container/hash_container_defaults.h"
+#include "absl/container/internal/raw_hash_set.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+namespace container_internal {
+
+// On-disk header of a frozen table blob. All fields are stored in the
+// producing machine's byte order; frozen blobs are not portable across
+// architectures (the slot layout would not match anyway).
+struct FrozenHashTableHeader {
+  static constexpr uint64_t kMagic = 0x62616c74687a6266;  // "fbzhtlab"
+  static constexpr uint32_t kVersion = 1;
+
+  uint64_t magic;
+  uint32_t version;
+  // Group width the blob was built with; probing only works if the reader
+  // was compiled with the same width.
+  uint32_t group_width;
+  uint64_t capacity;
+  uint64_t size;
+  // sizeof the slot type, as a cheap guard against type mismatches.
+  uint64_t slot_size;
+  // Offset of the slot array from the start of the blob.
+  uint64_t slots_offset;
+};
+
+static_assert(std::is_trivially_copyable<FrozenHashTableHeader>::value,
+              "FrozenHashTableHeader must be trivially copyable");
+
+}  // namespace container_internal
+
+// -----------------------------------------------------------------------------
+// absl::frozen_flat_hash_map_view
+// -----------------------------------------------------------------------------
+//
+// A non-owning, read-only view over a blob produced by `FreezeFlatHashMap()`.
+// The viewed bytes must stay alive and unmodified for the lifetime of the
+// view. All methods are const and thread-safe.
+template <class K, class V, class Hash = DefaultHashContainerHash<K>,
+          class Eq = DefaultHashContainerEq<K>>
+class frozen_flat_hash_map_view {
+  using Header = container_internal::FrozenHashTableHeader;
+  using ctrl_t = container_internal::ctrl_t;
+  using Group = container_internal::Group;
+
+ public:
+  using key_type = K;
+  using mapped_type = V;
+  using value_type = std::pair<const K, V>;
+  using size_type = size_t;
+
+  static_assert(std::is_trivially_copyable<K>::value,
+                "frozen maps require trivially copyable keys");
+  static_assert(std::is_trivially_copyable<V>::value,
+                "frozen maps require trivially copyable values");
+
+  // Validates `bytes` and returns a view over it, or `nullopt` if the bytes
+  // do not hold a compatible frozen table (wrong magic, version, group width,
+  // slot size, or truncated data). `bytes.data()` must be aligned to
+  // `alignof(value_type)`.
+  static absl::optional<frozen_flat_hash_map_view> FromBytes(
+      absl::string_view bytes) {
+    if (bytes.size() < sizeof(Header)) return absl::nullopt;
+    Header header;
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    if (header.magic != Header::kMagic ||
+        header.version != Header::kVersion ||
+        header.group_width != Group::kWidth ||
+        header.slot_size != sizeof(value_type)) {
+      return absl::nullopt;
+    }
+    if (header.capacity != 0 &&
+        bytes.size() < header.slots_offset +
+                           header.capacity * sizeof(value_type)) {
+      return absl::nullopt;
+    }
+    assert(reinterpret_cast<uintptr_t>(bytes.data()) %
+               alignof(value_type) ==
+           0);
+    return frozen_flat_hash_map_view(bytes, header);
+  }
+
+  // Returns a pointer to the value mapped to the given key, or `nullptr` if
+  // the key is not present. Heterogeneous lookup is supported under the same
+  // conditions as `flat_hash_map`.
+  template <class Key>
+  const V* find(const Key& key) const {
+    if (capacity_ == 0) return nullptr;
+    const size_t hash = hash_(key);
+    // Probing matches a live table's find() except that H1 is not salted;
+    // see the file comment.
+    auto seq = container_internal::probe_seq<Group::kWidth>(hash >> 7,
+                                                            capacity_);
+    while (true) {
+      Group g{ctrl_ + seq.offset()};
+      for (uint32_t i : g.Match(container_internal::H2(hash))) {
+        const value_type* slot = slots_ + seq.offset(i);
+        if (ABSL_PREDICT_TRUE(eq_(slot->first, key))) return &slot->second;
+      }
+      if (ABSL_PREDICT_TRUE(g.MaskEmpty())) return nullptr;
+      seq.next();
+      assert(seq.index() <= capacity_ && "full table!");
+    }
+  }
+
+  template <class Key>
+  bool contains(const Key& key) const {
+    return find(key) != nullptr;
+  }
+
+  // Runs `fn(const value_type&)` on every element, in table order.
+  template <class Fn>
+  void for_each(Fn fn) const {
+    for (size_t i = 0; i < capacity_; ++i) {
+      if (container_internal::IsFull(ctrl_[i])) fn(slots_[i]);
+    }
+  }
+
+  size_type size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+  size_type capacity() const { return capacity_; }
+
+ private:
+  frozen_flat_hash_map_view(absl::string_view bytes, const Header& header)
+      : capacity_(static_cast<size_t>(header.capacity)),
+        size_(static_cast<size_t>(header.size)),
+        ctrl_(reinterpret_cast<const ctrl_t*>(bytes.data() + sizeof(Header))),
+        slots_(reinterpret_cast<const value_type*>(bytes.data() +
+                                                   header.slots_offset)) {}
+
+  size_t capacity_;
+  size_t size_;
+  const ctrl_t* ctrl_;
+  const value_type* slots_;
+  ABSL_ATTRIBUTE_NO_UNIQUE_ADDRESS Hash hash_;
+  ABSL_ATTRIBUTE_NO_UNIQUE_ADDRESS Eq eq_;
+};
+
+// FreezeFlatHashMap()
+//
+// Serializes the elements of `map` (or any container of key/value pairs with
+// unique keys) into a relocatable blob probed by
+// `frozen_flat_hash_map_view<K, V, Hash, Eq>`. `Hash` must be deterministic
+// across processes; see the file comment.
+template <class K, class V, class Hash = DefaultHashContainerHash<K>,
+          class Eq = DefaultHashContainerEq<K>, class Container>
+std::string FreezeFlatHashMap(const Container& map) {
+  using Header = container_internal::FrozenHashTableHeader;
+  using ctrl_t = container_internal::ctrl_t;
+  using Group = container_internal::Group;
+  using value_type = std::pair<const K, V>;
+
+  static_assert(std::is_trivially_copyable<K>::value,
+                "frozen maps require trivially copyable keys");
+  static_assert(std::is_trivially_copyable<V>::value,
+                "frozen maps require trivially copyable values");
+
+  const size_t n = map.size();
+  const size_t capacity =
+      n == 0 ? 0
+             : container_internal::NormalizeCapacity(
+                   container_internal::GrowthToLowerboundCapacity(n));
+
+  const size_t num_ctrl =
+      capacity == 0 ? 0 : container_internal::NumControlBytes(capacity);
+  // Slots are aligned so that a blob loaded at an aligned address has aligned
+  // slots regardless of the control array's length.
+  const size_t slots_offset =
+      (sizeof(Header) + num_ctrl + alignof(value_type) - 1) &
+      ~(alignof(value_type) - 1);
+
+  Header header;
+  header.magic = Header::kMagic;
+  header.version = Header::kVersion;
+  header.group_width = static_cast<uint32_t>(Group::kWidth);
+  header.capacity = capacity;
+  header.size = n;
+  header.slot_size = sizeof(value_type);
+  header.slots_offset = slots_offset;
+
+  std::string blob(slots_offset + capacity * sizeof(value_type), '\0');
+  std::memcpy(&blob[0], &header, sizeof(header));
+  if (capacity == 0) return blob;
+
+  ctrl_t* ctrl = reinterpret_cast<ctrl_t*>(&blob[sizeof(Header)]);
+  std::memset(ctrl, static_cast<int8_t>(ctrl_t::kEmpty), num_ctrl);
+  ctrl[capacity] = ctrl_t::kSentinel;
+  // The slot array is written with memcpy rather than through a value_type*
+  // to stay clear of alignment and object-lifetime issues inside the string.
+  char* slots = &blob[slots_offset];
+
+  Hash hasher;
+  const size_t cloned_bytes = container_internal::NumClonedBytes();
+  for (const auto& entry : map) {
+    const size_t hash = hasher(entry.first);
+    auto seq =
+        container_internal::probe_seq<Group::kWidth>(hash >> 7, capacity);
+    size_t target;
+    while (true) {
+      Group g{ctrl + seq.offset()};
+      auto mask = g.MaskEmpty();
+      if (mask) {
+        target = seq.offset(mask.LowestBitSet());
+        break;
+      }
+      seq.next();
+      assert(seq.index() <= capacity && "full table!");
+    }
+    // Mirror the control byte into the cloned tail, as SetCtrl does for live
+    // tables.
+    const ctrl_t h2 = static_cast<ctrl_t>(container_internal::H2(hash));
+    ctrl[target] = h2;
+    ctrl[((target - cloned_bytes) & capacity) + (cloned_bytes & capacity)] =
+        h2;
+    const value_type slot(entry.first, entry.second);
+    std::memcpy(slots + target * sizeof(value_type), &slot, sizeof(slot));
+  }
+  return blob;
+}
+
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_CONTAINER_FROZEN_FLAT_HASH_MAP_H_
@@ -0,0 +1,162 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/container/frozen_flat_hash_map.h"
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/strings/string_view.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+namespace {
+
+// Frozen blobs require a hasher that is deterministic across processes;
+// absl::Hash is randomized per process and would make this test meaningless.
+struct StableHash {
+  size_t operator()(uint64_t v) const {
+    return static_cast<size_t>(v * uint64_t{0x9E3779B97F4A7C15});
+  }
+};
+
+using View = frozen_flat_hash_map_view<uint64_t, uint64_t, StableHash>;
+
+// Returns `blob` copied into 8-byte-aligned storage, as an mmap'd file would
+// provide. std::string makes no alignment guarantee.
+std::vector<uint64_t> Align(const std::string& blob) {
+  std::vector<uint64_t> buf((blob.size() + 7) / 8);
+  std::memcpy(buf.data(), blob.data(), blob.size());
+  return buf;
+}
+
+absl::string_view AsBytes(const std::vector<uint64_t>& buf,
+                          size_t unpadded_size) {
+  return absl::string_view(reinterpret_cast<const char*>(buf.data()),
+                           unpadded_size);
+}
+
+TEST(FrozenFlatHashMap, Roundtrip) {
+  absl::flat_hash_map<uint64_t, uint64_t> m;
+  for (uint64_t i = 0; i < 10000; ++i) m[i * 3] = i;
+
+  const std::string blob =
+      FreezeFlatHashMap<uint64_t, uint64_t, StableHash>(m);
+  const std::vector<uint64_t> buf = Align(blob);
+  auto view = View::FromBytes(AsBytes(buf, blob.size()));
+  ASSERT_TRUE(view.has_value());
+
+  EXPECT_EQ(view->size(), m.size());
+  EXPECT_FALSE(view->empty());
+  for (const auto& kv : m) {
+    const uint64_t* v = view->find(kv.first);
+    ASSERT_NE(v, nullptr) << kv.first;
+    EXPECT_EQ(*v, kv.second);
+  }
+  // Absent keys (never multiples of 3 above, plus far-away ones) miss.
+  EXPECT_EQ(view->find(1), nullptr);
+  EXPECT_EQ(view->find(2), nullptr);
+  EXPECT_EQ(view->find(uint64_t{1} << 60), nullptr);
+  EXPECT_FALSE(view->contains(4));
+}
+
+TEST(FrozenFlatHashMap, EmptyMap) {
+  absl::flat_hash_map<uint64_t, uint64_t> m;
+  const std::string blob =
+      FreezeFlatHashMap<uint64_t, uint64_t, StableHash>(m);
+  const std::vector<uint64_t> buf = Align(blob);
+  auto view = View::FromBytes(AsBytes(buf, blob.size()));
+  ASSERT_TRUE(view.has_value());
+  EXPECT_TRUE(view->empty());
+  EXPECT_EQ(view->find(42), nullptr);
+}
+
+TEST(FrozenFlatHashMap, ForEach) {
+  absl::flat_hash_map<uint64_t, uint64_t> m;
+  uint64_t expected_sum = 0;
+  for (uint64_t i = 1; i <= 100; ++i) {
+    m[i] = i;
+    expected_sum += i;
+  }
+  const std::string blob =
+      FreezeFlatHashMap<uint64_t, uint64_t, StableHash>(m);
+  const std::vector<uint64_t> buf = Align(blob);
+  auto view = View::FromBytes(AsBytes(buf, blob.size()));
+  ASSERT_TRUE(view.has_value());
+
+  uint64_t sum = 0;
+  size_t count = 0;
+  view->for_each([&](const std::pair<const uint64_t, uint64_t>& kv) {
+    sum += kv.second;
+    ++count;
+  });
+  EXPECT_EQ(sum, expected_sum);
+  EXPECT_EQ(count, 100);
+}
+
+TEST(FrozenFlatHashMap, RejectsCorruptBlobs) {
+  absl::flat_hash_map<uint64_t, uint64_t> m;
+  for (uint64_t i = 0; i < 100; ++i) m[i] = i;
+  const std::string blob =
+      FreezeFlatHashMap<uint64_t, uint64_t, StableHash>(m);
+
+  // Truncated header.
+  {
+    std::vector<uint64_t> buf = Align(blob);
+    EXPECT_FALSE(View::FromBytes(AsBytes(buf, 8)).has_value());
+  }
+  // Truncated slot data.
+  {
+    std::vector<uint64_t> buf = Align(blob);
+    EXPECT_FALSE(View::FromBytes(AsBytes(buf, blob.size() - 16)).has_value());
+  }
+  // Bad magic.
+  {
+    std::string bad = blob;
+    bad[0] ^= 0x1;
+    std::vector<uint64_t> buf = Align(bad);
+    EXPECT_FALSE(View::FromBytes(AsBytes(buf, bad.size())).has_value());
+  }
+  // Mismatched slot type.
+  {
+    std::vector<uint64_t> buf = Align(blob);
+    using NarrowView = frozen_flat_hash_map_view<uint32_t, uint32_t,
+                                                 StableHash>;
+    EXPECT_FALSE(
+        NarrowView::FromBytes(AsBytes(buf, blob.size())).has_value());
+  }
+}
+
+TEST(FrozenFlatHashMap, FreezesAnyPairContainer) {
+  // The freezer only needs size() and iteration over key/value pairs.
+  std::vector<std::pair<uint64_t, uint64_t>> pairs = {{1, 10}, {2, 20},
+                                                      {3, 30}};
+  const std::string blob =
+      FreezeFlatHashMap<uint64_t, uint64_t, StableHash>(pairs);
+  const std::vector<uint64_t> buf = Align(blob);
+  auto view = View::FromBytes(AsBytes(buf, blob.size()));
+  ASSERT_TRUE(view.has_value());
+  EXPECT_EQ(view->size(), 3);
+  ASSERT_NE(view->find(2), nullptr);
+  EXPECT_EQ(*view->find(2), 20);
+}
+
+}  // namespace
+ABSL_NAMESPACE_END
+}  // namespace absl
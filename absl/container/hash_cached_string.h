@@ -0,0 +1,130 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// -----------------------------------------------------------------------------
+// File: hash_cached_string.h
+// -----------------------------------------------------------------------------
+//
+// `absl::HashCachedString` owns a `std::string` together with its `absl::Hash`
+// value, computed once when the string is set. Used as the key type of an
+// Abseil hash container, the cached hash is reused whenever the container
+// needs the hash of a stored key - most notably on rehash, and when the same
+// key is inserted into or looked up in several containers - instead of
+// rehashing the bytes each time:
+//
+//   absl::flat_hash_map<absl::HashCachedString, Payload> payloads;
+//   payloads[absl::HashCachedString("some key")] = ...;  // hashed once here
+//   ...
+//   auto it = payloads.find(name);  // heterogeneous: `name` hashed once, no
+//                                   // stored key is rehashed
+//
+// The default hash and equality functors of the Abseil hash containers accept
+// `HashCachedString` alongside `std::string`, `absl::string_view`, and
+// `const char*`, so lookups do not require constructing a `HashCachedString`.
+//
+// The stored string is immutable except through assignment, which recomputes
+// the cached hash; there is no way to mutate the characters while keeping a
+// stale hash.
+
+#ifndef ABSL_CONTAINER_HASH_CACHED_STRING_H_
+#define ABSL_CONTAINER_HASH_CACHED_STRING_H_
+
+#include <cstddef>
+#include <string>
+#include <utility>
+
+#include "absl/base/config.h"
+#include "absl/hash/hash.h"
+#include "absl/strings/string_view.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+// HashCachedString
+//
+// A `std::string` bundled with its `absl::Hash` value. The hash is computed
+// by the constructors and assignment operators, so it is always consistent
+// with the stored characters.
+class HashCachedString {
+ public:
+  HashCachedString() : hash_(Hash("")) {}
+  explicit HashCachedString(absl::string_view s)
+      : str_(s), hash_(Hash(str_)) {}
+  explicit HashCachedString(std::string&& s)
+      : str_(std::move(s)), hash_(Hash(str_)) {}
+  // Disambiguates string literals between the two constructors above.
+  explicit HashCachedString(const char* s)
+      : HashCachedString(absl::string_view(s)) {}
+
+  HashCachedString(const HashCachedString&) = default;
+  HashCachedString(HashCachedString&&) = default;
+  HashCachedString& operator=(const HashCachedString&) = default;
+  HashCachedString& operator=(HashCachedString&&) = default;
+
+  // Replaces the stored string and recomputes the cached hash.
+  HashCachedString& operator=(absl::string_view s) {
+    str_.assign(s.data(), s.size());
+    hash_ = Hash(str_);
+    return *this;
+  }
+  HashCachedString& operator=(std::string&& s) {
+    str_ = std::move(s);
+    hash_ = Hash(str_);
+    return *this;
+  }
+  HashCachedString& operator=(const char* s) {
+    return *this = absl::string_view(s);
+  }
+
+  // The stored string.
+  const std::string& str() const { return str_; }
+  operator absl::string_view() const { return str_; }  // NOLINT(runtime/explicit)
+
+  // The `absl::Hash<absl::string_view>` value of the stored string.
+  size_t hash() const { return hash_; }
+
+  bool empty() const { return str_.empty(); }
+  size_t size() const { return str_.size(); }
+
+  // Equal cached hashes are compared before the characters, so unequal
+  // strings are usually rejected without touching their bytes.
+  friend bool operator==(const HashCachedString& lhs,
+                         const HashCachedString& rhs) {
+    return lhs.hash_ == rhs.hash_ && lhs.str_ == rhs.str_;
+  }
+  friend bool operator!=(const HashCachedString& lhs,
+                         const HashCachedString& rhs) {
+    return !(lhs == rhs);
+  }
+
+  // Hashes like the stored string so that `absl::Hash<HashCachedString>` is
+  // consistent with the container functors that consume the cached value.
+  template <typename H>
+  friend H AbslHashValue(H h, const HashCachedString& s) {
+    return H::combine(std::move(h), absl::string_view(s.str_));
+  }
+
+ private:
+  static size_t Hash(absl::string_view s) {
+    return absl::Hash<absl::string_view>{}(s);
+  }
+
+  std::string str_;
+  size_t hash_;
+};
+
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_CONTAINER_HASH_CACHED_STRING_H_
@@ -0,0 +1,80 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/container/hash_cached_string.h"
+
+#include <string>
+#include <utility>
+
+#include "gtest/gtest.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/container/flat_hash_set.h"
+#include "absl/hash/hash.h"
+#include "absl/strings/string_view.h"
+
+namespace {
+
+TEST(HashCachedString, HashMatchesDefaultHasher) {
+  absl::string_view key = "some fairly long key that is expensive to hash";
+  absl::HashCachedString cached(key);
+  EXPECT_EQ(cached.hash(), absl::Hash<absl::string_view>{}(key));
+  EXPECT_EQ(cached.hash(), absl::Hash<absl::HashCachedString>{}(cached));
+  EXPECT_EQ(absl::string_view(cached), key);
+  EXPECT_EQ(cached.str(), key);
+}
+
+TEST(HashCachedString, AssignmentRecomputesHash) {
+  absl::HashCachedString cached("before");
+  cached = absl::string_view("after");
+  EXPECT_EQ(cached.hash(), absl::Hash<absl::string_view>{}("after"));
+  cached = std::string("moved in");
+  EXPECT_EQ(cached.hash(), absl::Hash<absl::string_view>{}("moved in"));
+  EXPECT_EQ(cached.str(), "moved in");
+}
+
+TEST(HashCachedString, Equality) {
+  absl::HashCachedString a("key");
+  absl::HashCachedString b("key");
+  absl::HashCachedString c("other");
+  EXPECT_EQ(a, b);
+  EXPECT_NE(a, c);
+  EXPECT_EQ(a, absl::string_view("key"));
+  EXPECT_NE(a, absl::string_view("other"));
+}
+
+TEST(HashCachedString, HeterogeneousLookupInFlatHashMap) {
+  absl::flat_hash_map<absl::HashCachedString, int> m;
+  m[absl::HashCachedString("one")] = 1;
+  m[absl::HashCachedString("two")] = 2;
+
+  auto it = m.find(absl::string_view("one"));
+  ASSERT_TRUE(it != m.end());
+  EXPECT_EQ(it->second, 1);
+  EXPECT_TRUE(m.contains("two"));
+  EXPECT_TRUE(m.contains(std::string("two")));
+  EXPECT_FALSE(m.contains("three"));
+  EXPECT_TRUE(m.contains(absl::HashCachedString("one")));
+}
+
+TEST(HashCachedString, SurvivesRehash) {
+  absl::flat_hash_set<absl::HashCachedString> s;
+  for (int i = 0; i < 1000; ++i) {
+    s.insert(absl::HashCachedString("key" + std::to_string(i)));
+  }
+  for (int i = 0; i < 1000; ++i) {
+    EXPECT_TRUE(s.contains("key" + std::to_string(i))) << i;
+  }
+}
+
+}  // namespace
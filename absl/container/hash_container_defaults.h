@@ -15,8 +15,15 @@
 #ifndef ABSL_CONTAINER_HASH_CONTAINER_DEFAULTS_H_
 #define ABSL_CONTAINER_HASH_CONTAINER_DEFAULTS_H_
 
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
 #include "absl/base/config.h"
+#include "absl/base/internal/raw_logging.h"
 #include "absl/container/internal/hash_function_defaults.h"
+#include "absl/numeric/bits.h"
+#include "absl/numeric/int128.h"
 
 namespace absl {
 ABSL_NAMESPACE_BEGIN
@@ -39,6 +46,69 @@ using DefaultHashContainerHash = absl::container_internal::hash_default_hash<T>;
 template <typename T>
 using DefaultHashContainerEq = absl::container_internal::hash_default_eq<T>;
 
+// NoMixHash
+//
+// A hashing functor for keys whose bits are already uniformly distributed,
+// such as cryptographic digests, fingerprints, or outputs of another strong
+// hash. It feeds the low 64 bits of the key directly into the container --
+// the swisstable derives its H1/H2 split from them unchanged -- instead of
+// remixing through `absl::Hash`'s multiply rounds on every operation.
+//
+// Use this only when every key is the output of a mixing function. Keys with
+// any structure (sequential ids, pointers, lengths, tags in low bits) will
+// cluster and degrade the table to linear scans; `absl::Hash` exists to
+// prevent exactly that. As a guard rail, debug builds inspect the first 256
+// hashed keys of each functor instance and log a warning if their bits do
+// not look uniform. The functor is also an explicit opt out of `absl::Hash`'s
+// per-process randomization, so hash values are predictable to anyone who
+// knows the keys; do not use it where flooding resistance matters.
+//
+// Example:
+//
+//   absl::flat_hash_map<uint64_t, Payload, absl::NoMixHash<uint64_t>>
+//       by_fingerprint;
+template <typename T>
+class NoMixHash {
+  static_assert(std::is_integral<T>::value ||
+                    std::is_same<T, absl::uint128>::value ||
+                    std::is_same<T, absl::int128>::value,
+                "NoMixHash requires an integral or 128-bit integer key; for "
+                "other pre-mixed key types, hash the digest field directly");
+
+ public:
+  size_t operator()(const T& value) const {
+    const uint64_t h = static_cast<uint64_t>(value);
+    DebugCheckUniformity(h);
+    return static_cast<size_t>(h);
+  }
+
+ private:
+#ifndef NDEBUG
+  void DebugCheckUniformity(uint64_t h) const {
+    seen_or_ |= h;
+    seen_and_ &= h;
+    if (++samples_ == 256) {
+      // Bits that were set in some sampled keys and clear in others.
+      const int varying = absl::popcount(seen_or_ & ~seen_and_);
+      if (varying < 32) {
+        ABSL_RAW_LOG(WARNING,
+                     "NoMixHash: only %d of 64 hash bits vary across the "
+                     "first 256 keys; these keys do not look pre-mixed and "
+                     "will degrade hash table performance. Use the default "
+                     "hasher instead.",
+                     varying);
+      }
+    }
+  }
+
+  mutable uint64_t seen_or_ = 0;
+  mutable uint64_t seen_and_ = ~uint64_t{0};
+  mutable uint32_t samples_ = 0;
+#else
+  void DebugCheckUniformity(uint64_t) const {}
+#endif
+};
+
 ABSL_NAMESPACE_END
 }  // namespace absl
 
@@ -0,0 +1,63 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/container/hash_container_defaults.h"
+
+#include <cstddef>
+#include <cstdint>
+
+#include "gtest/gtest.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/numeric/int128.h"
+
+namespace {
+
+// A SplitMix64 round; stands in for the fingerprints NoMixHash is meant for.
+uint64_t Mix(uint64_t x) {
+  x += 0x9e3779b97f4a7c15u;
+  x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9u;
+  x = (x ^ (x >> 27)) * 0x94d049bb133111ebu;
+  return x ^ (x >> 31);
+}
+
+TEST(NoMixHash, IsIdentityOnLow64Bits) {
+  absl::NoMixHash<uint64_t> hash64;
+  EXPECT_EQ(hash64(0), 0u);
+  EXPECT_EQ(hash64(0x123456789abcdef0u),
+            static_cast<size_t>(0x123456789abcdef0u));
+
+  absl::NoMixHash<absl::uint128> hash128;
+  const absl::uint128 digest = absl::MakeUint128(0xdeadbeefu, Mix(42));
+  EXPECT_EQ(hash128(digest), static_cast<size_t>(Mix(42)));
+}
+
+TEST(NoMixHash, WorksAsFlatHashMapHasher) {
+  absl::flat_hash_map<uint64_t, int, absl::NoMixHash<uint64_t>> m;
+  constexpr int kCount = 10000;
+  for (int i = 0; i < kCount; ++i) {
+    m[Mix(static_cast<uint64_t>(i))] = i;
+  }
+  ASSERT_EQ(m.size(), static_cast<size_t>(kCount));
+  for (int i = 0; i < kCount; ++i) {
+    auto it = m.find(Mix(static_cast<uint64_t>(i)));
+    ASSERT_NE(it, m.end()) << i;
+    EXPECT_EQ(it->second, i);
+  }
+  for (int i = 0; i < kCount; i += 2) {
+    EXPECT_EQ(m.erase(Mix(static_cast<uint64_t>(i))), 1u) << i;
+  }
+  EXPECT_EQ(m.size(), static_cast<size_t>(kCount / 2));
+}
+
+}  // namespace
@@ -0,0 +1,99 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// -----------------------------------------------------------------------------
+// File: hashtable_stats.h
+// -----------------------------------------------------------------------------
+//
+// Introspection for the Swiss-table hash containers (`absl::flat_hash_map`,
+// `absl::flat_hash_set`, `absl::node_hash_map`, `absl::node_hash_set`).
+// `absl::GetHashtableStats()` summarizes a table's occupancy and probing
+// behavior, which is useful for monitoring production canaries: a growing
+// tombstone count or a fattening probe-length histogram flags a degraded
+// hash distribution before it turns into a CPU regression.
+//
+//   absl::HashtableStats stats = absl::GetHashtableStats(my_map);
+//   LOG(INFO) << "load " << double{stats.size} / stats.capacity
+//             << " tombstones " << stats.num_deleted
+//             << " mean probe length " << stats.mean_probe_length;
+//
+// The occupancy counts come from a single pass over the table's control
+// bytes. The probe-length histogram additionally hashes every element, so
+// computing it costs about as much as looking every element up once; sample
+// accordingly when tables are large.
+
+#ifndef ABSL_CONTAINER_HASHTABLE_STATS_H_
+#define ABSL_CONTAINER_HASHTABLE_STATS_H_
+
+#include <cstddef>
+#include <vector>
+
+#include "absl/base/config.h"
+#include "absl/container/internal/hashtable_debug.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+// HashtableStats
+//
+// A snapshot of a hash table's occupancy and probing behavior.
+struct HashtableStats {
+  // The number of slots in the backing array.
+  size_t capacity;
+
+  // The number of elements.
+  size_t size;
+
+  // The number of tombstones (slots left behind by erasures that still
+  // lengthen probe sequences until the next rehash).
+  size_t num_deleted;
+
+  // `probe_length_histogram[i]` is the number of elements whose lookup takes
+  // `i` extra probes past its preferred position; the sum of the entries is
+  // `size`. A well-distributed hash keeps almost all mass at index 0.
+  std::vector<size_t> probe_length_histogram;
+
+  // The mean of the distribution above, or zero for an empty table.
+  double mean_probe_length;
+};
+
+// GetHashtableStats()
+//
+// Returns a `HashtableStats` snapshot of `c`, which must be one of the
+// Swiss-table containers. The container is not modified; as with any
+// inspection of a hash table, concurrent writes must be excluded by the
+// caller.
+template <typename C>
+HashtableStats GetHashtableStats(const C& c) {
+  using Access = container_internal::hashtable_debug_internal::
+      HashtableDebugAccess<C>;
+  HashtableStats stats = {};
+  stats.capacity = c.capacity();
+  stats.size = c.size();
+  stats.num_deleted = Access::GetNumDeleted(c);
+  stats.probe_length_histogram =
+      container_internal::GetHashtableDebugNumProbesHistogram(c);
+  size_t total_probes = 0;
+  for (size_t i = 0; i < stats.probe_length_histogram.size(); ++i) {
+    total_probes += i * stats.probe_length_histogram[i];
+  }
+  stats.mean_probe_length =
+      stats.size == 0 ? 0.0 : 1.0 * total_probes / stats.size;
+  return stats;
+}
+
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_CONTAINER_HASHTABLE_STATS_H_
@@ -0,0 +1,107 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/container/hashtable_stats.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/container/flat_hash_set.h"
+#include "absl/container/node_hash_map.h"
+
+namespace {
+
+TEST(HashtableStats, Empty) {
+  absl::flat_hash_map<int, int> m;
+  absl::HashtableStats stats = absl::GetHashtableStats(m);
+  EXPECT_EQ(stats.size, 0);
+  EXPECT_EQ(stats.num_deleted, 0);
+  EXPECT_EQ(stats.mean_probe_length, 0.0);
+  EXPECT_EQ(std::accumulate(stats.probe_length_histogram.begin(),
+                            stats.probe_length_histogram.end(), size_t{0}),
+            0);
+}
+
+TEST(HashtableStats, CountsMatchContainer) {
+  absl::flat_hash_map<int, std::string> m;
+  for (int i = 0; i < 1000; ++i) m[i] = std::to_string(i);
+
+  absl::HashtableStats stats = absl::GetHashtableStats(m);
+  EXPECT_EQ(stats.size, 1000);
+  EXPECT_EQ(stats.capacity, m.capacity());
+  EXPECT_GE(stats.capacity, stats.size);
+  // The histogram covers every element.
+  EXPECT_EQ(std::accumulate(stats.probe_length_histogram.begin(),
+                            stats.probe_length_histogram.end(), size_t{0}),
+            stats.size);
+  EXPECT_GE(stats.mean_probe_length, 0.0);
+}
+
+TEST(HashtableStats, CountsTombstones) {
+  // Erasure only leaves a tombstone behind when the erased slot's
+  // neighborhood is full (otherwise the slot is marked empty again), so use a
+  // degenerate hash to pack the elements into one dense run.
+  struct DegenerateHash {
+    size_t operator()(int64_t) const { return 0; }
+  };
+  absl::flat_hash_set<int64_t, DegenerateHash> s;
+  for (int64_t i = 0; i < 200; ++i) s.insert(i);
+  const size_t capacity = s.capacity();
+
+  for (int64_t i = 0; i < 100; ++i) s.erase(i);
+  ASSERT_EQ(s.capacity(), capacity);
+
+  absl::HashtableStats stats = absl::GetHashtableStats(s);
+  EXPECT_EQ(stats.size, 100);
+  EXPECT_GT(stats.num_deleted, 0);
+  EXPECT_LE(stats.num_deleted, 100);
+
+  // Rehashing clears the tombstones.
+  s.rehash(0);
+  stats = absl::GetHashtableStats(s);
+  EXPECT_EQ(stats.size, 100);
+  EXPECT_EQ(stats.num_deleted, 0);
+}
+
+TEST(HashtableStats, DetectsBadHash) {
+  struct DegenerateHash {
+    size_t operator()(int64_t) const { return 0; }
+  };
+  absl::flat_hash_set<int64_t, DegenerateHash> bad;
+  absl::flat_hash_set<int64_t> good;
+  for (int64_t i = 0; i < 200; ++i) {
+    bad.insert(i);
+    good.insert(i);
+  }
+
+  absl::HashtableStats bad_stats = absl::GetHashtableStats(bad);
+  absl::HashtableStats good_stats = absl::GetHashtableStats(good);
+  EXPECT_GT(bad_stats.mean_probe_length, good_stats.mean_probe_length);
+}
+
+TEST(HashtableStats, NodeContainers) {
+  absl::node_hash_map<int, std::string> m;
+  for (int i = 0; i < 100; ++i) m[i] = std::to_string(i);
+  m.erase(42);
+
+  absl::HashtableStats stats = absl::GetHashtableStats(m);
+  EXPECT_EQ(stats.size, 99);
+  EXPECT_EQ(stats.capacity, m.capacity());
+}
+
+}  // namespace
@@ -0,0 +1,88 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/container/hugepage_allocator.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/container/internal/hugepage_memory.h"
+
+namespace {
+
+using absl::container_internal::kHugepageSize;
+using absl::container_internal::kHugepageThreshold;
+
+TEST(HugepageAllocator, SmallAllocationsRoundTrip) {
+  absl::HugepageAllocator<int> alloc;
+  for (size_t n : {size_t{1}, size_t{7}, size_t{1024}}) {
+    int* p = alloc.allocate(n);
+    ASSERT_NE(p, nullptr);
+    std::memset(p, 0xab, n * sizeof(int));
+    alloc.deallocate(p, n);
+  }
+}
+
+TEST(HugepageAllocator, LargeAllocationsAreHugepageAligned) {
+  absl::HugepageAllocator<char> alloc;
+  const size_t n = kHugepageThreshold + 123;
+  char* p = alloc.allocate(n);
+  ASSERT_NE(p, nullptr);
+#if defined(__linux__)
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(p) % kHugepageSize, 0);
+#endif
+  // The whole requested range must be usable.
+  std::memset(p, 0xcd, n);
+  EXPECT_EQ(static_cast<unsigned char>(p[n - 1]), 0xcd);
+  alloc.deallocate(p, n);
+}
+
+TEST(HugepageAllocator, AllocatorRequirements) {
+  absl::HugepageAllocator<int> a;
+  absl::HugepageAllocator<long> b(a);  // rebind-style converting construction
+  EXPECT_TRUE(a == b);
+  EXPECT_FALSE(a != b);
+}
+
+TEST(HugepageAllocator, WorksAsFlatHashMapBackingAllocator) {
+  using Alloc = absl::HugepageAllocator<std::pair<const uint64_t, uint64_t>>;
+  absl::flat_hash_map<uint64_t, uint64_t, absl::Hash<uint64_t>,
+                      std::equal_to<uint64_t>, Alloc>
+      map;
+  // Enough elements that the backing array crosses the hugepage threshold.
+  const uint64_t n = (kHugepageThreshold / 16) * 2;
+  for (uint64_t i = 0; i < n; ++i) map[i] = i * 3;
+  for (uint64_t i = 0; i < n; ++i) {
+    auto it = map.find(i);
+    ASSERT_NE(it, map.end());
+    EXPECT_EQ(it->second, i * 3);
+  }
+  for (uint64_t i = 0; i < n; i += 2) map.erase(i);
+  EXPECT_EQ(map.size(), n / 2);
+}
+
+TEST(HugepageAllocator, WorksInStdVector) {
+  std::vector<double, absl::HugepageAllocator<double>> v;
+  v.resize(kHugepageThreshold / sizeof(double) + 1, 0.5);
+  EXPECT_EQ(v.back(), 0.5);
+  v.clear();
+  v.shrink_to_fit();
+}
+
+}  // namespace
@@ -0,0 +1,271 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// -----------------------------------------------------------------------------
+// File: incremental_flat_hash_map.h
+// -----------------------------------------------------------------------------
+//
+// An `absl::incremental_flat_hash_map<K, V>` is an unordered associative
+// container with the same lookup performance as `absl::flat_hash_map` but
+// with growth cost amortized across subsequent operations instead of paid in
+// one shot.
+//
+// When a large `flat_hash_map` grows, every element is rehashed into the new
+// backing array inside a single insert call; for multi-GB tables that one
+// call can stall a serving thread for tens to hundreds of milliseconds. This
+// container instead keeps up to two `flat_hash_map`s alive during growth: new
+// inserts go to the larger table, lookups consult both, and every mutating
+// operation migrates a small bounded batch of elements from the old table to
+// the new one until the old table is empty. No single operation ever rehashes
+// more than a constant number of elements.
+//
+// The price is a second probe on lookups while a migration is in flight and
+// an interface without iterators (an element may move between the two backing
+// tables at any mutating call). Use this container only when tail latency of
+// mutating operations matters more than peak throughput; otherwise prefer
+// `flat_hash_map`, or `reserve()` up front when the final size is known.
+
+#ifndef ABSL_CONTAINER_INCREMENTAL_FLAT_HASH_MAP_H_
+#define ABSL_CONTAINER_INCREMENTAL_FLAT_HASH_MAP_H_
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/container/hash_container_defaults.h"
+#include "absl/container/internal/raw_hash_set.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+// -----------------------------------------------------------------------------
+// absl::incremental_flat_hash_map
+// -----------------------------------------------------------------------------
+//
+// An `absl::incremental_flat_hash_map<K, V>` differs from `flat_hash_map` in
+// the following notable ways:
+//
+// * Growth is incremental: a mutating operation migrates at most a constant
+//   number of elements, so there are no rehash latency spikes.
+// * There are no iterators. `find()` returns a pointer to the mapped value
+//   (or `nullptr`), which is valid until the next mutating operation.
+// * Memory usage is temporarily higher while a migration is in flight, since
+//   the old and new backing tables are both live.
+//
+// Heterogeneous lookup is supported under the same conditions as
+// `flat_hash_map`.
+template <class K, class V, class Hash = DefaultHashContainerHash<K>,
+          class Eq = DefaultHashContainerEq<K>,
+          class Allocator = std::allocator<std::pair<const K, V>>>
+class incremental_flat_hash_map {
+  using Map = absl::flat_hash_map<K, V, Hash, Eq, Allocator>;
+
+ public:
+  using key_type = typename Map::key_type;
+  using mapped_type = typename Map::mapped_type;
+  using value_type = typename Map::value_type;
+  using size_type = typename Map::size_type;
+  using hasher = typename Map::hasher;
+  using key_equal = typename Map::key_equal;
+  using allocator_type = typename Map::allocator_type;
+
+  incremental_flat_hash_map() = default;
+
+  // Inserts `value` if its key is not already present. Returns `true` if the
+  // insertion took place.
+  bool insert(const value_type& value) {
+    return do_insert([&](Map& m) { return m.insert(value).second; },
+                     value.first);
+  }
+  bool insert(value_type&& value) {
+    return do_insert([&](Map& m) { return m.insert(std::move(value)).second; },
+                     value.first);
+  }
+
+  // Constructs `mapped_type` from `args` and inserts it under `key` if the
+  // key is not already present. Returns `true` if the insertion took place.
+  template <class Key, class... Args>
+  bool try_emplace(Key&& key, Args&&... args) {
+    return do_insert(
+        [&](Map& m) {
+          return m.try_emplace(std::forward<Key>(key),
+                               std::forward<Args>(args)...)
+              .second;
+        },
+        key);
+  }
+
+  // Inserts or overwrites the value stored under `key`. Returns `true` if a
+  // new element was inserted, `false` if an existing one was assigned to.
+  template <class Key, class Mapped>
+  bool insert_or_assign(Key&& key, Mapped&& mapped) {
+    prepare_mutation();
+    // An existing element may still live in the old table; erase it there so
+    // that the assignment in the active table does not create a duplicate.
+    const bool existed = migrating() && old().erase(key) > 0;
+    const bool inserted =
+        active()
+            .insert_or_assign(std::forward<Key>(key),
+                              std::forward<Mapped>(mapped))
+            .second;
+    return inserted && !existed;
+  }
+
+  // Returns a pointer to the value mapped to the given key, or `nullptr` if
+  // the key is not present. The pointer is invalidated by the next mutating
+  // operation.
+  template <class Key>
+  V* find(const Key& key) {
+    auto it = active().find(key);
+    if (it != active().end()) return &it->second;
+    if (migrating()) {
+      it = old().find(key);
+      if (it != old().end()) return &it->second;
+    }
+    return nullptr;
+  }
+  template <class Key>
+  const V* find(const Key& key) const {
+    return const_cast<incremental_flat_hash_map*>(this)->find(key);
+  }
+
+  template <class Key>
+  bool contains(const Key& key) const {
+    return find(key) != nullptr;
+  }
+
+  // Erases the element with the given key, if any. Returns the number of
+  // elements erased (0 or 1).
+  template <class Key>
+  size_type erase(const Key& key) {
+    migrate_some();
+    size_type erased = active().erase(key);
+    if (erased == 0 && migrating()) erased = old().erase(key);
+    return erased;
+  }
+
+  // Runs `fn` on every element. Elements are visited in no particular order.
+  template <class Fn>
+  void for_each(Fn fn) {
+    for (value_type& v : active()) fn(v);
+    if (migrating()) {
+      for (value_type& v : old()) fn(v);
+    }
+  }
+  template <class Fn>
+  void for_each(Fn fn) const {
+    for (const value_type& v : active()) fn(v);
+    if (migrating()) {
+      for (const value_type& v : old()) fn(v);
+    }
+  }
+
+  size_type size() const { return active().size() + old().size(); }
+  bool empty() const { return size() == 0; }
+
+  void clear() {
+    maps_[0].clear();
+    maps_[1].clear();
+  }
+
+  // Grows the active table so that `n` elements fit without further growth.
+  // Unlike organic growth, an explicit reserve rehashes in one shot: callers
+  // asking for capacity up front have already chosen to pay the cost here.
+  void reserve(size_type n) {
+    drain();
+    active().reserve(n);
+  }
+
+ private:
+  // How many elements each mutating operation moves from the old table to the
+  // active one while a migration is in flight. Must be at least 2 so that
+  // migration outpaces insertion and the old table drains before the active
+  // one fills (the active table starts at twice the old capacity).
+  static constexpr size_type kMigrationStride = 32;
+
+  Map& active() { return maps_[active_]; }
+  const Map& active() const { return maps_[active_]; }
+  Map& old() { return maps_[1 - active_]; }
+  const Map& old() const { return maps_[1 - active_]; }
+
+  bool migrating() const { return !old().empty(); }
+
+  // Tables below this capacity grow organically; their one-shot rehash is
+  // cheap, so migrating them would only add lookup overhead.
+  static constexpr size_type kMinMigrationCapacity = 64;
+
+  // Returns the number of elements the active table can hold before its
+  // internal growth would trigger.
+  size_type growth_limit() const {
+    const size_type cap = active().capacity();
+    return cap == 0 ? 0 : container_internal::CapacityToGrowth(cap);
+  }
+
+  // Advances any in-flight migration and, if the active table is about to
+  // grow, redirects subsequent inserts to the other table so the rehash
+  // happens incrementally.
+  void prepare_mutation() {
+    migrate_some();
+    if (!migrating() && active().capacity() >= kMinMigrationCapacity &&
+        active().size() >= growth_limit()) {
+      start_migration();
+    }
+  }
+
+  template <class Inserter, class Key>
+  bool do_insert(Inserter insert_fn, const Key& key) {
+    prepare_mutation();
+    // A key still waiting in the old table must not be duplicated in the
+    // active one.
+    if (migrating() && old().contains(key)) return false;
+    return insert_fn(active());
+  }
+
+  void start_migration() {
+    Map& next = old();  // Currently empty; becomes the active table.
+    next.reserve(2 * active().capacity());
+    active_ = 1 - active_;
+  }
+
+  // Moves up to kMigrationStride elements from the old table to the active
+  // one. Extraction by node handle would avoid copies, but flat_hash_map
+  // nodes own standalone slots rather than table storage, so plain moves are
+  // equivalent here.
+  void migrate_some() {
+    if (!migrating()) return;
+    Map& src = old();
+    Map& dst = active();
+    auto it = src.begin();
+    for (size_type i = 0; i < kMigrationStride && it != src.end(); ++i) {
+      auto next = std::next(it);
+      dst.insert(std::move(*it));
+      src.erase(it);
+      it = next;
+    }
+  }
+
+  // Completes any in-flight migration.
+  void drain() {
+    while (migrating()) migrate_some();
+  }
+
+  Map maps_[2];
+  int active_ = 0;
+};
+
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_CONTAINER_INCREMENTAL_FLAT_HASH_MAP_H_
@@ -0,0 +1,139 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/container/incremental_flat_hash_map.h"
+
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "absl/strings/string_view.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+namespace {
+
+TEST(IncrementalFlatHashMap, BasicOperations) {
+  incremental_flat_hash_map<int, int> m;
+  EXPECT_TRUE(m.empty());
+
+  EXPECT_TRUE(m.insert({1, 10}));
+  EXPECT_FALSE(m.insert({1, 11}));
+  EXPECT_TRUE(m.try_emplace(2, 20));
+  EXPECT_FALSE(m.try_emplace(2, 21));
+  EXPECT_EQ(m.size(), 2);
+
+  ASSERT_NE(m.find(1), nullptr);
+  EXPECT_EQ(*m.find(1), 10);
+  EXPECT_EQ(m.find(3), nullptr);
+  EXPECT_TRUE(m.contains(2));
+
+  EXPECT_EQ(m.erase(1), 1);
+  EXPECT_EQ(m.erase(1), 0);
+  EXPECT_EQ(m.size(), 1);
+
+  m.clear();
+  EXPECT_TRUE(m.empty());
+}
+
+TEST(IncrementalFlatHashMap, GrowsThroughManyMigrations) {
+  constexpr int kCount = 100000;
+  incremental_flat_hash_map<int64_t, int64_t> m;
+  for (int64_t i = 0; i < kCount; ++i) {
+    ASSERT_TRUE(m.try_emplace(i, i * 2)) << i;
+    // Recently and long-ago inserted keys stay findable while elements are
+    // spread across two backing tables mid-migration.
+    ASSERT_NE(m.find(i), nullptr) << i;
+    ASSERT_NE(m.find(i / 2), nullptr) << i;
+  }
+  EXPECT_EQ(m.size(), kCount);
+  for (int64_t i = 0; i < kCount; ++i) {
+    const int64_t* v = m.find(i);
+    ASSERT_NE(v, nullptr) << i;
+    EXPECT_EQ(*v, i * 2);
+  }
+
+  // Re-inserting every key fails regardless of which backing table currently
+  // holds it.
+  for (int64_t i = 0; i < kCount; ++i) {
+    ASSERT_FALSE(m.try_emplace(i, -1)) << i;
+  }
+  EXPECT_EQ(m.size(), kCount);
+}
+
+TEST(IncrementalFlatHashMap, InsertOrAssignOverwritesMidMigration) {
+  constexpr int kCount = 10000;
+  incremental_flat_hash_map<int, int> m;
+  for (int i = 0; i < kCount; ++i) m.try_emplace(i, i);
+  // Some of these keys are in the old table, some in the active one.
+  for (int i = 0; i < kCount; ++i) {
+    EXPECT_FALSE(m.insert_or_assign(i, i + 1));
+  }
+  EXPECT_EQ(m.size(), kCount);
+  for (int i = 0; i < kCount; ++i) {
+    ASSERT_NE(m.find(i), nullptr);
+    EXPECT_EQ(*m.find(i), i + 1);
+  }
+}
+
+TEST(IncrementalFlatHashMap, EraseMidMigration) {
+  constexpr int kCount = 10000;
+  incremental_flat_hash_map<int, int> m;
+  for (int i = 0; i < kCount; ++i) m.try_emplace(i, i);
+  for (int i = 0; i < kCount; i += 2) {
+    ASSERT_EQ(m.erase(i), 1) << i;
+  }
+  EXPECT_EQ(m.size(), kCount / 2);
+  for (int i = 0; i < kCount; ++i) {
+    EXPECT_EQ(m.contains(i), i % 2 == 1) << i;
+  }
+}
+
+TEST(IncrementalFlatHashMap, ForEach) {
+  incremental_flat_hash_map<int, int> m;
+  for (int i = 0; i < 1000; ++i) m.try_emplace(i, 1);
+
+  int64_t sum = 0;
+  const auto& cm = m;
+  cm.for_each([&](const std::pair<const int, int>& p) { sum += p.second; });
+  EXPECT_EQ(sum, 1000);
+
+  m.for_each([](std::pair<const int, int>& p) { p.second = 2; });
+  sum = 0;
+  cm.for_each([&](const std::pair<const int, int>& p) { sum += p.second; });
+  EXPECT_EQ(sum, 2000);
+}
+
+TEST(IncrementalFlatHashMap, ReserveAvoidsMigration) {
+  incremental_flat_hash_map<int, int> m;
+  m.reserve(10000);
+  for (int i = 0; i < 10000; ++i) ASSERT_TRUE(m.try_emplace(i, i));
+  EXPECT_EQ(m.size(), 10000);
+}
+
+TEST(IncrementalFlatHashMap, HeterogeneousLookup) {
+  incremental_flat_hash_map<std::string, int> m;
+  m.try_emplace("abc", 1);
+  absl::string_view key = "abc";
+  EXPECT_TRUE(m.contains(key));
+  ASSERT_NE(m.find(key), nullptr);
+  EXPECT_EQ(*m.find(key), 1);
+  EXPECT_EQ(m.erase(key), 1);
+}
+
+}  // namespace
+ABSL_NAMESPACE_END
+}  // namespace absl
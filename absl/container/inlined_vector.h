@@ -53,6 +53,7 @@
 #include "absl/container/internal/inlined_vector.h"
 #include "absl/memory/memory.h"
 #include "absl/meta/type_traits.h"
+#include "absl/types/span.h"
 
 namespace absl {
 ABSL_NAMESPACE_BEGIN
@@ -755,6 +756,51 @@ class InlinedVector {
     static_cast<void>(emplace_back(std::move(v)));
   }
 
+  // `InlinedVector::append(...)`
+  //
+  // Appends the elements of `values` to the end of the inlined vector. When
+  // the value type is trivially copyable and the default allocator is in use,
+  // this is a single `memcpy` plus a size update rather than the generic
+  // iterator loop of `insert(end(), first, last)`.
+  //
+  // `values` must not overlap the vector's own storage, which the call may
+  // reallocate.
+  void append(absl::Span<const value_type> values) {
+    if (ABSL_PREDICT_FALSE(values.empty())) return;
+    // Fast path: if the value type is trivially copy constructible and
+    // trivially destructible and we know the allocator doesn't do anything
+    // fancy, then it is legal for us to simply memcpy the span's elements
+    // into uninitialized tail slots.
+    if (absl::is_trivially_copy_constructible<value_type>::value &&
+        absl::is_trivially_destructible<value_type>::value &&
+        std::is_same<A, std::allocator<value_type>>::value) {
+      pointer dst = storage_.AppendUninitialized(values.size());
+      std::memcpy(reinterpret_cast<char*>(dst),
+                  reinterpret_cast<const char*>(values.data()),
+                  values.size() * sizeof(value_type));
+      return;
+    }
+    insert(end(), values.begin(), values.end());
+  }
+
+  // `InlinedVector::append_uninitialized(...)`
+  //
+  // Extends the inlined vector by `n` elements whose storage is left
+  // uninitialized and returns a `Span` covering the new tail, for writers
+  // that fill the bytes in place (the counterpart of
+  // `STLStringResizeUninitialized()` for strings). Every returned element
+  // must be written before it is read. Only available for trivially copyable
+  // value types with the default allocator.
+  absl::Span<value_type> append_uninitialized(size_type n)
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    static_assert(absl::is_trivially_copy_constructible<value_type>::value &&
+                      absl::is_trivially_destructible<value_type>::value &&
+                      std::is_same<A, std::allocator<value_type>>::value,
+                  "append_uninitialized() requires a trivially copyable value "
+                  "type and the default allocator.");
+    return absl::Span<value_type>(storage_.AppendUninitialized(n), n);
+  }
+
   // `InlinedVector::pop_back()`
   //
   // Destroys the element at `back()`, reducing the size by `1`.
@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <forward_list>
 #include <iterator>
 #include <list>
@@ -304,6 +305,31 @@ TEST(UniquePtr, MoveAssign) {
   }
 }
 
+// Growing a container of unique pointers should relocate the elements into
+// the new backing store with no leaks and no double-frees, whether or not
+// unique pointers are detected as trivially relocatable on this toolchain.
+TEST(UniquePtr, Growth) {
+  for (size_t size = 0; size < 16; ++size) {
+    SCOPED_TRACE(size);
+
+    absl::InlinedVector<std::unique_ptr<size_t>, 2> a;
+    for (size_t i = 0; i < size; ++i) {
+      a.push_back(std::make_unique<size_t>(i));
+    }
+    a.reserve(size + 20);
+    ASSERT_THAT(a, SizeIs(size));
+    for (size_t i = 0; i < size; ++i) {
+      ASSERT_THAT(a[i], Pointee(i));
+    }
+
+    a.shrink_to_fit();
+    ASSERT_THAT(a, SizeIs(size));
+    for (size_t i = 0; i < size; ++i) {
+      ASSERT_THAT(a[i], Pointee(i));
+    }
+  }
+}
+
 // Swapping containers of unique pointers should work fine, with no
 // leaks, despite the fact that unique pointers are trivially relocatable but
 // not trivially destructible.
@@ -2205,4 +2231,38 @@ TEST(StorageTest, InlinedCapacityAutoIncrease) {
             sizeof(MySpan<int>) / sizeof(int));
 }
 
+TEST(AppendTest, AppendsTriviallyCopyableSpans) {
+  absl::InlinedVector<uint8_t, 8> v;
+  std::vector<uint8_t> bytes(100);
+  for (size_t i = 0; i < bytes.size(); ++i) bytes[i] = static_cast<uint8_t>(i);
+
+  // An empty span is a no-op; the first real append grows inline storage to
+  // heap storage; further appends extend in place or reallocate.
+  v.append(absl::Span<const uint8_t>());
+  EXPECT_TRUE(v.empty());
+  v.append(absl::MakeConstSpan(bytes.data(), 4));
+  EXPECT_THAT(v, ElementsAre(0, 1, 2, 3));
+  v.append(absl::MakeConstSpan(bytes.data() + 4, bytes.size() - 4));
+  EXPECT_THAT(v, ElementsAreArray(bytes));
+}
+
+TEST(AppendTest, AppendFallsBackForNonTrivialTypes) {
+  absl::InlinedVector<std::string, 2> v = {"a", "b"};
+  std::vector<std::string> more = {"c", "d", "e"};
+  v.append(absl::MakeConstSpan(more));
+  EXPECT_THAT(v, ElementsAre("a", "b", "c", "d", "e"));
+}
+
+TEST(AppendTest, AppendUninitializedIsWritableTail) {
+  absl::InlinedVector<uint8_t, 8> v = {1, 2, 3};
+  absl::Span<uint8_t> tail = v.append_uninitialized(64);
+  EXPECT_EQ(tail.size(), 64u);
+  EXPECT_EQ(tail.data(), v.data() + 3);
+  EXPECT_EQ(v.size(), 67u);
+  for (size_t i = 0; i < tail.size(); ++i) tail[i] = static_cast<uint8_t>(i);
+  EXPECT_EQ(v[3], 0);
+  EXPECT_EQ(v[66], 63);
+  EXPECT_THAT(v, SizeIs(67));
+}
+
 }  // anonymous namespace
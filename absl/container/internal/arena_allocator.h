@@ -0,0 +1,96 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef ABSL_CONTAINER_INTERNAL_ARENA_ALLOCATOR_H_
+#define ABSL_CONTAINER_INTERNAL_ARENA_ALLOCATOR_H_
+
+#include <cstddef>
+
+#include "absl/base/config.h"
+#include "absl/base/internal/low_level_alloc.h"
+
+// ArenaAllocator is only available on platforms where LowLevelAlloc is
+// available.
+#ifndef ABSL_LOW_LEVEL_ALLOC_MISSING
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+namespace container_internal {
+
+// A standard-compliant allocator that draws memory from a
+// `absl::base_internal::LowLevelAlloc::Arena`. It is intended for
+// allocator-aware containers whose heap fallback would otherwise hit
+// `operator new` on a hot path; in particular it lets the oversize case of
+// `absl::FixedArray` become an arena allocation:
+//
+//   LowLevelAlloc::Arena* arena = ...;  // e.g. one per request or per thread
+//   absl::FixedArray<char, 0, ArenaAllocator<char>> buf(
+//       n, ArenaAllocator<char>(arena));
+//
+// The allocator is a single pointer, propagates to rebound copies, and
+// compares equal iff both allocators use the same arena. A default-constructed
+// instance uses `LowLevelAlloc::DefaultArena()`.
+template <typename T>
+class ArenaAllocator {
+ public:
+  using value_type = T;
+  using size_type = size_t;
+  using difference_type = ptrdiff_t;
+
+  ArenaAllocator() = default;
+  explicit ArenaAllocator(absl::base_internal::LowLevelAlloc::Arena* arena)
+      : arena_(arena) {}
+
+  template <typename U>
+  ArenaAllocator(const ArenaAllocator<U>& x) : arena_(x.arena()) {}
+
+  T* allocate(size_t n) {
+    // LowLevelAlloc aligns all blocks to 2 * sizeof(void*) and provides no way
+    // to request more.
+    static_assert(alignof(T) <= 2 * sizeof(void*),
+                  "ArenaAllocator cannot allocate over-aligned types");
+    return static_cast<T*>(absl::base_internal::LowLevelAlloc::AllocWithArena(
+        n * sizeof(T), arena_));
+  }
+
+  void deallocate(T* p, size_t) { absl::base_internal::LowLevelAlloc::Free(p); }
+
+  absl::base_internal::LowLevelAlloc::Arena* arena() const { return arena_; }
+
+  template <typename U>
+  class rebind {
+   public:
+    using other = ArenaAllocator<U>;
+  };
+
+  friend bool operator==(const ArenaAllocator& a, const ArenaAllocator& b) {
+    return a.arena_ == b.arena_;
+  }
+
+  friend bool operator!=(const ArenaAllocator& a, const ArenaAllocator& b) {
+    return !(a == b);
+  }
+
+ private:
+  absl::base_internal::LowLevelAlloc::Arena* arena_ =
+      absl::base_internal::LowLevelAlloc::DefaultArena();
+};
+
+}  // namespace container_internal
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // !ABSL_LOW_LEVEL_ALLOC_MISSING
+
+#endif  // ABSL_CONTAINER_INTERNAL_ARENA_ALLOCATOR_H_
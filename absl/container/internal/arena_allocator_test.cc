@@ -0,0 +1,106 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/container/internal/arena_allocator.h"
+
+#ifndef ABSL_LOW_LEVEL_ALLOC_MISSING
+
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "absl/base/internal/low_level_alloc.h"
+#include "absl/container/fixed_array.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+namespace container_internal {
+namespace {
+
+using ::absl::base_internal::LowLevelAlloc;
+using ::testing::ElementsAre;
+
+TEST(ArenaAllocator, AllocateDeallocate) {
+  LowLevelAlloc::Arena* arena = LowLevelAlloc::NewArena(0);
+  ArenaAllocator<int64_t> alloc(arena);
+
+  int64_t* p = alloc.allocate(100);
+  ASSERT_NE(p, nullptr);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(p) % alignof(int64_t), 0);
+  std::iota(p, p + 100, int64_t{0});
+
+  // The arena cannot be destroyed while the block is live.
+  EXPECT_FALSE(LowLevelAlloc::DeleteArena(arena));
+  alloc.deallocate(p, 100);
+  EXPECT_TRUE(LowLevelAlloc::DeleteArena(arena));
+}
+
+TEST(ArenaAllocator, Comparison) {
+  LowLevelAlloc::Arena* arena = LowLevelAlloc::NewArena(0);
+  ArenaAllocator<int> a(arena);
+  ArenaAllocator<int> b(arena);
+  ArenaAllocator<int> c;  // DefaultArena()
+
+  EXPECT_EQ(a, b);
+  EXPECT_NE(a, c);
+  // Rebound copies use the same arena.
+  ArenaAllocator<char> d(a);
+  EXPECT_EQ(d.arena(), arena);
+
+  EXPECT_TRUE(LowLevelAlloc::DeleteArena(arena));
+}
+
+TEST(ArenaAllocator, FixedArrayOversizeFallback) {
+  LowLevelAlloc::Arena* arena = LowLevelAlloc::NewArena(0);
+  {
+    // Inline capacity of zero forces every element onto the arena.
+    absl::FixedArray<int, 0, ArenaAllocator<int>> a(1000,
+                                                    ArenaAllocator<int>(arena));
+    std::iota(a.begin(), a.end(), 0);
+    EXPECT_EQ(a[999], 999);
+    EXPECT_FALSE(LowLevelAlloc::DeleteArena(arena));
+  }
+  EXPECT_TRUE(LowLevelAlloc::DeleteArena(arena));
+}
+
+TEST(ArenaAllocator, FixedArrayInlineStorageSkipsArena) {
+  LowLevelAlloc::Arena* arena = LowLevelAlloc::NewArena(0);
+  {
+    absl::FixedArray<int, 8, ArenaAllocator<int>> a(8,
+                                                    ArenaAllocator<int>(arena));
+    std::iota(a.begin(), a.end(), 0);
+    EXPECT_EQ(a[7], 7);
+    // Nothing was drawn from the arena, so it is already deletable.
+    EXPECT_TRUE(LowLevelAlloc::DeleteArena(arena));
+  }
+}
+
+TEST(ArenaAllocator, Vector) {
+  LowLevelAlloc::Arena* arena = LowLevelAlloc::NewArena(0);
+  {
+    std::vector<int, ArenaAllocator<int>> v{ArenaAllocator<int>(arena)};
+    for (int i = 0; i < 3; ++i) v.push_back(i);
+    EXPECT_THAT(v, ElementsAre(0, 1, 2));
+  }
+  EXPECT_TRUE(LowLevelAlloc::DeleteArena(arena));
+}
+
+}  // namespace
+}  // namespace container_internal
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // !ABSL_LOW_LEVEL_ALLOC_MISSING
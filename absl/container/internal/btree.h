@@ -60,6 +60,7 @@
 #include "absl/base/config.h"
 #include "absl/base/internal/raw_logging.h"
 #include "absl/base/macros.h"
+#include "absl/container/internal/btreez_sampler.h"
 #include "absl/container/internal/common.h"
 #include "absl/container/internal/common_policy_traits.h"
 #include "absl/container/internal/compressed_tuple.h"
@@ -790,13 +791,41 @@ class btree_node {
                               btree_is_key_compare_to<Compare, key_type>());
   }
 
+  // Whether binary search against `k` can skip leading key bytes that the
+  // current search bounds are already known to share with `k` (see
+  // prefix_skip_binary_search_impl). This requires byte-lexicographic
+  // ordering (in either direction) and string_view-compatible keys, i.e. the
+  // default comparators for std::string/absl::string_view keys.
+  template <typename K, typename Compare>
+  using can_skip_shared_key_prefix = absl::conjunction<
+      absl::disjunction<std::is_same<Compare, StringBtreeDefaultLess>,
+                        std::is_same<Compare, StringBtreeDefaultGreater>>,
+      std::is_convertible<const K &, absl::string_view>,
+      std::is_convertible<const key_type &, absl::string_view>>;
+
   template <typename K, typename Compare>
   SearchResult<size_type, btree_is_key_compare_to<Compare, key_type>::value>
   binary_search(const K &k, const Compare &comp) const {
+    return binary_search_dispatch(k, comp,
+                                  can_skip_shared_key_prefix<K, Compare>());
+  }
+
+  template <typename K, typename Compare>
+  SearchResult<size_type, btree_is_key_compare_to<Compare, key_type>::value>
+  binary_search_dispatch(const K &k, const Compare &comp,
+                         std::false_type /* CanSkipSharedKeyPrefix */) const {
     return binary_search_impl(k, start(), finish(), comp,
                               btree_is_key_compare_to<Compare, key_type>());
   }
 
+  template <typename K, typename Compare>
+  SearchResult<size_type, true> binary_search_dispatch(
+      const K &k, const Compare &,
+      std::true_type /* CanSkipSharedKeyPrefix */) const {
+    return prefix_skip_binary_search_impl<K, Compare>(absl::string_view(k),
+                                                      start(), finish());
+  }
+
   // Returns the position of the first value whose key is not less than k using
   // linear search performed using plain compare.
   template <typename K, typename Compare>
@@ -887,6 +916,68 @@ class btree_node {
     }
   }
 
+  // Returns the position of the first value whose key is not less than k (in
+  // comparator order) using binary search that skips leading key bytes the
+  // current search bounds are known to share with k.
+  //
+  // For strings sorted lexicographically (ascending or descending), if A <= X
+  // <= B then lcp(X, k) >= min(lcp(A, k), lcp(B, k)), where lcp is the length
+  // of the longest common prefix. We track the lcp of k with the keys bounding
+  // the search range below and above, so each comparison inside the range can
+  // start past the bytes both bounds share with k. When the keys in a node
+  // share long prefixes (URLs, file paths, composite keys), this turns most
+  // full-key comparisons into short suffix comparisons - the search-time half
+  // of classic B-tree prefix truncation. The node layout is unchanged: keys
+  // must be stored whole because iterators hand out references to them.
+  template <typename K, typename Compare>
+  SearchResult<size_type, true> prefix_skip_binary_search_impl(
+      absl::string_view k, size_type s, size_type e) const {
+    constexpr bool kReverse =
+        std::is_same<Compare, StringBtreeDefaultGreater>::value;
+    // lcp(k, X) for the keys X bounding the search range below and above.
+    // Zero before the corresponding bound has been compared against k.
+    size_t lo_lcp = 0;
+    size_t hi_lcp = 0;
+    MatchKind exact_match = MatchKind::kNe;
+    while (s != e) {
+      const size_type mid = (s + e) >> 1;
+      const absl::string_view mid_key(key(mid));
+      // Every key in (lo bound, hi bound) shares at least this many leading
+      // bytes with k, so the comparison can resume there.
+      size_t lcp = lo_lcp < hi_lcp ? lo_lcp : hi_lcp;
+      const size_t limit =
+          mid_key.size() < k.size() ? mid_key.size() : k.size();
+      while (lcp < limit && mid_key[lcp] == k[lcp]) ++lcp;
+      int c;  // Sign of mid_key <=> k, lexicographically ascending.
+      if (lcp < limit) {
+        c = static_cast<unsigned char>(mid_key[lcp]) <
+                    static_cast<unsigned char>(k[lcp])
+                ? -1
+                : 1;
+      } else {
+        c = mid_key.size() < k.size() ? -1 : mid_key.size() > k.size() ? 1 : 0;
+      }
+      if (kReverse) c = -c;
+      if (c < 0) {
+        s = mid + 1;
+        lo_lcp = lcp;
+      } else if (c > 0) {
+        e = mid;
+        hi_lcp = lcp;
+      } else if (params_type::template can_have_multiple_equivalent_keys<K>()) {
+        // Need to return the first value whose key is not less than k, which
+        // requires continuing the binary search if there could be multiple
+        // equivalent keys.
+        e = mid;
+        hi_lcp = lcp;
+        exact_match = MatchKind::kEq;
+      } else {
+        return {mid, MatchKind::kEq};
+      }
+    }
+    return {s, exact_match};
+  }
+
   // Returns whether key i is ordered correctly with respect to the other keys
   // in the node. The motivation here is to detect comparators that violate
   // transitivity. Note: we only do comparisons of keys on this node rather than
@@ -1392,7 +1483,11 @@ class btree {
 
  public:
   btree(const key_compare &comp, const allocator_type &alloc)
-      : root_(EmptyNode()), rightmost_(comp, alloc, EmptyNode()), size_(0) {}
+      : root_(EmptyNode()),
+        rightmost_(comp, alloc, EmptyNode(),
+                   container_internal::SampleBtreez(sizeof(value_type),
+                                                    kNodeSlots)),
+        size_(0) {}
 
   btree(const btree &other) : btree(other, other.allocator()) {}
   btree(const btree &other, const allocator_type &alloc)
@@ -1404,6 +1499,9 @@ class btree {
         rightmost_(std::move(other.rightmost_)),
         size_(std::exchange(other.size_, 0u)) {
     other.mutable_rightmost() = EmptyNode();
+    // The sampling handle moved here along with `rightmost_`; `other` must
+    // not unregister it again.
+    other.infoz() = BtreezInfoHandle();
   }
   btree(btree &&other, const allocator_type &alloc)
       : btree(other.key_comp(), alloc) {
@@ -1420,6 +1518,7 @@ class btree {
     // is complete.
     static_assert(static_assert_validation(), "This call must be elided.");
     clear();
+    infoz().Unregister();
   }
 
   // Assign the contents of other to *this.
@@ -1528,6 +1627,16 @@ class btree {
   void insert_iterator_multi(InputIterator b,
                              InputIterator e);
 
+  // Bulk-loads the range [b, e) into an empty btree, building leaves
+  // left-to-right and internal nodes bottom-up instead of inserting
+  // element-by-element. Every node except those on the rightmost spine is
+  // filled completely, so no splits or searches are performed.
+  // Requirement: the btree is empty.
+  // Requirement: the range is sorted according to key_comp() (and contains no
+  // duplicate keys if the btree does not allow multiple equivalent keys).
+  template <typename InputIterator>
+  void bulk_load(InputIterator b, InputIterator e);
+
   // Erase the specified iterator from the btree. The iterator must be valid
   // (i.e. not equal to end()).  Return an iterator pointing to the node after
   // the one that was erased (or end() if none exists).
@@ -1555,6 +1664,14 @@ class btree {
   // Swaps the contents of `this` and `other`.
   void swap(btree &other);
 
+  // Rebuilds the tree by moving its values, in order, into a freshly built
+  // tree, then adopts that tree. Because the values arrive sorted, every
+  // insertion happens at the rightmost position, where node splits leave
+  // the left node completely full; the rebuilt tree therefore has all leaf
+  // nodes at maximum fill, allocated in iteration order. Invalidates all
+  // iterators.
+  void compact();
+
   const key_compare &key_comp() const noexcept {
     return rightmost_.template get<0>();
   }
@@ -1661,6 +1778,10 @@ class btree {
     return &rightmost_.template get<0>();
   }
 
+  // Sampling handle for btreez telemetry; empty unless this instance was
+  // selected for sampling at construction.
+  BtreezInfoHandle &infoz() { return rightmost_.template get<3>(); }
+
   // The leftmost node is stored as the parent of the root node.
   node_type *leftmost() { return root()->parent(); }
   const node_type *leftmost() const { return root()->parent(); }
@@ -1782,9 +1903,10 @@ class btree {
 
   // A pointer to the rightmost node. Note that the leftmost node is stored as
   // the root's parent. We use compressed tuple in order to save space because
-  // key_compare and allocator_type are usually empty.
+  // key_compare and allocator_type are usually empty, as is BtreezInfoHandle
+  // unless btreez sampling is compiled in.
   absl::container_internal::CompressedTuple<key_compare, allocator_type,
-                                            node_type *>
+                                            node_type *, BtreezInfoHandle>
       rightmost_;
 
   // Number of values.
@@ -2380,6 +2502,84 @@ void btree<P>::insert_iterator_multi(InputIterator b, InputIterator e) {
   }
 }
 
+template <typename P>
+template <typename InputIterator>
+void btree<P>::bulk_load(InputIterator b, InputIterator e) {
+  assert(empty());
+  if (b == e) return;
+
+  allocator_type *alloc = mutable_allocator();
+
+  // The nodes currently under construction, one per height; spine[0] is the
+  // rightmost leaf. Every node that the loop finishes with is completely
+  // full, so fanout is at least kNodeSlots + 1 >= 4 per level and 64 levels
+  // cover any representable size.
+  node_type *spine[64];
+  node_type *leaf = new_leaf_root_node(kNodeSlots);
+  mutable_root() = mutable_rightmost() = leaf;
+  spine[0] = leaf;
+  int levels = 1;
+
+  size_type n = 0;
+  for (; b != e; ++b, ++n) {
+    node_type *cur = spine[0];
+    if (cur->count() < kNodeSlots) {
+      cur->emplace_value(cur->finish(), alloc, *b);
+      continue;
+    }
+    // The leaf is full. This value becomes the separator between the full
+    // leaf and a fresh one in the lowest non-full ancestor; subsequent values
+    // go into the fresh leaf. `child` is the new node to attach after the
+    // separator; its position is assigned by init_child below.
+    node_type *child = new_leaf_node(/*position=*/0, cur->parent());
+    spine[0] = child;
+    for (int level = 1;; ++level) {
+      if (level == levels) {
+        // Grow the tree. As in rebalance_or_split, the old root's parent
+        // pointer holds the leftmost node, which never changes here.
+        node_type *old_root = root();
+        node_type *new_root = new_internal_node(/*position=*/0,
+                                                old_root->parent());
+        new_root->set_generation(old_root->generation());
+        new_root->init_child(new_root->start(), old_root);
+        mutable_root() = new_root;
+        assert(levels < 64);
+        spine[levels++] = new_root;
+      }
+      node_type *node = spine[level];
+      if (node->count() < kNodeSlots) {
+        const field_type i = node->finish();
+        node->emplace_value(i, alloc, *b);
+        node->init_child(i + 1, child);
+        break;
+      }
+      // This level is full too: start a new node here whose leftmost child is
+      // the new node from the level below, and push the separator up.
+      node_type *next = new_internal_node(/*position=*/0, node->parent());
+      next->init_child(next->start(), child);
+      spine[level] = next;
+      child = next;
+    }
+  }
+  size_ = n;
+  infoz().RecordSizeChanged(size_);
+  mutable_rightmost() = spine[0];
+
+  // All nodes off the rightmost spine are full, but the spine nodes hold
+  // whatever was left over — possibly nothing at all if the input ended on a
+  // separator. Working top-down (so that each node's parent already has at
+  // least one value), borrow values from the always-full left sibling until
+  // every non-root node holds at least kMinNodeValues.
+  for (int level = levels - 2; level >= 0; --level) {
+    node_type *node = spine[level];
+    if (node->count() >= kMinNodeValues) continue;
+    node_type *left = node->parent()->child(node->position() - 1);
+    assert(left->count() == kNodeSlots);
+    left->rebalance_left_to_right(
+        static_cast<field_type>(kMinNodeValues - node->count()), node, alloc);
+  }
+}
+
 template <typename P>
 auto btree<P>::operator=(const btree &other) -> btree & {
   if (this != &other) {
@@ -2459,6 +2659,7 @@ auto btree<P>::erase(iterator iter) -> iterator {
   // Update node finish and container size.
   iter.node_->set_finish(iter.node_->finish() - 1);
   --size_;
+  infoz().RecordErase(size_);
 
   // We want to return the next value after the one we just erased. If we
   // erased from an internal node (internal_delete == true), then the next
@@ -2543,6 +2744,7 @@ auto btree<P>::erase_range(iterator begin, iterator end)
         static_cast<field_type>(end.position_ - begin.position_),
         mutable_allocator());
     size_ -= count;
+    infoz().RecordErase(size_);
     return {count, rebalance_after_delete(begin)};
   }
 
@@ -2557,6 +2759,7 @@ auto btree<P>::erase_range(iterator begin, iterator end)
       begin.node_->remove_values(static_cast<field_type>(begin.position_),
                                  to_erase, mutable_allocator());
       size_ -= to_erase;
+      infoz().RecordErase(size_);
       begin = rebalance_after_delete(begin);
     } else {
       begin = erase(begin);
@@ -2573,6 +2776,7 @@ void btree<P>::clear() {
   }
   mutable_root() = mutable_rightmost() = EmptyNode();
   size_ = 0;
+  infoz().RecordSizeChanged(0);
 }
 
 template <typename P>
@@ -2592,6 +2796,14 @@ void btree<P>::swap(btree &other) {
   swap(size_, other.size_);
 }
 
+template <typename P>
+void btree<P>::compact() {
+  if (empty()) return;
+  btree other(key_comp(), allocator());
+  other.copy_or_move_values_in_order(*this);
+  swap(other);  // `other` frees the old nodes when it goes out of scope.
+}
+
 template <typename P>
 void btree<P>::verify() const {
   assert(root() != nullptr);
@@ -2641,6 +2853,7 @@ void btree<P>::rebalance_or_split(iterator *iter) {
           }
 
           assert(node->count() < node->max_count());
+          if (infoz().IsSampled()) infoz().RecordRebalance(height());
           return;
         }
       }
@@ -2669,6 +2882,7 @@ void btree<P>::rebalance_or_split(iterator *iter) {
           }
 
           assert(node->count() < node->max_count());
+          if (infoz().IsSampled()) infoz().RecordRebalance(height());
           return;
         }
       }
@@ -2710,6 +2924,8 @@ void btree<P>::rebalance_or_split(iterator *iter) {
     insert_position = insert_position - node->count() - 1;
     node = split_node;
   }
+  // `height()` is an O(height) walk; only pay for it on sampled instances.
+  if (infoz().IsSampled()) infoz().RecordSplit(height());
 }
 
 template <typename P>
@@ -2729,6 +2945,7 @@ bool btree<P>::try_merge_or_rebalance(iterator *iter) {
       iter->position_ += 1 + left->count();
       merge_nodes(left, iter->node_);
       iter->node_ = left;
+      if (infoz().IsSampled()) infoz().RecordMerge(height());
       return true;
     }
   }
@@ -2738,6 +2955,7 @@ bool btree<P>::try_merge_or_rebalance(iterator *iter) {
     assert(right->max_count() == kNodeSlots);
     if (1U + iter->node_->count() + right->count() <= kNodeSlots) {
       merge_nodes(iter->node_, right);
+      if (infoz().IsSampled()) infoz().RecordMerge(height());
       return true;
     }
     // Try rebalancing with our right sibling. We don't perform rebalancing if
@@ -2750,6 +2968,7 @@ bool btree<P>::try_merge_or_rebalance(iterator *iter) {
       to_move =
           (std::min)(to_move, static_cast<field_type>(right->count() - 1));
       iter->node_->rebalance_right_to_left(to_move, right, mutable_allocator());
+      if (infoz().IsSampled()) infoz().RecordRebalance(height());
       return false;
     }
   }
@@ -2766,6 +2985,7 @@ bool btree<P>::try_merge_or_rebalance(iterator *iter) {
       to_move = (std::min)(to_move, static_cast<field_type>(left->count() - 1));
       left->rebalance_left_to_right(to_move, iter->node_, mutable_allocator());
       iter->position_ += to_move;
+      if (infoz().IsSampled()) infoz().RecordRebalance(height());
       return false;
     }
   }
@@ -2788,6 +3008,7 @@ void btree<P>::try_shrink() {
     mutable_root() = child;
   }
   node_type::clear_and_delete(orig_root, mutable_allocator());
+  if (infoz().IsSampled()) infoz().RecordHeight(height());
 }
 
 template <typename P>
@@ -2881,6 +3102,7 @@ inline auto btree<P>::internal_emplace(iterator iter, Args &&...args)
       "https://en.cppreference.com/w/cpp/named_req/Compare), or (2) a "
       "key may have been mutated after it was inserted into the tree.");
   ++size_;
+  infoz().RecordInsert(size_);
   iter.update_generation();
   return iter;
 }
@@ -3029,6 +3251,7 @@ struct btree_access {
       }
       const int num_deleted = node->finish() - to_pos;
       tree.size_ -= num_deleted;
+      tree.infoz().RecordSizeChanged(tree.size_);
       node->set_finish(to_pos);
       it.position_ = to_pos;
       it = tree.rebalance_after_delete(it);
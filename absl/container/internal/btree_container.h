@@ -19,6 +19,7 @@
 #include <initializer_list>
 #include <iterator>
 #include <utility>
+#include <vector>
 
 #include "absl/base/attributes.h"
 #include "absl/base/internal/throw_delegate.h"
@@ -174,6 +175,17 @@ class btree_container {
     return tree_.equal_range(key);
   }
 
+  // Bulk-load routine. Builds the tree bottom-up from a presorted range,
+  // which is much faster than inserting element-by-element.
+  //
+  // Requirement: the container is empty.
+  // Requirement: the range is sorted according to value_comp() (and contains
+  // no equivalent keys for containers that require unique keys).
+  template <typename InputIterator>
+  void bulk_load(InputIterator b, InputIterator e) {
+    tree_.bulk_load(b, e);
+  }
+
   // Deletion routines. Note that there is also a deletion routine that is
   // specific to btree_set_container/btree_multiset_container.
 
@@ -218,8 +230,24 @@ class btree_container {
     return extract(iterator(position));
   }
 
+  // Moves every element, in sorted order, into a presized vector and leaves
+  // the container empty. For maps the vector holds mutable pairs
+  // (`std::pair<key_type, mapped_type>`), ready for binary-search serving.
+  // This is a single leaf-order walk followed by `clear()`, which frees the
+  // nodes without any of the rebalancing that per-element erasure would do.
+  std::vector<typename Tree::params_type::init_type> extract_sorted() {
+    std::vector<typename Tree::params_type::init_type> out;
+    out.reserve(size());
+    for (iterator it = tree_.begin(), e = tree_.end(); it != e; ++it) {
+      out.push_back(std::move(Tree::params_type::element(it.slot())));
+    }
+    clear();
+    return out;
+  }
+
   // Utility routines.
   ABSL_ATTRIBUTE_REINITIALIZES void clear() { tree_.clear(); }
+  void compact() { tree_.compact(); }
   void swap(btree_container &other) { tree_.swap(other.tree_); }
   void verify() const { tree_.verify(); }
 
@@ -417,8 +445,20 @@ class btree_set_container : public btree_container<Tree> {
                            typename T::params_type::is_map_container>>::value,
           int> = 0>
   void merge(btree_container<T> &src) {  // NOLINT
+    // Both trees are iterated in sorted order, so the destination insert
+    // position advances monotonically (when the comparators agree) and the
+    // previous insertion point is a good hint: runs of source elements that
+    // land adjacently in the destination are spliced in amortized constant
+    // time instead of re-descending from the root per element. A stale hint
+    // only costs the two comparisons insert_hint_unique makes before falling
+    // back to a normal descent.
+    iterator hint = this->end();
     for (auto src_it = src.begin(); src_it != src.end();) {
-      if (insert(std::move(params_type::element(src_it.slot()))).second) {
+      std::pair<iterator, bool> res = this->tree_.insert_hint_unique(
+          hint, params_type::key(src_it.slot()),
+          std::move(params_type::element(src_it.slot())));
+      hint = std::next(res.first);
+      if (res.second) {
         src_it = src.erase(src_it);
       } else {
         ++src_it;
@@ -721,8 +761,13 @@ class btree_multiset_container : public btree_container<Tree> {
                            typename T::params_type::is_map_container>>::value,
           int> = 0>
   void merge(btree_container<T> &src) {  // NOLINT
+    // As in btree_set_container::merge, carry the previous insertion point as
+    // a hint so runs of source elements splice in without per-element
+    // root-to-leaf descents.
+    iterator hint = this->end();
     for (auto src_it = src.begin(), end = src.end(); src_it != end; ++src_it) {
-      insert(std::move(params_type::element(src_it.slot())));
+      hint = std::next(this->tree_.insert_hint_multi(
+          hint, std::move(params_type::element(src_it.slot()))));
     }
     src.clear();
   }
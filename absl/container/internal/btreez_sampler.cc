@@ -0,0 +1,209 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/container/internal/btreez_sampler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include "absl/base/attributes.h"
+#include "absl/base/config.h"
+#include "absl/base/internal/per_thread_tls.h"
+#include "absl/base/no_destructor.h"
+#include "absl/base/optimization.h"
+#include "absl/debugging/stacktrace.h"
+#include "absl/profiling/internal/exponential_biased.h"
+#include "absl/profiling/internal/sample_recorder.h"
+#include "absl/time/clock.h"
+#include "absl/utility/utility.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+namespace container_internal {
+
+#ifdef ABSL_INTERNAL_NEED_REDUNDANT_CONSTEXPR_DECL
+constexpr int BtreezInfo::kMaxStackDepth;
+#endif
+
+namespace {
+ABSL_CONST_INIT std::atomic<bool> g_btreez_enabled{false};
+ABSL_CONST_INIT std::atomic<int32_t> g_btreez_sample_parameter{1 << 10};
+
+#if defined(ABSL_INTERNAL_BTREEZ_SAMPLE)
+ABSL_PER_THREAD_TLS_KEYWORD absl::profiling_internal::ExponentialBiased
+    g_btreez_exponential_biased_generator;
+#endif
+
+}  // namespace
+
+#if defined(ABSL_INTERNAL_BTREEZ_SAMPLE)
+ABSL_PER_THREAD_TLS_KEYWORD BtreezSamplingState global_next_btreez_sample = {
+    0, 0};
+#endif  // defined(ABSL_INTERNAL_BTREEZ_SAMPLE)
+
+BtreezSampler& GlobalBtreezSampler() {
+  static absl::NoDestructor<BtreezSampler> sampler;
+  return *sampler;
+}
+
+BtreezInfo::BtreezInfo() = default;
+BtreezInfo::~BtreezInfo() = default;
+
+void BtreezInfo::PrepareForSampling(int64_t stride, size_t value_size_value,
+                                    size_t node_slots_value) {
+  size.store(0, std::memory_order_relaxed);
+  max_size.store(0, std::memory_order_relaxed);
+  height.store(0, std::memory_order_relaxed);
+  num_inserts.store(0, std::memory_order_relaxed);
+  num_erases.store(0, std::memory_order_relaxed);
+  num_splits.store(0, std::memory_order_relaxed);
+  num_merges.store(0, std::memory_order_relaxed);
+  num_rebalances.store(0, std::memory_order_relaxed);
+
+  create_time = absl::Now();
+  weight = stride;
+  // The inliner makes hardcoded skip_count difficult (especially when
+  // combined with LTO). We use the ability to exclude stacks by regex when
+  // encoding instead.
+  depth = absl::GetStackTrace(stack, BtreezInfo::kMaxStackDepth,
+                              /* skip_count= */ 0);
+  value_size = value_size_value;
+  node_slots = node_slots_value;
+}
+
+BtreezInfo* SampleBtreezSlow(BtreezSamplingState& next_sample,
+                             size_t value_size, size_t node_slots) {
+#if !defined(ABSL_INTERNAL_BTREEZ_SAMPLE)
+  next_sample = {
+      std::numeric_limits<int64_t>::max(),
+      std::numeric_limits<int64_t>::max(),
+  };
+  static_cast<void>(value_size);
+  static_cast<void>(node_slots);
+  return nullptr;
+#else
+  bool first = next_sample.next_sample < 0;
+
+  const int64_t next_stride = g_btreez_exponential_biased_generator.GetStride(
+      g_btreez_sample_parameter.load(std::memory_order_relaxed));
+
+  next_sample.next_sample = next_stride;
+  const int64_t old_stride = exchange(next_sample.sample_stride, next_stride);
+  // Small values of interval are equivalent to just sampling next time.
+  ABSL_ASSERT(next_stride >= 1);
+
+  // g_btreez_enabled can be dynamically flipped, we need to set a threshold
+  // low enough that we will start sampling in a reasonable time, so we just
+  // use the default sampling rate.
+  if (!g_btreez_enabled.load(std::memory_order_relaxed)) return nullptr;
+
+  // We will only be negative on our first count, so we should just retry in
+  // that case.
+  if (first) {
+    if (ABSL_PREDICT_TRUE(--next_sample.next_sample > 0)) return nullptr;
+    return SampleBtreezSlow(next_sample, value_size, node_slots);
+  }
+
+  return GlobalBtreezSampler().Register(old_stride, value_size, node_slots);
+#endif
+}
+
+void UnsampleBtreezSlow(BtreezInfo* info) {
+  GlobalBtreezSampler().Unregister(info);
+}
+
+// There is only one concurrent writer per sampled btree (the tree itself is
+// not thread-safe for mutation), so `load` then `store` is sufficient
+// instead of using `fetch_add` in the functions below.
+void RecordInsertSlow(BtreezInfo* info, size_t size) {
+  info->size.store(size, std::memory_order_relaxed);
+  info->max_size.store(
+      (std::max)(info->max_size.load(std::memory_order_relaxed), size),
+      std::memory_order_relaxed);
+  info->num_inserts.store(
+      1 + info->num_inserts.load(std::memory_order_relaxed),
+      std::memory_order_relaxed);
+}
+
+void RecordEraseSlow(BtreezInfo* info, size_t size) {
+  info->size.store(size, std::memory_order_relaxed);
+  info->num_erases.store(1 + info->num_erases.load(std::memory_order_relaxed),
+                         std::memory_order_relaxed);
+}
+
+void RecordSizeChangedSlow(BtreezInfo* info, size_t size) {
+  info->size.store(size, std::memory_order_relaxed);
+  info->max_size.store(
+      (std::max)(info->max_size.load(std::memory_order_relaxed), size),
+      std::memory_order_relaxed);
+  if (size == 0) info->height.store(0, std::memory_order_relaxed);
+}
+
+void RecordSplitSlow(BtreezInfo* info, size_t height) {
+  info->height.store(height, std::memory_order_relaxed);
+  info->num_splits.store(1 + info->num_splits.load(std::memory_order_relaxed),
+                         std::memory_order_relaxed);
+}
+
+void RecordMergeSlow(BtreezInfo* info, size_t height) {
+  info->height.store(height, std::memory_order_relaxed);
+  info->num_merges.store(1 + info->num_merges.load(std::memory_order_relaxed),
+                         std::memory_order_relaxed);
+}
+
+void RecordRebalanceSlow(BtreezInfo* info, size_t height) {
+  info->height.store(height, std::memory_order_relaxed);
+  info->num_rebalances.store(
+      1 + info->num_rebalances.load(std::memory_order_relaxed),
+      std::memory_order_relaxed);
+}
+
+void RecordHeightSlow(BtreezInfo* info, size_t height) {
+  info->height.store(height, std::memory_order_relaxed);
+}
+
+bool IsBtreezEnabled() {
+  return g_btreez_enabled.load(std::memory_order_acquire);
+}
+
+void SetBtreezEnabled(bool enabled) {
+  g_btreez_enabled.store(enabled, std::memory_order_release);
+}
+
+int32_t GetBtreezSampleParameter() {
+  return g_btreez_sample_parameter.load(std::memory_order_acquire);
+}
+
+void SetBtreezSampleParameter(int32_t rate) {
+  if (rate > 0) {
+    g_btreez_sample_parameter.store(rate, std::memory_order_release);
+  }
+}
+
+size_t GetBtreezMaxSamples() {
+  return GlobalBtreezSampler().GetMaxSamples();
+}
+
+void SetBtreezMaxSamples(size_t max) {
+  if (max > 0) {
+    GlobalBtreezSampler().SetMaxSamples(max);
+  }
+}
+
+}  // namespace container_internal
+ABSL_NAMESPACE_END
+}  // namespace absl
@@ -0,0 +1,238 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// -----------------------------------------------------------------------------
+// File: btreez_sampler.h
+// -----------------------------------------------------------------------------
+//
+// This header defines the API for a low-level library that sampling B-trees
+// (e.g. absl::btree_map) may use for gathering telemetry, the btree
+// counterpart of `hashtablez_sampler.h`. A small fraction of btree instances
+// is sampled at construction; for those instances the tree records its size,
+// height, and structural-change counts (splits, merges, rebalances), which a
+// telemetry collector can read with `BtreezSampler::Iterate`. This gives
+// production visibility into node occupancy and tree shape, the inputs
+// needed to tune `kTargetNodeSize` with real data.
+//
+// As with hashtablez, the per-instance hooks compile away entirely unless
+// `ABSL_INTERNAL_BTREEZ_SAMPLE` is defined; the sampler machinery itself is
+// always available.
+
+#ifndef ABSL_CONTAINER_INTERNAL_BTREEZ_SAMPLER_H_
+#define ABSL_CONTAINER_INTERNAL_BTREEZ_SAMPLER_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "absl/base/attributes.h"
+#include "absl/base/config.h"
+#include "absl/base/internal/per_thread_tls.h"
+#include "absl/base/optimization.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/profiling/internal/sample_recorder.h"
+#include "absl/time/time.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+namespace container_internal {
+
+// Stores information about a sampled btree. All mutations to this *must* be
+// made through the `Record*` functions below. All reads from this *must*
+// only occur in the callback to `BtreezSampler::Iterate`.
+struct BtreezInfo : public profiling_internal::Sample<BtreezInfo> {
+  // Constructs the object but does not fill in any fields.
+  BtreezInfo();
+  ~BtreezInfo();
+  BtreezInfo(const BtreezInfo&) = delete;
+  BtreezInfo& operator=(const BtreezInfo&) = delete;
+
+  // Puts the object into a clean state, fills in the logically `const`
+  // members, blocking for any readers that are currently sampling the object.
+  void PrepareForSampling(int64_t stride, size_t value_size_value,
+                          size_t node_slots_value)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(init_mu);
+
+  // These fields are mutated by the various Record* APIs and need to be
+  // thread-safe.
+  std::atomic<size_t> size;
+  std::atomic<size_t> max_size;
+  std::atomic<size_t> height;
+  std::atomic<size_t> num_inserts;
+  std::atomic<size_t> num_erases;
+  std::atomic<size_t> num_splits;
+  std::atomic<size_t> num_merges;
+  std::atomic<size_t> num_rebalances;
+
+  // All of the fields below are set by `PrepareForSampling`, they must not
+  // be mutated in `Record*` functions. They are logically `const` in that
+  // sense. These are guarded by init_mu, but that is not externalized to
+  // clients, which can read them only during `BtreezSampler::Iterate` which
+  // will hold the lock.
+  static constexpr int kMaxStackDepth = 64;
+  absl::Time create_time;
+  int32_t depth;
+  void* stack[kMaxStackDepth];
+  size_t value_size;  // sizeof(value_type)
+  size_t node_slots;  // Value slots per node (kNodeSlots).
+};
+
+void RecordInsertSlow(BtreezInfo* info, size_t size);
+void RecordEraseSlow(BtreezInfo* info, size_t size);
+void RecordSizeChangedSlow(BtreezInfo* info, size_t size);
+void RecordSplitSlow(BtreezInfo* info, size_t height);
+void RecordMergeSlow(BtreezInfo* info, size_t height);
+void RecordRebalanceSlow(BtreezInfo* info, size_t height);
+void RecordHeightSlow(BtreezInfo* info, size_t height);
+
+struct BtreezSamplingState {
+  int64_t next_sample;
+  // When we make a sampling decision, we record that distance so we can
+  // weight each sample.
+  int64_t sample_stride;
+};
+
+BtreezInfo* SampleBtreezSlow(BtreezSamplingState& next_sample,
+                             size_t value_size, size_t node_slots);
+void UnsampleBtreezSlow(BtreezInfo* info);
+
+#if defined(ABSL_INTERNAL_BTREEZ_SAMPLE)
+#error ABSL_INTERNAL_BTREEZ_SAMPLE cannot be directly set
+#endif  // defined(ABSL_INTERNAL_BTREEZ_SAMPLE)
+
+#if defined(ABSL_INTERNAL_BTREEZ_SAMPLE)
+class BtreezInfoHandle {
+ public:
+  explicit BtreezInfoHandle() : info_(nullptr) {}
+  explicit BtreezInfoHandle(BtreezInfo* info) : info_(info) {}
+
+  // We do not have a destructor. Caller is responsible for calling Unregister
+  // before destroying the handle.
+  void Unregister() {
+    if (ABSL_PREDICT_TRUE(info_ == nullptr)) return;
+    UnsampleBtreezSlow(info_);
+    info_ = nullptr;
+  }
+
+  inline bool IsSampled() const { return ABSL_PREDICT_FALSE(info_ != nullptr); }
+
+  inline void RecordInsert(size_t size) {
+    if (ABSL_PREDICT_TRUE(info_ == nullptr)) return;
+    RecordInsertSlow(info_, size);
+  }
+
+  inline void RecordErase(size_t size) {
+    if (ABSL_PREDICT_TRUE(info_ == nullptr)) return;
+    RecordEraseSlow(info_, size);
+  }
+
+  inline void RecordSizeChanged(size_t size) {
+    if (ABSL_PREDICT_TRUE(info_ == nullptr)) return;
+    RecordSizeChangedSlow(info_, size);
+  }
+
+  inline void RecordSplit(size_t height) {
+    if (ABSL_PREDICT_TRUE(info_ == nullptr)) return;
+    RecordSplitSlow(info_, height);
+  }
+
+  inline void RecordMerge(size_t height) {
+    if (ABSL_PREDICT_TRUE(info_ == nullptr)) return;
+    RecordMergeSlow(info_, height);
+  }
+
+  inline void RecordRebalance(size_t height) {
+    if (ABSL_PREDICT_TRUE(info_ == nullptr)) return;
+    RecordRebalanceSlow(info_, height);
+  }
+
+  inline void RecordHeight(size_t height) {
+    if (ABSL_PREDICT_TRUE(info_ == nullptr)) return;
+    RecordHeightSlow(info_, height);
+  }
+
+  friend inline void swap(BtreezInfoHandle& lhs, BtreezInfoHandle& rhs) {
+    std::swap(lhs.info_, rhs.info_);
+  }
+
+ private:
+  friend class BtreezInfoHandlePeer;
+  BtreezInfo* info_;
+};
+#else
+// Ensure that when btreez is turned off at compile time, BtreezInfo can be
+// removed by the linker, in order to reduce the binary size. The empty handle
+// also occupies no space in the btree through the empty base optimization.
+class BtreezInfoHandle {
+ public:
+  explicit BtreezInfoHandle() = default;
+  explicit BtreezInfoHandle(std::nullptr_t) {}
+
+  inline void Unregister() {}
+  inline bool IsSampled() const { return false; }
+  inline void RecordInsert(size_t /*size*/) {}
+  inline void RecordErase(size_t /*size*/) {}
+  inline void RecordSizeChanged(size_t /*size*/) {}
+  inline void RecordSplit(size_t /*height*/) {}
+  inline void RecordMerge(size_t /*height*/) {}
+  inline void RecordRebalance(size_t /*height*/) {}
+  inline void RecordHeight(size_t /*height*/) {}
+
+  friend inline void swap(BtreezInfoHandle& /*lhs*/,
+                          BtreezInfoHandle& /*rhs*/) {}
+};
+#endif  // defined(ABSL_INTERNAL_BTREEZ_SAMPLE)
+
+#if defined(ABSL_INTERNAL_BTREEZ_SAMPLE)
+extern ABSL_PER_THREAD_TLS_KEYWORD BtreezSamplingState global_next_btreez_sample;
+#endif  // defined(ABSL_INTERNAL_BTREEZ_SAMPLE)
+
+// Returns a sampling handle.
+inline BtreezInfoHandle SampleBtreez(
+    ABSL_ATTRIBUTE_UNUSED size_t value_size,
+    ABSL_ATTRIBUTE_UNUSED size_t node_slots) {
+#if defined(ABSL_INTERNAL_BTREEZ_SAMPLE)
+  if (ABSL_PREDICT_TRUE(--global_next_btreez_sample.next_sample > 0)) {
+    return BtreezInfoHandle(nullptr);
+  }
+  return BtreezInfoHandle(
+      SampleBtreezSlow(global_next_btreez_sample, value_size, node_slots));
+#else
+  return BtreezInfoHandle(nullptr);
+#endif  // !ABSL_INTERNAL_BTREEZ_SAMPLE
+}
+
+using BtreezSampler = ::absl::profiling_internal::SampleRecorder<BtreezInfo>;
+
+// Returns a global Sampler.
+BtreezSampler& GlobalBtreezSampler();
+
+// Enables or disables sampling for btrees.
+bool IsBtreezEnabled();
+void SetBtreezEnabled(bool enabled);
+
+// Sets the rate at which btrees will be sampled (one in `rate` instances).
+int32_t GetBtreezSampleParameter();
+void SetBtreezSampleParameter(int32_t rate);
+
+// Sets a soft max for the number of samples that will be kept.
+size_t GetBtreezMaxSamples();
+void SetBtreezMaxSamples(size_t max);
+
+}  // namespace container_internal
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_CONTAINER_INTERNAL_BTREEZ_SAMPLER_H_
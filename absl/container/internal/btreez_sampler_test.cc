@@ -0,0 +1,151 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/container/internal/btreez_sampler.h"
+
+#include <atomic>
+#include <cstddef>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "absl/container/btree_map.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+namespace container_internal {
+namespace {
+
+BtreezInfo* Register(BtreezSampler* s, size_t value_size, size_t node_slots) {
+  const int64_t test_stride = 123;
+  BtreezInfo* info = s->Register(test_stride, value_size, node_slots);
+  assert(info != nullptr);
+  return info;
+}
+
+TEST(BtreezInfoTest, PrepareForSampling) {
+  BtreezInfo info;
+  absl::MutexLock l(&info.init_mu);
+  const int64_t test_stride = 31;
+  info.PrepareForSampling(test_stride, /*value_size_value=*/16,
+                          /*node_slots_value=*/62);
+
+  EXPECT_EQ(info.size.load(), 0);
+  EXPECT_EQ(info.max_size.load(), 0);
+  EXPECT_EQ(info.height.load(), 0);
+  EXPECT_EQ(info.num_inserts.load(), 0);
+  EXPECT_EQ(info.num_erases.load(), 0);
+  EXPECT_EQ(info.num_splits.load(), 0);
+  EXPECT_EQ(info.num_merges.load(), 0);
+  EXPECT_EQ(info.num_rebalances.load(), 0);
+  EXPECT_EQ(info.value_size, 16);
+  EXPECT_EQ(info.node_slots, 62);
+  EXPECT_EQ(info.weight, test_stride);
+  EXPECT_GE(info.create_time, absl::Now() - absl::Minutes(1));
+}
+
+TEST(BtreezInfoTest, RecordInsertAndErase) {
+  BtreezInfo info;
+  absl::MutexLock l(&info.init_mu);
+  info.PrepareForSampling(/*stride=*/1, 8, 62);
+
+  RecordInsertSlow(&info, 1);
+  RecordInsertSlow(&info, 2);
+  RecordInsertSlow(&info, 3);
+  EXPECT_EQ(info.size.load(), 3);
+  EXPECT_EQ(info.max_size.load(), 3);
+  EXPECT_EQ(info.num_inserts.load(), 3);
+
+  RecordEraseSlow(&info, 2);
+  EXPECT_EQ(info.size.load(), 2);
+  EXPECT_EQ(info.max_size.load(), 3);
+  EXPECT_EQ(info.num_erases.load(), 1);
+
+  RecordSizeChangedSlow(&info, 0);
+  EXPECT_EQ(info.size.load(), 0);
+  EXPECT_EQ(info.height.load(), 0);
+  EXPECT_EQ(info.max_size.load(), 3);
+}
+
+TEST(BtreezInfoTest, RecordStructuralChanges) {
+  BtreezInfo info;
+  absl::MutexLock l(&info.init_mu);
+  info.PrepareForSampling(/*stride=*/1, 8, 62);
+
+  RecordSplitSlow(&info, 2);
+  RecordSplitSlow(&info, 3);
+  RecordMergeSlow(&info, 3);
+  RecordRebalanceSlow(&info, 3);
+  RecordHeightSlow(&info, 2);
+  EXPECT_EQ(info.num_splits.load(), 2);
+  EXPECT_EQ(info.num_merges.load(), 1);
+  EXPECT_EQ(info.num_rebalances.load(), 1);
+  EXPECT_EQ(info.height.load(), 2);
+}
+
+TEST(BtreezSamplerTest, Registration) {
+  BtreezSampler sampler;
+  BtreezInfo* info = Register(&sampler, 8, 62);
+  EXPECT_EQ(info->value_size, 8);
+  EXPECT_EQ(info->node_slots, 62);
+
+  size_t count = 0;
+  sampler.Iterate([&](const BtreezInfo&) { ++count; });
+  EXPECT_EQ(count, 1);
+
+  sampler.Unregister(info);
+  count = 0;
+  sampler.Iterate([&](const BtreezInfo&) { ++count; });
+  EXPECT_EQ(count, 0);
+}
+
+TEST(BtreezSamplerTest, Configuration) {
+  SetBtreezEnabled(true);
+  EXPECT_TRUE(IsBtreezEnabled());
+  SetBtreezEnabled(false);
+  EXPECT_FALSE(IsBtreezEnabled());
+
+  const int32_t old_rate = GetBtreezSampleParameter();
+  SetBtreezSampleParameter(256);
+  EXPECT_EQ(GetBtreezSampleParameter(), 256);
+  SetBtreezSampleParameter(old_rate);
+
+  const size_t old_max = GetBtreezMaxSamples();
+  SetBtreezMaxSamples(old_max + 1);
+  EXPECT_EQ(GetBtreezMaxSamples(), old_max + 1);
+  SetBtreezMaxSamples(old_max);
+}
+
+// Without ABSL_INTERNAL_BTREEZ_SAMPLE, btrees never sample; the hooks must
+// still compile and the global sampler must stay empty.
+TEST(BtreezSamplerTest, UnsampledBtreeLeavesNoTrace) {
+  SetBtreezEnabled(true);
+  SetBtreezSampleParameter(1);
+  {
+    absl::btree_map<int, int> m;
+    for (int i = 0; i < 1000; ++i) m[i] = i;
+    for (int i = 0; i < 500; ++i) m.erase(i);
+    m.clear();
+  }
+#if !defined(ABSL_INTERNAL_BTREEZ_SAMPLE)
+  size_t count = 0;
+  GlobalBtreezSampler().Iterate([&](const BtreezInfo&) { ++count; });
+  EXPECT_EQ(count, 0);
+#endif
+  SetBtreezEnabled(false);
+}
+
+}  // namespace
+}  // namespace container_internal
+ABSL_NAMESPACE_END
+}  // namespace absl
@@ -52,7 +52,9 @@
 #include <type_traits>
 
 #include "absl/base/config.h"
+#include "absl/container/hash_cached_string.h"
 #include "absl/container/internal/common.h"
+#include "absl/container/prehashed_key.h"
 #include "absl/hash/hash.h"
 #include "absl/meta/type_traits.h"
 #include "absl/strings/cord.h"
@@ -82,6 +84,15 @@ struct StringHash {
   size_t operator()(const absl::Cord& v) const {
     return absl::Hash<absl::Cord>{}(v);
   }
+  // `absl::PrehashedKey` carries the `absl::Hash` value of its key, which is
+  // exactly what the overloads above would compute, so reuse it.
+  template <typename K>
+  size_t operator()(const PrehashedKey<K>& v) const {
+    return v.hash();
+  }
+  // `absl::HashCachedString` caches the `absl::Hash` value of its string, so
+  // stored keys are never rehashed.
+  size_t operator()(const HashCachedString& v) const { return v.hash(); }
 };
 
 struct StringEq {
@@ -98,6 +109,19 @@ struct StringEq {
   bool operator()(absl::string_view lhs, const absl::Cord& rhs) const {
     return lhs == rhs;
   }
+  template <typename K, typename V>
+  bool operator()(const PrehashedKey<K>& lhs, const V& rhs) const {
+    return (*this)(lhs.key(), rhs);
+  }
+  template <typename K, typename V>
+  bool operator()(const V& lhs, const PrehashedKey<K>& rhs) const {
+    return (*this)(lhs, rhs.key());
+  }
+  // Compares the cached hashes before the characters.
+  bool operator()(const HashCachedString& lhs,
+                  const HashCachedString& rhs) const {
+    return lhs == rhs;
+  }
 };
 
 // Supports heterogeneous lookup for string-like elements.
@@ -112,6 +136,8 @@ template <>
 struct HashEq<absl::string_view> : StringHashEq {};
 template <>
 struct HashEq<absl::Cord> : StringHashEq {};
+template <>
+struct HashEq<absl::HashCachedString> : StringHashEq {};
 
 #ifdef ABSL_HAVE_STD_STRING_VIEW
 
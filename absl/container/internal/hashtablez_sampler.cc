@@ -74,6 +74,45 @@ HashtablezSampler& GlobalHashtablezSampler() {
   return *sampler;
 }
 
+size_t SnapshotHashtablezSamples(HashtablezSnapshot* snapshots,
+                                 size_t max_snapshots) {
+  size_t n = 0;
+  GlobalHashtablezSampler().IterateUnlocked([&](const HashtablezInfo& info) {
+    if (n == max_snapshots) return;
+    HashtablezSnapshot& snap = snapshots[n];
+    snap.capacity = info.capacity.load(std::memory_order_relaxed);
+    snap.size = info.size.load(std::memory_order_relaxed);
+    snap.num_erases = info.num_erases.load(std::memory_order_relaxed);
+    snap.num_rehashes = info.num_rehashes.load(std::memory_order_relaxed);
+    snap.max_probe_length =
+        info.max_probe_length.load(std::memory_order_relaxed);
+    snap.total_probe_length =
+        info.total_probe_length.load(std::memory_order_relaxed);
+    snap.hashes_bitwise_or =
+        info.hashes_bitwise_or.load(std::memory_order_relaxed);
+    snap.hashes_bitwise_and =
+        info.hashes_bitwise_and.load(std::memory_order_relaxed);
+    snap.hashes_bitwise_xor =
+        info.hashes_bitwise_xor.load(std::memory_order_relaxed);
+    snap.max_reserve = info.max_reserve.load(std::memory_order_relaxed);
+    snap.num_grows = info.num_grows.load(std::memory_order_relaxed);
+    snap.rehash_bytes_moved =
+        info.rehash_bytes_moved.load(std::memory_order_relaxed);
+    // These fields are written only while the sample is dead (in
+    // `PrepareForSampling`, before `PopDead` republishes it as live), so for
+    // a sample that stays live across the copy they are stable. The liveness
+    // re-check below discards the snapshot of a sample retired mid-copy.
+    snap.inline_element_size = info.inline_element_size;
+    snap.key_size = info.key_size;
+    snap.value_size = info.value_size;
+    snap.callsite_fingerprint = info.callsite_fingerprint;
+    snap.soo_capacity = info.soo_capacity;
+    snap.weight = info.weight;
+    if (HashtablezSampler::IsLive(info)) ++n;
+  });
+  return n;
+}
+
 HashtablezInfo::HashtablezInfo() = default;
 HashtablezInfo::~HashtablezInfo() = default;
 
@@ -92,6 +131,8 @@ void HashtablezInfo::PrepareForSampling(int64_t stride,
   hashes_bitwise_and.store(~size_t{}, std::memory_order_relaxed);
   hashes_bitwise_xor.store(0, std::memory_order_relaxed);
   max_reserve.store(0, std::memory_order_relaxed);
+  num_grows.store(0, std::memory_order_relaxed);
+  rehash_bytes_moved.store(0, std::memory_order_relaxed);
 
   create_time = absl::Now();
   weight = stride;
@@ -103,6 +144,15 @@ void HashtablezInfo::PrepareForSampling(int64_t stride,
   inline_element_size = inline_element_size_value;
   key_size = key_size_value;
   value_size = value_size_value;
+  // An order-sensitive mix of the stack PCs. This is only used to group
+  // samples sharing a construction callsite, so collisions merely merge two
+  // callsites in a report; no cryptographic strength is needed.
+  uint64_t fingerprint = 0;
+  for (int i = 0; i < depth; ++i) {
+    fingerprint = (fingerprint ^ reinterpret_cast<uintptr_t>(stack[i])) *
+                  uint64_t{0x9ddfea08eb382d69};
+  }
+  callsite_fingerprint = static_cast<size_t>(fingerprint);
   soo_capacity = soo_capacity_value;
 }
 
@@ -189,6 +239,15 @@ void RecordRehashSlow(HashtablezInfo* info, size_t total_probe_length) {
   info->num_rehashes.store(
       1 + info->num_rehashes.load(std::memory_order_relaxed),
       std::memory_order_relaxed);
+  // Every element the table currently holds was moved into the new backing
+  // array. `size` was refreshed by the `RecordStorageChanged` call preceding
+  // this hook, and `inline_element_size` is set before the handle is
+  // published, so both are safe to read on the writer thread.
+  info->rehash_bytes_moved.store(
+      info->rehash_bytes_moved.load(std::memory_order_relaxed) +
+          info->size.load(std::memory_order_relaxed) *
+              info->inline_element_size,
+      std::memory_order_relaxed);
 }
 
 void RecordReservationSlow(HashtablezInfo* info, size_t target_capacity) {
@@ -204,6 +263,14 @@ void RecordClearedReservationSlow(HashtablezInfo* info) {
 
 void RecordStorageChangedSlow(HashtablezInfo* info, size_t size,
                               size_t capacity) {
+  const size_t old_capacity = info->capacity.load(std::memory_order_relaxed);
+  if (capacity > old_capacity && old_capacity != 0) {
+    // Growing an already-allocated table is the event a sufficiently large
+    // `reserve()` call would have avoided; the initial allocation is not
+    // counted since reserving cannot eliminate it.
+    info->num_grows.store(1 + info->num_grows.load(std::memory_order_relaxed),
+                          std::memory_order_relaxed);
+  }
   info->size.store(size, std::memory_order_relaxed);
   info->capacity.store(capacity, std::memory_order_relaxed);
   if (size == 0) {
@@ -243,6 +310,24 @@ void RecordEraseSlow(HashtablezInfo* info) {
                          std::memory_order_relaxed);
 }
 
+void RecordErasesSlow(HashtablezInfo* info, size_t count) {
+  info->size.fetch_sub(count, std::memory_order_relaxed);
+  // There is only one concurrent writer, so `load` then `store` is sufficient
+  // instead of using `fetch_add`.
+  info->num_erases.store(
+      count + info->num_erases.load(std::memory_order_relaxed),
+      std::memory_order_relaxed);
+}
+
+size_t HashtablezReserveAdvice(const HashtablezSnapshot& snapshot) {
+  if (snapshot.num_grows == 0) return 0;
+  // If the largest reservation already covers the current size, the recorded
+  // growth predates the reservation; the callsite needs its reserve() moved
+  // earlier rather than a different value, so no number is advised.
+  if (snapshot.max_reserve >= snapshot.size) return 0;
+  return snapshot.size;
+}
+
 void SetHashtablezConfigListener(HashtablezConfigListener l) {
   g_hashtablez_config_listener.store(l, std::memory_order_release);
 }
@@ -89,6 +89,12 @@ struct HashtablezInfo : public profiling_internal::Sample<HashtablezInfo> {
   std::atomic<size_t> hashes_bitwise_and;
   std::atomic<size_t> hashes_bitwise_xor;
   std::atomic<size_t> max_reserve;
+  // The number of times the table moved to a larger backing array after its
+  // initial allocation, and the cumulative bytes of slot data moved by all
+  // rehashes. Both are zero for a table whose final capacity was reserved up
+  // front, which makes them the signal for reserve-miss reports.
+  std::atomic<size_t> num_grows;
+  std::atomic<size_t> rehash_bytes_moved;
 
   // All of the fields below are set by `PrepareForSampling`, they must not be
   // mutated in `Record*` functions.  They are logically `const` in that sense.
@@ -107,6 +113,10 @@ struct HashtablezInfo : public profiling_internal::Sample<HashtablezInfo> {
   size_t inline_element_size;  // How big is the slot in bytes?
   size_t key_size;             // sizeof(key_type)
   size_t value_size;           // sizeof(value_type)
+  // A cheap hash of `stack`, identifying the callsite that constructed the
+  // table without requiring symbolization. Only stable within a single build
+  // of the binary; use it to group samples, not to compare across releases.
+  size_t callsite_fingerprint;
 };
 
 void RecordRehashSlow(HashtablezInfo* info, size_t total_probe_length);
@@ -122,6 +132,7 @@ void RecordInsertSlow(HashtablezInfo* info, size_t hash,
                       size_t distance_from_desired);
 
 void RecordEraseSlow(HashtablezInfo* info);
+void RecordErasesSlow(HashtablezInfo* info, size_t count);
 
 struct SamplingState {
   int64_t next_sample;
@@ -184,6 +195,11 @@ class HashtablezInfoHandle {
     RecordEraseSlow(info_);
   }
 
+  inline void RecordErases(size_t count) {
+    if (ABSL_PREDICT_TRUE(info_ == nullptr)) return;
+    RecordErasesSlow(info_, count);
+  }
+
   friend inline void swap(HashtablezInfoHandle& lhs,
                           HashtablezInfoHandle& rhs) {
     std::swap(lhs.info_, rhs.info_);
@@ -209,6 +225,7 @@ class HashtablezInfoHandle {
   inline void RecordClearedReservation() {}
   inline void RecordInsert(size_t /*hash*/, size_t /*distance_from_desired*/) {}
   inline void RecordErase() {}
+  inline void RecordErases(size_t /*count*/) {}
 
   friend inline void swap(HashtablezInfoHandle& /*lhs*/,
                           HashtablezInfoHandle& /*rhs*/) {}
@@ -243,6 +260,52 @@ using HashtablezSampler =
 // Returns a global Sampler.
 HashtablezSampler& GlobalHashtablezSampler();
 
+// A plain-data copy of the statistics of a single sampled hashtable, filled
+// in by `SnapshotHashtablezSamples()`.
+struct HashtablezSnapshot {
+  size_t capacity;
+  size_t size;
+  size_t num_erases;
+  size_t num_rehashes;
+  size_t max_probe_length;
+  size_t total_probe_length;
+  size_t hashes_bitwise_or;
+  size_t hashes_bitwise_and;
+  size_t hashes_bitwise_xor;
+  size_t max_reserve;
+  size_t num_grows;
+  size_t rehash_bytes_moved;
+  size_t inline_element_size;
+  size_t key_size;
+  size_t value_size;
+  size_t callsite_fingerprint;
+  uint16_t soo_capacity;
+  int64_t weight;
+};
+
+// Copies the statistics of up to `max_snapshots` currently live samples from
+// the global sampler into `snapshots`, using only atomic reads on the sampled
+// records. Unlike `HashtablezSampler::Iterate`, this never acquires the
+// per-sample mutex, so periodic exporters can run it without ever blocking
+// concurrent table creation, destruction, or mutation. Returns the number of
+// snapshots written.
+//
+// The fields of one snapshot are copied without synchronization and so are
+// not guaranteed to be from a single instant; this matches the accuracy of
+// the underlying relaxed counters. Samples that are retired while being
+// copied are discarded. Stack traces are not available through this API as
+// they cannot be read without locking; use `Iterate` for those.
+size_t SnapshotHashtablezSamples(HashtablezSnapshot* snapshots,
+                                 size_t max_snapshots);
+
+// Returns the element count that a `reserve()` call at the sampled table's
+// construction site should have requested to avoid the growth recorded in
+// `snapshot`, or 0 if the sample shows no avoidable growth (the table never
+// outgrew its initial allocation, or an adequate reservation was already
+// made). Reports should group snapshots by `callsite_fingerprint` and take
+// the maximum advice per callsite.
+size_t HashtablezReserveAdvice(const HashtablezSnapshot& snapshot);
+
 using HashtablezConfigListener = void (*)();
 void SetHashtablezConfigListener(HashtablezConfigListener l);
 
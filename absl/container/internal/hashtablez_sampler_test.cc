@@ -105,6 +105,8 @@ TEST(HashtablezInfoTest, PrepareForSampling) {
   EXPECT_EQ(info.hashes_bitwise_and.load(), ~size_t{});
   EXPECT_EQ(info.hashes_bitwise_xor.load(), 0);
   EXPECT_EQ(info.max_reserve.load(), 0);
+  EXPECT_EQ(info.num_grows.load(), 0);
+  EXPECT_EQ(info.rehash_bytes_moved.load(), 0);
   EXPECT_GE(info.create_time, test_start);
   EXPECT_EQ(info.weight, test_stride);
   EXPECT_EQ(info.inline_element_size, test_element_size);
@@ -121,6 +123,8 @@ TEST(HashtablezInfoTest, PrepareForSampling) {
   info.hashes_bitwise_and.store(1, std::memory_order_relaxed);
   info.hashes_bitwise_xor.store(1, std::memory_order_relaxed);
   info.max_reserve.store(1, std::memory_order_relaxed);
+  info.num_grows.store(1, std::memory_order_relaxed);
+  info.rehash_bytes_moved.store(1, std::memory_order_relaxed);
   info.create_time = test_start - absl::Hours(20);
 
   info.PrepareForSampling(test_stride * 2, test_element_size,
@@ -137,6 +141,8 @@ TEST(HashtablezInfoTest, PrepareForSampling) {
   EXPECT_EQ(info.hashes_bitwise_and.load(), ~size_t{});
   EXPECT_EQ(info.hashes_bitwise_xor.load(), 0);
   EXPECT_EQ(info.max_reserve.load(), 0);
+  EXPECT_EQ(info.num_grows.load(), 0);
+  EXPECT_EQ(info.rehash_bytes_moved.load(), 0);
   EXPECT_EQ(info.weight, 2 * test_stride);
   EXPECT_EQ(info.inline_element_size, test_element_size);
   EXPECT_EQ(info.key_size, test_key_size);
@@ -160,9 +166,16 @@ TEST(HashtablezInfoTest, RecordStorageChanged) {
   RecordStorageChangedSlow(&info, 17, 47);
   EXPECT_EQ(info.size.load(), 17);
   EXPECT_EQ(info.capacity.load(), 47);
+  // The initial allocation is not a growth event.
+  EXPECT_EQ(info.num_grows.load(), 0);
   RecordStorageChangedSlow(&info, 20, 20);
   EXPECT_EQ(info.size.load(), 20);
   EXPECT_EQ(info.capacity.load(), 20);
+  EXPECT_EQ(info.num_grows.load(), 0);
+  RecordStorageChangedSlow(&info, 20, 40);
+  EXPECT_EQ(info.num_grows.load(), 1);
+  RecordStorageChangedSlow(&info, 35, 80);
+  EXPECT_EQ(info.num_grows.load(), 2);
 }
 
 TEST(HashtablezInfoTest, RecordInsert) {
@@ -250,6 +263,10 @@ TEST(HashtablezInfoTest, RecordRehash) {
   EXPECT_EQ(info.total_probe_length.load(), 3);
   EXPECT_EQ(info.num_erases.load(), 0);
   EXPECT_EQ(info.num_rehashes.load(), 1);
+  EXPECT_EQ(info.rehash_bytes_moved.load(), 2 * test_element_size);
+
+  RecordRehashSlow(&info, 2 * kProbeLength);
+  EXPECT_EQ(info.rehash_bytes_moved.load(), 4 * test_element_size);
   EXPECT_EQ(info.inline_element_size, test_element_size);
   EXPECT_EQ(info.key_size, test_key_size);
   EXPECT_EQ(info.value_size, test_value_size);
@@ -427,6 +444,84 @@ TEST(HashtablezSamplerTest, Unregistration) {
   EXPECT_THAT(GetSizes(&sampler), IsEmpty());
 }
 
+TEST(HashtablezSamplerTest, Snapshot) {
+  // Snapshots are taken from the global sampler; tag our samples with a
+  // distinctive value_size so leftovers from other tests are ignored.
+  const size_t kValueSizeTag = 12345;
+  HashtablezSampler& sampler = GlobalHashtablezSampler();
+  std::vector<HashtablezInfo*> infos;
+  for (size_t i = 0; i < 3; ++i) {
+    auto* info = sampler.Register(/*stride=*/123, /*inline_element_size=*/17,
+                                  /*key_size=*/3, /*value_size=*/kValueSizeTag,
+                                  /*soo_capacity=*/0);
+    ASSERT_NE(info, nullptr);
+    info->size.store(10 + i);
+    info->max_probe_length.store(i);
+    infos.push_back(info);
+  }
+
+  std::vector<HashtablezSnapshot> snapshots(100);
+  size_t n = SnapshotHashtablezSamples(snapshots.data(), snapshots.size());
+  ASSERT_LE(n, snapshots.size());
+
+  std::vector<size_t> sizes;
+  for (size_t i = 0; i < n; ++i) {
+    if (snapshots[i].value_size != kValueSizeTag) continue;
+    sizes.push_back(snapshots[i].size);
+    EXPECT_EQ(snapshots[i].inline_element_size, 17);
+    EXPECT_EQ(snapshots[i].key_size, 3);
+    EXPECT_EQ(snapshots[i].weight, 123);
+    EXPECT_LT(snapshots[i].max_probe_length, 3);
+    // All three samples were registered from the same callsite, so they must
+    // share a fingerprint. (It may be 0 on platforms where GetStackTrace
+    // collects nothing.)
+    EXPECT_EQ(snapshots[i].callsite_fingerprint, infos[0]->callsite_fingerprint);
+  }
+  EXPECT_THAT(sizes, UnorderedElementsAre(10, 11, 12));
+
+  for (auto* info : infos) sampler.Unregister(info);
+
+  n = SnapshotHashtablezSamples(snapshots.data(), snapshots.size());
+  for (size_t i = 0; i < n; ++i) {
+    EXPECT_NE(snapshots[i].value_size, kValueSizeTag);
+  }
+}
+
+TEST(HashtablezSamplerTest, ReserveAdvice) {
+  HashtablezSnapshot snapshot = {};
+  snapshot.size = 1000;
+
+  // A table that never outgrew its initial allocation needs no advice.
+  snapshot.num_grows = 0;
+  EXPECT_EQ(HashtablezReserveAdvice(snapshot), 0);
+
+  // A table that grew without a (sufficient) reservation should have
+  // reserved its current size.
+  snapshot.num_grows = 4;
+  EXPECT_EQ(HashtablezReserveAdvice(snapshot), 1000);
+  snapshot.max_reserve = 500;
+  EXPECT_EQ(HashtablezReserveAdvice(snapshot), 1000);
+
+  // A reservation covering the current size means the growth predates the
+  // reserve() call; no target value is advised.
+  snapshot.max_reserve = 1000;
+  EXPECT_EQ(HashtablezReserveAdvice(snapshot), 0);
+}
+
+TEST(HashtablezSamplerTest, SnapshotRespectsMaxSnapshots) {
+  HashtablezSampler& sampler = GlobalHashtablezSampler();
+  std::vector<HashtablezInfo*> infos;
+  for (size_t i = 0; i < 4; ++i) {
+    infos.push_back(Register(&sampler, i));
+  }
+
+  HashtablezSnapshot snapshots[2];
+  EXPECT_EQ(SnapshotHashtablezSamples(snapshots, 2), 2);
+  EXPECT_EQ(SnapshotHashtablezSamples(snapshots, 0), 0);
+
+  for (auto* info : infos) sampler.Unregister(info);
+}
+
 TEST(HashtablezSamplerTest, MultiThreaded) {
   HashtablezSampler sampler;
   Notification stop;
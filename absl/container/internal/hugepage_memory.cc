@@ -0,0 +1,115 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/container/internal/hugepage_memory.h"
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#include "absl/base/config.h"
+#include "absl/base/internal/throw_delegate.h"
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+namespace container_internal {
+
+namespace {
+
+constexpr size_t RoundUpToHugepage(size_t size) {
+  return (size + kHugepageSize - 1) & ~(kHugepageSize - 1);
+}
+
+bool UseHugepages(size_t size) {
+#if defined(__linux__)
+  return size >= kHugepageThreshold;
+#else
+  static_cast<void>(size);
+  return false;
+#endif
+}
+
+// Fallback for small blocks and platforms without hugepage support.
+void* FallbackAllocate(size_t size, size_t alignment) {
+#if defined(__cpp_aligned_new)
+  if (alignment > alignof(std::max_align_t)) {
+    return ::operator new(size, std::align_val_t{alignment});
+  }
+#endif
+  static_cast<void>(alignment);
+  return ::operator new(size);
+}
+
+void FallbackDeallocate(void* ptr, size_t size, size_t alignment) {
+#if defined(__cpp_aligned_new)
+  if (alignment > alignof(std::max_align_t)) {
+#if defined(__cpp_sized_deallocation)
+    ::operator delete(ptr, size, std::align_val_t{alignment});
+#else
+    ::operator delete(ptr, std::align_val_t{alignment});
+#endif
+    return;
+  }
+#endif
+  static_cast<void>(alignment);
+#if defined(__cpp_sized_deallocation)
+  ::operator delete(ptr, size);
+#else
+  static_cast<void>(size);
+  ::operator delete(ptr);
+#endif
+}
+
+}  // namespace
+
+void* HugepageAwareAllocate(size_t size, size_t alignment) {
+#if defined(__linux__)
+  if (UseHugepages(size)) {
+    const size_t rounded = RoundUpToHugepage(size);
+    void* ptr = nullptr;
+    // kHugepageSize exceeds any plausible slot alignment, so aligning to the
+    // hugepage boundary satisfies `alignment` as well.
+    if (posix_memalign(&ptr, kHugepageSize, rounded) != 0) {
+      base_internal::ThrowStdBadAlloc();
+    }
+#if defined(MADV_HUGEPAGE)
+    // Best effort: the kernel coalesces the range into hugepages
+    // asynchronously, and ignores the advice if transparent hugepages are
+    // disabled. Either way the memory is usable.
+    madvise(ptr, rounded, MADV_HUGEPAGE);
+#endif
+    return ptr;
+  }
+#endif
+  return FallbackAllocate(size, alignment);
+}
+
+void HugepageAwareDeallocate(void* ptr, size_t size, size_t alignment) {
+#if defined(__linux__)
+  if (UseHugepages(size)) {
+    // Hugepage-sized blocks always come from posix_memalign.
+    free(ptr);
+    return;
+  }
+#endif
+  FallbackDeallocate(ptr, size, alignment);
+}
+
+}  // namespace container_internal
+ABSL_NAMESPACE_END
+}  // namespace absl
@@ -0,0 +1,67 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Hugepage-aware raw memory allocation.
+//
+// Large flat containers (most notably `absl::flat_hash_map` backing arrays)
+// are accessed in a nearly random pattern, so with 4 KiB pages the TLB covers
+// only a tiny fraction of the working set and lookups stall on TLB misses.
+// The helpers in this file allocate big blocks with 2 MiB alignment and ask
+// the kernel to back them with transparent hugepages, which widens TLB
+// coverage by ~512x for those blocks.
+//
+// This is a low-level building block; most users should opt in through
+// `absl::HugepageAllocator` (see absl/container/hugepage_allocator.h).
+
+#ifndef ABSL_CONTAINER_INTERNAL_HUGEPAGE_MEMORY_H_
+#define ABSL_CONTAINER_INTERNAL_HUGEPAGE_MEMORY_H_
+
+#include <cstddef>
+
+#include "absl/base/config.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+namespace container_internal {
+
+// The kernel hugepage size assumed by this file. 2 MiB is the transparent
+// hugepage size on x86-64 and the common configuration on aarch64.
+constexpr size_t kHugepageSize = size_t{2} << 20;
+
+// Allocations of at least this many bytes are placed on hugepage-aligned,
+// hugepage-advised memory. Below it, a hugepage would waste more memory than
+// the TLB relief is worth and the request is served by `operator new`.
+constexpr size_t kHugepageThreshold = kHugepageSize;
+
+// Allocates `size` bytes aligned to at least `alignment`.
+//
+// On Linux, requests of `kHugepageThreshold` bytes or more are rounded up to
+// a whole number of hugepages, aligned to `kHugepageSize`, and advised with
+// `madvise(MADV_HUGEPAGE)`; the kernel honors the advice on a best-effort
+// basis, so the call succeeds even where transparent hugepages are disabled.
+// All other requests (and all requests on other platforms) are served by
+// `operator new`. Never returns null; failure to obtain memory is reported
+// the way `operator new` reports it.
+void* HugepageAwareAllocate(size_t size, size_t alignment);
+
+// Deallocates memory obtained from `HugepageAwareAllocate`. `size` and
+// `alignment` must be the values passed to the matching allocation call, as
+// they determine which underlying allocator owns the block.
+void HugepageAwareDeallocate(void* ptr, size_t size, size_t alignment);
+
+}  // namespace container_internal
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_CONTAINER_INTERNAL_HUGEPAGE_MEMORY_H_
@@ -446,6 +446,13 @@ class Storage {
   template <typename... Args>
   Reference<A> EmplaceBack(Args&&... args);
 
+  // Grows the size by `count` without constructing the new elements,
+  // relocating to a larger backing array if necessary, and returns a pointer
+  // to the first new slot.  Callers are responsible for ensuring that leaving
+  // the slots unconstructed is valid for `ValueType<A>` and for writing them
+  // before they are read or destroyed.
+  Pointer<A> AppendUninitialized(SizeType<A> count);
+
   Iterator<A> Erase(ConstIterator<A> from, ConstIterator<A> to);
 
   void Reserve(SizeType<A> requested_capacity);
@@ -565,6 +572,10 @@ class Storage {
   template <typename... Args>
   ABSL_ATTRIBUTE_NOINLINE Reference<A> EmplaceBackSlow(Args&&... args);
 
+  // Relocates the `n` elements starting at `src` into the uninitialized
+  // buffer at `dst`, leaving the source range destroyed.
+  void RelocateElements(Pointer<A> dst, Pointer<A> src, SizeType<A> n);
+
   Metadata metadata_;
   Data data_;
 };
@@ -576,6 +587,25 @@ void Storage<T, N, A>::DestroyContents() {
   DeallocateIfAllocated();
 }
 
+template <typename T, size_t N, typename A>
+void Storage<T, N, A>::RelocateElements(Pointer<A> dst, Pointer<A> src,
+                                        SizeType<A> n) {
+  // Fast path: if the value type is trivially relocatable and we know the
+  // allocator doesn't do anything fancy, then moving the bytes and never
+  // running move constructors or destructors is equivalent to (and much
+  // cheaper than) an element-wise relocation loop.
+  if (absl::is_trivially_relocatable<ValueType<A>>::value &&
+      std::is_same<A, std::allocator<ValueType<A>>>::value) {
+    std::memcpy(reinterpret_cast<char*>(dst),
+                reinterpret_cast<const char*>(src), n * sizeof(ValueType<A>));
+  } else {
+    IteratorValueAdapter<A, MoveIterator<A>> move_values(
+        (MoveIterator<A>(src)));
+    ConstructElements<A>(GetAllocator(), dst, move_values, n);
+    DestroyAdapter<A>::DestroyElements(GetAllocator(), src, n);
+  }
+}
+
 template <typename T, size_t N, typename A>
 void Storage<T, N, A>::InitFrom(const Storage& other) {
   const SizeType<A> n = other.GetSize();
@@ -717,11 +747,8 @@ auto Storage<T, N, A>::Resize(ValueAdapter values,
     ConstructionTransaction<A> construction_tx(alloc);
     construction_tx.Construct(new_data + size, values, new_size - size);
 
-    IteratorValueAdapter<A, MoveIterator<A>> move_values(
-        (MoveIterator<A>(base)));
-    ConstructElements<A>(alloc, new_data, move_values, size);
+    RelocateElements(new_data, base, size);
 
-    DestroyAdapter<A>::DestroyElements(alloc, base, size);
     std::move(construction_tx).Commit();
     DeallocateIfAllocated();
     SetAllocation(std::move(allocation_tx).Release());
@@ -730,6 +757,28 @@ auto Storage<T, N, A>::Resize(ValueAdapter values,
   SetSize(new_size);
 }
 
+template <typename T, size_t N, typename A>
+auto Storage<T, N, A>::AppendUninitialized(SizeType<A> count) -> Pointer<A> {
+  StorageView<A> storage_view = MakeStorageView();
+  const SizeType<A> new_size = storage_view.size + count;
+  if (new_size > storage_view.capacity) {
+    AllocationTransaction<A> allocation_tx(GetAllocator());
+    SizeType<A> requested_capacity =
+        ComputeCapacity(storage_view.capacity, new_size);
+    Pointer<A> new_data = allocation_tx.Allocate(requested_capacity);
+
+    RelocateElements(new_data, storage_view.data, storage_view.size);
+
+    DeallocateIfAllocated();
+    SetAllocation(std::move(allocation_tx).Release());
+    SetIsAllocated();
+    AddSize(count);
+    return new_data + storage_view.size;
+  }
+  AddSize(count);
+  return storage_view.data + storage_view.size;
+}
+
 template <typename T, size_t N, typename A>
 template <typename ValueAdapter>
 auto Storage<T, N, A>::Insert(ConstIterator<A> pos, ValueAdapter values,
@@ -746,25 +795,35 @@ auto Storage<T, N, A>::Insert(ConstIterator<A> pos, ValueAdapter values,
     ConstructionTransaction<A> construction_tx(GetAllocator());
     ConstructionTransaction<A> move_construction_tx(GetAllocator());
 
-    IteratorValueAdapter<A, MoveIterator<A>> move_values(
-        MoveIterator<A>(storage_view.data));
-
     SizeType<A> requested_capacity =
         ComputeCapacity(storage_view.capacity, new_size);
     Pointer<A> new_data = allocation_tx.Allocate(requested_capacity);
 
     construction_tx.Construct(new_data + insert_index, values, insert_count);
 
-    move_construction_tx.Construct(new_data, move_values, insert_index);
+    if (absl::is_trivially_relocatable<ValueType<A>>::value &&
+        std::is_same<A, std::allocator<ValueType<A>>>::value) {
+      // Relocation by memcpy cannot throw, so no rollback transaction is
+      // needed for the already-moved prefix.
+      RelocateElements(new_data, storage_view.data, insert_index);
+      RelocateElements(new_data + insert_end_index,
+                       storage_view.data + insert_index,
+                       storage_view.size - insert_index);
+    } else {
+      IteratorValueAdapter<A, MoveIterator<A>> move_values(
+          MoveIterator<A>(storage_view.data));
+
+      move_construction_tx.Construct(new_data, move_values, insert_index);
 
-    ConstructElements<A>(GetAllocator(), new_data + insert_end_index,
-                         move_values, storage_view.size - insert_index);
+      ConstructElements<A>(GetAllocator(), new_data + insert_end_index,
+                           move_values, storage_view.size - insert_index);
 
-    DestroyAdapter<A>::DestroyElements(GetAllocator(), storage_view.data,
-                                       storage_view.size);
+      DestroyAdapter<A>::DestroyElements(GetAllocator(), storage_view.data,
+                                         storage_view.size);
 
+      std::move(move_construction_tx).Commit();
+    }
     std::move(construction_tx).Commit();
-    std::move(move_construction_tx).Commit();
     DeallocateIfAllocated();
     SetAllocation(std::move(allocation_tx).Release());
 
@@ -845,8 +904,6 @@ template <typename... Args>
 auto Storage<T, N, A>::EmplaceBackSlow(Args&&... args) -> Reference<A> {
   StorageView<A> storage_view = MakeStorageView();
   AllocationTransaction<A> allocation_tx(GetAllocator());
-  IteratorValueAdapter<A, MoveIterator<A>> move_values(
-      MoveIterator<A>(storage_view.data));
   SizeType<A> requested_capacity = NextCapacity(storage_view.capacity);
   Pointer<A> construct_data = allocation_tx.Allocate(requested_capacity);
   Pointer<A> last_ptr = construct_data + storage_view.size;
@@ -854,18 +911,15 @@ auto Storage<T, N, A>::EmplaceBackSlow(Args&&... args) -> Reference<A> {
   // Construct new element.
   AllocatorTraits<A>::construct(GetAllocator(), last_ptr,
                                 std::forward<Args>(args)...);
-  // Move elements from old backing store to new backing store.
+  // Relocate elements from old backing store to new backing store.
   ABSL_INTERNAL_TRY {
-    ConstructElements<A>(GetAllocator(), allocation_tx.GetData(), move_values,
-                         storage_view.size);
+    RelocateElements(allocation_tx.GetData(), storage_view.data,
+                     storage_view.size);
   }
   ABSL_INTERNAL_CATCH_ANY {
     AllocatorTraits<A>::destroy(GetAllocator(), last_ptr);
     ABSL_INTERNAL_RETHROW;
   }
-  // Destroy elements in old backing store.
-  DestroyAdapter<A>::DestroyElements(GetAllocator(), storage_view.data,
-                                     storage_view.size);
 
   DeallocateIfAllocated();
   SetAllocation(std::move(allocation_tx).Release());
@@ -920,18 +974,11 @@ auto Storage<T, N, A>::Reserve(SizeType<A> requested_capacity) -> void {
 
   AllocationTransaction<A> allocation_tx(GetAllocator());
 
-  IteratorValueAdapter<A, MoveIterator<A>> move_values(
-      MoveIterator<A>(storage_view.data));
-
   SizeType<A> new_requested_capacity =
       ComputeCapacity(storage_view.capacity, requested_capacity);
   Pointer<A> new_data = allocation_tx.Allocate(new_requested_capacity);
 
-  ConstructElements<A>(GetAllocator(), new_data, move_values,
-                       storage_view.size);
-
-  DestroyAdapter<A>::DestroyElements(GetAllocator(), storage_view.data,
-                                     storage_view.size);
+  RelocateElements(new_data, storage_view.data, storage_view.size);
 
   DeallocateIfAllocated();
   SetAllocation(std::move(allocation_tx).Release());
@@ -950,9 +997,6 @@ auto Storage<T, N, A>::ShrinkToFit() -> void {
 
   AllocationTransaction<A> allocation_tx(GetAllocator());
 
-  IteratorValueAdapter<A, MoveIterator<A>> move_values(
-      MoveIterator<A>(storage_view.data));
-
   Pointer<A> construct_data;
   if (storage_view.size > GetInlinedCapacity()) {
     SizeType<A> requested_capacity = storage_view.size;
@@ -966,17 +1010,13 @@ auto Storage<T, N, A>::ShrinkToFit() -> void {
   }
 
   ABSL_INTERNAL_TRY {
-    ConstructElements<A>(GetAllocator(), construct_data, move_values,
-                         storage_view.size);
+    RelocateElements(construct_data, storage_view.data, storage_view.size);
   }
   ABSL_INTERNAL_CATCH_ANY {
     SetAllocation({storage_view.data, storage_view.capacity});
     ABSL_INTERNAL_RETHROW;
   }
 
-  DestroyAdapter<A>::DestroyElements(GetAllocator(), storage_view.data,
-                                     storage_view.size);
-
   MallocAdapter<A>::Deallocate(GetAllocator(), storage_view.data,
                                storage_view.capacity);
 
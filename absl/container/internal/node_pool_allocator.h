@@ -0,0 +1,167 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef ABSL_CONTAINER_INTERNAL_NODE_POOL_ALLOCATOR_H_
+#define ABSL_CONTAINER_INTERNAL_NODE_POOL_ALLOCATOR_H_
+
+#include <cstddef>
+#include <memory>
+#include <new>
+
+#include "absl/base/config.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+namespace container_internal {
+
+// A free list of fixed-size blocks backing `NodePoolAllocator`. Node-based
+// containers (`node_hash_map`, `node_hash_set`) allocate one block per
+// element and, under insert/erase churn, pay for a malloc/free round trip on
+// every cycle. Routing the container's allocator through a pool turns an
+// erase-then-insert cycle into two pointer swaps:
+//
+//   NodePool pool;
+//   absl::node_hash_map<K, V, absl::Hash<K>, std::equal_to<K>,
+//                       NodePoolAllocator<std::pair<const K, V>>>
+//       m(NodePoolAllocator<std::pair<const K, V>>(&pool));
+//
+// The pool caches the blocks of the first single-object allocation size it
+// sees (the node size) and serves subsequent allocations of that size from
+// the free list; all other requests, in particular the table's backing
+// array, go straight to the heap. `Shrink()` returns every cached block to
+// the heap, e.g. after a workload's churn phase ends.
+//
+// The pool is not thread safe — guard it with whatever synchronizes the
+// containers that use it — and must outlive them.
+class NodePool {
+ public:
+  NodePool() = default;
+
+  NodePool(const NodePool&) = delete;
+  NodePool& operator=(const NodePool&) = delete;
+
+  ~NodePool() { Shrink(); }
+
+  // Releases every cached block back to the heap. Blocks currently in use by
+  // a container are unaffected.
+  void Shrink() {
+    while (free_list_ != nullptr) {
+      void* next = *static_cast<void**>(free_list_);
+      ::operator delete(free_list_);
+      free_list_ = next;
+    }
+    available_ = 0;
+  }
+
+  // The number of cached blocks available for reuse.
+  size_t available() const { return available_; }
+
+  // The block size served from the free list, or zero before the first
+  // pooled allocation fixes it.
+  size_t block_size() const { return block_size_; }
+
+ private:
+  template <class T>
+  friend class NodePoolAllocator;
+
+  void* Allocate(size_t bytes) {
+    if (block_size_ == 0) block_size_ = bytes;
+    if (bytes == block_size_ && free_list_ != nullptr) {
+      void* p = free_list_;
+      free_list_ = *static_cast<void**>(p);
+      --available_;
+      return p;
+    }
+    return ::operator new(bytes);
+  }
+
+  void Deallocate(void* p, size_t bytes) {
+    if (bytes == block_size_) {
+      *static_cast<void**>(p) = free_list_;
+      free_list_ = p;
+      ++available_;
+    } else {
+      ::operator delete(p);
+    }
+  }
+
+  void* free_list_ = nullptr;
+  size_t block_size_ = 0;
+  size_t available_ = 0;
+};
+
+// A standard-compliant allocator that recycles single-object allocations
+// through a caller-provided `NodePool`. Rebound copies share the pool, so a
+// node container's element allocations are pooled while its rebound
+// backing-array allocations fall through to `std::allocator`. Allocators
+// compare equal iff they use the same pool.
+template <class T>
+class NodePoolAllocator {
+ public:
+  using value_type = T;
+
+  NodePoolAllocator() = default;
+  explicit NodePoolAllocator(NodePool* pool) : pool_(pool) {}
+
+  template <class U>
+  NodePoolAllocator(const NodePoolAllocator<U>& x) : pool_(x.pool()) {}
+
+  T* allocate(size_t n) {
+    if (ShouldPool(n)) return static_cast<T*>(pool_->Allocate(sizeof(T)));
+    return std::allocator<T>().allocate(n);
+  }
+
+  void deallocate(T* p, size_t n) {
+    if (ShouldPool(n)) {
+      pool_->Deallocate(p, sizeof(T));
+    } else {
+      std::allocator<T>().deallocate(p, n);
+    }
+  }
+
+  NodePool* pool() const { return pool_; }
+
+  template <class U>
+  class rebind {
+   public:
+    using other = NodePoolAllocator<U>;
+  };
+
+  friend bool operator==(const NodePoolAllocator& a,
+                         const NodePoolAllocator& b) {
+    return a.pool_ == b.pool_;
+  }
+
+  friend bool operator!=(const NodePoolAllocator& a,
+                         const NodePoolAllocator& b) {
+    return !(a == b);
+  }
+
+ private:
+  // Only single-object allocations are pooled, and only when the block can
+  // hold the free-list link and pooled blocks' `operator new` alignment
+  // suffices.
+  bool ShouldPool(size_t n) const {
+    return pool_ != nullptr && n == 1 && sizeof(T) >= sizeof(void*) &&
+           alignof(T) <= alignof(max_align_t);
+  }
+
+  NodePool* pool_ = nullptr;
+};
+
+}  // namespace container_internal
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_CONTAINER_INTERNAL_NODE_POOL_ALLOCATOR_H_
@@ -0,0 +1,128 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/container/internal/node_pool_allocator.h"
+
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include "gtest/gtest.h"
+#include "absl/container/node_hash_map.h"
+#include "absl/container/node_hash_set.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+namespace container_internal {
+namespace {
+
+TEST(NodePool, RecyclesMatchingBlocks) {
+  NodePool pool;
+  NodePoolAllocator<int64_t[4]> alloc(&pool);
+
+  auto* p = alloc.allocate(1);
+  EXPECT_EQ(pool.block_size(), sizeof(int64_t[4]));
+  EXPECT_EQ(pool.available(), 0);
+
+  alloc.deallocate(p, 1);
+  EXPECT_EQ(pool.available(), 1);
+
+  // The freed block is reused for the next allocation of the same size.
+  auto* q = alloc.allocate(1);
+  EXPECT_EQ(q, p);
+  EXPECT_EQ(pool.available(), 0);
+  alloc.deallocate(q, 1);
+
+  pool.Shrink();
+  EXPECT_EQ(pool.available(), 0);
+}
+
+TEST(NodePool, ArrayAllocationsBypassThePool) {
+  NodePool pool;
+  NodePoolAllocator<int64_t> alloc(&pool);
+
+  int64_t* p = alloc.allocate(16);
+  alloc.deallocate(p, 16);
+  EXPECT_EQ(pool.available(), 0);
+  EXPECT_EQ(pool.block_size(), 0);
+}
+
+TEST(NodePoolAllocator, ComparisonAndRebind) {
+  NodePool pool;
+  NodePoolAllocator<int64_t> a(&pool);
+  NodePoolAllocator<std::pair<const int, int>> b(a);
+  EXPECT_EQ(b.pool(), &pool);
+  EXPECT_TRUE(a == NodePoolAllocator<int64_t>(b));
+  EXPECT_TRUE(a != NodePoolAllocator<int64_t>());
+}
+
+TEST(NodePoolAllocator, NodeHashMapChurn) {
+  using Alloc = NodePoolAllocator<std::pair<const int, std::string>>;
+  NodePool pool;
+  absl::node_hash_map<int, std::string, absl::Hash<int>, std::equal_to<int>,
+                      Alloc>
+      m{Alloc(&pool)};
+
+  for (int i = 0; i < 100; ++i) m[i] = std::to_string(i);
+  EXPECT_EQ(pool.available(), 0);
+
+  for (int i = 0; i < 100; ++i) m.erase(i);
+  EXPECT_EQ(pool.available(), 100);
+
+  // Reinserting drains the free list instead of hitting the heap.
+  for (int i = 0; i < 100; ++i) m[i] = std::to_string(i);
+  EXPECT_EQ(pool.available(), 0);
+  EXPECT_EQ(m.size(), 100);
+  EXPECT_EQ(m[42], "42");
+
+  m.clear();
+  EXPECT_EQ(pool.available(), 100);
+  pool.Shrink();
+  EXPECT_EQ(pool.available(), 0);
+  EXPECT_TRUE(m.empty());
+}
+
+TEST(NodePoolAllocator, NodeHashSetChurn) {
+  using Alloc = NodePoolAllocator<std::string>;
+  NodePool pool;
+  absl::node_hash_set<std::string, absl::Hash<std::string>,
+                      std::equal_to<std::string>, Alloc>
+      s{Alloc(&pool)};
+
+  for (int i = 0; i < 50; ++i) s.insert(std::to_string(i));
+  for (int i = 0; i < 50; ++i) s.erase(std::to_string(i));
+  EXPECT_EQ(pool.available(), 50);
+  for (int i = 0; i < 50; ++i) s.insert(std::to_string(i));
+  EXPECT_EQ(pool.available(), 0);
+  EXPECT_EQ(s.size(), 50);
+}
+
+TEST(NodePoolAllocator, CopiedContainersShareThePool) {
+  using Alloc = NodePoolAllocator<std::pair<const int, int>>;
+  NodePool pool;
+  absl::node_hash_map<int, int, absl::Hash<int>, std::equal_to<int>, Alloc> m{
+      Alloc(&pool)};
+  for (int i = 0; i < 10; ++i) m[i] = i;
+
+  auto copy = m;
+  copy.clear();
+  EXPECT_EQ(pool.available(), 10);
+  m.clear();
+  EXPECT_EQ(pool.available(), 20);
+}
+
+}  // namespace
+}  // namespace container_internal
+ABSL_NAMESPACE_END
+}  // namespace absl
@@ -41,7 +41,11 @@ constexpr ctrl_t ZeroCtrlT() { return static_cast<ctrl_t>(0); }
 // This enables removing a branch in the hot path of find(). In order to ensure
 // that the control bytes are aligned to 16, we have 16 bytes before the control
 // bytes even though growth_info only needs 8.
-alignas(16) ABSL_CONST_INIT ABSL_DLL const ctrl_t kEmptyGroup[32] = {
+// The sentinel is followed by a full group of empty bytes so that a group
+// load from the sentinel is valid for the widest supported group
+// (GroupAvx512Impl, 64 bytes), regardless of which group implementation was
+// selected at compile time.
+alignas(16) ABSL_CONST_INIT ABSL_DLL const ctrl_t kEmptyGroup[80] = {
     ZeroCtrlT(),       ZeroCtrlT(),    ZeroCtrlT(),    ZeroCtrlT(),
     ZeroCtrlT(),       ZeroCtrlT(),    ZeroCtrlT(),    ZeroCtrlT(),
     ZeroCtrlT(),       ZeroCtrlT(),    ZeroCtrlT(),    ZeroCtrlT(),
@@ -49,18 +53,43 @@ alignas(16) ABSL_CONST_INIT ABSL_DLL const ctrl_t kEmptyGroup[32] = {
     ctrl_t::kSentinel, ctrl_t::kEmpty, ctrl_t::kEmpty, ctrl_t::kEmpty,
     ctrl_t::kEmpty,    ctrl_t::kEmpty, ctrl_t::kEmpty, ctrl_t::kEmpty,
     ctrl_t::kEmpty,    ctrl_t::kEmpty, ctrl_t::kEmpty, ctrl_t::kEmpty,
+    ctrl_t::kEmpty,    ctrl_t::kEmpty, ctrl_t::kEmpty, ctrl_t::kEmpty,
+    ctrl_t::kEmpty,    ctrl_t::kEmpty, ctrl_t::kEmpty, ctrl_t::kEmpty,
+    ctrl_t::kEmpty,    ctrl_t::kEmpty, ctrl_t::kEmpty, ctrl_t::kEmpty,
+    ctrl_t::kEmpty,    ctrl_t::kEmpty, ctrl_t::kEmpty, ctrl_t::kEmpty,
+    ctrl_t::kEmpty,    ctrl_t::kEmpty, ctrl_t::kEmpty, ctrl_t::kEmpty,
+    ctrl_t::kEmpty,    ctrl_t::kEmpty, ctrl_t::kEmpty, ctrl_t::kEmpty,
+    ctrl_t::kEmpty,    ctrl_t::kEmpty, ctrl_t::kEmpty, ctrl_t::kEmpty,
+    ctrl_t::kEmpty,    ctrl_t::kEmpty, ctrl_t::kEmpty, ctrl_t::kEmpty,
+    ctrl_t::kEmpty,    ctrl_t::kEmpty, ctrl_t::kEmpty, ctrl_t::kEmpty,
+    ctrl_t::kEmpty,    ctrl_t::kEmpty, ctrl_t::kEmpty, ctrl_t::kEmpty,
+    ctrl_t::kEmpty,    ctrl_t::kEmpty, ctrl_t::kEmpty, ctrl_t::kEmpty,
+    ctrl_t::kEmpty,    ctrl_t::kEmpty, ctrl_t::kEmpty, ctrl_t::kEmpty,
     ctrl_t::kEmpty,    ctrl_t::kEmpty, ctrl_t::kEmpty, ctrl_t::kEmpty};
 
 // We need one full byte followed by a sentinel byte for iterator::operator++ to
 // work. We have a full group after kSentinel to be safe (in case operator++ is
-// changed to read a full group).
-ABSL_CONST_INIT ABSL_DLL const ctrl_t kSooControl[17] = {
+// changed to read a full group). As with kEmptyGroup, the array is sized for
+// the widest supported group.
+ABSL_CONST_INIT ABSL_DLL const ctrl_t kSooControl[66] = {
     ZeroCtrlT(),    ctrl_t::kSentinel, ZeroCtrlT(),    ctrl_t::kEmpty,
     ctrl_t::kEmpty, ctrl_t::kEmpty,    ctrl_t::kEmpty, ctrl_t::kEmpty,
     ctrl_t::kEmpty, ctrl_t::kEmpty,    ctrl_t::kEmpty, ctrl_t::kEmpty,
     ctrl_t::kEmpty, ctrl_t::kEmpty,    ctrl_t::kEmpty, ctrl_t::kEmpty,
-    ctrl_t::kEmpty};
-static_assert(NumControlBytes(SooCapacity()) <= 17,
+    ctrl_t::kEmpty, ctrl_t::kEmpty,    ctrl_t::kEmpty, ctrl_t::kEmpty,
+    ctrl_t::kEmpty, ctrl_t::kEmpty,    ctrl_t::kEmpty, ctrl_t::kEmpty,
+    ctrl_t::kEmpty, ctrl_t::kEmpty,    ctrl_t::kEmpty, ctrl_t::kEmpty,
+    ctrl_t::kEmpty, ctrl_t::kEmpty,    ctrl_t::kEmpty, ctrl_t::kEmpty,
+    ctrl_t::kEmpty, ctrl_t::kEmpty,    ctrl_t::kEmpty, ctrl_t::kEmpty,
+    ctrl_t::kEmpty, ctrl_t::kEmpty,    ctrl_t::kEmpty, ctrl_t::kEmpty,
+    ctrl_t::kEmpty, ctrl_t::kEmpty,    ctrl_t::kEmpty, ctrl_t::kEmpty,
+    ctrl_t::kEmpty, ctrl_t::kEmpty,    ctrl_t::kEmpty, ctrl_t::kEmpty,
+    ctrl_t::kEmpty, ctrl_t::kEmpty,    ctrl_t::kEmpty, ctrl_t::kEmpty,
+    ctrl_t::kEmpty, ctrl_t::kEmpty,    ctrl_t::kEmpty, ctrl_t::kEmpty,
+    ctrl_t::kEmpty, ctrl_t::kEmpty,    ctrl_t::kEmpty, ctrl_t::kEmpty,
+    ctrl_t::kEmpty, ctrl_t::kEmpty,    ctrl_t::kEmpty, ctrl_t::kEmpty,
+    ctrl_t::kEmpty, ctrl_t::kEmpty};
+static_assert(NumControlBytes(SooCapacity()) <= 66,
               "kSooControl capacity too small");
 
 #ifdef ABSL_INTERNAL_NEED_REDUNDANT_CONSTEXPR_DECL
@@ -286,7 +315,7 @@ void DropDeletesWithoutResize(CommonFields& common,
       slot_ptr = PrevSlot(slot_ptr, slot_size);
     }
   }
-  ResetGrowthLeft(common);
+  ResetGrowthLeft(common, policy.growth_shift);
   common.infoz().RecordRehash(total_probe_length);
 }
 
@@ -307,6 +336,23 @@ static bool WasNeverFull(CommonFields& c, size_t index) {
              Group::kWidth;
 }
 
+// Returns true if the probe sequence for `hash` reaches the group window
+// containing `target` no later than the window containing `current`. An
+// element with this hash stored at `current` can then be moved to `target`
+// without becoming unreachable: a lookup for it still visits `target`'s
+// window on the way.
+bool ProbeReachesFirst(const CommonFields& c, size_t hash, size_t target,
+                       size_t current) {
+  const size_t mask = c.capacity();
+  auto seq = probe(c, hash);
+  while (true) {
+    if (((target - seq.offset()) & mask) < Group::kWidth) return true;
+    if (((current - seq.offset()) & mask) < Group::kWidth) return false;
+    seq.next();
+    assert(seq.index() <= mask && "full table!");
+  }
+}
+
 }  // namespace
 
 void EraseMetaOnly(CommonFields& c, size_t index, size_t slot_size) {
@@ -324,13 +370,98 @@ void EraseMetaOnly(CommonFields& c, size_t index, size_t slot_size) {
   SetCtrl(c, index, ctrl_t::kDeleted, slot_size);
 }
 
+size_t BulkEraseGroupMetaOnly(CommonFields& c, size_t group_index,
+                              uint64_t erased, size_t slot_size) {
+  size_t num_tombstones = 0;
+  // Clearing the bytes in slot order keeps the result identical to erasing
+  // the same elements one at a time: each `WasNeverFull()` query observes the
+  // already-cleared bytes of the earlier erasures in this group.
+  for (; erased != 0; erased &= erased - 1) {
+    const size_t index = group_index + TrailingZeros(erased);
+    assert(IsFull(c.control()[index]) && "erasing a dangling iterator");
+    if (WasNeverFull(c, index)) {
+      SetCtrl(c, index, ctrl_t::kEmpty, slot_size);
+    } else {
+      SetCtrl(c, index, ctrl_t::kDeleted, slot_size);
+      ++num_tombstones;
+    }
+  }
+  return num_tombstones;
+}
+
+void EraseMetaOnlyWithBackshift(CommonFields& c, size_t index,
+                                const PolicyFunctions& policy) {
+  assert(IsFull(c.control()[index]) && "erasing a dangling iterator");
+  c.decrement_size();
+  c.infoz().RecordErase();
+
+  ctrl_t* ctrl = c.control();
+  void* set = &c;
+  void* slot_array = c.slot_array();
+  const size_t capacity = c.capacity();
+  const size_t slot_size = policy.slot_size;
+  const void* hash_fn = policy.hash_fn(c);
+
+  // Bounds the number of relocations per erase. Each relocation hashes the
+  // occupied slots in a two-group window looking for an element that can be
+  // shifted back, so this keeps the worst-case extra work per erase to a
+  // small constant.
+  constexpr size_t kMaxShifts = 4;
+
+  size_t hole = index;
+  for (size_t shifts = 0;; ++shifts) {
+    if (WasNeverFull(c, hole)) {
+      SetCtrl(c, hole, ctrl_t::kEmpty, slot_size);
+      c.growth_info().OverwriteFullAsEmpty();
+      if (hole != index) c.increment_generation();
+      return;
+    }
+    if (shifts == kMaxShifts) break;
+    // Look for an element after the hole whose probe sequence visits the
+    // hole's window no later than its current slot. Moving it back keeps it
+    // reachable and re-creates the hole in its slot, which tends to sit in a
+    // sparser neighborhood (that is why the element overflowed there), where
+    // the hole can be marked empty. A hole can never be marked empty while
+    // it is inside a contiguous run of `Group::kWidth` occupied slots, so
+    // scan from the far end of a two-group window to favor candidates that
+    // move the hole out of its run entirely.
+    size_t found = 0;
+    size_t found_hash = 0;
+    bool have_found = false;
+    for (size_t d = 2 * Group::kWidth - 1; d != 0; --d) {
+      const size_t j = (hole + d) & capacity;
+      if (!IsFull(ctrl[j])) continue;
+      const size_t hash =
+          (*policy.hash_slot)(hash_fn, SlotAddress(slot_array, j, slot_size));
+      if (ProbeReachesFirst(c, hash, hole, j)) {
+        found = j;
+        found_hash = hash;
+        have_found = true;
+        break;
+      }
+    }
+    if (!have_found) break;
+    // SetCtrl unpoisons the destination slot, so call it before the
+    // transfer.
+    SetCtrl(c, hole, H2(found_hash), slot_size);
+    (*policy.transfer)(set, SlotAddress(slot_array, hole, slot_size),
+                       SlotAddress(slot_array, found, slot_size));
+    hole = found;
+  }
+
+  // The hole's neighborhood could not be cleared; leave a tombstone.
+  SetCtrl(c, hole, ctrl_t::kDeleted, slot_size);
+  c.growth_info().OverwriteFullAsDeleted();
+  if (hole != index) c.increment_generation();
+}
+
 void ClearBackingArray(CommonFields& c, const PolicyFunctions& policy,
                        bool reuse, bool soo_enabled) {
   c.set_size(0);
   if (reuse) {
     assert(!soo_enabled || c.capacity() > SooCapacity());
     ResetCtrl(c, policy.slot_size);
-    ResetGrowthLeft(c);
+    ResetGrowthLeft(c, policy.growth_shift);
     c.infoz().RecordStorageChanged(0, c.capacity());
   } else {
     // We need to record infoz before calling dealloc, which will unregister
@@ -345,6 +476,31 @@ void ClearBackingArray(CommonFields& c, const PolicyFunctions& policy,
 void HashSetResizeHelper::GrowIntoSingleGroupShuffleControlBytes(
     ctrl_t* __restrict new_ctrl, size_t new_capacity) const {
   assert(is_single_group(new_capacity));
+#ifdef ABSL_INTERNAL_RAW_HASH_SET_HAVE_AVX512_GROUP
+  // For 64-byte groups the shuffled window does not fit into a uint64_t, so
+  // we use a scalar version of the shuffle described below: the control bytes
+  // (including the sentinel, which becomes kEmpty) are rotated by
+  // `half_old_capacity + 1` positions, matching the `i ^ shuffle_bit` slot
+  // relocation in GrowSizeIntoSingleGroup. Single-group tables are at most
+  // kWidth slots, so the loops below are short.
+  const size_t half_old_capacity = old_capacity_ / 2;
+  assert(old_capacity_ < Group::kWidth / 2);
+  for (size_t i = 0; i != old_capacity_ + 1; ++i) {
+    ctrl_t c = old_ctrl()[(half_old_capacity + 1 + i) % (old_capacity_ + 1)];
+    if (c == ctrl_t::kSentinel) c = ctrl_t::kEmpty;
+    new_ctrl[i] = c;
+  }
+  std::memset(new_ctrl + old_capacity_ + 1,
+              static_cast<int8_t>(ctrl_t::kEmpty),
+              NumControlBytes(new_capacity) - old_capacity_ - 1);
+  // Set the cloned control bytes. Only positions [0, old_capacity_] can be
+  // non-empty; the cloned bytes for the remaining positions were just set to
+  // kEmpty above. A loop is used because source and destination may overlap.
+  for (size_t i = 0; i != old_capacity_ + 1; ++i) {
+    new_ctrl[new_capacity + 1 + i] = new_ctrl[i];
+  }
+  new_ctrl[new_capacity] = ctrl_t::kSentinel;
+#else   // ABSL_INTERNAL_RAW_HASH_SET_HAVE_AVX512_GROUP
   constexpr size_t kHalfWidth = Group::kWidth / 2;
   constexpr size_t kQuarterWidth = Group::kWidth / 4;
   assert(old_capacity_ < kHalfWidth);
@@ -464,6 +620,7 @@ void HashSetResizeHelper::GrowIntoSingleGroupShuffleControlBytes(
 
   // Finally, we set the new sentinel byte.
   new_ctrl[new_capacity] = ctrl_t::kSentinel;
+#endif  // ABSL_INTERNAL_RAW_HASH_SET_HAVE_AVX512_GROUP
 }
 
 void HashSetResizeHelper::InitControlBytesAfterSoo(ctrl_t* new_ctrl, ctrl_t h2,
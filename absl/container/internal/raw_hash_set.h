@@ -202,6 +202,7 @@
 #include "absl/base/config.h"
 #include "absl/base/internal/endian.h"
 #include "absl/base/internal/raw_logging.h"
+#include "absl/base/internal/sysinfo.h"
 #include "absl/base/macros.h"
 #include "absl/base/optimization.h"
 #include "absl/base/options.h"
@@ -216,6 +217,8 @@
 #include "absl/memory/memory.h"
 #include "absl/meta/type_traits.h"
 #include "absl/numeric/bits.h"
+#include "absl/synchronization/blocking_counter.h"
+#include "absl/types/span.h"
 #include "absl/utility/utility.h"
 
 #ifdef ABSL_INTERNAL_HAVE_SSE2
@@ -234,6 +237,25 @@
 #include <arm_neon.h>
 #endif
 
+// ABSL_SWISSTABLE_ENABLE_AVX512_GROUP is an opt-in that widens the probe
+// group from 16 control bytes (SSE2) to a full 64-byte cache line using
+// AVX-512BW mask comparisons. Wider groups reduce the average number of probe
+// iterations for large tables at the cost of slightly higher per-probe
+// latency.
+//
+// The group width determines the hashtable memory layout, so this macro must
+// be defined consistently in every translation unit that includes this
+// header, *including when building Abseil itself*. Defining it in only some
+// translation units results in ODR violations and memory corruption.
+#ifdef ABSL_SWISSTABLE_ENABLE_AVX512_GROUP
+#if defined(__AVX512BW__)
+#include <immintrin.h>
+#define ABSL_INTERNAL_RAW_HASH_SET_HAVE_AVX512_GROUP 1
+#else
+#error "ABSL_SWISSTABLE_ENABLE_AVX512_GROUP requires AVX-512BW (-mavx512bw)."
+#endif
+#endif
+
 namespace absl {
 ABSL_NAMESPACE_BEGIN
 namespace container_internal {
@@ -533,8 +555,8 @@ static_assert(ctrl_t::kDeleted == static_cast<ctrl_t>(-2),
               "ctrl_t::kDeleted must be -2 to make the implementation of "
               "ConvertSpecialToEmptyAndFullToDeleted efficient");
 
-// See definition comment for why this is size 32.
-ABSL_DLL extern const ctrl_t kEmptyGroup[32];
+// See definition comment for why this is size 80.
+ABSL_DLL extern const ctrl_t kEmptyGroup[80];
 
 // Returns a pointer to a control byte group that can be used by empty tables.
 inline ctrl_t* EmptyGroup() {
@@ -546,7 +568,7 @@ inline ctrl_t* EmptyGroup() {
 // For use in SOO iterators.
 // TODO(b/289225379): we could potentially get rid of this by adding an is_soo
 // bit in iterators. This would add branches but reduce cache misses.
-ABSL_DLL extern const ctrl_t kSooControl[17];
+ABSL_DLL extern const ctrl_t kSooControl[66];
 
 // Returns a pointer to a full byte followed by a sentinel byte.
 inline ctrl_t* SooControl() {
@@ -753,6 +775,70 @@ struct GroupSse2Impl {
 };
 #endif  // ABSL_INTERNAL_RAW_HASH_SET_HAVE_SSE2
 
+#ifdef ABSL_INTERNAL_RAW_HASH_SET_HAVE_AVX512_GROUP
+// A 64-byte group that probes an entire cache line of control bytes per
+// iteration. AVX-512BW comparisons produce the bitmask directly in a mask
+// register, so no movemask step is needed.
+struct GroupAvx512Impl {
+  static constexpr size_t kWidth = 64;  // the number of slots per group
+
+  explicit GroupAvx512Impl(const ctrl_t* pos) {
+    ctrl = _mm512_loadu_si512(pos);
+  }
+
+  // Returns a bitmask representing the positions of slots that match hash.
+  BitMask<uint64_t, kWidth> Match(h2_t hash) const {
+    return BitMask<uint64_t, kWidth>(_mm512_cmpeq_epi8_mask(
+        _mm512_set1_epi8(static_cast<char>(hash)), ctrl));
+  }
+
+  // Returns a bitmask representing the positions of empty slots.
+  NonIterableBitMask<uint64_t, kWidth> MaskEmpty() const {
+    return NonIterableBitMask<uint64_t, kWidth>(_mm512_cmpeq_epi8_mask(
+        _mm512_set1_epi8(static_cast<char>(ctrl_t::kEmpty)), ctrl));
+  }
+
+  // Returns a bitmask representing the positions of full slots.
+  // Note: for `is_small()` tables group may contain the "same" slot twice:
+  // original and mirrored.
+  BitMask<uint64_t, kWidth> MaskFull() const {
+    return BitMask<uint64_t, kWidth>(~_mm512_movepi8_mask(ctrl));
+  }
+
+  // Returns a bitmask representing the positions of non full slots.
+  // Note: this includes: kEmpty, kDeleted, kSentinel.
+  // It is useful in contexts when kSentinel is not present.
+  auto MaskNonFull() const {
+    return BitMask<uint64_t, kWidth>(_mm512_movepi8_mask(ctrl));
+  }
+
+  // Returns a bitmask representing the positions of empty or deleted slots.
+  NonIterableBitMask<uint64_t, kWidth> MaskEmptyOrDeleted() const {
+    return NonIterableBitMask<uint64_t, kWidth>(_mm512_cmpgt_epi8_mask(
+        _mm512_set1_epi8(static_cast<char>(ctrl_t::kSentinel)), ctrl));
+  }
+
+  // Returns the number of trailing empty or deleted elements in the group.
+  uint32_t CountLeadingEmptyOrDeleted() const {
+    const uint64_t mask = _mm512_cmpgt_epi8_mask(
+        _mm512_set1_epi8(static_cast<char>(ctrl_t::kSentinel)), ctrl);
+    // countr_zero is well defined for 0, which happens when all kWidth bytes
+    // are empty or deleted and `mask + 1` overflows to 0.
+    return static_cast<uint32_t>(countr_zero(mask + 1));
+  }
+
+  void ConvertSpecialToEmptyAndFullToDeleted(ctrl_t* dst) const {
+    const __mmask64 special = _mm512_movepi8_mask(ctrl);
+    _mm512_storeu_si512(
+        dst, _mm512_mask_blend_epi8(
+                 special, _mm512_set1_epi8(static_cast<char>(ctrl_t::kDeleted)),
+                 _mm512_set1_epi8(static_cast<char>(ctrl_t::kEmpty))));
+  }
+
+  __m512i ctrl;
+};
+#endif  // ABSL_INTERNAL_RAW_HASH_SET_HAVE_AVX512_GROUP
+
 #if defined(ABSL_INTERNAL_HAVE_ARM_NEON) && defined(ABSL_IS_LITTLE_ENDIAN)
 struct GroupAArch64Impl {
   static constexpr size_t kWidth = 8;
@@ -904,7 +990,10 @@ struct GroupPortableImpl {
   uint64_t ctrl;
 };
 
-#ifdef ABSL_INTERNAL_HAVE_SSE2
+#ifdef ABSL_INTERNAL_RAW_HASH_SET_HAVE_AVX512_GROUP
+using Group = GroupAvx512Impl;
+using GroupFullEmptyOrDeleted = GroupAvx512Impl;
+#elif defined(ABSL_INTERNAL_HAVE_SSE2)
 using Group = GroupSse2Impl;
 using GroupFullEmptyOrDeleted = GroupSse2Impl;
 #elif defined(ABSL_INTERNAL_HAVE_ARM_NEON) && defined(ABSL_IS_LITTLE_ENDIAN)
@@ -1103,6 +1192,9 @@ class GrowthInfo {
   // Overwrites single full slot with an empty slot.
   void OverwriteFullAsEmpty() { ++growth_left_info_; }
 
+  // Overwrites several full slots with empty slots.
+  void OverwriteManyFullAsEmpty(size_t cnt) { growth_left_info_ += cnt; }
+
   // Overwrites single empty slot with a full slot.
   void OverwriteEmptyAsFull() {
     assert(GetGrowthLeft() > 0);
@@ -1512,16 +1604,32 @@ inline size_t NormalizeCapacity(size_t n) {
 //   never need to probe (the whole table fits in one group) so we don't need a
 //   load factor less than 1.
 
+// The default number of bits by which `capacity` is shifted to compute the
+// number of slots kept empty at maximum load; i.e. the default maximum load
+// factor is `1 - 1/2^3 == 7/8`. Hash policies may override this per
+// instantiation by declaring `static constexpr size_t kGrowthShift`; see
+// `GrowthShift()` below.
+inline constexpr size_t kDefaultGrowthShift = 3;
+
 // Given `capacity`, applies the load factor; i.e., it returns the maximum
 // number of values we should put into the table before a resizing rehash.
-inline size_t CapacityToGrowth(size_t capacity) {
+// `growth_shift` selects the maximum load factor `1 - 1/2^growth_shift`.
+inline size_t CapacityToGrowth(size_t capacity,
+                               size_t growth_shift = kDefaultGrowthShift) {
   assert(IsValidCapacity(capacity));
-  // `capacity*7/8`
-  if (Group::kWidth == 8 && capacity == 7) {
-    // x-x/8 does not work when x==7.
-    return 6;
-  }
-  return capacity - capacity / 8;
+  if (capacity + 1 < Group::kWidth) {
+    // The whole table fits in one group, so it can be filled completely; see
+    // the growth notes above. This is a no-op for 8- and 16-wide groups, where
+    // `x - x/8 == x` for all single-group capacities, but matters for wider
+    // (AVX-512) groups.
+    return capacity;
+  }
+  const size_t growth = capacity - (capacity >> growth_shift);
+  // Multi-group tables must keep at least one empty slot, or probes for
+  // absent keys would not terminate. This triggers for the smallest
+  // multi-group capacities, where `capacity >> growth_shift` rounds to zero
+  // (e.g. capacity 7 with 8-wide groups at the default shift).
+  return growth == capacity ? capacity - 1 : growth;
 }
 
 // Given `growth`, "unapplies" the load factor to find how large the capacity
@@ -1529,13 +1637,42 @@ inline size_t CapacityToGrowth(size_t capacity) {
 //
 // This might not be a valid capacity and `NormalizeCapacity()` should be
 // called on this.
-inline size_t GrowthToLowerboundCapacity(size_t growth) {
-  // `growth*8/7`
-  if (Group::kWidth == 8 && growth == 7) {
-    // x+(x-1)/7 does not work when x==7.
-    return 8;
-  }
-  return growth + static_cast<size_t>((static_cast<int64_t>(growth) - 1) / 7);
+inline size_t GrowthToLowerboundCapacity(
+    size_t growth, size_t growth_shift = kDefaultGrowthShift) {
+  if (growth < Group::kWidth / 2) {
+    // Inverse of the single-group case in `CapacityToGrowth()`: normalizing
+    // `growth` yields a capacity below `Group::kWidth - 1`, which can be
+    // filled completely.
+    return growth;
+  }
+  // `growth * 2^shift / (2^shift - 1)`
+  const size_t capacity =
+      growth + (growth - 1) / ((size_t{1} << growth_shift) - 1);
+  // Inverse of the at-least-one-empty-slot case in `CapacityToGrowth()`.
+  return (capacity >> growth_shift) == 0 ? capacity + 1 : capacity;
+}
+
+template <class Policy, class = void>
+struct GrowthShiftImpl
+    : std::integral_constant<size_t, kDefaultGrowthShift> {};
+
+template <class Policy>
+struct GrowthShiftImpl<Policy, absl::void_t<decltype(Policy::kGrowthShift)>>
+    : std::integral_constant<size_t, Policy::kGrowthShift> {};
+
+// Returns the growth shift to use for tables with the given hash `Policy`:
+// the policy's `kGrowthShift` if it declares one, `kDefaultGrowthShift`
+// otherwise. Policies that tolerate longer probe sequences in exchange for
+// memory (or vice versa) can tune their maximum load factor this way without
+// any per-instance cost; the shift is a compile-time property of the table
+// type.
+template <class Policy>
+constexpr size_t GrowthShift() {
+  static_assert(GrowthShiftImpl<Policy>::value >= 1 &&
+                    GrowthShiftImpl<Policy>::value <= 6,
+                "Policy::kGrowthShift must be in [1, 6]; i.e. maximum load "
+                "factors from 1/2 to 63/64.");
+  return GrowthShiftImpl<Policy>::value;
 }
 
 template <class InputIter>
@@ -1786,9 +1923,9 @@ extern template FindInfo find_first_non_full(const CommonFields&, size_t);
 // performance critical routines.
 FindInfo find_first_non_full_outofline(const CommonFields&, size_t);
 
-inline void ResetGrowthLeft(CommonFields& common) {
+inline void ResetGrowthLeft(CommonFields& common, size_t growth_shift) {
   common.growth_info().InitGrowthLeftNoDeleted(
-      CapacityToGrowth(common.capacity()) - common.size());
+      CapacityToGrowth(common.capacity(), growth_shift) - common.size());
 }
 
 // Sets `ctrl` to `{kEmpty, kSentinel, ..., kEmpty}`, marking the entire
@@ -1872,20 +2009,29 @@ ABSL_ATTRIBUTE_ALWAYS_INLINE inline void IterateOverFullSlots(
     // first group (starting from position 0). We are taking group from position
     // `capacity` in order to avoid duplicates.
 
-    // Small tables capacity fits into portable group, where
-    // GroupPortableImpl::MaskFull is more efficient for the
-    // capacity <= GroupPortableImpl::kWidth.
-    assert(cap <= GroupPortableImpl::kWidth &&
-           "unexpectedly large small capacity");
     static_assert(Group::kWidth >= GroupPortableImpl::kWidth,
                   "unexpected group width");
     // Group starts from kSentinel slot, so indices in the mask will
     // be increased by 1.
-    const auto mask = GroupPortableImpl(ctrl + cap).MaskFull();
-    --ctrl;
-    --slot;
-    for (uint32_t i : mask) {
-      cb(ctrl + i, slot + i);
+    if (cap <= GroupPortableImpl::kWidth) {
+      // Small tables capacity fits into portable group, where
+      // GroupPortableImpl::MaskFull is more efficient for the
+      // capacity <= GroupPortableImpl::kWidth.
+      const auto mask = GroupPortableImpl(ctrl + cap).MaskFull();
+      --ctrl;
+      --slot;
+      for (uint32_t i : mask) {
+        cb(ctrl + i, slot + i);
+      }
+    } else {
+      // With wider groups (AVX-512), small tables can exceed the portable
+      // group width, so read a full-width group instead.
+      const auto mask = GroupFullEmptyOrDeleted(ctrl + cap).MaskFull();
+      --ctrl;
+      --slot;
+      for (uint32_t i : mask) {
+        cb(ctrl + i, slot + i);
+      }
     }
     return;
   }
@@ -2037,7 +2183,8 @@ class HashSetResizeHelper {
   ABSL_ATTRIBUTE_NOINLINE bool InitializeSlots(CommonFields& c, Alloc alloc,
                                                ctrl_t soo_slot_h2,
                                                size_t key_size,
-                                               size_t value_size) {
+                                               size_t value_size,
+                                               size_t growth_shift) {
     assert(c.capacity());
     HashtablezInfoHandle infoz =
         ShouldSampleHashtablezInfo<Alloc>()
@@ -2056,7 +2203,7 @@ class HashSetResizeHelper {
     c.set_generation(NextGeneration(old_generation));
     c.set_control(reinterpret_cast<ctrl_t*>(mem + layout.control_offset()));
     c.set_slots(mem + layout.slot_offset());
-    ResetGrowthLeft(c);
+    ResetGrowthLeft(c, growth_shift);
 
     const bool grow_single_group =
         IsGrowingIntoSingleGroupApplicable(old_capacity_, layout.capacity());
@@ -2240,6 +2387,9 @@ size_t PrepareInsertAfterSoo(size_t hash, size_t slot_size,
 struct PolicyFunctions {
   size_t slot_size;
 
+  // The table's growth shift; see `GrowthShift()`.
+  size_t growth_shift;
+
   // Returns the pointer to the hash function stored in the set.
   const void* (*hash_fn)(const CommonFields& common);
 
@@ -2267,6 +2417,27 @@ void ClearBackingArray(CommonFields& c, const PolicyFunctions& policy,
 // Type-erased version of raw_hash_set::erase_meta_only.
 void EraseMetaOnly(CommonFields& c, size_t index, size_t slot_size);
 
+// Rewrites the control bytes for a group's worth of erasures at once:
+// `erased` is a bitmask of offsets within the group window starting at
+// `group_index` whose slots have already been destroyed. Each erased byte is
+// set to `kEmpty` when no probe sequence can have passed through the slot and
+// to `kDeleted` otherwise; the number of tombstones written is returned.
+// Unlike `EraseMetaOnly()`, size, growth info, and hashtablez accounting are
+// left to the caller, which settles them once for the whole sweep.
+size_t BulkEraseGroupMetaOnly(CommonFields& c, size_t group_index,
+                              uint64_t erased, size_t slot_size);
+
+// As `EraseMetaOnly()`, but performs backward-shift compaction instead of
+// leaving a tombstone: if the vacated slot cannot be marked empty, elements
+// from later in the collision run are moved back along their probe sequences
+// into the hole until it lands in a slot that can be. This bounds tombstone
+// accumulation in erase-heavy workloads at the cost of hashing a bounded
+// number of neighboring elements per erase. Because it relocates elements,
+// callers must treat iterators, pointers, and references to all elements as
+// invalidated.
+void EraseMetaOnlyWithBackshift(CommonFields& c, size_t index,
+                                const PolicyFunctions& policy);
+
 // Function to place in PolicyFunctions::dealloc for raw_hash_sets
 // that are using std::allocator. This allows us to share the same
 // function body for raw_hash_set instantiations that have the
@@ -2380,6 +2551,12 @@ class raw_hash_set {
            alignof(slot_type) <= alignof(HeapOrSoo);
   }
 
+  // The growth shift of this table: how many bits `capacity` is shifted by
+  // to compute the number of slots kept empty at maximum load. Policies may
+  // override the default (3, i.e. a 7/8 maximum load factor) by declaring
+  // `kGrowthShift`; see `GrowthShift()`.
+  static constexpr size_t kGrowthShift = GrowthShift<Policy>();
+
   // Whether `size` fits in the SOO capacity of this table.
   bool fits_in_soo(size_t size) const {
     return SooEnabled() && size <= SooCapacity();
@@ -2718,8 +2895,8 @@ class raw_hash_set {
                                that.alloc_ref())) {}
 
   raw_hash_set(const raw_hash_set& that, const allocator_type& a)
-      : raw_hash_set(GrowthToLowerboundCapacity(that.size()), that.hash_ref(),
-                     that.eq_ref(), a) {
+      : raw_hash_set(GrowthToLowerboundCapacity(that.size(), kGrowthShift),
+                     that.hash_ref(), that.eq_ref(), a) {
     const size_t size = that.size();
     if (size == 0) {
       return;
@@ -2970,6 +3147,24 @@ class raw_hash_set {
     for (; first != last; ++first) emplace(*first);
   }
 
+  // Extension API: bulk insertion of a range of elements.
+  //
+  // Behaves like `insert(first, last)` except that when the size of the range
+  // can be computed up front (i.e. the iterators are at least forward
+  // iterators), the table is grown once for the whole range before any
+  // element is inserted. This avoids the repeated rehashes that per-element
+  // insertion performs while growing and leaves the growth check in the
+  // insertion loop as a never-taken branch. The pre-sizing assumes all keys
+  // in the range are distinct; ranges with many duplicate keys may leave the
+  // table larger than `reserve(size())` would.
+  template <class InputIt>
+  void insert_range(InputIt first, InputIt last) {
+    prepare_insert_range(
+        first, last,
+        typename std::iterator_traits<InputIt>::iterator_category());
+    for (; first != last; ++first) emplace(*first);
+  }
+
   template <class T, RequiresNotInit<T> = 0, RequiresInsertable<const T&> = 0>
   void insert(std::initializer_list<T> ilist) {
     insert(ilist.begin(), ilist.end());
@@ -3140,6 +3335,30 @@ class raw_hash_set {
     }
   }
 
+  // Erases the element at `position` like `erase()`, but compacts the
+  // vacated slot's neighborhood instead of leaving a tombstone behind
+  // ("backward-shift deletion"). Tombstones lengthen every probe sequence
+  // that crosses them and are otherwise reclaimed all at once by an in-place
+  // rehash when an insertion finds the table too full; erase-heavy workloads
+  // can use this overload to spread that cost over the erases instead,
+  // paying a bounded amount of extra hashing per call.
+  //
+  // Unlike `erase()`, this may relocate other elements, so it invalidates
+  // iterators, pointers, and references to all elements of the table, not
+  // just the erased one.
+  void erase_and_compact(const_iterator position) {
+    AssertIsFull(position.control(), position.inner_.generation(),
+                 position.inner_.generation_ptr(), "erase_and_compact()");
+    destroy(position.slot());
+    if (is_soo()) {
+      common().set_empty_soo();
+    } else {
+      EraseMetaOnlyWithBackshift(
+          common(), static_cast<size_t>(position.control() - control()),
+          GetPolicyFunctions());
+    }
+  }
+
   iterator erase(const_iterator first,
                  const_iterator last) ABSL_ATTRIBUTE_LIFETIME_BOUND {
     // We check for empty first because ClearBackingArray requires that
@@ -3261,7 +3480,8 @@ class raw_hash_set {
 
     // bitor is a faster way of doing `max` here. We will round up to the next
     // power-of-2-minus-1, so bitor is good enough.
-    auto m = NormalizeCapacity(n | GrowthToLowerboundCapacity(size()));
+    auto m = NormalizeCapacity(n |
+                               GrowthToLowerboundCapacity(size(), kGrowthShift));
     // n == 0 unconditionally rehashes as per the standard.
     if (n == 0 || m > cap) {
       resize(m);
@@ -3276,7 +3496,7 @@ class raw_hash_set {
     const size_t max_size_before_growth =
         is_soo() ? SooCapacity() : size() + growth_left();
     if (n > max_size_before_growth) {
-      size_t m = GrowthToLowerboundCapacity(n);
+      size_t m = GrowthToLowerboundCapacity(n, kGrowthShift);
       resize(NormalizeCapacity(m));
 
       // This is after resize, to ensure that we have completed the allocation
@@ -3319,6 +3539,27 @@ class raw_hash_set {
 #endif  // ABSL_HAVE_PREFETCH
   }
 
+  // Looks up every key in `keys` and writes the resulting iterator (or
+  // `end()`) to the corresponding element of `results`.
+  //
+  // Lookups are software-pipelined in small windows: every key in a window is
+  // hashed and its first probe group prefetched before any probing starts, so
+  // that the cache misses of independent lookups overlap instead of
+  // serializing on the hash -> ctrl byte -> slot dependent-load chain. This is
+  // profitable when issuing many lookups against a table whose working set
+  // does not fit in cache.
+  //
+  // REQUIRES: `keys.size() == results.size()`.
+  template <class K = key_type>
+  void find_batch(absl::Span<const K> keys, absl::Span<iterator> results) {
+    find_batch_impl(keys, results);
+  }
+  template <class K = key_type>
+  void find_batch(absl::Span<const K> keys,
+                  absl::Span<const_iterator> results) const {
+    const_cast<raw_hash_set*>(this)->find_batch_impl(keys, results);
+  }
+
   // The API of find() has two extensions.
   //
   // 1. The hash can be passed by the user. It must be equal to the hash of the
@@ -3376,6 +3617,59 @@ class raw_hash_set {
     return {it, it};
   }
 
+  // Invokes `fn` with a reference to every element of the table, partitioned
+  // across tasks scheduled on `executor`.  `executor` must provide
+  // `Schedule(absl::AnyInvocable<void()>)` (e.g. `absl::ThreadPool`).  Each
+  // task performs a linear scan over one contiguous, group-aligned slice of
+  // the backing array, so the work parallelizes without coordination between
+  // shards.  Blocks until every shard has finished.
+  //
+  // `fn` is invoked concurrently with itself and must be thread-safe.  As
+  // with iteration, `fn` may modify mapped values but not keys, and the table
+  // must not be mutated while the call is in flight.  `shards` limits the
+  // number of scheduled tasks; the default of zero schedules a small multiple
+  // of the number of CPUs, and tables too small to be worth splitting are
+  // scanned inline on the calling thread.
+  template <typename Executor, typename Callback>
+  void parallel_for_each(Executor& executor, Callback fn, size_t shards = 0) {
+    if (ABSL_PREDICT_FALSE(empty())) return;
+    if (is_soo()) {
+      fn(static_cast<reference>(PolicyTraits::element(soo_slot())));
+      return;
+    }
+    const size_t cap = capacity();
+    const size_t groups = cap / Group::kWidth + 1;
+    if (shards == 0) {
+      shards = static_cast<size_t>(base_internal::NumCPUs()) * 4;
+    }
+    shards = (std::min)(shards, groups);
+    if (shards <= 1) {
+      for_each_slot_range(0, cap, fn);
+      return;
+    }
+    absl::BlockingCounter done(static_cast<int>(shards));
+    for (size_t shard = 0; shard != shards; ++shard) {
+      // Divide the group index space evenly; the final shard also covers the
+      // trailing partial group.
+      const size_t begin = shard * groups / shards * Group::kWidth;
+      const size_t end =
+          (std::min)((shard + 1) * groups / shards * Group::kWidth, cap);
+      executor.Schedule([this, begin, end, &fn, &done] {
+        for_each_slot_range(begin, end, fn);
+        done.DecrementCount();
+      });
+    }
+    done.Wait();
+  }
+  template <typename Executor, typename Callback>
+  void parallel_for_each(Executor& executor, Callback fn,
+                         size_t shards = 0) const {
+    const_cast<raw_hash_set*>(this)->parallel_for_each(
+        executor,
+        [&fn](reference elem) { fn(static_cast<const_reference>(elem)); },
+        shards);
+  }
+
   size_t bucket_count() const { return capacity(); }
   float load_factor() const {
     return capacity() ? static_cast<double>(size()) / capacity() : 0.0;
@@ -3522,6 +3816,51 @@ class raw_hash_set {
     }
   }
 
+  // Shared implementation of the mutable and const `find_batch()` overloads.
+  // `ResultIter` is `iterator` or `const_iterator`.
+  template <class K, class ResultIter>
+  void find_batch_impl(absl::Span<const K> keys,
+                       absl::Span<ResultIter> results) {
+    assert(keys.size() == results.size());
+    if (SooEnabled() ? is_soo() : capacity() == 0) {
+      for (size_t i = 0; i < keys.size(); ++i) results[i] = find(keys[i]);
+      return;
+    }
+    prefetch_heap_block();
+    // The window is sized so that the in-flight hashes fit comfortably in
+    // registers/L1 while still overlapping enough misses to cover DRAM
+    // latency.
+    constexpr size_t kWindow = 8;
+    size_t hashes[kWindow];
+    for (size_t base = 0; base < keys.size(); base += kWindow) {
+      const size_t n = (std::min)(kWindow, keys.size() - base);
+      for (size_t i = 0; i < n; ++i) {
+        AssertHashEqConsistent(keys[base + i]);
+        hashes[i] = hash_ref()(keys[base + i]);
+#ifdef ABSL_HAVE_PREFETCH
+        auto seq = probe(common(), hashes[i]);
+        PrefetchToLocalCache(control() + seq.offset());
+        PrefetchToLocalCache(slot_array() + seq.offset());
+#endif  // ABSL_HAVE_PREFETCH
+      }
+      for (size_t i = 0; i < n; ++i) {
+        results[base + i] = find_non_soo(keys[base + i], hashes[i]);
+      }
+    }
+  }
+
+  // Grows the table once for the whole range before `insert_range()` starts
+  // inserting. Only enabled for forward iterators; for single-pass input
+  // iterators the range size is unknown and we fall back to growing as we go.
+  template <class ForwardIt>
+  void prepare_insert_range(ForwardIt first, ForwardIt last,
+                            std::forward_iterator_tag) {
+    const size_t n = static_cast<size_t>(std::distance(first, last));
+    if (n != 0) reserve(size() + n);
+  }
+  template <class InputIt>
+  void prepare_insert_range(InputIt, InputIt, std::input_iterator_tag) {}
+
   // Conditionally samples hashtablez for SOO tables. This should be called on
   // insertion into an empty SOO table and in copy construction when the size
   // can fit in SOO capacity.
@@ -3634,7 +3973,7 @@ class raw_hash_set {
                                       PolicyTraits::transfer_uses_memcpy(),
                                       SooEnabled(), alignof(slot_type)>(
             common, CharAlloc(set->alloc_ref()), soo_slot_h2, sizeof(key_type),
-            sizeof(value_type));
+            sizeof(value_type), kGrowthShift);
 
     // In the SooEnabled() case, capacity is never 0 so we don't check.
     if (!SooEnabled() && resize_helper.old_capacity() == 0) {
@@ -3968,6 +4307,19 @@ class raw_hash_set {
     assert(!is_soo());
     return static_cast<slot_type*>(common().slot_array());
   }
+  // Invokes `fn` on the full slots in `[begin, end)`.  Used by
+  // `parallel_for_each()`, whose shards scan disjoint slot ranges.
+  template <typename Callback>
+  void for_each_slot_range(size_t begin, size_t end, Callback& fn) {
+    const ctrl_t* ctrl = control();
+    slot_type* slot = slot_array();
+    for (size_t i = begin; i != end; ++i) {
+      if (IsFull(ctrl[i])) {
+        fn(static_cast<reference>(PolicyTraits::element(slot + i)));
+      }
+    }
+  }
+
   slot_type* soo_slot() {
     assert(is_soo());
     return static_cast<slot_type*>(common().soo_data());
@@ -4020,6 +4372,7 @@ class raw_hash_set {
   static const PolicyFunctions& GetPolicyFunctions() {
     static constexpr PolicyFunctions value = {
         sizeof(slot_type),
+        kGrowthShift,
         // TODO(b/328722020): try to type erase
         // for standard layout and alignof(Hash) <= alignof(CommonFields).
         std::is_empty<hasher>::value ? &GetHashRefForEmptyHasher
@@ -4064,17 +4417,62 @@ struct HashtableFreeFunctionsAccess {
     }
     ABSL_ATTRIBUTE_UNUSED const size_t original_size_for_assert = c->size();
     size_t num_deleted = 0;
-    IterateOverFullSlots(
-        c->common(), c->slot_array(), [&](const ctrl_t* ctrl, auto* slot) {
-          if (pred(Set::PolicyTraits::element(slot))) {
-            c->destroy(slot);
-            EraseMetaOnly(c->common(), static_cast<size_t>(ctrl - c->control()),
-                          sizeof(*slot));
-            ++num_deleted;
-          }
-        });
-    // NOTE: IterateOverFullSlots allow removal of the current element, so we
-    // verify the size additionally here.
+    if (is_small(c->capacity())) {
+      IterateOverFullSlots(
+          c->common(), c->slot_array(), [&](const ctrl_t* ctrl, auto* slot) {
+            if (pred(Set::PolicyTraits::element(slot))) {
+              c->destroy(slot);
+              EraseMetaOnly(c->common(),
+                            static_cast<size_t>(ctrl - c->control()),
+                            sizeof(*slot));
+              ++num_deleted;
+            }
+          });
+      // NOTE: IterateOverFullSlots allow removal of the current element, so we
+      // verify the size additionally here.
+      assert(original_size_for_assert - num_deleted == c->size() &&
+             "hash table was modified unexpectedly");
+      return num_deleted;
+    }
+    // Walk the control array a group at a time: evaluate the predicate over
+    // each group's full slots, destroy the matches, rewrite the group's
+    // control bytes in one call, and settle the size, growth info, and
+    // hashtablez accounting once at the end instead of per erasure.
+    CommonFields& common = c->common();
+    ctrl_t* ctrl = common.control();
+    auto* slot = c->slot_array();
+    size_t group_index = 0;
+    size_t remaining = c->size();
+    size_t num_tombstones = 0;
+    while (remaining != 0) {
+      // 64-bit so that every offset fits regardless of `Group::kWidth`.
+      uint64_t erased = 0;
+      for (uint32_t i : GroupFullEmptyOrDeleted(ctrl).MaskFull()) {
+        assert(IsFull(ctrl[i]) && "hash table was modified unexpectedly");
+        --remaining;
+        if (pred(Set::PolicyTraits::element(slot + i))) {
+          c->destroy(slot + i);
+          erased |= uint64_t{1} << i;
+        }
+      }
+      if (erased != 0) {
+        num_deleted += static_cast<size_t>(popcount(erased));
+        num_tombstones +=
+            BulkEraseGroupMetaOnly(common, group_index, erased, sizeof(*slot));
+      }
+      ctrl += Group::kWidth;
+      slot += Group::kWidth;
+      group_index += Group::kWidth;
+      assert((remaining == 0 || *(ctrl - 1) != ctrl_t::kSentinel) &&
+             "hash table was modified unexpectedly");
+    }
+    if (num_deleted != 0) {
+      common.set_size(common.size() - num_deleted);
+      common.growth_info().OverwriteManyFullAsEmpty(num_deleted -
+                                                    num_tombstones);
+      if (num_tombstones != 0) common.growth_info().OverwriteFullAsDeleted();
+      common.infoz().RecordErases(num_deleted);
+    }
     assert(original_size_for_assert - num_deleted == c->size() &&
            "hash table was modified unexpectedly");
     return num_deleted;
@@ -4144,6 +4542,19 @@ struct HashtableDebugAccess<Set, absl::void_t<typename Set::raw_hash_set>> {
     }
   }
 
+  // Returns the number of tombstones (kDeleted control bytes) in one pass
+  // over the control array.
+  static size_t GetNumDeleted(const Set& set) {
+    if (set.is_soo() || set.capacity() == 0) return 0;
+    const ctrl_t* ctrl = set.control();
+    const size_t capacity = set.capacity();
+    size_t num_deleted = 0;
+    for (size_t i = 0; i != capacity; ++i) {
+      if (IsDeleted(ctrl[i])) ++num_deleted;
+    }
+    return num_deleted;
+  }
+
   static size_t AllocatedByteSize(const Set& c) {
     size_t capacity = c.capacity();
     if (capacity == 0) return 0;
@@ -62,6 +62,7 @@
 #include "absl/meta/type_traits.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/string_view.h"
+#include "absl/types/span.h"
 
 namespace absl {
 ABSL_NAMESPACE_BEGIN
@@ -226,6 +227,30 @@ TEST(Util, GrowthAndCapacity) {
   }
 }
 
+TEST(Util, GrowthAndCapacityWithCustomShift) {
+  for (size_t shift = 1; shift <= 6; ++shift) {
+    for (size_t growth = 0; growth < 10000; ++growth) {
+      SCOPED_TRACE(absl::StrCat("shift=", shift, " growth=", growth));
+      size_t capacity =
+          NormalizeCapacity(GrowthToLowerboundCapacity(growth, shift));
+      // The capacity is large enough for `growth`.
+      EXPECT_THAT(CapacityToGrowth(capacity, shift), Ge(growth));
+      // Multi-group tables must keep at least one empty slot at every shift,
+      // or probes for absent keys would not terminate.
+      if (capacity + 1 >= Group::kWidth) {
+        EXPECT_THAT(CapacityToGrowth(capacity, shift), Lt(capacity));
+      }
+    }
+  }
+  // The default shift matches the unparameterized behavior.
+  for (size_t capacity = Group::kWidth - 1; capacity < 10000;
+       capacity = 2 * capacity + 1) {
+    SCOPED_TRACE(capacity);
+    EXPECT_EQ(CapacityToGrowth(capacity, kDefaultGrowthShift),
+              CapacityToGrowth(capacity));
+  }
+}
+
 TEST(Util, probe_seq) {
   probe_seq<16> seq(0, 127);
   auto gen = [&]() {
@@ -357,6 +382,18 @@ TEST(Group, Match) {
     EXPECT_THAT(Group{group}.Match(0), ElementsAre());
     EXPECT_THAT(Group{group}.Match(1), ElementsAre(1, 5, 7));
     EXPECT_THAT(Group{group}.Match(2), ElementsAre(2, 4));
+  } else if (Group::kWidth == 64) {
+    ctrl_t group[64];
+    std::fill(std::begin(group), std::end(group), ctrl_t::kEmpty);
+    group[1] = CtrlT(1);
+    group[5] = ctrl_t::kDeleted;
+    group[17] = ctrl_t::kSentinel;
+    group[30] = CtrlT(3);
+    group[50] = CtrlT(3);
+    group[63] = CtrlT(1);
+    EXPECT_THAT(Group{group}.Match(0), ElementsAre());
+    EXPECT_THAT(Group{group}.Match(1), ElementsAre(1, 63));
+    EXPECT_THAT(Group{group}.Match(3), ElementsAre(30, 50));
   } else {
     FAIL() << "No test coverage for Group::kWidth==" << Group::kWidth;
   }
@@ -376,6 +413,15 @@ TEST(Group, MaskEmpty) {
                       ctrl_t::kSentinel, CtrlT(1)};
     EXPECT_THAT(Group{group}.MaskEmpty().LowestBitSet(), 0);
     EXPECT_THAT(Group{group}.MaskEmpty().HighestBitSet(), 0);
+  } else if (Group::kWidth == 64) {
+    ctrl_t group[64];
+    std::fill(std::begin(group), std::end(group), ctrl_t::kEmpty);
+    group[1] = CtrlT(1);
+    group[5] = ctrl_t::kDeleted;
+    group[17] = ctrl_t::kSentinel;
+    group[63] = CtrlT(1);
+    EXPECT_THAT(Group{group}.MaskEmpty().LowestBitSet(), 0);
+    EXPECT_THAT(Group{group}.MaskEmpty().HighestBitSet(), 62);
   } else {
     FAIL() << "No test coverage for Group::kWidth==" << Group::kWidth;
   }
@@ -395,6 +441,16 @@ TEST(Group, MaskFull) {
                       ctrl_t::kDeleted,  CtrlT(2), ctrl_t::kSentinel,
                       ctrl_t::kSentinel, CtrlT(1)};
     EXPECT_THAT(Group{group}.MaskFull(), ElementsAre(1, 4, 7));
+  } else if (Group::kWidth == 64) {
+    ctrl_t group[64];
+    std::fill(std::begin(group), std::end(group), ctrl_t::kEmpty);
+    group[1] = CtrlT(1);
+    group[5] = ctrl_t::kDeleted;
+    group[17] = ctrl_t::kSentinel;
+    group[30] = CtrlT(3);
+    group[50] = CtrlT(3);
+    group[63] = CtrlT(1);
+    EXPECT_THAT(Group{group}.MaskFull(), ElementsAre(1, 30, 50, 63));
   } else {
     FAIL() << "No test coverage for Group::kWidth==" << Group::kWidth;
   }
@@ -414,6 +470,15 @@ TEST(Group, MaskNonFull) {
                       ctrl_t::kDeleted,  CtrlT(2), ctrl_t::kSentinel,
                       ctrl_t::kSentinel, CtrlT(1)};
     EXPECT_THAT(Group{group}.MaskNonFull(), ElementsAre(0, 2, 3, 5, 6));
+  } else if (Group::kWidth == 64) {
+    ctrl_t group[64];
+    std::fill(std::begin(group), std::end(group), ctrl_t::kEmpty);
+    group[1] = CtrlT(1);
+    group[5] = ctrl_t::kDeleted;
+    group[17] = ctrl_t::kSentinel;
+    group[63] = CtrlT(1);
+    EXPECT_THAT(Group{group}.MaskNonFull().LowestBitSet(), 0);
+    EXPECT_THAT(Group{group}.MaskNonFull().HighestBitSet(), 62);
   } else {
     FAIL() << "No test coverage for Group::kWidth==" << Group::kWidth;
   }
@@ -433,6 +498,15 @@ TEST(Group, MaskEmptyOrDeleted) {
                       ctrl_t::kSentinel, CtrlT(1)};
     EXPECT_THAT(Group{group}.MaskEmptyOrDeleted().LowestBitSet(), 0);
     EXPECT_THAT(Group{group}.MaskEmptyOrDeleted().HighestBitSet(), 3);
+  } else if (Group::kWidth == 64) {
+    ctrl_t group[64];
+    std::fill(std::begin(group), std::end(group), ctrl_t::kEmpty);
+    group[1] = CtrlT(1);
+    group[5] = ctrl_t::kDeleted;
+    group[17] = ctrl_t::kSentinel;
+    group[63] = CtrlT(1);
+    EXPECT_THAT(Group{group}.MaskEmptyOrDeleted().LowestBitSet(), 0);
+    EXPECT_THAT(Group{group}.MaskEmptyOrDeleted().HighestBitSet(), 62);
   } else {
     FAIL() << "No test coverage for Group::kWidth==" << Group::kWidth;
   }
@@ -668,6 +742,20 @@ static_assert(sizeof(SizedValue<kNonSooSize>) >= kNonSooSize, "too small");
 using NonSooIntTable = ValueTable<SizedValue<kNonSooSize>>;
 using SooIntTable = ValueTable<int64_t, /*kTransferable=*/true, /*kSoo=*/true>;
 
+// For testing custom maximum load factors via Policy::kGrowthShift.
+template <size_t kShift>
+struct GrowthShiftIntPolicy : IntPolicy {
+  static constexpr size_t kGrowthShift = kShift;
+};
+
+template <size_t kShift>
+struct GrowthShiftIntTable
+    : raw_hash_set<GrowthShiftIntPolicy<kShift>, hash_default_hash<int64_t>,
+                   std::equal_to<int64_t>, std::allocator<int64_t>> {
+  using Base = typename GrowthShiftIntTable::raw_hash_set;
+  using Base::Base;
+};
+
 template <typename T>
 struct CustomAlloc : std::allocator<T> {
   CustomAlloc() = default;
@@ -1046,6 +1134,110 @@ TYPED_TEST(SooTest, Contains2) {
   EXPECT_FALSE(t.contains(0));
 }
 
+TYPED_TEST(SooTest, FindBatch) {
+  using Key = typename TypeParam::key_type;
+  TypeParam t;
+  std::vector<Key> keys;
+  for (int64_t i = 0; i < 100; ++i) {
+    t.insert(i * 2);
+    keys.push_back(i);
+  }
+  std::vector<typename TypeParam::iterator> results(keys.size());
+  t.find_batch(absl::MakeConstSpan(keys), absl::MakeSpan(results));
+  for (size_t i = 0; i != keys.size(); ++i) {
+    if (i % 2 == 0) {
+      ASSERT_NE(results[i], t.end());
+      EXPECT_EQ(*results[i], keys[i]);
+    } else {
+      EXPECT_EQ(results[i], t.end());
+    }
+  }
+
+  const TypeParam& ct = t;
+  std::vector<typename TypeParam::const_iterator> const_results(keys.size());
+  ct.find_batch(absl::MakeConstSpan(keys), absl::MakeSpan(const_results));
+  for (size_t i = 0; i != keys.size(); ++i) {
+    EXPECT_EQ(const_results[i] == ct.end(), i % 2 != 0);
+  }
+}
+
+TYPED_TEST(SooTest, FindBatchSoo) {
+  TypeParam t;
+  t.insert(17);
+  std::vector<typename TypeParam::key_type> keys = {17, 42};
+  std::vector<typename TypeParam::iterator> results(keys.size());
+  t.find_batch(absl::MakeConstSpan(keys), absl::MakeSpan(results));
+  ASSERT_NE(results[0], t.end());
+  EXPECT_EQ(*results[0], 17);
+  EXPECT_EQ(results[1], t.end());
+}
+
+TYPED_TEST(SooTest, InsertRange) {
+  using Key = typename TypeParam::key_type;
+  std::vector<Key> values;
+  for (int64_t i = 0; i < 100; ++i) values.push_back(i);
+
+  TypeParam t;
+  t.insert_range(values.begin(), values.end());
+  EXPECT_EQ(t.size(), 100);
+  // Pre-sizing reserved room for the whole range, so no rehash happens while
+  // inserting and capacity covers the final size.
+  EXPECT_GE(t.capacity(), NormalizeCapacity(GrowthToLowerboundCapacity(100)));
+  for (int64_t i = 0; i < 100; ++i) ASSERT_NE(t.find(Key(i)), t.end());
+
+  // Overlapping re-insertion dedupes against existing elements.
+  t.insert_range(values.begin(), values.begin() + 50);
+  EXPECT_EQ(t.size(), 100);
+}
+
+// Wraps a forward iterator so that it only advertises (and supports) the
+// single-pass input iterator operations.
+template <class It>
+class InputIteratorAdapter {
+ public:
+  using iterator_category = std::input_iterator_tag;
+  using value_type = typename std::iterator_traits<It>::value_type;
+  using difference_type = typename std::iterator_traits<It>::difference_type;
+  using pointer = typename std::iterator_traits<It>::pointer;
+  using reference = typename std::iterator_traits<It>::reference;
+
+  explicit InputIteratorAdapter(It it) : it_(it) {}
+
+  reference operator*() const { return *it_; }
+  InputIteratorAdapter& operator++() {
+    ++it_;
+    return *this;
+  }
+  friend bool operator==(const InputIteratorAdapter& a,
+                         const InputIteratorAdapter& b) {
+    return a.it_ == b.it_;
+  }
+  friend bool operator!=(const InputIteratorAdapter& a,
+                         const InputIteratorAdapter& b) {
+    return a.it_ != b.it_;
+  }
+
+ private:
+  It it_;
+};
+
+template <class It>
+InputIteratorAdapter<It> MakeInputIterator(It it) {
+  return InputIteratorAdapter<It>(it);
+}
+
+TYPED_TEST(SooTest, InsertRangeInputIterator) {
+  using Key = typename TypeParam::key_type;
+  std::vector<Key> values = {1, 2, 3, 2};
+  TypeParam t;
+  // Single-pass iterators cannot be pre-sized; the growth-as-you-go fallback
+  // must still produce the right contents.
+  t.insert_range(MakeInputIterator(values.begin()),
+                 MakeInputIterator(values.end()));
+  EXPECT_EQ(t.size(), 3);
+  for (int64_t i = 1; i <= 3; ++i) EXPECT_NE(t.find(Key(i)), t.end());
+}
+
 int decompose_constructed;
 int decompose_copy_constructed;
 int decompose_copy_assigned;
@@ -1861,6 +2053,66 @@ TEST(Table, GrowthInfoDeletedBit) {
       RawHashSetTestOnlyAccess::GetCommon(t).growth_info().HasNoDeleted());
 }
 
+TEST(Table, EraseAndCompactAvoidsTombstones) {
+  // All elements collide, so the first `kRun` of them fully pack the first
+  // two probe windows and the next three overflow to a later, sparse window.
+  const int64_t kRun = 2 * static_cast<int64_t>(Group::kWidth);
+  BadTable plain, compact;
+  // Scale the capacity with the group width so the packed run plus overflow
+  // always fits without rehashing mid-insert.
+  plain.reserve(static_cast<size_t>(3 * kRun));
+  compact.reserve(static_cast<size_t>(3 * kRun));
+  for (int64_t i = 0; i < kRun + 3; ++i) {
+    plain.insert(i);
+    compact.insert(i);
+  }
+  // Erase half of the packed run. Every plain erase leaves a tombstone
+  // because the vacated slot's neighborhood is packed. The compacting erase
+  // backshifts an overflowed element into the vacated slot and marks a slot
+  // in the sparse window empty instead, until the overflowed elements run
+  // out and it too has to leave tombstones.
+  for (int64_t i = 0; i < kRun; i += 2) {
+    plain.erase(plain.find(i));
+    compact.erase_and_compact(compact.find(i));
+  }
+  EXPECT_EQ(RawHashSetTestOnlyAccess::CountTombstones(plain), kRun / 2);
+  // Insertion order within a probe window is randomized, so an overflowed
+  // element may sit just beyond the backshift scan range; at least two of
+  // the three are always reachable.
+  EXPECT_LE(RawHashSetTestOnlyAccess::CountTombstones(compact), kRun / 2 - 2);
+  EXPECT_EQ(compact.size(), plain.size());
+  // All remaining elements are still reachable.
+  for (int64_t i = 0; i < kRun + 3; ++i) {
+    EXPECT_EQ(compact.contains(i), i % 2 == 1 || i >= kRun) << i;
+  }
+}
+
+TEST(Table, EraseAndCompactPreservesElements) {
+  IntTable t;
+  for (int64_t i = 0; i < 1000; ++i) t.insert(i);
+  for (int64_t i = 0; i < 1000; i += 2) t.erase_and_compact(t.find(i));
+  EXPECT_EQ(t.size(), 500);
+  for (int64_t i = 0; i < 1000; ++i) {
+    EXPECT_EQ(t.contains(i), i % 2 == 1) << i;
+  }
+  // Compacting erases keep working when interleaved with inserts.
+  for (int64_t i = 0; i < 1000; i += 2) t.insert(i);
+  for (int64_t i = 1; i < 1000; i += 2) t.erase_and_compact(t.find(i));
+  EXPECT_EQ(t.size(), 500);
+  for (int64_t i = 0; i < 1000; ++i) {
+    EXPECT_EQ(t.contains(i), i % 2 == 0) << i;
+  }
+}
+
+TEST(Table, EraseAndCompactSoo) {
+  SooIntTable t;
+  t.insert(1);
+  t.erase_and_compact(t.find(1));
+  EXPECT_EQ(t.size(), 0);
+  t.insert(2);
+  EXPECT_TRUE(t.contains(2));
+}
+
 TYPED_TEST(SooTest, Clear) {
   TypeParam t;
   EXPECT_TRUE(t.find(0) == t.end());
@@ -1934,6 +2186,47 @@ TYPED_TEST(SooTest, RehashZeroForcesRehash) {
   EXPECT_NE(p, &*t.find(0));
 }
 
+TEST(Table, GrowthShiftPolicyRespectsLowLoadFactor) {
+  // kGrowthShift == 1 caps the load factor at 1/2.
+  GrowthShiftIntTable<1> t;
+  for (int64_t i = 0; i < 1000; ++i) {
+    t.insert(i);
+    if (t.capacity() + 1 >= Group::kWidth) {
+      EXPECT_LE(t.size(), CapacityToGrowth(t.capacity(), 1));
+    }
+  }
+  EXPECT_EQ(t.size(), 1000);
+  for (int64_t i = 0; i < 1000; ++i) EXPECT_EQ(t.count(i), 1);
+
+  // Erase churn exercises the deleted-slot rehash and clear paths, which read
+  // the shift through PolicyFunctions.
+  for (int64_t i = 0; i < 500; ++i) t.erase(i);
+  for (int64_t i = 1000; i < 1500; ++i) t.insert(i);
+  EXPECT_EQ(t.size(), 1000);
+  EXPECT_LE(t.size(), CapacityToGrowth(t.capacity(), 1));
+
+  GrowthShiftIntTable<1> copy = t;
+  EXPECT_EQ(copy.size(), 1000);
+  EXPECT_LE(copy.size(), CapacityToGrowth(copy.capacity(), 1));
+  for (int64_t i = 500; i < 1500; ++i) EXPECT_EQ(copy.count(i), 1);
+}
+
+TEST(Table, GrowthShiftPolicyAllowsDenserTables) {
+  // kGrowthShift == 6 allows a load factor up to 63/64.
+  GrowthShiftIntTable<6> dense;
+  dense.reserve(1000);
+  IntTable dflt;
+  dflt.reserve(1000);
+  EXPECT_LT(dense.capacity(), dflt.capacity());
+
+  // reserve() must have allocated enough to hold all elements without growth.
+  const size_t reserved_capacity = dense.capacity();
+  for (int64_t i = 0; i < 1000; ++i) dense.insert(i);
+  EXPECT_EQ(dense.capacity(), reserved_capacity);
+  for (int64_t i = 0; i < 1000; ++i) EXPECT_EQ(dense.count(i), 1);
+  EXPECT_EQ(dense.count(1000), 0);
+}
+
 TEST(Table, ConstructFromInitList) {
   using P = std::pair<std::string, std::string>;
   struct Q {
@@ -2476,6 +2769,14 @@ TYPED_TEST(SooTest, IterationOrderChangesOnRehash) {
              size_t{0},  // Force rehash is guaranteed.
              size * 10   // Rehash to the larger capacity is guaranteed.
          }) {
+      if (Group::kWidth > 16 &&
+          is_small(NormalizeCapacity(GrowthToLowerboundCapacity(
+              (std::max)(size, rehash_size))))) {
+        // With wide (AVX-512) groups, tables this small fit in a single probe
+        // group and insert deterministically (see ShouldInsertBackwards), so
+        // iteration order is not guaranteed to change across rehashes.
+        continue;
+      }
       std::vector<TypeParam> garbage;
       bool ok = false;
       for (int i = 0; i < 5000; ++i) {
@@ -3121,6 +3422,32 @@ TYPED_TEST(SooTest, EraseIfPartial) {
   }
 }
 
+TYPED_TEST(SooTest, EraseIfLargeTable) {
+  for (int mod : {0, 1}) {
+    SCOPED_TRACE(mod);
+    auto pred = [&](const auto& x) {
+      return static_cast<int64_t>(x) % 2 == mod;
+    };
+    TypeParam t;
+    std::vector<int64_t> expected;
+    for (int i = 0; i < 10000; ++i) {
+      t.insert(i);
+      if (i % 2 != mod) {
+        expected.push_back(i);
+      }
+    }
+    EXPECT_EQ(absl::container_internal::EraseIf(pred, &t), 5000);
+    ASSERT_THAT(t, testing::UnorderedElementsAreArray(expected));
+    // The table stays usable after the bulk sweep: the erased keys can be
+    // reinserted into the vacated slots and everything erased again.
+    for (int i = 0; i < 10000; ++i) t.insert(i);
+    ASSERT_EQ(t.size(), 10000);
+    auto erase_all = [](const auto&) { return true; };
+    EXPECT_EQ(absl::container_internal::EraseIf(erase_all, &t), 10000);
+    EXPECT_TRUE(t.empty());
+  }
+}
+
 TYPED_TEST(SooTest, ForEach) {
   TypeParam t;
   std::vector<int64_t> expected;
@@ -0,0 +1,227 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Replays an operation trace against flat_hash_map, node_hash_map, and
+// btree_map and reports per-operation latency histograms, so container
+// changes can be evaluated against captured workloads rather than synthetic
+// key distributions.
+//
+// The trace format is one operation per line:
+//
+//   f <key>     # find
+//   i <key>     # insert (or overwrite)
+//   e <key>     # erase
+//
+// with `<key>` an unsigned 64-bit decimal. Lines starting with '#' are
+// ignored. Pass the trace with --trace=<file>. Without a trace, the driver
+// synthesizes a skewed mixed workload (Zipf-distributed keys, 60% find /
+// 30% insert / 10% erase) controlled by --ops=<n> and --keyspace=<n>.
+//
+// Latencies are measured in CycleClock ticks and accumulated into an
+// exponential histogram, from which p50/p90/p99/p99.9 are reported per
+// operation type and container.
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "absl/base/internal/cycleclock.h"
+#include "absl/container/btree_map.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/container/node_hash_map.h"
+#include "absl/random/distributions.h"
+#include "absl/random/random.h"
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_format.h"
+#include "absl/strings/string_view.h"
+#include "absl/strings/strip.h"
+
+namespace {
+
+enum class OpType { kFind, kInsert, kErase };
+
+struct Op {
+  OpType type;
+  uint64_t key;
+};
+
+constexpr const char* OpName(OpType type) {
+  return type == OpType::kFind     ? "find"
+         : type == OpType::kInsert ? "insert"
+                                   : "erase";
+}
+
+// Exponential latency histogram over CycleClock ticks: bucket b holds
+// latencies in [2^b, 2^(b+1)).
+class LatencyHistogram {
+ public:
+  void Record(int64_t cycles) {
+    if (cycles < 1) cycles = 1;
+    int bucket = 63 - __builtin_clzll(static_cast<uint64_t>(cycles));
+    if (bucket >= kNumBuckets) bucket = kNumBuckets - 1;
+    ++buckets_[bucket];
+    ++count_;
+    total_ += cycles;
+  }
+
+  size_t count() const { return count_; }
+
+  double Mean() const {
+    return count_ == 0 ? 0.0
+                       : static_cast<double>(total_) /
+                             static_cast<double>(count_);
+  }
+
+  // Returns the upper bound of the bucket containing quantile `q` in [0, 1].
+  // Bucket granularity bounds the error to a factor of two.
+  int64_t Quantile(double q) const {
+    const size_t rank = static_cast<size_t>(q * static_cast<double>(count_));
+    size_t seen = 0;
+    for (int b = 0; b < kNumBuckets; ++b) {
+      seen += buckets_[b];
+      if (seen > rank) return int64_t{1} << (b + 1);
+    }
+    return int64_t{1} << kNumBuckets;
+  }
+
+ private:
+  static constexpr int kNumBuckets = 48;
+  size_t buckets_[kNumBuckets] = {};
+  size_t count_ = 0;
+  int64_t total_ = 0;
+};
+
+std::vector<Op> LoadTrace(const char* path) {
+  std::vector<Op> ops;
+  FILE* f = fopen(path, "r");
+  if (f == nullptr) {
+    absl::FPrintF(stderr, "cannot open trace file %s\n", path);
+    exit(1);
+  }
+  char line[256];
+  size_t line_number = 0;
+  while (fgets(line, sizeof(line), f) != nullptr) {
+    ++line_number;
+    absl::string_view text(line);
+    text = absl::StripAsciiWhitespace(text);
+    if (text.empty() || text[0] == '#') continue;
+    OpType type;
+    switch (text[0]) {
+      case 'f': type = OpType::kFind; break;
+      case 'i': type = OpType::kInsert; break;
+      case 'e': type = OpType::kErase; break;
+      default:
+        absl::FPrintF(stderr, "bad op on line %d: %s\n", line_number, text);
+        exit(1);
+    }
+    uint64_t key;
+    if (!absl::SimpleAtoi(absl::StripAsciiWhitespace(text.substr(1)), &key)) {
+      absl::FPrintF(stderr, "bad key on line %d: %s\n", line_number, text);
+      exit(1);
+    }
+    ops.push_back(Op{type, key});
+  }
+  fclose(f);
+  return ops;
+}
+
+// A synthetic stand-in for a captured trace: Zipf-skewed keys with an
+// interleaved find-heavy operation mix.
+std::vector<Op> SynthesizeTrace(size_t num_ops, uint64_t keyspace) {
+  absl::BitGen gen;
+  std::vector<Op> ops;
+  ops.reserve(num_ops);
+  for (size_t i = 0; i < num_ops; ++i) {
+    const uint64_t key = absl::Zipf(gen, keyspace - 1);
+    const double r = absl::Uniform(gen, 0.0, 1.0);
+    const OpType type = r < 0.6    ? OpType::kFind
+                        : r < 0.9  ? OpType::kInsert
+                                   : OpType::kErase;
+    ops.push_back(Op{type, key});
+  }
+  return ops;
+}
+
+// Replays `ops` against a fresh `Map`, timing each operation.
+template <typename Map>
+void Replay(absl::string_view container_name, const std::vector<Op>& ops) {
+  using CycleClock = absl::base_internal::CycleClock;
+  Map map;
+  LatencyHistogram histograms[3];
+  uint64_t found = 0;  // Keeps the find results observable.
+  for (const Op& op : ops) {
+    const int64_t start = CycleClock::Now();
+    switch (op.type) {
+      case OpType::kFind:
+        found += map.find(op.key) != map.end() ? 1 : 0;
+        break;
+      case OpType::kInsert:
+        map[op.key] = op.key;
+        break;
+      case OpType::kErase:
+        map.erase(op.key);
+        break;
+    }
+    histograms[static_cast<int>(op.type)].Record(CycleClock::Now() - start);
+  }
+
+  absl::PrintF("%s: %d ops, final size %d, hits %d\n", container_name,
+               ops.size(), map.size(), found);
+  for (int i = 0; i < 3; ++i) {
+    const LatencyHistogram& h = histograms[i];
+    if (h.count() == 0) continue;
+    absl::PrintF(
+        "  %-6s count=%-9d mean=%-8.1f p50<%-6d p90<%-6d p99<%-6d "
+        "p99.9<%d cycles\n",
+        OpName(static_cast<OpType>(i)), h.count(), h.Mean(), h.Quantile(0.5),
+        h.Quantile(0.9), h.Quantile(0.99), h.Quantile(0.999));
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const char* trace_path = nullptr;
+  size_t num_ops = 5000000;
+  uint64_t keyspace = 1 << 20;
+  for (int i = 1; i < argc; ++i) {
+    absl::string_view arg(argv[i]);
+    if (absl::ConsumePrefix(&arg, "--trace=")) {
+      trace_path = argv[i] + strlen("--trace=");
+    } else if (absl::ConsumePrefix(&arg, "--ops=")) {
+      if (!absl::SimpleAtoi(arg, &num_ops)) return 1;
+    } else if (absl::ConsumePrefix(&arg, "--keyspace=")) {
+      if (!absl::SimpleAtoi(arg, &keyspace)) return 1;
+    } else {
+      absl::FPrintF(stderr,
+                    "usage: %s [--trace=<file>] [--ops=<n>] [--keyspace=<n>]\n",
+                    argv[0]);
+      return 1;
+    }
+  }
+
+  const std::vector<Op> ops = trace_path != nullptr
+                                  ? LoadTrace(trace_path)
+                                  : SynthesizeTrace(num_ops, keyspace);
+  absl::PrintF("replaying %d operations (%s)\n", ops.size(),
+               trace_path != nullptr ? trace_path : "synthetic zipf trace");
+
+  Replay<absl::flat_hash_map<uint64_t, uint64_t>>("flat_hash_map", ops);
+  Replay<absl::node_hash_map<uint64_t, uint64_t>>("node_hash_map", ops);
+  Replay<absl::btree_map<uint64_t, uint64_t>>("btree_map", ops);
+  return 0;
+}
@@ -0,0 +1,107 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// -----------------------------------------------------------------------------
+// File: prehashed_key.h
+// -----------------------------------------------------------------------------
+//
+// `absl::PrehashedKey<K>` bundles a key with its `absl::Hash` value so the
+// hash can be computed once and reused across lookups in several containers.
+// This matters for expensive-to-hash keys, such as long strings, that are
+// looked up in more than one Swiss-table container keyed the same way:
+//
+//   absl::flat_hash_set<std::string> seen;
+//   absl::flat_hash_map<std::string, Payload> payloads;
+//   ...
+//   absl::PrehashedKey<absl::string_view> key = absl::MakePrehashedKey(name);
+//   if (seen.contains(key)) {
+//     Process(payloads.find(key)->second);  // `name` was hashed only once.
+//   }
+//
+// A `PrehashedKey` is accepted by the default hash and equality functors of
+// the string-keyed Abseil hash containers (`std::string`, `absl::string_view`,
+// and `absl::Cord` keys). Containers with custom hash functors reject it at
+// compile time, since the stored hash would not match theirs.
+//
+// String-like keys are wrapped as `PrehashedKey<absl::string_view>`, so the
+// wrapper must not outlive the characters of the original key; treat it like
+// a `string_view` over the lookup key.
+
+#ifndef ABSL_CONTAINER_PREHASHED_KEY_H_
+#define ABSL_CONTAINER_PREHASHED_KEY_H_
+
+#include <cstddef>
+#include <type_traits>
+
+#include "absl/base/config.h"
+#include "absl/hash/hash.h"
+#include "absl/strings/string_view.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+template <typename K>
+class PrehashedKey;
+
+PrehashedKey<absl::string_view> MakePrehashedKey(absl::string_view key);
+
+template <typename K, typename = typename std::enable_if<!std::is_convertible<
+                          const K&, absl::string_view>::value>::type>
+PrehashedKey<K> MakePrehashedKey(const K& key);
+
+// PrehashedKey
+//
+// A key of type `K` together with its `absl::Hash<K>` value. Create one with
+// `absl::MakePrehashedKey()`; the constructor is private so that the stored
+// hash is always the one the default container hashers would compute.
+template <typename K>
+class PrehashedKey {
+ public:
+  // The wrapped key.
+  const K& key() const { return key_; }
+
+  // The `absl::Hash` value of the wrapped key.
+  size_t hash() const { return hash_; }
+
+ private:
+  friend PrehashedKey<absl::string_view> MakePrehashedKey(absl::string_view);
+  template <typename T, typename>
+  friend PrehashedKey<T> MakePrehashedKey(const T&);
+
+  PrehashedKey(const K& key, size_t hash) : key_(key), hash_(hash) {}
+
+  K key_;
+  size_t hash_;
+};
+
+// MakePrehashedKey()
+//
+// Returns a `PrehashedKey` wrapping `key`. String-like keys (`std::string`,
+// `absl::string_view`, string literals) are wrapped as
+// `PrehashedKey<absl::string_view>` to avoid copying the characters; other
+// key types are stored by value.
+inline PrehashedKey<absl::string_view> MakePrehashedKey(absl::string_view key) {
+  return PrehashedKey<absl::string_view>(
+      key, absl::Hash<absl::string_view>{}(key));
+}
+
+template <typename K, typename>
+PrehashedKey<K> MakePrehashedKey(const K& key) {
+  return PrehashedKey<K>(key, absl::Hash<K>{}(key));
+}
+
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_CONTAINER_PREHASHED_KEY_H_
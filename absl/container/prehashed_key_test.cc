@@ -0,0 +1,84 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/container/prehashed_key.h"
+
+#include <string>
+#include <type_traits>
+
+#include "gtest/gtest.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/container/flat_hash_set.h"
+#include "absl/container/node_hash_map.h"
+#include "absl/hash/hash.h"
+#include "absl/strings/cord.h"
+#include "absl/strings/string_view.h"
+
+namespace {
+
+TEST(PrehashedKey, HashMatchesDefaultHasher) {
+  absl::string_view key = "some fairly long key that is expensive to hash";
+  auto prehashed = absl::MakePrehashedKey(key);
+  EXPECT_EQ(prehashed.hash(), absl::Hash<absl::string_view>{}(key));
+  EXPECT_EQ(prehashed.key(), key);
+}
+
+TEST(PrehashedKey, StringLikeKeysWrapAsStringView) {
+  std::string str = "value";
+  auto from_string = absl::MakePrehashedKey(str);
+  auto from_view = absl::MakePrehashedKey(absl::string_view(str));
+  auto from_literal = absl::MakePrehashedKey("value");
+  static_assert(std::is_same<decltype(from_string),
+                             absl::PrehashedKey<absl::string_view>>::value,
+                "");
+  static_assert(std::is_same<decltype(from_literal),
+                             absl::PrehashedKey<absl::string_view>>::value,
+                "");
+  EXPECT_EQ(from_string.hash(), from_view.hash());
+  EXPECT_EQ(from_string.hash(), from_literal.hash());
+}
+
+TEST(PrehashedKey, FindInFlatHashSet) {
+  absl::flat_hash_set<std::string> s = {"a", "b", "c"};
+  EXPECT_TRUE(s.contains(absl::MakePrehashedKey("b")));
+  EXPECT_FALSE(s.contains(absl::MakePrehashedKey("d")));
+  EXPECT_EQ(*s.find(absl::MakePrehashedKey("a")), "a");
+  EXPECT_TRUE(s.find(absl::MakePrehashedKey("d")) == s.end());
+}
+
+TEST(PrehashedKey, SharedAcrossContainers) {
+  absl::flat_hash_set<std::string> seen = {"x", "y"};
+  absl::flat_hash_map<std::string, int> payloads = {{"x", 1}, {"y", 2}};
+  auto key = absl::MakePrehashedKey("y");
+  ASSERT_TRUE(seen.contains(key));
+  EXPECT_EQ(payloads.find(key)->second, 2);
+}
+
+TEST(PrehashedKey, NodeContainers) {
+  absl::node_hash_map<std::string, int> m = {{"k", 7}};
+  EXPECT_EQ(m.find(absl::MakePrehashedKey("k"))->second, 7);
+  EXPECT_TRUE(m.find(absl::MakePrehashedKey("missing")) == m.end());
+}
+
+TEST(PrehashedKey, CordKeys) {
+  absl::flat_hash_set<absl::Cord> s;
+  s.insert(absl::Cord("cord key"));
+  EXPECT_TRUE(s.contains(absl::MakePrehashedKey(absl::Cord("cord key"))));
+  EXPECT_FALSE(s.contains(absl::MakePrehashedKey(absl::Cord("absent"))));
+  // A Cord container also accepts a prehashed string key: `absl::Hash`
+  // guarantees equal strings and Cords hash identically.
+  EXPECT_TRUE(s.contains(absl::MakePrehashedKey("cord key")));
+}
+
+}  // namespace
@@ -0,0 +1,242 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// -----------------------------------------------------------------------------
+// File: small_flat_hash_map.h
+// -----------------------------------------------------------------------------
+//
+// An `absl::small_flat_hash_map<K, V, N>` is an unordered associative
+// container optimized for maps that usually hold only a handful of elements.
+// Up to `N` elements are stored inline in the object itself and searched with
+// a linear scan — no hashing, no control bytes, and crucially no heap
+// allocation. When the (N+1)-th distinct key arrives, the contents spill
+// transparently into an `absl::flat_hash_map`, so pathological instances
+// still get O(1) behavior.
+//
+// `flat_hash_map` already avoids allocation for a single element via its
+// small-object optimization, but any second element allocates a full
+// ctrl+slot array. For workloads with millions of tiny maps (RPC metadata,
+// per-request annotations), those allocations dominate; this container
+// eliminates them for maps of up to `N` elements.
+//
+// As with the other internally-storage-switching Abseil containers, there are
+// no iterators: element access is via `find()` (which returns a pointer) and
+// `for_each()`. Pointers are invalidated by any mutating operation.
+
+#ifndef ABSL_CONTAINER_SMALL_FLAT_HASH_MAP_H_
+#define ABSL_CONTAINER_SMALL_FLAT_HASH_MAP_H_
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+#include "absl/base/attributes.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/container/hash_container_defaults.h"
+#include "absl/container/inlined_vector.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+// -----------------------------------------------------------------------------
+// absl::small_flat_hash_map
+// -----------------------------------------------------------------------------
+//
+// An `absl::small_flat_hash_map<K, V, N>` differs from `flat_hash_map` in the
+// following notable ways:
+//
+// * Maps of up to `N` elements are stored inline and never touch the heap
+//   (beyond what the keys and values themselves allocate).
+// * Lookups in the inline representation are linear scans using only the
+//   equality functor; the hasher is not invoked until the map spills.
+// * There are no iterators. `find()` returns a pointer to the mapped value
+//   (or `nullptr`), valid until the next mutating operation.
+// * Once spilled to the backing `flat_hash_map`, a map does not return to the
+//   inline representation, even if erased back below `N` elements.
+//
+// `N` should be small (single digits to a few dozen): the inline elements are
+// part of the object's footprint, and linear scans lose to hashing as `N`
+// grows.
+template <class K, class V, size_t N,
+          class Hash = DefaultHashContainerHash<K>,
+          class Eq = DefaultHashContainerEq<K>,
+          class Allocator = std::allocator<std::pair<const K, V>>>
+class small_flat_hash_map {
+  using Map = absl::flat_hash_map<K, V, Hash, Eq, Allocator>;
+  // The inline representation stores mutable keys so that elements can be
+  // moved when spilling.
+  using SmallValue = std::pair<K, V>;
+
+ public:
+  using key_type = typename Map::key_type;
+  using mapped_type = typename Map::mapped_type;
+  using value_type = typename Map::value_type;
+  using size_type = typename Map::size_type;
+  using hasher = typename Map::hasher;
+  using key_equal = typename Map::key_equal;
+  using allocator_type = typename Map::allocator_type;
+
+  static_assert(N > 0, "small_flat_hash_map requires N > 0");
+
+  small_flat_hash_map() = default;
+
+  // Inserts `value` if its key is not already present. Returns `true` if the
+  // insertion took place.
+  bool insert(const value_type& value) {
+    return try_emplace(value.first, value.second);
+  }
+  bool insert(value_type&& value) {
+    return try_emplace(std::move(const_cast<K&>(value.first)),
+                       std::move(value.second));
+  }
+
+  // Constructs `mapped_type` from `args` and inserts it under `key` if the
+  // key is not already present. Returns `true` if the insertion took place.
+  template <class Key, class... Args>
+  bool try_emplace(Key&& key, Args&&... args) {
+    if (spilled()) {
+      return large_.try_emplace(std::forward<Key>(key),
+                                std::forward<Args>(args)...)
+          .second;
+    }
+    if (find_small(key) != nullptr) return false;
+    if (small_.size() == N) {
+      spill();
+      return large_.try_emplace(std::forward<Key>(key),
+                                std::forward<Args>(args)...)
+          .second;
+    }
+    small_.emplace_back(std::piecewise_construct,
+                        std::forward_as_tuple(std::forward<Key>(key)),
+                        std::forward_as_tuple(std::forward<Args>(args)...));
+    return true;
+  }
+
+  // Inserts or overwrites the value stored under `key`. Returns `true` if a
+  // new element was inserted, `false` if an existing one was assigned to.
+  template <class Key, class Mapped>
+  bool insert_or_assign(Key&& key, Mapped&& mapped) {
+    if (spilled()) {
+      return large_
+          .insert_or_assign(std::forward<Key>(key),
+                            std::forward<Mapped>(mapped))
+          .second;
+    }
+    if (SmallValue* v = find_small(key)) {
+      v->second = std::forward<Mapped>(mapped);
+      return false;
+    }
+    return try_emplace(std::forward<Key>(key), std::forward<Mapped>(mapped));
+  }
+
+  // Returns a pointer to the value mapped to the given key, or `nullptr` if
+  // the key is not present. The pointer is invalidated by the next mutating
+  // operation.
+  template <class Key>
+  V* find(const Key& key) {
+    if (!spilled()) {
+      SmallValue* v = find_small(key);
+      return v == nullptr ? nullptr : &v->second;
+    }
+    auto it = large_.find(key);
+    return it == large_.end() ? nullptr : &it->second;
+  }
+  template <class Key>
+  const V* find(const Key& key) const {
+    return const_cast<small_flat_hash_map*>(this)->find(key);
+  }
+
+  template <class Key>
+  bool contains(const Key& key) const {
+    return find(key) != nullptr;
+  }
+
+  // Erases the element with the given key, if any. Returns the number of
+  // elements erased (0 or 1).
+  template <class Key>
+  size_type erase(const Key& key) {
+    if (spilled()) return large_.erase(key);
+    for (size_type i = 0; i < small_.size(); ++i) {
+      if (eq_(small_[i].first, key)) {
+        // Order is not observable, so fill the hole with the last element.
+        if (i + 1 != small_.size()) small_[i] = std::move(small_.back());
+        small_.pop_back();
+        return 1;
+      }
+    }
+    return 0;
+  }
+
+  // Runs `fn` on every element. Elements are visited in no particular order.
+  template <class Fn>
+  void for_each(Fn fn) {
+    if (spilled()) {
+      for (value_type& v : large_) fn(v);
+    } else {
+      for (SmallValue& v : small_) {
+        fn(reinterpret_cast<value_type&>(v));
+      }
+    }
+  }
+  template <class Fn>
+  void for_each(Fn fn) const {
+    if (spilled()) {
+      for (const value_type& v : large_) fn(v);
+    } else {
+      for (const SmallValue& v : small_) {
+        fn(reinterpret_cast<const value_type&>(v));
+      }
+    }
+  }
+
+  size_type size() const { return spilled() ? large_.size() : small_.size(); }
+  bool empty() const { return size() == 0; }
+
+  // Returns true once the map has spilled to its heap-backed representation.
+  bool spilled() const { return spilled_; }
+
+  void clear() {
+    small_.clear();
+    large_.clear();
+    spilled_ = false;
+  }
+
+ private:
+  template <class Key>
+  SmallValue* find_small(const Key& key) {
+    for (SmallValue& v : small_) {
+      if (eq_(v.first, key)) return &v;
+    }
+    return nullptr;
+  }
+
+  void spill() {
+    large_.reserve(N + 1);
+    for (SmallValue& v : small_) {
+      large_.try_emplace(std::move(v.first), std::move(v.second));
+    }
+    small_.clear();
+    spilled_ = true;
+  }
+
+  absl::InlinedVector<SmallValue, N> small_;
+  Map large_;
+  bool spilled_ = false;
+  ABSL_ATTRIBUTE_NO_UNIQUE_ADDRESS key_equal eq_;
+};
+
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_CONTAINER_SMALL_FLAT_HASH_MAP_H_
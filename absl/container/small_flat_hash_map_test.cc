@@ -0,0 +1,150 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/container/small_flat_hash_map.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "absl/strings/string_view.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+namespace {
+
+using ::testing::Pair;
+using ::testing::UnorderedElementsAre;
+
+TEST(SmallFlatHashMap, StaysInlineBelowThreshold) {
+  small_flat_hash_map<int, int, 4> m;
+  EXPECT_TRUE(m.empty());
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_TRUE(m.try_emplace(i, i * 10));
+  }
+  EXPECT_EQ(m.size(), 4);
+  EXPECT_FALSE(m.spilled());
+
+  EXPECT_FALSE(m.try_emplace(2, 99));
+  ASSERT_NE(m.find(2), nullptr);
+  EXPECT_EQ(*m.find(2), 20);
+  EXPECT_EQ(m.find(7), nullptr);
+}
+
+TEST(SmallFlatHashMap, SpillsOnOverflow) {
+  small_flat_hash_map<int, int, 4> m;
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_TRUE(m.try_emplace(i, i * 10)) << i;
+  }
+  EXPECT_TRUE(m.spilled());
+  EXPECT_EQ(m.size(), 100);
+  for (int i = 0; i < 100; ++i) {
+    const int* v = m.find(i);
+    ASSERT_NE(v, nullptr) << i;
+    EXPECT_EQ(*v, i * 10);
+  }
+  // Duplicates are still rejected after spilling.
+  EXPECT_FALSE(m.try_emplace(50, -1));
+}
+
+TEST(SmallFlatHashMap, EraseInline) {
+  small_flat_hash_map<int, int, 4> m;
+  for (int i = 0; i < 4; ++i) m.try_emplace(i, i);
+  EXPECT_EQ(m.erase(1), 1);
+  EXPECT_EQ(m.erase(1), 0);
+  EXPECT_EQ(m.size(), 3);
+  EXPECT_FALSE(m.contains(1));
+  EXPECT_TRUE(m.contains(0));
+  EXPECT_TRUE(m.contains(2));
+  EXPECT_TRUE(m.contains(3));
+  // Erasing back under the threshold keeps the map functional.
+  m.try_emplace(4, 4);
+  EXPECT_EQ(m.size(), 4);
+  EXPECT_FALSE(m.spilled());
+}
+
+TEST(SmallFlatHashMap, InsertOrAssign) {
+  small_flat_hash_map<int, std::string, 2> m;
+  EXPECT_TRUE(m.insert_or_assign(1, "a"));
+  EXPECT_FALSE(m.insert_or_assign(1, "b"));
+  EXPECT_EQ(*m.find(1), "b");
+
+  // Assignment also works across the spill boundary.
+  m.try_emplace(2, "c");
+  m.try_emplace(3, "d");
+  EXPECT_TRUE(m.spilled());
+  EXPECT_FALSE(m.insert_or_assign(1, "e"));
+  EXPECT_EQ(*m.find(1), "e");
+}
+
+TEST(SmallFlatHashMap, ForEach) {
+  small_flat_hash_map<int, int, 8> m;
+  for (int i = 0; i < 5; ++i) m.try_emplace(i, i);
+
+  std::vector<std::pair<int, int>> contents;
+  const auto& cm = m;
+  cm.for_each([&](const std::pair<const int, int>& p) {
+    contents.push_back({p.first, p.second});
+  });
+  EXPECT_THAT(contents, UnorderedElementsAre(Pair(0, 0), Pair(1, 1),
+                                             Pair(2, 2), Pair(3, 3),
+                                             Pair(4, 4)));
+
+  m.for_each([](std::pair<const int, int>& p) { p.second += 1; });
+  ASSERT_NE(m.find(3), nullptr);
+  EXPECT_EQ(*m.find(3), 4);
+}
+
+TEST(SmallFlatHashMap, HeterogeneousLookup) {
+  small_flat_hash_map<std::string, int, 4> m;
+  m.try_emplace("abc", 1);
+  absl::string_view key = "abc";
+  EXPECT_TRUE(m.contains(key));
+  ASSERT_NE(m.find(key), nullptr);
+  EXPECT_EQ(*m.find(key), 1);
+  EXPECT_EQ(m.erase(key), 1);
+
+  // The same lookups work once spilled.
+  for (int i = 0; i < 10; ++i) m.try_emplace(std::to_string(i), i);
+  EXPECT_TRUE(m.spilled());
+  EXPECT_TRUE(m.contains(absl::string_view("7")));
+}
+
+TEST(SmallFlatHashMap, MoveOnlyValues) {
+  small_flat_hash_map<int, std::unique_ptr<int>, 2> m;
+  EXPECT_TRUE(m.try_emplace(1, new int(10)));
+  EXPECT_TRUE(m.try_emplace(2, new int(20)));
+  EXPECT_TRUE(m.try_emplace(3, new int(30)));  // Spills; values are moved.
+  EXPECT_TRUE(m.spilled());
+  ASSERT_NE(m.find(1), nullptr);
+  EXPECT_EQ(**m.find(1), 10);
+}
+
+TEST(SmallFlatHashMap, Clear) {
+  small_flat_hash_map<int, int, 2> m;
+  for (int i = 0; i < 10; ++i) m.try_emplace(i, i);
+  EXPECT_TRUE(m.spilled());
+  m.clear();
+  EXPECT_TRUE(m.empty());
+  EXPECT_FALSE(m.spilled());
+  EXPECT_TRUE(m.try_emplace(1, 1));
+  EXPECT_FALSE(m.spilled());
+}
+
+}  // namespace
+ABSL_NAMESPACE_END
+}  // namespace absl
@@ -0,0 +1,173 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// -----------------------------------------------------------------------------
+// File: soa_flat_hash_map.h
+// -----------------------------------------------------------------------------
+//
+// An `absl::soa_flat_hash_map<K, V>` is a hash map that stores keys and
+// values in separate arrays (structure-of-arrays form). Probing scans a
+// swisstable whose slots hold only a key and a position, so candidate keys
+// pack densely into cache lines; the value array is touched only after a key
+// has actually matched. `flat_hash_map` instead stores `pair<const K, V>`
+// per slot, so with a small key and a large value most of each probed cache
+// line is payload the comparison never needed.
+//
+// Use it where keys are small, values are large, and lookups miss or probe
+// long chains often enough that cache traffic during probing matters:
+//
+//   absl::soa_flat_hash_map<uint64_t, Row> rows;   // 8B keys, 256B values
+//   rows[id] = MakeRow(...);
+//   if (Row* row = rows.find(id)) Process(*row);
+//
+// Values are kept dense and in insertion order until the first erase, so
+// `values()` is a contiguous span suitable for vectorized scans; `keys()` is
+// the parallel key span. `erase` swaps the last element into the hole, so it
+// is O(1) but reorders `keys()`/`values()` and invalidates pointers to the
+// moved element. Any mutation may invalidate all element pointers and spans,
+// as with `std::vector`.
+//
+// Costs relative to `flat_hash_map`: each key is stored twice (once in the
+// probe table, once in the dense key array), and `erase` performs a second
+// hash lookup to re-index the element it moved. The trade is worthwhile only
+// when `sizeof(V)` is large relative to `sizeof(K)`.
+//
+// The API is deliberately narrower than `flat_hash_map`: there are no
+// iterators over `pair<const K, V>` (no such pair exists in memory — the key
+// and value live in different arrays), and `find` returns a pointer to the
+// value or null. Iterate via the `keys()` and `values()` spans, which are
+// always parallel.
+
+#ifndef ABSL_CONTAINER_SOA_FLAT_HASH_MAP_H_
+#define ABSL_CONTAINER_SOA_FLAT_HASH_MAP_H_
+
+#include <cassert>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "absl/base/config.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/container/hash_container_defaults.h"
+#include "absl/types/span.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+// -----------------------------------------------------------------------------
+// absl::soa_flat_hash_map
+// -----------------------------------------------------------------------------
+//
+// A hash map with split key/value storage. Heterogeneous lookup is supported
+// under the same conditions as `flat_hash_map`.
+template <class K, class V, class Hash = DefaultHashContainerHash<K>,
+          class Eq = DefaultHashContainerEq<K>>
+class soa_flat_hash_map {
+  // Maps each key to its position in `keys_`/`values_`. Probing touches only
+  // these small slots; values are read after a confirmed key match.
+  using Index = absl::flat_hash_map<K, size_t, Hash, Eq>;
+
+ public:
+  using key_type = K;
+  using mapped_type = V;
+  using size_type = size_t;
+
+  soa_flat_hash_map() = default;
+
+  size_type size() const { return values_.size(); }
+  bool empty() const { return values_.empty(); }
+
+  void reserve(size_type n) {
+    index_.reserve(n);
+    keys_.reserve(n);
+    values_.reserve(n);
+  }
+
+  void clear() {
+    index_.clear();
+    keys_.clear();
+    values_.clear();
+  }
+
+  // Returns a pointer to the value mapped to `key`, or null if absent.
+  template <class Key>
+  V* find(const Key& key) {
+    auto it = index_.find(key);
+    return it == index_.end() ? nullptr : &values_[it->second];
+  }
+  template <class Key>
+  const V* find(const Key& key) const {
+    auto it = index_.find(key);
+    return it == index_.end() ? nullptr : &values_[it->second];
+  }
+
+  template <class Key>
+  bool contains(const Key& key) const {
+    return index_.contains(key);
+  }
+
+  // Inserts a value constructed from `args...` if `key` is absent. Returns a
+  // pointer to the (new or preexisting) value and whether insertion happened.
+  template <class Key, class... Args>
+  std::pair<V*, bool> try_emplace(Key&& key, Args&&... args) {
+    auto res = index_.try_emplace(std::forward<Key>(key), values_.size());
+    if (res.second) {
+      keys_.push_back(res.first->first);
+      values_.emplace_back(std::forward<Args>(args)...);
+    }
+    return {&values_[res.first->second], res.second};
+  }
+
+  template <class Key>
+  V& operator[](Key&& key) {
+    return *try_emplace(std::forward<Key>(key)).first;
+  }
+
+  // Removes `key` if present; returns the number of elements removed (0 or
+  // 1). The last element is swapped into the erased slot, so `keys()` and
+  // `values()` are reordered and pointers to the moved element are
+  // invalidated.
+  template <class Key>
+  size_type erase(const Key& key) {
+    auto it = index_.find(key);
+    if (it == index_.end()) return 0;
+    const size_t pos = it->second;
+    index_.erase(it);
+    const size_t last = values_.size() - 1;
+    if (pos != last) {
+      keys_[pos] = std::move(keys_[last]);
+      values_[pos] = std::move(values_[last]);
+      index_.find(keys_[pos])->second = pos;
+    }
+    keys_.pop_back();
+    values_.pop_back();
+    return 1;
+  }
+
+  // The dense key and value arrays. `keys()[i]` maps to `values()[i]`. Order
+  // is unspecified once `erase` has been called.
+  absl::Span<const K> keys() const { return absl::MakeConstSpan(keys_); }
+  absl::Span<V> values() { return absl::MakeSpan(values_); }
+  absl::Span<const V> values() const { return absl::MakeConstSpan(values_); }
+
+ private:
+  Index index_;
+  std::vector<K> keys_;
+  std::vector<V> values_;
+};
+
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_CONTAINER_SOA_FLAT_HASH_MAP_H_
@@ -0,0 +1,121 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/container/soa_flat_hash_map.h"
+
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "absl/strings/string_view.h"
+
+namespace {
+
+using ::testing::UnorderedElementsAre;
+
+TEST(SoaFlatHashMap, BasicInsertAndFind) {
+  absl::soa_flat_hash_map<uint64_t, std::string> m;
+  EXPECT_TRUE(m.empty());
+
+  auto res = m.try_emplace(1, "one");
+  EXPECT_TRUE(res.second);
+  EXPECT_EQ(*res.first, "one");
+  res = m.try_emplace(1, "uno");
+  EXPECT_FALSE(res.second);
+  EXPECT_EQ(*res.first, "one");
+
+  m[2] = "two";
+  EXPECT_EQ(m.size(), 2);
+  ASSERT_NE(m.find(2), nullptr);
+  EXPECT_EQ(*m.find(2), "two");
+  EXPECT_EQ(m.find(3), nullptr);
+  EXPECT_TRUE(m.contains(1));
+  EXPECT_FALSE(m.contains(3));
+}
+
+TEST(SoaFlatHashMap, KeysAndValuesAreParallel) {
+  absl::soa_flat_hash_map<int, int> m;
+  for (int i = 0; i < 100; ++i) m[i] = i * 10;
+  ASSERT_EQ(m.keys().size(), m.values().size());
+  for (size_t i = 0; i < m.keys().size(); ++i) {
+    EXPECT_EQ(m.values()[i], m.keys()[i] * 10);
+  }
+}
+
+TEST(SoaFlatHashMap, EraseSwapsLastIntoHole) {
+  absl::soa_flat_hash_map<int, std::string> m;
+  m[1] = "a";
+  m[2] = "b";
+  m[3] = "c";
+  EXPECT_EQ(m.erase(2), 1);
+  EXPECT_EQ(m.erase(2), 0);
+  EXPECT_EQ(m.size(), 2);
+  EXPECT_EQ(m.find(2), nullptr);
+  // The survivors are still indexed correctly after the swap.
+  ASSERT_NE(m.find(1), nullptr);
+  EXPECT_EQ(*m.find(1), "a");
+  ASSERT_NE(m.find(3), nullptr);
+  EXPECT_EQ(*m.find(3), "c");
+  EXPECT_THAT(m.keys(), UnorderedElementsAre(1, 3));
+
+  EXPECT_EQ(m.erase(1), 1);
+  EXPECT_EQ(m.erase(3), 1);
+  EXPECT_TRUE(m.empty());
+}
+
+TEST(SoaFlatHashMap, HeterogeneousLookup) {
+  absl::soa_flat_hash_map<std::string, int> m;
+  m["key"] = 7;
+  ASSERT_NE(m.find(absl::string_view("key")), nullptr);
+  EXPECT_EQ(*m.find(absl::string_view("key")), 7);
+  EXPECT_TRUE(m.contains(absl::string_view("key")));
+  EXPECT_EQ(m.erase(absl::string_view("key")), 1);
+  EXPECT_TRUE(m.empty());
+}
+
+TEST(SoaFlatHashMap, LargeValuesUntouchedUntilMatch) {
+  struct BigValue {
+    char payload[256];
+  };
+  absl::soa_flat_hash_map<uint64_t, BigValue> m;
+  m.reserve(1000);
+  for (uint64_t i = 0; i < 1000; ++i) {
+    m.try_emplace(i).first->payload[0] = static_cast<char>(i);
+  }
+  for (uint64_t i = 0; i < 1000; ++i) {
+    ASSERT_NE(m.find(i), nullptr);
+    EXPECT_EQ(m.find(i)->payload[0], static_cast<char>(i));
+    EXPECT_EQ(m.find(i + 1000), nullptr);
+  }
+  for (uint64_t i = 0; i < 1000; i += 2) EXPECT_EQ(m.erase(i), 1);
+  EXPECT_EQ(m.size(), 500);
+  ASSERT_EQ(m.keys().size(), 500);
+  for (size_t i = 0; i < m.keys().size(); ++i) {
+    EXPECT_EQ(m.values()[i].payload[0], static_cast<char>(m.keys()[i]));
+  }
+}
+
+TEST(SoaFlatHashMap, ClearAndReuse) {
+  absl::soa_flat_hash_map<int, int> m;
+  m[1] = 10;
+  m.clear();
+  EXPECT_TRUE(m.empty());
+  EXPECT_EQ(m.find(1), nullptr);
+  m[1] = 20;
+  EXPECT_EQ(*m.find(1), 20);
+}
+
+}  // namespace
@@ -0,0 +1,383 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// -----------------------------------------------------------------------------
+// File: soa_vector.h
+// -----------------------------------------------------------------------------
+//
+// An `absl::soa_vector<T1, T2, ...>` is a dynamically sized sequence of rows
+// stored in structure-of-arrays form: all `T1`s are contiguous, followed by
+// all `T2`s, and so on, in a single heap allocation computed with
+// `container_internal::Layout`. Rows are appended and removed together, but
+// each column is read and written through its own contiguous `absl::Span`,
+// which is what vectorized scans and cache-friendly single-field traversals
+// want:
+//
+//   absl::soa_vector<uint64_t, float> points;
+//   points.push_back(id, weight);
+//   for (float w : points.field<1>()) total += w;  // scans only the floats
+//
+// Like `std::vector`, the container grows geometrically and invalidates all
+// spans and element pointers on reallocation. Unlike `std::vector`, there is
+// no per-row reference type; access a row as `v.field<0>()[i]`,
+// `v.field<1>()[i]`, etc.
+//
+// Efficiency tip inherited from `Layout`: order the column types so that
+// alignments are non-increasing (`alignof(T1) >= alignof(T2) >= ...`) to
+// avoid padding between columns.
+
+#ifndef ABSL_CONTAINER_SOA_VECTOR_H_
+#define ABSL_CONTAINER_SOA_VECTOR_H_
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+#include "absl/base/attributes.h"
+#include "absl/base/config.h"
+#include "absl/base/macros.h"
+#include "absl/container/internal/container_memory.h"
+#include "absl/container/internal/layout.h"
+#include "absl/types/span.h"
+#include "absl/utility/utility.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+// -----------------------------------------------------------------------------
+// absl::soa_vector
+// -----------------------------------------------------------------------------
+//
+// A resizable structure-of-arrays container holding one column per template
+// argument. All columns always have the same length, `size()`, and share one
+// allocation sized for `capacity()` rows.
+template <typename... Ts>
+class soa_vector {
+  static_assert(sizeof...(Ts) > 0,
+                "soa_vector must have at least one column type");
+
+  using Layout = container_internal::Layout<Ts...>;
+  using CharAlloc = std::allocator<char>;
+
+ public:
+  using size_type = size_t;
+
+  // The type of column `I`, i.e. the `I`-th of `Ts...`.
+  template <size_t I>
+  using element_type = typename Layout::template ElementType<I>;
+
+  // The number of columns.
+  static constexpr size_t num_fields() { return sizeof...(Ts); }
+
+  soa_vector() = default;
+
+  soa_vector(const soa_vector& other) {
+    if (other.size_ == 0) return;
+    AllocateStorage(other.size_);
+    CopyColumns(other, absl::index_sequence_for<Ts...>());
+    size_ = other.size_;
+  }
+
+  soa_vector(soa_vector&& other) noexcept
+      : data_(other.data_), size_(other.size_), capacity_(other.capacity_) {
+    other.data_ = nullptr;
+    other.size_ = 0;
+    other.capacity_ = 0;
+  }
+
+  soa_vector& operator=(const soa_vector& other) {
+    if (this != &other) {
+      soa_vector tmp(other);
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  soa_vector& operator=(soa_vector&& other) noexcept {
+    if (this != &other) {
+      DestroyElements();
+      FreeStorage();
+      data_ = other.data_;
+      size_ = other.size_;
+      capacity_ = other.capacity_;
+      other.data_ = nullptr;
+      other.size_ = 0;
+      other.capacity_ = 0;
+    }
+    return *this;
+  }
+
+  ~soa_vector() {
+    DestroyElements();
+    FreeStorage();
+  }
+
+  // soa_vector::empty()
+  //
+  // Returns whether the container holds no rows.
+  bool empty() const { return size_ == 0; }
+
+  // soa_vector::size()
+  //
+  // Returns the number of rows; every column has exactly this many elements.
+  size_type size() const { return size_; }
+
+  // soa_vector::capacity()
+  //
+  // Returns the number of rows the current allocation can hold.
+  size_type capacity() const { return capacity_; }
+
+  // soa_vector::field()
+  //
+  // Returns the column of `element_type<I>`s as a contiguous span of `size()`
+  // elements. The span is invalidated by any operation that reallocates
+  // (`push_back` past `capacity()`, `reserve`) and by destruction.
+  template <size_t I>
+  absl::Span<element_type<I>> field() {
+    return absl::Span<element_type<I>>(Column<I>(), size_);
+  }
+  template <size_t I>
+  absl::Span<const element_type<I>> field() const {
+    return absl::Span<const element_type<I>>(Column<I>(), size_);
+  }
+
+  // soa_vector::push_back()
+  //
+  // Appends one row, one value per column. Reallocates if `size()` equals
+  // `capacity()`. Provides the strong exception safety guarantee as long as
+  // the column types are nothrow move constructible.
+  void push_back(Ts... values) {
+    if (size_ == capacity_) Grow(NextCapacity());
+    ConstructRow(size_, absl::index_sequence_for<Ts...>(), std::move(values)...);
+    ++size_;
+  }
+
+  // soa_vector::pop_back()
+  //
+  // Removes the last row, destroying one element in each column.
+  void pop_back() {
+    assert(size_ > 0);
+    --size_;
+    DestroyRow(size_, absl::index_sequence_for<Ts...>());
+  }
+
+  // soa_vector::reserve()
+  //
+  // Ensures the allocation can hold at least `n` rows without reallocating.
+  void reserve(size_type n) {
+    if (n > capacity_) Grow(n);
+  }
+
+  // soa_vector::clear()
+  //
+  // Destroys all rows. Does not release the allocation.
+  void clear() {
+    DestroyElements();
+    size_ = 0;
+  }
+
+  // soa_vector::swap()
+  //
+  // Exchanges the contents of two soa_vectors in constant time.
+  void swap(soa_vector& other) noexcept {
+    using std::swap;
+    swap(data_, other.data_);
+    swap(size_, other.size_);
+    swap(capacity_, other.capacity_);
+  }
+
+  friend void swap(soa_vector& a, soa_vector& b) noexcept { a.swap(b); }
+
+ private:
+  // All columns have the same number of elements, so the layout is fully
+  // described by the row capacity.
+  static Layout MakeLayout(size_t capacity) {
+    return Layout(ColumnSize<Ts>(capacity)...);
+  }
+  template <typename T>
+  static size_t ColumnSize(size_t capacity) {
+    return capacity;
+  }
+
+  template <size_t I>
+  element_type<I>* Column() {
+    return MakeLayout(capacity_).template Pointer<I>(data_);
+  }
+  template <size_t I>
+  const element_type<I>* Column() const {
+    return MakeLayout(capacity_).template Pointer<I>(data_);
+  }
+
+  size_t NextCapacity() const { return capacity_ == 0 ? 4 : capacity_ * 2; }
+
+  // Sets `data_` and `capacity_` to a new uninitialized allocation of
+  // `new_capacity` rows. Does not touch the old allocation.
+  void AllocateStorage(size_t new_capacity) {
+    data_ = static_cast<char*>(container_internal::Allocate<Layout::Alignment()>(
+        &alloc_, MakeLayout(new_capacity).AllocSize()));
+    capacity_ = new_capacity;
+  }
+
+  void FreeStorage() {
+    if (data_ == nullptr) return;
+    container_internal::Deallocate<Layout::Alignment()>(
+        &alloc_, data_, MakeLayout(capacity_).AllocSize());
+    data_ = nullptr;
+    capacity_ = 0;
+  }
+
+  // Moves every column into a fresh allocation of `new_capacity` rows and
+  // releases the old one. If a move constructor throws, the new allocation is
+  // unwound and the old contents are left intact.
+  void Grow(size_t new_capacity) {
+    assert(new_capacity > size_);
+    char* old_data = data_;
+    const size_t old_capacity = capacity_;
+    const Layout old_layout = MakeLayout(old_capacity);
+    AllocateStorage(new_capacity);
+    size_t constructed = 0;
+    ABSL_INTERNAL_TRY {
+      MoveColumns(old_data, old_layout, constructed,
+                  absl::index_sequence_for<Ts...>());
+    }
+    ABSL_INTERNAL_CATCH_ANY {
+      DestroyFirstElements(constructed, absl::index_sequence_for<Ts...>());
+      FreeStorage();
+      data_ = old_data;
+      capacity_ = old_capacity;
+      ABSL_INTERNAL_RETHROW;
+    }
+    if (old_data != nullptr) {
+      char* new_data = data_;
+      const size_t new_capacity_saved = capacity_;
+      data_ = old_data;
+      capacity_ = old_capacity;
+      DestroyElements();
+      FreeStorage();
+      data_ = new_data;
+      capacity_ = new_capacity_saved;
+    }
+  }
+
+  // Move-constructs the first `size_` elements of each column from the old
+  // allocation into the current one, bumping `constructed` after each element
+  // so that a throwing move can be unwound by the caller.
+  template <size_t... Is>
+  void MoveColumns(char* old_data, const Layout& old_layout,
+                   size_t& constructed, absl::index_sequence<Is...>) {
+    int unused[] = {
+        (MoveColumn<Is>(old_layout.template Pointer<Is>(old_data), constructed),
+         0)...};
+    (void)unused;
+  }
+  template <size_t I>
+  void MoveColumn(element_type<I>* old_column, size_t& constructed) {
+    element_type<I>* new_column = Column<I>();
+    for (size_t i = 0; i != size_; ++i) {
+      ::new (static_cast<void*>(new_column + i))
+          element_type<I>(std::move(old_column[i]));
+      ++constructed;
+    }
+  }
+
+  // Copy-constructs `other.size_` elements of each column into the current
+  // (fresh) allocation. Only called from the copy constructor, so unwinding
+  // on a throwing copy is the destructor's cleanup with `size_` still zero.
+  template <size_t... Is>
+  void CopyColumns(const soa_vector& other, absl::index_sequence<Is...>) {
+    size_t constructed = 0;
+    ABSL_INTERNAL_TRY {
+      int unused[] = {(CopyColumn<Is>(other, constructed), 0)...};
+      (void)unused;
+    }
+    ABSL_INTERNAL_CATCH_ANY {
+      DestroyFirstElements(constructed, absl::index_sequence_for<Ts...>());
+      FreeStorage();
+      ABSL_INTERNAL_RETHROW;
+    }
+  }
+  template <size_t I>
+  void CopyColumn(const soa_vector& other, size_t& constructed) {
+    const element_type<I>* src = other.template Column<I>();
+    element_type<I>* dst = Column<I>();
+    for (size_t i = 0; i != other.size_; ++i) {
+      ::new (static_cast<void*>(dst + i)) element_type<I>(src[i]);
+      ++constructed;
+    }
+  }
+
+  // Constructs row `row` from `values`, one element per column. If a
+  // constructor throws, the elements already constructed in this row are
+  // destroyed before rethrowing.
+  template <size_t... Is>
+  void ConstructRow(size_t row, absl::index_sequence<Is...>, Ts... values) {
+    size_t constructed = 0;
+    ABSL_INTERNAL_TRY {
+      int unused[] = {(::new (static_cast<void*>(Column<Is>() + row))
+                           element_type<Is>(std::move(values)),
+                       ++constructed, 0)...};
+      (void)unused;
+    }
+    ABSL_INTERNAL_CATCH_ANY {
+      DestroyRowPrefix(row, constructed, absl::index_sequence_for<Ts...>());
+      ABSL_INTERNAL_RETHROW;
+    }
+  }
+
+  template <size_t... Is>
+  void DestroyRow(size_t row, absl::index_sequence<Is...>) {
+    int unused[] = {((Column<Is>() + row)->~Ts(), 0)...};
+    (void)unused;
+  }
+
+  // Destroys row `row` in the first `n` columns.
+  template <size_t... Is>
+  void DestroyRowPrefix(size_t row, size_t n, absl::index_sequence<Is...>) {
+    int unused[] = {(Is < n ? (Column<Is>() + row)->~Ts() : void(), 0)...};
+    (void)unused;
+  }
+
+  void DestroyElements() {
+    DestroyFirstElements(size_ * sizeof...(Ts), absl::index_sequence_for<Ts...>());
+  }
+
+  // Destroys the first `n` elements in column construction order: all of
+  // column 0 first, then column 1, and so on, with a possibly partial final
+  // column. This mirrors the order in which MoveColumns/CopyColumns construct.
+  template <size_t... Is>
+  void DestroyFirstElements(size_t n, absl::index_sequence<Is...>) {
+    int unused[] = {(DestroyColumnPrefix<Is>(
+                         n > Is * size_ ? (std::min)(n - Is * size_, size_) : 0),
+                     0)...};
+    (void)unused;
+  }
+  template <size_t I>
+  void DestroyColumnPrefix(size_t n) {
+    using T = element_type<I>;
+    T* column = Column<I>();
+    for (size_t i = 0; i != n; ++i) column[i].~T();
+  }
+
+  char* data_ = nullptr;
+  size_t size_ = 0;
+  size_t capacity_ = 0;
+  ABSL_ATTRIBUTE_NO_UNIQUE_ADDRESS CharAlloc alloc_;
+};
+
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_CONTAINER_SOA_VECTOR_H_
@@ -0,0 +1,176 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/container/soa_vector.h"
+
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "absl/container/internal/test_instance_tracker.h"
+#include "absl/strings/str_cat.h"
+
+namespace {
+
+using ::absl::test_internal::CopyableMovableInstance;
+using ::absl::test_internal::InstanceTracker;
+using ::testing::ElementsAre;
+using ::testing::IsEmpty;
+
+TEST(SoaVector, Empty) {
+  absl::soa_vector<int, double> v;
+  EXPECT_TRUE(v.empty());
+  EXPECT_EQ(v.size(), 0);
+  EXPECT_EQ(v.capacity(), 0);
+  EXPECT_THAT(v.field<0>(), IsEmpty());
+  EXPECT_THAT(v.field<1>(), IsEmpty());
+}
+
+TEST(SoaVector, PushBackAndFields) {
+  absl::soa_vector<uint64_t, float> v;
+  v.push_back(1, 1.5f);
+  v.push_back(2, 2.5f);
+  v.push_back(3, 3.5f);
+
+  EXPECT_EQ(v.size(), 3);
+  EXPECT_THAT(v.field<0>(), ElementsAre(1, 2, 3));
+  EXPECT_THAT(v.field<1>(), ElementsAre(1.5f, 2.5f, 3.5f));
+
+  // Columns are independently writable.
+  v.field<1>()[1] = -1.0f;
+  EXPECT_THAT(v.field<1>(), ElementsAre(1.5f, -1.0f, 3.5f));
+}
+
+TEST(SoaVector, GrowthPreservesValues) {
+  absl::soa_vector<int, std::string> v;
+  for (int i = 0; i < 100; ++i) {
+    v.push_back(i, absl::StrCat("s", i));
+  }
+  EXPECT_EQ(v.size(), 100);
+  EXPECT_GE(v.capacity(), 100);
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_EQ(v.field<0>()[i], i);
+    EXPECT_EQ(v.field<1>()[i], absl::StrCat("s", i));
+  }
+}
+
+TEST(SoaVector, ColumnsAreContiguous) {
+  absl::soa_vector<int, char> v;
+  for (int i = 0; i < 10; ++i) v.push_back(i, 'a');
+  absl::Span<int> ints = v.field<0>();
+  for (int i = 1; i < 10; ++i) {
+    EXPECT_EQ(&ints[i], &ints[0] + i);
+  }
+}
+
+TEST(SoaVector, Reserve) {
+  absl::soa_vector<int> v;
+  v.reserve(50);
+  EXPECT_GE(v.capacity(), 50);
+  const int* data = v.field<0>().data();
+  for (int i = 0; i < 50; ++i) v.push_back(i);
+  // No reallocation happened.
+  EXPECT_EQ(v.field<0>().data(), data);
+}
+
+TEST(SoaVector, PopBackAndClear) {
+  absl::soa_vector<int, std::string> v;
+  v.push_back(1, "one");
+  v.push_back(2, "two");
+  v.pop_back();
+  EXPECT_THAT(v.field<0>(), ElementsAre(1));
+  EXPECT_THAT(v.field<1>(), ElementsAre("one"));
+
+  v.clear();
+  EXPECT_TRUE(v.empty());
+  EXPECT_GT(v.capacity(), 0);
+  v.push_back(3, "three");
+  EXPECT_THAT(v.field<1>(), ElementsAre("three"));
+}
+
+TEST(SoaVector, CopyAndMove) {
+  absl::soa_vector<int, std::string> v;
+  v.push_back(1, "one");
+  v.push_back(2, "two");
+
+  absl::soa_vector<int, std::string> copy(v);
+  EXPECT_THAT(copy.field<0>(), ElementsAre(1, 2));
+  EXPECT_THAT(copy.field<1>(), ElementsAre("one", "two"));
+  EXPECT_THAT(v.field<1>(), ElementsAre("one", "two"));
+
+  absl::soa_vector<int, std::string> moved(std::move(v));
+  EXPECT_THAT(moved.field<1>(), ElementsAre("one", "two"));
+  EXPECT_TRUE(v.empty());  // NOLINT(bugprone-use-after-move)
+
+  copy = moved;
+  EXPECT_THAT(copy.field<1>(), ElementsAre("one", "two"));
+  v = std::move(moved);
+  EXPECT_THAT(v.field<1>(), ElementsAre("one", "two"));
+}
+
+TEST(SoaVector, Swap) {
+  absl::soa_vector<int> a;
+  absl::soa_vector<int> b;
+  a.push_back(1);
+  b.push_back(2);
+  b.push_back(3);
+  swap(a, b);
+  EXPECT_THAT(a.field<0>(), ElementsAre(2, 3));
+  EXPECT_THAT(b.field<0>(), ElementsAre(1));
+}
+
+TEST(SoaVector, NoLeaksOnGrowthCopyAndDestruction) {
+  InstanceTracker tracker;
+  {
+    absl::soa_vector<CopyableMovableInstance, CopyableMovableInstance> v;
+    for (int i = 0; i < 20; ++i) {
+      v.push_back(CopyableMovableInstance(i), CopyableMovableInstance(-i));
+    }
+    EXPECT_EQ(tracker.instances(), 40);
+    absl::soa_vector<CopyableMovableInstance, CopyableMovableInstance> copy(v);
+    EXPECT_EQ(tracker.instances(), 80);
+    v.pop_back();
+    EXPECT_EQ(tracker.instances(), 78);
+    v.clear();
+    EXPECT_EQ(tracker.instances(), 40);
+  }
+  EXPECT_EQ(tracker.instances(), 0);
+}
+
+TEST(SoaVector, SingleColumn) {
+  absl::soa_vector<std::string> v;
+  v.push_back("a");
+  v.push_back("b");
+  EXPECT_THAT(v.field<0>(), ElementsAre("a", "b"));
+}
+
+TEST(SoaVector, MixedAlignments) {
+  // Descending alignments: no padding between columns, but any order must
+  // still produce correctly aligned columns.
+  absl::soa_vector<char, double, int16_t> v;
+  for (int i = 0; i < 33; ++i) {
+    v.push_back(static_cast<char>('a' + i % 26), i * 0.5,
+                static_cast<int16_t>(i));
+  }
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(v.field<1>().data()) % alignof(double),
+            0);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(v.field<2>().data()) % alignof(int16_t),
+            0);
+  EXPECT_EQ(v.field<1>()[32], 16.0);
+  EXPECT_EQ(v.field<2>()[32], 32);
+}
+
+}  // namespace
@@ -74,12 +74,26 @@ crc32c_t RemoveCrc32cPrefix(crc32c_t crc_a, crc32c_t crc_ab, size_t length_b) {
   return ConcatCrc32c(crc_a, crc_ab, length_b);
 }
 
+crc32c_t CombineCrc32c(absl::Span<const Crc32cShard> shards) {
+  crc32c_t result{0};
+  for (const Crc32cShard& shard : shards) {
+    result = ConcatCrc32c(result, shard.crc, shard.length);
+  }
+  return result;
+}
+
 crc32c_t MemcpyCrc32c(void* dest, const void* src, size_t count,
                       crc32c_t initial_crc) {
   return static_cast<crc32c_t>(
       crc_internal::Crc32CAndCopy(dest, src, count, initial_crc, false));
 }
 
+crc32c_t NonTemporalMemcpyCrc32c(void* dest, const void* src, size_t count,
+                                 crc32c_t initial_crc) {
+  return static_cast<crc32c_t>(
+      crc_internal::Crc32CAndCopy(dest, src, count, initial_crc, true));
+}
+
 // Remove a Suffix of given size from a buffer
 //
 // Given a CRC32C of an existing buffer, `full_string_crc`; the CRC32C of a
@@ -25,12 +25,14 @@
 #ifndef ABSL_CRC_CRC32C_H_
 #define ABSL_CRC_CRC32C_H_
 
+#include <cstddef>
 #include <cstdint>
 #include <ostream>
 
 #include "absl/crc/internal/crc32c_inline.h"
 #include "absl/strings/str_format.h"
 #include "absl/strings/string_view.h"
+#include "absl/types/span.h"
 
 namespace absl {
 ABSL_NAMESPACE_BEGIN
@@ -132,6 +134,16 @@ crc32c_t ExtendCrc32cByZeroes(crc32c_t initial_crc, size_t length);
 crc32c_t MemcpyCrc32c(void* dest, const void* src, size_t count,
                       crc32c_t initial_crc = crc32c_t{0});
 
+// NonTemporalMemcpyCrc32c()
+//
+// Like `MemcpyCrc32c()`, but performs the copy with non-temporal stores where
+// the platform supports them, so the destination buffer is not pulled into
+// CPU caches. Prefer this variant when copying buffers much larger than the
+// cache that will not be read again soon, where cache pollution from the copy
+// costs more than caching the destination could save.
+crc32c_t NonTemporalMemcpyCrc32c(void* dest, const void* src, size_t count,
+                                 crc32c_t initial_crc = crc32c_t{0});
+
 // -----------------------------------------------------------------------------
 // CRC32C Arithmetic Functions
 // -----------------------------------------------------------------------------
@@ -151,6 +163,36 @@ crc32c_t MemcpyCrc32c(void* dest, const void* src, size_t count,
 // This operation has a runtime cost of O(log(`crc2_length`)).
 crc32c_t ConcatCrc32c(crc32c_t crc1, crc32c_t crc2, size_t crc2_length);
 
+// Crc32cShard
+//
+// The CRC32C value and length of one consecutive shard of a buffer, used
+// with `CombineCrc32c()`.
+struct Crc32cShard {
+  crc32c_t crc;
+  size_t length;
+};
+
+// CombineCrc32c()
+//
+// Combines the CRC32C values of consecutive shards of a buffer into the
+// CRC32C value of the whole buffer.
+//
+// `shards[i]` must hold the CRC32C value of the i-th shard, computed with a
+// zero initial value, along with that shard's length. This is the combining
+// step of a parallel checksum: split the buffer into consecutive shards,
+// checksum each shard on its own thread with `ComputeCrc32c()`, then combine
+// the per-shard results in buffer order:
+//
+//   std::vector<absl::Crc32cShard> shards(num_threads);
+//   // In thread i, for the i-th subrange of the buffer:
+//   shards[i] = {absl::ComputeCrc32c(subrange), subrange.size()};
+//   ...
+//   absl::crc32c_t crc = absl::CombineCrc32c(shards);
+//
+// This operation has a runtime cost of O(`shards.size()` * log(max shard
+// length)), independent of the amount of data the shards cover.
+crc32c_t CombineCrc32c(absl::Span<const Crc32cShard> shards);
+
 // RemoveCrc32cPrefix()
 //
 // Calculates the CRC32C value of an existing buffer with a series of bytes
@@ -20,6 +20,7 @@
 #include <cstring>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include "gtest/gtest.h"
 #include "absl/crc/internal/crc32c.h"
@@ -154,6 +155,28 @@ TEST(CRC32C, Concat) {
   EXPECT_EQ(absl::ConcatCrc32c(crc_a, crc_b, world.size()), crc_ab);
 }
 
+TEST(CRC32C, Combine) {
+  EXPECT_EQ(absl::CombineCrc32c({}), absl::crc32c_t{0});
+
+  std::string data = TestString(100000);
+  absl::crc32c_t expected = absl::ComputeCrc32c(data);
+
+  // A single shard covering the whole buffer.
+  EXPECT_EQ(absl::CombineCrc32c({{expected, data.size()}}), expected);
+
+  // Uneven shards, including an empty one, covering the whole buffer.
+  constexpr size_t kShardSize[] = {0, 1, 20, 500, 69479, 30000};
+  std::vector<absl::Crc32cShard> shards;
+  size_t offset = 0;
+  for (size_t size : kShardSize) {
+    absl::string_view shard = absl::string_view(data).substr(offset, size);
+    shards.push_back({absl::ComputeCrc32c(shard), shard.size()});
+    offset += size;
+  }
+  ASSERT_EQ(offset, data.size());
+  EXPECT_EQ(absl::CombineCrc32c(shards), expected);
+}
+
 TEST(CRC32C, Memcpy) {
   constexpr size_t kBytesSize[] = {0, 1, 20, 500, 100000};
   for (size_t bytes : kBytesSize) {
@@ -170,6 +193,22 @@ TEST(CRC32C, Memcpy) {
   }
 }
 
+TEST(CRC32C, NonTemporalMemcpy) {
+  constexpr size_t kBytesSize[] = {0, 1, 20, 500, 100000, 5000000};
+  for (size_t bytes : kBytesSize) {
+    SCOPED_TRACE(bytes);
+    std::string sample_string = TestString(bytes);
+    std::string target_buffer = std::string(bytes, '\0');
+
+    absl::crc32c_t memcpy_crc = absl::NonTemporalMemcpyCrc32c(
+        &(target_buffer[0]), sample_string.data(), bytes);
+    absl::crc32c_t compute_crc = absl::ComputeCrc32c(sample_string);
+
+    EXPECT_EQ(memcpy_crc, compute_crc);
+    EXPECT_EQ(sample_string, target_buffer);
+  }
+}
+
 TEST(CRC32C, RemovePrefix) {
   std::string hello = "Hello, ";
   std::string world = "world!";
@@ -136,6 +136,8 @@ CpuType GetIntelCpuType() {
               }
             case 0x5e:  // Skylake (client)
               return CpuType::kIntelSkylake;
+            case 0x8f:  // Sapphire Rapids Xeon
+              return CpuType::kIntelSapphireRapids;
             default:
               return CpuType::kUnknown;
           }
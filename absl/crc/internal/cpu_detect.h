@@ -31,6 +31,7 @@ enum class CpuType {
   kAmdMilan,
   kAmdGenoa,
   kAmdRyzenV3000,
+  kIntelSapphireRapids,
   kIntelCascadelakeXeon,
   kIntelSkylakeXeon,
   kIntelBroadwell,
@@ -50,6 +50,13 @@
 
 #endif
 
+// 512-bit wide carryless multiplication requires AVX-512F in addition to the
+// VPCLMULQDQ extension.
+#if defined(ABSL_CRC_INTERNAL_HAVE_X86_SIMD) && defined(__AVX512F__) && \
+    defined(__VPCLMULQDQ__)
+#define ABSL_CRC_INTERNAL_HAVE_X86_512_SIMD
+#endif
+
 namespace absl {
 ABSL_NAMESPACE_BEGIN
 namespace crc_internal {
@@ -128,6 +135,38 @@ V128 V128_Add64(const V128 l, const V128 r);
 
 #endif
 
+#if defined(ABSL_CRC_INTERNAL_HAVE_X86_512_SIMD)
+
+using V512 = __m512i;
+
+// Load 512 bits of integer data. |src| does not need to be aligned.
+V512 V512_LoadU(const V512* src);
+
+// Polynomially multiplies the high 64 bits of each 128-bit lane of |l| and
+// |r|.
+V512 V512_PMulHi(const V512 l, const V512 r);
+
+// Polynomially multiplies the low 64 bits of each 128-bit lane of |l| and |r|.
+V512 V512_PMulLow(const V512 l, const V512 r);
+
+// Produces a XOR operation of |l| and |r|.
+V512 V512_Xor(const V512 l, const V512 r);
+
+// Produces a XOR operation of |x|, |y| and |z|.
+V512 V512_Xor3(const V512 x, const V512 y, const V512 z);
+
+// Broadcasts |l| into every 128-bit lane.
+V512 V512_Broadcast(const V128 l);
+
+// Sets the lowest 32 bits to |r| and zeroes the rest.
+V512 V512_From32WithZeroFill(const uint32_t r);
+
+// Extracts the 128-bit lane of |l| selected by |imm|.
+template <int imm>
+V128 V512_Extract128(const V512 l);
+
+#endif
+
 #if defined(ABSL_CRC_INTERNAL_HAVE_X86_SIMD)
 
 inline uint32_t CRC32_u8(uint32_t crc, uint8_t v) {
@@ -197,6 +236,39 @@ inline V128 V128_Add64(const V128 l, const V128 r) {
   return _mm_add_epi64(l, r);
 }
 
+#if defined(ABSL_CRC_INTERNAL_HAVE_X86_512_SIMD)
+
+inline V512 V512_LoadU(const V512* src) { return _mm512_loadu_si512(src); }
+
+inline V512 V512_PMulHi(const V512 l, const V512 r) {
+  return _mm512_clmulepi64_epi128(l, r, 0x11);
+}
+
+inline V512 V512_PMulLow(const V512 l, const V512 r) {
+  return _mm512_clmulepi64_epi128(l, r, 0x00);
+}
+
+inline V512 V512_Xor(const V512 l, const V512 r) {
+  return _mm512_xor_si512(l, r);
+}
+
+inline V512 V512_Xor3(const V512 x, const V512 y, const V512 z) {
+  return _mm512_ternarylogic_epi64(x, y, z, 0x96);
+}
+
+inline V512 V512_Broadcast(const V128 l) { return _mm512_broadcast_i32x4(l); }
+
+inline V512 V512_From32WithZeroFill(const uint32_t r) {
+  return _mm512_zextsi128_si512(_mm_cvtsi32_si128(static_cast<int>(r)));
+}
+
+template <int imm>
+inline V128 V512_Extract128(const V512 l) {
+  return _mm512_extracti32x4_epi32(l, imm);
+}
+
+#endif  // ABSL_CRC_INTERNAL_HAVE_X86_512_SIMD
+
 #elif defined(ABSL_CRC_INTERNAL_HAVE_ARM_SIMD)
 
 inline uint32_t CRC32_u8(uint32_t crc, uint8_t v) { return __crc32cb(crc, v); }
@@ -0,0 +1,56 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/crc/streaming_memcpy.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+
+class StreamingMemcpyTest : public testing::TestWithParam<size_t> {};
+
+// Covers sizes on both sides of the internal threshold, including odd sizes
+// that exercise the misaligned header and tail paths.
+TEST_P(StreamingMemcpyTest, CopiesExactly) {
+  const size_t copy_size = GetParam();
+  std::vector<uint8_t> src(copy_size + 64);
+  std::vector<uint8_t> dst(copy_size + 64);
+  for (size_t i = 0; i < src.size(); i++) {
+    src[i] = static_cast<uint8_t>(i % 251);
+    dst[i] = ~src[i];
+  }
+
+  // Offset the pointers so neither side starts cacheline-aligned.
+  uint8_t* d = dst.data() + 3;
+  const uint8_t* s = src.data() + 5;
+  void* result = absl::StreamingMemcpy(d, s, copy_size);
+  EXPECT_EQ(result, d);
+  for (size_t i = 0; i < copy_size; i++) {
+    ASSERT_EQ(d[i], s[i]) << "at offset " << i;
+  }
+  // Bytes beyond the copy are untouched.
+  EXPECT_EQ(dst[2], static_cast<uint8_t>(~src[2]));
+  EXPECT_EQ(dst[copy_size + 3], static_cast<uint8_t>(~src[copy_size + 3]));
+}
+
+INSTANTIATE_TEST_SUITE_P(Sizes, StreamingMemcpyTest,
+                         testing::Values(0, 1, 63, 64, 1024, 4096,
+                                         256 * 1024 - 1, 256 * 1024,
+                                         1024 * 1024 + 17));
+
+}  // namespace
@@ -0,0 +1,223 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/debugging/internal/leak_sampler.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+#include "absl/base/attributes.h"
+#include "absl/base/config.h"
+#include "absl/base/internal/low_level_alloc.h"
+#include "absl/base/internal/per_thread_tls.h"
+#include "absl/base/internal/raw_logging.h"
+#include "absl/base/no_destructor.h"
+#include "absl/base/optimization.h"
+#include "absl/debugging/stacktrace.h"
+#include "absl/functional/function_ref.h"
+#include "absl/profiling/internal/exponential_biased.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+namespace debugging_internal {
+
+namespace {
+
+constexpr int kMaxStackDepth = 64;
+
+ABSL_CONST_INIT std::atomic<int64_t> g_leak_sampling_interval{0};
+
+base_internal::LowLevelAlloc::Arena* SamplerArena() {
+  static base_internal::LowLevelAlloc::Arena* arena =
+      base_internal::LowLevelAlloc::NewArena(
+          base_internal::LowLevelAlloc::kAsyncSignalSafe);
+  return arena;
+}
+
+uintptr_t HashPointer(uintptr_t p) {
+  // Fibonacci hashing; allocator results are aligned, so mix the low bits up.
+  return (p >> 4) * uintptr_t{0x9E3779B97F4A7C15};
+}
+
+#if ABSL_PER_THREAD_TLS
+ABSL_PER_THREAD_TLS_KEYWORD absl::profiling_internal::ExponentialBiased
+    g_leak_exponential_biased_generator;
+#endif
+
+}  // namespace
+
+#if ABSL_PER_THREAD_TLS
+ABSL_PER_THREAD_TLS_KEYWORD LeakSamplingState leak_next_sample = {0, 0};
+#endif
+
+int64_t SampleLeakAllocationSlow(LeakSamplingState& state, size_t size) {
+  // We avoid missing the first sample on a thread: on the first call
+  // `next_sample` is zero and the countdown has not been armed with a real
+  // stride yet, so re-arm and retry the decision.
+  if (ABSL_PREDICT_FALSE(state.sample_stride == 0)) {
+    const int64_t interval =
+        g_leak_sampling_interval.load(std::memory_order_relaxed);
+    if (interval <= 0) {
+      // Sampling is disabled; back off so the fast path stays fast.
+      state.next_sample = std::numeric_limits<int64_t>::max() / 2;
+      state.sample_stride = 0;
+      return 0;
+    }
+#if ABSL_PER_THREAD_TLS
+    state.sample_stride =
+        g_leak_exponential_biased_generator.GetStride(interval);
+#else
+    state.sample_stride = interval;
+#endif
+    state.next_sample = state.sample_stride;
+    return ShouldSampleLeakAllocation(size);
+  }
+
+  const int64_t interval =
+      g_leak_sampling_interval.load(std::memory_order_relaxed);
+  if (interval <= 0) {
+    state.next_sample = std::numeric_limits<int64_t>::max() / 2;
+    state.sample_stride = 0;
+    return 0;
+  }
+
+  const int64_t weight = state.sample_stride;
+#if ABSL_PER_THREAD_TLS
+  state.sample_stride =
+      g_leak_exponential_biased_generator.GetStride(interval);
+#else
+  state.sample_stride = interval;
+#endif
+  state.next_sample = state.sample_stride;
+  return weight;
+}
+
+void SetLeakSamplingIntervalBytes(int64_t interval) {
+  g_leak_sampling_interval.store(interval, std::memory_order_relaxed);
+#if ABSL_PER_THREAD_TLS
+  // Force this thread to re-arm its countdown on the next allocation.
+  leak_next_sample.next_sample = 0;
+  leak_next_sample.sample_stride = 0;
+#endif
+}
+
+int64_t LeakSamplingIntervalBytes() {
+  return g_leak_sampling_interval.load(std::memory_order_relaxed);
+}
+
+LeakSampler::LeakSampler(size_t capacity) : stack_table_() {
+  size_t slots = 1;
+  while (slots < capacity) slots <<= 1;
+  mask_ = slots - 1;
+  slots_ = static_cast<Slot*>(base_internal::LowLevelAlloc::AllocWithArena(
+      slots * sizeof(Slot), SamplerArena()));
+  memset(static_cast<void*>(slots_), 0, slots * sizeof(Slot));
+}
+
+LeakSampler::~LeakSampler() {
+  base_internal::LowLevelAlloc::Free(slots_);
+}
+
+void LeakSampler::RecordAllocation(const void* ptr, size_t size,
+                                   int64_t weight) {
+  const uintptr_t key = reinterpret_cast<uintptr_t>(ptr);
+  if (key == kEmpty || key == kTombstone || key == kBusy) return;
+
+  void* pcs[kMaxStackDepth];
+  // Skip this function and its caller (the allocator hook).
+  const int depth = absl::GetStackTrace(pcs, kMaxStackDepth, 2);
+  const uint32_t stack_id = stack_table_.Intern(pcs, depth);
+  const int64_t now_ns = absl::GetCurrentTimeNanos();
+
+  size_t i = HashPointer(key) & mask_;
+  for (size_t probes = 0; probes <= mask_; ++probes, i = (i + 1) & mask_) {
+    uintptr_t stored = slots_[i].ptr.load(std::memory_order_acquire);
+    if (stored == key) {
+      // The allocator reused an address whose free we never saw (or the
+      // caller double-recorded).  Keep the existing sample.
+      return;
+    }
+    if (stored != kEmpty && stored != kTombstone) continue;
+    // Claim the slot, fill it in, then publish the key.  Readers that see
+    // the key are guaranteed to see the fields.
+    if (!slots_[i].ptr.compare_exchange_strong(stored, kBusy,
+                                               std::memory_order_acq_rel)) {
+      --probes;
+      --i;  // Re-examine this slot; another thread changed it.
+      continue;
+    }
+    slots_[i].size = size;
+    slots_[i].weight = weight;
+    slots_[i].stack_id = stack_id;
+    slots_[i].allocation_time_ns = now_ns;
+    slots_[i].ptr.store(key, std::memory_order_release);
+    size_.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  dropped_samples_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void LeakSampler::RecordFree(const void* ptr) {
+  const uintptr_t key = reinterpret_cast<uintptr_t>(ptr);
+  if (key == kEmpty || key == kTombstone || key == kBusy) return;
+
+  size_t i = HashPointer(key) & mask_;
+  for (size_t probes = 0; probes <= mask_; ++probes, i = (i + 1) & mask_) {
+    uintptr_t stored = slots_[i].ptr.load(std::memory_order_acquire);
+    if (stored == kEmpty) return;  // Never sampled.
+    if (stored != key) continue;
+    if (slots_[i].ptr.compare_exchange_strong(stored, kTombstone,
+                                              std::memory_order_acq_rel)) {
+      size_.fetch_sub(1, std::memory_order_relaxed);
+    }
+    return;
+  }
+}
+
+void LeakSampler::IterateSurvivors(
+    absl::Duration min_age,
+    absl::FunctionRef<void(const LeakSample&)> visitor) const {
+  const int64_t now_ns = absl::GetCurrentTimeNanos();
+  for (size_t i = 0; i <= mask_; ++i) {
+    const uintptr_t key = slots_[i].ptr.load(std::memory_order_acquire);
+    if (key == kEmpty || key == kTombstone || key == kBusy) continue;
+    LeakSample sample;
+    sample.ptr = reinterpret_cast<const void*>(key);
+    sample.size = slots_[i].size;
+    sample.weight = slots_[i].weight;
+    sample.stack_id = slots_[i].stack_id;
+    sample.allocation_time = absl::FromUnixNanos(slots_[i].allocation_time_ns);
+    // Revalidate: if the slot changed while we copied it out, the fields may
+    // describe a different allocation; skip it.
+    if (slots_[i].ptr.load(std::memory_order_acquire) != key) continue;
+    if (absl::FromUnixNanos(now_ns) - sample.allocation_time < min_age) {
+      continue;
+    }
+    visitor(sample);
+  }
+}
+
+LeakSampler& GlobalLeakSampler() {
+  static absl::NoDestructor<LeakSampler> sampler;
+  return *sampler;
+}
+
+}  // namespace debugging_internal
+ABSL_NAMESPACE_END
+}  // namespace absl
@@ -0,0 +1,187 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// -----------------------------------------------------------------------------
+// File: leak_sampler.h
+// -----------------------------------------------------------------------------
+//
+// This header file defines the machinery for sampled leak detection: a
+// byte-weighted sampling decision (as in heap profiling) plus a compact
+// concurrent table of sampled live allocations, each tagged with a
+// hash-consed stack trace id and its allocation time.  Unlike the
+// LeakSanitizer integration in absl/debugging/leak_check.h, which is
+// all-or-nothing, this is cheap enough to leave enabled in production at low
+// sampling rates; allocations that survive far longer than expected can then
+// be reported as suspected leaks.
+//
+// Abseil does not hook allocators itself.  The owner of the allocator calls
+// `ShouldSampleLeakAllocation()` from its allocation path and forwards
+// sampled allocations (and all frees) to a `LeakSampler`:
+//
+//   void* Alloc(size_t size) {
+//     void* ptr = ...;
+//     if (int64_t weight =
+//             absl::debugging_internal::ShouldSampleLeakAllocation(size)) {
+//       absl::debugging_internal::GlobalLeakSampler().RecordAllocation(
+//           ptr, size, weight);
+//     }
+//     return ptr;
+//   }
+//   void Free(void* ptr) {
+//     absl::debugging_internal::GlobalLeakSampler().RecordFree(ptr);
+//     ...
+//   }
+//
+// This utility is internal-only. Use at your own risk.
+
+#ifndef ABSL_DEBUGGING_INTERNAL_LEAK_SAMPLER_H_
+#define ABSL_DEBUGGING_INTERNAL_LEAK_SAMPLER_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "absl/base/config.h"
+#include "absl/base/internal/per_thread_tls.h"
+#include "absl/base/optimization.h"
+#include "absl/functional/function_ref.h"
+#include "absl/profiling/internal/stack_trace_table.h"
+#include "absl/time/time.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+namespace debugging_internal {
+
+// A sampled allocation that is still live.
+struct LeakSample {
+  const void* ptr;
+  size_t size;
+  // Bytes of allocation traffic this sample represents (the sampling stride
+  // that selected it), for scaling reported numbers back up.
+  int64_t weight;
+  // Id of the allocation stack in `GlobalLeakSampler().stack_trace_table()`,
+  // or `StackTraceTable::kInvalidId` if the trace could not be interned.
+  uint32_t stack_id;
+  absl::Time allocation_time;
+};
+
+// LeakSampler
+//
+// A fixed-capacity concurrent table of sampled live allocations, keyed by
+// pointer.  `RecordAllocation` and `RecordFree` are lock-free and do not
+// allocate with the global allocator, so they are safe to call from inside
+// allocator hooks.  When the table is full, new samples are dropped (and
+// counted); tracked allocations are still released by `RecordFree`.
+class LeakSampler {
+ public:
+  explicit LeakSampler(size_t capacity = 1 << 14);
+  ~LeakSampler();
+
+  LeakSampler(const LeakSampler&) = delete;
+  LeakSampler& operator=(const LeakSampler&) = delete;
+
+  // Starts tracking `ptr`, capturing the current stack trace.  `weight` is
+  // the value returned by `ShouldSampleLeakAllocation()`.
+  void RecordAllocation(const void* ptr, size_t size, int64_t weight);
+
+  // Stops tracking `ptr`.  Cheap for pointers that were never sampled.
+  void RecordFree(const void* ptr);
+
+  // Calls `visitor` for every tracked allocation at least `min_age` old.
+  // Runs concurrently with `RecordAllocation`/`RecordFree`; a sample may be
+  // freed while or just after it is visited.  Pass `absl::ZeroDuration()` to
+  // visit all tracked allocations.
+  void IterateSurvivors(absl::Duration min_age,
+                        absl::FunctionRef<void(const LeakSample&)> visitor)
+      const;
+
+  // Table holding the allocation stacks of the samples.
+  absl::profiling_internal::StackTraceTable& stack_trace_table() {
+    return stack_table_;
+  }
+
+  // Number of currently tracked allocations.
+  size_t size() const { return size_.load(std::memory_order_relaxed); }
+
+  // Number of samples dropped because the table was full.
+  size_t dropped_samples() const {
+    return dropped_samples_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  struct Slot {
+    // Pointer value of the tracked allocation; kEmpty, kTombstone, or kBusy
+    // when the slot does not hold a published sample.
+    std::atomic<uintptr_t> ptr{0};
+    size_t size;
+    int64_t weight;
+    uint32_t stack_id;
+    int64_t allocation_time_ns;
+  };
+
+  static constexpr uintptr_t kEmpty = 0;
+  static constexpr uintptr_t kTombstone = 1;
+  static constexpr uintptr_t kBusy = 2;
+
+  size_t mask_;  // Number of slots minus one (power of two).
+  Slot* slots_;
+  std::atomic<size_t> size_{0};
+  std::atomic<size_t> dropped_samples_{0};
+  absl::profiling_internal::StackTraceTable stack_table_;
+};
+
+// Returns the process-wide sampler fed by `ShouldSampleLeakAllocation()`.
+LeakSampler& GlobalLeakSampler();
+
+// Sets the mean number of allocated bytes between samples.  At 1 MiB, for
+// example, roughly one in 16384 64-byte allocations is sampled.  Zero (the
+// default) disables sampling.
+void SetLeakSamplingIntervalBytes(int64_t interval);
+int64_t LeakSamplingIntervalBytes();
+
+struct LeakSamplingState {
+  int64_t next_sample;  // Bytes until the next sample, counted down.
+  int64_t sample_stride;
+};
+
+// Re-arms the per-thread countdown and decides whether this allocation is
+// sampled.  Do not call directly; use `ShouldSampleLeakAllocation()`.
+int64_t SampleLeakAllocationSlow(LeakSamplingState& state, size_t size);
+
+#if ABSL_PER_THREAD_TLS
+extern ABSL_PER_THREAD_TLS_KEYWORD LeakSamplingState leak_next_sample;
+#endif
+
+// Returns a positive weight if an allocation of `size` bytes should be
+// sampled, and 0 otherwise.  The fast path is a single thread-local
+// decrement.  On platforms without thread-local storage, sampling is
+// permanently disabled.
+inline int64_t ShouldSampleLeakAllocation(size_t size) {
+#if ABSL_PER_THREAD_TLS
+  if (ABSL_PREDICT_TRUE(
+          (leak_next_sample.next_sample -= static_cast<int64_t>(size)) > 0)) {
+    return 0;
+  }
+  return SampleLeakAllocationSlow(leak_next_sample, size);
+#else
+  static_cast<void>(size);
+  return 0;
+#endif
+}
+
+}  // namespace debugging_internal
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_DEBUGGING_INTERNAL_LEAK_SAMPLER_H_
@@ -0,0 +1,166 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/debugging/internal/leak_sampler.h"
+
+#include <cstdint>
+#include <thread>  // NOLINT(build/c++11)
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "absl/base/internal/per_thread_tls.h"
+#include "absl/debugging/stacktrace.h"
+#include "absl/profiling/internal/stack_trace_table.h"
+#include "absl/time/time.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+namespace debugging_internal {
+namespace {
+
+TEST(LeakSampler, RecordAndFree) {
+  LeakSampler sampler(64);
+  int a, b;
+
+  sampler.RecordAllocation(&a, sizeof(a), 1000);
+  sampler.RecordAllocation(&b, sizeof(b), 2000);
+  EXPECT_EQ(sampler.size(), 2);
+
+  int seen = 0;
+  sampler.IterateSurvivors(absl::ZeroDuration(),
+                           [&](const LeakSample& sample) {
+                             ++seen;
+                             if (sample.ptr == &a) {
+                               EXPECT_EQ(sample.size, sizeof(a));
+                               EXPECT_EQ(sample.weight, 1000);
+                             }
+                           });
+  EXPECT_EQ(seen, 2);
+
+  sampler.RecordFree(&a);
+  EXPECT_EQ(sampler.size(), 1);
+  sampler.IterateSurvivors(absl::ZeroDuration(), [&](const LeakSample& sample) {
+    EXPECT_EQ(sample.ptr, &b);
+  });
+
+  // Freeing an untracked pointer is a no-op.
+  sampler.RecordFree(&a);
+  EXPECT_EQ(sampler.size(), 1);
+}
+
+TEST(LeakSampler, CapturesStacks) {
+  void* probe[8];
+  if (absl::GetStackTrace(probe, 8, 0) <= 0) {
+    GTEST_SKIP() << "unwinder produces no frames in this build";
+  }
+
+  LeakSampler sampler(64);
+  int a;
+  sampler.RecordAllocation(&a, sizeof(a), 1);
+
+  uint32_t stack_id = profiling_internal::StackTraceTable::kInvalidId;
+  sampler.IterateSurvivors(absl::ZeroDuration(), [&](const LeakSample& sample) {
+    stack_id = sample.stack_id;
+  });
+  ASSERT_NE(stack_id, profiling_internal::StackTraceTable::kInvalidId);
+
+  const void* pcs[64];
+  EXPECT_GT(sampler.stack_trace_table().GetTrace(stack_id, pcs, 64), 0);
+}
+
+TEST(LeakSampler, MinAgeFiltersYoungAllocations) {
+  LeakSampler sampler(64);
+  int a;
+  sampler.RecordAllocation(&a, sizeof(a), 1);
+
+  int seen = 0;
+  sampler.IterateSurvivors(absl::Hours(1),
+                           [&](const LeakSample&) { ++seen; });
+  EXPECT_EQ(seen, 0);
+  sampler.IterateSurvivors(absl::ZeroDuration(),
+                           [&](const LeakSample&) { ++seen; });
+  EXPECT_EQ(seen, 1);
+}
+
+TEST(LeakSampler, DropsWhenFull) {
+  LeakSampler sampler(4);
+  std::vector<int> storage(16);
+  for (int& p : storage) {
+    sampler.RecordAllocation(&p, sizeof(p), 1);
+  }
+  EXPECT_EQ(sampler.size(), 4);
+  EXPECT_EQ(sampler.dropped_samples(), 12);
+
+  // Tracked allocations can still be freed.
+  int seen = 0;
+  sampler.IterateSurvivors(absl::ZeroDuration(), [&](const LeakSample& sample) {
+    ++seen;
+    sampler.RecordFree(sample.ptr);
+  });
+  EXPECT_EQ(seen, 4);
+  EXPECT_EQ(sampler.size(), 0);
+}
+
+TEST(LeakSampler, SamplingDisabledByDefault) {
+  for (int i = 0; i < 1000; ++i) {
+    EXPECT_EQ(ShouldSampleLeakAllocation(1 << 20), 0);
+  }
+}
+
+#if ABSL_PER_THREAD_TLS
+TEST(LeakSampler, SamplesAtConfiguredRate) {
+  SetLeakSamplingIntervalBytes(1 << 16);
+  constexpr int kAllocations = 100000;
+  constexpr size_t kSize = 64;
+  int64_t sampled_bytes = 0;
+  for (int i = 0; i < kAllocations; ++i) {
+    sampled_bytes += ShouldSampleLeakAllocation(kSize);
+  }
+  SetLeakSamplingIntervalBytes(0);
+
+  // The summed weights estimate total allocated bytes.
+  const double allocated = static_cast<double>(kAllocations) * kSize;
+  EXPECT_GT(sampled_bytes, allocated * 0.5);
+  EXPECT_LT(sampled_bytes, allocated * 2.0);
+}
+#endif
+
+TEST(LeakSampler, ConcurrentRecordAndFree) {
+  LeakSampler sampler(1 << 10);
+  constexpr int kThreads = 8;
+  constexpr int kPerThread = 100;
+  std::vector<std::vector<int>> storage(kThreads,
+                                        std::vector<int>(kPerThread));
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&, t] {
+      for (int rep = 0; rep < 50; ++rep) {
+        for (int i = 0; i < kPerThread; ++i) {
+          sampler.RecordAllocation(&storage[t][i], sizeof(int), 1);
+        }
+        for (int i = 0; i < kPerThread; ++i) {
+          sampler.RecordFree(&storage[t][i]);
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  EXPECT_EQ(sampler.size(), 0);
+  EXPECT_EQ(sampler.dropped_samples(), 0);
+}
+
+}  // namespace
+}  // namespace debugging_internal
+ABSL_NAMESPACE_END
+}  // namespace absl
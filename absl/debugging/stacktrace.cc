@@ -66,13 +66,15 @@ typedef int (*Unwinder)(void**, int*, int, int, const void*, int*);
 std::atomic<Unwinder> custom;
 
 template <bool IS_STACK_FRAMES, bool IS_WITH_CONTEXT>
-ABSL_ATTRIBUTE_ALWAYS_INLINE inline int Unwind(void** result, int* sizes,
-                                               int max_depth, int skip_count,
-                                               const void* uc,
-                                               int* min_dropped_frames) {
+ABSL_ATTRIBUTE_ALWAYS_INLINE inline int Unwind(
+    void** result, int* sizes, int max_depth, int skip_count, const void* uc,
+    int* min_dropped_frames,
+    StackUnwindMode mode = StackUnwindMode::kAccurate) {
   Unwinder f = &UnwindImpl<IS_STACK_FRAMES, IS_WITH_CONTEXT>;
-  Unwinder g = custom.load(std::memory_order_acquire);
-  if (g != nullptr) f = g;
+  if (mode != StackUnwindMode::kFast) {
+    Unwinder g = custom.load(std::memory_order_acquire);
+    if (g != nullptr) f = g;
+  }
 
   // Add 1 to skip count for the unwinder function itself
   int size = (*f)(result, sizes, max_depth, skip_count + 1, uc,
@@ -111,6 +113,20 @@ GetStackTraceWithContext(void** result, int max_depth, int skip_count,
                              min_dropped_frames);
 }
 
+ABSL_ATTRIBUTE_NOINLINE ABSL_ATTRIBUTE_NO_TAIL_CALL int GetStackTraceWithMode(
+    void** result, int max_depth, int skip_count, StackUnwindMode mode) {
+  return Unwind<false, false>(result, nullptr, max_depth, skip_count, nullptr,
+                              nullptr, mode);
+}
+
+ABSL_ATTRIBUTE_NOINLINE ABSL_ATTRIBUTE_NO_TAIL_CALL int
+GetStackTraceWithContextAndMode(void** result, int max_depth, int skip_count,
+                                const void* uc, int* min_dropped_frames,
+                                StackUnwindMode mode) {
+  return Unwind<false, true>(result, nullptr, max_depth, skip_count, uc,
+                             min_dropped_frames, mode);
+}
+
 void SetStackUnwinder(Unwinder w) {
   custom.store(w, std::memory_order_release);
 }
@@ -156,6 +156,44 @@ extern int GetStackTraceWithContext(void** result, int max_depth,
                                     int skip_count, const void* uc,
                                     int* min_dropped_frames);
 
+// StackUnwindMode
+//
+// Selects which unwinder services a single unwind request when a custom
+// unwinder has been installed with `absl::SetStackUnwinder()`.
+enum class StackUnwindMode {
+  // Use the custom unwinder if one is installed, falling back to the built-in
+  // unwinder otherwise. This matches the behavior of
+  // `GetStack{Trace,Frames}{,WithContext}()`, and is what crash paths such as
+  // the failure signal handler should use: a custom unwinder is typically
+  // installed precisely because it produces more accurate traces.
+  kAccurate,
+  // Always use the built-in unwinder, bypassing any custom unwinder. The
+  // built-in unwinders walk frame pointers (or the platform equivalent)
+  // without allocating, so their cost is small and linear in the number of
+  // frames walked. High-frequency samplers should use this mode with a small
+  // `max_depth`: together they put a hard budget on the cost of each unwind,
+  // independent of how expensive an installed custom unwinder may be.
+  kFast,
+};
+
+// GetStackTraceWithMode()
+//
+// Like `absl::GetStackTrace()`, but with an explicit choice of unwinder for
+// this call. See `absl::StackUnwindMode` for when to prefer each mode.
+extern int GetStackTraceWithMode(void** result, int max_depth, int skip_count,
+                                 StackUnwindMode mode);
+
+// GetStackTraceWithContextAndMode()
+//
+// Like `absl::GetStackTraceWithContext()`, but with an explicit choice of
+// unwinder for this call. Intended for signal-driven samplers (e.g. SIGPROF
+// handlers) that pass the interrupted thread's `ucontext_t` and want the
+// bounded-cost behavior of `StackUnwindMode::kFast`.
+extern int GetStackTraceWithContextAndMode(void** result, int max_depth,
+                                           int skip_count, const void* uc,
+                                           int* min_dropped_frames,
+                                           StackUnwindMode mode);
+
 // SetStackUnwinder()
 //
 // Provides a custom function for unwinding stack frames that will be used in
@@ -14,6 +14,8 @@
 
 #include "absl/debugging/stacktrace.h"
 
+#include <cstdint>
+
 #include "gtest/gtest.h"
 #include "absl/base/macros.h"
 #include "absl/base/optimization.h"
@@ -44,4 +46,30 @@ TEST(StackTrace, HugeFrame) {
 }
 #endif
 
+int FakeUnwinder(void** pcs, int*, int max_depth, int, const void*, int*) {
+  if (max_depth < 1) return 0;
+  pcs[0] = reinterpret_cast<void*>(uintptr_t{0xdeadbeef});
+  return 1;
+}
+
+TEST(StackTrace, FastModeBypassesCustomUnwinder) {
+  absl::SetStackUnwinder(FakeUnwinder);
+  void* stack[16];
+
+  // Accurate mode (and the legacy entry points) use the custom unwinder.
+  ASSERT_EQ(absl::GetStackTraceWithMode(stack, 16, 0,
+                                        absl::StackUnwindMode::kAccurate),
+            1);
+  EXPECT_EQ(stack[0], reinterpret_cast<void*>(uintptr_t{0xdeadbeef}));
+
+  // Fast mode goes straight to the built-in unwinder.
+  int depth = absl::GetStackTraceWithMode(stack, 16, 0,
+                                          absl::StackUnwindMode::kFast);
+  if (depth > 0) {
+    EXPECT_NE(stack[0], reinterpret_cast<void*>(uintptr_t{0xdeadbeef}));
+  }
+
+  absl::SetStackUnwinder(nullptr);
+}
+
 }  // namespace
@@ -41,3 +41,26 @@
 #else
 #include "absl/debugging/symbolize_unimplemented.inc"
 #endif
+
+// Symbolizers that do not provide a batched implementation fall back to
+// symbolizing one frame at a time.
+#ifndef ABSL_INTERNAL_HAVE_SYMBOLIZE_BATCH
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+int SymbolizeBatch(const void *const *pcs, int num_pcs, char *const *outs,
+                   int out_size) {
+  int num_symbolized = 0;
+  for (int i = 0; i < num_pcs; ++i) {
+    if (Symbolize(pcs[i], outs[i], out_size)) {
+      ++num_symbolized;
+    } else if (out_size > 0) {
+      outs[i][0] = '\0';
+    }
+  }
+  return num_symbolized;
+}
+
+ABSL_NAMESPACE_END
+}  // namespace absl
+#endif  // ABSL_INTERNAL_HAVE_SYMBOLIZE_BATCH
@@ -93,6 +93,21 @@ void InitializeSymbolizer(const char* argv0);
 //  }
 bool Symbolize(const void *pc, char *out, int out_size);
 
+// SymbolizeBatch()
+//
+// Symbolizes each of the `num_pcs` program counters in `pcs`, writing the
+// name of `pcs[i]` to the caller-owned buffer `outs[i]` of size `out_size`,
+// with the same per-frame semantics as `Symbolize()`. Buffers of frames that
+// cannot be symbolized are set to the empty string. Returns the number of
+// frames successfully symbolized.
+//
+// Symbolizing a whole stack trace this way is substantially cheaper than
+// calling `Symbolize()` once per frame: frames that live in the same object
+// file share a single sweep over that object's symbol tables. Crash handlers
+// and profilers that symbolize in bulk should prefer this function.
+int SymbolizeBatch(const void *const *pcs, int num_pcs, char *const *outs,
+                   int out_size);
+
 ABSL_NAMESPACE_END
 }  // namespace absl
 
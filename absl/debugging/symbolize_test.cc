@@ -187,6 +187,37 @@ TEST(Symbolize, Cached) {
   EXPECT_TRUE(nullptr == TrySymbolize(nullptr));
 }
 
+TEST(Symbolize, SymbolizeBatch) {
+  void *pcs[] = {
+      GetPCFromFnPtr((void *)(&nonstatic_func)),
+      nullptr,  // not symbolizable
+      GetPCFromFnPtr((void *)(&Foo::func)),
+      GetPCFromFnPtr((void *)(&nonstatic_func)),  // repeated frame
+  };
+  constexpr int kNumPcs = sizeof(pcs) / sizeof(pcs[0]);
+  char bufs[kNumPcs][1024];
+  char *outs[kNumPcs];
+  for (int i = 0; i < kNumPcs; ++i) {
+    outs[i] = bufs[i];
+  }
+
+  EXPECT_EQ(kNumPcs - 1,
+            absl::SymbolizeBatch(pcs, kNumPcs, outs, sizeof(bufs[0])));
+  EXPECT_STREQ("nonstatic_func", bufs[0]);
+  EXPECT_STREQ("", bufs[1]);
+  EXPECT_STREQ(TrySymbolize(pcs[2]), bufs[2]);
+  EXPECT_STREQ("nonstatic_func", bufs[3]);
+
+  // Batched results agree with per-frame Symbolize(), including the
+  // truncation behavior.
+  char small_buf[5];
+  char *small_outs[] = {small_buf};
+  EXPECT_EQ(1, absl::SymbolizeBatch(pcs, 1, small_outs, sizeof(small_buf)));
+  EXPECT_STREQ("n...", small_buf);
+
+  EXPECT_EQ(0, absl::SymbolizeBatch(pcs, 0, outs, sizeof(bufs[0])));
+}
+
 TEST(Symbolize, Truncation) {
   constexpr char kNonStaticFunc[] = "nonstatic_func";
   EXPECT_STREQ("nonstatic_func",
@@ -15,7 +15,9 @@
 
 #include "absl/flags/commandlineflag.h"
 
+#include <functional>
 #include <string>
+#include <utility>
 
 #include "absl/base/config.h"
 #include "absl/flags/internal/commandlineflag.h"
@@ -25,10 +27,16 @@ namespace absl {
 ABSL_NAMESPACE_BEGIN
 
 bool CommandLineFlag::IsRetired() const { return false; }
+const char* CommandLineFlag::RawFilename() const { return nullptr; }
 bool CommandLineFlag::ParseFrom(absl::string_view value, std::string* error) {
   return ParseFrom(value, flags_internal::SET_FLAGS_VALUE,
                    flags_internal::kProgrammaticChange, *error);
 }
+void CommandLineFlag::RegisterChangeCallback(std::function<void()>) {}
+
+void OnFlagChange(CommandLineFlag& flag, std::function<void()> callback) {
+  flag.RegisterChangeCallback(std::move(callback));
+}
 
 ABSL_NAMESPACE_END
 }  // namespace absl
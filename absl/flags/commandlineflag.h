@@ -26,6 +26,7 @@
 #ifndef ABSL_FLAGS_COMMANDLINEFLAG_H_
 #define ABSL_FLAGS_COMMANDLINEFLAG_H_
 
+#include <functional>
 #include <memory>
 #include <string>
 
@@ -165,6 +166,8 @@ class CommandLineFlag {
 
  private:
   friend class flags_internal::PrivateHandleAccessor;
+  friend void OnFlagChange(CommandLineFlag& flag,
+                           std::function<void()> callback);
 
   // Sets the value of the flag based on specified string `value`. If the flag
   // was successfully set to new value, it returns true. Otherwise, sets `error`
@@ -182,6 +185,12 @@ class CommandLineFlag {
   // Returns id of the flag's value type.
   virtual flags_internal::FlagFastTypeId TypeId() const = 0;
 
+  // Returns the filename passed to the flag's definition, without the
+  // usage-config normalization applied by `Filename()`, or nullptr if it is
+  // not available. Used to cheaply validate registrations at static
+  // initialization time.
+  virtual const char* RawFilename() const;
+
   // Interface to save flag to some persistent state. Returns current flag state
   // or nullptr if flag does not support saving and restoring a state.
   virtual std::unique_ptr<flags_internal::FlagStateInterface> SaveState() = 0;
@@ -200,11 +209,33 @@ class CommandLineFlag {
   // Checks that flags default value can be converted to string and back to the
   // flag's value type.
   virtual void CheckDefaultValueParsingRoundtrip() const = 0;
+
+  // Registers a callback to be invoked every time the flag's value changes.
+  // The default implementation silently ignores the registration; it is
+  // overridden by flag implementations that support change notification.
+  virtual void RegisterChangeCallback(std::function<void()> callback);
 };
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic pop
 #endif
 
+// OnFlagChange()
+//
+// Registers `callback` to be invoked every time the value of `flag` changes
+// at runtime, whether via `absl::SetFlag`, `absl::SetCommandLineOption` or
+// flag state restoration. This allows reconfiguration to be push-based
+// instead of polling the flag's value:
+//
+//   absl::CommandLineFlag* flag = absl::FindCommandLineFlag("vlog_level");
+//   absl::OnFlagChange(*flag, [] { ReconfigureLogging(); });
+//
+// The callback is not invoked at registration time; read the flag once after
+// registering to pick up the current value. Callbacks registered on the same
+// flag are invoked serially in registration order, without any flag locks
+// held, and cannot be unregistered, so anything the callback references must
+// outlive the flag. Registrations on retired flags are silently ignored.
+void OnFlagChange(CommandLineFlag& flag, std::function<void()> callback);
+
 ABSL_NAMESPACE_END
 }  // namespace absl
 
@@ -233,4 +233,42 @@ TEST_F(CommandLineFlagTest, TestParseFromIfDefault) {
   // EXPECT_EQ(err, "ERROR: int_flag is already set to 201");
 }
 
+// --------------------------------------------------------------------
+
+// Callbacks cannot be unregistered and may be invoked by flag restoration
+// in the test fixture's TearDown, so the counters must outlive the test.
+int on_change_counter_1 = 0;
+int on_change_counter_2 = 0;
+
+TEST_F(CommandLineFlagTest, TestOnFlagChange) {
+  std::string err;
+
+  auto* flag_01 = absl::FindCommandLineFlag("int_flag2");
+  ASSERT_TRUE(flag_01);
+
+  absl::OnFlagChange(*flag_01, [] { ++on_change_counter_1; });
+  absl::OnFlagChange(*flag_01, [] { ++on_change_counter_2; });
+
+  // Registration alone does not invoke the callbacks.
+  EXPECT_EQ(on_change_counter_1, 0);
+  EXPECT_EQ(on_change_counter_2, 0);
+
+  EXPECT_TRUE(flag_01->ParseFrom("404", &err)) << err;
+  EXPECT_EQ(on_change_counter_1, 1);
+  EXPECT_EQ(on_change_counter_2, 1);
+
+  absl::SetFlag(&FLAGS_int_flag2, 505);
+  EXPECT_EQ(on_change_counter_1, 2);
+  EXPECT_EQ(on_change_counter_2, 2);
+
+  // A failed update does not invoke the callbacks.
+  EXPECT_FALSE(flag_01->ParseFrom("not a number", &err));
+  EXPECT_EQ(on_change_counter_1, 2);
+
+  // Registrations on retired flags are silently ignored.
+  auto* flag_02 = absl::FindCommandLineFlag("bool_retired_flag");
+  ASSERT_TRUE(flag_02);
+  absl::OnFlagChange(*flag_02, [] { ++on_change_counter_1; });
+}
+
 }  // namespace
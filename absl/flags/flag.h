@@ -119,6 +119,57 @@ void SetFlag(absl::Flag<T>* flag, const V& v) {
   flags_internal::FlagImplPeer::InvokeSet(*flag, value);
 }
 
+// FlagReader
+//
+// An `absl::FlagReader<T>` caches a snapshot of an `absl::Flag<T>`'s value and
+// refreshes it only when the flag is modified.  `absl::GetFlag()` on a flag
+// whose type is not trivially copyable (e.g. `std::string`) acquires a mutex
+// and copies the value on every call; a `FlagReader` reduces the steady-state
+// cost of such reads to one atomic load and a comparison, making it suitable
+// for hot paths that consult a rarely-changing flag.
+//
+// A `FlagReader` is not itself thread-safe: each instance must be used from a
+// single thread or guarded externally (a `thread_local` instance is a common
+// choice).  The snapshot is eventually consistent with the flag's value: a
+// `Get()` that races with a concurrent flag modification may return the
+// previous value, but a subsequent `Get()` will observe the change.
+//
+// Example:
+//
+//   // FLAGS_backend is a Flag of type `std::string`
+//   thread_local absl::FlagReader<std::string> reader(FLAGS_backend);
+//   const std::string& backend = reader.Get();
+template <typename T>
+class FlagReader {
+ public:
+  explicit FlagReader(const absl::Flag<T>& flag)
+      : flag_(&flag),
+        epoch_(flags_internal::FlagImplPeer::InvokeReadEpoch(flag)),
+        value_(absl::GetFlag(flag)) {}
+
+  FlagReader(const FlagReader&) = delete;
+  FlagReader& operator=(const FlagReader&) = delete;
+
+  // Returns a reference to the cached value, refreshing it first if the flag
+  // has been modified since the last refresh.  The reference is invalidated by
+  // the next call to `Get()`.
+  const T& Get() {
+    // The epoch is sampled before the value so that a modification landing
+    // between the two loads leaves the cache marked stale rather than fresh.
+    int64_t epoch = flags_internal::FlagImplPeer::InvokeReadEpoch(*flag_);
+    if (ABSL_PREDICT_FALSE(epoch != epoch_)) {
+      epoch_ = epoch;
+      value_ = absl::GetFlag(*flag_);
+    }
+    return value_;
+  }
+
+ private:
+  const absl::Flag<T>* flag_;
+  int64_t epoch_;
+  T value_;
+};
+
 // GetFlagReflectionHandle()
 //
 // Returns the reflection handle corresponding to specified Abseil Flag
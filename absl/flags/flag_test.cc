@@ -621,6 +621,26 @@ TEST_F(FlagTest, TestGetSet) {
 
 // --------------------------------------------------------------------
 
+TEST_F(FlagTest, TestFlagReader) {
+  absl::SetFlag(&FLAGS_test_flag_11, "initial");
+  absl::FlagReader<std::string> reader(FLAGS_test_flag_11);
+  EXPECT_EQ(reader.Get(), "initial");
+  // Repeated reads of an unmodified flag hit the cache.
+  EXPECT_EQ(reader.Get(), "initial");
+
+  absl::SetFlag(&FLAGS_test_flag_11, "modified");
+  EXPECT_EQ(reader.Get(), "modified");
+
+  // FlagReader also works with flags whose reads are already lock-free.
+  absl::SetFlag(&FLAGS_test_flag_02, 321);
+  absl::FlagReader<int> int_reader(FLAGS_test_flag_02);
+  EXPECT_EQ(int_reader.Get(), 321);
+  absl::SetFlag(&FLAGS_test_flag_02, 654);
+  EXPECT_EQ(int_reader.Get(), 654);
+}
+
+// --------------------------------------------------------------------
+
 TEST_F(FlagTest, TestGetViaReflection) {
 #if ABSL_FLAGS_STRIP_NAMES
   GTEST_SKIP() << "This test requires flag names to be present";
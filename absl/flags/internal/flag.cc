@@ -22,10 +22,13 @@
 
 #include <array>
 #include <atomic>
+#include <functional>
 #include <memory>
 #include <new>
 #include <string>
 #include <typeinfo>
+#include <utility>
+#include <vector>
 
 #include "absl/base/call_once.h"
 #include "absl/base/casts.h"
@@ -264,6 +267,8 @@ std::string FlagImpl::Filename() const {
   return flags_internal::GetUsageConfig().normalize_filename(filename_);
 }
 
+const char* FlagImpl::RawFilename() const { return filename_; }
+
 std::string FlagImpl::Help() const {
   return HelpSourceKind() == FlagHelpKind::kLiteral ? help_.literal
                                                     : help_.gen_func();
@@ -325,12 +330,23 @@ void FlagImpl::SetCallback(const FlagCallbackFunc mutation_callback) {
   InvokeCallback();
 }
 
+void FlagImpl::RegisterChangeCallback(std::function<void()> callback) {
+  absl::MutexLock l(DataGuard());
+
+  if (callback_ == nullptr) {
+    callback_ = new FlagCallback;
+  }
+  callback_->change_callbacks.push_back(std::move(callback));
+}
+
 void FlagImpl::InvokeCallback() const {
   if (!callback_) return;
 
-  // Make a copy of the C-style function pointer that we are about to invoke
-  // before we release the lock guarding it.
+  // Make a copy of the callbacks that we are about to invoke before we
+  // release the lock guarding them.
   FlagCallbackFunc cb = callback_->func;
+  std::vector<std::function<void()>> change_callbacks =
+      callback_->change_callbacks;
 
   // If the flag has a mutation callback this function invokes it. While the
   // callback is being invoked the primary flag's mutex is unlocked and it is
@@ -345,7 +361,8 @@ void FlagImpl::InvokeCallback() const {
   // released and reacquired by the implementation.
   MutexRelock relock(*DataGuard());
   absl::MutexLock lock(&callback_->guard);
-  cb();
+  if (cb != nullptr) cb();
+  for (const auto& change_callback : change_callbacks) change_callback();
 }
 
 std::unique_ptr<FlagStateInterface> FlagImpl::SaveState() {
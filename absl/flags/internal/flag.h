@@ -21,10 +21,12 @@
 
 #include <atomic>
 #include <cstring>
+#include <functional>
 #include <memory>
 #include <string>
 #include <type_traits>
 #include <typeinfo>
+#include <vector>
 
 #include "absl/base/attributes.h"
 #include "absl/base/call_once.h"
@@ -407,7 +409,9 @@ struct FlagValue<T, FlagValueStorageKind::kAlignedBuffer> {
 using FlagCallbackFunc = void (*)();
 
 struct FlagCallback {
-  FlagCallbackFunc func;
+  FlagCallbackFunc func = nullptr;
+  // Change notification callbacks registered via absl::OnFlagChange.
+  std::vector<std::function<void()>> change_callbacks;
   absl::Mutex guard;  // Guard for concurrent callback invocations.
 };
 
@@ -478,6 +482,8 @@ class FlagImpl final : public CommandLineFlag {
   // Interfaces to operate on callbacks.
   void SetCallback(const FlagCallbackFunc mutation_callback)
       ABSL_LOCKS_EXCLUDED(*DataGuard());
+  void RegisterChangeCallback(std::function<void()> callback) override
+      ABSL_LOCKS_EXCLUDED(*DataGuard());
   void InvokeCallback() const ABSL_EXCLUSIVE_LOCKS_REQUIRED(*DataGuard());
 
   // Used in read/write operations to validate source/target has correct type.
@@ -551,6 +557,7 @@ class FlagImpl final : public CommandLineFlag {
   // CommandLineFlag interface implementation
   absl::string_view Name() const override;
   std::string Filename() const override;
+  const char* RawFilename() const override;
   std::string Help() const override;
   FlagFastTypeId TypeId() const override;
   bool IsSpecifiedOnCommandLine() const override
@@ -686,6 +693,10 @@ class Flag {
     impl_.Write(&v);
   }
 
+  // Returns an opaque version number for the flag's value; see
+  // `SequenceLock::ReadEpoch()`.
+  int64_t ReadEpoch() const { return impl_.seq_lock_.ReadEpoch(); }
+
   // Access to the reflection.
   const CommandLineFlag& Reflect() const { return impl_; }
 
@@ -714,6 +725,10 @@ class FlagImplPeer {
   static const CommandLineFlag& InvokeReflect(const FlagType& f) {
     return f.Reflect();
   }
+  template <typename FlagType>
+  static int64_t InvokeReadEpoch(const FlagType& flag) {
+    return flag.ReadEpoch();
+  }
 };
 
 ///////////////////////////////////////////////////////////////////////////////
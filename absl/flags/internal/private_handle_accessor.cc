@@ -31,6 +31,10 @@ FlagFastTypeId PrivateHandleAccessor::TypeId(const CommandLineFlag& flag) {
   return flag.TypeId();
 }
 
+const char* PrivateHandleAccessor::RawFilename(const CommandLineFlag& flag) {
+  return flag.RawFilename();
+}
+
 std::unique_ptr<FlagStateInterface> PrivateHandleAccessor::SaveState(
     CommandLineFlag& flag) {
   return flag.SaveState();
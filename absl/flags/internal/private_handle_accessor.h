@@ -36,6 +36,9 @@ class PrivateHandleAccessor {
   // Access to CommandLineFlag::TypeId.
   static FlagFastTypeId TypeId(const CommandLineFlag& flag);
 
+  // Access to CommandLineFlag::RawFilename.
+  static const char* RawFilename(const CommandLineFlag& flag);
+
   // Access to CommandLineFlag::SaveState.
   static std::unique_ptr<FlagStateInterface> SaveState(CommandLineFlag& flag);
 
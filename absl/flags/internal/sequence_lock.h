@@ -128,6 +128,14 @@ class SequenceLock {
     return val / 2;
   }
 
+  // Returns an opaque version number for the protected data.  Unlike
+  // `ModificationCount()`, this may be called concurrently with writes; the
+  // counter only moves forward, so if two calls return the same value, no
+  // write completed between them.  The value returned while a `Write()` is in
+  // progress (or before `MarkInitialized()`) is transient and will not be
+  // returned again once the write completes.
+  int64_t ReadEpoch() const { return lock_.load(std::memory_order_acquire); }
+
   // REQUIRES: This must be externally synchronized against concurrent calls to
   // `Write()` or `ModificationCount()`.
   // REQUIRES: `MarkInitialized()` must have been previously called.
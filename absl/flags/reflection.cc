@@ -18,7 +18,10 @@
 #include <assert.h>
 
 #include <atomic>
+#include <cstring>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "absl/base/config.h"
 #include "absl/base/no_destructor.h"
@@ -68,13 +71,28 @@ class FlagRegistry {
   friend void ForEachFlag(std::function<void(CommandLineFlag&)> visitor);
   friend void FinalizeRegistry();
 
-  // The map from name to flag, for FindFlag().
+  // The map from name to flag, for FindFlag(). Cleared by FinalizeRegistry();
+  // flags registered after finalization (e.g. from a dynamically loaded
+  // library) are still inserted here for duplicate detection.
   using FlagMap = absl::flat_hash_map<absl::string_view, CommandLineFlag*>;
   using FlagIterator = FlagMap::iterator;
   using FlagConstIterator = FlagMap::const_iterator;
   FlagMap flags_;
-  std::vector<CommandLineFlag*> flat_flags_;
-  std::atomic<bool> finalized_flags_{false};
+
+  // An immutable name-sorted snapshot of all registered flags. Names are
+  // materialized so that lookups binary-search contiguous string_views
+  // instead of making a virtual Name() call per probe.
+  struct FlagSnapshot {
+    std::vector<std::pair<absl::string_view, CommandLineFlag*>> flags;
+  };
+  // The current snapshot, built by FinalizeRegistry() and republished
+  // wholesale on each later registration (RCU-style), so that FindFlag() and
+  // ForEachFlag() never take lock_ in steady state. Superseded snapshots are
+  // parked in retired_snapshots_, since lock-free readers may still be
+  // iterating over them.
+  std::atomic<FlagSnapshot*> snapshot_{nullptr};
+  std::vector<std::unique_ptr<FlagSnapshot>> retired_snapshots_
+      ABSL_GUARDED_BY(lock_);
 
   absl::Mutex lock_;
 
@@ -97,13 +115,16 @@ class FlagRegistryLock {
 }  // namespace
 
 CommandLineFlag* FlagRegistry::FindFlag(absl::string_view name) {
-  if (finalized_flags_.load(std::memory_order_acquire)) {
-    // We could save some gcus here if we make `Name()` be non-virtual.
-    // We could move the `const char*` name to the base class.
+  if (const FlagSnapshot* snapshot =
+          snapshot_.load(std::memory_order_acquire)) {
     auto it = std::partition_point(
-        flat_flags_.begin(), flat_flags_.end(),
-        [=](CommandLineFlag* f) { return f->Name() < name; });
-    if (it != flat_flags_.end() && (*it)->Name() == name) return *it;
+        snapshot->flags.begin(), snapshot->flags.end(),
+        [=](const std::pair<absl::string_view, CommandLineFlag*>& f) {
+          return f.first < name;
+        });
+    if (it != snapshot->flags.end() && it->first == name) return it->second;
+    // The snapshot covers every registered flag, so a miss is definitive.
+    return nullptr;
   }
 
   FlagRegistryLock frl(*this);
@@ -112,7 +133,17 @@ CommandLineFlag* FlagRegistry::FindFlag(absl::string_view name) {
 }
 
 void FlagRegistry::RegisterFlag(CommandLineFlag& flag, const char* filename) {
+  // Both filenames normally originate from the same ABSL_FLAG expansion, in
+  // which case a raw string comparison suffices. The normalized comparison
+  // below copies the usage config and allocates, which is a measurable cost
+  // when run per flag at static initialization time, so save it for
+  // registrations that fail the cheap check.
+  const char* raw_filename =
+      filename == nullptr
+          ? nullptr
+          : flags_internal::PrivateHandleAccessor::RawFilename(flag);
   if (filename != nullptr &&
+      (raw_filename == nullptr || std::strcmp(raw_filename, filename) != 0) &&
       flag.Filename() != GetUsageConfig().normalize_filename(filename)) {
     flags_internal::ReportUsageError(
         absl::StrCat(
@@ -167,6 +198,20 @@ void FlagRegistry::RegisterFlag(CommandLineFlag& flag, const char* filename) {
     // All cases above are fatal, except for the retired flags.
     std::exit(1);
   }
+
+  // If the registry has been finalized, fold the new flag into a freshly
+  // republished snapshot so that readers continue to avoid lock_.
+  if (FlagSnapshot* old_snapshot = snapshot_.load(std::memory_order_relaxed)) {
+    auto* new_snapshot = new FlagSnapshot(*old_snapshot);
+    auto it = std::partition_point(
+        new_snapshot->flags.begin(), new_snapshot->flags.end(),
+        [&](const std::pair<absl::string_view, CommandLineFlag*>& f) {
+          return f.first < flag.Name();
+        });
+    new_snapshot->flags.emplace(it, flag.Name(), &flag);
+    snapshot_.store(new_snapshot, std::memory_order_release);
+    retired_snapshots_.emplace_back(old_snapshot);
+  }
 }
 
 FlagRegistry& FlagRegistry::GlobalRegistry() {
@@ -179,8 +224,10 @@ FlagRegistry& FlagRegistry::GlobalRegistry() {
 void ForEachFlag(std::function<void(CommandLineFlag&)> visitor) {
   FlagRegistry& registry = FlagRegistry::GlobalRegistry();
 
-  if (registry.finalized_flags_.load(std::memory_order_acquire)) {
-    for (const auto& i : registry.flat_flags_) visitor(*i);
+  if (const auto* snapshot =
+          registry.snapshot_.load(std::memory_order_acquire)) {
+    for (const auto& i : snapshot->flags) visitor(*i.second);
+    return;
   }
 
   FlagRegistryLock frl(registry);
@@ -197,20 +244,22 @@ bool RegisterCommandLineFlag(CommandLineFlag& flag, const char* filename) {
 void FinalizeRegistry() {
   auto& registry = FlagRegistry::GlobalRegistry();
   FlagRegistryLock frl(registry);
-  if (registry.finalized_flags_.load(std::memory_order_relaxed)) {
+  if (registry.snapshot_.load(std::memory_order_relaxed) != nullptr) {
     // Was already finalized. Ignore the second time.
     return;
   }
-  registry.flat_flags_.reserve(registry.flags_.size());
+  auto* snapshot = new FlagRegistry::FlagSnapshot;
+  snapshot->flags.reserve(registry.flags_.size());
   for (const auto& f : registry.flags_) {
-    registry.flat_flags_.push_back(f.second);
+    snapshot->flags.emplace_back(f.second->Name(), f.second);
   }
-  std::sort(std::begin(registry.flat_flags_), std::end(registry.flat_flags_),
-            [](const CommandLineFlag* lhs, const CommandLineFlag* rhs) {
-              return lhs->Name() < rhs->Name();
+  std::sort(std::begin(snapshot->flags), std::end(snapshot->flags),
+            [](const std::pair<absl::string_view, CommandLineFlag*>& lhs,
+               const std::pair<absl::string_view, CommandLineFlag*>& rhs) {
+              return lhs.first < rhs.first;
             });
   registry.flags_.clear();
-  registry.finalized_flags_.store(true, std::memory_order_release);
+  registry.snapshot_.store(snapshot, std::memory_order_release);
 }
 
 // --------------------------------------------------------------------
@@ -158,14 +158,33 @@ ABSL_NAMESPACE_BEGIN
 //   // Create an empty instance using the default constructor.
 //   AnyInvocable<void()> empty;
 //   empty();  // WARNING: Undefined behavior!
-template <class Sig>
-class AnyInvocable : private internal_any_invocable::Impl<Sig> {
+//
+// The optional `kStorageBytes` template parameter sets the size of the
+// small-object-optimization buffer, which defaults to two pointers. Target
+// objects that fit in the buffer (and are nothrow-move-constructible) are
+// stored inline; larger targets are heap-allocated. Code that constructs
+// many short-lived `AnyInvocable` objects from closures with larger capture
+// lists can size the buffer to its common capture footprint to avoid the
+// allocation, at the cost of a larger `AnyInvocable` object:
+//
+//   // A task whose captures need up to 48 bytes is still allocation-free.
+//   using Task = absl::InlinedAnyInvocable<void() &&, 48>;
+//
+// Instantiations with different buffer sizes are distinct (but
+// interconvertible) types.
+template <class Sig, std::size_t kStorageBytes>
+class AnyInvocable
+    : private internal_any_invocable::Impl<Sig, kStorageBytes> {
  private:
   static_assert(
       std::is_function<Sig>::value,
       "The template argument of AnyInvocable must be a function type.");
+  static_assert(
+      kStorageBytes >= internal_any_invocable::kDefaultStorageSize,
+      "The storage of AnyInvocable must be at least as large as its default "
+      "of two pointers.");
 
-  using Impl = internal_any_invocable::Impl<Sig>;
+  using Impl = internal_any_invocable::Impl<Sig, kStorageBytes>;
 
  public:
   // The return type of Sig
@@ -188,8 +207,9 @@ class AnyInvocable : private internal_any_invocable::Impl<Sig> {
   // Upon construction, `*this` is only empty if `f` is a function pointer or
   // member pointer type and is null, or if `f` is an `AnyInvocable` that is
   // empty.
-  template <class F, typename = absl::enable_if_t<
-                         internal_any_invocable::CanConvert<Sig, F>::value>>
+  template <class F,
+            typename = absl::enable_if_t<internal_any_invocable::CanConvert<
+                Sig, kStorageBytes, F>::value>>
   AnyInvocable(F&& f)  // NOLINT
       : Impl(internal_any_invocable::ConversionConstruct(),
              std::forward<F>(f)) {}
@@ -203,8 +223,8 @@ class AnyInvocable : private internal_any_invocable::Impl<Sig> {
   //       absl::in_place_type<PossiblyImmovableType>, arg1, arg2);
   //
   template <class T, class... Args,
-            typename = absl::enable_if_t<
-                internal_any_invocable::CanEmplace<Sig, T, Args...>::value>>
+            typename = absl::enable_if_t<internal_any_invocable::CanEmplace<
+                Sig, kStorageBytes, T, Args...>::value>>
   explicit AnyInvocable(absl::in_place_type_t<T>, Args&&... args)
       : Impl(absl::in_place_type<absl::decay_t<T>>,
              std::forward<Args>(args)...) {
@@ -216,7 +236,8 @@ class AnyInvocable : private internal_any_invocable::Impl<Sig> {
   // Overload of the above constructor to support list-initialization.
   template <class T, class U, class... Args,
             typename = absl::enable_if_t<internal_any_invocable::CanEmplace<
-                Sig, T, std::initializer_list<U>&, Args...>::value>>
+                Sig, kStorageBytes, T, std::initializer_list<U>&,
+                Args...>::value>>
   explicit AnyInvocable(absl::in_place_type_t<T>,
                         std::initializer_list<U> ilist, Args&&... args)
       : Impl(absl::in_place_type<absl::decay_t<T>>, ilist,
@@ -245,8 +266,9 @@ class AnyInvocable : private internal_any_invocable::Impl<Sig> {
   // Upon assignment, `*this` is only empty if `f` is a function pointer or
   // member pointer type and is null, or if `f` is an `AnyInvocable` that is
   // empty.
-  template <class F, typename = absl::enable_if_t<
-                         internal_any_invocable::CanAssign<Sig, F>::value>>
+  template <class F,
+            typename = absl::enable_if_t<internal_any_invocable::CanAssign<
+                Sig, kStorageBytes, F>::value>>
   AnyInvocable& operator=(F&& f) {
     *this = AnyInvocable(std::forward<F>(f));
     return *this;
@@ -255,10 +277,10 @@ class AnyInvocable : private internal_any_invocable::Impl<Sig> {
   // Assigns an `AnyInvocable` from a reference to an invocable object.
   // Upon assignment, stores a reference to the invocable object in the
   // `AnyInvocable` instance.
-  template <
-      class F,
-      typename = absl::enable_if_t<
-          internal_any_invocable::CanAssignReferenceWrapper<Sig, F>::value>>
+  template <class F,
+            typename = absl::enable_if_t<
+                internal_any_invocable::CanAssignReferenceWrapper<
+                    Sig, kStorageBytes, F>::value>>
   AnyInvocable& operator=(std::reference_wrapper<F> f) noexcept {
     *this = AnyInvocable(f);
     return *this;
@@ -324,10 +346,19 @@ class AnyInvocable : private internal_any_invocable::Impl<Sig> {
 
  private:
   // Friending other instantiations is necessary for conversions.
-  template <bool /*SigIsNoexcept*/, class /*ReturnType*/, class... /*P*/>
+  template <std::size_t /*kStorageBytes*/, bool /*SigIsNoexcept*/,
+            class /*ReturnType*/, class... /*P*/>
   friend class internal_any_invocable::CoreImpl;
 };
 
+// InlinedAnyInvocable
+//
+// A convenience alias for spelling an `absl::AnyInvocable` with an enlarged
+// small-object-optimization buffer, analogous to how `absl::InlinedVector`
+// names a `std::vector`-like type with inline capacity.
+template <class Sig, std::size_t kStorageBytes>
+using InlinedAnyInvocable = AnyInvocable<Sig, kStorageBytes>;
+
 ABSL_NAMESPACE_END
 }  // namespace absl
 
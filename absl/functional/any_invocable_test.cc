@@ -25,7 +25,7 @@
 #include "absl/meta/type_traits.h"
 #include "absl/utility/utility.h"
 
-static_assert(absl::internal_any_invocable::kStorageSize >= sizeof(void*),
+static_assert(absl::internal_any_invocable::kDefaultStorageSize >= sizeof(void*),
               "These tests assume that the small object storage is at least "
               "the size of a pointer.");
 
@@ -147,7 +147,7 @@ struct TypeErasedPadding<ObjSize::small> {};
 
 template <>
 struct TypeErasedPadding<ObjSize::large> {
-  char dummy_data[absl::internal_any_invocable::kStorageSize + 1] = {};
+  char dummy_data[absl::internal_any_invocable::kDefaultStorageSize + 1] = {};
 };
 
 struct Int {
@@ -1714,6 +1714,54 @@ static_assert(
 static_assert(!std::is_convertible<void*, absl::AnyInvocable<void() &&>>::value,
               "");
 
+// A callable whose state is too large for the default storage but fits in an
+// enlarged buffer.
+struct LargeStateFunctor {
+  int operator()() const noexcept { return static_cast<int>(state[0]); }
+  int64_t state[4];
+};
+
+constexpr std::size_t kLargeStorage = sizeof(LargeStateFunctor);
+
+static_assert(!absl::internal_any_invocable::IsStoredLocally<
+                  LargeStateFunctor,
+                  absl::internal_any_invocable::kDefaultStorageSize>::value,
+              "");
+static_assert(absl::internal_any_invocable::IsStoredLocally<
+                  LargeStateFunctor, kLargeStorage>::value,
+              "");
+
+TEST(InlinedAnyInvocableTest, LargeTargetIsInvocable) {
+  absl::InlinedAnyInvocable<int() const, kLargeStorage> fun =
+      LargeStateFunctor{{17, 0, 0, 0}};
+  EXPECT_TRUE(static_cast<bool>(fun));
+  EXPECT_EQ(17, fun());
+
+  absl::InlinedAnyInvocable<int() const, kLargeStorage> other = std::move(fun);
+  EXPECT_EQ(17, other());
+
+  other = nullptr;
+  EXPECT_FALSE(static_cast<bool>(other));
+}
+
+TEST(InlinedAnyInvocableTest, ConversionBetweenStorageSizes) {
+  // Instantiations with different buffer sizes are distinct types, but
+  // convert by wrapping one inside of the other.
+  absl::AnyInvocable<int()> small = [] { return 5; };
+  absl::InlinedAnyInvocable<int(), kLargeStorage> large = std::move(small);
+  EXPECT_EQ(5, large());
+
+  absl::AnyInvocable<int()> back = std::move(large);
+  EXPECT_EQ(5, back());
+}
+
+TEST(InlinedAnyInvocableTest, InPlaceConstruction) {
+  absl::InlinedAnyInvocable<int() const, kLargeStorage> fun(
+      absl::in_place_type<LargeStateFunctor>,
+      LargeStateFunctor{{29, 0, 0, 0}});
+  EXPECT_EQ(29, fun());
+}
+
 #undef ABSL_INTERNAL_NOEXCEPT_SPEC
 
 }  // namespace
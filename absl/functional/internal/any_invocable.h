@@ -83,18 +83,23 @@ ABSL_NAMESPACE_BEGIN
 #define ABSL_INTERNAL_NOEXCEPT_SPEC(noex)
 #endif
 
-// Defined in functional/any_invocable.h
-template <class Sig>
-class AnyInvocable;
-
 namespace internal_any_invocable {
 
 // Constants relating to the small-object-storage for AnyInvocable
 enum StorageProperty : std::size_t {
   kAlignment = alignof(std::max_align_t),  // The alignment of the storage
-  kStorageSize = sizeof(void*) * 2         // The size of the storage
+  kDefaultStorageSize = sizeof(void*) * 2  // The default size of the storage
 };
 
+}  // namespace internal_any_invocable
+
+// Defined in functional/any_invocable.h
+template <class Sig,
+          std::size_t kStorageBytes = internal_any_invocable::kDefaultStorageSize>
+class AnyInvocable;
+
+namespace internal_any_invocable {
+
 ////////////////////////////////////////////////////////////////////////////////
 //
 // A metafunction for checking if a type is an AnyInvocable instantiation.
@@ -102,14 +107,14 @@ enum StorageProperty : std::size_t {
 template <class T>
 struct IsAnyInvocable : std::false_type {};
 
-template <class Sig>
-struct IsAnyInvocable<AnyInvocable<Sig>> : std::true_type {};
+template <class Sig, std::size_t kStorageBytes>
+struct IsAnyInvocable<AnyInvocable<Sig, kStorageBytes>> : std::true_type {};
 //
 ////////////////////////////////////////////////////////////////////////////////
 
 // A type trait that tells us whether or not a target function type should be
-// stored locally in the small object optimization storage
-template <class T>
+// stored locally in the small object optimization storage of the given size
+template <class T, std::size_t kStorageSize>
 using IsStoredLocally = std::integral_constant<
     bool, sizeof(T) <= kStorageSize && alignof(T) <= kAlignment &&
               kAlignment % alignof(T) == 0 &&
@@ -189,6 +194,7 @@ enum class FunctionToCall : bool { relocate_from_to, dispose };
 
 // The portion of `AnyInvocable` state that contains either a pointer to the
 // target object or the object itself in local storage
+template <std::size_t kStorageSize>
 union TypeErasedState {
   struct {
     // A pointer to the type-erased object when remotely stored
@@ -202,8 +208,8 @@ union TypeErasedState {
 };
 
 // A typed accessor for the object in `TypeErasedState` storage
-template <class T>
-T& ObjectInLocalStorage(TypeErasedState* const state) {
+template <class T, std::size_t kStorageSize>
+T& ObjectInLocalStorage(TypeErasedState<kStorageSize>* const state) {
   // We launder here because the storage may be reused with the same type.
 #if defined(__cpp_lib_launder) && __cpp_lib_launder >= 201606L
   return *std::launder(reinterpret_cast<T*>(&state->storage));
@@ -230,26 +236,32 @@ T& ObjectInLocalStorage(TypeErasedState* const state) {
 // A pointer to such a function is contained in each `AnyInvocable` instance.
 // NOTE: When specifying `FunctionToCall::`dispose, the same state must be
 // passed as both "from" and "to".
+template <std::size_t kStorageSize>
 using ManagerType = void(FunctionToCall /*operation*/,
-                         TypeErasedState* /*from*/, TypeErasedState* /*to*/)
+                         TypeErasedState<kStorageSize>* /*from*/,
+                         TypeErasedState<kStorageSize>* /*to*/)
     ABSL_INTERNAL_NOEXCEPT_SPEC(true);
 
 // The type for functions issuing the actual invocation of the object
 // A pointer to such a function is contained in each AnyInvocable instance.
-template <bool SigIsNoexcept, class ReturnType, class... P>
-using InvokerType = ReturnType(TypeErasedState*, ForwardedParameterType<P>...)
-    ABSL_INTERNAL_NOEXCEPT_SPEC(SigIsNoexcept);
+template <bool SigIsNoexcept, class ReturnType, std::size_t kStorageSize,
+          class... P>
+using InvokerType =
+    ReturnType(TypeErasedState<kStorageSize>*, ForwardedParameterType<P>...)
+        ABSL_INTERNAL_NOEXCEPT_SPEC(SigIsNoexcept);
 
 // The manager that is used when AnyInvocable is empty
-inline void EmptyManager(FunctionToCall /*operation*/,
-                         TypeErasedState* /*from*/,
-                         TypeErasedState* /*to*/) noexcept {}
+template <std::size_t kStorageSize>
+void EmptyManager(FunctionToCall /*operation*/,
+                  TypeErasedState<kStorageSize>* /*from*/,
+                  TypeErasedState<kStorageSize>* /*to*/) noexcept {}
 
 // The manager that is used when a target function is in local storage and is
 // a trivially copyable type.
-inline void LocalManagerTrivial(FunctionToCall /*operation*/,
-                                TypeErasedState* const from,
-                                TypeErasedState* const to) noexcept {
+template <std::size_t kStorageSize>
+void LocalManagerTrivial(FunctionToCall /*operation*/,
+                         TypeErasedState<kStorageSize>* const from,
+                         TypeErasedState<kStorageSize>* const to) noexcept {
   // This single statement without branching handles both possible operations.
   //
   // For FunctionToCall::dispose, "from" and "to" point to the same state, and
@@ -271,11 +283,11 @@ inline void LocalManagerTrivial(FunctionToCall /*operation*/,
 
 // The manager that is used when a target function is in local storage and is
 // not a trivially copyable type.
-template <class T>
+template <class T, std::size_t kStorageSize>
 void LocalManagerNontrivial(FunctionToCall operation,
-                            TypeErasedState* const from,
-                            TypeErasedState* const to) noexcept {
-  static_assert(IsStoredLocally<T>::value,
+                            TypeErasedState<kStorageSize>* const from,
+                            TypeErasedState<kStorageSize>* const to) noexcept {
+  static_assert(IsStoredLocally<T, kStorageSize>::value,
                 "Local storage must only be used for supported types.");
   static_assert(!std::is_trivially_copyable<T>::value,
                 "Locally stored types must be trivially copyable.");
@@ -297,13 +309,14 @@ void LocalManagerNontrivial(FunctionToCall operation,
 // The invoker that is used when a target function is in local storage
 // Note: QualTRef here is the target function type along with cv and reference
 // qualifiers that must be used when calling the function.
-template <bool SigIsNoexcept, class ReturnType, class QualTRef, class... P>
+template <bool SigIsNoexcept, class ReturnType, class QualTRef,
+          std::size_t kStorageSize, class... P>
 ReturnType LocalInvoker(
-    TypeErasedState* const state,
+    TypeErasedState<kStorageSize>* const state,
     ForwardedParameterType<P>... args) noexcept(SigIsNoexcept) {
   using RawT = RemoveCVRef<QualTRef>;
   static_assert(
-      IsStoredLocally<RawT>::value,
+      IsStoredLocally<RawT, kStorageSize>::value,
       "Target object must be in local storage in order to be invoked from it.");
 
   auto& f = (ObjectInLocalStorage<RawT>)(state);
@@ -313,9 +326,10 @@ ReturnType LocalInvoker(
 
 // The manager that is used when a target function is in remote storage and it
 // has a trivial destructor
-inline void RemoteManagerTrivial(FunctionToCall operation,
-                                 TypeErasedState* const from,
-                                 TypeErasedState* const to) noexcept {
+template <std::size_t kStorageSize>
+void RemoteManagerTrivial(FunctionToCall operation,
+                          TypeErasedState<kStorageSize>* const from,
+                          TypeErasedState<kStorageSize>* const to) noexcept {
   switch (operation) {
     case FunctionToCall::relocate_from_to:
       // NOTE: Requires that the left-hand operand is already empty.
@@ -334,11 +348,11 @@ inline void RemoteManagerTrivial(FunctionToCall operation,
 
 // The manager that is used when a target function is in remote storage and the
 // destructor of the type is not trivial
-template <class T>
+template <class T, std::size_t kStorageSize>
 void RemoteManagerNontrivial(FunctionToCall operation,
-                             TypeErasedState* const from,
-                             TypeErasedState* const to) noexcept {
-  static_assert(!IsStoredLocally<T>::value,
+                             TypeErasedState<kStorageSize>* const from,
+                             TypeErasedState<kStorageSize>* const to) noexcept {
+  static_assert(!IsStoredLocally<T, kStorageSize>::value,
                 "Remote storage must only be used for types that do not "
                 "qualify for local storage.");
 
@@ -355,12 +369,13 @@ void RemoteManagerNontrivial(FunctionToCall operation,
 }
 
 // The invoker that is used when a target function is in remote storage
-template <bool SigIsNoexcept, class ReturnType, class QualTRef, class... P>
+template <bool SigIsNoexcept, class ReturnType, class QualTRef,
+          std::size_t kStorageSize, class... P>
 ReturnType RemoteInvoker(
-    TypeErasedState* const state,
+    TypeErasedState<kStorageSize>* const state,
     ForwardedParameterType<P>... args) noexcept(SigIsNoexcept) {
   using RawT = RemoveCVRef<QualTRef>;
-  static_assert(!IsStoredLocally<RawT>::value,
+  static_assert(!IsStoredLocally<RawT, kStorageSize>::value,
                 "Target object must be in remote storage in order to be "
                 "invoked from it.");
 
@@ -396,7 +411,7 @@ struct TypedConversionConstruct {};
 // the user of the top-level template accidentally passes a template argument
 // that is not a function type, they will get a static_assert in AnyInvocable's
 // class body rather than an error stating that Impl is not defined.
-template <class Sig>
+template <class Sig, std::size_t kStorageBytes>
 class Impl {};  // Note: This is partially-specialized later.
 
 // A std::unique_ptr deleter that deletes memory allocated via ::operator new.
@@ -421,24 +436,31 @@ class TrivialDeleter {
 };
 #endif  // __cpp_sized_deallocation
 
-template <bool SigIsNoexcept, class ReturnType, class... P>
+template <std::size_t kStorageBytes, bool SigIsNoexcept, class ReturnType,
+          class... P>
 class CoreImpl;
 
+// Note: Instantiations with different storage sizes are never compatible, as
+// "moving the guts" copies the type-erased state verbatim and the managers
+// and invokers are bound to a particular storage layout.
 constexpr bool IsCompatibleConversion(void*, void*) { return false; }
-template <bool NoExceptSrc, bool NoExceptDest, class... T>
-constexpr bool IsCompatibleConversion(CoreImpl<NoExceptSrc, T...>*,
-                                      CoreImpl<NoExceptDest, T...>*) {
+template <std::size_t kStorageBytes, bool NoExceptSrc, bool NoExceptDest,
+          class... T>
+constexpr bool IsCompatibleConversion(
+    CoreImpl<kStorageBytes, NoExceptSrc, T...>*,
+    CoreImpl<kStorageBytes, NoExceptDest, T...>*) {
   return !NoExceptDest || NoExceptSrc;
 }
 
 // A helper base class for all core operations of AnyInvocable that do not
 // depend on the cv/ref qualifiers of the function type.
-template <bool SigIsNoexcept, class ReturnType, class... P>
+template <std::size_t kStorageBytes, bool SigIsNoexcept, class ReturnType,
+          class... P>
 class CoreImpl {
  public:
   using result_type = ReturnType;
 
-  CoreImpl() noexcept : manager_(EmptyManager), invoker_(nullptr) {}
+  CoreImpl() noexcept : manager_(EmptyManager<kStorageBytes>), invoker_(nullptr) {}
 
   enum class TargetType {
     kPointer,
@@ -481,7 +503,7 @@ class CoreImpl {
     other.manager_(FunctionToCall::relocate_from_to, &other.state_, &state_);
     manager_ = other.manager_;
     invoker_ = other.invoker_;
-    other.manager_ = EmptyManager;
+    other.manager_ = EmptyManager<kStorageBytes>;
     other.invoker_ = nullptr;
   }
 
@@ -499,7 +521,7 @@ class CoreImpl {
     other.manager_(FunctionToCall::relocate_from_to, &other.state_, &state_);
     manager_ = other.manager_;
     invoker_ = other.invoker_;
-    other.manager_ = EmptyManager;
+    other.manager_ = EmptyManager<kStorageBytes>;
     other.invoker_ = nullptr;
 
     return *this;
@@ -513,7 +535,7 @@ class CoreImpl {
   // Effects: Puts the object into its empty state.
   void Clear() {
     manager_(FunctionToCall::dispose, &state_, &state_);
-    manager_ = EmptyManager;
+    manager_ = EmptyManager<kStorageBytes>;
     invoker_ = nullptr;
   }
 
@@ -535,7 +557,7 @@ class CoreImpl {
 #if !defined(__clang__) && defined(__GNUC__)
 #pragma GCC diagnostic pop
 #endif
-      manager_ = EmptyManager;
+      manager_ = EmptyManager<kStorageBytes>;
       invoker_ = nullptr;
       return;
     }
@@ -551,7 +573,7 @@ class CoreImpl {
     manager_ = f.manager_;
     invoker_ = f.invoker_;
 
-    f.manager_ = EmptyManager;
+    f.manager_ = EmptyManager<kStorageBytes>;
     f.invoker_ = nullptr;
   }
 
@@ -562,7 +584,7 @@ class CoreImpl {
     if (f.HasValue()) {
       InitializeStorage<QualDecayedTRef>(std::forward<F>(f));
     } else {
-      manager_ = EmptyManager;
+      manager_ = EmptyManager<kStorageBytes>;
       invoker_ = nullptr;
     }
   }
@@ -576,38 +598,41 @@ class CoreImpl {
   // Use local (inline) storage for applicable target object types.
   template <class QualTRef, class... Args,
             typename = absl::enable_if_t<
-                IsStoredLocally<RemoveCVRef<QualTRef>>::value>>
+                IsStoredLocally<RemoveCVRef<QualTRef>, kStorageBytes>::value>>
   void InitializeStorage(Args&&... args) {
     using RawT = RemoveCVRef<QualTRef>;
     ::new (static_cast<void*>(&state_.storage))
         RawT(std::forward<Args>(args)...);
 
-    invoker_ = LocalInvoker<SigIsNoexcept, ReturnType, QualTRef, P...>;
+    invoker_ =
+        LocalInvoker<SigIsNoexcept, ReturnType, QualTRef, kStorageBytes, P...>;
     // We can simplify our manager if we know the type is trivially copyable.
     InitializeLocalManager<RawT>();
   }
 
   // Use remote storage for target objects that cannot be stored locally.
   template <class QualTRef, class... Args,
-            absl::enable_if_t<!IsStoredLocally<RemoveCVRef<QualTRef>>::value,
-                              int> = 0>
+            absl::enable_if_t<
+                !IsStoredLocally<RemoveCVRef<QualTRef>, kStorageBytes>::value,
+                int> = 0>
   void InitializeStorage(Args&&... args) {
     InitializeRemoteManager<RemoveCVRef<QualTRef>>(std::forward<Args>(args)...);
     // This is set after everything else in case an exception is thrown in an
     // earlier step of the initialization.
-    invoker_ = RemoteInvoker<SigIsNoexcept, ReturnType, QualTRef, P...>;
+    invoker_ =
+        RemoteInvoker<SigIsNoexcept, ReturnType, QualTRef, kStorageBytes, P...>;
   }
 
   template <class T,
             typename = absl::enable_if_t<std::is_trivially_copyable<T>::value>>
   void InitializeLocalManager() {
-    manager_ = LocalManagerTrivial;
+    manager_ = LocalManagerTrivial<kStorageBytes>;
   }
 
   template <class T,
             absl::enable_if_t<!std::is_trivially_copyable<T>::value, int> = 0>
   void InitializeLocalManager() {
-    manager_ = LocalManagerNontrivial<T>;
+    manager_ = LocalManagerNontrivial<T, kStorageBytes>;
   }
 
   template <class T>
@@ -625,14 +650,14 @@ class CoreImpl {
     ::new (uninitialized_target.get()) T(std::forward<Args>(args)...);
     state_.remote.target = uninitialized_target.release();
     state_.remote.size = sizeof(T);
-    manager_ = RemoteManagerTrivial;
+    manager_ = RemoteManagerTrivial<kStorageBytes>;
   }
 
   template <class T, class... Args,
             absl::enable_if_t<!HasTrivialRemoteStorage<T>::value, int> = 0>
   void InitializeRemoteManager(Args&&... args) {
     state_.remote.target = ::new T(std::forward<Args>(args)...);
-    manager_ = RemoteManagerNontrivial<T>;
+    manager_ = RemoteManagerNontrivial<T, kStorageBytes>;
   }
 
   //////////////////////////////////////////////////////////////////////////////
@@ -647,21 +672,20 @@ class CoreImpl {
     static constexpr bool value = false;
   };
 
-  template <typename Sig>
-  struct IsCompatibleAnyInvocable<AnyInvocable<Sig>> {
-    static constexpr bool value =
-        (IsCompatibleConversion)(static_cast<
-                                     typename AnyInvocable<Sig>::CoreImpl*>(
-                                     nullptr),
-                                 static_cast<CoreImpl*>(nullptr));
+  template <typename Sig, std::size_t kOtherStorageBytes>
+  struct IsCompatibleAnyInvocable<AnyInvocable<Sig, kOtherStorageBytes>> {
+    static constexpr bool value = (IsCompatibleConversion)(
+        static_cast<typename AnyInvocable<Sig, kOtherStorageBytes>::CoreImpl*>(
+            nullptr),
+        static_cast<CoreImpl*>(nullptr));
   };
 
   //
   //////////////////////////////////////////////////////////////////////////////
 
-  TypeErasedState state_;
-  ManagerType* manager_;
-  InvokerType<SigIsNoexcept, ReturnType, P...>* invoker_;
+  TypeErasedState<kStorageBytes> state_;
+  ManagerType<kStorageBytes>* manager_;
+  InvokerType<SigIsNoexcept, ReturnType, kStorageBytes, P...>* invoker_;
 };
 
 // A constructor name-tag used with Impl to request the
@@ -698,41 +722,45 @@ using TrueAlias =
     std::integral_constant<bool, sizeof(absl::void_t<T...>*) != 0>;
 
 /*SFINAE constraints for the conversion-constructor.*/
-template <class Sig, class F,
-          class = absl::enable_if_t<
-              !std::is_same<RemoveCVRef<F>, AnyInvocable<Sig>>::value>>
+template <class Sig, std::size_t kStorageBytes, class F,
+          class = absl::enable_if_t<!std::is_same<
+              RemoveCVRef<F>, AnyInvocable<Sig, kStorageBytes>>::value>>
 using CanConvert = TrueAlias<
     absl::enable_if_t<!IsInPlaceType<RemoveCVRef<F>>::value>,
-    absl::enable_if_t<Impl<Sig>::template CallIsValid<F>::value>,
     absl::enable_if_t<
-        Impl<Sig>::template CallIsNoexceptIfSigIsNoexcept<F>::value>,
+        Impl<Sig, kStorageBytes>::template CallIsValid<F>::value>,
+    absl::enable_if_t<Impl<Sig, kStorageBytes>::
+                          template CallIsNoexceptIfSigIsNoexcept<F>::value>,
     absl::enable_if_t<std::is_constructible<absl::decay_t<F>, F>::value>>;
 
 /*SFINAE constraints for the std::in_place constructors.*/
-template <class Sig, class F, class... Args>
+template <class Sig, std::size_t kStorageBytes, class F, class... Args>
 using CanEmplace = TrueAlias<
-    absl::enable_if_t<Impl<Sig>::template CallIsValid<F>::value>,
     absl::enable_if_t<
-        Impl<Sig>::template CallIsNoexceptIfSigIsNoexcept<F>::value>,
+        Impl<Sig, kStorageBytes>::template CallIsValid<F>::value>,
+    absl::enable_if_t<Impl<Sig, kStorageBytes>::
+                          template CallIsNoexceptIfSigIsNoexcept<F>::value>,
     absl::enable_if_t<std::is_constructible<absl::decay_t<F>, Args...>::value>>;
 
 /*SFINAE constraints for the conversion-assign operator.*/
-template <class Sig, class F,
-          class = absl::enable_if_t<
-              !std::is_same<RemoveCVRef<F>, AnyInvocable<Sig>>::value>>
+template <class Sig, std::size_t kStorageBytes, class F,
+          class = absl::enable_if_t<!std::is_same<
+              RemoveCVRef<F>, AnyInvocable<Sig, kStorageBytes>>::value>>
 using CanAssign = TrueAlias<
-    absl::enable_if_t<Impl<Sig>::template CallIsValid<F>::value>,
     absl::enable_if_t<
-        Impl<Sig>::template CallIsNoexceptIfSigIsNoexcept<F>::value>,
+        Impl<Sig, kStorageBytes>::template CallIsValid<F>::value>,
+    absl::enable_if_t<Impl<Sig, kStorageBytes>::
+                          template CallIsNoexceptIfSigIsNoexcept<F>::value>,
     absl::enable_if_t<std::is_constructible<absl::decay_t<F>, F>::value>>;
 
 /*SFINAE constraints for the reference-wrapper conversion-assign operator.*/
-template <class Sig, class F>
+template <class Sig, std::size_t kStorageBytes, class F>
 using CanAssignReferenceWrapper = TrueAlias<
+    absl::enable_if_t<Impl<Sig, kStorageBytes>::template CallIsValid<
+        std::reference_wrapper<F>>::value>,
     absl::enable_if_t<
-        Impl<Sig>::template CallIsValid<std::reference_wrapper<F>>::value>,
-    absl::enable_if_t<Impl<Sig>::template CallIsNoexceptIfSigIsNoexcept<
-        std::reference_wrapper<F>>::value>>;
+        Impl<Sig, kStorageBytes>::template CallIsNoexceptIfSigIsNoexcept<
+            std::reference_wrapper<F>>::value>>;
 
 ////////////////////////////////////////////////////////////////////////////////
 //
@@ -780,12 +808,13 @@ using CanAssignReferenceWrapper = TrueAlias<
 // non-moveable result types correctly. For example this was the case in libc++
 // before commit c3a24882 (2022-05).
 #define ABSL_INTERNAL_ANY_INVOCABLE_IMPL_(cv, ref, inv_quals, noex)            \
-  template <class ReturnType, class... P>                                      \
-  class Impl<ReturnType(P...) cv ref ABSL_INTERNAL_NOEXCEPT_SPEC(noex)>        \
-      : public CoreImpl<noex, ReturnType, P...> {                              \
+  template <std::size_t kStorageBytes, class ReturnType, class... P>           \
+  class Impl<ReturnType(P...) cv ref ABSL_INTERNAL_NOEXCEPT_SPEC(noex),        \
+             kStorageBytes>                                                    \
+      : public CoreImpl<kStorageBytes, noex, ReturnType, P...> {               \
    public:                                                                     \
     /*The base class, which contains the datamembers and core operations*/     \
-    using Core = CoreImpl<noex, ReturnType, P...>;                             \
+    using Core = CoreImpl<kStorageBytes, noex, ReturnType, P...>;              \
                                                                                \
     /*SFINAE constraint to check if F is invocable with the proper signature*/ \
     template <class F>                                                         \
@@ -822,13 +851,13 @@ using CanAssignReferenceWrapper = TrueAlias<
                                                                                \
     /*Raises a fatal error when the AnyInvocable is invoked after a move*/     \
     static ReturnType InvokedAfterMove(                                        \
-      TypeErasedState*,                                                        \
+      TypeErasedState<kStorageBytes>*,                                         \
       ForwardedParameterType<P>...) noexcept(noex) {                           \
       ABSL_HARDENING_ASSERT(false && "AnyInvocable use-after-move");           \
       std::terminate();                                                        \
     }                                                                          \
                                                                                \
-    InvokerType<noex, ReturnType, P...>* ExtractInvoker() cv {                 \
+    InvokerType<noex, ReturnType, kStorageBytes, P...>* ExtractInvoker() cv {  \
       using QualifiedTestType = int cv ref;                                    \
       auto* invoker = this->invoker_;                                          \
       if (!std::is_const<QualifiedTestType>::value &&                          \
@@ -846,7 +875,7 @@ using CanAssignReferenceWrapper = TrueAlias<
     ReturnType operator()(P... args) cv ref noexcept(noex) {                   \
       assert(this->invoker_ != nullptr);                                       \
       return this->ExtractInvoker()(                                           \
-          const_cast<TypeErasedState*>(&this->state_),                         \
+          const_cast<TypeErasedState<kStorageBytes>*>(&this->state_),          \
           static_cast<ForwardedParameterType<P>>(args)...);                    \
     }                                                                          \
   }
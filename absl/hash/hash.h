@@ -78,11 +78,16 @@
 #ifndef ABSL_HASH_HASH_H_
 #define ABSL_HASH_HASH_H_
 
+#include <cassert>
+#include <cstdint>
 #include <tuple>
 #include <utility>
 
+#include "absl/base/attributes.h"
 #include "absl/functional/function_ref.h"
 #include "absl/hash/internal/hash.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
 
 namespace absl {
 ABSL_NAMESPACE_BEGIN
@@ -142,6 +147,14 @@ ABSL_NAMESPACE_BEGIN
 // Note: the list above is not meant to be exhaustive. Additional type support
 // may be added, in which case the above list will be updated.
 //
+// Contiguous containers of "uniquely represented" element types -- types
+// whose equal values always have identical object bytes, such as integral
+// and enum types (see `absl::hash_internal::is_uniquely_represented`) -- are
+// guaranteed to be hashed as a single pass over the underlying bytes rather
+// than element by element. This applies to `std::vector`, `std::array`,
+// `absl::Span`, `absl::InlinedVector`, and `absl::FixedArray`, so hashing a
+// large numeric buffer costs the same as hashing a string of equal size.
+//
 // -----------------------------------------------------------------------------
 // absl::Hash Invocation Evaluation
 // -----------------------------------------------------------------------------
@@ -418,6 +431,136 @@ class HashState : public hash_internal::HashStateBase<HashState> {
       absl::FunctionRef<void(HashState, absl::FunctionRef<void(HashState&)>)>);
 };
 
+// HashStream
+//
+// `absl::HashStream` hashes a stream of bytes incrementally, so that large
+// payloads arriving in chunks can be hashed without first being reassembled
+// into one buffer. `Finalize()` returns exactly the value that
+// `absl::Hash<absl::string_view>` would produce for the concatenation of all
+// bytes passed to `Update()`, with the same quality guarantees, including the
+// per-process seed: the result is not stable across processes and must not be
+// persisted.
+//
+// Example:
+//
+//   absl::HashStream stream;
+//   while (ReadChunk(&file, &chunk)) {
+//     stream.Update(chunk);
+//   }
+//   size_t digest = std::move(stream).Finalize();
+class HashStream {
+ public:
+  HashStream() = default;
+
+  HashStream(const HashStream&) = delete;
+  HashStream& operator=(const HashStream&) = delete;
+
+  // HashStream::Update()
+  //
+  // Appends `bytes` to the hashed stream. Chunk boundaries do not affect the
+  // result; only the concatenated byte sequence does.
+  void Update(absl::string_view bytes) {
+    state_ = combiner_.add_buffer(std::move(state_), bytes.data(),
+                                  bytes.size());
+    size_ += bytes.size();
+  }
+
+  // HashStream::Finalize()
+  //
+  // Consumes the stream and returns the hash of all appended bytes. Must be
+  // called at most once, on an rvalue:
+  //
+  //   size_t digest = std::move(stream).Finalize();
+  ABSL_MUST_USE_RESULT size_t Finalize() && {
+    return static_cast<size_t>(
+        hash_internal::MixingHashState::combine(
+            combiner_.finalize(std::move(state_)), size_)
+            .state_);
+  }
+
+ private:
+  hash_internal::MixingHashState state_{};
+  hash_internal::PiecewiseCombiner combiner_;
+  size_t size_ = 0;
+};
+
+// SeededHash
+//
+// `absl::SeededHash<T>` hashes values with the same mixing algorithm and
+// quality guarantees as `absl::Hash<T>`, but starting from a caller-provided
+// seed instead of the randomized per-process seed. Two processes built from
+// the same Abseil revision for the same platform compute identical values for
+// equal seeds, so precomputed tables and consistent-hashing rings can be
+// persisted or shared across processes without rehashing.
+//
+// Use of this class is an explicit opt out of `absl::Hash`'s randomization,
+// and comes with the corresponding obligations:
+//
+//   * Values are NOT guaranteed stable across Abseil revisions. The algorithm
+//     is versioned by `kAlgorithmVersion`, which is incremented whenever the
+//     computed values change; persisted tables should record it and rehash on
+//     mismatch.
+//   * Values differ between platforms with different endianness or word size.
+//   * A caller who knows the seed can construct collisions. Do not expose
+//     seeded hashes of untrusted input to their producers, and do not use
+//     this class where denial-of-service resistance matters.
+//
+// Example:
+//
+//   absl::SeededHash<std::string> hasher(kSnapshotSeed);
+//   size_t bucket = hasher(key) % num_buckets;
+template <typename T>
+class SeededHash {
+ public:
+  // Incremented whenever the value computed for a given (seed, value) pair
+  // changes.
+  static constexpr int kAlgorithmVersion = 1;
+
+  explicit SeededHash(uint64_t seed) : seed_(seed) {}
+
+  size_t operator()(const T& value) const {
+    return static_cast<size_t>(
+        hash_internal::MixingHashState::combine(
+            hash_internal::MixingHashState{seed_}, value)
+            .state_);
+  }
+
+ private:
+  uint64_t seed_;
+};
+
+// HashBatch()
+//
+// Hashes every element of `keys` into the corresponding slot of `out`,
+// producing exactly the values `absl::Hash<T>` would. Use this before a
+// batched table probe: computing the hashes together keeps several
+// independent mixing multiplies in flight at once, which hides their latency
+// in a way a hash-probe-hash-probe loop does not. The gain is largest for
+// trivially hashable fixed-width keys, whose hash is a single multiply-mix.
+//
+// `out` must be at least as large as `keys`; extra slots are left untouched.
+template <typename T>
+void HashBatch(absl::Span<const T> keys, absl::Span<size_t> out) {
+  assert(out.size() >= keys.size());
+  const absl::Hash<T> hasher;
+  size_t i = 0;
+  // Four hashes in flight; the iterations carry no dependencies, so the
+  // mixing multiplies pipeline.
+  for (; i + 4 <= keys.size(); i += 4) {
+    const size_t h0 = hasher(keys[i]);
+    const size_t h1 = hasher(keys[i + 1]);
+    const size_t h2 = hasher(keys[i + 2]);
+    const size_t h3 = hasher(keys[i + 3]);
+    out[i] = h0;
+    out[i + 1] = h1;
+    out[i + 2] = h2;
+    out[i + 3] = h3;
+  }
+  for (; i < keys.size(); ++i) {
+    out[i] = hasher(keys[i]);
+  }
+}
+
 ABSL_NAMESPACE_END
 }  // namespace absl
 
@@ -1038,10 +1038,39 @@ TEST(HashTest, HeterogeneousCall) {
 TEST(IsUniquelyRepresentedTest, SanityTest) {
   using absl::hash_internal::is_uniquely_represented;
 
+  enum PlainEnum { kPlain };
+  enum class TypedEnum : int32_t { kTyped };
+
   EXPECT_TRUE(is_uniquely_represented<unsigned char>::value);
   EXPECT_TRUE(is_uniquely_represented<int>::value);
+  EXPECT_TRUE(is_uniquely_represented<PlainEnum>::value);
+  EXPECT_TRUE(is_uniquely_represented<TypedEnum>::value);
   EXPECT_FALSE(is_uniquely_represented<bool>::value);
   EXPECT_FALSE(is_uniquely_represented<int*>::value);
+  EXPECT_FALSE(is_uniquely_represented<float>::value);
+}
+
+// Verifies the documented guarantee that contiguous ranges of
+// uniquely-represented elements are fed to the hash state as one byte buffer
+// rather than element by element.
+TEST(IsUniquelyRepresentedTest, ContiguousRangesHashAsSingleBuffer) {
+  enum class Feature : int32_t { kA = 1, kB = 2, kC = 3, kD = 4 };
+
+  const std::vector<int32_t> ints = {1, 2, 3, 4};
+  const std::vector<Feature> enums = {Feature::kA, Feature::kB, Feature::kC,
+                                      Feature::kD};
+
+  // One combine_contiguous call over the raw bytes, followed by the size.
+  const SpyHashState one_pass = SpyHashState::combine(
+      SpyHashState::combine_contiguous(
+          SpyHashState(), reinterpret_cast<const unsigned char*>(ints.data()),
+          ints.size() * sizeof(int32_t)),
+      ints.size());
+
+  EXPECT_EQ(SpyHash(ints), one_pass);
+  // The enum vector has the same underlying bytes and must take the same
+  // single-pass path.
+  EXPECT_EQ(SpyHash(enums), one_pass);
 }
 
 struct IntAndString {
@@ -1145,4 +1174,79 @@ TEST(HashOf, CantPassExplicitTemplateParameters) {
   EXPECT_FALSE(HashOfExplicitParameter<int>(0));
 }
 
+TEST(SeededHash, DeterministicForEqualSeeds) {
+  const absl::SeededHash<std::string> a(0x12345678);
+  const absl::SeededHash<std::string> b(0x12345678);
+  const absl::SeededHash<std::string> other(0x87654321);
+  const std::string keys[] = {"", "a", "key", std::string(5000, 'x')};
+  for (const std::string& key : keys) {
+    // Independent instances with the same seed agree; they are not influenced
+    // by the per-process random seed.
+    EXPECT_EQ(a(key), b(key));
+    // A different seed changes the values.
+    EXPECT_NE(a(key), other(key)) << key.size();
+  }
+}
+
+TEST(SeededHash, SupportsHashableTypes) {
+  const absl::SeededHash<int> int_hasher(1);
+  const absl::SeededHash<std::pair<int, std::string>> pair_hasher(1);
+  EXPECT_NE(int_hasher(1), int_hasher(2));
+  EXPECT_NE(pair_hasher({1, "a"}), pair_hasher({1, "b"}));
+  EXPECT_EQ(pair_hasher({1, "a"}), pair_hasher({1, "a"}));
+}
+
+TEST(HashBatch, MatchesSingleHashes) {
+  // Key counts around the unrolling factor, including zero.
+  for (size_t n : {size_t{0}, size_t{1}, size_t{3}, size_t{4}, size_t{5},
+                   size_t{64}, size_t{67}}) {
+    std::vector<int64_t> keys(n);
+    for (size_t i = 0; i < n; ++i) keys[i] = static_cast<int64_t>(i * 977 - 3);
+    std::vector<size_t> out(n, 0);
+    absl::HashBatch(absl::MakeConstSpan(keys), absl::MakeSpan(out));
+    for (size_t i = 0; i < n; ++i) {
+      EXPECT_EQ(absl::Hash<int64_t>{}(keys[i]), out[i]) << n << "/" << i;
+    }
+  }
+
+  // Non-trivial key types hash identically too.
+  std::vector<std::string> skeys = {"", "a", "some longer key", "d", "e"};
+  std::vector<size_t> sout(skeys.size());
+  absl::HashBatch(absl::MakeConstSpan(skeys), absl::MakeSpan(sout));
+  for (size_t i = 0; i < skeys.size(); ++i) {
+    EXPECT_EQ(absl::Hash<std::string>{}(skeys[i]), sout[i]);
+  }
+}
+
+TEST(HashStream, MatchesFlatHashForAnyChunking) {
+  // Cover totals below, at, and well above the internal chunk size, and
+  // update sizes that leave the buffer at every kind of boundary.
+  std::string data;
+  for (int i = 0; i < 5000; ++i) data.push_back(static_cast<char>(i * 131));
+  const size_t expected = absl::Hash<absl::string_view>{}(data);
+
+  for (size_t chunk : {size_t{1}, size_t{7}, size_t{64}, size_t{1023},
+                       size_t{1024}, size_t{1025}, size_t{4096}}) {
+    absl::HashStream stream;
+    for (size_t i = 0; i < data.size(); i += chunk) {
+      stream.Update(absl::string_view(data).substr(i, chunk));
+    }
+    EXPECT_EQ(expected, std::move(stream).Finalize()) << chunk;
+  }
+}
+
+TEST(HashStream, EmptyStreamAndEmptyUpdates) {
+  absl::HashStream empty;
+  EXPECT_EQ(absl::Hash<absl::string_view>{}(""),
+            std::move(empty).Finalize());
+
+  const std::string data = "some modest payload";
+  absl::HashStream stream;
+  stream.Update("");
+  stream.Update(data);
+  stream.Update("");
+  EXPECT_EQ(absl::Hash<absl::string_view>{}(data),
+            std::move(stream).Finalize());
+}
+
 }  // namespace
@@ -82,6 +82,9 @@ namespace absl {
 ABSL_NAMESPACE_BEGIN
 
 class HashState;
+class HashStream;
+template <typename T>
+class SeededHash;
 
 namespace hash_internal {
 
@@ -340,6 +343,20 @@ struct is_uniquely_represented<
 template <>
 struct is_uniquely_represented<bool> : std::false_type {};
 
+// is_uniquely_represented for enum types
+//
+// Enums are represented as their underlying integral type, which has no
+// padding bits, so equal enumerator values always have equal object bytes.
+// Treating them as uniquely represented guarantees that contiguous ranges of
+// enums (e.g. `std::vector<MyEnum>`) are hashed as a single pass over raw
+// bytes rather than element by element. Like the scalar enum overload of
+// `AbslHashValue()` below, this assumes that no tooling stores out-of-band
+// data in the unused bits of an enum.
+template <typename T>
+struct is_uniquely_represented<
+    T, typename std::enable_if<std::is_enum<T>::value>::type>
+    : std::true_type {};
+
 // hash_bytes()
 //
 // Convenience function that combines `hash_state` with the byte representation
@@ -371,6 +388,11 @@ typename std::enable_if<std::is_same<B, bool>::value, H>::type AbslHashValue(
 }
 
 // AbslHashValue() for hashing enum values
+//
+// Note that `absl::Hash` normally reaches enums through the
+// `is_uniquely_represented` trait above and hashes their object bytes
+// directly; this overload remains for hash states that call `AbslHashValue`
+// without going through `HashSelect`.
 template <typename H, typename Enum>
 typename std::enable_if<std::is_enum<Enum>::value, H>::type AbslHashValue(
     H hash_state, Enum e) {
@@ -889,7 +911,9 @@ H AbslHashValue(H hash_state, const std::bitset<N>& set) {
 //
 // Mixes all values in the range [data, data+size) into the hash state.
 // This overload accepts only uniquely-represented types, and hashes them by
-// hashing the entire range of bytes.
+// hashing the entire range of bytes in a single `combine_contiguous` pass;
+// callers may rely on this (it is what makes hashing a numeric buffer as
+// cheap as hashing a string of the same size).
 template <typename H, typename T>
 typename std::enable_if<is_uniquely_represented<T>::value, H>::type
 hash_range_or_bytes(H hash_state, const T* data, size_t size) {
@@ -1086,6 +1110,15 @@ class ABSL_DLL MixingHashState : public HashStateBase<MixingHashState> {
   // RunCombinedUnordered() directly.
   friend class absl::HashState;
 
+  // Allow the streaming hasher to hold a MixingHashState and read out the
+  // final state.
+  friend class absl::HashStream;
+
+  // Allow the explicitly seeded hasher to start from a caller-provided state
+  // instead of the per-process seed.
+  template <typename T>
+  friend class absl::SeededHash;
+
   // Workaround for MSVC bug.
   // We make the type copyable to fix the calling convention, even though we
   // never actually copy it. Keep it private to not affect the public API of the
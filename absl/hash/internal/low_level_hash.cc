@@ -21,6 +21,11 @@
 #include "absl/base/prefetch.h"
 #include "absl/numeric/int128.h"
 
+#ifdef ABSL_HASH_INTERNAL_LOW_LEVEL_HASH_HAVE_AESNI
+#include <emmintrin.h>
+#include <wmmintrin.h>
+#endif
+
 namespace absl {
 ABSL_NAMESPACE_BEGIN
 namespace hash_internal {
@@ -31,6 +36,64 @@ static uint64_t Mix(uint64_t v0, uint64_t v1) {
   return absl::Uint128Low64(p) ^ absl::Uint128High64(p);
 }
 
+#ifdef ABSL_HASH_INTERNAL_LOW_LEVEL_HASH_HAVE_AESNI
+// Consumes 64-byte chunks from `*ptr` until at most 64 bytes remain, updating
+// `*ptr` and `*len` accordingly, and returns the resulting 64-bit state.
+//
+// Each chunk is absorbed with one AES round per 16-byte lane across four
+// independent lanes, so the loop is limited by load throughput rather than by
+// the latency of a multiply chain. A single round does not fully diffuse its
+// input, but every absorbed byte subsequently passes through at least two more
+// AES rounds when the lanes are combined, plus the 128-bit multiply performed
+// on the final 16 bytes by the caller. This is not meant to be secure - just
+// fast.
+static uint64_t BulkMixAesNi(const uint8_t** ptr, size_t* len,
+                             uint64_t current_state, const uint64_t salt[5]) {
+  const uint8_t* p = *ptr;
+  size_t remaining = *len;
+  __m128i s0 = _mm_set_epi64x(static_cast<int64_t>(salt[1]),
+                              static_cast<int64_t>(current_state));
+  __m128i s1 = _mm_set_epi64x(static_cast<int64_t>(salt[2]),
+                              static_cast<int64_t>(current_state));
+  __m128i s2 = _mm_set_epi64x(static_cast<int64_t>(salt[3]),
+                              static_cast<int64_t>(current_state));
+  __m128i s3 = _mm_set_epi64x(static_cast<int64_t>(salt[4]),
+                              static_cast<int64_t>(current_state));
+
+  do {
+    // Always prefetch the next cacheline.
+    PrefetchToLocalCache(p + ABSL_CACHELINE_SIZE);
+
+    s0 = _mm_aesenc_si128(
+        s0, _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+    s1 = _mm_aesenc_si128(
+        s1, _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 16)));
+    s2 = _mm_aesenc_si128(
+        s2, _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 32)));
+    s3 = _mm_aesenc_si128(
+        s3, _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 48)));
+
+    p += 64;
+    remaining -= 64;
+  } while (remaining > 64);
+
+  __m128i combined =
+      _mm_xor_si128(_mm_aesenc_si128(s0, s1), _mm_aesenc_si128(s2, s3));
+  combined = _mm_aesenc_si128(combined, _mm_set_epi64x(
+                                            static_cast<int64_t>(salt[1]),
+                                            static_cast<int64_t>(salt[2])));
+  combined = _mm_aesenc_si128(combined, _mm_set_epi64x(
+                                            static_cast<int64_t>(salt[3]),
+                                            static_cast<int64_t>(salt[4])));
+
+  *ptr = p;
+  *len = remaining;
+  return static_cast<uint64_t>(_mm_cvtsi128_si64(combined)) ^
+         static_cast<uint64_t>(
+             _mm_cvtsi128_si64(_mm_unpackhi_epi64(combined, combined)));
+}
+#endif  // ABSL_HASH_INTERNAL_LOW_LEVEL_HASH_HAVE_AESNI
+
 uint64_t LowLevelHashLenGt16(const void* data, size_t len, uint64_t seed,
                              const uint64_t salt[5]) {
   // Prefetch the cacheline that data resides in.
@@ -41,6 +104,9 @@ uint64_t LowLevelHashLenGt16(const void* data, size_t len, uint64_t seed,
   uint64_t current_state = seed ^ salt[0];
 
   if (len > 64) {
+#ifdef ABSL_HASH_INTERNAL_LOW_LEVEL_HASH_HAVE_AESNI
+    current_state = BulkMixAesNi(&ptr, &len, current_state, salt);
+#else
     // If we have more than 64 bytes, we're going to handle chunks of 64
     // bytes at a time. We're going to build up two separate hash states
     // which we will then hash together.
@@ -73,6 +139,7 @@ uint64_t LowLevelHashLenGt16(const void* data, size_t len, uint64_t seed,
 
     current_state = (current_state ^ duplicated_state0) ^
                     (duplicated_state1 + duplicated_state2);
+#endif  // ABSL_HASH_INTERNAL_LOW_LEVEL_HASH_HAVE_AESNI
   }
 
   // We now have a data `ptr` with at most 64 bytes and the current state
@@ -30,6 +30,17 @@
 
 #include "absl/base/config.h"
 
+// When the target instruction set is known at compile time to include AES-NI,
+// inputs longer than 64 bytes are mixed with AES rounds instead of 128-bit
+// multiplications, which moves long-input hashing much closer to memory
+// bandwidth. This changes the computed hash values for such inputs, so the
+// choice is made at compile time only: every machine running the same binary
+// computes the same hashes. We deliberately do not use runtime CPU dispatch
+// here for that reason.
+#if defined(__AES__) && defined(__x86_64__)
+#define ABSL_HASH_INTERNAL_LOW_LEVEL_HASH_HAVE_AESNI 1
+#endif
+
 namespace absl {
 ABSL_NAMESPACE_BEGIN
 namespace hash_internal {
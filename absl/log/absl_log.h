@@ -57,6 +57,8 @@
   ABSL_LOG_INTERNAL_LOG_EVERY_POW_2_IMPL(_##severity)
 #define ABSL_LOG_EVERY_N_SEC(severity, n_seconds) \
   ABSL_LOG_INTERNAL_LOG_EVERY_N_SEC_IMPL(_##severity, n_seconds)
+#define ABSL_LOG_AT_MOST_RATE(severity, n_per_sec) \
+  ABSL_LOG_INTERNAL_LOG_AT_MOST_RATE_IMPL(_##severity, n_per_sec)
 
 #define ABSL_PLOG_EVERY_N(severity, n) \
   ABSL_LOG_INTERNAL_PLOG_EVERY_N_IMPL(_##severity, n)
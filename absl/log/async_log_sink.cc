@@ -0,0 +1,243 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/log/async_log_sink.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>  // NOLINT(build/c++11)
+#include <vector>
+
+#include "absl/base/config.h"
+#include "absl/base/log_severity.h"
+#include "absl/log/log_entry.h"
+#include "absl/log/log_sink.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/time/time.h"
+#include "absl/types/span.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+struct AsyncLogSink::BufferedEntry {
+  explicit BufferedEntry(const LogEntry& entry)
+      : full_filename(entry.source_filename()),
+        base_filename(entry.source_basename()),
+        line(entry.source_line()),
+        prefix(entry.prefix()),
+        severity(entry.log_severity()),
+        verbosity(entry.verbosity()),
+        timestamp(entry.timestamp()),
+        tid(entry.tid()),
+        text(entry.text_message_with_prefix_and_newline()),
+        prefix_len(entry.text_message_with_prefix_and_newline().size() -
+                   entry.text_message_with_newline().size()),
+        encoding(entry.encoded_message()),
+        stacktrace(entry.stacktrace()) {}
+
+  std::string full_filename;
+  std::string base_filename;
+  int line;
+  bool prefix;
+  absl::LogSeverity severity;
+  int verbosity;
+  absl::Time timestamp;
+  LogEntry::tid_t tid;
+  // Prefix, streamed data, and trailing newline; `std::string` guarantees a
+  // nul terminator one past the end.
+  std::string text;
+  size_t prefix_len;
+  std::string encoding;
+  std::string stacktrace;
+};
+
+// The ring buffer is a bounded MPMC queue in the style described by Dmitry
+// Vyukov.  Each slot carries a sequence number: a producer may claim slot
+// `pos` when its sequence equals `pos`, and stores `pos + 1` once the entry
+// pointer is in place; a consumer may take from slot `pos` when its sequence
+// equals `pos + 1`, and stores `pos + capacity` to hand the slot to the
+// producer of the next lap.  Producers are lock-free; consumers additionally
+// serialize on `drain_mutex_` since entries must reach the wrapped sink in
+// order.
+struct AsyncLogSink::Slot {
+  std::atomic<size_t> sequence;
+  BufferedEntry* entry;
+};
+
+AsyncLogSink::AsyncLogSink(LogSink* sink, size_t buffer_size)
+    : sink_(sink),
+      enqueue_pos_(0),
+      dequeue_pos_(0),
+      discarded_(0),
+      stopping_(false) {
+  size_t capacity = 2;
+  while (capacity < buffer_size) capacity *= 2;
+  mask_ = capacity - 1;
+  slots_.reset(new Slot[capacity]);
+  for (size_t i = 0; i != capacity; ++i) {
+    slots_[i].sequence.store(i, std::memory_order_relaxed);
+    slots_[i].entry = nullptr;
+  }
+  flusher_ = std::thread(&AsyncLogSink::FlusherLoop, this);
+}
+
+AsyncLogSink::~AsyncLogSink() {
+  {
+    absl::MutexLock lock(&flusher_mutex_);
+    stopping_.store(true, std::memory_order_relaxed);
+  }
+  flusher_.join();
+  // Deliver anything enqueued after the flusher thread's final drain.
+  Drain();
+}
+
+void AsyncLogSink::Send(const LogEntry& entry) {
+  BufferedEntry* buffered = new BufferedEntry(entry);
+  if (entry.log_severity() == absl::LogSeverity::kFatal) {
+    // The process terminates once the fatal entry has been sent to each
+    // sink; entries still in the buffer would be lost, and so would this
+    // one.  Drain and deliver synchronously instead.
+    Drain();
+    Forward(*buffered);
+    delete buffered;
+    return;
+  }
+  if (!Enqueue(buffered)) {
+    delete buffered;
+    discarded_.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+void AsyncLogSink::Flush() {
+  Drain();
+  sink_->Flush();
+}
+
+uint64_t AsyncLogSink::DiscardedCount() const {
+  return discarded_.load(std::memory_order_relaxed);
+}
+
+bool AsyncLogSink::Enqueue(BufferedEntry* buffered) {
+  size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+  while (true) {
+    Slot& slot = slots_[pos & mask_];
+    const size_t seq = slot.sequence.load(std::memory_order_acquire);
+    if (seq == pos) {
+      if (enqueue_pos_.compare_exchange_weak(pos, pos + 1,
+                                             std::memory_order_relaxed)) {
+        slot.entry = buffered;
+        slot.sequence.store(pos + 1, std::memory_order_release);
+        return true;
+      }
+      // Lost the race for this slot; `pos` was reloaded by the CAS.
+    } else if (static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos) < 0) {
+      // The slot has not yet been consumed on the previous lap: full.
+      return false;
+    } else {
+      pos = enqueue_pos_.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+AsyncLogSink::BufferedEntry* AsyncLogSink::Dequeue() {
+  const size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+  Slot& slot = slots_[pos & mask_];
+  // Not `pos + 1`: either the buffer is empty or the producer that claimed
+  // this slot has not finished publishing; in both cases there is nothing to
+  // take yet.
+  if (slot.sequence.load(std::memory_order_acquire) != pos + 1) return nullptr;
+  BufferedEntry* buffered = slot.entry;
+  slot.entry = nullptr;
+  slot.sequence.store(pos + mask_ + 1, std::memory_order_release);
+  dequeue_pos_.store(pos + 1, std::memory_order_relaxed);
+  return buffered;
+}
+
+void AsyncLogSink::Drain() {
+  absl::MutexLock lock(&drain_mutex_);
+  std::vector<BufferedEntry*> batch;
+  while (true) {
+    while (BufferedEntry* buffered = Dequeue()) batch.push_back(buffered);
+    if (batch.empty()) return;
+    ForwardBatch(batch);
+    for (BufferedEntry* buffered : batch) delete buffered;
+    // Entries enqueued while the batch was being delivered are drained too,
+    // so `Flush` keeps its "everything logged so far" guarantee.
+    batch.clear();
+  }
+}
+
+void AsyncLogSink::Rebuild(const BufferedEntry& buffered, LogEntry& entry) {
+  entry.full_filename_ = buffered.full_filename;
+  entry.base_filename_ = buffered.base_filename;
+  entry.line_ = buffered.line;
+  entry.prefix_ = buffered.prefix;
+  entry.severity_ = buffered.severity;
+  entry.verbose_level_ = buffered.verbosity;
+  entry.timestamp_ = buffered.timestamp;
+  entry.tid_ = buffered.tid;
+  entry.text_message_with_prefix_and_newline_and_nul_ =
+      absl::Span<const char>(buffered.text.c_str(), buffered.text.size() + 1);
+  entry.prefix_len_ = buffered.prefix_len;
+  entry.encoding_ = buffered.encoding;
+  entry.stacktrace_ = buffered.stacktrace;
+}
+
+void AsyncLogSink::Forward(const BufferedEntry& buffered) {
+  LogEntry entry;
+  Rebuild(buffered, entry);
+  sink_->Send(entry);
+}
+
+void AsyncLogSink::ForwardBatch(absl::Span<BufferedEntry* const> batch) {
+  // `LogEntry` is neither copyable nor movable, so the batch is materialized
+  // as a default-constructed array filled in place.  Each entry borrows its
+  // `BufferedEntry`'s strings, which outlive the `SendBatch` call.
+  std::unique_ptr<LogEntry[]> entries(new LogEntry[batch.size()]);
+  for (size_t i = 0; i < batch.size(); ++i) {
+    Rebuild(*batch[i], entries[i]);
+  }
+  sink_->SendBatch(absl::MakeConstSpan(entries.get(), batch.size()));
+}
+
+bool AsyncLogSink::HasBufferedEntries() const {
+  const size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+  return slots_[pos & mask_].sequence.load(std::memory_order_acquire) ==
+         pos + 1;
+}
+
+bool AsyncLogSink::FlusherShouldWake() const {
+  return stopping_.load(std::memory_order_relaxed) || HasBufferedEntries();
+}
+
+void AsyncLogSink::FlusherLoop() {
+  while (true) {
+    Drain();
+    absl::MutexLock lock(&flusher_mutex_);
+    if (stopping_.load(std::memory_order_relaxed)) return;
+    // Producers never take `flusher_mutex_`, so newly-buffered entries are
+    // noticed when the timeout elapses rather than via the condition; the
+    // timeout bounds delivery latency while the buffer is non-empty and the
+    // condition makes shutdown prompt.
+    flusher_mutex_.AwaitWithTimeout(
+        absl::Condition(this, &AsyncLogSink::FlusherShouldWake),
+        absl::Milliseconds(50));
+  }
+}
+
+ABSL_NAMESPACE_END
+}  // namespace absl
@@ -0,0 +1,149 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// -----------------------------------------------------------------------------
+// File: log/async_log_sink.h
+// -----------------------------------------------------------------------------
+//
+// This header declares `class absl::AsyncLogSink`, a sink adaptor which
+// decouples the thread that evaluates a `LOG` statement from the thread that
+// writes the message out.
+
+#ifndef ABSL_LOG_ASYNC_LOG_SINK_H_
+#define ABSL_LOG_ASYNC_LOG_SINK_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>  // NOLINT(build/c++11)
+
+#include "absl/base/config.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/log/log_entry.h"
+#include "absl/log/log_sink.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/types/span.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+// AsyncLogSink
+//
+// `absl::AsyncLogSink` wraps another `absl::LogSink` and makes its delivery
+// asynchronous.  `Send` copies the already-formatted `absl::LogEntry` payload
+// into a bounded, lock-free ring buffer and returns without blocking on the
+// wrapped sink; a background flusher thread owned by this object drains the
+// buffer and forwards each buffered entry, in order, to the wrapped sink.
+// This keeps slow writers (network sinks, cold disks) off the critical path
+// of the logging thread.
+//
+// Overflow policy is drop-and-count: if the buffer is full when `Send` is
+// called, the entry is discarded and `DiscardedCount()` is incremented.
+// `Send` never blocks waiting for buffer space.
+//
+// Two situations are handled synchronously on the logging thread:
+//
+//   * `Flush()` drains all buffered entries into the wrapped sink and then
+//     flushes it, so callers keep the usual "everything logged so far is
+//     durable after `Flush`" guarantee.
+//   * Entries with severity `FATAL` drain the buffer and are forwarded
+//     immediately, since the process terminates as soon as `Send` returns and
+//     anything left in the buffer would otherwise be lost.
+//
+// Otherwise buffered entries are written out as soon as the flusher thread
+// observes them, within a few tens of milliseconds at the latest.
+//
+// Example:
+//
+//   MyRemoteSink remote_sink;
+//   absl::AsyncLogSink async_sink(&remote_sink);
+//   absl::AddLogSink(&async_sink);
+//   ...
+//   absl::RemoveLogSink(&async_sink);  // before async_sink is destroyed
+//
+// The wrapped sink must outlive the `AsyncLogSink`, and its `Send` and
+// `Flush` must be thread-safe; they are invoked from the flusher thread and,
+// for the synchronous cases above, from logging threads.  The destructor
+// stops the flusher thread and delivers any remaining buffered entries.
+//
+// This class is thread-safe.
+class AsyncLogSink final : public LogSink {
+ public:
+  // Wraps `sink`, buffering up to `buffer_size` entries (rounded up to a
+  // power of two) between the logging threads and the flusher thread.
+  explicit AsyncLogSink(LogSink* sink, size_t buffer_size = 512);
+  ~AsyncLogSink() override;
+
+  AsyncLogSink(const AsyncLogSink&) = delete;
+  AsyncLogSink& operator=(const AsyncLogSink&) = delete;
+
+  void Send(const LogEntry& entry) override;
+  void Flush() override;
+
+  // AsyncLogSink::DiscardedCount()
+  //
+  // Returns the number of entries dropped so far because the buffer was full
+  // when they arrived.
+  uint64_t DiscardedCount() const;
+
+ private:
+  // A deep copy of one formatted `LogEntry`'s data, made on the logging
+  // thread and consumed on the flusher thread.
+  struct BufferedEntry;
+  // One ring buffer element; see the implementation for the protocol.
+  struct Slot;
+
+  // Attempts to publish `buffered` into the ring buffer.  Returns false
+  // (without taking ownership) if the buffer is full.  Lock-free; safe to
+  // call from any number of threads.
+  bool Enqueue(BufferedEntry* buffered);
+  // Removes and returns the oldest buffered entry, or null if none is ready.
+  BufferedEntry* Dequeue() ABSL_EXCLUSIVE_LOCKS_REQUIRED(drain_mutex_);
+  // Forwards all currently-buffered entries to the wrapped sink, batched
+  // through `LogSink::SendBatch` so the sink can amortize per-message costs.
+  void Drain() ABSL_LOCKS_EXCLUDED(drain_mutex_);
+  // Rebuilds a `LogEntry` from `buffered`; the entry borrows `buffered`'s
+  // strings and must not outlive it.
+  static void Rebuild(const BufferedEntry& buffered, LogEntry& entry);
+  // Rebuilds a `LogEntry` from `buffered` and sends it to the wrapped sink.
+  void Forward(const BufferedEntry& buffered);
+  // Rebuilds the batch and delivers it with one `SendBatch` call.
+  void ForwardBatch(absl::Span<BufferedEntry* const> batch);
+  // True if the oldest slot holds a fully-published entry.
+  bool HasBufferedEntries() const;
+  // Wake-up predicate for the flusher thread.
+  bool FlusherShouldWake() const;
+  void FlusherLoop();
+
+  LogSink* const sink_;
+  size_t mask_;
+  std::unique_ptr<Slot[]> slots_;
+  std::atomic<size_t> enqueue_pos_;
+  std::atomic<size_t> dequeue_pos_;
+  std::atomic<uint64_t> discarded_;
+  // Serializes consumers (the flusher thread vs. synchronous drains).
+  absl::Mutex drain_mutex_;
+  // Guards the flusher thread's sleep/wake handshake.  Written only under
+  // `flusher_mutex_` so that `Mutex::Await` observes the change; atomic so
+  // that the wake-up predicate needs no lock annotations.
+  absl::Mutex flusher_mutex_;
+  std::atomic<bool> stopping_;
+  std::thread flusher_;
+};
+
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_LOG_ASYNC_LOG_SINK_H_
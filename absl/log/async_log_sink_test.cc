@@ -0,0 +1,252 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/log/async_log_sink.h"
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "absl/base/log_severity.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/log/log.h"
+#include "absl/log/log_entry.h"
+#include "absl/log/log_sink.h"
+#include "absl/log/scoped_mock_log.h"
+#include "absl/strings/match.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/synchronization/notification.h"
+#include "absl/types/span.h"
+
+namespace {
+using ::testing::_;
+
+// Records the data of every entry it receives so tests can check that
+// buffered entries reach the wrapped sink intact.
+class RecordingLogSink : public absl::LogSink {
+ public:
+  struct Record {
+    std::string text_with_prefix_and_newline;
+    std::string message;
+    std::string basename;
+    int line;
+    bool prefix;
+    absl::LogSeverity severity;
+  };
+
+  void Send(const absl::LogEntry& entry) override {
+    Record record;
+    record.text_with_prefix_and_newline =
+        std::string(entry.text_message_with_prefix_and_newline());
+    record.message = std::string(entry.text_message());
+    record.basename = std::string(entry.source_basename());
+    record.line = entry.source_line();
+    record.prefix = entry.prefix();
+    record.severity = entry.log_severity();
+    absl::MutexLock lock(&mutex_);
+    records_.push_back(std::move(record));
+  }
+
+  void Flush() override { flush_count_.fetch_add(1, std::memory_order_relaxed); }
+
+  std::vector<Record> records() const {
+    absl::MutexLock lock(&mutex_);
+    return records_;
+  }
+  int flush_count() const {
+    return flush_count_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  mutable absl::Mutex mutex_;
+  std::vector<Record> records_ ABSL_GUARDED_BY(mutex_);
+  std::atomic<int> flush_count_{0};
+};
+
+// Holds every `Send` until `Unblock` is called, so tests can fill the
+// buffer deterministically.
+class BlockingLogSink : public absl::LogSink {
+ public:
+  void Send(const absl::LogEntry& entry) override {
+    unblock_.WaitForNotification();
+    absl::MutexLock lock(&mutex_);
+    messages_.push_back(std::string(entry.text_message()));
+  }
+
+  void Unblock() { unblock_.Notify(); }
+
+  size_t message_count() const {
+    absl::MutexLock lock(&mutex_);
+    return messages_.size();
+  }
+
+ private:
+  absl::Notification unblock_;
+  mutable absl::Mutex mutex_;
+  std::vector<std::string> messages_ ABSL_GUARDED_BY(mutex_);
+};
+
+TEST(AsyncLogSinkTest, ForwardsEntriesToWrappedSink) {
+  absl::ScopedMockLog wrapped(absl::MockLogDefault::kDisallowUnexpected);
+  EXPECT_CALL(wrapped, Log(absl::LogSeverity::kInfo, _, "hello world"));
+
+  absl::AsyncLogSink async_sink(&wrapped.UseAsLocalSink());
+  LOG(INFO).ToSinkOnly(&async_sink) << "hello world";
+  async_sink.Flush();
+}
+
+TEST(AsyncLogSinkTest, PreservesEntryData) {
+  RecordingLogSink wrapped;
+  absl::AsyncLogSink async_sink(&wrapped);
+
+  const int expected_line = __LINE__ + 1;
+  LOG(WARNING).ToSinkOnly(&async_sink) << "buffered";
+  async_sink.Flush();
+
+  const auto records = wrapped.records();
+  ASSERT_EQ(records.size(), 1);
+  EXPECT_EQ(records[0].message, "buffered");
+  EXPECT_EQ(records[0].basename, "async_log_sink_test.cc");
+  EXPECT_EQ(records[0].line, expected_line);
+  EXPECT_TRUE(records[0].prefix);
+  EXPECT_EQ(records[0].severity, absl::LogSeverity::kWarning);
+  EXPECT_TRUE(absl::EndsWith(records[0].text_with_prefix_and_newline,
+                             "buffered\n"));
+  EXPECT_GT(records[0].text_with_prefix_and_newline.size(),
+            records[0].message.size() + 1);
+}
+
+TEST(AsyncLogSinkTest, FlushDrainsBufferAndFlushesWrappedSink) {
+  RecordingLogSink wrapped;
+  absl::AsyncLogSink async_sink(&wrapped);
+
+  for (int i = 0; i < 10; ++i) {
+    LOG(INFO).ToSinkOnly(&async_sink) << "message " << i;
+  }
+  async_sink.Flush();
+
+  EXPECT_EQ(wrapped.records().size(), 10);
+  EXPECT_GE(wrapped.flush_count(), 1);
+  EXPECT_EQ(async_sink.DiscardedCount(), 0);
+}
+
+TEST(AsyncLogSinkTest, DeliversEntriesInOrder) {
+  RecordingLogSink wrapped;
+  absl::AsyncLogSink async_sink(&wrapped);
+
+  for (int i = 0; i < 100; ++i) {
+    LOG(INFO).ToSinkOnly(&async_sink) << "message " << i;
+  }
+  async_sink.Flush();
+
+  const auto records = wrapped.records();
+  ASSERT_EQ(records.size(), 100);
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_EQ(records[i].message, "message " + std::to_string(i));
+  }
+}
+
+TEST(AsyncLogSinkTest, OverflowDropsAndCounts) {
+  BlockingLogSink wrapped;
+  absl::AsyncLogSink async_sink(&wrapped, /*buffer_size=*/2);
+
+  // The wrapped sink accepts nothing yet, so at most two entries fit in the
+  // buffer plus a batch of up to two in flight on the flusher thread; the
+  // rest must be dropped and counted.
+  for (int i = 0; i < 8; ++i) {
+    LOG(INFO).ToSinkOnly(&async_sink) << "message " << i;
+  }
+  EXPECT_GE(async_sink.DiscardedCount(), 4);
+
+  wrapped.Unblock();
+  async_sink.Flush();
+  EXPECT_EQ(wrapped.message_count() + async_sink.DiscardedCount(), 8);
+}
+
+// Overrides `SendBatch` so tests can verify that buffered entries are
+// delivered in batches rather than one `Send` call each.
+class BatchRecordingLogSink : public absl::LogSink {
+ public:
+  void Send(const absl::LogEntry&) override {
+    single_sends_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  void SendBatch(absl::Span<const absl::LogEntry> entries) override {
+    absl::MutexLock lock(&mutex_);
+    batch_sizes_.push_back(entries.size());
+    for (const absl::LogEntry& entry : entries) {
+      messages_.push_back(std::string(entry.text_message()));
+    }
+  }
+
+  std::vector<std::string> messages() const {
+    absl::MutexLock lock(&mutex_);
+    return messages_;
+  }
+  std::vector<size_t> batch_sizes() const {
+    absl::MutexLock lock(&mutex_);
+    return batch_sizes_;
+  }
+  int single_sends() const {
+    return single_sends_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  mutable absl::Mutex mutex_;
+  std::vector<std::string> messages_ ABSL_GUARDED_BY(mutex_);
+  std::vector<size_t> batch_sizes_ ABSL_GUARDED_BY(mutex_);
+  std::atomic<int> single_sends_{0};
+};
+
+TEST(AsyncLogSinkTest, DeliversBufferedEntriesThroughSendBatch) {
+  BatchRecordingLogSink wrapped;
+  absl::AsyncLogSink async_sink(&wrapped);
+
+  for (int i = 0; i < 50; ++i) {
+    LOG(INFO).ToSinkOnly(&async_sink) << "message " << i;
+  }
+  async_sink.Flush();
+
+  // Every non-fatal entry arrives through SendBatch, in order, and never
+  // through Send.
+  const auto messages = wrapped.messages();
+  ASSERT_EQ(messages.size(), 50);
+  for (int i = 0; i < 50; ++i) {
+    EXPECT_EQ(messages[i], "message " + std::to_string(i));
+  }
+  EXPECT_EQ(wrapped.single_sends(), 0);
+  size_t batched = 0;
+  for (size_t size : wrapped.batch_sizes()) {
+    EXPECT_GT(size, 0);
+    batched += size;
+  }
+  EXPECT_EQ(batched, 50);
+}
+
+TEST(AsyncLogSinkTest, DestructorDeliversRemainingEntries) {
+  RecordingLogSink wrapped;
+  {
+    absl::AsyncLogSink async_sink(&wrapped);
+    for (int i = 0; i < 5; ++i) {
+      LOG(INFO).ToSinkOnly(&async_sink) << "message " << i;
+    }
+  }
+  EXPECT_EQ(wrapped.records().size(), 5);
+}
+
+}  // namespace
@@ -67,6 +67,15 @@ std::string* CheckOpMessageBuilder::NewString() {
   return new std::string(stream_.str());
 }
 
+std::string* MakeCheckOpStringSlow(const void* v1, CheckOpPrinter print1,
+                                   const void* v2, CheckOpPrinter print2,
+                                   const char* exprtext) {
+  CheckOpMessageBuilder comb(exprtext);
+  print1(comb.ForVar1(), v1);
+  print2(comb.ForVar2(), v2);
+  return comb.NewString();
+}
+
 void MakeCheckOpValueString(std::ostream& os, const char v) {
   if (v >= 32 && v <= 126) {
     os << "'" << v << "'";
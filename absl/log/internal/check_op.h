@@ -334,17 +334,36 @@ Detect(...);  // Ellipsis has lowest preference when int passed.
 template <typename T>
 using CheckOpStreamType = decltype(detect_specialization::Detect<T>(0));
 
+// A type-erased printer for one operand of a failed `CHECK_XX`.  `p` points to
+// a value of the type the printer was instantiated for.
+using CheckOpPrinter = void (*)(std::ostream& os, const void* p);
+
+template <typename T>
+void PrintCheckOpValue(std::ostream& os, const void* p) {
+  MakeCheckOpValueString(os, *static_cast<const T*>(p));
+}
+
+// Builds the `expr (V1 vs. V2)` message from type-erased operands.  Defined
+// out of line, in a single TU, so that the stream machinery is shared by all
+// `MakeCheckOpString` instantiations rather than duplicated per type pair.
+ABSL_ATTRIBUTE_RETURNS_NONNULL std::string* MakeCheckOpStringSlow(
+    const void* v1, CheckOpPrinter print1, const void* v2,
+    CheckOpPrinter print2, const char* exprtext);
+
 // Build the error message string.  Specify no inlining for code size.
+// The body is a thin shim over `MakeCheckOpStringSlow`: each (T1, T2)
+// instantiation costs two operand addresses and two printer pointers, keeping
+// the O(n^2) pair instantiations cheap while the printers are O(n).
 template <typename T1, typename T2>
 ABSL_ATTRIBUTE_RETURNS_NONNULL std::string* MakeCheckOpString(
     T1 v1, T2 v2, const char* exprtext) ABSL_ATTRIBUTE_NOINLINE;
 
 template <typename T1, typename T2>
 std::string* MakeCheckOpString(T1 v1, T2 v2, const char* exprtext) {
-  CheckOpMessageBuilder comb(exprtext);
-  MakeCheckOpValueString(comb.ForVar1(), v1);
-  MakeCheckOpValueString(comb.ForVar2(), v2);
-  return comb.NewString();
+  return MakeCheckOpStringSlow(
+      &v1, PrintCheckOpValue<std::remove_cv_t<std::remove_reference_t<T1>>>,
+      &v2, PrintCheckOpValue<std::remove_cv_t<std::remove_reference_t<T2>>>,
+      exprtext);
 }
 
 // Add a few commonly used instantiations as extern to reduce size of objects
@@ -78,6 +78,49 @@ bool LogEveryNSecState::ShouldLog(double seconds) {
 #endif
 }
 
+bool LogAtMostRateState::ShouldLog(int n_per_sec) {
+  using absl::base_internal::CycleClock;
+  LossyIncrement(&counter_);
+  if (n_per_sec <= 0) return false;
+  const int64_t now_cycles = CycleClock::Now();
+  int64_t window_cycles = window_start_cycles_.load(std::memory_order_relaxed);
+  if (now_cycles - window_cycles >=
+      static_cast<int64_t>(CycleClock::Frequency())) {
+#if defined(__myriad2__)
+    // As in `LogEveryNSecState`: myriad2 does not have 8-byte compare and
+    // exchange, so use a racy version that may over-log in the face of
+    // concurrent logging.
+    window_start_cycles_.store(now_cycles, std::memory_order_relaxed);
+    tokens_used_.store(1, std::memory_order_relaxed);
+    return true;
+#else
+    // Start a new one-second window.  The winner of the race takes the first
+    // token; losers fall through and contend for the remaining ones.  A loser
+    // that claims a token between the exchange and the store below causes one
+    // extra message that window; like the lossy counters above, occasional
+    // over-logging is fine.
+    if (window_start_cycles_.compare_exchange_strong(
+            window_cycles, now_cycles, std::memory_order_relaxed,
+            std::memory_order_relaxed)) {
+      tokens_used_.store(1, std::memory_order_relaxed);
+      return true;
+    }
+#endif
+  }
+  // Claim a token in the current window.  Suppressed calls, the common case
+  // in a log storm, return after two relaxed loads and never touch the
+  // compare-and-exchange.
+  uint32_t used = tokens_used_.load(std::memory_order_relaxed);
+  while (true) {
+    if (used >= static_cast<uint32_t>(n_per_sec)) return false;
+    if (tokens_used_.compare_exchange_weak(used, used + 1,
+                                           std::memory_order_relaxed,
+                                           std::memory_order_relaxed)) {
+      return true;
+    }
+  }
+}
+
 }  // namespace log_internal
 ABSL_NAMESPACE_END
 }  // namespace absl
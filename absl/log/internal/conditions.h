@@ -228,6 +228,19 @@ class LogEveryNSecState final {
   std::atomic<int64_t> next_log_time_cycles_{0};
 };
 
+class LogAtMostRateState final {
+ public:
+  bool ShouldLog(int n_per_sec);
+  uint32_t counter() { return counter_.load(std::memory_order_relaxed); }
+
+ private:
+  std::atomic<uint32_t> counter_{0};
+  // Tokens claimed in the current one-second window.
+  std::atomic<uint32_t> tokens_used_{0};
+  // Cycle count according to CycleClock at which the current window began.
+  std::atomic<int64_t> window_start_cycles_{0};
+};
+
 // Helper routines to abort the application quietly
 
 ABSL_ATTRIBUTE_NORETURN inline void AbortQuietly() { abort(); }
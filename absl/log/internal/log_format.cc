@@ -72,6 +72,39 @@ PutLeadingWhitespace(T tid, char*& p) {
   if (tid > -100000 && tid < 1000000) *p++ = ' ';
 }
 
+// Length of the formatted "MMDD HH:MM:SS" fields, without a terminator.
+constexpr size_t kCivilSecondLen = sizeof("MMDD HH:MM:SS") - sizeof("");
+
+// Writes the "MMDD HH:MM:SS" fields (`kCivilSecondLen` chars, no terminator).
+void FormatCivilSecond(absl::CivilSecond cs, char* p) {
+  absl::numbers_internal::PutTwoDigits(static_cast<uint32_t>(cs.month()), p);
+  p += 2;
+  absl::numbers_internal::PutTwoDigits(static_cast<uint32_t>(cs.day()), p);
+  p += 2;
+  *p++ = ' ';
+  absl::numbers_internal::PutTwoDigits(static_cast<uint32_t>(cs.hour()), p);
+  p += 2;
+  *p++ = ':';
+  absl::numbers_internal::PutTwoDigits(static_cast<uint32_t>(cs.minute()), p);
+  p += 2;
+  *p++ = ':';
+  absl::numbers_internal::PutTwoDigits(static_cast<uint32_t>(cs.second()), p);
+}
+
+#ifdef ABSL_HAVE_THREAD_LOCAL
+// The civil-time conversion below is measurable at high log rates, and
+// consecutive messages usually land in the same second, so each thread caches
+// the formatted "MMDD HH:MM:SS" fields and re-renders only the microseconds
+// until the second rolls over or the time zone changes.
+struct SecondCache {
+  const absl::TimeZone* tz = nullptr;
+  // Absolute time at which the cached civil second began; the cached text is
+  // valid for timestamps in [second_start, second_start + 1s).
+  absl::Time second_start = absl::InfiniteFuture();
+  char text[kCivilSecondLen];
+};
+#endif  // ABSL_HAVE_THREAD_LOCAL
+
 // The fields before the filename are all fixed-width except for the thread ID,
 // which is of bounded width.
 size_t FormatBoundedFields(absl::LogSeverity severity, absl::Time timestamp,
@@ -112,24 +145,31 @@ size_t FormatBoundedFields(absl::LogSeverity severity, absl::Time timestamp,
 
   char* p = buf.data();
   *p++ = absl::LogSeverityName(severity)[0];
+  absl::Duration subsecond;
+#ifdef ABSL_HAVE_THREAD_LOCAL
+  thread_local SecondCache second_cache;
+  if (ABSL_PREDICT_TRUE(second_cache.tz == tz &&
+                        timestamp >= second_cache.second_start &&
+                        timestamp - second_cache.second_start <
+                            absl::Seconds(1))) {
+    subsecond = timestamp - second_cache.second_start;
+  } else {
+    const absl::TimeZone::CivilInfo ci = tz->At(timestamp);
+    FormatCivilSecond(ci.cs, second_cache.text);
+    second_cache.tz = tz;
+    second_cache.second_start = timestamp - ci.subsecond;
+    subsecond = ci.subsecond;
+  }
+  memcpy(p, second_cache.text, kCivilSecondLen);
+  p += kCivilSecondLen;
+#else   // ABSL_HAVE_THREAD_LOCAL
   const absl::TimeZone::CivilInfo ci = tz->At(timestamp);
-  absl::numbers_internal::PutTwoDigits(static_cast<uint32_t>(ci.cs.month()), p);
-  p += 2;
-  absl::numbers_internal::PutTwoDigits(static_cast<uint32_t>(ci.cs.day()), p);
-  p += 2;
-  *p++ = ' ';
-  absl::numbers_internal::PutTwoDigits(static_cast<uint32_t>(ci.cs.hour()), p);
-  p += 2;
-  *p++ = ':';
-  absl::numbers_internal::PutTwoDigits(static_cast<uint32_t>(ci.cs.minute()),
-                                       p);
-  p += 2;
-  *p++ = ':';
-  absl::numbers_internal::PutTwoDigits(static_cast<uint32_t>(ci.cs.second()),
-                                       p);
-  p += 2;
+  FormatCivilSecond(ci.cs, p);
+  p += kCivilSecondLen;
+  subsecond = ci.subsecond;
+#endif  // ABSL_HAVE_THREAD_LOCAL
   *p++ = '.';
-  const int64_t usecs = absl::ToInt64Microseconds(ci.subsecond);
+  const int64_t usecs = absl::ToInt64Microseconds(subsecond);
   absl::numbers_internal::PutTwoDigits(static_cast<uint32_t>(usecs / 10000), p);
   p += 2;
   absl::numbers_internal::PutTwoDigits(static_cast<uint32_t>(usecs / 100 % 100),
@@ -109,6 +109,12 @@
   ABSL_LOG_INTERNAL_CONDITION##severity(STATEFUL, true)(EveryNSec, n_seconds) \
       ABSL_LOGGING_INTERNAL_LOG##severity.InternalStream()
 
+// ABSL_LOG_AT_MOST_RATE
+#define ABSL_LOG_INTERNAL_LOG_AT_MOST_RATE_IMPL(severity, n_per_sec) \
+  ABSL_LOG_INTERNAL_CONDITION##severity(STATEFUL, true)(AtMostRate,  \
+                                                        n_per_sec)   \
+      ABSL_LOGGING_INTERNAL_LOG##severity.InternalStream()
+
 #define ABSL_LOG_INTERNAL_PLOG_EVERY_N_IMPL(severity, n)           \
   ABSL_LOG_INTERNAL_CONDITION##severity(STATEFUL, true)(EveryN, n) \
       ABSL_LOGGING_INTERNAL_LOG##severity.InternalStream()         \
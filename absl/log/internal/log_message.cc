@@ -117,6 +117,30 @@ void WriteToStream(const char* data, void* os) {
   auto* cast_os = static_cast<std::ostream*>(os);
   *cast_os << data;
 }
+
+#ifdef ABSL_HAVE_THREAD_LOCAL
+// A per-thread cache of storage for `LogMessageData` so that steady-state
+// logging does not allocate.  `LogMessageData` is large (it holds two
+// message-sized buffers), so blocks are cached rather than kept on the stack.
+// More than one block per thread is kept because logging can be reentrant,
+// e.g. a registered `LogSink` whose `Send` itself logs; deeper nesting than
+// the cache covers falls back to the heap.
+constexpr size_t kLogMessageDataCacheBlocks = 4;
+
+struct LogMessageDataCache {
+  void* blocks[kLogMessageDataCacheBlocks];
+  size_t size = 0;
+
+  ~LogMessageDataCache() {
+    while (size > 0) ::operator delete(blocks[--size]);
+  }
+};
+
+LogMessageDataCache& GetLogMessageDataCache() {
+  thread_local LogMessageDataCache cache;
+  return cache;
+}
+#endif  // ABSL_HAVE_THREAD_LOCAL
 }  // namespace
 
 struct LogMessage::LogMessageData final {
@@ -125,6 +149,11 @@ struct LogMessage::LogMessageData final {
   LogMessageData(const LogMessageData&) = delete;
   LogMessageData& operator=(const LogMessageData&) = delete;
 
+  // Storage is recycled through a per-thread cache so that steady-state
+  // logging performs no heap allocations.
+  static void* operator new(size_t size);
+  static void operator delete(void* p, size_t size);
+
   // `LogEntry` sent to `LogSink`s; contains metadata.
   absl::LogEntry entry;
 
@@ -158,6 +187,29 @@ struct LogMessage::LogMessageData final {
   void FinalizeEncodingAndFormat();
 };
 
+void* LogMessage::LogMessageData::operator new(size_t size) {
+#ifdef ABSL_HAVE_THREAD_LOCAL
+  if (size == sizeof(LogMessageData)) {
+    LogMessageDataCache& cache = GetLogMessageDataCache();
+    if (cache.size > 0) return cache.blocks[--cache.size];
+  }
+#endif
+  return ::operator new(size);
+}
+
+void LogMessage::LogMessageData::operator delete(void* p, size_t size) {
+#ifdef ABSL_HAVE_THREAD_LOCAL
+  if (size == sizeof(LogMessageData)) {
+    LogMessageDataCache& cache = GetLogMessageDataCache();
+    if (cache.size < kLogMessageDataCacheBlocks) {
+      cache.blocks[cache.size++] = p;
+      return;
+    }
+  }
+#endif
+  ::operator delete(p);
+}
+
 LogMessage::LogMessageData::LogMessageData(const char* file, int line,
                                            absl::LogSeverity severity,
                                            absl::Time timestamp)
@@ -392,6 +444,19 @@ template LogMessage& LogMessage::operator<<(const bool& v);
 void LogMessage::Flush() {
   if (data_->entry.log_severity() < absl::MinLogLevel()) return;
 
+  // If no registered sink wants entries at this severity, the formatted text
+  // would never be consumed, so skip formatting and dispatch entirely.  This
+  // cannot apply to fatal entries (the process still has to die with the
+  // message), to entries with sinks attached via `ToSinkAlso`/`ToSinkOnly`
+  // (those sinks receive everything), or while logging reentrantly from a
+  // sink's `Send` (the stderr fallback used there does not filter).
+  if (data_->entry.log_severity() < absl::LogSeverity::kFatal &&
+      data_->extra_sinks.empty() &&
+      !log_internal::ThreadIsLoggingToLogSink() &&
+      data_->entry.log_severity() < log_internal::MinLogSinkSeverity()) {
+    return;
+  }
+
   if (data_->is_perror) {
     InternalStream() << ": " << absl::base_internal::StrError(errno_saver_())
                      << " [" << errno_saver_() << "]";
@@ -70,12 +70,17 @@ class LogMessage {
   LogMessage& operator=(const LogMessage&) = delete;
   ~LogMessage() ABSL_ATTRIBUTE_COLD;
 
+  // All the methods and operators below run only when the message is actually
+  // emitted, so they are marked cold to keep every call at the log site in the
+  // caller's cold partition; only the severity/condition branch stays on the
+  // hot path.
+
   // Overrides the location inferred from the callsite.  The string pointed to
   // by `file` must be valid until the end of the statement.
-  LogMessage& AtLocation(absl::string_view file, int line);
+  LogMessage& AtLocation(absl::string_view file, int line) ABSL_ATTRIBUTE_COLD;
   // Omits the prefix from this line.  The prefix includes metadata about the
   // logged data such as source code location and timestamp.
-  LogMessage& NoPrefix();
+  LogMessage& NoPrefix() ABSL_ATTRIBUTE_COLD;
   // Sets the verbosity field of the logged message as if it was logged by
   // `VLOG(verbose_level)`.  Unlike `VLOG`, this method does not affect
   // evaluation of the statement when the specified `verbose_level` has been
@@ -83,22 +88,22 @@ class LogMessage {
   // make use of the `absl::LogSink::verbosity()` value.  The value
   // `absl::LogEntry::kNoVerbosityLevel` can be specified to mark the message
   // not verbose.
-  LogMessage& WithVerbosity(int verbose_level);
+  LogMessage& WithVerbosity(int verbose_level) ABSL_ATTRIBUTE_COLD;
   // Uses the specified timestamp instead of one collected in the constructor.
-  LogMessage& WithTimestamp(absl::Time timestamp);
+  LogMessage& WithTimestamp(absl::Time timestamp) ABSL_ATTRIBUTE_COLD;
   // Uses the specified thread ID instead of one collected in the constructor.
-  LogMessage& WithThreadID(absl::LogEntry::tid_t tid);
+  LogMessage& WithThreadID(absl::LogEntry::tid_t tid) ABSL_ATTRIBUTE_COLD;
   // Copies all metadata (but no data) from the specified `absl::LogEntry`.
-  LogMessage& WithMetadataFrom(const absl::LogEntry& entry);
+  LogMessage& WithMetadataFrom(const absl::LogEntry& entry) ABSL_ATTRIBUTE_COLD;
   // Appends to the logged message a colon, a space, a textual description of
   // the current value of `errno` (as by strerror(3)), and the numerical value
   // of `errno`.
-  LogMessage& WithPerror();
+  LogMessage& WithPerror() ABSL_ATTRIBUTE_COLD;
   // Sends this message to `*sink` in addition to whatever other sinks it would
   // otherwise have been sent to.  `sink` must not be null.
-  LogMessage& ToSinkAlso(absl::LogSink* sink);
+  LogMessage& ToSinkAlso(absl::LogSink* sink) ABSL_ATTRIBUTE_COLD;
   // Sends this message to `*sink` and no others.  `sink` must not be null.
-  LogMessage& ToSinkOnly(absl::LogSink* sink);
+  LogMessage& ToSinkOnly(absl::LogSink* sink) ABSL_ATTRIBUTE_COLD;
 
   // Don't call this method from outside this library.
   LogMessage& InternalStream() { return *this; }
@@ -142,12 +147,14 @@ class LogMessage {
   // clang-format on
 
   // These overloads are more efficient since no `ostream` is involved.
-  LogMessage& operator<<(const std::string& v);
-  LogMessage& operator<<(absl::string_view v);
+  LogMessage& operator<<(const std::string& v) ABSL_ATTRIBUTE_COLD;
+  LogMessage& operator<<(absl::string_view v) ABSL_ATTRIBUTE_COLD;
 
   // Handle stream manipulators e.g. std::endl.
-  LogMessage& operator<<(std::ostream& (*m)(std::ostream& os));
-  LogMessage& operator<<(std::ios_base& (*m)(std::ios_base& os));
+  LogMessage& operator<<(std::ostream& (*m)(std::ostream& os))
+      ABSL_ATTRIBUTE_COLD;
+  LogMessage& operator<<(std::ios_base& (*m)(std::ios_base& os))
+      ABSL_ATTRIBUTE_COLD;
 
   // Literal strings.  This allows us to record C string literals as literals in
   // the logging.proto.Value.
@@ -166,20 +173,23 @@ class LogMessage {
 
   // This prevents non-const `char[]` arrays from looking like literals.
   template <int SIZE>
-  LogMessage& operator<<(char (&buf)[SIZE]) ABSL_ATTRIBUTE_NOINLINE;
+  LogMessage& operator<<(char (&buf)[SIZE]) ABSL_ATTRIBUTE_COLD
+      ABSL_ATTRIBUTE_NOINLINE;
 
   // Types that support `AbslStringify()` are serialized that way.
   template <typename T,
             typename std::enable_if<absl::HasAbslStringify<T>::value,
                                     int>::type = 0>
-  LogMessage& operator<<(const T& v) ABSL_ATTRIBUTE_NOINLINE;
+  LogMessage& operator<<(const T& v) ABSL_ATTRIBUTE_COLD
+      ABSL_ATTRIBUTE_NOINLINE;
 
   // Types that don't support `AbslStringify()` but do support streaming into a
   // `std::ostream&` are serialized that way.
   template <typename T,
             typename std::enable_if<!absl::HasAbslStringify<T>::value,
                                     int>::type = 0>
-  LogMessage& operator<<(const T& v) ABSL_ATTRIBUTE_NOINLINE;
+  LogMessage& operator<<(const T& v) ABSL_ATTRIBUTE_COLD
+      ABSL_ATTRIBUTE_NOINLINE;
 
   // Note: We explicitly do not support `operator<<` for non-const references
   // because it breaks logging of non-integer bitfield types (i.e., enums).
@@ -232,9 +242,11 @@ class LogMessage {
     kNotLiteral,
   };
   template <StringType str_type>
-  void CopyToEncodedBuffer(absl::string_view str) ABSL_ATTRIBUTE_NOINLINE;
+  void CopyToEncodedBuffer(absl::string_view str) ABSL_ATTRIBUTE_COLD
+      ABSL_ATTRIBUTE_NOINLINE;
   template <StringType str_type>
-  void CopyToEncodedBuffer(char ch, size_t num) ABSL_ATTRIBUTE_NOINLINE;
+  void CopyToEncodedBuffer(char ch, size_t num) ABSL_ATTRIBUTE_COLD
+      ABSL_ATTRIBUTE_NOINLINE;
 
   // Returns `true` if the message is fatal or enabled debug-fatal.
   bool IsFatal() const;
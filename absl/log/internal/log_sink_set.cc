@@ -28,6 +28,7 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
 #include <vector>
 
 #include "absl/base/attributes.h"
@@ -52,6 +53,20 @@ ABSL_NAMESPACE_BEGIN
 namespace log_internal {
 namespace {
 
+// Aggregates of the registered sinks' minimum severities, kept up to date by
+// `GlobalLogSinkSet` and read without its lock so that `MinLogSinkSeverity()`
+// stays cheap enough for the hot path in `LogMessage::Flush`.
+//
+// `kMinRegisteredSeverity` holds the minimum severity across registered sinks
+// that filter statically, encoded as an int because
+// `absl::LogSeverityAtLeast::kInfinity` (used when no such sink is
+// registered) has no `absl::LogSeverity` equivalent.
+// `kHaveStderrThresholdSinks` is true when any built-in sink that filters
+// dynamically on `absl::StderrThreshold()` is registered.
+ABSL_CONST_INIT std::atomic<int> g_min_registered_severity{
+    static_cast<int>(absl::LogSeverityAtLeast::kInfinity)};
+ABSL_CONST_INIT std::atomic<bool> g_have_stderr_threshold_sinks{false};
+
 // Returns a mutable reference to a thread-local variable that should be true if
 // a globally-registered `LogSink`'s `Send()` is currently being invoked on this
 // thread.
@@ -170,15 +185,18 @@ class GlobalLogSinkSet final {
     // myriad2 and Fuchsia do not log to stderr by default.
 #else
     static absl::NoDestructor<StderrLogSink> stderr_log_sink;
-    AddLogSink(stderr_log_sink.get());
+    AddLogSinkImpl(stderr_log_sink.get(), absl::LogSeverity::kInfo,
+                   /*uses_stderr_threshold=*/true);
 #endif
 #ifdef __ANDROID__
     static absl::NoDestructor<AndroidLogSink> android_log_sink;
-    AddLogSink(android_log_sink.get());
+    AddLogSinkImpl(android_log_sink.get(), absl::LogSeverity::kInfo,
+                   /*uses_stderr_threshold=*/false);
 #endif
 #if defined(_WIN32)
     static absl::NoDestructor<WindowsDebuggerLogSink> debugger_log_sink;
-    AddLogSink(debugger_log_sink.get());
+    AddLogSinkImpl(debugger_log_sink.get(), absl::LogSeverity::kInfo,
+                   /*uses_stderr_threshold=*/true);
 #endif  // !defined(_WIN32)
   }
 
@@ -198,29 +216,28 @@ class GlobalLogSinkSet final {
         // scope even in case of exceptions.
         auto status_cleanup =
             absl::MakeCleanup([] { ThreadIsLoggingStatus() = false; });
-        SendToSinks(entry, absl::MakeSpan(sinks_));
+        for (const SinkEntry& registered : sinks_) {
+          if (entry.log_severity() < registered.min_severity) continue;
+          registered.sink->Send(entry);
+        }
       }
     }
   }
 
-  void AddLogSink(absl::LogSink* sink) ABSL_LOCKS_EXCLUDED(guard_) {
-    {
-      absl::WriterMutexLock global_sinks_lock(&guard_);
-      auto pos = std::find(sinks_.begin(), sinks_.end(), sink);
-      if (pos == sinks_.end()) {
-        sinks_.push_back(sink);
-        return;
-      }
-    }
-    ABSL_INTERNAL_LOG(FATAL, "Duplicate log sinks are not supported");
+  void AddLogSink(absl::LogSink* sink, absl::LogSeverity min_severity)
+      ABSL_LOCKS_EXCLUDED(guard_) {
+    AddLogSinkImpl(sink, min_severity, /*uses_stderr_threshold=*/false);
   }
 
   void RemoveLogSink(absl::LogSink* sink) ABSL_LOCKS_EXCLUDED(guard_) {
     {
       absl::WriterMutexLock global_sinks_lock(&guard_);
-      auto pos = std::find(sinks_.begin(), sinks_.end(), sink);
+      auto pos = std::find_if(
+          sinks_.begin(), sinks_.end(),
+          [sink](const SinkEntry& entry) { return entry.sink == sink; });
       if (pos != sinks_.end()) {
         sinks_.erase(pos);
+        UpdateAggregateSeverities();
         return;
       }
     }
@@ -247,9 +264,54 @@ class GlobalLogSinkSet final {
   }
 
  private:
+  struct SinkEntry {
+    absl::LogSink* sink;
+    // The sink is not sent entries below this severity.
+    absl::LogSeverity min_severity;
+    // True for built-in sinks whose `Send` filters dynamically on
+    // `absl::StderrThreshold()` rather than on `min_severity`.
+    bool uses_stderr_threshold;
+  };
+
+  void AddLogSinkImpl(absl::LogSink* sink, absl::LogSeverity min_severity,
+                      bool uses_stderr_threshold) ABSL_LOCKS_EXCLUDED(guard_) {
+    {
+      absl::WriterMutexLock global_sinks_lock(&guard_);
+      auto pos = std::find_if(
+          sinks_.begin(), sinks_.end(),
+          [sink](const SinkEntry& entry) { return entry.sink == sink; });
+      if (pos == sinks_.end()) {
+        sinks_.push_back({sink, min_severity, uses_stderr_threshold});
+        UpdateAggregateSeverities();
+        return;
+      }
+    }
+    ABSL_INTERNAL_LOG(FATAL, "Duplicate log sinks are not supported");
+  }
+
+  void UpdateAggregateSeverities() ABSL_EXCLUSIVE_LOCKS_REQUIRED(guard_) {
+    auto min_severity = absl::LogSeverityAtLeast::kInfinity;
+    bool have_stderr_threshold_sinks = false;
+    for (const SinkEntry& entry : sinks_) {
+      if (entry.uses_stderr_threshold) {
+        have_stderr_threshold_sinks = true;
+      } else {
+        const auto candidate =
+            static_cast<absl::LogSeverityAtLeast>(entry.min_severity);
+        if (static_cast<int>(candidate) < static_cast<int>(min_severity)) {
+          min_severity = candidate;
+        }
+      }
+    }
+    g_min_registered_severity.store(static_cast<int>(min_severity),
+                                    std::memory_order_relaxed);
+    g_have_stderr_threshold_sinks.store(have_stderr_threshold_sinks,
+                                        std::memory_order_relaxed);
+  }
+
   void FlushLogSinksLocked() ABSL_SHARED_LOCKS_REQUIRED(guard_) {
-    for (absl::LogSink* sink : sinks_) {
-      sink->Flush();
+    for (const SinkEntry& entry : sinks_) {
+      entry.sink->Flush();
     }
   }
 
@@ -261,7 +323,7 @@ class GlobalLogSinkSet final {
     }
   }
 
-  using LogSinksSet = std::vector<absl::LogSink*>;
+  using LogSinksSet = std::vector<SinkEntry>;
   absl::Mutex guard_;
   LogSinksSet sinks_ ABSL_GUARDED_BY(guard_);
 };
@@ -282,7 +344,11 @@ void LogToSinks(const absl::LogEntry& entry,
 }
 
 void AddLogSink(absl::LogSink* sink) {
-  log_internal::GlobalSinks().AddLogSink(sink);
+  log_internal::GlobalSinks().AddLogSink(sink, absl::LogSeverity::kInfo);
+}
+
+void AddLogSink(absl::LogSink* sink, absl::LogSeverity min_severity) {
+  log_internal::GlobalSinks().AddLogSink(sink, min_severity);
 }
 
 void RemoveLogSink(absl::LogSink* sink) {
@@ -291,6 +357,26 @@ void RemoveLogSink(absl::LogSink* sink) {
 
 void FlushLogSinks() { log_internal::GlobalSinks().FlushLogSinks(); }
 
+absl::LogSeverityAtLeast MinLogSinkSeverity() {
+  // Force the built-in sinks to be registered so that the aggregates reflect
+  // them even if nothing has logged yet.
+  log_internal::GlobalSinks();
+  auto min_severity = static_cast<absl::LogSeverityAtLeast>(
+      g_min_registered_severity.load(std::memory_order_relaxed));
+  if (g_have_stderr_threshold_sinks.load(std::memory_order_relaxed)) {
+    // These sinks filter on `absl::StderrThreshold()`, and log everything
+    // until `absl::InitializeLog()` has run.
+    const absl::LogSeverityAtLeast stderr_min_severity =
+        absl::log_internal::IsInitialized() ? absl::StderrThreshold()
+                                            : absl::LogSeverityAtLeast::kInfo;
+    if (static_cast<int>(stderr_min_severity) <
+        static_cast<int>(min_severity)) {
+      min_severity = stderr_min_severity;
+    }
+  }
+  return min_severity;
+}
+
 }  // namespace log_internal
 ABSL_NAMESPACE_END
 }  // namespace absl
@@ -20,6 +20,7 @@
 #define ABSL_LOG_INTERNAL_LOG_SINK_SET_H_
 
 #include "absl/base/config.h"
+#include "absl/base/log_severity.h"
 #include "absl/log/log_entry.h"
 #include "absl/log/log_sink.h"
 #include "absl/types/span.h"
@@ -44,9 +45,16 @@ void LogToSinks(const absl::LogEntry& entry,
 
 // Implementation for operations with log sink set.
 void AddLogSink(absl::LogSink* sink);
+void AddLogSink(absl::LogSink* sink, absl::LogSeverity min_severity);
 void RemoveLogSink(absl::LogSink* sink);
 void FlushLogSinks();
 
+// Returns the minimum severity at which any globally-registered `LogSink`
+// wants entries, or `absl::LogSeverityAtLeast::kInfinity` if no sink wants
+// any.  Entries below this severity need not be formatted or dispatched
+// unless extra sinks are attached with `ToSinkAlso`/`ToSinkOnly`.
+absl::LogSeverityAtLeast MinLogSinkSeverity();
+
 }  // namespace log_internal
 ABSL_NAMESPACE_END
 }  // namespace absl
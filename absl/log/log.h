@@ -301,6 +301,20 @@
 #define LOG_EVERY_N_SEC(severity, n_seconds) \
   ABSL_LOG_INTERNAL_LOG_EVERY_N_SEC_IMPL(_##severity, n_seconds)
 
+// LOG_AT_MOST_RATE
+//
+// An instance of `LOG_AT_MOST_RATE` uses a hidden state variable to log the
+// specified message at most `n_per_sec` times per second.  Unlike
+// `LOG_EVERY_N_SEC`, messages may arrive in bursts up to `n_per_sec` before
+// suppression begins.  A hidden counter of executions (whether a message is
+// logged or not) is also maintained and can be logged by streaming the symbol
+// `COUNTER`.  `LOG_AT_MOST_RATE` is thread-safe.
+// Example:
+//
+//   LOG_AT_MOST_RATE(INFO, 10) << "Got " << COUNTER << " cookies so far";
+#define LOG_AT_MOST_RATE(severity, n_per_sec) \
+  ABSL_LOG_INTERNAL_LOG_AT_MOST_RATE_IMPL(_##severity, n_per_sec)
+
 #define PLOG_EVERY_N(severity, n) \
   ABSL_LOG_INTERNAL_PLOG_EVERY_N_IMPL(_##severity, n)
 #define PLOG_FIRST_N(severity, n) \
@@ -15,11 +15,74 @@
 
 #include "absl/log/log_entry.h"
 
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
 #include "absl/base/config.h"
+#include "absl/log/internal/proto.h"
+#include "absl/time/time.h"
+#include "absl/types/span.h"
 
 namespace absl {
 ABSL_NAMESPACE_BEGIN
 
+namespace {
+// message `logging.proto.Event`
+//
+// Metadata tags written here; tag 7 (`Value`) is written by `LogMessage` as
+// operands are streamed and its encoding is appended verbatim from
+// `encoding_`.
+enum EventTag : uint8_t {
+  kTimeNsecs = 1,
+  kFileBasename = 2,
+  kFileLine = 3,
+  kSeverity = 4,
+  kThreadId = 5,
+  kVerbosity = 6,
+};
+
+// Appends `value` to `dest` as a varint with no tag, for use as a length
+// prefix.
+void AppendRawVarint(uint64_t value, std::string* dest) {
+  while (value >= 0x80) {
+    dest->push_back(static_cast<char>((value & 0x7f) | 0x80));
+    value >>= 7;
+  }
+  dest->push_back(static_cast<char>(value));
+}
+}  // namespace
+
+void LogEntry::AppendEncodedEvent(std::string* dest) const {
+  // Metadata fields are encoded into a stack buffer first so that the length
+  // prefix can be computed before anything is appended to `dest`.  The
+  // buffer comfortably fits all the fixed-size fields; the basename is
+  // truncated in the unlikely event that it does not fit alongside them.
+  char buf[512];
+  absl::Span<char> remaining(buf, sizeof(buf));
+  log_internal::EncodeVarint(EventTag::kTimeNsecs, absl::ToUnixNanos(timestamp_),
+                             &remaining);
+  log_internal::EncodeStringTruncate(EventTag::kFileBasename, base_filename_,
+                                     &remaining);
+  log_internal::EncodeVarint(EventTag::kFileLine,
+                             static_cast<uint64_t>(line_), &remaining);
+  log_internal::EncodeVarint(EventTag::kSeverity,
+                             static_cast<uint64_t>(severity_), &remaining);
+  log_internal::EncodeVarint(EventTag::kThreadId,
+                             static_cast<uint64_t>(tid_), &remaining);
+  if (verbose_level_ != kNoVerbosityLevel) {
+    log_internal::EncodeVarint(EventTag::kVerbosity,
+                               static_cast<uint64_t>(verbose_level_),
+                               &remaining);
+  }
+  // `remaining` may have zero size without pointing past the end of `buf`, so
+  // the difference between `data()` pointers gives the encoded size.
+  const size_t metadata_size = static_cast<size_t>(remaining.data() - buf);
+  AppendRawVarint(metadata_size + encoding_.size(), dest);
+  dest->append(buf, metadata_size);
+  dest->append(encoding_.data(), encoding_.size());
+}
+
 #ifdef ABSL_INTERNAL_NEED_REDUNDANT_CONSTEXPR_DECL
 constexpr int LogEntry::kNoVerbosityLevel;
 constexpr int LogEntry::kNoVerboseLevel;
@@ -38,6 +38,8 @@
 namespace absl {
 ABSL_NAMESPACE_BEGIN
 
+class AsyncLogSink;
+
 namespace log_internal {
 // Test only friend.
 class LogEntryTestPeer;
@@ -179,6 +181,22 @@ class LogEntry final {
     return encoding_;
   }
 
+  // LogEntry::AppendEncodedEvent()
+  //
+  // Appends a compact binary representation of this entry to `dest`: a varint
+  // length prefix followed by a message in protocol buffer wire format
+  // holding the timestamp (as nanoseconds since the Unix epoch), the source
+  // file basename and line, the severity, the thread ID, the verbosity (for
+  // verbose entries only), and the raw operands exactly as returned by
+  // `encoded_message()`.  Binary-aware `LogSink`s can forward this
+  // representation instead of the formatted text and skip textual formatting
+  // entirely.  String operands streamed as literals (see `log/structured.h`)
+  // are marked as such in the operand encoding, so consumers can intern them.
+  //
+  // The message definition is not yet published; tag assignments are subject
+  // to change.
+  void AppendEncodedEvent(std::string* dest) const;
+
   // LogEntry::stacktrace()
   //
   // Optional stacktrace, e.g. for `FATAL` logs and failed `CHECK`s.
@@ -213,6 +231,8 @@ class LogEntry final {
 
   friend class log_internal::LogEntryTestPeer;
   friend class log_internal::LogMessage;
+  // Rebuilds entries from buffered copies on its flusher thread.
+  friend class AsyncLogSink;
 };
 
 ABSL_NAMESPACE_END
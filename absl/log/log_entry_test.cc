@@ -32,6 +32,7 @@
 #include "absl/base/log_severity.h"
 #include "absl/log/internal/append_truncated.h"
 #include "absl/log/internal/log_format.h"
+#include "absl/log/internal/proto.h"
 #include "absl/log/internal/test_helpers.h"
 #include "absl/strings/numbers.h"
 #include "absl/strings/str_split.h"
@@ -66,6 +67,7 @@ class LogEntryTestPeer {
     entry_.line_ = line;
     entry_.prefix_ = prefix;
     entry_.severity_ = severity;
+    entry_.verbose_level_ = absl::LogEntry::kNoVerbosityLevel;
     std::string time_err;
     EXPECT_THAT(
         absl::ParseTime("%Y-%m-%d%ET%H:%M:%E*S", timestamp,
@@ -465,4 +467,55 @@ TEST(LogEntryTest, Raw) {
   EXPECT_THAT(entry.entry().text_message(), Eq("hello world"));
 }
 
+TEST(LogEntryTest, AppendEncodedEvent) {
+  LogEntryTestPeer entry("foo.cc", 1234, kUsePrefix,
+                         absl::LogSeverity::kWarning,
+                         "2020-01-02T03:04:05.6789", 451,
+                         absl::log_internal::PrefixFormat::kNotRaw,
+                         "hello world");
+  std::string encoded;
+  entry.entry().AppendEncodedEvent(&encoded);
+
+  // Strip the varint length prefix and check it against the payload size.
+  absl::Span<const char> data(encoded.data(), encoded.size());
+  uint64_t length = 0;
+  int shift = 0;
+  while (!data.empty()) {
+    const auto byte = static_cast<unsigned char>(data.front());
+    data.remove_prefix(1);
+    length |= static_cast<uint64_t>(byte & 0x7f) << shift;
+    shift += 7;
+    if ((byte & 0x80) == 0) break;
+  }
+  EXPECT_THAT(length, Eq(data.size()));
+
+  uint64_t seen_tags = 0;
+  absl::log_internal::ProtoField field;
+  while (field.DecodeFrom(&data)) {
+    seen_tags |= uint64_t{1} << field.tag();
+    switch (field.tag()) {
+      case 1:  // timestamp, nanoseconds since the Unix epoch
+        EXPECT_THAT(field.int64_value(),
+                    Eq(absl::ToUnixNanos(entry.entry().timestamp())));
+        break;
+      case 2:  // source file basename
+        EXPECT_THAT(field.string_value(), Eq("foo.cc"));
+        break;
+      case 3:  // source line
+        EXPECT_THAT(field.uint64_value(), Eq(uint64_t{1234}));
+        break;
+      case 4:  // severity
+        EXPECT_THAT(field.int32_value(),
+                    Eq(static_cast<int>(absl::LogSeverity::kWarning)));
+        break;
+      case 5:  // thread ID
+        EXPECT_THAT(field.uint64_value(), Eq(uint64_t{451}));
+        break;
+    }
+  }
+  // All the metadata fields, and no verbosity field since this is not a
+  // verbose entry.
+  EXPECT_THAT(seen_tags, Eq(uint64_t{0b111110}));
+}
+
 }  // namespace
@@ -23,6 +23,7 @@
 
 #include "absl/base/config.h"
 #include "absl/log/log_entry.h"
+#include "absl/types/span.h"
 
 namespace absl {
 ABSL_NAMESPACE_BEGIN
@@ -48,6 +49,20 @@ class LogSink {
   // loop if you try.
   virtual void Send(const absl::LogEntry& entry) = 0;
 
+  // LogSink::SendBatch()
+  //
+  // `SendBatch` delivers several entries at once, so sinks with per-call
+  // overhead (locking, syscalls, message framing) can amortize it across a
+  // batch.  The default implementation calls `Send` on each entry in order.
+  //
+  // The logging library calls `Send` once per `LOG` statement; `SendBatch` is
+  // called instead by components that accumulate entries before delivery,
+  // such as `absl::AsyncLogSink`.  `SendBatch` must be thread-safe and is
+  // subject to the same restrictions as `Send`.
+  virtual void SendBatch(absl::Span<const absl::LogEntry> entries) {
+    for (const absl::LogEntry& entry : entries) Send(entry);
+  }
+
   // LogSink::Flush()
   //
   // Sinks that buffer messages should override this method to flush the buffer
@@ -22,6 +22,7 @@
 #define ABSL_LOG_LOG_SINK_REGISTRY_H_
 
 #include "absl/base/config.h"
+#include "absl/base/log_severity.h"
 #include "absl/log/internal/log_sink_set.h"
 #include "absl/log/log_sink.h"
 
@@ -48,6 +49,22 @@ inline void RemoveLogSink(absl::LogSink* sink) {
   log_internal::RemoveLogSink(sink);
 }
 
+// AddLogSink() with a minimum severity
+//
+// Registers `sink` to receive only entries whose severity is at least
+// `min_severity`; entries below it are not sent to this sink at all.
+//
+// Declaring a minimum severity also enables a process-wide fast path: when
+// every registered sink's minimum (including the built-in stderr sink's,
+// which follows `absl::StderrThreshold()`) is above a message's severity,
+// that message is neither formatted nor dispatched, unless sinks are
+// attached to it directly with `ToSinkAlso` or `ToSinkOnly`.  Sinks that
+// only want errors should therefore prefer this overload over filtering
+// inside `Send`.
+inline void AddLogSink(absl::LogSink* sink, absl::LogSeverity min_severity) {
+  log_internal::AddLogSink(sink, min_severity);
+}
+
 // FlushLogSinks()
 //
 // Calls `absl::LogSink::Flush` on all registered sinks.
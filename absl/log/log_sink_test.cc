@@ -94,6 +94,25 @@ TEST(LogSinkRegistryTest, MultipleLogSinks) {
   LOG(INFO) << "Fourth";
 }
 
+TEST(LogSinkRegistryTest, AddLogSinkWithMinimumSeverity) {
+  absl::ScopedMockLog test_sink(absl::MockLogDefault::kDisallowUnexpected);
+
+  InSequence s;
+  EXPECT_CALL(test_sink, Log(absl::LogSeverity::kInfo, _, _)).Times(0);
+  EXPECT_CALL(test_sink, Log(absl::LogSeverity::kWarning, _, _)).Times(0);
+  EXPECT_CALL(test_sink,
+              Log(absl::LogSeverity::kError, __FILE__, "This is an error"));
+
+  absl::AddLogSink(&test_sink.UseAsLocalSink(), absl::LogSeverity::kError);
+
+  LOG(INFO) << "Suppressed for this sink";
+  LOG(WARNING) << "Also suppressed";
+  LOG(ERROR) << "This is an error";
+
+  absl::RemoveLogSink(&test_sink.UseAsLocalSink());
+  LOG(ERROR) << "Not delivered after removal";
+}
+
 TEST(LogSinkRegistrationDeathTest, DuplicateSinkRegistration) {
   ASSERT_DEATH_IF_SUPPORTED(
       {
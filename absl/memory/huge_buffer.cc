@@ -0,0 +1,214 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/memory/huge_buffer.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+
+#include "absl/base/config.h"
+#include "absl/base/internal/throw_delegate.h"
+
+#ifdef ABSL_HAVE_MMAP
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "absl/base/internal/direct_mmap.h"
+
+#ifndef MAP_ANONYMOUS
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+#endif  // ABSL_HAVE_MMAP
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+namespace {
+
+size_t SystemPageSize() {
+#ifdef ABSL_HAVE_MMAP
+  static const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  return page_size;
+#else
+  return 4096;
+#endif
+}
+
+constexpr size_t RoundUp(size_t size, size_t granularity) {
+  return (size + granularity - 1) & ~(granularity - 1);
+}
+
+// Allocation of last resort, for platforms without mmap or when every
+// mapping attempt failed. Page-aligned so `page_size()` stays truthful.
+void* FallbackAllocate(size_t rounded, size_t page) {
+#if defined(__cpp_aligned_new)
+  void* p = ::operator new(rounded, std::align_val_t{page}, std::nothrow);
+#else
+  static_cast<void>(page);
+  void* p = ::operator new(rounded, std::nothrow);
+#endif
+  if (p == nullptr) base_internal::ThrowStdBadAlloc();
+  // Anonymous mappings are zeroed by the kernel; match that here.
+  std::memset(p, 0, rounded);
+  return p;
+}
+
+void FallbackDeallocate(void* p, size_t page) {
+#if defined(__cpp_aligned_new)
+  ::operator delete(p, std::align_val_t{page});
+#else
+  static_cast<void>(page);
+  ::operator delete(p);
+#endif
+}
+
+}  // namespace
+
+HugeBuffer::HugeBuffer(size_t size) {
+  if (size == 0) return;
+  size_ = size;
+
+#ifdef ABSL_HAVE_MMAP
+  const int prot = PROT_READ | PROT_WRITE;
+
+#if defined(__linux__) && defined(MAP_HUGETLB)
+  {
+    // Pre-reserved hugepages give a guaranteed page size, but fail unless
+    // the administrator has set vm.nr_hugepages.
+    const size_t rounded = RoundUp(size, kHugepageSize);
+    void* p = base_internal::DirectMmap(
+        nullptr, rounded, prot, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1,
+        0);
+    if (p != MAP_FAILED) {
+      data_ = p;
+      mapped_size_ = rounded;
+      backing_ = Backing::kHugetlb;
+      return;
+    }
+  }
+#endif  // __linux__ && MAP_HUGETLB
+
+#if defined(__linux__)
+  {
+    // Over-map by one hugepage and trim to a 2 MiB-aligned region, so that
+    // the kernel can back every 2 MiB chunk with a transparent hugepage.
+    const size_t rounded = RoundUp(size, kHugepageSize);
+    const size_t overmapped = rounded + kHugepageSize;
+    void* p = base_internal::DirectMmap(nullptr, overmapped, prot,
+                                        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (p != MAP_FAILED) {
+      const uintptr_t base = reinterpret_cast<uintptr_t>(p);
+      const uintptr_t aligned = RoundUp(base, kHugepageSize);
+      if (aligned != base) {
+        base_internal::DirectMunmap(p, aligned - base);
+      }
+      const size_t tail = overmapped - (aligned - base) - rounded;
+      if (tail != 0) {
+        base_internal::DirectMunmap(
+            reinterpret_cast<void*>(aligned + rounded), tail);
+      }
+      data_ = reinterpret_cast<void*>(aligned);
+      mapped_size_ = rounded;
+#if defined(MADV_HUGEPAGE)
+      // Failure means the kernel has transparent hugepages disabled; the
+      // mapping is still fine on ordinary pages.
+      backing_ = madvise(data_, rounded, MADV_HUGEPAGE) == 0
+                     ? Backing::kTransparentHugepage
+                     : Backing::kNormalPages;
+#else
+      backing_ = Backing::kNormalPages;
+#endif
+      return;
+    }
+  }
+#endif  // __linux__
+
+  {
+    // Non-Linux platforms, or Linux with the address space too fragmented
+    // for the over-mapping above: an ordinary anonymous mapping.
+    const size_t rounded = RoundUp(size, SystemPageSize());
+    void* p = base_internal::DirectMmap(nullptr, rounded, prot,
+                                        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (p != MAP_FAILED) {
+      data_ = p;
+      mapped_size_ = rounded;
+      backing_ = Backing::kNormalPages;
+      return;
+    }
+  }
+#endif  // ABSL_HAVE_MMAP
+
+  data_ = FallbackAllocate(RoundUp(size, SystemPageSize()), SystemPageSize());
+  mapped_size_ = 0;  // marks operator-new backing for Release()
+  backing_ = Backing::kNormalPages;
+}
+
+HugeBuffer::HugeBuffer(HugeBuffer&& other) noexcept
+    : data_(other.data_),
+      size_(other.size_),
+      mapped_size_(other.mapped_size_),
+      backing_(other.backing_) {
+  other.data_ = nullptr;
+  other.size_ = 0;
+  other.mapped_size_ = 0;
+  other.backing_ = Backing::kNone;
+}
+
+HugeBuffer& HugeBuffer::operator=(HugeBuffer&& other) noexcept {
+  if (this != &other) {
+    Release();
+    data_ = other.data_;
+    size_ = other.size_;
+    mapped_size_ = other.mapped_size_;
+    backing_ = other.backing_;
+    other.data_ = nullptr;
+    other.size_ = 0;
+    other.mapped_size_ = 0;
+    other.backing_ = Backing::kNone;
+  }
+  return *this;
+}
+
+HugeBuffer::~HugeBuffer() { Release(); }
+
+void HugeBuffer::Release() {
+  if (data_ == nullptr) return;
+#ifdef ABSL_HAVE_MMAP
+  if (mapped_size_ != 0) {
+    base_internal::DirectMunmap(data_, mapped_size_);
+    data_ = nullptr;
+    return;
+  }
+#endif
+  FallbackDeallocate(data_, SystemPageSize());
+  data_ = nullptr;
+}
+
+size_t HugeBuffer::page_size() const {
+  switch (backing_) {
+    case Backing::kNone:
+      return 0;
+    case Backing::kHugetlb:
+    case Backing::kTransparentHugepage:
+      return kHugepageSize;
+    case Backing::kNormalPages:
+      return SystemPageSize();
+  }
+  return 0;
+}
+
+ABSL_NAMESPACE_END
+}  // namespace absl
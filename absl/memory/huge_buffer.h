@@ -0,0 +1,122 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// -----------------------------------------------------------------------------
+// File: huge_buffer.h
+// -----------------------------------------------------------------------------
+//
+// This header defines `absl::HugeBuffer`, an RAII allocation of N bytes that
+// is backed by 2 MiB hugepages when the system provides them. Arenas, ring
+// buffers, and other large flat structures that are probed or streamed
+// through benefit from hugepages because each TLB entry then covers 512x the
+// address range; getting there portably requires an mmap/madvise/fallback
+// dance that is easy to get subtly wrong, which this type centralizes.
+//
+// The buffer tries progressively weaker backings and reports which one it
+// obtained:
+//
+//   1. `MAP_HUGETLB`: pre-reserved hugepages, guaranteed 2 MiB.
+//   2. A 2 MiB-aligned anonymous mapping advised with `MADV_HUGEPAGE`:
+//      transparent hugepages, applied by the kernel on a best-effort basis.
+//   3. An ordinary mapping (or `operator new` where mmap is unavailable).
+//
+// Example:
+//
+//   absl::HugeBuffer ring(64 << 20);
+//   if (ring.page_size() < absl::HugeBuffer::kHugepageSize) {
+//     LOG(INFO) << "hugepages unavailable; running on small pages";
+//   }
+//   Use(ring.data(), ring.size());
+//
+// `HugeBuffer` performs no heap allocation of its own beyond the mapping, so
+// it is usable from allocator-level code. It is movable but not copyable;
+// the mapping is released on destruction.
+
+#ifndef ABSL_MEMORY_HUGE_BUFFER_H_
+#define ABSL_MEMORY_HUGE_BUFFER_H_
+
+#include <cstddef>
+
+#include "absl/base/config.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+// -----------------------------------------------------------------------------
+// HugeBuffer
+// -----------------------------------------------------------------------------
+//
+// An owning, movable allocation of raw bytes, hugepage-backed when possible.
+// The memory is readable and writable, zero-initialized, and aligned to at
+// least `page_size()`.
+class HugeBuffer {
+ public:
+  // The hugepage size this type targets: the transparent hugepage size on
+  // x86-64 and the common configuration on aarch64.
+  static constexpr size_t kHugepageSize = size_t{2} << 20;
+
+  // How the buffer's memory is backed; see the file comment for the order in
+  // which these are attempted.
+  enum class Backing {
+    kNone,                 // empty (default-constructed or moved-from)
+    kHugetlb,              // MAP_HUGETLB hugepages, guaranteed
+    kTransparentHugepage,  // aligned and advised; kernel applies best-effort
+    kNormalPages,          // ordinary pages
+  };
+
+  // An empty buffer; `data()` is null.
+  HugeBuffer() = default;
+
+  // Allocates `size` bytes. Throws `std::bad_alloc` (or terminates when
+  // exceptions are disabled) if no backing, including the ordinary-page
+  // fallback, can provide the memory. `HugeBuffer(0)` is an empty buffer.
+  explicit HugeBuffer(size_t size);
+
+  HugeBuffer(HugeBuffer&& other) noexcept;
+  HugeBuffer& operator=(HugeBuffer&& other) noexcept;
+  HugeBuffer(const HugeBuffer&) = delete;
+  HugeBuffer& operator=(const HugeBuffer&) = delete;
+
+  ~HugeBuffer();
+
+  // The buffer's memory, or null if the buffer is empty.
+  void* data() const { return data_; }
+
+  // The usable size in bytes, as requested at construction.
+  size_t size() const { return size_; }
+
+  // Which backing the buffer obtained.
+  Backing backing() const { return backing_; }
+
+  // The page size backing the buffer: `kHugepageSize` for `kHugetlb` and
+  // `kTransparentHugepage` backings (for the latter it is the granularity
+  // the buffer is aligned and advised to; the kernel may still decline),
+  // the system page size for `kNormalPages`, and 0 for an empty buffer.
+  size_t page_size() const;
+
+ private:
+  void Release();
+
+  void* data_ = nullptr;
+  size_t size_ = 0;
+  // Bytes actually mapped (`size_` rounded up to the backing granularity);
+  // zero when the memory came from `operator new` instead of mmap.
+  size_t mapped_size_ = 0;
+  Backing backing_ = Backing::kNone;
+};
+
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_MEMORY_HUGE_BUFFER_H_
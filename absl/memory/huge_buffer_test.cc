@@ -0,0 +1,96 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/memory/huge_buffer.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+#include "gtest/gtest.h"
+
+namespace {
+
+TEST(HugeBufferTest, EmptyBuffer) {
+  absl::HugeBuffer empty;
+  EXPECT_EQ(empty.data(), nullptr);
+  EXPECT_EQ(empty.size(), 0);
+  EXPECT_EQ(empty.backing(), absl::HugeBuffer::Backing::kNone);
+  EXPECT_EQ(empty.page_size(), 0);
+
+  absl::HugeBuffer zero(0);
+  EXPECT_EQ(zero.data(), nullptr);
+  EXPECT_EQ(zero.size(), 0);
+}
+
+TEST(HugeBufferTest, MemoryIsUsableAndZeroed) {
+  const size_t kSize = 3 * absl::HugeBuffer::kHugepageSize + 123;
+  absl::HugeBuffer buffer(kSize);
+  ASSERT_NE(buffer.data(), nullptr);
+  EXPECT_EQ(buffer.size(), kSize);
+  EXPECT_NE(buffer.backing(), absl::HugeBuffer::Backing::kNone);
+  EXPECT_GT(buffer.page_size(), 0);
+
+  unsigned char* bytes = static_cast<unsigned char*>(buffer.data());
+  for (size_t i = 0; i < kSize; i += 4096) EXPECT_EQ(bytes[i], 0);
+  std::memset(bytes, 0xab, kSize);
+  EXPECT_EQ(bytes[kSize - 1], 0xab);
+}
+
+TEST(HugeBufferTest, AlignedToReportedPageSize) {
+  absl::HugeBuffer buffer(absl::HugeBuffer::kHugepageSize);
+  ASSERT_NE(buffer.data(), nullptr);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(buffer.data()) % buffer.page_size(),
+            0);
+#if defined(__linux__)
+  // On Linux the buffer is at least hugepage-aligned and -advised, even if
+  // the kernel later declines to use hugepages.
+  if (buffer.backing() != absl::HugeBuffer::Backing::kNormalPages) {
+    EXPECT_EQ(buffer.page_size(), absl::HugeBuffer::kHugepageSize);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(buffer.data()) %
+                  absl::HugeBuffer::kHugepageSize,
+              0);
+  }
+#endif
+}
+
+TEST(HugeBufferTest, SmallBuffer) {
+  // Sizes below a hugepage still work; backing may be anything.
+  absl::HugeBuffer buffer(100);
+  ASSERT_NE(buffer.data(), nullptr);
+  EXPECT_EQ(buffer.size(), 100);
+  std::memset(buffer.data(), 0x5a, buffer.size());
+}
+
+TEST(HugeBufferTest, MoveTransfersOwnership) {
+  absl::HugeBuffer a(1 << 20);
+  void* data = a.data();
+  const auto backing = a.backing();
+
+  absl::HugeBuffer b(std::move(a));
+  EXPECT_EQ(b.data(), data);
+  EXPECT_EQ(b.size(), 1 << 20);
+  EXPECT_EQ(b.backing(), backing);
+  EXPECT_EQ(a.data(), nullptr);  // NOLINT(bugprone-use-after-move)
+  EXPECT_EQ(a.backing(), absl::HugeBuffer::Backing::kNone);
+
+  absl::HugeBuffer c(4096);
+  c = std::move(b);
+  EXPECT_EQ(c.data(), data);
+  EXPECT_EQ(b.data(), nullptr);  // NOLINT(bugprone-use-after-move)
+  std::memset(c.data(), 0xcd, c.size());
+}
+
+}  // namespace
@@ -0,0 +1,229 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// -----------------------------------------------------------------------------
+// File: monotonic_arena.h
+// -----------------------------------------------------------------------------
+//
+// This header file defines `absl::MonotonicArena`, a region-based ("arena")
+// allocator, and `absl::ArenaAllocator<T>`, a standard-library allocator
+// adapter over it. The arena serves allocations by bumping a pointer within
+// larger chunks obtained from the heap, and releases all of its memory at
+// once when it is reset or destroyed; individual deallocations are no-ops.
+// This makes it well suited to request-scoped data structures that grow for
+// a while and are then discarded wholesale.
+//
+// Example:
+//
+//   absl::InlinedMonotonicArena<4096> arena;
+//   absl::flat_hash_map<int, std::string, absl::Hash<int>, std::equal_to<>,
+//                       absl::ArenaAllocator<std::pair<const int, std::string>>>
+//       index(absl::ArenaAllocator<std::pair<const int, std::string>>(&arena));
+//   ... populate and use `index`; all of its memory is freed with `arena` ...
+//
+// An arena is not thread-safe: concurrent allocations must be synchronized
+// by the caller, just as with any container that would use it.
+
+#ifndef ABSL_MEMORY_MONOTONIC_ARENA_H_
+#define ABSL_MEMORY_MONOTONIC_ARENA_H_
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+
+#include "absl/base/config.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+// -----------------------------------------------------------------------------
+// MonotonicArena
+// -----------------------------------------------------------------------------
+//
+// A `MonotonicArena` hands out memory from chunks allocated with
+// `::operator new`, growing the chunk size geometrically as the arena grows.
+// An optional caller-provided initial buffer (see `InlinedMonotonicArena`
+// for a convenient self-contained form) serves allocations before any heap
+// chunk is needed. `Reset()` discards every allocation and returns the arena
+// to its initial state, reusing the initial buffer if one was given.
+class MonotonicArena {
+ public:
+  MonotonicArena() = default;
+
+  // Constructs an arena that serves allocations from `initial_buffer` (of
+  // `initial_size` bytes) until it is exhausted. The buffer must outlive the
+  // arena and is not freed by it.
+  MonotonicArena(void* initial_buffer, size_t initial_size)
+      : pos_(static_cast<char*>(initial_buffer)),
+        end_(pos_ + initial_size),
+        initial_buffer_(initial_buffer),
+        initial_size_(initial_size) {}
+
+  MonotonicArena(const MonotonicArena&) = delete;
+  MonotonicArena& operator=(const MonotonicArena&) = delete;
+
+  ~MonotonicArena() { FreeChunks(); }
+
+  // MonotonicArena::Allocate()
+  //
+  // Returns a pointer to `bytes` bytes of uninitialized memory with the
+  // given alignment, which must be a power of two. The memory remains valid
+  // until the arena is reset or destroyed.
+  void* Allocate(size_t bytes, size_t alignment = alignof(max_align_t)) {
+    assert(alignment != 0 && (alignment & (alignment - 1)) == 0);
+    uintptr_t p = reinterpret_cast<uintptr_t>(pos_);
+    uintptr_t aligned = (p + alignment - 1) & ~(alignment - 1);
+    if (bytes > static_cast<size_t>(reinterpret_cast<uintptr_t>(end_) -
+                                    aligned) ||
+        aligned > reinterpret_cast<uintptr_t>(end_)) {
+      AddChunk(bytes + alignment - 1);
+      p = reinterpret_cast<uintptr_t>(pos_);
+      aligned = (p + alignment - 1) & ~(alignment - 1);
+    }
+    pos_ = reinterpret_cast<char*>(aligned + bytes);
+    return reinterpret_cast<void*>(aligned);
+  }
+
+  // MonotonicArena::Reset()
+  //
+  // Discards all allocations, frees every heap chunk, and returns the arena
+  // to its freshly constructed state. Objects constructed in arena memory
+  // must be destroyed (if needed) before calling this.
+  void Reset() {
+    FreeChunks();
+    chunks_ = nullptr;
+    pos_ = static_cast<char*>(initial_buffer_);
+    end_ = pos_ + initial_size_;
+    next_chunk_size_ = kMinChunkSize;
+  }
+
+ private:
+  // Header placed at the start of every heap chunk, linking chunks together
+  // so the arena can free them.
+  struct Chunk {
+    Chunk* next;
+    size_t size;
+  };
+
+  static constexpr size_t kMinChunkSize = 1024;
+  static constexpr size_t kMaxChunkSize = 64 * 1024;
+
+  // Allocates a fresh chunk with room for at least `min_bytes` and makes it
+  // the active chunk. Anything left in the previous chunk is abandoned; the
+  // waste is bounded because requests larger than a chunk get a chunk of
+  // their own.
+  void AddChunk(size_t min_bytes) {
+    size_t size = std::max(next_chunk_size_, min_bytes + sizeof(Chunk));
+    next_chunk_size_ = std::min(size * 2, kMaxChunkSize);
+    char* raw = static_cast<char*>(::operator new(size));
+    Chunk* chunk = reinterpret_cast<Chunk*>(raw);
+    chunk->next = chunks_;
+    chunk->size = size;
+    chunks_ = chunk;
+    pos_ = raw + sizeof(Chunk);
+    end_ = raw + size;
+  }
+
+  void FreeChunks() {
+    for (Chunk* chunk = chunks_; chunk != nullptr;) {
+      Chunk* next = chunk->next;
+      ::operator delete(chunk);
+      chunk = next;
+    }
+  }
+
+  char* pos_ = nullptr;
+  char* end_ = nullptr;
+  Chunk* chunks_ = nullptr;
+  void* initial_buffer_ = nullptr;
+  size_t initial_size_ = 0;
+  size_t next_chunk_size_ = kMinChunkSize;
+};
+
+// -----------------------------------------------------------------------------
+// InlinedMonotonicArena
+// -----------------------------------------------------------------------------
+//
+// A `MonotonicArena` whose first `InlineBytes` bytes of storage live inside
+// the arena object itself (typically on the stack), so short-lived arenas
+// that stay small never touch the heap.
+template <size_t InlineBytes>
+class InlinedMonotonicArena : public MonotonicArena {
+ public:
+  InlinedMonotonicArena() : MonotonicArena(storage_, InlineBytes) {}
+
+ private:
+  alignas(alignof(max_align_t)) char storage_[InlineBytes];
+};
+
+// -----------------------------------------------------------------------------
+// ArenaAllocator
+// -----------------------------------------------------------------------------
+//
+// A standard-library allocator that draws memory from a `MonotonicArena`.
+// `deallocate()` is a no-op; memory is reclaimed when the arena is reset or
+// destroyed, which must not happen before the last container using the
+// allocator. The allocator propagates on container copy/move assignment and
+// swap so that containers never mix memory from different arenas.
+template <typename T>
+class ArenaAllocator {
+ public:
+  using value_type = T;
+  using size_type = size_t;
+  using difference_type = ptrdiff_t;
+
+  using propagate_on_container_copy_assignment = std::true_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+  using is_always_equal = std::false_type;
+
+  // The arena must outlive the allocator and every container using it.
+  explicit ArenaAllocator(MonotonicArena* arena) : arena_(arena) {}
+
+  template <typename U>
+  ArenaAllocator(const ArenaAllocator<U>& other) : arena_(other.arena()) {}
+
+  T* allocate(size_t n) {
+    return static_cast<T*>(arena_->Allocate(n * sizeof(T), alignof(T)));
+  }
+
+  // Arena memory is reclaimed wholesale; individual deallocation is a no-op.
+  void deallocate(T*, size_t) {}
+
+  MonotonicArena* arena() const { return arena_; }
+
+  template <typename U>
+  struct rebind {
+    using other = ArenaAllocator<U>;
+  };
+
+  friend bool operator==(const ArenaAllocator& a, const ArenaAllocator& b) {
+    return a.arena_ == b.arena_;
+  }
+
+  friend bool operator!=(const ArenaAllocator& a, const ArenaAllocator& b) {
+    return !(a == b);
+  }
+
+ private:
+  MonotonicArena* arena_;
+};
+
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_MEMORY_MONOTONIC_ARENA_H_
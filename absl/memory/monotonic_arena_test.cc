@@ -0,0 +1,125 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/memory/monotonic_arena.h"
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "absl/container/flat_hash_map.h"
+
+namespace {
+
+bool IsAligned(const void* p, size_t alignment) {
+  return reinterpret_cast<uintptr_t>(p) % alignment == 0;
+}
+
+TEST(MonotonicArena, AllocationsAreAlignedAndDistinct) {
+  absl::MonotonicArena arena;
+  char* a = static_cast<char*>(arena.Allocate(1));
+  char* b = static_cast<char*>(arena.Allocate(100, 64));
+  char* c = static_cast<char*>(arena.Allocate(3, 1));
+  EXPECT_TRUE(IsAligned(a, alignof(max_align_t)));
+  EXPECT_TRUE(IsAligned(b, 64));
+  // The regions must not overlap: fill each and check the others survive.
+  std::memset(a, 0xaa, 1);
+  std::memset(b, 0xbb, 100);
+  std::memset(c, 0xcc, 3);
+  EXPECT_EQ(*a, '\xaa');
+  for (int i = 0; i < 100; ++i) EXPECT_EQ(b[i], '\xbb');
+  for (int i = 0; i < 3; ++i) EXPECT_EQ(c[i], '\xcc');
+}
+
+TEST(MonotonicArena, ServesAllocationsLargerThanAChunk) {
+  absl::MonotonicArena arena;
+  constexpr size_t kBig = 1 << 20;
+  char* p = static_cast<char*>(arena.Allocate(kBig));
+  std::memset(p, 0x5a, kBig);
+  EXPECT_EQ(p[0], '\x5a');
+  EXPECT_EQ(p[kBig - 1], '\x5a');
+  // The arena keeps working after an oversized request.
+  EXPECT_NE(arena.Allocate(16), nullptr);
+}
+
+TEST(MonotonicArena, InlineStorageServesFirstAllocations) {
+  absl::InlinedMonotonicArena<256> arena;
+  const char* first = reinterpret_cast<const char*>(&arena);
+  const char* last = first + sizeof(arena);
+  char* p = static_cast<char*>(arena.Allocate(64));
+  EXPECT_GE(p, first);
+  EXPECT_LT(p, last);
+  // Once the inline buffer is exhausted, allocation moves to the heap.
+  char* q = static_cast<char*>(arena.Allocate(1024));
+  EXPECT_TRUE(q < first || q >= last);
+}
+
+TEST(MonotonicArena, ResetReturnsToInitialBuffer) {
+  absl::InlinedMonotonicArena<256> arena;
+  void* first = arena.Allocate(64);
+  arena.Allocate(1 << 16);  // force a heap chunk
+  arena.Reset();
+  EXPECT_EQ(arena.Allocate(64), first);
+}
+
+TEST(ArenaAllocator, WorksWithStdVector) {
+  absl::MonotonicArena arena;
+  absl::ArenaAllocator<int> alloc(&arena);
+  std::vector<int, absl::ArenaAllocator<int>> v(alloc);
+  for (int i = 0; i < 10000; ++i) v.push_back(i);
+  for (int i = 0; i < 10000; ++i) ASSERT_EQ(v[i], i);
+}
+
+TEST(ArenaAllocator, WorksWithFlatHashMap) {
+  using Alloc = absl::ArenaAllocator<std::pair<const int, std::string>>;
+  absl::MonotonicArena arena;
+  Alloc alloc(&arena);
+  absl::flat_hash_map<int, std::string, absl::Hash<int>, std::equal_to<int>,
+                      Alloc>
+      m(alloc);
+  for (int i = 0; i < 1000; ++i) m[i] = std::to_string(i);
+  EXPECT_EQ(m.size(), 1000);
+  for (int i = 0; i < 1000; ++i) ASSERT_EQ(m[i], std::to_string(i));
+}
+
+TEST(ArenaAllocator, EqualityFollowsTheArena) {
+  absl::MonotonicArena arena1;
+  absl::MonotonicArena arena2;
+  absl::ArenaAllocator<int> a(&arena1);
+  absl::ArenaAllocator<int> b(&arena1);
+  absl::ArenaAllocator<int> c(&arena2);
+  EXPECT_EQ(a, b);
+  EXPECT_NE(a, c);
+  // Rebinding preserves the arena.
+  absl::ArenaAllocator<double> d(a);
+  EXPECT_EQ(d.arena(), &arena1);
+}
+
+TEST(ArenaAllocator, CopyAssignmentPropagatesTheArena) {
+  absl::MonotonicArena arena1;
+  absl::MonotonicArena arena2;
+  absl::ArenaAllocator<int> alloc1(&arena1);
+  absl::ArenaAllocator<int> alloc2(&arena2);
+  std::vector<int, absl::ArenaAllocator<int>> v1(alloc1);
+  std::vector<int, absl::ArenaAllocator<int>> v2(alloc2);
+  v1.assign({1, 2, 3});
+  v2 = v1;
+  EXPECT_EQ(v2.get_allocator().arena(), &arena1);
+  EXPECT_EQ(v2.size(), 3);
+}
+
+}  // namespace
@@ -46,6 +46,7 @@
 
 #include "absl/base/attributes.h"
 #include "absl/numeric/internal/bits.h"
+#include "absl/types/span.h"
 
 namespace absl {
 ABSL_NAMESPACE_BEGIN
@@ -190,6 +191,32 @@ ABSL_INTERNAL_CONSTEXPR_CLZ inline
 
 #endif
 
+// Bulk counting functions
+//
+// These kernels count bits across whole arrays of words, as needed by bitmap
+// and bitset analytics, using SIMD paths (where the build enables them) that
+// run substantially faster than a per-word `popcount()` loop.
+
+// PopcountSpan()
+//
+// Returns the total number of 1 bits in `words`.
+uint64_t PopcountSpan(absl::Span<const uint64_t> words);
+
+// AndPopcount()
+//
+// Returns the total number of 1 bits in `a[i] & b[i]` over all `i` (the
+// cardinality of a bitset intersection) without materializing the
+// intermediate words. `a` and `b` must be the same size.
+uint64_t AndPopcount(absl::Span<const uint64_t> a, absl::Span<const uint64_t> b);
+
+// AndNotPopcount()
+//
+// Returns the total number of 1 bits in `a[i] & ~b[i]` over all `i` (the
+// cardinality of a bitset difference) without materializing the intermediate
+// words. `a` and `b` must be the same size.
+uint64_t AndNotPopcount(absl::Span<const uint64_t> a,
+                        absl::Span<const uint64_t> b);
+
 ABSL_NAMESPACE_END
 }  // namespace absl
 
@@ -14,8 +14,11 @@
 
 #include "absl/numeric/bits.h"
 
+#include <cstddef>
+#include <cstdint>
 #include <limits>
 #include <type_traits>
+#include <vector>
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
@@ -414,6 +417,47 @@ TEST(Counting, PopcountFuzz) {
   }
 }
 
+TEST(Counting, PopcountSpan) {
+  EXPECT_EQ(PopcountSpan({}), 0);
+
+  const std::vector<uint64_t> ones(130, ~uint64_t{0});
+  EXPECT_EQ(PopcountSpan(ones), 130 * 64);
+
+  // Exercise sizes around the SIMD block boundaries.
+  absl::BitGen rng;
+  for (size_t size : {1, 3, 4, 5, 7, 8, 9, 63, 64, 65, 127, 128, 129, 300}) {
+    std::vector<uint64_t> words(size);
+    uint64_t expected = 0;
+    for (uint64_t& word : words) {
+      word = absl::Uniform<uint64_t>(rng);
+      expected += static_cast<uint64_t>(popcount(word));
+    }
+    EXPECT_EQ(PopcountSpan(words), expected) << size;
+  }
+}
+
+TEST(Counting, FusedPopcounts) {
+  EXPECT_EQ(AndPopcount({}, {}), 0);
+  EXPECT_EQ(AndNotPopcount({}, {}), 0);
+
+  absl::BitGen rng;
+  for (size_t size : {1, 4, 9, 63, 64, 65, 128, 300}) {
+    std::vector<uint64_t> a(size);
+    std::vector<uint64_t> b(size);
+    uint64_t expected_and = 0;
+    uint64_t expected_and_not = 0;
+    for (size_t i = 0; i < size; ++i) {
+      a[i] = absl::Uniform<uint64_t>(rng);
+      b[i] = absl::Uniform<uint64_t>(rng);
+      expected_and += static_cast<uint64_t>(popcount(a[i] & b[i]));
+      expected_and_not += static_cast<uint64_t>(popcount(a[i] & ~b[i]));
+    }
+    EXPECT_EQ(AndPopcount(a, b), expected_and) << size;
+    EXPECT_EQ(AndNotPopcount(a, b), expected_and_not) << size;
+    EXPECT_EQ(AndNotPopcount(a, a), 0u);
+  }
+}
+
 TEST(IntegralPowersOfTwo, SingleBit) {
   EXPECT_FALSE(has_single_bit(uint8_t{}));
   EXPECT_FALSE(has_single_bit(static_cast<uint8_t>(-1)));
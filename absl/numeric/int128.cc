@@ -47,9 +47,59 @@ inline ABSL_ATTRIBUTE_ALWAYS_INLINE int Fls128(uint128 n) {
   return 63 - countl_zero(low);
 }
 
-// Long division/modulo for uint128 implemented using the shift-subtract
-// division algorithm adapted from:
-// https://stackoverflow.com/questions/5386377/division-without-using
+// Divides the 128-bit value `high:low` by the 64-bit `divisor`, returning the
+// 64-bit quotient and storing the remainder in `*remainder`. Requires
+// high < divisor so that the quotient fits in 64 bits. This is Knuth's
+// Algorithm D specialized to two 32-bit digit steps (Hacker's Delight,
+// 2nd ed., Figure 9-3).
+inline uint64_t Div128By64(uint64_t high, uint64_t low, uint64_t divisor,
+                           uint64_t* remainder) {
+  assert(high < divisor);
+  constexpr uint64_t b = uint64_t{1} << 32;  // Digit base.
+
+  // Normalize so the divisor's most significant bit is set.
+  const int s = countl_zero(divisor);
+  divisor <<= s;
+  const uint64_t vn1 = divisor >> 32;
+  const uint64_t vn0 = divisor & 0xffffffff;
+
+  const uint64_t un32 = (s == 0) ? high : (high << s) | (low >> (64 - s));
+  const uint64_t un10 = low << s;
+  const uint64_t un1 = un10 >> 32;
+  const uint64_t un0 = un10 & 0xffffffff;
+
+  // First quotient digit. The estimate is off by at most 2; the loop body
+  // executes at most twice.
+  uint64_t q1 = un32 / vn1;
+  uint64_t rhat = un32 % vn1;
+  while (q1 >= b || q1 * vn0 > b * rhat + un1) {
+    --q1;
+    rhat += vn1;
+    if (rhat >= b) break;
+  }
+
+  // Multiply and subtract; un21 fits in 64 bits even though the
+  // intermediate products wrap.
+  const uint64_t un21 = un32 * b + un1 - q1 * divisor;
+
+  // Second quotient digit.
+  uint64_t q0 = un21 / vn1;
+  rhat = un21 % vn1;
+  while (q0 >= b || q0 * vn0 > b * rhat + un0) {
+    --q0;
+    rhat += vn1;
+    if (rhat >= b) break;
+  }
+
+  *remainder = (un21 * b + un0 - q0 * divisor) >> s;
+  return q1 * b + q0;
+}
+
+// Division/modulo for uint128 built from 64-bit hardware division: either one
+// or two 2-digit-by-1-digit steps (Div128By64), or, for a divisor of 65 bits
+// or more, a single Knuth quotient estimate corrected by at most one
+// subtraction. Replaces bit-by-bit shift-subtract long division, whose cost
+// grew with the magnitude of the quotient (up to 128 iterations).
 inline void DivModImpl(uint128 dividend, uint128 divisor, uint128* quotient_ret,
                        uint128* remainder_ret) {
   assert(divisor != 0);
@@ -60,32 +110,46 @@ inline void DivModImpl(uint128 dividend, uint128 divisor, uint128* quotient_ret,
     return;
   }
 
-  if (divisor == dividend) {
-    *quotient_ret = 1;
-    *remainder_ret = 0;
-    return;
-  }
-
-  uint128 denominator = divisor;
-  uint128 quotient = 0;
+  uint64_t hi = Uint128High64(dividend);
+  const uint64_t lo = Uint128Low64(dividend);
+  const uint64_t divisor_hi = Uint128High64(divisor);
+  const uint64_t divisor_lo = Uint128Low64(divisor);
 
-  // Left aligns the MSB of the denominator and the dividend.
-  const int shift = Fls128(dividend) - Fls128(denominator);
-  denominator <<= shift;
-
-  // Uses shift-subtract algorithm to divide dividend by denominator. The
-  // remainder will be left in dividend.
-  for (int i = 0; i <= shift; ++i) {
-    quotient <<= 1;
-    if (dividend >= denominator) {
-      dividend -= denominator;
-      quotient |= 1;
+  if (divisor_hi == 0) {
+    if (hi == 0) {
+      *quotient_ret = lo / divisor_lo;
+      *remainder_ret = lo % divisor_lo;
+      return;
     }
-    denominator >>= 1;
+    // Reduce the high digit first so that Div128By64's precondition
+    // (high < divisor) holds for the low digit step.
+    const uint64_t quotient_hi = hi / divisor_lo;
+    hi %= divisor_lo;
+    uint64_t remainder = 0;
+    const uint64_t quotient_lo = Div128By64(hi, lo, divisor_lo, &remainder);
+    *quotient_ret = MakeUint128(quotient_hi, quotient_lo);
+    *remainder_ret = remainder;
+    return;
   }
 
+  // The divisor needs more than 64 bits, so the quotient fits in 64 bits.
+  // Estimate it from the divisor's top 64 bits (Hacker's Delight, 2nd ed.,
+  // Section 9-5): the estimate is at most one too large.
+  const int n = countl_zero(divisor_hi);
+  const uint64_t v1 = Uint128High64(divisor << n);
+  const uint128 u1 = dividend >> 1;
+  uint64_t ignored = 0;
+  const uint64_t q1 =
+      Div128By64(Uint128High64(u1), Uint128Low64(u1), v1, &ignored);
+  uint64_t quotient = Uint128Low64((uint128(q1) << n) >> 63);
+  if (quotient != 0) --quotient;
+  uint128 remainder = dividend - uint128(quotient) * divisor;
+  if (remainder >= divisor) {
+    ++quotient;
+    remainder -= divisor;
+  }
   *quotient_ret = quotient;
-  *remainder_ret = dividend;
+  *remainder_ret = remainder;
 }
 
 template <typename T>
@@ -151,6 +215,44 @@ uint128 operator%(uint128 lhs, uint128 rhs) {
 }
 #endif  // !defined(ABSL_HAVE_INTRINSIC_INT128)
 
+uint128_divisor::uint128_divisor(uint128 divisor)
+    : divisor_(divisor), magic_(0), shift_(0) {
+  assert(divisor != 0);
+  shift_ = Fls128(divisor);
+  if ((divisor & (divisor - 1)) == 0) {
+    // Power of two: div() is a plain shift and magic_ stays 0.
+    return;
+  }
+  // Compute m = floor(2**(129 + shift_) / divisor) + 1. With
+  // 2**shift_ < divisor < 2**(shift_ + 1), m always has exactly 129 bits;
+  // magic_ keeps its low 128 and div() supplies the high bit implicitly.
+  //
+  // Start from 2**128 == q * divisor + r, derived from dividing
+  // Uint128Max() == 2**128 - 1.
+  uint128 q;
+  uint128 r;
+  DivModImpl(Uint128Max(), divisor, &q, &r);
+  ++r;
+  if (r == divisor) {
+    ++q;
+    r = 0;
+  }
+  // Raise the dividend to 2**(129 + shift_) one bit at a time, keeping the
+  // remainder below the divisor.
+  for (int i = 0; i <= shift_; ++i) {
+    // 2*r can exceed 128 bits; when it does, the wrapped subtraction below
+    // still yields the correct remainder.
+    const bool overflow = (Uint128High64(r) >> 63) != 0;
+    q <<= 1;
+    r <<= 1;
+    if (overflow || r >= divisor) {
+      q |= 1;
+      r -= divisor;
+    }
+  }
+  magic_ = q + 1;  // The rounding up never carries into bit 128.
+}
+
 namespace {
 
 std::string Uint128ToFormattedString(uint128 v, std::ios_base::fmtflags flags) {
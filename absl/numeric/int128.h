@@ -255,6 +255,56 @@ constexpr uint128 Uint128Max() {
                  (std::numeric_limits<uint64_t>::max)());
 }
 
+// uint128_divisor
+//
+// Precomputed form of a `uint128` divisor, for repeated division by a value
+// that is not known at compile time but does not change between divisions
+// (e.g. a shard count). Construction computes a fixed-point reciprocal of the
+// divisor; each subsequent `div()` or `mod()` is then a multiply and a shift
+// rather than a hardware (or, without intrinsic 128-bit support, a software)
+// division.
+//
+// Example:
+//
+//     absl::uint128_divisor shards(num_shards);
+//     for (absl::uint128 key : keys) {
+//       Assign(key % shards, key / shards);
+//     }
+//
+// Construction costs roughly as much as a few plain divisions, so this only
+// pays off when the same divisor is reused.
+class uint128_divisor {
+ public:
+  // Precomputes the reciprocal of `divisor`, which must be nonzero.
+  explicit uint128_divisor(uint128 divisor);
+
+  // Returns the divisor this was constructed with.
+  constexpr uint128 divisor() const { return divisor_; }
+
+  // Returns `dividend / divisor()`.
+  uint128 div(uint128 dividend) const;
+
+  // Returns `dividend % divisor()`.
+  uint128 mod(uint128 dividend) const;
+
+ private:
+  uint128 divisor_;
+  // Low 128 bits of the 129-bit rounded-up reciprocal
+  // floor(2**(129 + shift_) / divisor_) + 1, or 0 when the divisor is a
+  // power of two and `div()` is a plain shift.
+  uint128 magic_;
+  // floor(log2(divisor_)).
+  int shift_;
+};
+
+inline uint128 operator/(uint128 lhs, const uint128_divisor& rhs) {
+  return rhs.div(lhs);
+}
+
+inline uint128 operator%(uint128 lhs, const uint128_divisor& rhs) {
+  return rhs.mod(lhs);
+}
+
 ABSL_NAMESPACE_END
 }  // namespace absl
 
@@ -1072,6 +1122,41 @@ inline uint128& uint128::operator--() {
   return *this;
 }
 
+namespace int128_internal {
+
+// Returns the high 128 bits of the full 256-bit product `lhs * rhs`.
+inline uint128 MultiplyHigh128(uint128 lhs, uint128 rhs) {
+  uint64_t a1 = Uint128High64(lhs);
+  uint64_t a0 = Uint128Low64(lhs);
+  uint64_t b1 = Uint128High64(rhs);
+  uint64_t b0 = Uint128Low64(rhs);
+  uint128 p00 = uint128(a0) * b0;
+  uint128 p01 = uint128(a0) * b1;
+  uint128 p10 = uint128(a1) * b0;
+  uint128 p11 = uint128(a1) * b1;
+  // None of these sums can overflow: each product is at most
+  // (2**64 - 1)**2 == 2**128 - 2**65 + 1, leaving room for two carries.
+  uint128 mid = p01 + Uint128High64(p00) + Uint128Low64(p10);
+  return p11 + Uint128High64(mid) + Uint128High64(p10);
+}
+
+}  // namespace int128_internal
+
+inline uint128 uint128_divisor::div(uint128 dividend) const {
+  if (magic_ == 0) return dividend >> shift_;  // Power-of-two divisor.
+  // Multiply-shift division by the 129-bit reciprocal m = 2**128 + magic_:
+  // dividend / divisor_ == floor(m * dividend / 2**(129 + shift_)). The
+  // addition of `dividend` contributed by the implicit high bit of `m` is
+  // folded in as (dividend - t) >> 1 to keep the sum within 128 bits.
+  uint128 t = int128_internal::MultiplyHigh128(magic_, dividend);
+  t += (dividend - t) >> 1;
+  return t >> shift_;
+}
+
+inline uint128 uint128_divisor::mod(uint128 dividend) const {
+  return dividend - div(dividend) * divisor_;
+}
+
 constexpr int128 MakeInt128(int64_t high, uint64_t low) {
   return int128(high, low);
 }
@@ -453,6 +453,64 @@ TEST(Uint128, DivideAndModRandomInputs) {
   }
 }
 
+TEST(Uint128, DivisorBasic) {
+  const absl::uint128 a = absl::MakeUint128(0x530eda741c71d4c3, 0xbf25975319080000);
+
+  // Powers of two divide by shifting.
+  for (int i = 0; i < 128; ++i) {
+    const absl::uint128 b = absl::uint128(1) << i;
+    const absl::uint128_divisor divisor(b);
+    EXPECT_EQ(divisor.divisor(), b);
+    EXPECT_EQ(a / divisor, a >> i);
+    EXPECT_EQ(a % divisor, a - ((a >> i) << i));
+  }
+
+  // Small divisors against the plain operators.
+  for (uint64_t b : {uint64_t{3}, uint64_t{10}, uint64_t{123},
+                     uint64_t{0x1110001}, uint64_t{10000000000000000000u}}) {
+    const absl::uint128_divisor divisor(b);
+    EXPECT_EQ(a / divisor, a / absl::uint128(b));
+    EXPECT_EQ(a % divisor, a % absl::uint128(b));
+  }
+
+  // Divisors wider than 64 bits.
+  const absl::uint128 big = absl::MakeUint128(0x29876d3a0e38ea61, 0xdf92cba98c83ffff);
+  const absl::uint128_divisor divisor(big);
+  EXPECT_EQ(a / divisor, a / big);
+  EXPECT_EQ(a % divisor, a % big);
+  EXPECT_EQ(big / divisor, 1);
+  EXPECT_EQ(big % divisor, 0);
+  EXPECT_EQ((big - 1) / divisor, 0);
+  EXPECT_EQ((big - 1) % divisor, big - 1);
+  EXPECT_EQ(absl::Uint128Max() / divisor,
+            absl::Uint128Max() / big);
+  EXPECT_EQ(absl::Uint128Max() % divisor,
+            absl::Uint128Max() % big);
+}
+
+TEST(Uint128, DivisorRandomInputs) {
+  const int kNumDivisors = 1 << 8;
+  const int kNumDividends = 1 << 10;
+  std::minstd_rand random(testing::UnitTest::GetInstance()->random_seed());
+  std::uniform_int_distribution<uint64_t> uniform_uint64;
+  for (int i = 0; i < kNumDivisors; ++i) {
+    // Cover divisors of every width.
+    const absl::uint128 b =
+        absl::MakeUint128(uniform_uint64(random), uniform_uint64(random)) >>
+        (i % 128);
+    if (b == 0) {
+      continue;  // Avoid a div-by-zero.
+    }
+    const absl::uint128_divisor divisor(b);
+    for (int j = 0; j < kNumDividends; ++j) {
+      const absl::uint128 a =
+          absl::MakeUint128(uniform_uint64(random), uniform_uint64(random));
+      ASSERT_EQ(a / divisor, a / b);
+      ASSERT_EQ(a % divisor, a % b);
+    }
+  }
+}
+
 TEST(Uint128, ConstexprTest) {
   constexpr absl::uint128 zero = absl::uint128();
   constexpr absl::uint128 one = 1;
@@ -19,6 +19,7 @@
 
 #include <atomic>
 
+#include "absl/base/attributes.h"
 #include "absl/base/optimization.h"
 #include "absl/profiling/internal/exponential_biased.h"
 
@@ -197,6 +198,21 @@ class PeriodicSampler final : public PeriodicSamplerBase {
     period_.store(period, std::memory_order_relaxed);
   }
 
+  // Returns true roughly once every `period` calls made by the calling
+  // thread. Thread-safe.
+  //
+  // Each thread counts down its own stride, drawn from `ExponentialBiased`,
+  // in a thread-local instance of this sampler: the common not-sampled path
+  // is a thread-local counter bump and sign test with no shared-memory
+  // traffic. The global period shared via `Tag` is consulted only when a
+  // stride expires, so `SetGlobalPeriod()` takes effect in each thread at
+  // its next fire. Prefer this over sharing one instance across threads,
+  // which would race on (and contend for) the instance's stride.
+  static bool SamplePerThread() noexcept {
+    ABSL_CONST_INIT thread_local PeriodicSampler sampler;
+    return sampler.Sample();
+  }
+
  private:
   static std::atomic<int> period_;
 };
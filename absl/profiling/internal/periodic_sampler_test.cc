@@ -14,7 +14,9 @@
 
 #include "absl/profiling/internal/periodic_sampler.h"
 
+#include <atomic>
 #include <thread>  // NOLINT(build/c++11)
+#include <vector>
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
@@ -148,6 +150,46 @@ TEST(PeriodicSamplerTest, DefaultPeriod) {
   EXPECT_THAT(sampler.period(), Eq(100));
 }
 
+TEST(PeriodicSamplerTest, SamplePerThread) {
+  struct Tag {};
+  using Sampler = PeriodicSampler<Tag, 16>;
+
+  // Every thread draws its own strides and fires independently, at roughly
+  // the global period across all of them.
+  constexpr int kThreads = 4;
+  constexpr int kCallsPerThread = 1 << 16;
+  std::atomic<int> fires(0);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&fires] {
+      int local_fires = 0;
+      for (int i = 0; i < kCallsPerThread; ++i) {
+        if (Sampler::SamplePerThread()) ++local_fires;
+      }
+      fires.fetch_add(local_fires, std::memory_order_relaxed);
+    });
+  }
+  for (std::thread& thread : threads) thread.join();
+
+  constexpr int kExpected = kThreads * kCallsPerThread / 16;
+  EXPECT_GT(fires.load(std::memory_order_relaxed), kExpected / 2);
+  EXPECT_LT(fires.load(std::memory_order_relaxed), kExpected * 2);
+}
+
+TEST(PeriodicSamplerTest, SamplePerThreadDisabledAndAlwaysOn) {
+  struct Tag {};
+  using Sampler = PeriodicSampler<Tag>;  // default period 0: disabled
+
+  for (int i = 0; i < 1000; ++i) {
+    EXPECT_FALSE(Sampler::SamplePerThread());
+  }
+
+  Sampler::SetGlobalPeriod(1);
+  EXPECT_TRUE(Sampler::SamplePerThread());
+  Sampler::SetGlobalPeriod(0);
+  EXPECT_FALSE(Sampler::SamplePerThread());
+}
+
 TEST(PeriodicSamplerTest, SetGlobalPeriod) {
   struct Tag1 {};
   struct Tag2 {};
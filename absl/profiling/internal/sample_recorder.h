@@ -45,7 +45,10 @@ struct Sample {
   // prevents races with sampling and resurrecting an object.
   absl::Mutex init_mu;
   T* next = nullptr;
-  T* dead ABSL_GUARDED_BY(init_mu) = nullptr;
+  // Intrusive link in the graveyard list; the sample is live iff this is
+  // null.  Written only under `init_mu`, but also read without it by
+  // `SampleRecorder::IterateUnlocked`, hence atomic.
+  std::atomic<T*> dead{nullptr};
   int64_t weight;  // How many sampling events were required to sample this one.
 };
 
@@ -77,6 +80,59 @@ class SampleRecorder {
   // samples that have been dropped.
   int64_t Iterate(const std::function<void(const T& stack)>& f);
 
+  // Like `Iterate`, but does not acquire any per-sample locks, so it never
+  // blocks concurrent `Register`/`Unregister` calls or mutations of the
+  // sampled objects.  In exchange, `f` runs concurrently with such calls and
+  // must restrict itself to fields of `T` that are safe to read without
+  // `init_mu` (e.g. atomics).  `f` may be invoked on a sample that is retired
+  // while it runs; `IsLive` can be used to re-validate a sample after reading
+  // from it.
+  int64_t IterateUnlocked(const std::function<void(const T& sample)>& f);
+
+  // Returns whether `sample` is currently live, i.e. registered and not
+  // awaiting reuse on the graveyard list.
+  static bool IsLive(const T& sample) {
+    return sample.dead.load(std::memory_order_acquire) == nullptr;
+  }
+
+  // A point-in-time view of the sample list.  Samples registered after the
+  // snapshot was taken are not visited: new samples are prepended to the
+  // list, so the captured head delimits an immutable segment.  Taking and
+  // iterating a snapshot acquires no locks and is therefore wait-free with
+  // respect to `Register`/`Unregister` and mutations of the sampled objects;
+  // the restrictions on `f` documented for `IterateUnlocked` apply.  A
+  // snapshot must not outlive its `SampleRecorder`.
+  class Snapshot {
+   public:
+    // Iterates over the samples in the snapshot that are still live,
+    // returning the number of samples dropped as of when the snapshot was
+    // taken.
+    int64_t Iterate(const std::function<void(const T& sample)>& f) const {
+      T* s = head_;
+      while (s != nullptr) {
+        if (IsLive(*s)) {
+          f(*s);
+        }
+        s = s->next;
+      }
+      return dropped_samples_;
+    }
+
+   private:
+    friend class SampleRecorder;
+    Snapshot(T* head, int64_t dropped_samples)
+        : head_(head), dropped_samples_(dropped_samples) {}
+
+    T* head_;
+    int64_t dropped_samples_;
+  };
+
+  // Captures the current sample list as a `Snapshot`.
+  Snapshot TakeSnapshot() const {
+    return Snapshot(all_.load(std::memory_order_acquire),
+                    dropped_samples_.load(std::memory_order_relaxed));
+  }
+
   size_t GetMaxSamples() const;
   void SetMaxSamples(size_t max);
 
@@ -131,7 +187,7 @@ template <typename T>
 SampleRecorder<T>::SampleRecorder()
     : dropped_samples_(0), size_estimate_(0), all_(nullptr), dispose_(nullptr) {
   absl::MutexLock l(&graveyard_.init_mu);
-  graveyard_.dead = &graveyard_;
+  graveyard_.dead.store(&graveyard_, std::memory_order_relaxed);
 }
 
 template <typename T>
@@ -161,8 +217,9 @@ void SampleRecorder<T>::PushDead(T* sample) {
 
   absl::MutexLock graveyard_lock(&graveyard_.init_mu);
   absl::MutexLock sample_lock(&sample->init_mu);
-  sample->dead = graveyard_.dead;
-  graveyard_.dead = sample;
+  sample->dead.store(graveyard_.dead.load(std::memory_order_relaxed),
+                     std::memory_order_release);
+  graveyard_.dead.store(sample, std::memory_order_relaxed);
 }
 
 template <typename T>
@@ -173,13 +230,16 @@ T* SampleRecorder<T>::PopDead(Targs... args) {
   // The list is circular, so eventually it collapses down to
   //   graveyard_.dead == &graveyard_
   // when it is empty.
-  T* sample = graveyard_.dead;
+  T* sample = graveyard_.dead.load(std::memory_order_relaxed);
   if (sample == &graveyard_) return nullptr;
 
   absl::MutexLock sample_lock(&sample->init_mu);
-  graveyard_.dead = sample->dead;
-  sample->dead = nullptr;
+  graveyard_.dead.store(sample->dead.load(std::memory_order_relaxed),
+                        std::memory_order_relaxed);
   sample->PrepareForSampling(std::forward<Targs>(args)...);
+  // Mark the sample live only after it is fully reinitialized so that
+  // `IterateUnlocked` never observes a live sample with stale state.
+  sample->dead.store(nullptr, std::memory_order_release);
   return sample;
 }
 
@@ -227,7 +287,21 @@ int64_t SampleRecorder<T>::Iterate(
   T* s = all_.load(std::memory_order_acquire);
   while (s != nullptr) {
     absl::MutexLock l(&s->init_mu);
-    if (s->dead == nullptr) {
+    if (s->dead.load(std::memory_order_relaxed) == nullptr) {
+      f(*s);
+    }
+    s = s->next;
+  }
+
+  return dropped_samples_.load(std::memory_order_relaxed);
+}
+
+template <typename T>
+int64_t SampleRecorder<T>::IterateUnlocked(
+    const std::function<void(const T& sample)>& f) {
+  T* s = all_.load(std::memory_order_acquire);
+  while (s != nullptr) {
+    if (IsLive(*s)) {
       f(*s);
     }
     s = s->next;
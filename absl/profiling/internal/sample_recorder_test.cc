@@ -105,6 +105,55 @@ TEST(SampleRecorderTest, Unregistration) {
   EXPECT_THAT(GetSizes(&sampler), IsEmpty());
 }
 
+TEST(SampleRecorderTest, IterateUnlocked) {
+  SampleRecorder<Info> sampler;
+  auto* info1 = Register(&sampler, 31, 1);
+  auto* info2 = Register(&sampler, 32, 2);
+
+  std::vector<size_t> sizes;
+  sampler.IterateUnlocked([&](const Info& info) {
+    EXPECT_TRUE(SampleRecorder<Info>::IsLive(info));
+    sizes.push_back(info.size.load(std::memory_order_acquire));
+  });
+  EXPECT_THAT(sizes, UnorderedElementsAre(1, 2));
+
+  sampler.Unregister(info1);
+  sizes.clear();
+  sampler.IterateUnlocked([&](const Info& info) {
+    sizes.push_back(info.size.load(std::memory_order_acquire));
+  });
+  EXPECT_THAT(sizes, UnorderedElementsAre(2));
+
+  sampler.Unregister(info2);
+}
+
+TEST(SampleRecorderTest, Snapshot) {
+  SampleRecorder<Info> sampler;
+  auto* info1 = Register(&sampler, 31, 1);
+  auto* info2 = Register(&sampler, 32, 2);
+
+  auto snapshot = sampler.TakeSnapshot();
+
+  // Samples registered after the snapshot are not visited.
+  auto* info3 = Register(&sampler, 33, 3);
+  std::vector<size_t> sizes;
+  snapshot.Iterate([&](const Info& info) {
+    sizes.push_back(info.size.load(std::memory_order_acquire));
+  });
+  EXPECT_THAT(sizes, UnorderedElementsAre(1, 2));
+
+  // Samples retired after the snapshot are skipped at visit time.
+  sampler.Unregister(info1);
+  sizes.clear();
+  snapshot.Iterate([&](const Info& info) {
+    sizes.push_back(info.size.load(std::memory_order_acquire));
+  });
+  EXPECT_THAT(sizes, UnorderedElementsAre(2));
+
+  sampler.Unregister(info2);
+  sampler.Unregister(info3);
+}
+
 TEST(SampleRecorderTest, MultiThreaded) {
   SampleRecorder<Info> sampler;
   Notification stop;
@@ -0,0 +1,150 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/profiling/internal/stack_trace_table.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "absl/base/config.h"
+#include "absl/base/internal/low_level_alloc.h"
+#include "absl/base/internal/raw_logging.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+namespace profiling_internal {
+
+namespace {
+
+size_t RoundUpToPowerOfTwo(size_t n) {
+  size_t result = 1;
+  while (result < n) result <<= 1;
+  return result;
+}
+
+}  // namespace
+
+StackTraceTable::StackTraceTable(size_t capacity) : next_id_(0) {
+  capacity_ = RoundUpToPowerOfTwo(capacity < 2 ? 2 : capacity);
+  const size_t num_slots = capacity_ * 2;
+  mask_ = num_slots - 1;
+  arena_ = base_internal::LowLevelAlloc::NewArena(
+      base_internal::LowLevelAlloc::kAsyncSignalSafe);
+  slots_ = static_cast<std::atomic<uint32_t>*>(
+      base_internal::LowLevelAlloc::AllocWithArena(
+          num_slots * sizeof(slots_[0]), arena_));
+  traces_ = static_cast<std::atomic<Trace*>*>(
+      base_internal::LowLevelAlloc::AllocWithArena(
+          capacity_ * sizeof(traces_[0]), arena_));
+  ABSL_RAW_CHECK(slots_ != nullptr && traces_ != nullptr, "out of memory");
+  for (size_t i = 0; i < num_slots; ++i) {
+    slots_[i].store(0, std::memory_order_relaxed);
+  }
+  for (size_t i = 0; i < capacity_; ++i) {
+    traces_[i].store(nullptr, std::memory_order_relaxed);
+  }
+}
+
+StackTraceTable::~StackTraceTable() {
+  for (size_t i = 0; i < capacity_; ++i) {
+    Trace* trace = traces_[i].load(std::memory_order_relaxed);
+    if (trace != nullptr) base_internal::LowLevelAlloc::Free(trace);
+  }
+  base_internal::LowLevelAlloc::Free(traces_);
+  base_internal::LowLevelAlloc::Free(slots_);
+  base_internal::LowLevelAlloc::DeleteArena(arena_);
+}
+
+uint64_t StackTraceTable::Hash(const void* const* pcs, int depth) {
+  // A simple multiply-xor mix.  We do not use absl::Hash here to keep the
+  // call path trivially async-signal-safe and dependency-free.
+  constexpr uint64_t kMul = uint64_t{0x9ddfea08eb382d69};
+  uint64_t h = static_cast<uint64_t>(depth);
+  for (int i = 0; i < depth; ++i) {
+    h ^= reinterpret_cast<uintptr_t>(pcs[i]);
+    h *= kMul;
+    h ^= h >> 47;
+  }
+  return h;
+}
+
+uint32_t StackTraceTable::Intern(const void* const* pcs, int depth) {
+  if (depth <= 0) return kInvalidId;
+  const uint64_t hash = Hash(pcs, depth);
+  const size_t num_slots = mask_ + 1;
+  const size_t num_pc_bytes = static_cast<size_t>(depth) * sizeof(pcs[0]);
+
+  // Trace and id claimed by this call, if any.  They are claimed at the
+  // first empty slot and reused if we lose the race for it; if the winner
+  // turns out to hold an equal trace, they are simply abandoned (bounded by
+  // the number of such races, not by the number of calls).
+  Trace* new_trace = nullptr;
+  uint32_t new_id = kInvalidId;
+
+  size_t index = static_cast<size_t>(hash) & mask_;
+  for (size_t probes = 0; probes < num_slots;
+       ++probes, index = (index + 1) & mask_) {
+    uint32_t id = slots_[index].load(std::memory_order_acquire);
+    if (id == 0) {
+      if (new_trace == nullptr) {
+        const uint64_t claimed =
+            next_id_.fetch_add(1, std::memory_order_relaxed) + 1;
+        if (claimed > capacity_) return kInvalidId;
+        new_trace = static_cast<Trace*>(
+            base_internal::LowLevelAlloc::AllocWithArena(
+                sizeof(Trace) - sizeof(new_trace->pcs) + num_pc_bytes,
+                arena_));
+        if (new_trace == nullptr) return kInvalidId;
+        new_trace->depth = depth;
+        memcpy(new_trace->pcs, pcs, num_pc_bytes);
+        new_id = static_cast<uint32_t>(claimed);
+        traces_[new_id - 1].store(new_trace, std::memory_order_release);
+      }
+      if (slots_[index].compare_exchange_strong(id, new_id,
+                                                std::memory_order_acq_rel,
+                                                std::memory_order_acquire)) {
+        return new_id;
+      }
+      // Lost the race for this slot; `id` now holds the winner, which may
+      // well be the same trace.  Fall through and compare.
+    }
+    const Trace* trace = traces_[id - 1].load(std::memory_order_acquire);
+    if (trace != nullptr && trace->depth == depth &&
+        memcmp(trace->pcs, pcs, num_pc_bytes) == 0) {
+      return id;
+    }
+  }
+  return kInvalidId;
+}
+
+int StackTraceTable::GetTrace(uint32_t id, const void** pcs,
+                              int max_depth) const {
+  if (id == kInvalidId || id > capacity_ || max_depth <= 0) return 0;
+  const Trace* trace = traces_[id - 1].load(std::memory_order_acquire);
+  if (trace == nullptr) return 0;
+  const int num_pcs = trace->depth < max_depth ? trace->depth : max_depth;
+  memcpy(pcs, trace->pcs, static_cast<size_t>(num_pcs) * sizeof(pcs[0]));
+  return num_pcs;
+}
+
+size_t StackTraceTable::size() const {
+  const uint64_t claimed = next_id_.load(std::memory_order_relaxed);
+  return claimed < capacity_ ? static_cast<size_t>(claimed) : capacity_;
+}
+
+}  // namespace profiling_internal
+ABSL_NAMESPACE_END
+}  // namespace absl
@@ -0,0 +1,121 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// -----------------------------------------------------------------------------
+// File: stack_trace_table.h
+// -----------------------------------------------------------------------------
+//
+// This header file defines a hash-consing table that maps stack traces to
+// small integer ids, storing each distinct trace exactly once.  Profilers
+// that capture the same traces over and over (e.g. allocation-sampling
+// hooks) can record a 4-byte id per sample instead of a full PC array,
+// deduplicating at capture time.  Insertion is lock-free and
+// async-signal-safe.
+//
+// This utility is internal-only. Use at your own risk.
+
+#ifndef ABSL_PROFILING_INTERNAL_STACK_TRACE_TABLE_H_
+#define ABSL_PROFILING_INTERNAL_STACK_TRACE_TABLE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "absl/base/config.h"
+#include "absl/base/internal/low_level_alloc.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+namespace profiling_internal {
+
+// StackTraceTable
+//
+// A fixed-capacity concurrent hash table keyed by the PC array of a stack
+// trace.  `Intern` returns a stable, dense, 1-based id for the trace,
+// inserting it if it has not been seen before; `GetTrace` recovers the PCs
+// for an id.  All storage comes from an async-signal-safe LowLevelAlloc
+// arena, so `Intern` may be called from signal handlers (the same contract
+// `absl::GetStackTrace` itself offers).
+//
+// The table never grows and never rehashes: once `capacity` distinct traces
+// have been interned (or a rare insertion race wastes an id), further new
+// traces get `kInvalidId` and the caller should fall back to storing the
+// trace itself.  Ids are never reused or invalidated.
+//
+// A `SampleRecorder` sample, for instance, can hold the id of its capture
+// trace rather than a `depth` + 64-pointer pair of fields.
+class StackTraceTable {
+ public:
+  // Returned by `Intern` when a trace cannot be interned, either because the
+  // table is full or because storage is exhausted.
+  static constexpr uint32_t kInvalidId = 0;
+
+  // Constructs a table holding at most `capacity` distinct traces (rounded up
+  // to a power of two).  The constructor allocates and is not
+  // async-signal-safe; create the table before installing any hooks that
+  // intern from signal context.
+  explicit StackTraceTable(size_t capacity = 1 << 16);
+  ~StackTraceTable();
+
+  StackTraceTable(const StackTraceTable&) = delete;
+  StackTraceTable& operator=(const StackTraceTable&) = delete;
+
+  // Returns the id for the trace `pcs[0, depth)`, interning it on first
+  // sight, or `kInvalidId` if `depth <= 0` or the table cannot accept new
+  // traces.  Lock-free and async-signal-safe.
+  uint32_t Intern(const void* const* pcs, int depth);
+
+  // Copies up to `max_depth` PCs of the trace with the given id into `pcs`
+  // and returns the number copied.  Returns 0 for `kInvalidId` or an id this
+  // table never returned.
+  int GetTrace(uint32_t id, const void** pcs, int max_depth) const;
+
+  // Number of ids handed out so far.  Insertion races may leave a few of
+  // these pointing at duplicate copies of a trace.
+  size_t size() const;
+
+  // Maximum number of ids this table can hand out.
+  size_t capacity() const { return capacity_; }
+
+ private:
+  struct Trace {
+    int depth;
+    const void* pcs[1];  // Actually `depth` entries, allocated inline.
+  };
+
+  static uint64_t Hash(const void* const* pcs, int depth);
+
+  size_t capacity_;  // Power of two; also the length of traces_.
+  size_t mask_;      // Length of slots_ minus one.
+
+  // Probe table.  A slot holds 0 when empty, else an id; claimed with
+  // compare-and-exchange.  Sized at twice capacity_ so that the load factor
+  // stays at or below one half.
+  std::atomic<uint32_t>* slots_;
+
+  // Id-to-trace map, indexed by id - 1.  An entry is written (release)
+  // before the id is published in slots_.
+  std::atomic<Trace*>* traces_;
+
+  // Monotonic id source; 64 bits so that a full table cannot wrap it.
+  std::atomic<uint64_t> next_id_;
+
+  absl::base_internal::LowLevelAlloc::Arena* arena_;
+};
+
+}  // namespace profiling_internal
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_PROFILING_INTERNAL_STACK_TRACE_TABLE_H_
@@ -0,0 +1,141 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/profiling/internal/stack_trace_table.h"
+
+#include <cstdint>
+#include <thread>  // NOLINT(build/c++11)
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+namespace profiling_internal {
+namespace {
+
+using ::testing::ElementsAre;
+
+const void* PC(uintptr_t value) {
+  return reinterpret_cast<const void*>(value);
+}
+
+TEST(StackTraceTableTest, InternAndGet) {
+  StackTraceTable table(16);
+  const void* trace[] = {PC(0x100), PC(0x200), PC(0x300)};
+
+  uint32_t id = table.Intern(trace, 3);
+  ASSERT_NE(id, StackTraceTable::kInvalidId);
+  EXPECT_EQ(table.size(), 1);
+
+  const void* out[8] = {};
+  EXPECT_EQ(table.GetTrace(id, out, 8), 3);
+  EXPECT_THAT(std::vector<const void*>(out, out + 3),
+              ElementsAre(PC(0x100), PC(0x200), PC(0x300)));
+
+  // A shorter output buffer truncates.
+  EXPECT_EQ(table.GetTrace(id, out, 2), 2);
+}
+
+TEST(StackTraceTableTest, DeduplicatesEqualTraces) {
+  StackTraceTable table(16);
+  const void* trace[] = {PC(0x100), PC(0x200), PC(0x300)};
+
+  uint32_t id = table.Intern(trace, 3);
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_EQ(table.Intern(trace, 3), id);
+  }
+  EXPECT_EQ(table.size(), 1);
+
+  // A prefix of the trace is a different trace.
+  uint32_t prefix_id = table.Intern(trace, 2);
+  EXPECT_NE(prefix_id, StackTraceTable::kInvalidId);
+  EXPECT_NE(prefix_id, id);
+  EXPECT_EQ(table.size(), 2);
+}
+
+TEST(StackTraceTableTest, InvalidArguments) {
+  StackTraceTable table(16);
+  const void* trace[] = {PC(0x100)};
+  const void* out[4];
+
+  EXPECT_EQ(table.Intern(trace, 0), StackTraceTable::kInvalidId);
+  EXPECT_EQ(table.Intern(trace, -1), StackTraceTable::kInvalidId);
+  EXPECT_EQ(table.GetTrace(StackTraceTable::kInvalidId, out, 4), 0);
+  EXPECT_EQ(table.GetTrace(12345, out, 4), 0);
+}
+
+TEST(StackTraceTableTest, FullTableRejectsNewTraces) {
+  StackTraceTable table(4);
+  ASSERT_EQ(table.capacity(), 4);
+
+  uint32_t ids[4];
+  for (uintptr_t i = 0; i < 4; ++i) {
+    const void* trace[] = {PC(0x1000 + i)};
+    ids[i] = table.Intern(trace, 1);
+    ASSERT_NE(ids[i], StackTraceTable::kInvalidId);
+  }
+  EXPECT_EQ(table.size(), 4);
+
+  const void* fresh[] = {PC(0x9999)};
+  EXPECT_EQ(table.Intern(fresh, 1), StackTraceTable::kInvalidId);
+
+  // Already-interned traces are still found.
+  const void* known[] = {PC(0x1002)};
+  EXPECT_EQ(table.Intern(known, 1), ids[2]);
+}
+
+TEST(StackTraceTableTest, ConcurrentIntern) {
+  constexpr int kThreads = 8;
+  constexpr uintptr_t kDistinctTraces = 64;
+  StackTraceTable table(1024);
+
+  std::vector<std::vector<uint32_t>> ids(kThreads);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&table, &ids, t] {
+      for (int rep = 0; rep < 100; ++rep) {
+        for (uintptr_t i = 0; i < kDistinctTraces; ++i) {
+          const void* trace[] = {PC(0x100 + i), PC(0x200 + i)};
+          uint32_t id = table.Intern(trace, 2);
+          ASSERT_NE(id, StackTraceTable::kInvalidId);
+          if (rep == 0) ids[t].push_back(id);
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  // Every thread resolved every trace to the same id.
+  for (int t = 1; t < kThreads; ++t) {
+    EXPECT_EQ(ids[t], ids[0]);
+  }
+  // Races may waste a few ids but each trace is interned at most once per
+  // losing thread.
+  EXPECT_GE(table.size(), kDistinctTraces);
+  EXPECT_LE(table.size(), kDistinctTraces * kThreads);
+
+  const void* out[4];
+  for (uintptr_t i = 0; i < kDistinctTraces; ++i) {
+    ASSERT_EQ(table.GetTrace(ids[0][i], out, 4), 2);
+    EXPECT_EQ(out[0], PC(0x100 + i));
+    EXPECT_EQ(out[1], PC(0x200 + i));
+  }
+}
+
+}  // namespace
+}  // namespace profiling_internal
+ABSL_NAMESPACE_END
+}  // namespace absl
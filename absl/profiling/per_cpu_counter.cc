@@ -0,0 +1,113 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/profiling/per_cpu_counter.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+
+#ifdef ABSL_HAVE_SCHED_GETCPU
+#include <sched.h>
+#endif
+
+#include "absl/base/internal/sysinfo.h"
+#include "absl/base/no_destructor.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/synchronization/mutex.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+namespace {
+
+// Number of cells per counter: the CPU count rounded up to a power of two,
+// so that a CPU index can be folded into a cell index with a mask.
+size_t NumCells() {
+  static const size_t num_cells = [] {
+    size_t n = 1;
+    while (n < static_cast<size_t>(absl::base_internal::NumCPUs())) n *= 2;
+    return n;
+  }();
+  return num_cells;
+}
+
+struct CounterRegistry {
+  absl::Mutex mu;
+  absl::flat_hash_map<std::string, std::unique_ptr<PerCpuCounter>> counters
+      ABSL_GUARDED_BY(mu);
+};
+
+CounterRegistry& Registry() {
+  static absl::NoDestructor<CounterRegistry> registry;
+  return *registry;
+}
+
+}  // namespace
+
+PerCpuCounter::PerCpuCounter()
+    : mask_(NumCells() - 1), cells_(new Cell[NumCells()]) {}
+
+size_t PerCpuCounter::CellIndex() const {
+#ifdef ABSL_HAVE_SCHED_GETCPU
+  int cpu = sched_getcpu();
+  if (cpu >= 0) return static_cast<size_t>(cpu) & mask_;
+#endif
+#ifdef ABSL_HAVE_THREAD_LOCAL
+  // The CPU is not cheaply available; spread threads over the cells instead.
+  static std::atomic<size_t> next_stripe{0};
+  thread_local size_t stripe =
+      next_stripe.fetch_add(1, std::memory_order_relaxed);
+  return stripe & mask_;
+#else
+  return 0;
+#endif
+}
+
+int64_t PerCpuCounter::Value() const {
+  int64_t sum = 0;
+  for (size_t i = 0; i <= mask_; ++i) {
+    sum += cells_[i].value.load(std::memory_order_relaxed);
+  }
+  return sum;
+}
+
+PerCpuCounter& PerCpuCounter::FindOrCreate(absl::string_view name) {
+  CounterRegistry& registry = Registry();
+  absl::MutexLock lock(&registry.mu);
+  auto it = registry.counters.find(name);
+  if (it == registry.counters.end()) {
+    it = registry.counters
+             .emplace(std::string(name),
+                      std::unique_ptr<PerCpuCounter>(new PerCpuCounter))
+             .first;
+  }
+  return *it->second;
+}
+
+void PerCpuCounter::ForEachCounter(
+    absl::FunctionRef<void(absl::string_view, int64_t)> fn) {
+  CounterRegistry& registry = Registry();
+  absl::MutexLock lock(&registry.mu);
+  for (const auto& entry : registry.counters) {
+    fn(entry.first, entry.second->Value());
+  }
+}
+
+ABSL_NAMESPACE_END
+}  // namespace absl
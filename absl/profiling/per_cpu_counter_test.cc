@@ -0,0 +1,82 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/profiling/per_cpu_counter.h"
+
+#include <cstdint>
+#include <string>
+#include <thread>  // NOLINT(build/c++11)
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/strings/string_view.h"
+
+namespace {
+
+TEST(PerCpuCounterTest, StartsAtZero) {
+  absl::PerCpuCounter counter;
+  EXPECT_EQ(counter.Value(), 0);
+}
+
+TEST(PerCpuCounterTest, AddAndIncrement) {
+  absl::PerCpuCounter counter;
+  counter.Add(10);
+  counter.Increment();
+  counter.Add(-3);
+  EXPECT_EQ(counter.Value(), 8);
+}
+
+TEST(PerCpuCounterTest, ConcurrentIncrementsAreNotLost) {
+  constexpr int kNumThreads = 8;
+  constexpr int kIncrementsPerThread = 100000;
+
+  absl::PerCpuCounter counter;
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back([&counter] {
+      for (int j = 0; j < kIncrementsPerThread; ++j) {
+        counter.Increment();
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  EXPECT_EQ(counter.Value(),
+            static_cast<int64_t>(kNumThreads) * kIncrementsPerThread);
+}
+
+TEST(PerCpuCounterTest, FindOrCreateReturnsSameCounterForSameName) {
+  absl::PerCpuCounter& a = absl::PerCpuCounter::FindOrCreate("test.same_name");
+  absl::PerCpuCounter& b = absl::PerCpuCounter::FindOrCreate("test.same_name");
+  absl::PerCpuCounter& c = absl::PerCpuCounter::FindOrCreate("test.other_name");
+  EXPECT_EQ(&a, &b);
+  EXPECT_NE(&a, &c);
+}
+
+TEST(PerCpuCounterTest, ForEachCounterExportsRegisteredValues) {
+  absl::PerCpuCounter::FindOrCreate("test.export_a").Add(5);
+  absl::PerCpuCounter::FindOrCreate("test.export_b").Add(7);
+
+  absl::flat_hash_map<std::string, int64_t> exported;
+  absl::PerCpuCounter::ForEachCounter(
+      [&exported](absl::string_view name, int64_t value) {
+        exported[std::string(name)] = value;
+      });
+
+  EXPECT_EQ(exported.at("test.export_a"), 5);
+  EXPECT_EQ(exported.at("test.export_b"), 7);
+}
+
+}  // namespace
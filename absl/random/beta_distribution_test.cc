@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <cfloat>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <iterator>
@@ -39,6 +40,7 @@
 #include "absl/strings/str_format.h"
 #include "absl/strings/str_replace.h"
 #include "absl/strings/strip.h"
+#include "absl/types/span.h"
 
 namespace {
 
@@ -563,6 +565,41 @@ TEST(BetaDistributionTest, StabilityTest) {
 // changes, then it is likely that this test will change as well.  Also, if
 // dependencies of the distribution change, such as RandU64ToDouble, then this
 // is also likely to change.
+TEST(BetaDistributionTest, FillMatchesDistribution) {
+  // We use a fixed bit generator for distribution accuracy tests.  This allows
+  // these tests to be deterministic, while still testing the quality of the
+  // implementation.
+  absl::random_internal::pcg64_2018_engine rng(0x2B7E151628AED2A6);
+
+  // One (alpha, beta) pair per algorithm: Joehnk and Cheng's BA/BB.
+  for (const auto& ab :
+       {std::make_pair(0.5, 0.5), std::make_pair(0.9, 2.0),
+        std::make_pair(3.0, 4.0)}) {
+    const double alpha = ab.first;
+    const double beta = ab.second;
+    absl::beta_distribution<double> dist(alpha, beta);
+    std::vector<double> data(20000);
+    dist.fill(rng, absl::MakeSpan(data));
+
+    double sum = 0;
+    for (const auto x : data) {
+      ASSERT_GE(x, 0.0);
+      ASSERT_LE(x, 1.0);
+      sum += x;
+    }
+    const double expected_mean = alpha / (alpha + beta);
+    const double variance =
+        alpha * beta /
+        ((alpha + beta) * (alpha + beta) * (alpha + beta + 1));
+    // Allow ~7 standard errors of the mean.
+    EXPECT_NEAR(sum / static_cast<double>(data.size()), expected_mean,
+                7.0 * std::sqrt(variance / static_cast<double>(data.size())));
+  }
+
+  absl::beta_distribution<double> dist(2.0, 2.0);
+  dist.fill(rng, absl::Span<double>());  // empty spans are valid
+}
+
 TEST(BetaDistributionTest, AlgorithmBounds) {
 #if (defined(__i386__) || defined(_M_IX86)) && FLT_EVAL_METHOD != 0
   // We're using an x87-compatible FPU, and intermediate operations are
@@ -24,6 +24,7 @@
 #ifndef ABSL_RANDOM_BIT_GEN_REF_H_
 #define ABSL_RANDOM_BIT_GEN_REF_H_
 
+#include <cstdint>
 #include <limits>
 #include <type_traits>
 #include <utility>
@@ -34,6 +35,9 @@
 #include "absl/meta/type_traits.h"
 #include "absl/random/internal/distribution_caller.h"
 #include "absl/random/internal/fast_uniform_bits.h"
+#include "absl/random/internal/nonsecure_base.h"
+#include "absl/random/internal/pcg_engine.h"
+#include "absl/random/internal/randen_engine.h"
 
 namespace absl {
 ABSL_NAMESPACE_BEGIN
@@ -119,7 +123,8 @@ class BitGenRef {
   BitGenRef(URBGRef&& gen ABSL_ATTRIBUTE_LIFETIME_BOUND)  // NOLINT
       : t_erased_gen_ptr_(reinterpret_cast<uintptr_t>(&gen)),
         mock_call_(NotAMock),
-        generate_impl_fn_(ImplFn<URBG>) {}
+        generate_impl_fn_(ImplFn<URBG>),
+        kind_(KindOf<URBG>()) {}
 
   template <typename URBGRef, typename URBG = absl::remove_cvref_t<URBGRef>,
             typename absl::enable_if_t<(!std::is_same<URBG, BitGenRef>::value &&
@@ -128,7 +133,8 @@ class BitGenRef {
   BitGenRef(URBGRef&& gen ABSL_ATTRIBUTE_LIFETIME_BOUND)  // NOLINT
       : t_erased_gen_ptr_(reinterpret_cast<uintptr_t>(&gen)),
         mock_call_(&MockCall<URBG>),
-        generate_impl_fn_(ImplFn<URBG>) {}
+        generate_impl_fn_(ImplFn<URBG>),
+        kind_(KindOf<URBG>()) {}
 
   using result_type = uint64_t;
 
@@ -140,13 +146,52 @@ class BitGenRef {
     return (std::numeric_limits<result_type>::max)();
   }
 
-  result_type operator()() { return generate_impl_fn_(t_erased_gen_ptr_); }
+  result_type operator()() {
+    // Generators identified by `kind_` are dispatched directly so that the
+    // call can be inlined: code that takes a `BitGenRef` for mockability
+    // pays nothing for the seam when production passes an `absl::BitGen`.
+    // Both types produce full-range 64-bit values (checked below), so the
+    // direct call returns exactly what the type-erased `ImplFn` would.
+    if (kind_ == GenKind::kBitGen) {
+      return (*reinterpret_cast<BitGenType*>(t_erased_gen_ptr_))();
+    }
+    if (kind_ == GenKind::kInsecureBitGen) {
+      return (*reinterpret_cast<InsecureBitGenType*>(t_erased_gen_ptr_))();
+    }
+    return generate_impl_fn_(t_erased_gen_ptr_);
+  }
 
  private:
   using impl_fn = result_type (*)(uintptr_t);
   using mock_call_fn = bool (*)(uintptr_t, base_internal::FastTypeIdType, void*,
                                 void*);
 
+  // The concrete types behind `absl::BitGen` and `absl::InsecureBitGen`,
+  // which get a devirtualized fast path in `operator()`.
+  using BitGenType = random_internal::NonsecureURBGBase<
+      random_internal::randen_engine<uint64_t>>;
+  using InsecureBitGenType =
+      random_internal::NonsecureURBGBase<random_internal::pcg64_2018_engine>;
+
+  static_assert((BitGenType::min)() == 0 &&
+                    (BitGenType::max)() ==
+                        (std::numeric_limits<uint64_t>::max)(),
+                "BitGen does not cover the full result_type range");
+  static_assert((InsecureBitGenType::min)() == 0 &&
+                    (InsecureBitGenType::max)() ==
+                        (std::numeric_limits<uint64_t>::max)(),
+                "InsecureBitGen does not cover the full result_type range");
+
+  enum class GenKind : uint8_t { kGeneric, kBitGen, kInsecureBitGen };
+
+  template <typename URBG>
+  static constexpr GenKind KindOf() {
+    return std::is_same<URBG, BitGenType>::value ? GenKind::kBitGen
+           : std::is_same<URBG, InsecureBitGenType>::value
+               ? GenKind::kInsecureBitGen
+               : GenKind::kGeneric;
+  }
+
   template <typename URBG>
   static result_type ImplFn(uintptr_t ptr) {
     // Ensure that the return values from operator() fill the entire
@@ -175,6 +220,7 @@ class BitGenRef {
   uintptr_t t_erased_gen_ptr_;
   mock_call_fn mock_call_;
   impl_fn generate_impl_fn_;
+  GenKind kind_;
 
   template <typename>
   friend struct ::absl::random_internal::DistributionCaller;  // for InvokeMock
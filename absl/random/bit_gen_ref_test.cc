@@ -15,6 +15,10 @@
 //
 #include "absl/random/bit_gen_ref.h"
 
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 #include "absl/base/internal/fast_type_id.h"
@@ -90,6 +94,32 @@ TEST(BitGenRefTest, PassThroughEquivalence) {
   EXPECT_THAT(output, testing::Eq(expected));
 }
 
+TEST(BitGenRefTest, DirectDispatchAdvancesUnderlyingGenerator) {
+  // absl::BitGen and absl::InsecureBitGen take the direct-dispatch path in
+  // operator(). Draws through the ref must advance the referenced generator
+  // exactly as calling it directly: interleaved draws form one stream, so no
+  // 64-bit value should ever repeat.
+  std::vector<uint64_t> draws;
+  {
+    absl::BitGen gen;
+    absl::BitGenRef gen_ref(gen);
+    for (int i = 0; i < 8; ++i) {
+      draws.push_back(gen_ref());
+      draws.push_back(gen());
+    }
+  }
+  {
+    absl::InsecureBitGen gen;
+    absl::BitGenRef gen_ref(gen);
+    for (int i = 0; i < 8; ++i) {
+      draws.push_back(gen_ref());
+      draws.push_back(gen());
+    }
+  }
+  std::sort(draws.begin(), draws.end());
+  EXPECT_EQ(std::adjacent_find(draws.begin(), draws.end()), draws.end());
+}
+
 TEST(BitGenRefTest, MockingBitGenBaseOverrides) {
   ConstBitGen const_gen;
   EXPECT_EQ(FnTest(const_gen), 42);
@@ -190,6 +190,9 @@ void discrete_distribution<IntType>::param_type::init() {
   }
 }
 
+// Variate generation is O(1): one uniform strip selection, one probe into the
+// precomputed (acceptance, alternate) table, and one bernoulli acceptance
+// test. No per-draw binary search over cumulative sums is involved.
 template <typename IntType>
 template <typename URBG>
 typename discrete_distribution<IntType>::result_type
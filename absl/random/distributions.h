@@ -46,8 +46,10 @@
 #ifndef ABSL_RANDOM_DISTRIBUTIONS_H_
 #define ABSL_RANDOM_DISTRIBUTIONS_H_
 
+#include <algorithm>
 #include <limits>
 #include <type_traits>
+#include <utility>
 
 #include "absl/base/config.h"
 #include "absl/base/internal/inline_variable.h"
@@ -57,6 +59,7 @@
 #include "absl/random/exponential_distribution.h"
 #include "absl/random/gaussian_distribution.h"
 #include "absl/random/internal/distribution_caller.h"  // IWYU pragma: export
+#include "absl/random/internal/fast_uniform_bits.h"
 #include "absl/random/internal/traits.h"
 #include "absl/random/internal/uniform_helper.h"  // IWYU pragma: export
 #include "absl/random/log_uniform_int_distribution.h"
@@ -64,6 +67,7 @@
 #include "absl/random/uniform_int_distribution.h"  // IWYU pragma: export
 #include "absl/random/uniform_real_distribution.h"  // IWYU pragma: export
 #include "absl/random/zipf_distribution.h"
+#include "absl/types/span.h"
 
 namespace absl {
 ABSL_NAMESPACE_BEGIN
@@ -119,7 +123,9 @@ ABSL_INTERNAL_INLINE_CONSTEXPR(IntervalOpenClosedTag, IntervalOpenClosed, {});
 //   auto x = absl::Uniform<float>(bitgen, 0, 1);
 //
 template <typename R = void, typename TagType, typename URBG>
-typename absl::enable_if_t<!std::is_same<R, void>::value, R>  //
+typename absl::enable_if_t<!std::is_same<R, void>::value &&
+                               random_internal::IsIntervalTag<TagType>::value,
+                           R>
 Uniform(TagType tag,
         URBG&& urbg,  // NOLINT(runtime/references)
         R lo, R hi) {
@@ -161,7 +167,8 @@ Uniform(URBG&& urbg,  // NOLINT(runtime/references)
 // correctly from the passed types.
 template <typename R = void, typename TagType, typename URBG, typename A,
           typename B>
-typename absl::enable_if_t<std::is_same<R, void>::value,
+typename absl::enable_if_t<std::is_same<R, void>::value &&
+                               random_internal::IsIntervalTag<TagType>::value,
                            random_internal::uniform_inferred_return_t<A, B>>
 Uniform(TagType tag,
         URBG&& urbg,  // NOLINT(runtime/references)
@@ -217,6 +224,117 @@ Uniform(URBG&& urbg) {  // NOLINT(runtime/references)
       distribution_t>(&urbg);
 }
 
+namespace random_internal {
+
+// When the URBG is mocked, each value is produced through DistributionCaller
+// so per-element mock interception still works; otherwise the distribution
+// object is constructed once and reused across the entire span.
+template <typename DistrT, typename URBG, typename T, typename... Args>
+typename absl::enable_if_t<DistributionCaller<URBG>::HasInvokeMock::value>
+UniformFillImpl(URBG* urbg, absl::Span<T> span, Args&&... args) {
+  for (T& v : span) {
+    v = DistributionCaller<URBG>::template Call<DistrT>(urbg, args...);
+  }
+}
+
+// Distributions providing a batch fill() method (such as
+// absl::uniform_int_distribution) generate the entire span per call;
+// otherwise each element is drawn from the distribution in turn.
+template <typename DistrT, typename URBG, typename T>
+auto UniformFillDispatch(DistrT& dist, URBG& urbg, absl::Span<T> span, int)
+    -> decltype(dist.fill(urbg, span)) {
+  dist.fill(urbg, span);
+}
+
+template <typename DistrT, typename URBG, typename T>
+void UniformFillDispatch(DistrT& dist, URBG& urbg, absl::Span<T> span, char) {
+  for (T& v : span) {
+    v = dist(urbg);
+  }
+}
+
+template <typename DistrT, typename URBG, typename T, typename... Args>
+typename absl::enable_if_t<!DistributionCaller<URBG>::HasInvokeMock::value>
+UniformFillImpl(URBG* urbg, absl::Span<T> span, Args&&... args) {
+  DistrT dist(std::forward<Args>(args)...);
+  UniformFillDispatch(dist, *urbg, span, 0);
+}
+
+}  // namespace random_internal
+
+// absl::Uniform(tag, bitgen, span, lo, hi)
+//
+// Overload of `Uniform()` which fills `span` with values in the interval
+// indicated by `tag`, equivalent to assigning `Uniform<T>(tag, bitgen, lo,
+// hi)` to each element. Amortizing the distribution setup across the span
+// makes this substantially faster than element-wise calls for large buffers.
+template <typename T, typename TagType, typename URBG, typename A, typename B>
+void Uniform(TagType tag,
+             URBG&& urbg,  // NOLINT(runtime/references)
+             absl::Span<T> span, A lo, B hi) {
+  using distribution_t = random_internal::UniformDistributionWrapper<T>;
+
+  auto a = random_internal::uniform_lower_bound<T>(tag, lo, hi);
+  auto b = random_internal::uniform_upper_bound<T>(tag, lo, hi);
+  if (!random_internal::is_uniform_range_valid(a, b)) {
+    std::fill(span.begin(), span.end(), static_cast<T>(lo));
+    return;
+  }
+
+  random_internal::UniformFillImpl<distribution_t>(
+      &urbg, span, tag, static_cast<T>(lo), static_cast<T>(hi));
+}
+
+// absl::Uniform(bitgen, span, lo, hi)
+//
+// Overload of `Uniform()` which fills `span` with values in the default
+// closed-open interval of [lo, hi).
+template <typename T, typename URBG, typename A, typename B>
+void Uniform(URBG&& urbg,  // NOLINT(runtime/references)
+             absl::Span<T> span, A lo, B hi) {
+  using distribution_t = random_internal::UniformDistributionWrapper<T>;
+
+  constexpr auto tag = absl::IntervalClosedOpen;
+  auto a = random_internal::uniform_lower_bound<T>(tag, lo, hi);
+  auto b = random_internal::uniform_upper_bound<T>(tag, lo, hi);
+  if (!random_internal::is_uniform_range_valid(a, b)) {
+    std::fill(span.begin(), span.end(), static_cast<T>(lo));
+    return;
+  }
+
+  random_internal::UniformFillImpl<distribution_t>(&urbg, span,
+                                                   static_cast<T>(lo),
+                                                   static_cast<T>(hi));
+}
+
+// -----------------------------------------------------------------------------
+// absl::FillRandom(bitgen, span)
+// -----------------------------------------------------------------------------
+//
+// `absl::FillRandom` fills `span` with uniformly distributed random values
+// over the entire range of the unsigned integer type `T`, as if each element
+// were assigned from `absl::Uniform<T>(bitgen)`.
+//
+// Generators exposing a bulk `generate()` method, such as `absl::BitGen`,
+// fill whole buffers per underlying refill, which is much faster than
+// requesting one value per call.
+//
+// Example:
+//
+//   absl::BitGen bitgen;
+//   std::vector<uint64_t> draws(1 << 20);
+//   absl::FillRandom(bitgen, absl::MakeSpan(draws));
+//
+template <typename URBG, typename T>
+void FillRandom(URBG&& urbg,  // NOLINT(runtime/references)
+                absl::Span<T> span) {
+  static_assert(random_internal::IsUnsigned<T>::value,
+                "absl::FillRandom() must be parameterized by an unsigned "
+                "integer type");
+  random_internal::FillUniformBits(&urbg, span.data(),
+                                   span.data() + span.size());
+}
+
 // -----------------------------------------------------------------------------
 // absl::Bernoulli(bitgen, p)
 // -----------------------------------------------------------------------------
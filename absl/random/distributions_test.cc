@@ -14,6 +14,7 @@
 
 #include "absl/random/distributions.h"
 
+#include <algorithm>
 #include <cfloat>
 #include <cmath>
 #include <cstdint>
@@ -27,6 +28,7 @@
 #include "absl/numeric/int128.h"
 #include "absl/random/internal/distribution_test_util.h"
 #include "absl/random/random.h"
+#include "absl/types/span.h"
 
 namespace {
 
@@ -267,6 +269,49 @@ TEST_F(RandomDistributionsTest, UniformNoBounds) {
                               decltype(UniformNoBoundsReturnT<double>(0))>();
 }
 
+TEST_F(RandomDistributionsTest, UniformSpan) {
+  absl::InsecureBitGen gen;
+
+  std::vector<int> ints(101, -1);
+  absl::Uniform(gen, absl::MakeSpan(ints), 1, 100);
+  for (const int v : ints) {
+    EXPECT_GE(v, 1);
+    EXPECT_LT(v, 100);
+  }
+
+  std::vector<double> doubles(101, -1.0);
+  absl::Uniform(absl::IntervalClosedClosed, gen, absl::MakeSpan(doubles), 0.0,
+                1.0);
+  for (const double v : doubles) {
+    EXPECT_GE(v, 0.0);
+    EXPECT_LE(v, 1.0);
+  }
+
+  // An invalid range fills the span with lo, matching the scalar overload.
+  absl::Uniform(gen, absl::MakeSpan(ints), 7, 7);
+  for (const int v : ints) {
+    EXPECT_EQ(7, v);
+  }
+}
+
+TEST_F(RandomDistributionsTest, FillRandom) {
+  absl::BitGen gen;
+
+  // A repeated or stuck value among 1024 uint64_t draws is astronomically
+  // unlikely for a working generator.
+  std::vector<uint64_t> draws(1024, 0);
+  absl::FillRandom(gen, absl::MakeSpan(draws));
+  std::vector<uint64_t> sorted = draws;
+  std::sort(sorted.begin(), sorted.end());
+  EXPECT_EQ(sorted.end(), std::adjacent_find(sorted.begin(), sorted.end()));
+
+  // Narrower types exercise the generic per-value fallback.
+  std::vector<uint16_t> small(1024, 0);
+  absl::FillRandom(gen, absl::MakeSpan(small));
+  EXPECT_NE(*std::min_element(small.begin(), small.end()),
+            *std::max_element(small.begin(), small.end()));
+}
+
 TEST_F(RandomDistributionsTest, UniformNonsenseRanges) {
   // The ranges used in this test are undefined behavior.
   // The results are arbitrary and subject to future changes.
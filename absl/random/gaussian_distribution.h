@@ -23,15 +23,18 @@
 //
 
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <istream>
 #include <limits>
 #include <type_traits>
 
 #include "absl/base/config.h"
+#include "absl/base/optimization.h"
 #include "absl/random/internal/fast_uniform_bits.h"
 #include "absl/random/internal/generate_real.h"
 #include "absl/random/internal/iostream_state_saver.h"
+#include "absl/types/span.h"
 
 namespace absl {
 ABSL_NAMESPACE_BEGIN
@@ -46,9 +49,22 @@ namespace random_internal {
 // Jurgen A Doornik.  (https://www.doornik.com/research/ziggurat.pdf)
 class ABSL_DLL gaussian_distribution_base {
  public:
+  // Number of variates produced per chunk by zignor_fill; also bounds its
+  // stack buffer of pregenerated bits.
+  static constexpr size_t kBatchSize = 256;
+
   template <typename URBG>
   inline double zignor(URBG& g);  // NOLINT(runtime/references)
 
+  // Fills [begin, end) with variates, equivalent in distribution to repeated
+  // invocation of zignor(). Bits for the common-case rectangle test are
+  // generated in bulk so the strip selection and table lookups form a tight
+  // branch-free loop; wedge and tail rejections are resolved with the scalar
+  // path.
+  template <typename URBG>
+  inline void zignor_fill(URBG& g,  // NOLINT(runtime/references)
+                          double* begin, double* end);
+
  private:
   friend class TableGenerator;
 
@@ -139,6 +155,20 @@ class gaussian_distribution : random_internal::gaussian_distribution_base {
   result_type operator()(URBG& g,  // NOLINT(runtime/references)
                          const param_type& p);
 
+  // Fills `out` with variates, equivalent in distribution to assigning each
+  // element from operator(). Generating bits in bulk and keeping the
+  // common-case ziggurat layer branch-free makes this substantially faster
+  // than element-wise calls for large spans.
+  template <typename URBG>
+  void fill(URBG& g,  // NOLINT(runtime/references)
+            absl::Span<result_type> out) {
+    fill(g, param_, out);
+  }
+
+  template <typename URBG>
+  void fill(URBG& g,  // NOLINT(runtime/references)
+            const param_type& p, absl::Span<result_type> out);
+
   param_type param() const { return param_; }
   void param(const param_type& p) { param_ = p; }
 
@@ -178,6 +208,25 @@ gaussian_distribution<RealType>::operator()(
   return p.mean() + p.stddev() * static_cast<result_type>(zignor(g));
 }
 
+template <typename RealType>
+template <typename URBG>
+void gaussian_distribution<RealType>::fill(
+    URBG& g,  // NOLINT(runtime/references)
+    const param_type& p, absl::Span<result_type> out) {
+  double buf[kBatchSize];
+  result_type* dest = out.data();
+  size_t remaining = out.size();
+  while (remaining > 0) {
+    const size_t n = remaining < kBatchSize ? remaining : kBatchSize;
+    zignor_fill(g, buf, buf + n);
+    for (size_t i = 0; i < n; ++i) {
+      dest[i] = p.mean() + p.stddev() * static_cast<result_type>(buf[i]);
+    }
+    dest += n;
+    remaining -= n;
+  }
+}
+
 template <typename CharT, typename Traits, typename RealType>
 std::basic_ostream<CharT, Traits>& operator<<(
     std::basic_ostream<CharT, Traits>& os,  // NOLINT(runtime/references)
@@ -268,6 +317,54 @@ inline double gaussian_distribution_base::zignor(
   }
 }
 
+template <typename URBG>
+inline void gaussian_distribution_base::zignor_fill(
+    URBG& g,  // NOLINT(runtime/references)
+    double* begin, double* end) {
+  using random_internal::GeneratePositiveTag;
+  using random_internal::GenerateRealFromBits;
+  using random_internal::GenerateSignedTag;
+
+  uint64_t bits[kBatchSize];
+  while (begin != end) {
+    const size_t remaining = static_cast<size_t>(end - begin);
+    const size_t n = remaining < kBatchSize ? remaining : kBatchSize;
+    FillUniformBits(&g, bits, bits + n);
+
+    // First pass: compute every rectangle candidate with branch-free strip
+    // selection and table lookups, exactly as in zignor().
+    for (size_t k = 0; k < n; ++k) {
+      const int i = static_cast<int>(bits[k] & kMask);
+      const double j =
+          GenerateRealFromBits<double, GenerateSignedTag, false>(bits[k]);
+      begin[k] = j * zg_.x[i];
+    }
+
+    // Second pass: resolve the rare rectangle rejections with the remainder
+    // of the zignor() loop body, drawing any further bits scalar-wise.
+    for (size_t k = 0; k < n; ++k) {
+      const int i = static_cast<int>(bits[k] & kMask);
+      const double x = begin[k];
+      if (ABSL_PREDICT_TRUE(std::abs(x) < zg_.x[i + 1])) {
+        continue;  // Rectangular box, as in zignor().
+      }
+      if (i == 0) {
+        // Base box; sample the tail using a ratio of uniforms.
+        begin[k] = zignor_fallback(g, x < 0);
+        continue;
+      }
+      // Wedge sample, accepting or retrying exactly as zignor() would.
+      const double v = GenerateRealFromBits<double, GeneratePositiveTag, false>(
+          fast_u64_(g));  // U(0, 1)
+      if ((zg_.f[i + 1] + v * (zg_.f[i] - zg_.f[i + 1])) >=
+          std::exp(-0.5 * x * x)) {
+        begin[k] = zignor(g);
+      }
+    }
+    begin += n;
+  }
+}
+
 }  // namespace random_internal
 ABSL_NAMESPACE_END
 }  // namespace absl
@@ -19,6 +19,7 @@
 #include <cstddef>
 #include <ios>
 #include <iterator>
+#include <limits>
 #include <random>
 #include <string>
 #include <type_traits>
@@ -37,6 +38,7 @@
 #include "absl/strings/str_format.h"
 #include "absl/strings/str_replace.h"
 #include "absl/strings/strip.h"
+#include "absl/types/span.h"
 
 namespace {
 
@@ -385,6 +387,37 @@ std::string ParamName(const ::testing::TestParamInfo<Param>& info) {
 INSTANTIATE_TEST_SUITE_P(All, GaussianDistributionTests,
                          ::testing::ValuesIn(GenParams()), ParamName);
 
+TEST(GaussianDistributionTest, FillZTest) {
+  // fill() must produce the same distribution as repeated operator() calls.
+  const double kMean = 2.0;
+  const double kStddev = 3.0;
+  absl::random_internal::pcg64_2018_engine rng(0x2B7E151628AED2A6);
+  absl::gaussian_distribution<double> dis(kMean, kStddev);
+
+  std::vector<double> data(100000, 0.0);
+  dis.fill(rng, absl::MakeSpan(data));
+
+  const auto m = absl::random_internal::ComputeDistributionMoments(data);
+  const double max_err = absl::random_internal::MaxErrorTolerance(0.9999);
+  const double z = absl::random_internal::ZScore(kMean, m);
+  EXPECT_TRUE(absl::random_internal::Near("z", z, 0.0, max_err));
+  EXPECT_NEAR(std::sqrt(m.variance), kStddev, 0.1);
+}
+
+TEST(GaussianDistributionTest, FillVariousSizes) {
+  // Exercise spans around the internal batch size, including the empty span,
+  // through a generator with a bulk generate() method.
+  absl::BitGen gen;
+  absl::gaussian_distribution<float> dis(-1.0f, 0.5f);
+  for (const size_t n : {0u, 1u, 255u, 256u, 257u, 1000u}) {
+    std::vector<float> data(n, std::numeric_limits<float>::quiet_NaN());
+    dis.fill(gen, absl::MakeSpan(data));
+    for (const float v : data) {
+      EXPECT_TRUE(std::isfinite(v));
+    }
+  }
+}
+
 // NOTE: absl::gaussian_distribution is not guaranteed to be stable.
 TEST(GaussianDistributionTest, StabilityTest) {
   // absl::gaussian_distribution stability relies on the underlying zignor
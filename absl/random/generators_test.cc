@@ -15,6 +15,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <random>
+#include <thread>  // NOLINT(build/c++11)
 #include <vector>
 
 #include "gtest/gtest.h"
@@ -183,4 +184,19 @@ TEST(InsecureBitGen, Compatibility) {
   CompatibilityTest<absl::InsecureBitGen>();
 }
 
+TEST(DefaultBitGen, Basic) {
+  // Repeated calls on the same thread return the same generator.
+  absl::BitGen& gen = absl::DefaultBitGen();
+  EXPECT_EQ(&gen, &absl::DefaultBitGen());
+
+  // Each thread gets its own generator.
+  absl::BitGen* other = nullptr;
+  std::thread t([&other] { other = &absl::DefaultBitGen(); });
+  t.join();
+  EXPECT_NE(&gen, other);
+
+  absl::Uniform(absl::DefaultBitGen(), 0, 100);
+  absl::Uniform<uint64_t>(absl::DefaultBitGen());
+}
+
 }  // namespace
@@ -19,8 +19,10 @@
 #include <cstdint>
 #include <limits>
 #include <type_traits>
+#include <utility>
 
 #include "absl/base/config.h"
+#include "absl/base/optimization.h"
 #include "absl/meta/type_traits.h"
 #include "absl/random/internal/traits.h"
 
@@ -264,6 +266,71 @@ FastUniformBits<UIntType>::Generate(URBG& g,  // NOLINT(runtime/references)
   return s;
 }
 
+// Detects whether the URBG provides a bulk generate() method producing
+// values of type T, as randen_engine and its NonsecureURBGBase wrapper do.
+template <typename URBG, typename T, typename = void>
+struct HasBulkGenerate : std::false_type {};
+
+template <typename URBG, typename T>
+struct HasBulkGenerate<URBG, T,
+                       absl::void_t<decltype(std::declval<URBG&>().generate(
+                           std::declval<T*>(), std::declval<T*>()))>>
+    : std::true_type {};
+
+// Fills [begin, end) with uniformly distributed bits in units of T, using the
+// URBG's bulk generate() method when it natively produces values of type T,
+// and FastUniformBits otherwise.
+template <typename URBG, typename T>
+typename absl::enable_if_t<HasBulkGenerate<URBG, T>::value>  //
+FillUniformBits(URBG* urbg, T* begin, T* end) {
+  urbg->generate(begin, end);
+}
+
+template <typename URBG, typename T>
+typename absl::enable_if_t<!HasBulkGenerate<URBG, T>::value>  //
+FillUniformBits(URBG* urbg, T* begin, T* end) {
+  FastUniformBits<T> fast_bits;
+  for (; begin != end; ++begin) {
+    *begin = fast_bits(*urbg);
+  }
+}
+
+// Serves full-range 64-bit words from a block-refilled buffer, itself
+// satisfying the URBG requirements. Distribution batch methods whose
+// algorithms consume a variable number of uniforms per variate run their
+// unmodified per-sample code against this source, amortizing the underlying
+// generator's per-call overhead across each block (refills go through
+// FillUniformBits and thus the generator's bulk generate() when it has one).
+// Up to kBlockSize - 1 words of the final refill go unused.
+template <typename URBG>
+class BufferedBitSource {
+ public:
+  using result_type = uint64_t;
+
+  static constexpr result_type(min)() { return 0; }
+  static constexpr result_type(max)() {
+    return (std::numeric_limits<result_type>::max)();
+  }
+
+  explicit BufferedBitSource(URBG& g)  // NOLINT(runtime/references)
+      : g_(&g) {}
+
+  result_type operator()() {
+    if (ABSL_PREDICT_FALSE(pos_ == kBlockSize)) {
+      FillUniformBits(g_, buffer_, buffer_ + kBlockSize);
+      pos_ = 0;
+    }
+    return buffer_[pos_++];
+  }
+
+ private:
+  static constexpr size_t kBlockSize = 64;
+
+  URBG* g_;
+  size_t pos_ = kBlockSize;
+  result_type buffer_[kBlockSize];
+};
+
 }  // namespace random_internal
 ABSL_NAMESPACE_END
 }  // namespace absl
@@ -125,6 +125,16 @@ class NonsecureURBGBase {
   // NonsecureURBGBase::operator()()
   result_type operator()() { return urbg_(); }
 
+  // NonsecureURBGBase::generate()
+  //
+  // Fills [begin, end) with values from the underlying URBG; available only
+  // when the underlying URBG provides a bulk generate() method.
+  template <typename U = URBG>
+  auto generate(result_type* begin, result_type* end)
+      -> decltype(std::declval<U&>().generate(begin, end)) {
+    return urbg_.generate(begin, end);
+  }
+
   // NonsecureURBGBase::discard()
   void discard(unsigned long long values) {  // NOLINT(runtime/int)
     urbg_.discard(values);
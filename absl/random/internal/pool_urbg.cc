@@ -20,6 +20,10 @@
 #include <cstring>
 #include <iterator>
 
+#ifdef ABSL_HAVE_SCHED_GETCPU
+#include <sched.h>
+#endif
+
 #include "absl/base/attributes.h"
 #include "absl/base/call_once.h"
 #include "absl/base/config.h"
@@ -130,33 +134,56 @@ void RandenPoolEntry::Fill(uint8_t* out, size_t bytes) {
   }
 }
 
-// Number of pooled urbg entries.
-static constexpr size_t kPoolSize = 8;
+// Minimum number of pooled urbg entries; also the number used when the
+// current CPU cannot be queried.
+static constexpr size_t kMinPoolSize = 8;
+
+// Maximum number of pooled urbg entries. Each entry occupies its own
+// cache-line-aligned allocation, so large hosts pay a few extra KiB to
+// avoid cross-core contention.
+static constexpr size_t kMaxPoolSize = 64;
+
+// Number of pool entries in use; a power of two in
+// [kMinPoolSize, kMaxPoolSize], set once by InitPoolURBG.
+static size_t pool_size = kMinPoolSize;
 
 // Shared pool entries.
 static absl::once_flag pool_once;
-ABSL_CACHELINE_ALIGNED static RandenPoolEntry* shared_pools[kPoolSize];
+ABSL_CACHELINE_ALIGNED static RandenPoolEntry* shared_pools[kMaxPoolSize];
 
-// Returns an id in the range [0 ... kPoolSize), which indexes into the
+// Returns an id in the range [0 ... pool_size), which indexes into the
 // pool of random engines.
 //
-// Each thread to access the pool is assigned a sequential ID (without reuse)
-// from the pool-id space; the id is cached in a thread_local variable.
-// This id is assigned based on the arrival-order of the thread to the
-// GetPoolID call; this has no binary, CL, or runtime stability because
+// When sched_getcpu() is available the id tracks the calling CPU, so threads
+// running on distinct cores index distinct pool entries and never contend; a
+// thread migrating between refills may briefly share an entry, which affects
+// only performance, never correctness.
+//
+// Otherwise, each thread to access the pool is assigned a sequential ID
+// (without reuse) from the pool-id space; the id is cached in a thread_local
+// variable. This id is assigned based on the arrival-order of the thread to
+// the GetPoolID call; this has no binary, CL, or runtime stability because
 // on subsequent runs the order within the same program may be significantly
 // different. However, as other thread IDs are not assigned sequentially,
 // this is not expected to matter.
 size_t GetPoolID() {
-  static_assert(kPoolSize >= 1,
+  static_assert(kMinPoolSize >= 1,
                 "At least one urbg instance is required for PoolURBG");
 
+#ifdef ABSL_HAVE_SCHED_GETCPU
+  int cpu = sched_getcpu();
+  if (ABSL_PREDICT_TRUE(cpu >= 0)) {
+    // pool_size is a power of two, so this reduces to a mask.
+    return static_cast<size_t>(cpu) & (pool_size - 1);
+  }
+#endif
+
   ABSL_CONST_INIT static std::atomic<uint64_t> sequence{0};
 
 #ifdef ABSL_HAVE_THREAD_LOCAL
-  static thread_local size_t my_pool_id = kPoolSize;
-  if (ABSL_PREDICT_FALSE(my_pool_id == kPoolSize)) {
-    my_pool_id = (sequence++ % kPoolSize);
+  static thread_local size_t my_pool_id = kMaxPoolSize;
+  if (ABSL_PREDICT_FALSE(my_pool_id == kMaxPoolSize)) {
+    my_pool_id = (sequence++ % pool_size);
   }
   return my_pool_id;
 #else
@@ -175,7 +202,7 @@ size_t GetPoolID() {
       reinterpret_cast<uintptr_t>(pthread_getspecific(tid_key));
   if (ABSL_PREDICT_FALSE(my_pool_id == 0)) {
     // No allocated ID, allocate the next value, cache it, and return.
-    my_pool_id = (sequence++ % kPoolSize) + 1;
+    my_pool_id = (sequence++ % pool_size) + 1;
     int err = pthread_setspecific(tid_key, reinterpret_cast<void*>(my_pool_id));
     if (err) {
       ABSL_RAW_LOG(FATAL, "pthread_setspecific failed with %d", err);
@@ -201,24 +228,37 @@ RandenPoolEntry* PoolAlignedAlloc() {
   return new (aligned) RandenPoolEntry();
 }
 
-// Allocate and initialize kPoolSize objects of type RandenPoolEntry.
-//
-// The initialization strategy is to initialize one object directly from
-// OS entropy, then to use that object to seed all of the individual
-// pool instances.
+// Allocate and initialize pool_size objects of type RandenPoolEntry, seeding
+// each entry from OS entropy.
 void InitPoolURBG() {
   static constexpr size_t kSeedSize =
       RandenTraits::kStateBytes / sizeof(uint32_t);
-  // Read the seed data from OS entropy once.
-  uint32_t seed_material[kPoolSize * kSeedSize];
-  if (!random_internal::ReadSeedMaterialFromOSEntropy(
-          absl::MakeSpan(seed_material))) {
-    random_internal::ThrowSeedGenException();
+
+#ifdef ABSL_HAVE_SCHED_GETCPU
+  // With per-CPU indexing, use roughly one pool entry per CPU, rounded up
+  // to a power of two so that GetPoolID reduces to a mask.
+  const size_t num_cpus = static_cast<size_t>(absl::base_internal::NumCPUs());
+  size_t size = kMinPoolSize;
+  while (size < num_cpus && size < kMaxPoolSize) {
+    size *= 2;
   }
-  for (size_t i = 0; i < kPoolSize; i++) {
-    shared_pools[i] = PoolAlignedAlloc();
-    shared_pools[i]->Init(
-        absl::MakeSpan(&seed_material[i * kSeedSize], kSeedSize));
+  pool_size = size;
+#endif
+
+  // Read the seed data from OS entropy in kMinPoolSize chunks to bound the
+  // stack buffer size.
+  uint32_t seed_material[kMinPoolSize * kSeedSize];
+  for (size_t i = 0; i < pool_size; i += kMinPoolSize) {
+    if (!random_internal::ReadSeedMaterialFromOSEntropy(
+            absl::MakeSpan(seed_material))) {
+      random_internal::ThrowSeedGenException();
+    }
+    const size_t chunk = std::min(kMinPoolSize, pool_size - i);
+    for (size_t j = 0; j < chunk; j++) {
+      shared_pools[i + j] = PoolAlignedAlloc();
+      shared_pools[i + j]->Init(
+          absl::MakeSpan(&seed_material[j * kSeedSize], kSeedSize));
+    }
   }
 }
 
@@ -91,6 +91,27 @@ class alignas(8) randen_engine {
     return little_endian::ToHost(begin[next_++]);
   }
 
+  // Fills [dest_begin, dest_end) with random values, exactly as if by
+  // repeated invocation of operator(). Copying whole blocks out of the
+  // state between refills amortizes the per-call overhead.
+  void generate(result_type* dest_begin, result_type* dest_end) {
+    auto* begin = state();
+    while (dest_begin != dest_end) {
+      if (next_ >= kStateSizeT) {
+        next_ = kCapacityT;
+        impl_.Generate(begin);
+      }
+      const size_t n =
+          std::min(static_cast<size_t>(dest_end - dest_begin),
+                   static_cast<size_t>(kStateSizeT - next_));
+      for (size_t i = 0; i < n; ++i) {
+        dest_begin[i] = little_endian::ToHost(begin[next_ + i]);
+      }
+      next_ += n;
+      dest_begin += n;
+    }
+  }
+
   template <class SeedSequence>
   typename absl::enable_if_t<
       !std::is_convertible<SeedSequence, result_type>::value>
@@ -18,6 +18,7 @@
 #include <bitset>
 #include <random>
 #include <sstream>
+#include <vector>
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
@@ -128,6 +129,31 @@ TYPED_TEST(RandenEngineTypedTest, VerifyDiscard) {
   }
 }
 
+TYPED_TEST(RandenEngineTypedTest, VerifyGenerate) {
+  using randen = typename absl::random_internal::randen_engine<TypeParam>;
+
+  for (size_t num_used = 0; num_used < kTwoBufferValues; ++num_used) {
+    randen engine_used;
+    for (size_t i = 0; i < num_used; ++i) {
+      engine_used();
+    }
+
+    for (size_t count = 0; count < kTwoBufferValues; ++count) {
+      randen engine1 = engine_used;
+      randen engine2 = engine_used;
+      std::vector<TypeParam> buffer(count);
+      engine2.generate(buffer.data(), buffer.data() + buffer.size());
+      for (size_t i = 0; i < count; ++i) {
+        const auto r1 = engine1();
+        ASSERT_EQ(r1, buffer[i]) << "used=" << num_used << " count=" << count;
+      }
+      // Both engines must continue with the same stream.
+      ASSERT_EQ(engine1(), engine2()) << "used=" << num_used
+                                      << " count=" << count;
+    }
+  }
+}
+
 TYPED_TEST(RandenEngineTypedTest, StreamOperatorsResult) {
   using randen = typename absl::random_internal::randen_engine<TypeParam>;
   std::wostringstream os;
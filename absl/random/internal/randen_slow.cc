@@ -37,8 +37,111 @@
 #define ABSL_RANDOM_INTERNAL_ATTRIBUTE_ALWAYS_INLINE
 #endif
 
+// On AArch64 the baseline NEON vector unit (unlike the optional crypto
+// extension required by randen_hwaes.cc) can run the AES round vectorized
+// across each 16-byte block: SubBytes becomes four 64-byte table lookups,
+// and ShiftRows/MixColumns become byte shuffles and shifts.  This recovers
+// much of the hardware path's throughput on cores without the crypto ISA,
+// so use it instead of the scalar table-based round whenever it compiles.
+#if defined(ABSL_ARCH_AARCH64) && defined(__ARM_NEON) && \
+    defined(ABSL_IS_LITTLE_ENDIAN)
+#define ABSL_RANDOM_INTERNAL_RANDEN_SLOW_USE_NEON 1
+#include <arm_neon.h>
+#endif
+
 namespace {
 
+#if defined(ABSL_RANDOM_INTERNAL_RANDEN_SLOW_USE_NEON)
+
+// The AES S-box, as extracted from the first byte lane of the te0 table
+// used by the scalar implementation below ((te0[x] >> 8) & 0xff).
+alignas(16) constexpr uint8_t kAesSbox[256] = {
+    0x63, 0x7c, 0x77, 0x7b, 0xf2, 0x6b, 0x6f, 0xc5, 0x30, 0x01, 0x67, 0x2b,
+    0xfe, 0xd7, 0xab, 0x76, 0xca, 0x82, 0xc9, 0x7d, 0xfa, 0x59, 0x47, 0xf0,
+    0xad, 0xd4, 0xa2, 0xaf, 0x9c, 0xa4, 0x72, 0xc0, 0xb7, 0xfd, 0x93, 0x26,
+    0x36, 0x3f, 0xf7, 0xcc, 0x34, 0xa5, 0xe5, 0xf1, 0x71, 0xd8, 0x31, 0x15,
+    0x04, 0xc7, 0x23, 0xc3, 0x18, 0x96, 0x05, 0x9a, 0x07, 0x12, 0x80, 0xe2,
+    0xeb, 0x27, 0xb2, 0x75, 0x09, 0x83, 0x2c, 0x1a, 0x1b, 0x6e, 0x5a, 0xa0,
+    0x52, 0x3b, 0xd6, 0xb3, 0x29, 0xe3, 0x2f, 0x84, 0x53, 0xd1, 0x00, 0xed,
+    0x20, 0xfc, 0xb1, 0x5b, 0x6a, 0xcb, 0xbe, 0x39, 0x4a, 0x4c, 0x58, 0xcf,
+    0xd0, 0xef, 0xaa, 0xfb, 0x43, 0x4d, 0x33, 0x85, 0x45, 0xf9, 0x02, 0x7f,
+    0x50, 0x3c, 0x9f, 0xa8, 0x51, 0xa3, 0x40, 0x8f, 0x92, 0x9d, 0x38, 0xf5,
+    0xbc, 0xb6, 0xda, 0x21, 0x10, 0xff, 0xf3, 0xd2, 0xcd, 0x0c, 0x13, 0xec,
+    0x5f, 0x97, 0x44, 0x17, 0xc4, 0xa7, 0x7e, 0x3d, 0x64, 0x5d, 0x19, 0x73,
+    0x60, 0x81, 0x4f, 0xdc, 0x22, 0x2a, 0x90, 0x88, 0x46, 0xee, 0xb8, 0x14,
+    0xde, 0x5e, 0x0b, 0xdb, 0xe0, 0x32, 0x3a, 0x0a, 0x49, 0x06, 0x24, 0x5c,
+    0xc2, 0xd3, 0xac, 0x62, 0x91, 0x95, 0xe4, 0x79, 0xe7, 0xc8, 0x37, 0x6d,
+    0x8d, 0xd5, 0x4e, 0xa9, 0x6c, 0x56, 0xf4, 0xea, 0x65, 0x7a, 0xae, 0x08,
+    0xba, 0x78, 0x25, 0x2e, 0x1c, 0xa6, 0xb4, 0xc6, 0xe8, 0xdd, 0x74, 0x1f,
+    0x4b, 0xbd, 0x8b, 0x8a, 0x70, 0x3e, 0xb5, 0x66, 0x48, 0x03, 0xf6, 0x0e,
+    0x61, 0x35, 0x57, 0xb9, 0x86, 0xc1, 0x1d, 0x9e, 0xe1, 0xf8, 0x98, 0x11,
+    0x69, 0xd9, 0x8e, 0x94, 0x9b, 0x1e, 0x87, 0xe9, 0xce, 0x55, 0x28, 0xdf,
+    0x8c, 0xa1, 0x89, 0x0d, 0xbf, 0xe6, 0x42, 0x68, 0x41, 0x99, 0x2d, 0x0f,
+    0xb0, 0x54, 0xbb, 0x16,
+};
+
+// NEON implementation of the Vector128 class, treating each Randen block as
+// sixteen byte lanes.
+using Vector128 = uint8x16_t;
+
+inline ABSL_RANDOM_INTERNAL_ATTRIBUTE_ALWAYS_INLINE Vector128
+Vector128Load(const void* from) {
+  return vld1q_u8(reinterpret_cast<const uint8_t*>(from));
+}
+
+inline ABSL_RANDOM_INTERNAL_ATTRIBUTE_ALWAYS_INLINE void Vector128Store(
+    const Vector128& v, void* to) {
+  vst1q_u8(reinterpret_cast<uint8_t*>(to), v);
+}
+
+// One round of AES. "round_key" is a public constant for breaking the
+// symmetry of AES (ensures previously equal columns differ afterwards).
+//
+// Computes the same function as the scalar table-based round below.
+// SubBytes covers the 256-byte S-box with four 64-byte vqtbl4q lookups:
+// out-of-range indices yield zero, so decrementing the index vector by 64
+// between lookups selects each quarter of the table in turn.  ShiftRows and
+// the byte rotations of MixColumns are vqtbl1q shuffles, and the GF(2^8)
+// doubling is a left shift plus a conditional reduction by 0x1b.
+inline ABSL_RANDOM_INTERNAL_ATTRIBUTE_ALWAYS_INLINE Vector128
+AesRound(const Vector128& state, const Vector128& round_key) {
+  alignas(16) static constexpr uint8_t kShiftRows[16] = {
+      0, 5, 10, 15, 4, 9, 14, 3, 8, 13, 2, 7, 12, 1, 6, 11};
+  alignas(16) static constexpr uint8_t kRotateRows[16] = {
+      1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15, 12};
+
+  uint8x16_t sub = vdupq_n_u8(0);
+  uint8x16_t index = state;
+  for (int i = 0; i < 256; i += 64) {
+    const uint8x16x4_t quarter = {{
+        vld1q_u8(kAesSbox + i),
+        vld1q_u8(kAesSbox + i + 16),
+        vld1q_u8(kAesSbox + i + 32),
+        vld1q_u8(kAesSbox + i + 48),
+    }};
+    sub = veorq_u8(sub, vqtbl4q_u8(quarter, index));
+    index = vsubq_u8(index, vdupq_n_u8(64));
+  }
+
+  const uint8x16_t a = vqtbl1q_u8(sub, vld1q_u8(kShiftRows));
+
+  // MixColumns: with rotN() rotating each column by N bytes,
+  //   b = xtime(a ^ rot1(a)) ^ rot1(a) ^ rot2(a) ^ rot3(a).
+  const uint8x16_t rotate = vld1q_u8(kRotateRows);
+  const uint8x16_t rot1 = vqtbl1q_u8(a, rotate);
+  const uint8x16_t rot2 = vqtbl1q_u8(rot1, rotate);
+  const uint8x16_t rot3 = vqtbl1q_u8(rot2, rotate);
+  const uint8x16_t t = veorq_u8(a, rot1);
+  const uint8x16_t xt = veorq_u8(
+      vshlq_n_u8(t, 1),
+      vandq_u8(vdupq_n_u8(0x1b),
+               vreinterpretq_u8_s8(vshrq_n_s8(vreinterpretq_s8_u8(t), 7))));
+  return veorq_u8(veorq_u8(xt, rot1),
+                  veorq_u8(veorq_u8(rot2, rot3), round_key));
+}
+
+#else  // ABSL_RANDOM_INTERNAL_RANDEN_SLOW_USE_NEON
+
 // AES portions based on rijndael-alg-fst.c,
 // https://fastcrypto.org/front/misc/rijndael-alg-fst.c, and modified for
 // platform-endianness.
@@ -298,6 +401,8 @@ AesRound(const Vector128& state, const Vector128& round_key) {
   return result;
 }
 
+#endif  // ABSL_RANDOM_INTERNAL_RANDEN_SLOW_USE_NEON
+
 using ::absl::random_internal::RandenTraits;
 
 // The improved Feistel block shuffle function for 16 blocks.
@@ -62,6 +62,12 @@ struct IntervalOpenOpenTag
 
 namespace random_internal {
 
+// Detects whether `T` is one of the interval tag types. Used to constrain
+// overload sets which accept an interval tag as their first argument.
+template <typename T>
+using IsIntervalTag =
+    std::is_base_of<TagTypeCompare<absl::decay_t<T>>, absl::decay_t<T>>;
+
 // In the absence of an explicitly provided return-type, the template
 // "uniform_inferred_return_t<A, B>" is used to derive a suitable type, based on
 // the data-types of the endpoint-arguments {A lo, B hi}.
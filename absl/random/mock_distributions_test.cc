@@ -16,6 +16,7 @@
 
 #include <cmath>
 #include <limits>
+#include <vector>
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
@@ -23,6 +24,7 @@
 #include "absl/random/distributions.h"
 #include "absl/random/mocking_bit_gen.h"
 #include "absl/random/random.h"
+#include "absl/types/span.h"
 
 namespace {
 using ::testing::Return;
@@ -75,6 +77,30 @@ TEST(MockDistributions, Examples) {
   EXPECT_EQ(absl::LogUniform<int>(gen, 0, 1000000, 2), 2040);
 }
 
+TEST(MockDistributions, UniformSpanInvokesMockPerElement) {
+  absl::MockingBitGen gen;
+
+  std::vector<int> values(5, 0);
+  EXPECT_CALL(absl::MockUniform<int>(), Call(gen, 1, 1000000))
+      .Times(5)
+      .WillRepeatedly(Return(20));
+  absl::Uniform(gen, absl::MakeSpan(values), 1, 1000000);
+  for (const int v : values) {
+    EXPECT_EQ(v, 20);
+  }
+
+  std::vector<double> doubles(3, 0.0);
+  EXPECT_CALL(absl::MockUniform<double>(),
+              Call(absl::IntervalClosedClosed, gen, 0.0, 1.0))
+      .Times(3)
+      .WillRepeatedly(Return(0.5));
+  absl::Uniform(absl::IntervalClosedClosed, gen, absl::MakeSpan(doubles), 0.0,
+                1.0);
+  for (const double v : doubles) {
+    EXPECT_EQ(v, 0.5);
+  }
+}
+
 TEST(MockUniform, OutOfBoundsIsAllowed) {
   absl::UnvalidatedMockingBitGen gen;
 
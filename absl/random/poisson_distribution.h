@@ -27,6 +27,7 @@
 #include "absl/random/internal/generate_real.h"
 #include "absl/random/internal/iostream_state_saver.h"
 #include "absl/random/internal/traits.h"
+#include "absl/types/span.h"
 
 namespace absl {
 ABSL_NAMESPACE_BEGIN
@@ -104,6 +105,26 @@ class poisson_distribution {
   result_type operator()(URBG& g,  // NOLINT(runtime/references)
                          const param_type& p);
 
+  // Fills `out` with variates as if by repeated calls to `operator()`.
+  // Both algorithms consume a variable number of uniforms per variate, so
+  // the words are served from a block-refilled buffer, amortizing the
+  // generator's per-call overhead (and using its bulk API when available)
+  // across the whole span.
+  template <typename URBG>
+  void fill(URBG& g,  // NOLINT(runtime/references)
+            absl::Span<result_type> out) {
+    fill(g, param_, out);
+  }
+
+  template <typename URBG>
+  void fill(URBG& g,  // NOLINT(runtime/references)
+            const param_type& p, absl::Span<result_type> out) {
+    random_internal::BufferedBitSource<URBG> source(g);
+    for (result_type& v : out) {
+      v = (*this)(source, p);
+    }
+  }
+
   param_type param() const { return param_; }
   void param(const param_type& p) { param_ = p; }
 
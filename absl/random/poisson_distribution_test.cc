@@ -15,6 +15,7 @@
 #include "absl/random/poisson_distribution.h"
 
 #include <algorithm>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <iterator>
@@ -37,6 +38,7 @@
 #include "absl/strings/str_format.h"
 #include "absl/strings/str_replace.h"
 #include "absl/strings/strip.h"
+#include "absl/types/span.h"
 
 // Notes about generating poisson variates:
 //
@@ -542,6 +544,32 @@ TEST(PoissonDistributionTest, StabilityTest) {
               ElementsAre(161, 122, 129, 124, 112, 112, 117, 120, 130, 114));
 }
 
+TEST(PoissonDistributionTest, FillMatchesDistribution) {
+  // We use a fixed bit generator for distribution accuracy tests.  This allows
+  // these tests to be deterministic, while still testing the quality of the
+  // implementation.
+  absl::random_internal::pcg64_2018_engine rng(0x2B7E151628AED2A6);
+
+  // One mean per algorithm: Knuth, split-Knuth, and ratio of uniforms.
+  for (const double mean : {5.0, 25.0, 100.0}) {
+    absl::poisson_distribution<int> dist(mean);
+    std::vector<int> data(20000);
+    dist.fill(rng, absl::MakeSpan(data));
+
+    double sum = 0;
+    for (const auto x : data) {
+      ASSERT_GE(x, 0);
+      sum += x;
+    }
+    // A Poisson's variance equals its mean; allow ~7 standard errors.
+    EXPECT_NEAR(sum / static_cast<double>(data.size()), mean,
+                7.0 * std::sqrt(mean / static_cast<double>(data.size())));
+  }
+
+  absl::poisson_distribution<int> dist(1.0);
+  dist.fill(rng, absl::Span<int>());  // empty spans are valid
+}
+
 TEST(PoissonDistributionTest, AlgorithmExpectedValue_1) {
   // This tests small values of the Knuth method.
   // The underlying uniform distribution will generate exactly 0.5.
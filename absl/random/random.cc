@@ -0,0 +1,63 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/random/random.h"
+
+#include "absl/base/config.h"
+
+#ifndef ABSL_HAVE_THREAD_LOCAL
+#include <pthread.h>
+
+#include "absl/base/internal/raw_logging.h"
+#include "absl/base/optimization.h"
+#endif
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+#ifdef ABSL_HAVE_THREAD_LOCAL
+
+BitGen& DefaultBitGen() {
+  thread_local BitGen bit_gen;
+  return bit_gen;
+}
+
+#else  // ABSL_HAVE_THREAD_LOCAL
+
+BitGen& DefaultBitGen() {
+  static pthread_key_t key = [] {
+    pthread_key_t tmp_key;
+    int err = pthread_key_create(
+        &tmp_key, [](void* v) { delete static_cast<BitGen*>(v); });
+    if (err) {
+      ABSL_RAW_LOG(FATAL, "pthread_key_create failed with %d", err);
+    }
+    return tmp_key;
+  }();
+
+  auto* bit_gen = static_cast<BitGen*>(pthread_getspecific(key));
+  if (ABSL_PREDICT_FALSE(bit_gen == nullptr)) {
+    bit_gen = new BitGen;
+    int err = pthread_setspecific(key, bit_gen);
+    if (err) {
+      ABSL_RAW_LOG(FATAL, "pthread_setspecific failed with %d", err);
+    }
+  }
+  return *bit_gen;
+}
+
+#endif  // ABSL_HAVE_THREAD_LOCAL
+
+ABSL_NAMESPACE_END
+}  // namespace absl
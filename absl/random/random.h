@@ -183,6 +183,30 @@ using InsecureBitGen =
 // discards the intermediate results.
 // ---------------------------------------------------------------------------
 
+// -----------------------------------------------------------------------------
+// absl::DefaultBitGen()
+// -----------------------------------------------------------------------------
+//
+// Returns a reference to a lazily-constructed thread-local `absl::BitGen`.
+//
+// Constructing an `absl::BitGen` is not free (each instance seeds its Randen
+// state from the shared entropy pool), so code which needs random values only
+// occasionally should prefer this accessor over constructing a generator per
+// call, or over sharing a single instance between threads under a mutex. Each
+// thread gets its own generator, so calls never contend.
+//
+// Example:
+//
+//   // Generate an integer value in the closed interval [1,6]
+//   int die_roll = absl::Uniform(absl::IntervalClosed, absl::DefaultBitGen(),
+//                                1, 6);
+//
+// The returned reference must only be used on the calling thread; call
+// `absl::DefaultBitGen()` again from each thread that needs a generator. Like
+// `absl::BitGen` itself, the returned generator is not suitable for
+// security-related use-cases and provides no seed stability.
+BitGen& DefaultBitGen();
+
 ABSL_NAMESPACE_END
 }  // namespace absl
 
@@ -31,6 +31,7 @@
 #include "absl/random/internal/sequence_urbg.h"
 #include "absl/random/random.h"
 #include "absl/strings/str_cat.h"
+#include "absl/types/span.h"
 
 namespace {
 
@@ -214,6 +215,68 @@ TYPED_TEST(UniformIntDistributionTest, ChiSquaredTest50) {
   }
 }
 
+TYPED_TEST(UniformIntDistributionTest, FillChiSquaredTest50) {
+  using absl::random_internal::kChiSquared;
+
+  constexpr size_t kTrials = 1000;
+  constexpr int kBuckets = 50;  // inclusive, so actually +1
+  constexpr double kExpected =
+      static_cast<double>(kTrials) / static_cast<double>(kBuckets);
+
+  const int kThreshold =
+      absl::random_internal::ChiSquareValue(kBuckets, 0.999999);
+
+  const TypeParam min = std::is_unsigned<TypeParam>::value ? 37 : -37;
+  const TypeParam max = min + kBuckets;
+
+  // We use a fixed bit generator for distribution accuracy tests.  This allows
+  // these tests to be deterministic, while still testing the quality of the
+  // implementation.
+  absl::random_internal::pcg64_2018_engine rng{0x2B7E151628AED2A6};
+
+  absl::uniform_int_distribution<TypeParam> dist(min, max);
+
+  // Sizes straddling the internal batch size exercise the chunking logic.
+  std::vector<TypeParam> data(kTrials, 0);
+  dist.fill(rng, absl::MakeSpan(data));
+
+  std::vector<int32_t> counts(kBuckets + 1, 0);
+  for (const auto x : data) {
+    ASSERT_GE(x, min);
+    ASSERT_LE(x, max);
+    counts[x - min]++;
+  }
+  double chi_square = absl::random_internal::ChiSquareWithExpected(
+      std::begin(counts), std::end(counts), kExpected);
+  if (chi_square > kThreshold) {
+    double p_value =
+        absl::random_internal::ChiSquarePValue(chi_square, kBuckets);
+    FAIL() << kChiSquared << " value: " << chi_square << " > " << kThreshold
+           << "; p-value " << p_value;
+  }
+}
+
+TYPED_TEST(UniformIntDistributionTest, FillPowerOfTwoAndEmptyRanges) {
+  absl::BitGen gen;  // Exercises the bulk bit-generation path.
+
+  // Power-of-two range, masked rather than multiply-rejected.
+  absl::uniform_int_distribution<TypeParam> pow2(0, 63);
+  std::vector<TypeParam> data(300, 0);
+  pow2.fill(gen, absl::MakeSpan(data));
+  for (const auto x : data) {
+    EXPECT_GE(x, 0);
+    EXPECT_LE(x, 63);
+  }
+
+  // Single-value and empty spans.
+  absl::uniform_int_distribution<TypeParam> one(5, 5);
+  one.fill(gen, absl::MakeSpan(data));
+  for (const auto x : data) {
+    EXPECT_EQ(x, 5);
+  }
+  one.fill(gen, absl::Span<TypeParam>());
+}
+
 TEST(UniformIntDistributionTest, StabilityTest) {
   // absl::uniform_int_distribution stability relies only on integer operations.
   absl::random_internal::sequence_urbg urbg(
@@ -33,6 +33,7 @@
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_replace.h"
 #include "absl/strings/strip.h"
+#include "absl/types/span.h"
 
 namespace {
 
@@ -374,6 +375,40 @@ TEST(ZipfDistributionTest, StabilityTest) {
   }
 }
 
+TEST(ZipfDistributionTest, FillMatchesDistribution) {
+  // We use a fixed bit generator for distribution accuracy tests.  This allows
+  // these tests to be deterministic, while still testing the quality of the
+  // implementation.
+  absl::random_internal::pcg64_2018_engine rng(0x2B7E151628AED2A6);
+
+  absl::zipf_distribution<int32_t> dist(100, 2.0, 1.0);
+
+  // Large enough to span several internal batches.
+  std::vector<int32_t> data(100000);
+  dist.fill(rng, absl::MakeSpan(data));
+
+  // Expected mean of P(x) ~ (1 + x)^-2 over [0, 100].
+  double norm = 0;
+  double expected_mean = 0;
+  for (int x = 0; x <= 100; ++x) {
+    const double p = 1.0 / ((1.0 + x) * (1.0 + x));
+    norm += p;
+    expected_mean += x * p;
+  }
+  expected_mean /= norm;
+
+  double sum = 0;
+  for (const auto x : data) {
+    ASSERT_GE(x, 0);
+    ASSERT_LE(x, 100);
+    sum += x;
+  }
+  // The standard error of the mean here is ~0.023, so 0.15 is > 6 sigma.
+  EXPECT_NEAR(sum / static_cast<double>(data.size()), expected_mean, 0.15);
+
+  dist.fill(rng, absl::Span<int32_t>());  // empty spans are valid
+}
+
 TEST(ZipfDistributionTest, AlgorithmBounds) {
   absl::zipf_distribution<int32_t> dist;
 
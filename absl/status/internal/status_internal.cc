@@ -45,6 +45,56 @@ namespace absl {
 ABSL_NAMESPACE_BEGIN
 namespace status_internal {
 
+namespace {
+
+#ifdef ABSL_HAVE_THREAD_LOCAL
+// Per-thread freelist of StatusRep storage blocks. A few entries suffice to
+// absorb the construct/destroy churn of transient error statuses; anything
+// beyond that falls through to the global allocator. Blocks are plain
+// ::operator new storage, so a block released on a different thread than the
+// one that allocated it is safe to reuse or free there.
+constexpr size_t kStatusRepCacheBlocks = 8;
+
+struct StatusRepCache {
+  void* blocks[kStatusRepCacheBlocks];
+  size_t size = 0;
+
+  ~StatusRepCache() {
+    while (size > 0) ::operator delete(blocks[--size]);
+  }
+};
+
+StatusRepCache& GetStatusRepCache() {
+  thread_local StatusRepCache cache;
+  return cache;
+}
+#endif  // ABSL_HAVE_THREAD_LOCAL
+
+}  // namespace
+
+void* StatusRep::operator new(size_t size) {
+#ifdef ABSL_HAVE_THREAD_LOCAL
+  if (size == sizeof(StatusRep)) {
+    StatusRepCache& cache = GetStatusRepCache();
+    if (cache.size > 0) return cache.blocks[--cache.size];
+  }
+#endif
+  return ::operator new(size);
+}
+
+void StatusRep::operator delete(void* p, size_t size) {
+#ifdef ABSL_HAVE_THREAD_LOCAL
+  if (size == sizeof(StatusRep)) {
+    StatusRepCache& cache = GetStatusRepCache();
+    if (cache.size < kStatusRepCacheBlocks) {
+      cache.blocks[cache.size++] = p;
+      return;
+    }
+  }
+#endif
+  ::operator delete(p);
+}
+
 void StatusRep::Unref() const {
   // Fast path: if ref==1, there is no need for a RefCountDec (since
   // this is the only reference and therefore no other thread is
@@ -66,8 +116,14 @@ static absl::optional<size_t> FindPayloadIndexByUrl(
   return absl::nullopt;
 }
 
+absl::Cord StatusRep::InlinePayload() const {
+  return absl::Cord(absl::string_view(inline_payload_, inline_payload_size_));
+}
+
 absl::optional<absl::Cord> StatusRep::GetPayload(
     absl::string_view type_url) const {
+  if (InlinePayloadMatches(type_url)) return InlinePayload();
+
   absl::optional<size_t> index =
       status_internal::FindPayloadIndexByUrl(payloads_.get(), type_url);
   if (index.has_value()) return (*payloads_)[index.value()].payload;
@@ -76,6 +132,32 @@ absl::optional<absl::Cord> StatusRep::GetPayload(
 }
 
 void StatusRep::SetPayload(absl::string_view type_url, absl::Cord payload) {
+  if (InlinePayloadMatches(type_url)) {
+    if (payload.size() <= kInlinePayloadCapacity) {
+      char* dst = inline_payload_;
+      for (absl::string_view chunk : payload.Chunks()) {
+        std::memcpy(dst, chunk.data(), chunk.size());
+        dst += chunk.size();
+      }
+      inline_payload_size_ = static_cast<uint8_t>(payload.size());
+      return;
+    }
+    // The new value no longer fits inline; spill it below.
+    has_inline_payload_ = false;
+    inline_payload_type_url_.clear();
+  } else if (!has_inline_payload_ && payloads_ == nullptr &&
+             payload.size() <= kInlinePayloadCapacity) {
+    inline_payload_type_url_.assign(type_url.data(), type_url.size());
+    char* dst = inline_payload_;
+    for (absl::string_view chunk : payload.Chunks()) {
+      std::memcpy(dst, chunk.data(), chunk.size());
+      dst += chunk.size();
+    }
+    inline_payload_size_ = static_cast<uint8_t>(payload.size());
+    has_inline_payload_ = true;
+    return;
+  }
+
   if (payloads_ == nullptr) {
     payloads_ = absl::make_unique<status_internal::Payloads>();
   }
@@ -91,11 +173,17 @@ void StatusRep::SetPayload(absl::string_view type_url, absl::Cord payload) {
 }
 
 StatusRep::EraseResult StatusRep::ErasePayload(absl::string_view type_url) {
-  absl::optional<size_t> index =
-      status_internal::FindPayloadIndexByUrl(payloads_.get(), type_url);
-  if (!index.has_value()) return {false, Status::PointerToRep(this)};
-  payloads_->erase(payloads_->begin() + index.value());
-  if (payloads_->empty() && message_.empty()) {
+  if (InlinePayloadMatches(type_url)) {
+    has_inline_payload_ = false;
+    inline_payload_type_url_.clear();
+  } else {
+    absl::optional<size_t> index =
+        status_internal::FindPayloadIndexByUrl(payloads_.get(), type_url);
+    if (!index.has_value()) return {false, Status::PointerToRep(this)};
+    payloads_->erase(payloads_->begin() + index.value());
+  }
+  if (!has_inline_payload_ && (payloads_ == nullptr || payloads_->empty()) &&
+      message_.empty()) {
     // Special case: If this can be represented inlined, it MUST be inlined
     // (== depends on this behavior).
     EraseResult result = {true, Status::CodeToInlinedRep(code_)};
@@ -108,6 +196,18 @@ StatusRep::EraseResult StatusRep::ErasePayload(absl::string_view type_url) {
 void StatusRep::ForEachPayload(
     absl::FunctionRef<void(absl::string_view, const absl::Cord&)> visitor)
     const {
+  if (has_inline_payload_) {
+    const absl::Cord payload = InlinePayload();
+#ifdef NDEBUG
+    visitor(inline_payload_type_url_, payload);
+#else
+    // In debug mode invalidate the type url to prevent users from relying on
+    // this string lifetime.
+
+    // NOLINTNEXTLINE intentional extra conversion to force temporary.
+    visitor(std::string(inline_payload_type_url_), payload);
+#endif  // NDEBUG
+  }
   if (auto* payloads = payloads_.get()) {
     bool in_reverse =
         payloads->size() > 1 && reinterpret_cast<uintptr_t>(payloads) % 13 > 6;
@@ -157,35 +257,22 @@ bool StatusRep::operator==(const StatusRep& other) const {
   assert(this != &other);
   if (code_ != other.code_) return false;
   if (message_ != other.message_) return false;
-  const status_internal::Payloads* this_payloads = payloads_.get();
-  const status_internal::Payloads* other_payloads = other.payloads_.get();
-
-  const status_internal::Payloads no_payloads;
-  const status_internal::Payloads* larger_payloads =
-      this_payloads ? this_payloads : &no_payloads;
-  const status_internal::Payloads* smaller_payloads =
-      other_payloads ? other_payloads : &no_payloads;
-  if (larger_payloads->size() < smaller_payloads->size()) {
-    std::swap(larger_payloads, smaller_payloads);
-  }
-  if ((larger_payloads->size() - smaller_payloads->size()) > 1) return false;
-  // Payloads can be ordered differently, so we can't just compare payload
-  // vectors.
-  for (const auto& payload : *larger_payloads) {
-
-    bool found = false;
-    for (const auto& other_payload : *smaller_payloads) {
-      if (payload.type_url == other_payload.type_url) {
-        if (payload.payload != other_payload.payload) {
-          return false;
-        }
-        found = true;
-        break;
-      }
-    }
-    if (!found) return false;
-  }
-  return true;
+  // The same payloads may be split between inline and spilled storage
+  // differently in the two reps, so compare them as unordered sets keyed by
+  // type url.
+  const size_t this_size = (has_inline_payload_ ? 1 : 0) +
+                           (payloads_ == nullptr ? 0 : payloads_->size());
+  const size_t other_size =
+      (other.has_inline_payload_ ? 1 : 0) +
+      (other.payloads_ == nullptr ? 0 : other.payloads_->size());
+  if (this_size != other_size) return false;
+  bool equal = true;
+  ForEachPayload([&](absl::string_view type_url, const absl::Cord& payload) {
+    if (!equal) return;
+    absl::optional<absl::Cord> other_payload = other.GetPayload(type_url);
+    if (!other_payload.has_value() || *other_payload != payload) equal = false;
+  });
+  return equal;
 }
 
 absl::Nonnull<StatusRep*> StatusRep::CloneAndUnref() const {
@@ -203,6 +290,13 @@ absl::Nonnull<StatusRep*> StatusRep::CloneAndUnref() const {
     payloads = absl::make_unique<status_internal::Payloads>(*payloads_);
   }
   auto* new_rep = new StatusRep(code_, message_, std::move(payloads));
+  if (has_inline_payload_) {
+    new_rep->has_inline_payload_ = true;
+    new_rep->inline_payload_size_ = inline_payload_size_;
+    std::memcpy(new_rep->inline_payload_, inline_payload_,
+                inline_payload_size_);
+    new_rep->inline_payload_type_url_ = inline_payload_type_url_;
+  }
   Unref();
   return new_rep;
 }
@@ -15,6 +15,7 @@
 #define ABSL_STATUS_INTERNAL_STATUS_INTERNAL_H_
 
 #include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <string>
@@ -88,6 +89,9 @@ class StatusRep {
     uintptr_t new_rep;
   };
   EraseResult ErasePayload(absl::string_view type_url);
+  bool HasPayloads() const {
+    return has_inline_payload_ || (payloads_ != nullptr && !payloads_->empty());
+  }
   void ForEachPayload(
       absl::FunctionRef<void(absl::string_view, const absl::Cord&)> visitor)
       const;
@@ -102,14 +106,37 @@ class StatusRep {
   // `this` is not safe to be used after calling as it may have been deleted.
   absl::Nonnull<StatusRep*> CloneAndUnref() const;
 
+  // Reps are created and destroyed at a high rate in error-heavy services, so
+  // their storage is recycled through a small thread-local freelist instead of
+  // hitting the allocator on every non-OK status.
+  static void* operator new(size_t size);
+  static void operator delete(void* p, size_t size);
+
  private:
+  // Inline storage for the common case of a status carrying one payload with a
+  // small value (e.g. a compact error-detail struct). The first payload whose
+  // value fits is stored in `inline_payload_`; anything else spills to
+  // `payloads_`. Attaching a small payload thus needs no allocation beyond the
+  // rep itself, except for the type URL's string storage when it exceeds the
+  // small-string capacity.
+  static constexpr size_t kInlinePayloadCapacity = 24;
+
+  bool InlinePayloadMatches(absl::string_view type_url) const {
+    return has_inline_payload_ && inline_payload_type_url_ == type_url;
+  }
+  absl::Cord InlinePayload() const;
+
   mutable std::atomic<int32_t> ref_;
   absl::StatusCode code_;
+  bool has_inline_payload_ = false;
+  uint8_t inline_payload_size_ = 0;
+  char inline_payload_[kInlinePayloadCapacity];
 
   // As an internal implementation detail, we guarantee that if status.message()
   // is non-empty, then the resulting string_view is null terminated.
   // This is required to implement 'StatusMessageAsCStr(...)'
   std::string message_;
+  std::string inline_payload_type_url_;
   std::unique_ptr<status_internal::Payloads> payloads_;
 };
 
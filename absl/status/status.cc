@@ -118,6 +118,10 @@ absl::Nonnull<status_internal::StatusRep*> Status::PrepareToModify(
     return new status_internal::StatusRep(InlinedRepToCode(rep),
                                           absl::string_view(), nullptr);
   }
+  if (IsStatic(rep)) {
+    const StaticStatusData* data = RepToStaticData(rep);
+    return new status_internal::StatusRep(data->code, data->message, nullptr);
+  }
   return RepToPointer(rep)->CloneAndUnref();
 }
 
@@ -125,9 +129,42 @@ std::string Status::ToStringSlow(uintptr_t rep, StatusToStringMode mode) {
   if (IsInlined(rep)) {
     return absl::StrCat(absl::StatusCodeToString(InlinedRepToCode(rep)), ": ");
   }
+  if (IsStatic(rep)) {
+    const StaticStatusData* data = RepToStaticData(rep);
+    return absl::StrCat(absl::StatusCodeToString(data->code), ": ",
+                        data->message);
+  }
   return RepToPointer(rep)->ToString(mode);
 }
 
+bool Status::EqualsStaticSlow(uintptr_t lhs_rep, uintptr_t rhs_rep) {
+  absl::StatusCode lhs_code, rhs_code;
+  absl::string_view lhs_message, rhs_message;
+  // A static representation never carries payloads, so a heap representation
+  // with any payload cannot compare equal to it.
+  if (IsStatic(lhs_rep)) {
+    const StaticStatusData* data = RepToStaticData(lhs_rep);
+    lhs_code = data->code;
+    lhs_message = data->message;
+  } else {
+    const status_internal::StatusRep* rep = RepToPointer(lhs_rep);
+    if (rep->HasPayloads()) return false;
+    lhs_code = rep->code();
+    lhs_message = rep->message();
+  }
+  if (IsStatic(rhs_rep)) {
+    const StaticStatusData* data = RepToStaticData(rhs_rep);
+    rhs_code = data->code;
+    rhs_message = data->message;
+  } else {
+    const status_internal::StatusRep* rep = RepToPointer(rhs_rep);
+    if (rep->HasPayloads()) return false;
+    rhs_code = rep->code();
+    rhs_message = rep->message();
+  }
+  return lhs_code == rhs_code && lhs_message == rhs_message;
+}
+
 std::ostream& operator<<(std::ostream& os, const Status& x) {
   os << x.ToString(StatusToStringMode::kWithEverything);
   return os;
@@ -342,6 +342,23 @@ inline StatusToStringMode& operator^=(StatusToStringMode& lhs,
   return lhs;
 }
 
+// absl::StaticStatusData
+//
+// `absl::StaticStatusData` is the backing storage for a status created with
+// `absl::MakeStaticStatus()`. Instances must have static storage duration and
+// must outlive every status constructed from them; `message` must refer to a
+// null-terminated string (typically a string literal) and `code` must not be
+// `absl::StatusCode::kOk`.
+//
+// The struct is an aggregate so that it can be constant-initialized:
+//
+//   ABSL_CONST_INIT static const absl::StaticStatusData kQueueFull = {
+//       absl::StatusCode::kResourceExhausted, "queue full"};
+struct alignas(4) StaticStatusData {
+  absl::StatusCode code;
+  absl::string_view message;
+};
+
 // absl::Status
 //
 // The `absl::Status` class is generally used to gracefully handle errors
@@ -610,6 +627,7 @@ class ABSL_ATTRIBUTE_TRIVIAL_ABI Status final {
 
  private:
   friend Status CancelledError();
+  friend Status MakeStaticStatus(const StaticStatusData& data);
 
   // Creates a status in the canonical error space with the specified
   // code, and an empty error message.
@@ -637,6 +655,10 @@ class ABSL_ATTRIBUTE_TRIVIAL_ABI Status final {
   // See rep_ for details.
   static constexpr bool IsInlined(uintptr_t rep);
 
+  // Returns whether rep points at immortal `StaticStatusData`. See rep_ for
+  // details.
+  static constexpr bool IsStatic(uintptr_t rep);
+
   // Indicates whether this Status was the rhs of a move operation. See rep_
   // for details.
   static constexpr bool IsMovedFrom(uintptr_t rep);
@@ -653,14 +675,26 @@ class ABSL_ATTRIBUTE_TRIVIAL_ABI Status final {
   static absl::Nonnull<const status_internal::StatusRep*> RepToPointer(
       uintptr_t r);
 
+  // Converts a static representation back to the StaticStatusData it points
+  // at. See rep_ for details.
+  static absl::Nonnull<const StaticStatusData*> RepToStaticData(uintptr_t rep);
+
   static std::string ToStringSlow(uintptr_t rep, StatusToStringMode mode);
 
-  // Status supports two different representations.
+  // Compares two non-inlined representations, at least one of which is
+  // static. See operator==.
+  static bool EqualsStaticSlow(uintptr_t lhs_rep, uintptr_t rhs_rep);
+
+  // Status supports three different representations.
   //  - When the low bit is set it is an inlined representation.
   //    It uses the canonical error space, no message or payload.
   //    The error code is (rep_ >> 2).
   //    The (rep_ & 2) bit is the "moved from" indicator, used in IsMovedFrom().
-  //  - When the low bit is off it is an external representation.
+  //  - When the low bit is off and the second bit is set, rep_ points at an
+  //    immortal StaticStatusData object (with the second bit masked off). The
+  //    data is never refcounted, so construction, copying, and destruction are
+  //    trivial.
+  //  - When the low two bits are off it is an external representation.
   //    In this case all the data comes from a heap allocated Rep object.
   //    rep_ is a status_internal::StatusRep* pointer to that structure.
   uintptr_t rep_;
@@ -823,20 +857,26 @@ inline absl::StatusCode Status::code() const {
 
 inline int Status::raw_code() const {
   if (IsInlined(rep_)) return static_cast<int>(InlinedRepToCode(rep_));
+  if (IsStatic(rep_)) return static_cast<int>(RepToStaticData(rep_)->code);
   return static_cast<int>(RepToPointer(rep_)->code());
 }
 
 inline absl::string_view Status::message() const {
-  return !IsInlined(rep_)
-             ? RepToPointer(rep_)->message()
-             : (IsMovedFrom(rep_) ? absl::string_view(kMovedFromString)
-                                  : absl::string_view());
+  if (IsInlined(rep_)) {
+    return IsMovedFrom(rep_) ? absl::string_view(kMovedFromString)
+                             : absl::string_view();
+  }
+  if (IsStatic(rep_)) return RepToStaticData(rep_)->message;
+  return RepToPointer(rep_)->message();
 }
 
 inline bool operator==(const Status& lhs, const Status& rhs) {
   if (lhs.rep_ == rhs.rep_) return true;
   if (Status::IsInlined(lhs.rep_)) return false;
   if (Status::IsInlined(rhs.rep_)) return false;
+  if (Status::IsStatic(lhs.rep_) || Status::IsStatic(rhs.rep_)) {
+    return Status::EqualsStaticSlow(lhs.rep_, rhs.rep_);
+  }
   return *Status::RepToPointer(lhs.rep_) == *Status::RepToPointer(rhs.rep_);
 }
 
@@ -859,7 +899,7 @@ inline void swap(absl::Status& a, absl::Status& b) noexcept {
 
 inline absl::optional<absl::Cord> Status::GetPayload(
     absl::string_view type_url) const {
-  if (IsInlined(rep_)) return absl::nullopt;
+  if (IsInlined(rep_) || IsStatic(rep_)) return absl::nullopt;
   return RepToPointer(rep_)->GetPayload(type_url);
 }
 
@@ -871,7 +911,7 @@ inline void Status::SetPayload(absl::string_view type_url, absl::Cord payload) {
 }
 
 inline bool Status::ErasePayload(absl::string_view type_url) {
-  if (IsInlined(rep_)) return false;
+  if (IsInlined(rep_) || IsStatic(rep_)) return false;
   status_internal::StatusRep* rep = PrepareToModify(rep_);
   auto res = rep->ErasePayload(type_url);
   rep_ = res.new_rep;
@@ -881,12 +921,14 @@ inline bool Status::ErasePayload(absl::string_view type_url) {
 inline void Status::ForEachPayload(
     absl::FunctionRef<void(absl::string_view, const absl::Cord&)> visitor)
     const {
-  if (IsInlined(rep_)) return;
+  if (IsInlined(rep_) || IsStatic(rep_)) return;
   RepToPointer(rep_)->ForEachPayload(visitor);
 }
 
 constexpr bool Status::IsInlined(uintptr_t rep) { return (rep & 1) != 0; }
 
+constexpr bool Status::IsStatic(uintptr_t rep) { return (rep & 3) == 2; }
+
 constexpr bool Status::IsMovedFrom(uintptr_t rep) { return (rep & 2) != 0; }
 
 constexpr uintptr_t Status::CodeToInlinedRep(absl::StatusCode code) {
@@ -913,12 +955,18 @@ inline uintptr_t Status::PointerToRep(
   return reinterpret_cast<uintptr_t>(rep);
 }
 
+inline absl::Nonnull<const StaticStatusData*> Status::RepToStaticData(
+    uintptr_t rep) {
+  assert(IsStatic(rep));
+  return reinterpret_cast<const StaticStatusData*>(rep & ~uintptr_t{2});
+}
+
 inline void Status::Ref(uintptr_t rep) {
-  if (!IsInlined(rep)) RepToPointer(rep)->Ref();
+  if (!IsInlined(rep) && !IsStatic(rep)) RepToPointer(rep)->Ref();
 }
 
 inline void Status::Unref(uintptr_t rep) {
-  if (!IsInlined(rep)) RepToPointer(rep)->Unref();
+  if (!IsInlined(rep) && !IsStatic(rep)) RepToPointer(rep)->Unref();
 }
 
 inline Status OkStatus() { return Status(); }
@@ -928,6 +976,28 @@ inline Status OkStatus() { return Status(); }
 // message-less kCancelled errors are common in the infrastructure.
 inline Status CancelledError() { return Status(absl::StatusCode::kCancelled); }
 
+// MakeStaticStatus()
+//
+// Returns a `Status` carrying `data.code` and `data.message` that is backed by
+// `data` directly: no allocation is performed and no reference count is ever
+// touched, much like the inlined message-less representation `OkStatus()`
+// uses. This is useful for error statuses with fixed literal messages that are
+// produced at a high rate.
+//
+// `data` must have static storage duration (see `StaticStatusData`). Attaching
+// a payload to a copy of the returned status falls back to an ordinary
+// heap-allocated representation for that copy.
+//
+// Example:
+//
+//   ABSL_CONST_INIT static const absl::StaticStatusData kQueueFull = {
+//       absl::StatusCode::kResourceExhausted, "queue full"};
+//   return absl::MakeStaticStatus(kQueueFull);
+inline Status MakeStaticStatus(const StaticStatusData& data) {
+  assert(data.code != absl::StatusCode::kOk);
+  return Status(reinterpret_cast<uintptr_t>(&data) | 2);
+}
+
 // Retrieves a message's status as a null terminated C string. The lifetime of
 // this string is tied to the lifetime of the status object itself.
 //
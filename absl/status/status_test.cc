@@ -180,6 +180,34 @@ constexpr char kPayload3[] = "ccccc";
 
 using PayloadsVec = std::vector<std::pair<std::string, absl::Cord>>;
 
+TEST(Status, MakeStaticStatus) {
+  ABSL_CONST_INIT static const absl::StaticStatusData kQueueFull = {
+      absl::StatusCode::kResourceExhausted, "queue full"};
+
+  absl::Status status = absl::MakeStaticStatus(kQueueFull);
+  EXPECT_FALSE(status.ok());
+  EXPECT_EQ(absl::StatusCode::kResourceExhausted, status.code());
+  EXPECT_EQ("queue full", status.message());
+  EXPECT_EQ("RESOURCE_EXHAUSTED: queue full", status.ToString());
+  EXPECT_EQ(status.GetPayload(kUrl1), absl::nullopt);
+
+  // Copies share the static data and compare equal to each other and to an
+  // equivalent heap-backed status.
+  absl::Status copy = status;
+  EXPECT_EQ(status, copy);
+  EXPECT_EQ(status, absl::ResourceExhaustedError("queue full"));
+  EXPECT_NE(status, absl::ResourceExhaustedError("queue empty"));
+  EXPECT_NE(status, absl::UnavailableError("queue full"));
+
+  // Attaching a payload converts only this copy to a heap representation.
+  copy.SetPayload(kUrl1, absl::Cord(kPayload1));
+  EXPECT_THAT(copy.GetPayload(kUrl1), Optional(Eq(kPayload1)));
+  EXPECT_EQ(status.GetPayload(kUrl1), absl::nullopt);
+  EXPECT_NE(status, copy);
+  EXPECT_TRUE(copy.ErasePayload(kUrl1));
+  EXPECT_EQ(status, copy);
+}
+
 TEST(Status, TestGetSetPayload) {
   absl::Status ok_status = absl::OkStatus();
   ok_status.SetPayload(kUrl1, absl::Cord(kPayload1));
@@ -206,6 +234,30 @@ TEST(Status, TestGetSetPayload) {
               Optional(Eq(kPayload1)));
 }
 
+TEST(Status, TestPayloadAroundInlineCapacity) {
+  // Exercise the small-payload inline storage in StatusRep around its capacity
+  // boundary, including overwrites that move a payload between the inline slot
+  // and the spilled representation.
+  const std::string small(24, 'a');
+  const std::string large(25, 'b');
+
+  absl::Status bad_status(absl::StatusCode::kInternal, "fail");
+  bad_status.SetPayload(kUrl1, absl::Cord(small));
+  EXPECT_THAT(bad_status.GetPayload(kUrl1), Optional(Eq(small)));
+
+  bad_status.SetPayload(kUrl1, absl::Cord(large));
+  EXPECT_THAT(bad_status.GetPayload(kUrl1), Optional(Eq(large)));
+
+  bad_status.SetPayload(kUrl1, absl::Cord(small));
+  EXPECT_THAT(bad_status.GetPayload(kUrl1), Optional(Eq(small)));
+
+  // `bad_status`'s payload was spilled by the large overwrite; `other_status`
+  // stores the same payload inline. The two must still compare equal.
+  absl::Status other_status(absl::StatusCode::kInternal, "fail");
+  other_status.SetPayload(kUrl1, absl::Cord(small));
+  EXPECT_EQ(bad_status, other_status);
+}
+
 TEST(Status, TestErasePayload) {
   absl::Status bad_status(absl::StatusCode::kInternal, "fail");
   bad_status.SetPayload(kUrl1, absl::Cord(kPayload1));
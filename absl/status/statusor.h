@@ -38,6 +38,7 @@
 
 #include <exception>
 #include <initializer_list>
+#include <memory>
 #include <new>
 #include <ostream>
 #include <string>
@@ -604,6 +605,225 @@ class StatusOr : private internal_statusor::StatusOrData<T>,
   void Assign(absl::StatusOr<U>&& other);
 };
 
+// absl::StatusOr<T&>
+//
+// A partial specialization of `absl::StatusOr` for lvalue reference payloads.
+// `absl::StatusOr<T&>` represents either a borrowed reference to an object of
+// type `T` or an error (of type `absl::Status`) explaining why the reference
+// is not available. It is the natural return type for lookup APIs that hand
+// out views into long-lived storage (caches, registries, arenas) and must not
+// copy the value on every hit:
+//
+//   absl::StatusOr<const LargeProto&> Cache::Lookup(absl::string_view key);
+//
+//   auto entry = cache.Lookup(key);
+//   if (entry.ok()) {
+//     Process(*entry);  // No copy of LargeProto was made.
+//   }
+//
+// Unlike `absl::StatusOr<T>`, this specialization never owns the value: the
+// caller of the returning API must ensure the referenced object outlives the
+// `StatusOr<T&>` and any references obtained from it. The `StatusOr<T&>`
+// itself is cheap to copy; copying rebinds to the same object. Construction
+// from a temporary is disallowed at compile time since the reference would
+// dangle immediately.
+//
+// `value()` and `operator*` return `T&` and `operator->` returns `T*`.
+// Because the referent is not stored inside the `StatusOr`, there are no
+// rvalue-qualified accessors and no `emplace()`; `value_or()` returns a copy
+// of the referent, as it does in the primary template.
+template <typename T>
+class StatusOr<T&> {
+  template <typename U>
+  friend class StatusOr;
+
+ public:
+  typedef T& value_type;
+
+  // Constructs a new `absl::StatusOr<T&>` with an
+  // `absl::StatusCode::kUnknown` status, matching the primary template.
+  explicit StatusOr() : status_(absl::StatusCode::kUnknown, "") {}
+
+  // `StatusOr<T&>` is always copyable and movable; copies rebind to the same
+  // referent.
+  StatusOr(const StatusOr&) = default;
+  StatusOr& operator=(const StatusOr&) = default;
+  StatusOr(StatusOr&&) = default;
+  StatusOr& operator=(StatusOr&&) = default;
+
+  // Constructs an OK `absl::StatusOr<T&>` bound to `v`. Only lvalues are
+  // accepted; binding a temporary does not compile. Participates in overload
+  // resolution when `U&` is reference-compatible with `T&` (e.g. `Derived&`
+  // for `StatusOr<Base&>`, or `T&` for `StatusOr<const T&>`).
+  template <typename U,
+            absl::enable_if_t<
+                absl::conjunction<
+                    std::is_lvalue_reference<U&&>,
+                    std::is_convertible<absl::remove_reference_t<U>*,
+                                        T*>>::value,
+                int> = 0>
+  StatusOr(U&& v ABSL_ATTRIBUTE_LIFETIME_BOUND)  // NOLINT
+      : data_(std::addressof(v)) {}
+
+  // Rebinds `*this` to `v`.
+  template <typename U,
+            absl::enable_if_t<
+                absl::conjunction<
+                    std::is_lvalue_reference<U&&>,
+                    std::is_convertible<absl::remove_reference_t<U>*,
+                                        T*>>::value,
+                int> = 0>
+  StatusOr& operator=(U&& v ABSL_ATTRIBUTE_LIFETIME_BOUND) {
+    status_ = absl::OkStatus();
+    data_ = std::addressof(v);
+    return *this;
+  }
+
+  // Constructs a new `absl::StatusOr<T&>` from an `absl::StatusOr<U&>` whose
+  // referent is reference-compatible. The result borrows the same object.
+  template <typename U,
+            absl::enable_if_t<
+                absl::conjunction<absl::negation<std::is_same<T, U>>,
+                                  std::is_convertible<U*, T*>>::value,
+                int> = 0>
+  StatusOr(const StatusOr<U&>& other)  // NOLINT
+      : status_(other.status_), data_(other.data_) {}
+  template <typename U,
+            absl::enable_if_t<
+                absl::conjunction<absl::negation<std::is_same<T, U>>,
+                                  std::is_convertible<U*, T*>>::value,
+                int> = 0>
+  StatusOr& operator=(const StatusOr<U&>& other) {
+    status_ = other.status_;
+    data_ = other.data_;
+    return *this;
+  }
+
+  // Constructs a new `absl::StatusOr<T&>` with a non-ok status. After calling
+  // this constructor, `this->ok()` will be `false` and calls to `value()`
+  // will crash, or produce an exception if exceptions are enabled.
+  //
+  // REQUIRES: !Status(std::forward<U>(v)).ok(). This requirement is DCHECKed.
+  // In optimized builds, passing absl::OkStatus() here will have the effect
+  // of passing absl::StatusCode::kInternal as a fallback.
+  template <typename U = absl::Status,
+            absl::enable_if_t<internal_statusor::IsConstructionFromStatusValid<
+                                  false, T&, U>::value,
+                              int> = 0>
+  StatusOr(U&& v) : status_(std::forward<U>(v)) {  // NOLINT
+    EnsureNotOk();
+  }
+  template <typename U = absl::Status,
+            absl::enable_if_t<internal_statusor::IsConstructionFromStatusValid<
+                                  true, T&, U>::value,
+                              int> = 0>
+  explicit StatusOr(U&& v) : status_(std::forward<U>(v)) {
+    EnsureNotOk();
+  }
+  template <typename U = absl::Status,
+            absl::enable_if_t<internal_statusor::IsConstructionFromStatusValid<
+                                  false, T&, U>::value,
+                              int> = 0>
+  StatusOr& operator=(U&& v) {
+    AssignStatus(std::forward<U>(v));
+    return *this;
+  }
+
+  // StatusOr<T&>::ok()
+  //
+  // Returns whether or not this `absl::StatusOr<T&>` holds a reference.
+  ABSL_MUST_USE_RESULT bool ok() const { return status_.ok(); }
+
+  // StatusOr<T&>::status()
+  //
+  // Returns a reference to the current `absl::Status` contained within the
+  // `absl::StatusOr<T&>`. If `absl::StatusOr<T&>` holds a reference, then
+  // this function returns `absl::OkStatus()`.
+  const Status& status() const& { return status_; }
+  Status status() && { return ok() ? OkStatus() : std::move(status_); }
+
+  // StatusOr<T&>::value()
+  //
+  // Returns the borrowed reference if `this->ok()`. Otherwise, throws
+  // `absl::BadStatusOrAccess` if exceptions are enabled, or is guaranteed to
+  // terminate the process if exceptions are disabled.
+  //
+  // Note that the returned reference outlives the `StatusOr<T&>` itself: its
+  // lifetime is that of the referenced object.
+  T& value() const {
+    if (!ok()) internal_statusor::ThrowBadStatusOrAccess(status_);
+    return *data_;
+  }
+
+  // StatusOr<T&>::operator*()
+  //
+  // Returns the borrowed reference.
+  //
+  // REQUIRES: `this->ok() == true`, otherwise the behavior is undefined.
+  T& operator*() const {
+    EnsureOk();
+    return *data_;
+  }
+
+  // StatusOr<T&>::operator->()
+  //
+  // Returns a pointer to the referenced object.
+  //
+  // REQUIRES: `this->ok() == true`, otherwise the behavior is undefined.
+  absl::Nonnull<T*> operator->() const {
+    EnsureOk();
+    return data_;
+  }
+
+  // StatusOr<T&>::value_or()
+  //
+  // Returns a copy of the referenced object if `this->ok() == true`.
+  // Otherwise constructs a value from the provided `default_value`.
+  template <typename U>
+  absl::remove_cvref_t<T> value_or(U&& default_value) const {
+    if (ok()) {
+      return *data_;
+    }
+    return std::forward<U>(default_value);
+  }
+
+  // StatusOr<T&>::IgnoreError()
+  //
+  // Ignores any errors. This method does nothing except potentially suppress
+  // complaints from any tools that are checking that errors are not dropped
+  // on the floor.
+  void IgnoreError() const {
+    // no-op
+  }
+
+  // StatusOr<T&>::AssignStatus()
+  //
+  // Sets the status of `absl::StatusOr<T&>` to the given non-ok status value.
+  // See the primary template for details.
+  //
+  // REQUIRES: !Status(std::forward<U>(v)).ok(). This requirement is DCHECKed.
+  template <typename U>
+  void AssignStatus(U&& v) {
+    status_ = static_cast<absl::Status>(std::forward<U>(v));
+    data_ = nullptr;
+    EnsureNotOk();
+  }
+
+ private:
+  void EnsureOk() const {
+    if (ABSL_PREDICT_FALSE(!ok())) internal_statusor::Helper::Crash(status_);
+  }
+  void EnsureNotOk() {
+    if (ABSL_PREDICT_FALSE(ok())) {
+      internal_statusor::Helper::HandleInvalidStatusCtorArg(&status_);
+    }
+  }
+
+  absl::Status status_;
+  // Non-null iff `status_.ok()`.
+  T* data_ = nullptr;
+};
+
 // operator==()
 //
 // This operator checks the equality of two `absl::StatusOr<T>` objects.
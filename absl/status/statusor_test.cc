@@ -1799,4 +1799,96 @@ TEST(StatusOr, ErrorPrinting) {
   EXPECT_THAT(absl::StrCat(print_me), error_matcher);
 }
 
+
+TEST(StatusOr, ReferenceBindsToLvalue) {
+  int x = 17;
+  absl::StatusOr<int&> ref = x;
+  ASSERT_TRUE(ref.ok());
+  EXPECT_EQ(&*ref, &x);
+  *ref = 18;
+  EXPECT_EQ(x, 18);
+  EXPECT_EQ(ref.value(), 18);
+}
+
+TEST(StatusOr, ReferenceConstAccess) {
+  std::string s = "hello";
+  absl::StatusOr<const std::string&> ref = s;
+  ASSERT_TRUE(ref.ok());
+  EXPECT_EQ(ref->size(), 5);
+  EXPECT_EQ(&ref.value(), &s);
+}
+
+TEST(StatusOr, ReferenceHoldsStatus) {
+  absl::StatusOr<int&> ref = absl::NotFoundError("no entry");
+  EXPECT_FALSE(ref.ok());
+  EXPECT_EQ(ref.status().code(), absl::StatusCode::kNotFound);
+  EXPECT_EQ(ref.value_or(42), 42);
+}
+
+TEST(StatusOr, ReferenceCopyRebindsToSameObject) {
+  int x = 1;
+  absl::StatusOr<int&> a = x;
+  absl::StatusOr<int&> b = a;
+  ASSERT_TRUE(b.ok());
+  *b = 2;
+  EXPECT_EQ(x, 2);
+  EXPECT_EQ(*a, 2);
+}
+
+TEST(StatusOr, ReferenceRebindAssignment) {
+  int x = 1;
+  int y = 2;
+  absl::StatusOr<int&> ref = x;
+  ref = y;
+  ASSERT_TRUE(ref.ok());
+  EXPECT_EQ(&*ref, &y);
+
+  ref = absl::InternalError("gone");
+  EXPECT_FALSE(ref.ok());
+  ref = x;
+  ASSERT_TRUE(ref.ok());
+  EXPECT_EQ(&*ref, &x);
+}
+
+TEST(StatusOr, ReferenceConvertingConstruction) {
+  struct Base {
+    int b = 1;
+  };
+  struct Derived : Base {
+    int d = 2;
+  };
+  Derived derived;
+
+  absl::StatusOr<Derived&> as_derived = derived;
+  absl::StatusOr<Base&> as_base = as_derived;
+  ASSERT_TRUE(as_base.ok());
+  EXPECT_EQ(&*as_base, static_cast<Base*>(&derived));
+
+  absl::StatusOr<int&> mutable_ref = derived.d;
+  absl::StatusOr<const int&> const_ref = mutable_ref;
+  ASSERT_TRUE(const_ref.ok());
+  EXPECT_EQ(&const_ref.value(), &derived.d);
+
+  absl::StatusOr<Derived&> error = absl::NotFoundError("no entry");
+  absl::StatusOr<Base&> error_as_base = error;
+  EXPECT_EQ(error_as_base.status().code(), absl::StatusCode::kNotFound);
+}
+
+TEST(StatusOr, ReferenceValueOrCopies) {
+  std::string s = "borrowed";
+  absl::StatusOr<const std::string&> ref = s;
+  std::string copy = ref.value_or("default");
+  EXPECT_EQ(copy, "borrowed");
+  EXPECT_NE(&copy, &s);
+}
+
+TEST(StatusOr, ReferenceStatusRValueOverload) {
+  int x = 0;
+  absl::StatusOr<int&> ok_ref = x;
+  EXPECT_TRUE(std::move(ok_ref).status().ok());
+
+  absl::StatusOr<int&> err_ref = absl::CancelledError();
+  EXPECT_EQ(std::move(err_ref).status().code(), absl::StatusCode::kCancelled);
+}
+
 }  // namespace
@@ -23,6 +23,8 @@
 #include "absl/base/config.h"
 #include "absl/base/nullability.h"
 #include "absl/base/optimization.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
 
 namespace absl {
 ABSL_NAMESPACE_BEGIN
@@ -248,6 +250,26 @@ void AsciiStrToUpper(absl::Nonnull<std::string*> s) {
   return ascii_internal::AsciiStrCaseFold<true>(&(*s)[0], s->size());
 }
 
+void AsciiToLower(absl::Span<char> s) {
+  if (s.empty()) return;
+  ascii_internal::AsciiStrCaseFold<false>(s.data(), s.size());
+}
+
+void AsciiToUpper(absl::Span<char> s) {
+  if (s.empty()) return;
+  ascii_internal::AsciiStrCaseFold<true>(s.data(), s.size());
+}
+
+bool IsAsciiPrintable(absl::string_view s) {
+  // Accumulating with `&=` instead of returning early keeps the loop free of
+  // data-dependent branches, so compilers can vectorize it.
+  bool printable = true;
+  for (char c : s) {
+    printable &= ascii_isprint(static_cast<unsigned char>(c));
+  }
+  return printable;
+}
+
 void RemoveExtraAsciiWhitespace(absl::Nonnull<std::string*> str) {
   auto stripped = StripAsciiWhitespace(*str);
 
@@ -60,6 +60,7 @@
 #include "absl/base/config.h"
 #include "absl/base/nullability.h"
 #include "absl/strings/string_view.h"
+#include "absl/types/span.h"
 
 namespace absl {
 ABSL_NAMESPACE_BEGIN
@@ -169,6 +170,12 @@ inline char ascii_tolower(unsigned char c) {
 // Converts the characters in `s` to lowercase, changing the contents of `s`.
 void AsciiStrToLower(absl::Nonnull<std::string*> s);
 
+// Converts the characters in the span `s` to lowercase in place. Unlike the
+// `std::string` overload above, this works on any writable character buffer
+// (e.g. wire-format or arena-backed data) without copying it into a string.
+// The conversion loop is branchless so that compilers can vectorize it.
+void AsciiToLower(absl::Span<char> s);
+
 // Creates a lowercase string from a given absl::string_view.
 ABSL_MUST_USE_RESULT inline std::string AsciiStrToLower(absl::string_view s) {
   std::string result(s);
@@ -187,6 +194,10 @@ inline char ascii_toupper(unsigned char c) {
 // Converts the characters in `s` to uppercase, changing the contents of `s`.
 void AsciiStrToUpper(absl::Nonnull<std::string*> s);
 
+// Converts the characters in the span `s` to uppercase in place. See
+// `AsciiToLower()` above for when to prefer this over the string overloads.
+void AsciiToUpper(absl::Span<char> s);
+
 // Creates an uppercase string from a given absl::string_view.
 ABSL_MUST_USE_RESULT inline std::string AsciiStrToUpper(absl::string_view s) {
   std::string result(s);
@@ -194,6 +205,13 @@ ABSL_MUST_USE_RESULT inline std::string AsciiStrToUpper(absl::string_view s) {
   return result;
 }
 
+// Determines whether every character in `s` is printable ASCII (as defined by
+// `ascii_isprint()`, i.e. in the range [' ', '~']). Returns `true` for an
+// empty string. Checking all characters at once lets the whole-string scan
+// vectorize, making this much faster than a character-at-a-time loop over
+// `ascii_isprint()`.
+ABSL_MUST_USE_RESULT bool IsAsciiPrintable(absl::string_view s);
+
 // Returns absl::string_view with whitespace stripped from the beginning of the
 // given string_view.
 ABSL_MUST_USE_RESULT inline absl::string_view StripLeadingAsciiWhitespace(
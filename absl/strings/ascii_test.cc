@@ -23,6 +23,7 @@
 #include "gtest/gtest.h"
 #include "absl/base/macros.h"
 #include "absl/strings/string_view.h"
+#include "absl/types/span.h"
 
 namespace {
 
@@ -225,6 +226,41 @@ TEST(AsciiStrTo, Upper) {
   EXPECT_STREQ("MUTABLE", mutable_buf);
 }
 
+TEST(AsciiToFoo, Span) {
+  std::string str("_`?@[{AMNOpqrstuvwxyz");
+  absl::AsciiToLower(absl::MakeSpan(&str[0], str.size()));
+  EXPECT_EQ("_`?@[{amnopqrstuvwxyz", str);
+  absl::AsciiToUpper(absl::MakeSpan(&str[0], str.size()));
+  EXPECT_EQ("_`?@[{AMNOPQRSTUVWXYZ", str);
+
+  // Long enough to exercise the vectorized path.
+  std::string long_str("ABCDEFGHIJKLMNOPQRSTUVWXYZ1!aBCDEFGHIJKLMNOPQRSTUVW");
+  absl::AsciiToLower(absl::MakeSpan(&long_str[0], long_str.size()));
+  EXPECT_EQ("abcdefghijklmnopqrstuvwxyz1!abcdefghijklmnopqrstuvw", long_str);
+
+  // An empty span is a no-op.
+  absl::AsciiToUpper(absl::Span<char>());
+}
+
+TEST(IsAsciiPrintable, All) {
+  EXPECT_TRUE(absl::IsAsciiPrintable(""));
+  EXPECT_TRUE(absl::IsAsciiPrintable(" "));
+  EXPECT_TRUE(absl::IsAsciiPrintable("Hello, world! 0123456789 ~"));
+  EXPECT_FALSE(absl::IsAsciiPrintable("tab\there"));
+  EXPECT_FALSE(absl::IsAsciiPrintable("newline\n"));
+  EXPECT_FALSE(absl::IsAsciiPrintable(absl::string_view("\0", 1)));
+  EXPECT_FALSE(absl::IsAsciiPrintable("\x7f"));
+  EXPECT_FALSE(absl::IsAsciiPrintable("high bit \x80 set"));
+
+  // Every character individually agrees with ascii_isprint().
+  for (int i = 0; i < 256; ++i) {
+    const char c = static_cast<char>(i);
+    EXPECT_EQ(absl::IsAsciiPrintable(absl::string_view(&c, 1)),
+              absl::ascii_isprint(static_cast<unsigned char>(c)))
+        << "character " << i;
+  }
+}
+
 TEST(StripLeadingAsciiWhitespace, FromStringView) {
   EXPECT_EQ(absl::string_view{},
             absl::StripLeadingAsciiWhitespace(absl::string_view{}));
@@ -18,6 +18,7 @@
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <limits>
 #include <system_error>  // NOLINT(build/c++11)
 
@@ -1442,5 +1443,351 @@ const uint64_t kPower10MantissaLowTable[] = {
 };
 
 }  // namespace
+
+namespace {
+
+// Shortest-round-trip double formatting (the Ryu algorithm).
+//
+// A double is decomposed into a decimal mantissa and exponent such that the
+// mantissa has the fewest digits for which reading the value back yields
+// exactly the original double. The computation multiplies the binary mantissa
+// by a 125-bit fixed-point approximation of the appropriate power of five and
+// tracks the halfway points to the neighboring doubles, so no arbitrary
+// precision arithmetic is needed at runtime.
+
+#include "absl/strings/internal/charconv_pow5_tables.inc"
+
+constexpr int kDoubleMantissaBits = 52;
+// Exponent bias plus mantissa shift: a double is m * 2^(e - kDoubleBias).
+constexpr int kDoubleBias = 1075;
+
+// Returns ceil(log2(5^e)) for 0 <= e <= 3528.
+inline int32_t Pow5Bits(int32_t e) {
+  assert(e >= 0 && e <= 3528);
+  return static_cast<int32_t>(((static_cast<uint32_t>(e) * 1217359) >> 19) +
+                              1);
+}
+
+// Returns floor(log10(2^e)) for 0 <= e <= 1650.
+inline uint32_t Log10Pow2(int32_t e) {
+  assert(e >= 0 && e <= 1650);
+  return (static_cast<uint32_t>(e) * 78913) >> 18;
+}
+
+// Returns floor(log10(5^e)) for 0 <= e <= 2620.
+inline uint32_t Log10Pow5(int32_t e) {
+  assert(e >= 0 && e <= 2620);
+  return (static_cast<uint32_t>(e) * 732923) >> 20;
+}
+
+// Returns the number of times `value` is divisible by 5.
+inline uint32_t Pow5Factor(uint64_t value) {
+  uint32_t count = 0;
+  for (;;) {
+    assert(value != 0);
+    const uint64_t q = value / 5;
+    const uint32_t r = static_cast<uint32_t>(value - 5 * q);
+    if (r != 0) break;
+    value = q;
+    ++count;
+  }
+  return count;
+}
+
+inline bool MultipleOfPowerOf5(uint64_t value, uint32_t p) {
+  return Pow5Factor(value) >= p;
+}
+
+inline bool MultipleOfPowerOf2(uint64_t value, uint32_t p) {
+  assert(p < 64);
+  return (value & ((uint64_t{1} << p) - 1)) == 0;
+}
+
+// Returns the high 64 bits of (m * mul) >> j, where mul is a 128-bit value
+// given as {low, high} and 64 < j < 128.
+inline uint64_t MulShift64(uint64_t m, const uint64_t* mul, int32_t j) {
+  const uint128 b0 = static_cast<uint128>(m) * mul[0];
+  const uint128 b2 = static_cast<uint128>(m) * mul[1];
+  return static_cast<uint64_t>(((b0 >> 64) + b2) >> (j - 64));
+}
+
+inline uint64_t MulShiftAll64(uint64_t m, const uint64_t* mul, int32_t j,
+                              uint64_t* vp, uint64_t* vm, uint32_t mm_shift) {
+  *vp = MulShift64(4 * m + 2, mul, j);
+  *vm = MulShift64(4 * m - 1 - mm_shift, mul, j);
+  return MulShift64(4 * m, mul, j);
+}
+
+struct FloatingDecimal64 {
+  uint64_t mantissa;
+  // The value is mantissa * 10^exponent.
+  int32_t exponent;
+};
+
+FloatingDecimal64 ComputeShortest(uint64_t ieee_mantissa,
+                                  uint32_t ieee_exponent) {
+  int32_t e2;
+  uint64_t m2;
+  if (ieee_exponent == 0) {
+    e2 = 1 - kDoubleBias - 2;
+    m2 = ieee_mantissa;
+  } else {
+    e2 = static_cast<int32_t>(ieee_exponent) - kDoubleBias - 2;
+    m2 = (uint64_t{1} << kDoubleMantissaBits) | ieee_mantissa;
+  }
+  const bool even = (m2 & 1) == 0;
+  const bool accept_bounds = even;
+
+  // The interval of information-preserving outputs is
+  // [(mv - (mm_shift + 1)/2) * 2^(e2-2), (mv + 1) * 2^(e2-2)] around
+  // mv = 4 * m2; the lower neighbor is further away when the mantissa is a
+  // power of two (except for the smallest normal).
+  const uint64_t mv = 4 * m2;
+  const uint32_t mm_shift = ieee_mantissa != 0 || ieee_exponent <= 1;
+
+  // Convert the interval bounds to decimal with one 128-bit multiply each,
+  // and record whether the bounds are exact (have only trailing zeros left).
+  uint64_t vr, vp, vm;
+  int32_t e10;
+  bool vm_is_trailing_zeros = false;
+  bool vr_is_trailing_zeros = false;
+  if (e2 >= 0) {
+    const uint32_t q = Log10Pow2(e2) - (e2 > 3);
+    e10 = static_cast<int32_t>(q);
+    const int32_t k =
+        kPow5InvBitCount + Pow5Bits(static_cast<int32_t>(q)) - 1;
+    const int32_t i = -e2 + static_cast<int32_t>(q) + k;
+    vr = MulShiftAll64(m2, kPow5Inv[q], i, &vp, &vm, mm_shift);
+    if (q <= 21) {
+      // Only one of mp, mv, and mm can be a multiple of 5, if any.
+      if (mv % 5 == 0) {
+        vr_is_trailing_zeros = MultipleOfPowerOf5(mv, q);
+      } else if (accept_bounds) {
+        vm_is_trailing_zeros = MultipleOfPowerOf5(mv - 1 - mm_shift, q);
+      } else {
+        vp -= MultipleOfPowerOf5(mv + 2, q);
+      }
+    }
+  } else {
+    const uint32_t q = Log10Pow5(-e2) - (-e2 > 1);
+    e10 = static_cast<int32_t>(q) + e2;
+    const int32_t i = -e2 - static_cast<int32_t>(q);
+    const int32_t k = Pow5Bits(i) - kPow5BitCount;
+    const int32_t j = static_cast<int32_t>(q) - k;
+    vr = MulShiftAll64(m2, kPow5[i], j, &vp, &vm, mm_shift);
+    if (q <= 1) {
+      // {vr,vp,vm} is trailing zeros if {mv,mp,mm} has at least q trailing
+      // zero bits; mv = 4 * m2, so it always has at least two.
+      vr_is_trailing_zeros = true;
+      if (accept_bounds) {
+        vm_is_trailing_zeros = mm_shift == 1;
+      } else {
+        --vp;
+      }
+    } else if (q < 63) {
+      vr_is_trailing_zeros = MultipleOfPowerOf2(mv, q);
+    }
+  }
+
+  // Find the shortest decimal representation in the interval.
+  int32_t removed = 0;
+  uint8_t last_removed_digit = 0;
+  uint64_t output;
+  if (vm_is_trailing_zeros || vr_is_trailing_zeros) {
+    // Rare general case (~0.7% of inputs): exactness must be tracked while
+    // removing digits so that ties round to even.
+    for (;;) {
+      const uint64_t vp_div10 = vp / 10;
+      const uint64_t vm_div10 = vm / 10;
+      if (vp_div10 <= vm_div10) break;
+      const uint32_t vm_mod10 = static_cast<uint32_t>(vm - 10 * vm_div10);
+      const uint64_t vr_div10 = vr / 10;
+      const uint32_t vr_mod10 = static_cast<uint32_t>(vr - 10 * vr_div10);
+      vm_is_trailing_zeros &= vm_mod10 == 0;
+      vr_is_trailing_zeros &= last_removed_digit == 0;
+      last_removed_digit = static_cast<uint8_t>(vr_mod10);
+      vr = vr_div10;
+      vp = vp_div10;
+      vm = vm_div10;
+      ++removed;
+    }
+    if (vm_is_trailing_zeros) {
+      for (;;) {
+        const uint64_t vm_div10 = vm / 10;
+        const uint32_t vm_mod10 = static_cast<uint32_t>(vm - 10 * vm_div10);
+        if (vm_mod10 != 0) break;
+        const uint64_t vp_div10 = vp / 10;
+        const uint64_t vr_div10 = vr / 10;
+        const uint32_t vr_mod10 = static_cast<uint32_t>(vr - 10 * vr_div10);
+        vr_is_trailing_zeros &= last_removed_digit == 0;
+        last_removed_digit = static_cast<uint8_t>(vr_mod10);
+        vr = vr_div10;
+        vp = vp_div10;
+        vm = vm_div10;
+        ++removed;
+      }
+    }
+    if (vr_is_trailing_zeros && last_removed_digit == 5 && vr % 2 == 0) {
+      // Round even if the exact value is .....50..0.
+      last_removed_digit = 4;
+    }
+    output = vr + ((vr == vm && (!accept_bounds || !vm_is_trailing_zeros)) ||
+                   last_removed_digit >= 5);
+  } else {
+    // Common case: the loop iterates few times, so peel two digits at once.
+    bool round_up = false;
+    const uint64_t vp_div100 = vp / 100;
+    const uint64_t vm_div100 = vm / 100;
+    if (vp_div100 > vm_div100) {
+      const uint64_t vr_div100 = vr / 100;
+      const uint32_t vr_mod100 = static_cast<uint32_t>(vr - 100 * vr_div100);
+      round_up = vr_mod100 >= 50;
+      vr = vr_div100;
+      vp = vp_div100;
+      vm = vm_div100;
+      removed += 2;
+    }
+    for (;;) {
+      const uint64_t vp_div10 = vp / 10;
+      const uint64_t vm_div10 = vm / 10;
+      if (vp_div10 <= vm_div10) break;
+      const uint64_t vr_div10 = vr / 10;
+      const uint32_t vr_mod10 = static_cast<uint32_t>(vr - 10 * vr_div10);
+      round_up = vr_mod10 >= 5;
+      vr = vr_div10;
+      vp = vp_div10;
+      vm = vm_div10;
+      ++removed;
+    }
+    output = vr + (vr == vm || round_up);
+  }
+  return {output, e10 + removed};
+}
+
+// Writes the decimal digits of `v` (most significant first) and returns the
+// number of digits written. `v` has at most 17 digits.
+inline int WriteDigits(char* out, uint64_t v) {
+  char rev[17];
+  int n = 0;
+  do {
+    rev[n++] = static_cast<char>('0' + v % 10);
+    v /= 10;
+  } while (v != 0);
+  for (int i = 0; i < n; ++i) out[i] = rev[n - 1 - i];
+  return n;
+}
+
+// Renders `digits`/`exponent` into `out` in whichever of fixed or scientific
+// notation is shorter, preferring fixed on ties as std::to_chars does.
+// Returns the number of characters written. `out` must have room for 24
+// characters past any sign. When `exponent` is non-negative the value is an
+// integer and `exact_int` must hold its exact value: printf's "%f" style, and
+// therefore std::to_chars, prints all integral digits exactly rather than the
+// shortest digit string padded with zeros.
+int FormatShortest(char* out, const char* digits, int num_digits,
+                   int32_t exponent, uint128 exact_int) {
+  // `sci_exp` is the exponent in d.ddd e+XX notation.
+  const int32_t sci_exp = exponent + num_digits - 1;
+  const int32_t abs_sci_exp = sci_exp < 0 ? -sci_exp : sci_exp;
+  const int exp_digits = abs_sci_exp >= 100 ? 3 : 2;
+  const int sci_len = (num_digits == 1 ? 1 : num_digits + 1) + 2 + exp_digits;
+  int fixed_len;
+  if (exponent >= 0) {
+    fixed_len = num_digits + exponent;
+  } else if (-exponent < num_digits) {
+    fixed_len = num_digits + 1;
+  } else {
+    fixed_len = 2 - exponent;
+  }
+  char* p = out;
+  if (fixed_len <= sci_len) {
+    if (exponent >= 0) {
+      char rev[24];
+      int n = 0;
+      do {
+        rev[n++] = static_cast<char>('0' + static_cast<int>(exact_int % 10));
+        exact_int /= 10;
+      } while (exact_int != 0);
+      assert(n == fixed_len);
+      for (int i = 0; i < n; ++i) *p++ = rev[n - 1 - i];
+    } else if (-exponent < num_digits) {
+      const int32_t int_digits = num_digits + exponent;
+      memcpy(p, digits, static_cast<size_t>(int_digits));
+      p += int_digits;
+      *p++ = '.';
+      memcpy(p, digits + int_digits, static_cast<size_t>(-exponent));
+      p += -exponent;
+    } else {
+      *p++ = '0';
+      *p++ = '.';
+      for (int32_t i = 0; i < -exponent - num_digits; ++i) *p++ = '0';
+      memcpy(p, digits, static_cast<size_t>(num_digits));
+      p += num_digits;
+    }
+  } else {
+    *p++ = digits[0];
+    if (num_digits > 1) {
+      *p++ = '.';
+      memcpy(p, digits + 1, static_cast<size_t>(num_digits - 1));
+      p += num_digits - 1;
+    }
+    *p++ = 'e';
+    *p++ = sci_exp < 0 ? '-' : '+';
+    if (exp_digits == 3) {
+      *p++ = static_cast<char>('0' + abs_sci_exp / 100);
+    }
+    *p++ = static_cast<char>('0' + abs_sci_exp / 10 % 10);
+    *p++ = static_cast<char>('0' + abs_sci_exp % 10);
+  }
+  return static_cast<int>(p - out);
+}
+
+}  // namespace
+
+to_chars_result to_chars(absl::Nonnull<char*> first,
+                         absl::Nonnull<char*> last, double value) {
+  // Render into a scratch buffer first; the longest output is
+  // -1.7976931348623157e+308 (24 characters).
+  char buf[32];
+  char* p = buf;
+  const uint64_t bits = absl::bit_cast<uint64_t>(value);
+  const uint64_t ieee_mantissa =
+      bits & ((uint64_t{1} << kDoubleMantissaBits) - 1);
+  const uint32_t ieee_exponent =
+      static_cast<uint32_t>(bits >> kDoubleMantissaBits) & 0x7ff;
+  if (bits >> 63) *p++ = '-';
+  if (ieee_exponent == 0x7ff) {
+    memcpy(p, ieee_mantissa == 0 ? "inf" : "nan", 3);
+    p += 3;
+  } else if ((bits << 1) == 0) {
+    *p++ = '0';
+  } else {
+    const FloatingDecimal64 v = ComputeShortest(ieee_mantissa, ieee_exponent);
+    char digits[17];
+    const int num_digits = WriteDigits(digits, v.mantissa);
+    uint128 exact_int = 0;
+    if (v.exponent >= 0 && v.exponent + num_digits <= 24) {
+      // The value is an integer small enough that fixed notation may win; its
+      // exact value fits easily in 128 bits. (Fixed notation is never shorter
+      // beyond roughly 10^22, so larger values never read `exact_int`.)
+      const int32_t e =
+          static_cast<int32_t>(ieee_exponent == 0 ? 1 : ieee_exponent) -
+          kDoubleBias;
+      const uint64_t m =
+          ieee_exponent == 0
+              ? ieee_mantissa
+              : (uint64_t{1} << kDoubleMantissaBits) | ieee_mantissa;
+      exact_int = e >= 0 ? uint128(m) << e : uint128(m >> -e);
+    }
+    p += FormatShortest(p, digits, num_digits, v.exponent, exact_int);
+  }
+  const size_t length = static_cast<size_t>(p - buf);
+  if (static_cast<size_t>(last - first) < length) {
+    return {last, std::errc::value_too_large};
+  }
+  memcpy(first, buf, length);
+  return {first + length, std::errc()};
+}
+
 ABSL_NAMESPACE_END
 }  // namespace absl
@@ -87,6 +87,33 @@ absl::from_chars_result from_chars(absl::Nonnull<const char*> first,
                                    float& value,  // NOLINT
                                    chars_format fmt = chars_format::general);
 
+// The return result of a number-to-string conversion.
+//
+// On success, `ec` is std::errc() and `ptr` is one past the last character
+// written. If the output range was too small, `ec` is
+// `std::errc::value_too_large`, `ptr` is set to `last`, and the contents of
+// the range are unspecified.
+struct to_chars_result {
+  absl::Nonnull<char*> ptr;
+  std::errc ec;
+};
+
+// Workalike compatibility version of std::to_chars from C++17, for `double`
+// only and only in the default (shortest) form.
+//
+// Writes the shortest decimal representation of `value` into [first, last)
+// that `absl::from_chars` (or strtod) parses back to exactly `value`,
+// choosing between fixed and scientific notation in the style of printf's
+// "%g". The output is not NUL-terminated. Digits are produced with a
+// shortest-representation algorithm rather than repeated trial formatting,
+// which makes this substantially faster than snprintf for round-trippable
+// output.
+//
+// Infinities and NaN are written as "inf" and "nan" (with a leading '-' for
+// negative infinity), matching printf.
+absl::to_chars_result to_chars(absl::Nonnull<char*> first,
+                               absl::Nonnull<char*> last, double value);
+
 // std::chars_format is specified as a bitmask type, which means the following
 // operations must be provided:
 inline constexpr chars_format operator&(chars_format lhs, chars_format rhs) {
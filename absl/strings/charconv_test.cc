@@ -16,13 +16,22 @@
 
 #include <cfloat>
 #include <cmath>
+#include <cstdint>
 #include <cstdlib>
 #include <functional>
 #include <limits>
+#include <random>
 #include <string>
 #include <system_error>  // NOLINT(build/c++11)
 
+#if defined(__has_include)
+#if __has_include(<charconv>)
+#include <charconv>  // NOLINT(build/c++17)
+#endif
+#endif
+
 #include "gtest/gtest.h"
+#include "absl/base/casts.h"
 #include "absl/strings/internal/pow10_helper.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_format.h"
@@ -784,4 +793,98 @@ TEST(FromChars, DecimalFloatLimits) {
   TestOverflowAndUnderflow<float>(input_gen, expected_gen, -45, 38);
 }
 
+// Formats `d` with absl::to_chars and returns the result as a string.
+std::string ToCharsString(double d) {
+  char buf[64];
+  absl::to_chars_result result = absl::to_chars(buf, buf + sizeof(buf), d);
+  EXPECT_EQ(result.ec, std::errc());
+  return std::string(buf, result.ptr);
+}
+
+TEST(ToChars, BasicValues) {
+  EXPECT_EQ(ToCharsString(0.0), "0");
+  EXPECT_EQ(ToCharsString(-0.0), "-0");
+  EXPECT_EQ(ToCharsString(1.0), "1");
+  EXPECT_EQ(ToCharsString(-1.0), "-1");
+  EXPECT_EQ(ToCharsString(120.0), "120");
+  EXPECT_EQ(ToCharsString(0.1), "0.1");
+  EXPECT_EQ(ToCharsString(2.5), "2.5");
+  EXPECT_EQ(ToCharsString(0.3), "0.3");
+  // Notation follows std::to_chars: whichever of fixed and scientific is
+  // shorter, with fixed preferred on ties.
+  EXPECT_EQ(ToCharsString(1e10), "1e+10");
+  EXPECT_EQ(ToCharsString(0.0001), "1e-04");
+  EXPECT_EQ(ToCharsString(0.001), "0.001");
+  EXPECT_EQ(ToCharsString(1e100), "1e+100");
+  // Large integers in fixed notation are printed exactly, as printf does.
+  EXPECT_EQ(ToCharsString(1.0534291795678276e19), "10534291795678275584");
+}
+
+TEST(ToChars, Extremes) {
+  EXPECT_EQ(ToCharsString(std::numeric_limits<double>::max()),
+            "1.7976931348623157e+308");
+  EXPECT_EQ(ToCharsString(std::numeric_limits<double>::min()),
+            "2.2250738585072014e-308");
+  EXPECT_EQ(ToCharsString(std::numeric_limits<double>::denorm_min()),
+            "5e-324");
+  EXPECT_EQ(ToCharsString(-std::numeric_limits<double>::denorm_min()),
+            "-5e-324");
+  EXPECT_EQ(ToCharsString(std::numeric_limits<double>::infinity()), "inf");
+  EXPECT_EQ(ToCharsString(-std::numeric_limits<double>::infinity()), "-inf");
+  EXPECT_EQ(ToCharsString(std::numeric_limits<double>::quiet_NaN()), "nan");
+}
+
+TEST(ToChars, BufferTooSmall) {
+  char buf[8];
+  absl::to_chars_result result = absl::to_chars(buf, buf + sizeof(buf), 0.1);
+  EXPECT_EQ(result.ec, std::errc());
+  EXPECT_EQ(absl::string_view(buf, static_cast<size_t>(result.ptr - buf)),
+            "0.1");
+  result = absl::to_chars(buf, buf + sizeof(buf), 1.0 / 3.0);
+  EXPECT_EQ(result.ec, std::errc::value_too_large);
+  EXPECT_EQ(result.ptr, buf + sizeof(buf));
+  result = absl::to_chars(buf, buf, 1.0);
+  EXPECT_EQ(result.ec, std::errc::value_too_large);
+}
+
+TEST(ToChars, RoundTripsThroughFromChars) {
+  std::minstd_rand rng(0xabcdef);
+  std::uniform_int_distribution<uint64_t> bit_gen;
+  int tested = 0;
+  for (int i = 0; tested < 250000; ++i) {
+    // Mix arbitrary bit patterns with subnormals and values near integers.
+    uint64_t bits = bit_gen(rng);
+    if (i % 3 == 1) bits &= 0xFFFFFFFFFFFFFull;
+    if (i % 3 == 2) bits %= 0x4340000000000000ull;
+    const double d = absl::bit_cast<double>(bits);
+    if (std::isnan(d) || std::isinf(d)) continue;
+    ++tested;
+    const std::string s = ToCharsString(d);
+    double readback;
+    absl::from_chars_result from = absl::from_chars(
+        s.data(), s.data() + s.size(), readback);
+    ASSERT_EQ(from.ec, std::errc()) << s;
+    ASSERT_EQ(from.ptr, s.data() + s.size()) << s;
+    ASSERT_EQ(absl::bit_cast<uint64_t>(readback), bits) << s;
+  }
+}
+
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+TEST(ToChars, MatchesStdToChars) {
+  std::minstd_rand rng(0x123987);
+  std::uniform_int_distribution<uint64_t> bit_gen;
+  for (int i = 0; i < 250000; ++i) {
+    uint64_t bits = bit_gen(rng);
+    if (i % 3 == 1) bits &= 0xFFFFFFFFFFFFFull;
+    if (i % 3 == 2) bits %= 0x4340000000000000ull;
+    const double d = absl::bit_cast<double>(bits);
+    if (std::isnan(d)) continue;
+    char buf[64];
+    std::to_chars_result expected = std::to_chars(buf, buf + sizeof(buf), d);
+    ASSERT_EQ(ToCharsString(d),
+              std::string(buf, static_cast<size_t>(expected.ptr - buf)));
+  }
+}
+#endif  // __cpp_lib_to_chars >= 201611L
+
 }  // namespace
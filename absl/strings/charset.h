@@ -159,6 +159,34 @@ class CharSet {
   uint64_t m_[4];
 };
 
+// FindFirstOf()
+//
+// Returns the position of the first character in `s` at or after `pos` that
+// is contained in `set`, or `absl::string_view::npos` if there is none. This
+// is equivalent to `s.find_first_of(chars, pos)` for a string `chars`
+// containing the same characters, but tests membership with a single bit
+// probe per input character regardless of the size of the set, where
+// `find_first_of` may rescan the set for every character. Callers matching
+// many strings against the same set should build the `CharSet` once (it is
+// constexpr) and reuse it.
+inline size_t FindFirstOf(absl::string_view s, CharSet set, size_t pos = 0) {
+  for (size_t i = pos; i < s.size(); ++i) {
+    if (set.contains(s[i])) return i;
+  }
+  return absl::string_view::npos;
+}
+
+// FindFirstNotOf()
+//
+// Like `FindFirstOf()`, but returns the position of the first character at or
+// after `pos` that is *not* contained in `set`.
+inline size_t FindFirstNotOf(absl::string_view s, CharSet set, size_t pos = 0) {
+  for (size_t i = pos; i < s.size(); ++i) {
+    if (!set.contains(s[i])) return i;
+  }
+  return absl::string_view::npos;
+}
+
 }  // namespace absl
 
 #endif  // ABSL_STRINGS_CHARSET_H_
@@ -178,4 +178,39 @@ TEST(CharmapCtype, Match) {
   }
 }
 
+TEST(FindFirstOf, Basics) {
+  constexpr absl::CharSet kVowels("aeiou");
+  EXPECT_EQ(2, absl::FindFirstOf("xyaz", kVowels));
+  EXPECT_EQ(0, absl::FindFirstOf("axyz", kVowels));
+  EXPECT_EQ(absl::string_view::npos, absl::FindFirstOf("xyz", kVowels));
+  EXPECT_EQ(absl::string_view::npos, absl::FindFirstOf("", kVowels));
+  EXPECT_EQ(absl::string_view::npos, absl::FindFirstOf("aeiou", absl::CharSet()));
+
+  // The `pos` argument skips earlier occurrences.
+  EXPECT_EQ(3, absl::FindFirstOf("abca", kVowels, 1));
+  EXPECT_EQ(absl::string_view::npos, absl::FindFirstOf("abc", kVowels, 3));
+
+  // Characters with the high bit set are handled like any others.
+  const absl::CharSet high("\x80\xff");
+  EXPECT_EQ(1, absl::FindFirstOf("a\xffz", high));
+
+  // Results agree with string_view::find_first_of for every position.
+  const absl::string_view chars = "0aZ~\t";
+  const absl::CharSet set(chars);
+  const absl::string_view subject = "some text\twith 0 and Z and ~ in it";
+  for (size_t pos = 0; pos <= subject.size(); ++pos) {
+    EXPECT_EQ(subject.find_first_of(chars, pos),
+              absl::FindFirstOf(subject, set, pos))
+        << pos;
+  }
+}
+
+TEST(FindFirstNotOf, Basics) {
+  constexpr absl::CharSet kDigits = absl::CharSet::AsciiDigits();
+  EXPECT_EQ(3, absl::FindFirstNotOf("123a45", kDigits));
+  EXPECT_EQ(absl::string_view::npos, absl::FindFirstNotOf("123", kDigits));
+  EXPECT_EQ(5, absl::FindFirstNotOf("12a34x", kDigits, 3));
+  EXPECT_EQ(0, absl::FindFirstNotOf("abc", absl::CharSet()));
+}
+
 }  // namespace
@@ -596,6 +596,36 @@ void Cord::Append(T&& src) {
 
 template void Cord::Append(std::string&& src);
 
+Cord MakeCord(absl::Span<Cord> cords) {
+  auto constexpr method = CordzUpdateTracker::kConstructorCord;
+
+  // Collect a rep for every non-empty input, consuming the inputs: tree reps
+  // are detached from their source cord and inline data is copied into a flat
+  // node. Expected checksums do not propagate into the combined cord.
+  absl::InlinedVector<CordRep*, 16> reps;
+  for (Cord& cord : cords) {
+    if (cord.empty()) continue;
+    if (cord.contents_.is_tree()) {
+      reps.push_back(cord_internal::RemoveCrcNode(std::move(cord).TakeRep()));
+    } else {
+      absl::string_view data(cord.contents_.data(), cord.contents_.size());
+      reps.push_back(CordRepFlat::Create(data));
+      cord.Clear();
+    }
+  }
+
+  if (reps.empty()) return Cord();
+
+  Cord result;
+  if (reps.size() == 1) {
+    result.contents_.EmplaceTree(reps.front(), method);
+  } else {
+    result.contents_.EmplaceTree(CordRepBtree::Create(absl::MakeSpan(reps)),
+                                 method);
+  }
+  return result;
+}
+
 void Cord::Prepend(const Cord& src) {
   contents_.MaybeRemoveEmptyCrcNode();
   if (src.empty()) return;
@@ -788,7 +818,12 @@ int CompareChunks(absl::Nonnull<absl::string_view*> lhs,
   assert(*size_to_compare >= compared_size);
   *size_to_compare -= compared_size;
 
-  int memcmp_res = ::memcmp(lhs->data(), rhs->data(), compared_size);
+  // Chunks referencing the same memory are trivially equal: cords commonly
+  // share data edges with cords they were (partially) copied from, in which
+  // case both sides iterate over the very same buffers.
+  int memcmp_res = lhs->data() == rhs->data()
+                       ? 0
+                       : ::memcmp(lhs->data(), rhs->data(), compared_size);
   if (memcmp_res != 0) return memcmp_res;
 
   lhs->remove_prefix(compared_size);
@@ -897,6 +932,62 @@ absl::optional<uint32_t> Cord::ExpectedChecksum() const {
       contents_.tree()->crc()->crc_cord_state.Checksum());
 }
 
+CordVerifyingChunkReader::CordVerifyingChunkReader(const Cord& cord)
+    : cord_(&cord), chunk_iter_(cord.chunk_begin()) {
+  const crc_internal::CrcCordState* state = cord.MaybeGetCrcCordState();
+  if (state != nullptr && state->NumChunks() > 0) {
+    // CrcCordState is copy-on-write, so this copies a pointer, not the chunked
+    // checksum data.
+    state_ = *state;
+    has_expected_checksum_ = true;
+  }
+}
+
+absl::optional<absl::string_view> CordVerifyingChunkReader::Next() {
+  if (chunk_iter_ == cord_->chunk_end()) {
+    done_ = true;
+    return absl::nullopt;
+  }
+  absl::string_view chunk = *chunk_iter_;
+  ++chunk_iter_;
+  ExtendAndCheck(chunk);
+  return chunk;
+}
+
+void CordVerifyingChunkReader::ExtendAndCheck(absl::string_view chunk) {
+  if (!has_expected_checksum_) return;
+  while (!chunk.empty()) {
+    // Extend at most up to the next stored prefix boundary, so that the
+    // running crc can be compared against every stored prefix crc. The
+    // cord's data chunks need not line up with the checksummed chunks.
+    size_t len = chunk.size();
+    if (next_prefix_ < state_.NumChunks()) {
+      size_t boundary =
+          state_.NormalizedPrefixCrcAtNthChunk(next_prefix_).length;
+      if (boundary > bytes_read_) {
+        len = (std::min)(len, boundary - bytes_read_);
+      }
+    }
+    crc_ = absl::ExtendCrc32c(crc_, chunk.substr(0, len));
+    bytes_read_ += len;
+    chunk.remove_prefix(len);
+    while (next_prefix_ < state_.NumChunks()) {
+      const crc_internal::CrcCordState::PrefixCrc prefix =
+          state_.NormalizedPrefixCrcAtNthChunk(next_prefix_);
+      if (prefix.length > bytes_read_) break;
+      if (prefix.length == bytes_read_ && crc_ != prefix.crc) {
+        mismatch_ = true;
+      }
+      ++next_prefix_;
+    }
+  }
+}
+
+bool CordVerifyingChunkReader::Verified() const {
+  return has_expected_checksum_ && done_ && !mismatch_ &&
+         bytes_read_ == cord_->size() && crc_ == state_.Checksum();
+}
+
 inline int Cord::CompareSlowPath(absl::string_view rhs, size_t compared_size,
                                  size_t size_to_compare) const {
   auto advance = [](absl::Nonnull<Cord::ChunkIterator*> it,
@@ -981,7 +1072,10 @@ ResultType GenericCompare(const Cord& lhs, const RHS& rhs,
 
   size_t compared_size = std::min(lhs_chunk.size(), rhs_chunk.size());
   assert(size_to_compare >= compared_size);
-  int memcmp_res = ::memcmp(lhs_chunk.data(), rhs_chunk.data(), compared_size);
+  int memcmp_res =
+      lhs_chunk.data() == rhs_chunk.data()
+          ? 0
+          : ::memcmp(lhs_chunk.data(), rhs_chunk.data(), compared_size);
   if (compared_size == size_to_compare || memcmp_res != 0) {
     return ComputeCompareResult<ResultType>(memcmp_res);
   }
@@ -1207,6 +1301,13 @@ bool IsSubstringInCordAt(absl::Cord::CharIterator position,
   }
 }
 
+// The maximum needle size for which `Cord::FindImpl()` searches whole chunks
+// at a time, stitching together a small window of bytes around each chunk
+// boundary to catch matches that straddle chunks. The window holds up to
+// `kMaxBoundaryNeedle - 1` bytes on either side of a boundary, which covers
+// every position at which a straddling match can start or end.
+constexpr size_t kMaxBoundaryNeedle = 64;
+
 }  // namespace
 
 // A few options how this could be implemented:
@@ -1224,7 +1325,12 @@ bool IsSubstringInCordAt(absl::Cord::CharIterator position,
 // (c) Use string_view::find in each fragment, and specifically handle fragment
 //     boundaries.
 //
-// This currently implements option (b).
+// This currently implements option (c) for needles up to `kMaxBoundaryNeedle`
+// bytes: `string_view::find()` delegates to the vectorized `memchr()` and
+// `memcmp()` library routines inside each chunk, and matches straddling a
+// chunk boundary are found by searching a small window stitched together from
+// the bytes on both sides of the boundary. Larger needles fall back to
+// option (b).
 absl::Cord::CharIterator absl::Cord::FindImpl(CharIterator it,
                                               absl::string_view needle) const {
   // Ensure preconditions are met by callers first.
@@ -1234,6 +1340,55 @@ absl::Cord::CharIterator absl::Cord::FindImpl(CharIterator it,
   // Haystack must be at least as large as needle.
   assert(it.chunk_iterator_.bytes_remaining_ >= needle.size());
 
+  const size_t needle_size = needle.size();
+  if (needle_size <= kMaxBoundaryNeedle) {
+    // `overlap` carries the last `needle_size - 1` bytes preceding the
+    // current chunk - exactly the positions where a match straddling the
+    // chunk boundary can start - with `tail` the number of carried bytes.
+    const CharIterator start = it;
+    size_t scanned = 0;  // Number of bytes scanned before the current chunk.
+    char overlap[2 * (kMaxBoundaryNeedle - 1)];
+    size_t tail = 0;
+    while (it.chunk_iterator_.bytes_remaining_ > 0) {
+      const absl::string_view chunk = Cord::ChunkRemaining(it);
+      assert(!chunk.empty());
+      if (tail > 0) {
+        // Check for a match beginning in the carried bytes and extending
+        // into this chunk.
+        const size_t head = (std::min)(needle_size - 1, chunk.size());
+        memcpy(overlap + tail, chunk.data(), head);
+        const size_t pos = absl::string_view(overlap, tail + head).find(needle);
+        if (pos < tail) {
+          CharIterator match = start;
+          Cord::Advance(&match, scanned - tail + pos);
+          return match;
+        }
+      }
+      // Check for a match contained entirely within this chunk.
+      const size_t pos = chunk.find(needle);
+      if (pos != absl::string_view::npos) {
+        CharIterator match = start;
+        Cord::Advance(&match, scanned + pos);
+        return match;
+      }
+      // Carry the trailing bytes of this chunk, prefixed by previously
+      // carried bytes if the chunk itself is too short, over to the next.
+      if (chunk.size() >= needle_size - 1) {
+        tail = needle_size - 1;
+        memcpy(overlap, chunk.data() + chunk.size() - tail, tail);
+      } else {
+        const size_t keep = (std::min)(tail + chunk.size(), needle_size - 1);
+        const size_t from_tail = keep - chunk.size();
+        memmove(overlap, overlap + tail - from_tail, from_tail);
+        memcpy(overlap + from_tail, chunk.data(), chunk.size());
+        tail = keep;
+      }
+      scanned += chunk.size();
+      Cord::Advance(&it, chunk.size());
+    }
+    return char_end();
+  }
+
   // Cord is a sequence of chunks. To find `needle` we go chunk by chunk looking
   // for the first char of needle, up until we have advanced `N` defined as
   // `haystack.size() - needle.size()`. If we find the first char of needle at
@@ -1397,6 +1552,56 @@ absl::string_view Cord::FlattenSlowPath() {
   return absl::string_view(new_buffer, total_size);
 }
 
+void Cord::Compact() {
+  if (contents_.tree() == nullptr) return;
+
+  // Only rewrite if fragmentation is significant: the cord must hold more
+  // than twice the number of chunks of a dense packing into maximum size
+  // flat nodes. This makes repeated calls on compacted cords cheap.
+  const size_t total_size = size();
+  size_t num_chunks = 0;
+  for (absl::string_view chunk : Chunks()) {
+    static_cast<void>(chunk);
+    ++num_chunks;
+  }
+  if (num_chunks <= 2 * (total_size / kMaxFlatLength + 1)) return;
+
+  // Copy the contents into a sequence of full flat nodes, and build a
+  // balanced tree over them in a single bottom-up pass.
+  absl::InlinedVector<CordRep*, 16> flats;
+  CordRepFlat* flat = nullptr;
+  size_t offset = 0;
+  size_t target = 0;
+  size_t remaining = total_size;
+  for (absl::string_view chunk : Chunks()) {
+    while (!chunk.empty()) {
+      if (flat == nullptr) {
+        target = (std::min)(remaining, kMaxFlatLength);
+        flat = CordRepFlat::New(target);
+        offset = 0;
+      }
+      const size_t n = (std::min)(chunk.size(), target - offset);
+      memcpy(flat->Data() + offset, chunk.data(), n);
+      offset += n;
+      chunk.remove_prefix(n);
+      remaining -= n;
+      if (offset == target) {
+        flat->length = target;
+        flats.push_back(flat);
+        flat = nullptr;
+      }
+    }
+  }
+  assert(flat == nullptr && remaining == 0);
+
+  CordRep* new_rep = flats.size() == 1
+                         ? flats.front()
+                         : CordRepBtree::Create(absl::MakeSpan(flats));
+  CordzUpdateScope scope(contents_.cordz_info(), CordzUpdateTracker::kFlatten);
+  CordRep::Unref(contents_.as_tree());
+  contents_.SetTree(new_rep, scope);
+}
+
 /* static */ bool Cord::GetFlatAux(absl::Nonnull<CordRep*> rep,
                                    absl::Nonnull<absl::string_view*> fragment) {
   assert(rep != nullptr);
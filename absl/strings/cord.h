@@ -78,6 +78,7 @@
 #include "absl/base/optimization.h"
 #include "absl/base/port.h"
 #include "absl/container/inlined_vector.h"
+#include "absl/crc/crc32c.h"
 #include "absl/crc/internal/crc_cord_state.h"
 #include "absl/functional/function_ref.h"
 #include "absl/meta/type_traits.h"
@@ -98,6 +99,7 @@
 #include "absl/strings/string_view.h"
 #include "absl/types/compare.h"
 #include "absl/types/optional.h"
+#include "absl/types/span.h"
 
 namespace absl {
 ABSL_NAMESPACE_BEGIN
@@ -105,6 +107,7 @@ class Cord;
 class CordTestPeer;
 template <typename Releaser>
 Cord MakeCordFromExternal(absl::string_view, Releaser&&);
+Cord MakeCord(absl::Span<Cord> cords);
 void CopyCordToString(const Cord& src, absl::Nonnull<std::string*> dst);
 void AppendCordToString(const Cord& src, absl::Nonnull<std::string*> dst);
 
@@ -136,6 +139,15 @@ enum class CordMemoryAccounting {
   // on "how much memory is potentially held / kept alive by this cord?"
   kTotalMorePrecise,
 
+  // A cheaper variant of `kTotal` that inspects only one root-to-leaf path of
+  // the representation - O(log size) rather than O(chunks) - and extrapolates
+  // the rest. The result is exact for small cords and close to `kTotal` when
+  // the cord was built from similarly-sized pieces, but can be proportionally
+  // off for cords mixing very large and very small chunks. Intended for
+  // frequent calls such as per-request memory accounting, where walking every
+  // chunk is too expensive.
+  kTotalFast,
+
   // Counts the *approximate* number of bytes held in full or in part by this
   // Cord weighted by the sharing ratio of that data. For example, if some data
   // edge is shared by 4 different Cords, then each cord is attributed 1/4th of
@@ -253,6 +265,18 @@ class Cord {
   template <typename Releaser>
   friend Cord MakeCordFromExternal(absl::string_view data, Releaser&& releaser);
 
+  // MakeCord()
+  //
+  // Creates a Cord containing the concatenated contents of all `cords`, in
+  // order, consuming the inputs: each input cord is left empty. The combined
+  // tree is built in a single bottom-up pass over the data of all inputs,
+  // which produces a fully balanced tree with densely packed nodes. When
+  // combining many cords this is substantially cheaper than appending them
+  // one at a time, which rewrites the right-most path of the accumulated tree
+  // on every append. Any expected checksums on the inputs (see
+  // `SetExpectedChecksum()`) are discarded.
+  friend Cord MakeCord(absl::Span<Cord> cords);
+
   // Cord::Clear()
   //
   // Releases the Cord data. Any nodes that share data with other Cords, if
@@ -321,6 +345,51 @@ class Cord {
   CordBuffer GetCustomAppendBuffer(size_t block_size, size_t capacity,
                                    size_t min_capacity = 16);
 
+  // Cord::Appender
+  //
+  // An accumulator for high frequency appends of small fragments of data.
+  // Appending small fragments directly to a cord pays tree bookkeeping costs
+  // per call. An Appender instead copies appended data into a private
+  // `CordBuffer` and only appends to the bound cord when that buffer fills
+  // up, when `Flush()` is called, or when the Appender is destroyed, yielding
+  // the same cord contents through far fewer, larger tree updates. Large
+  // appends are passed through to the cord directly and are not copied.
+  //
+  // Example:
+  //
+  //   {
+  //     absl::Cord::Appender appender(&cord);
+  //     for (absl::string_view line : lines) {
+  //       appender.Append(line);
+  //     }
+  //   }  // Remaining buffered data is appended to `cord` here.
+  //
+  // The bound cord must outlive the Appender. Data passed to `Append()` is
+  // only guaranteed to be visible in the cord after `Flush()` is called or
+  // the Appender is destroyed; the cord should not be read or modified
+  // through other means in between. Appender is neither copyable nor movable.
+  class Appender {
+   public:
+    // Creates an Appender accumulating appends to `cord`.
+    explicit Appender(absl::Nonnull<Cord*> cord);
+
+    // Appends any remaining buffered data to the bound cord.
+    ~Appender();
+
+    Appender(const Appender&) = delete;
+    Appender& operator=(const Appender&) = delete;
+
+    // Appends `src` to the bound cord, buffering small fragments.
+    void Append(absl::string_view src);
+
+    // Appends all currently buffered data to the bound cord.
+    void Flush();
+
+   private:
+    absl::Nonnull<Cord*> cord_;
+    CordBuffer buffer_;
+  };
+
   // Cord::Prepend()
   //
   // Prepends data to the Cord, which may come from another Cord or other string
@@ -770,6 +839,21 @@ class Cord {
   // If the cord was already flat, the contents are not modified.
   absl::string_view Flatten() ABSL_ATTRIBUTE_LIFETIME_BOUND;
 
+  // Cord::Compact()
+  //
+  // Rewrites a heavily fragmented cord into densely packed, maximum-size flat
+  // chunks. Cords that have been edited many times can accumulate large
+  // numbers of small chunks and deep substring nodes, which slows down chunk
+  // iteration and inflates memory overhead. `Compact()` rewrites such cords
+  // into the minimal number of chunks; cords that are already reasonably
+  // dense are not modified, so calling it repeatedly is cheap.
+  //
+  // Unlike `Flatten()` this never allocates a single contiguous buffer for
+  // the whole cord, making it suitable for arbitrarily large cords, e.g. at
+  // cache insertion time. As with other mutating operations, a compacted
+  // cord loses its expected checksum (see `SetExpectedChecksum()`).
+  void Compact();
+
   // Cord::Find()
   //
   // Returns an iterator to the first occurrance of the substring `needle`.
@@ -821,6 +905,16 @@ class Cord {
     if (maybe_flat.has_value()) {
       return H::combine(std::move(hash_state), *maybe_flat);
     }
+    // Small fragmented cords are copied into a stack buffer and hashed as a
+    // single contiguous range: one combine_contiguous call is cheaper than
+    // feeding each chunk through the piecewise combiner, and the hash
+    // expansion is identical to that of the equivalent flattened string.
+    if (c.size() <= cord_internal::kMaxBytesToCopy) {
+      char buf[cord_internal::kMaxBytesToCopy];
+      c.CopyToArrayImpl(buf);
+      return H::combine(std::move(hash_state),
+                        absl::string_view(buf, c.size()));
+    }
     return c.HashFragmented(std::move(hash_state));
   }
 
@@ -1107,6 +1201,7 @@ class Cord {
   }
 
   friend class CrcCord;
+  friend class CordVerifyingChunkReader;
   void SetCrcCordState(crc_internal::CrcCordState state);
   absl::Nullable<const crc_internal::CrcCordState*> MaybeGetCrcCordState()
       const;
@@ -1125,6 +1220,61 @@ ABSL_NAMESPACE_BEGIN
 // allow a Cord to be logged
 extern std::ostream& operator<<(std::ostream& out, const Cord& cord);
 
+// CordVerifyingChunkReader
+//
+// An iterator-style reader that yields the chunks of a cord while
+// incrementally extending a CRC32C value over the bytes it returns, verifying
+// the data against the checksum stored by `Cord::SetExpectedChecksum()`. When
+// the cord carries finer-grained chunked CRC32C data, every stored prefix
+// checksum is verified as the reader passes it. This allows a read path that
+// already copies the cord's data out to validate it in the same pass, instead
+// of scanning the cord a second time.
+//
+// Example:
+//
+//   absl::CordVerifyingChunkReader reader(cord);
+//   while (absl::optional<absl::string_view> chunk = reader.Next()) {
+//     sink.Append(*chunk);
+//   }
+//   if (!reader.Verified()) {
+//     // Data did not match the cord's expected checksum.
+//   }
+//
+// The cord must outlive the reader and must not be modified while the reader
+// is in use.
+class CordVerifyingChunkReader {
+ public:
+  explicit CordVerifyingChunkReader(const Cord& cord ABSL_ATTRIBUTE_LIFETIME_BOUND);
+
+  // Returns true if the cord carries an expected checksum. When false, the
+  // reader still yields all chunks, but `Verified()` always returns false.
+  bool HasExpectedChecksum() const { return has_expected_checksum_; }
+
+  // Returns the next chunk of the cord, or `absl::nullopt` once all data has
+  // been returned.
+  absl::optional<absl::string_view> Next();
+
+  // Returns true if the cord carried an expected checksum, all of its data
+  // has been read through `Next()`, and the checksum of the returned bytes
+  // matched the expected checksum, including every intermediate prefix
+  // checksum stored in the cord's chunked CRC32C state.
+  bool Verified() const;
+
+ private:
+  void ExtendAndCheck(absl::string_view chunk);
+
+  const Cord* cord_;
+  Cord::ChunkIterator chunk_iter_;
+  crc_internal::CrcCordState state_;
+  absl::crc32c_t crc_{0};
+  size_t bytes_read_ = 0;
+  // Index of the first prefix in `state_` that `bytes_read_` has not reached.
+  size_t next_prefix_ = 0;
+  bool has_expected_checksum_ = false;
+  bool done_ = false;
+  bool mismatch_ = false;
+};
+
 // ------------------------------------------------------------------
 // Internal details follow.  Clients should ignore.
 
@@ -1394,6 +1544,9 @@ inline size_t Cord::EstimatedMemoryUsage(
       case CordMemoryAccounting::kTotalMorePrecise:
         result += cord_internal::GetMorePreciseMemoryUsage(rep);
         break;
+      case CordMemoryAccounting::kTotalFast:
+        result += cord_internal::GetFastEstimatedMemoryUsage(rep);
+        break;
       case CordMemoryAccounting::kTotal:
         result += cord_internal::GetEstimatedMemoryUsage(rep);
         break;
@@ -1473,6 +1626,43 @@ inline CordBuffer Cord::GetCustomAppendBuffer(size_t block_size,
   return GetAppendBufferSlowPath(block_size, capacity, min_capacity);
 }
 
+inline Cord::Appender::Appender(absl::Nonnull<Cord*> cord)
+    : cord_(cord),
+      buffer_(CordBuffer::CreateWithDefaultLimit(CordBuffer::kDefaultLimit)) {}
+
+inline Cord::Appender::~Appender() {
+  if (buffer_.length() > 0) cord_->Append(std::move(buffer_));
+}
+
+inline void Cord::Appender::Flush() {
+  if (buffer_.length() > 0) {
+    cord_->Append(std::move(buffer_));
+    buffer_ = CordBuffer::CreateWithDefaultLimit(CordBuffer::kDefaultLimit);
+  }
+}
+
+inline void Cord::Appender::Append(absl::string_view src) {
+  while (!src.empty()) {
+    absl::Span<char> space = buffer_.available();
+    if (space.empty()) {
+      cord_->Append(std::move(buffer_));
+      if (src.size() >= CordBuffer::MaximumPayload()) {
+        // A large remainder gains nothing from being copied through fixed
+        // size buffers: append it through the regular path.
+        cord_->Append(src);
+        buffer_ = CordBuffer::CreateWithDefaultLimit(CordBuffer::kDefaultLimit);
+        return;
+      }
+      buffer_ = CordBuffer::CreateWithDefaultLimit(CordBuffer::kDefaultLimit);
+      space = buffer_.available();
+    }
+    const size_t n = (std::min)(space.size(), src.size());
+    memcpy(space.data(), src.data(), n);
+    buffer_.IncreaseLengthBy(n);
+    src.remove_prefix(n);
+  }
+}
+
 extern template void Cord::Append(std::string&& src);
 extern template void Cord::Prepend(std::string&& src);
 
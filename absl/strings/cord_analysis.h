@@ -31,6 +31,14 @@ namespace cord_internal {
 // memory could each be "charged" independently for the same shared memory.
 size_t GetEstimatedMemoryUsage(absl::Nonnull<const CordRep*> rep);
 
+// Returns an O(height) approximation of `GetEstimatedMemoryUsage()` computed
+// from a single root-to-leaf path instead of a full tree walk. Node counts
+// per level are extrapolated from the fanout along the path and data edge
+// memory from one sampled leaf, so the estimate is exact for cords that fit
+// in a single leaf with uniform edges and proportionally off where fanout or
+// flat sizes vary across the tree.
+size_t GetFastEstimatedMemoryUsage(absl::Nonnull<const CordRep*> rep);
+
 // Returns the *approximate* number of bytes held in full or in part by this
 // Cord for the distinct memory held by this cord. This is similar to
 // `GetEstimatedMemoryUsage()`, except that if the cord has multiple references
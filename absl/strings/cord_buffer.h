@@ -42,6 +42,7 @@ namespace absl {
 ABSL_NAMESPACE_BEGIN
 
 class Cord;
+class CordBufferPool;
 class CordBufferTestPeer;
 
 // CordBuffer
@@ -115,7 +116,11 @@ class CordBuffer {
   // Maximum size for CreateWithCustomLimit() allocated buffers.
   // Note that the effective capacity may be slightly less
   // because of internal overhead of internal cord buffers.
-  static constexpr size_t kCustomLimit = 64U << 10;
+  // Buffers in the hundreds of KB to MB range are intended for bulk data
+  // paths storing very large (multi-GB) cords, where larger chunks greatly
+  // reduce tree depth and per-node overhead. Most applications should use
+  // much smaller limits; see `CreateWithCustomLimit()` for guidance.
+  static constexpr size_t kCustomLimit = 2U << 20;
 
   // Constructors, Destructors and Assignment Operators
 
@@ -289,7 +294,7 @@ class CordBuffer {
 
  private:
   // Make sure we don't accidentally over promise.
-  static_assert(kCustomLimit <= cord_internal::kMaxLargeFlatSize, "");
+  static_assert(kCustomLimit <= cord_internal::kMaxHugeFlatSize, "");
 
   // Assume the cost of an 'uprounded' allocation to CeilPow2(size) versus
   // the cost of allocating at least 1 extra flat <= 4KB:
@@ -451,6 +456,7 @@ class CordBuffer {
   Rep rep_;
 
   friend class Cord;
+  friend class CordBufferPool;
   friend class CordBufferTestPeer;
 };
 
@@ -497,7 +503,7 @@ inline CordBuffer CordBuffer::CreateWithCustomLimitImpl(
     }
   }
   const size_t length = capacity - kOverhead;
-  auto* rep = CordRepFlat::New(CordRepFlat::Large(), length, hints...);
+  auto* rep = CordRepFlat::New(CordRepFlat::Huge(), length, hints...);
   rep->length = 0;
   return CordBuffer(rep);
 }
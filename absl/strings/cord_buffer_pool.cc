@@ -0,0 +1,102 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/strings/cord_buffer_pool.h"
+
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+#include "absl/base/config.h"
+#include "absl/strings/cord_buffer.h"
+#include "absl/strings/internal/cord_internal.h"
+#include "absl/strings/internal/cord_rep_flat.h"
+#include "absl/strings/string_view.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+#ifdef ABSL_INTERNAL_NEED_REDUNDANT_CONSTEXPR_DECL
+constexpr size_t CordBufferPool::kDefaultMaxPerSizeClass;
+#endif
+
+size_t CordBufferPool::SizeClassForCapacity(size_t capacity) {
+  using cord_internal::kFlatOverhead;
+  using cord_internal::kMaxFlatLength;
+  using cord_internal::kMinFlatLength;
+
+  // Mirrors the length clamping and size rounding performed by the
+  // allocation inside `CordBuffer::CreateWithDefaultLimit()`.
+  size_t length = capacity;
+  if (length <= kMinFlatLength) {
+    length = kMinFlatLength;
+  } else if (length > kMaxFlatLength) {
+    length = kMaxFlatLength;
+  }
+  const size_t size = cord_internal::RoundUpForTag(length + kFlatOverhead);
+  return cord_internal::AllocatedSizeToTag(size) - kMinTag;
+}
+
+CordBuffer CordBufferPool::CreateWithDefaultLimit(size_t capacity) {
+  if (capacity > CordBuffer::Rep::kInlineCapacity) {
+    std::vector<cord_internal::CordRepFlat*>& cache =
+        cache_[SizeClassForCapacity(capacity)];
+    if (!cache.empty()) {
+      cord_internal::CordRepFlat* rep = cache.back();
+      cache.pop_back();
+      assert(rep->length == 0);
+      return CordBuffer(rep);
+    }
+  }
+  return CordBuffer::CreateWithDefaultLimit(capacity);
+}
+
+void CordBufferPool::Recycle(CordBuffer buffer) {
+  absl::string_view short_value;
+  cord_internal::CordRep* rep = buffer.ConsumeValue(short_value);
+  if (rep == nullptr) return;  // Inlined representation: nothing to cache.
+  assert(rep->refcount.IsOne());
+  if (rep->tag > kMaxTag) {
+    // A large buffer from `CreateWithCustomLimit()`: not cached.
+    cord_internal::CordRepFlat::Delete(rep);
+    return;
+  }
+  std::vector<cord_internal::CordRepFlat*>& cache = cache_[rep->tag - kMinTag];
+  if (cache.size() >= max_per_size_class_) {
+    cord_internal::CordRepFlat::Delete(rep);
+    return;
+  }
+  rep->length = 0;
+  cache.push_back(rep->flat());
+}
+
+void CordBufferPool::Clear() {
+  for (std::vector<cord_internal::CordRepFlat*>& cache : cache_) {
+    for (cord_internal::CordRepFlat* rep : cache) {
+      cord_internal::CordRepFlat::Delete(rep);
+    }
+    cache.clear();
+  }
+}
+
+size_t CordBufferPool::cached_buffers() const {
+  size_t total = 0;
+  for (const std::vector<cord_internal::CordRepFlat*>& cache : cache_) {
+    total += cache.size();
+  }
+  return total;
+}
+
+ABSL_NAMESPACE_END
+}  // namespace absl
@@ -0,0 +1,162 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// -----------------------------------------------------------------------------
+// File: cord_buffer_pool.h
+// -----------------------------------------------------------------------------
+//
+// This file defines `absl::CordBufferPool`, a caller-owned cache of the flat
+// memory buffers backing `absl::CordBuffer`. Each call to
+// `CordBuffer::CreateWithDefaultLimit()` allocates a fresh buffer from the
+// heap, and each `CordBuffer` destroyed without being appended to a Cord
+// frees its buffer again. Applications that create and release buffers at a
+// high rate - for example a proxy that fills a buffer per network read and
+// discards it when the read fails or is cancelled - pay a full allocator
+// round trip per buffer. A `CordBufferPool` lets such applications recycle
+// released buffers instead: buffers are returned to the pool with
+// `Recycle()`, and subsequent `CreateWithDefaultLimit()` calls on the pool
+// satisfy requests of the same size class from the cache without touching
+// the allocator.
+
+#ifndef ABSL_STRINGS_CORD_BUFFER_POOL_H_
+#define ABSL_STRINGS_CORD_BUFFER_POOL_H_
+
+#include <cstddef>
+#include <vector>
+
+#include "absl/base/config.h"
+#include "absl/strings/cord_buffer.h"
+#include "absl/strings/internal/cord_internal.h"
+#include "absl/strings/internal/cord_rep_flat.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+// CordBufferPool
+//
+// CordBufferPool caches the flat buffers backing `CordBuffer` instances so
+// that applications creating and releasing buffers at a high rate can avoid
+// an allocator round trip per buffer. A typical use keeps one pool per
+// worker thread (or other single-threaded context) for the lifetime of that
+// worker:
+//
+//   absl::CordBufferPool pool;
+//   while (HasWork()) {
+//     absl::CordBuffer buffer = pool.CreateWithDefaultLimit(4096);
+//     absl::Span<char> data = buffer.available();
+//     if (!FillFromNetwork(data)) {
+//       pool.Recycle(std::move(buffer));  // Cached for the next iteration.
+//       continue;
+//     }
+//     buffer.IncreaseLengthBy(data.size());
+//     cord.Append(std::move(buffer));  // Ownership passes to the cord.
+//   }
+//
+// Buffers are cached per allocation size class using the same size classes
+// as the underlying cord buffer allocation, so a recycled buffer is only
+// reused for requests that would have produced the very same allocation
+// size. A request whose size class has no cached buffer falls back to a
+// regular heap allocation; recycling a buffer whose size class cache is full
+// frees it. The number of buffers cached per size class is bounded by the
+// constructor argument, so the memory retained by a pool is bounded by the
+// number of distinct buffer sizes the application uses.
+//
+// The pool only observes buffers explicitly handed to `Recycle()`. Buffers
+// appended to a Cord pass ownership to the cord and are freed through the
+// regular cord machinery when the cord no longer references them; they never
+// return to the pool. Buffers destroyed without being recycled simply free
+// their memory as usual.
+//
+// A CordBuffer created from a pool is indistinguishable from one created by
+// `CordBuffer::CreateWithDefaultLimit()`: it can be filled, appended to any
+// Cord, moved, destroyed, or recycled into any pool, and it does not
+// reference the pool it came from. The pool can therefore be destroyed while
+// buffers it created are still live.
+//
+// CordBufferPool is thread compatible. Concurrent use from multiple threads
+// requires external synchronization; high-rate applications are expected to
+// keep one pool per thread instead.
+class CordBufferPool {
+ public:
+  // kDefaultMaxPerSizeClass
+  //
+  // Default bound on the number of buffers cached per size class.
+  static constexpr size_t kDefaultMaxPerSizeClass = 64;
+
+  // Creates a pool caching at most `max_per_size_class` buffers per size
+  // class. The pool starts empty: it caches memory only as buffers are
+  // recycled, and never allocates ahead of demand.
+  explicit CordBufferPool(size_t max_per_size_class = kDefaultMaxPerSizeClass)
+      : max_per_size_class_(max_per_size_class) {}
+
+  // Destroys this pool, freeing all cached buffers. Buffers created from the
+  // pool that are still live are unaffected.
+  ~CordBufferPool() { Clear(); }
+
+  CordBufferPool(const CordBufferPool&) = delete;
+  CordBufferPool& operator=(const CordBufferPool&) = delete;
+
+  // CordBufferPool::CreateWithDefaultLimit()
+  //
+  // Creates a CordBuffer instance of the desired `capacity`, capped at the
+  // default limit `CordBuffer::kDefaultLimit`, reusing a cached buffer of
+  // the matching size class when one is available and allocating exactly as
+  // `CordBuffer::CreateWithDefaultLimit()` otherwise. The returned buffer
+  // has a zero length and the same capacity guarantees as a buffer created
+  // by `CordBuffer::CreateWithDefaultLimit()`.
+  CordBuffer CreateWithDefaultLimit(size_t capacity);
+
+  // CordBufferPool::Recycle()
+  //
+  // Returns `buffer` to this pool, making its memory available to future
+  // `CreateWithDefaultLimit()` calls of the same size class. Any data length
+  // set on the buffer is discarded; the buffer contents are not cleared.
+  // Buffers that do not own heap memory (small buffers using the inlined
+  // representation) and buffers whose size class cache is full are simply
+  // released. Buffers created with `CordBuffer::CreateWithCustomLimit()`
+  // beyond the default limit are accepted but freed rather than cached.
+  void Recycle(CordBuffer buffer);
+
+  // CordBufferPool::Clear()
+  //
+  // Frees all buffers cached by this pool.
+  void Clear();
+
+  // CordBufferPool::cached_buffers()
+  //
+  // Returns the number of buffers currently cached across all size classes.
+  size_t cached_buffers() const;
+
+ private:
+  // Cached buffers are keyed by their allocation tag, which identifies the
+  // allocated size exactly. Default limit buffers use the tag range for
+  // allocated sizes in [kMinFlatSize, kMaxFlatSize].
+  static constexpr size_t kMinTag = cord_internal::FLAT;
+  static constexpr size_t kMaxTag =
+      cord_internal::AllocatedSizeToTagUnchecked(cord_internal::kMaxFlatSize);
+  static constexpr size_t kNumSizeClasses = kMaxTag - kMinTag + 1;
+
+  // Returns the size class index of the allocation that
+  // `CordBuffer::CreateWithDefaultLimit(capacity)` would perform.
+  // Requires `capacity` to exceed the inlined representation capacity.
+  static size_t SizeClassForCapacity(size_t capacity);
+
+  const size_t max_per_size_class_;
+  std::vector<cord_internal::CordRepFlat*> cache_[kNumSizeClasses];
+};
+
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_STRINGS_CORD_BUFFER_POOL_H_
@@ -0,0 +1,145 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/strings/cord_buffer_pool.h"
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <utility>
+
+#include "gtest/gtest.h"
+#include "absl/strings/cord.h"
+#include "absl/strings/cord_buffer.h"
+#include "absl/types/span.h"
+
+namespace {
+
+TEST(CordBufferPoolTest, EmptyPoolAllocates) {
+  absl::CordBufferPool pool;
+  EXPECT_EQ(pool.cached_buffers(), 0);
+
+  absl::CordBuffer buffer = pool.CreateWithDefaultLimit(4000);
+  EXPECT_EQ(buffer.length(), 0);
+  EXPECT_GE(buffer.capacity(), 4000);
+  EXPECT_EQ(pool.cached_buffers(), 0);
+}
+
+TEST(CordBufferPoolTest, RecycledBufferIsReused) {
+  absl::CordBufferPool pool;
+  absl::CordBuffer buffer = pool.CreateWithDefaultLimit(4000);
+  const char* data = buffer.data();
+  const size_t capacity = buffer.capacity();
+  buffer.SetLength(100);
+
+  pool.Recycle(std::move(buffer));
+  EXPECT_EQ(pool.cached_buffers(), 1);
+
+  absl::CordBuffer reused = pool.CreateWithDefaultLimit(4000);
+  EXPECT_EQ(reused.data(), data);
+  EXPECT_EQ(reused.capacity(), capacity);
+  EXPECT_EQ(reused.length(), 0);
+  EXPECT_EQ(pool.cached_buffers(), 0);
+}
+
+TEST(CordBufferPoolTest, ReuseRequiresMatchingSizeClass) {
+  absl::CordBufferPool pool;
+  pool.Recycle(pool.CreateWithDefaultLimit(4000));
+  ASSERT_EQ(pool.cached_buffers(), 1);
+
+  // A request in a smaller size class does not take the cached buffer.
+  absl::CordBuffer small = pool.CreateWithDefaultLimit(100);
+  EXPECT_EQ(pool.cached_buffers(), 1);
+
+  // A request in the matching size class does.
+  absl::CordBuffer large = pool.CreateWithDefaultLimit(4000);
+  EXPECT_EQ(pool.cached_buffers(), 0);
+}
+
+TEST(CordBufferPoolTest, AcceptsBuffersFromDirectCreation) {
+  absl::CordBufferPool pool;
+  pool.Recycle(absl::CordBuffer::CreateWithDefaultLimit(4000));
+  EXPECT_EQ(pool.cached_buffers(), 1);
+}
+
+TEST(CordBufferPoolTest, InlinedBuffersAreNotCached) {
+  absl::CordBufferPool pool;
+  pool.Recycle(pool.CreateWithDefaultLimit(4));
+  pool.Recycle(absl::CordBuffer());
+  EXPECT_EQ(pool.cached_buffers(), 0);
+}
+
+TEST(CordBufferPoolTest, CustomLimitBuffersAreNotCached) {
+  absl::CordBufferPool pool;
+  pool.Recycle(absl::CordBuffer::CreateWithCustomLimit(64 << 10, 64 << 10));
+  EXPECT_EQ(pool.cached_buffers(), 0);
+}
+
+TEST(CordBufferPoolTest, CacheIsBoundedPerSizeClass) {
+  absl::CordBufferPool pool(2);
+  for (int i = 0; i < 5; ++i) {
+    pool.Recycle(absl::CordBuffer::CreateWithDefaultLimit(4000));
+  }
+  EXPECT_EQ(pool.cached_buffers(), 2);
+
+  // The bound applies per size class: a different class still caches.
+  pool.Recycle(absl::CordBuffer::CreateWithDefaultLimit(100));
+  EXPECT_EQ(pool.cached_buffers(), 3);
+}
+
+TEST(CordBufferPoolTest, ClearReleasesCachedBuffers) {
+  absl::CordBufferPool pool;
+  pool.Recycle(pool.CreateWithDefaultLimit(100));
+  pool.Recycle(pool.CreateWithDefaultLimit(4000));
+  ASSERT_EQ(pool.cached_buffers(), 2);
+
+  pool.Clear();
+  EXPECT_EQ(pool.cached_buffers(), 0);
+}
+
+TEST(CordBufferPoolTest, PooledBuffersAppendToCord) {
+  absl::CordBufferPool pool;
+  pool.Recycle(pool.CreateWithDefaultLimit(2000));
+
+  absl::Cord cord;
+  for (char c : {'a', 'b', 'c'}) {
+    absl::CordBuffer buffer = pool.CreateWithDefaultLimit(2000);
+    absl::Span<char> data = buffer.available_up_to(2000);
+    memset(data.data(), c, data.size());
+    buffer.IncreaseLengthBy(data.size());
+    cord.Append(std::move(buffer));
+  }
+
+  std::string expected;
+  for (char c : {'a', 'b', 'c'}) expected.append(2000, c);
+  EXPECT_EQ(cord, expected);
+}
+
+TEST(CordBufferPoolTest, PoolOutlivedByItsBuffers) {
+  absl::CordBuffer buffer;
+  {
+    absl::CordBufferPool pool;
+    pool.Recycle(pool.CreateWithDefaultLimit(1000));
+    buffer = pool.CreateWithDefaultLimit(1000);
+  }
+  absl::Span<char> data = buffer.available_up_to(10);
+  memset(data.data(), 'x', data.size());
+  buffer.IncreaseLengthBy(data.size());
+
+  absl::Cord cord;
+  cord.Append(std::move(buffer));
+  EXPECT_EQ(cord, "xxxxxxxxxx");
+}
+
+}  // namespace
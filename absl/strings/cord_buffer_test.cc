@@ -73,7 +73,9 @@ TEST_P(CordBufferTest, MaximumPayload) {
   EXPECT_THAT(CordBuffer::MaximumPayload(), Eq(kMaxFlatLength));
   EXPECT_THAT(CordBuffer::MaximumPayload(512), Eq(512 - kFlatOverhead));
   EXPECT_THAT(CordBuffer::MaximumPayload(k64KiB), Eq(k64KiB - kFlatOverhead));
-  EXPECT_THAT(CordBuffer::MaximumPayload(k1MB), Eq(k64KiB - kFlatOverhead));
+  EXPECT_THAT(CordBuffer::MaximumPayload(k1MB), Eq(k1MB - kFlatOverhead));
+  EXPECT_THAT(CordBuffer::MaximumPayload(4u << 20),
+              Eq(kCustomLimit - kFlatOverhead));
 }
 
 TEST(CordBufferTest, ConstructDefault) {
@@ -138,7 +140,7 @@ TEST_P(CordBufferTest, AvailableUpTo) {
 
 // Returns the maximum capacity for a given block_size and requested size.
 size_t MaxCapacityFor(size_t block_size, size_t requested) {
-  requested = (std::min)(requested, cord_internal::kMaxLargeFlatSize);
+  requested = (std::min)(requested, cord_internal::kMaxHugeFlatSize);
   // Maximum returned size is always capped at block_size - kFlatOverhead.
   return block_size - kFlatOverhead;
 }
@@ -259,6 +261,14 @@ TEST(CordLargeBufferTest, CreateWithCustomLimit) {
   }
 }
 
+TEST(CordLargeBufferTest, CreateWithHugeCustomLimit) {
+  const size_t k2MiB = 2u << 20;
+  CordBuffer buffer = CordBuffer::CreateWithCustomLimit(k2MiB, k2MiB);
+  ASSERT_THAT(buffer.capacity(), Ge(k2MiB - kFlatOverhead));
+  EXPECT_THAT(buffer.capacity(), Le(MaxCapacityFor(k2MiB, k2MiB)));
+  memset(buffer.data(), 0xCD, buffer.capacity());
+}
+
 TEST(CordLargeBufferTest, CreateWithTooLargeLimit) {
   CordBuffer buffer = CordBuffer::CreateWithCustomLimit(k64KiB, k1MB);
   ASSERT_THAT(buffer.capacity(), Ge(k64KiB - kFlatOverhead));
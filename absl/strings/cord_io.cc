@@ -0,0 +1,178 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/strings/cord_io.h"
+
+#ifdef ABSL_HAVE_CORD_FD_IO
+
+#include <limits.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+
+#include "absl/container/inlined_vector.h"
+#include "absl/strings/cord_buffer.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+namespace {
+
+// The largest number of I/O vectors passed to a single `writev()` or
+// `readv()` call. POSIX caps vectored I/O at `IOV_MAX` segments.
+constexpr size_t kMaxIov =
+#ifdef IOV_MAX
+    IOV_MAX < 1024 ? IOV_MAX : 1024;
+#else
+    16;  // _XOPEN_IOV_MAX, the portable minimum.
+#endif
+
+// The number of buffers filled per `readv()` call by `ReadCordFromFd()`.
+constexpr size_t kReadBuffers = 16;
+
+}  // namespace
+
+int64_t WriteCordToFd(int fd, const Cord& cord) {
+  absl::InlinedVector<struct iovec, 16> iov;
+  iov.reserve(std::min(kMaxIov, static_cast<size_t>(1) + cord.size() / 128));
+
+  int64_t total = 0;
+  Cord::ChunkIterator it = cord.chunk_begin();
+  const Cord::ChunkIterator end = cord.chunk_end();
+  while (it != end || !iov.empty()) {
+    // Gather the next batch of chunks.
+    while (it != end && iov.size() < kMaxIov) {
+      absl::string_view chunk = *it;
+      iov.push_back({const_cast<char*>(chunk.data()), chunk.size()});
+      ++it;
+    }
+
+    ssize_t written = writev(fd, iov.data(), static_cast<int>(iov.size()));
+    if (written < 0) {
+      if (errno == EINTR) continue;
+      return -1;
+    }
+    total += written;
+
+    // Drop fully written vectors and trim a partially written one.
+    size_t consumed = 0;
+    auto remaining = static_cast<size_t>(written);
+    while (consumed < iov.size() && remaining >= iov[consumed].iov_len) {
+      remaining -= iov[consumed].iov_len;
+      ++consumed;
+    }
+    if (consumed < iov.size() && remaining > 0) {
+      iov[consumed].iov_base =
+          static_cast<char*>(iov[consumed].iov_base) + remaining;
+      iov[consumed].iov_len -= remaining;
+    }
+    iov.erase(iov.begin(), iov.begin() + consumed);
+  }
+  return total;
+}
+
+int64_t ReadCordFromFd(int fd, size_t max_bytes, Cord* dst) {
+  int64_t total = 0;
+  while (static_cast<size_t>(total) < max_bytes) {
+    const size_t remaining = max_bytes - static_cast<size_t>(total);
+
+    // Allocate Cord-owned buffers for the next batch and point the I/O
+    // vectors at their free space.
+    CordBuffer buffers[kReadBuffers];
+    struct iovec iov[kReadBuffers];
+    size_t num_buffers = 0;
+    size_t batch_capacity = 0;
+    while (num_buffers < kReadBuffers && batch_capacity < remaining) {
+      CordBuffer& buffer = buffers[num_buffers];
+      buffer = CordBuffer::CreateWithDefaultLimit(remaining - batch_capacity);
+      absl::Span<char> available = buffer.available_up_to(remaining -
+                                                          batch_capacity);
+      iov[num_buffers] = {available.data(), available.size()};
+      batch_capacity += available.size();
+      ++num_buffers;
+    }
+
+    ssize_t nread = readv(fd, iov, static_cast<int>(num_buffers));
+    if (nread < 0) {
+      if (errno == EINTR) continue;
+      return -1;
+    }
+    if (nread == 0) break;  // End of file.
+    total += nread;
+
+    // Commit the filled prefix of each buffer to the Cord.
+    auto filled = static_cast<size_t>(nread);
+    for (size_t i = 0; i < num_buffers && filled > 0; ++i) {
+      const size_t len = std::min(filled, iov[i].iov_len);
+      buffers[i].IncreaseLengthBy(len);
+      dst->Append(std::move(buffers[i]));
+      filled -= len;
+    }
+
+    // A short read means no more data is available right now.
+    if (static_cast<size_t>(nread) < batch_capacity) break;
+  }
+  return total;
+}
+
+absl::optional<Cord> MakeCordFromFile(int fd, size_t offset, size_t length,
+                                      CordFileAccess access) {
+  if (length == 0) return Cord();
+
+  struct stat status;
+  if (fstat(fd, &status) != 0) return absl::nullopt;
+  if (status.st_size < 0 || offset > static_cast<size_t>(status.st_size) ||
+      length > static_cast<size_t>(status.st_size) - offset) {
+    errno = EINVAL;
+    return absl::nullopt;
+  }
+
+  // `mmap()` requires a page aligned file offset: map from the enclosing
+  // page boundary and reference the mapping at the requested offset.
+  const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  const size_t page_offset = offset % page_size;
+  const size_t map_length = length + page_offset;
+  void* map = mmap(nullptr, map_length, PROT_READ, MAP_PRIVATE, fd,
+                   static_cast<off_t>(offset - page_offset));
+  if (map == MAP_FAILED) return absl::nullopt;
+
+  // Memory advice is a best effort hint: failure is deliberately ignored.
+  switch (access) {
+    case CordFileAccess::kNormal:
+      break;
+    case CordFileAccess::kSequential:
+      posix_madvise(map, map_length, POSIX_MADV_SEQUENTIAL);
+      break;
+    case CordFileAccess::kWillNeed:
+      posix_madvise(map, map_length, POSIX_MADV_WILLNEED);
+      break;
+  }
+
+  absl::string_view data(static_cast<const char*>(map) + page_offset, length);
+  return MakeCordFromExternal(data, [map, map_length](absl::string_view) {
+    munmap(map, map_length);
+  });
+}
+
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_HAVE_CORD_FD_IO
@@ -0,0 +1,125 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// -----------------------------------------------------------------------------
+// File: cord_io.h
+// -----------------------------------------------------------------------------
+//
+// Vectored file descriptor I/O for `absl::Cord`. A Cord stores its data as a
+// tree of chunks, so writing one to a file descriptor by flattening it first
+// copies every byte. `absl::WriteCordToFd()` instead passes the chunks
+// directly to `writev(2)`, batching many chunks per syscall with no copying,
+// and `absl::ReadCordFromFd()` reads with `readv(2)` straight into
+// Cord-owned buffers that are appended without copying.
+//
+// This file also defines `absl::MakeCordFromFile()`, which maps a file range
+// with `mmap(2)` and exposes it as a zero-copy Cord that unmaps the range
+// when the last reference to the data is dropped, so serving file contents
+// does not copy them out of the page cache.
+//
+// These functions are only available on platforms with POSIX vectored I/O;
+// `ABSL_HAVE_CORD_FD_IO` is defined when they are.
+
+#ifndef ABSL_STRINGS_CORD_IO_H_
+#define ABSL_STRINGS_CORD_IO_H_
+
+#include "absl/base/config.h"
+#include "absl/strings/cord.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+
+// ABSL_HAVE_CORD_FD_IO
+//
+// Defined when `absl::WriteCordToFd()` and `absl::ReadCordFromFd()` are
+// available on this platform.
+#define ABSL_HAVE_CORD_FD_IO 1
+
+#include <cstddef>
+#include <cstdint>
+
+#include "absl/types/optional.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+// WriteCordToFd()
+//
+// Writes the contents of `cord` to `fd` using `writev(2)`, passing the
+// Cord's chunks directly as I/O vectors without copying them. Short writes
+// are retried and `EINTR` is transparently restarted, so on success the
+// whole Cord has been written.
+//
+// Returns the number of bytes written, which is `cord.size()` on success.
+// On error returns -1 with `errno` set by the failing `writev()` call; some
+// prefix of `cord` may already have been written.
+int64_t WriteCordToFd(int fd, const Cord& cord);
+
+// ReadCordFromFd()
+//
+// Reads up to `max_bytes` bytes from `fd` with `readv(2)` directly into
+// Cord-owned buffers and appends them to `*dst` without copying. Reading
+// stops at end of file or whenever a read returns fewer bytes than
+// requested, so on pipes and sockets this returns as soon as available data
+// is exhausted rather than blocking for `max_bytes`.
+//
+// Returns the number of bytes appended to `*dst`, which is zero at end of
+// file. On error returns -1 with `errno` set by the failing `readv()` call;
+// bytes read by earlier calls remain appended to `*dst`.
+int64_t ReadCordFromFd(int fd, size_t max_bytes, Cord* dst);
+
+// CordFileAccess
+//
+// Access pattern hints for `absl::MakeCordFromFile()`, forwarded to the
+// kernel as memory advice for the created mapping.
+enum class CordFileAccess {
+  // No advice: the kernel's default readahead policy applies.
+  kNormal,
+
+  // The data will be consumed front to back. Advises the kernel to read
+  // ahead aggressively and that pages may be dropped soon after use
+  // (`POSIX_MADV_SEQUENTIAL`).
+  kSequential,
+
+  // All of the data will be needed soon. Advises the kernel to start
+  // populating pages immediately (`POSIX_MADV_WILLNEED`).
+  kWillNeed,
+};
+
+// MakeCordFromFile()
+//
+// Maps `length` bytes of `fd` starting at byte `offset` into memory with
+// `mmap(2)` and returns a read-only Cord referencing the mapping without
+// copying any data. The mapping is released with `munmap(2)` once the last
+// Cord (or subcord) referencing the data is destroyed; `fd` itself may be
+// closed as soon as this function returns. `offset` does not need to be page
+// aligned. `access` advises the kernel on the expected access pattern, see
+// `CordFileAccess`.
+//
+// The returned Cord reflects the file contents at access time, not call
+// time: like any mapping, concurrent modification or truncation of the file
+// by other processes affects (or invalidates) the mapped data.
+//
+// Returns an empty optional with `errno` set on failure; in particular
+// `EINVAL` if `[offset, offset + length)` does not fit in the current file
+// size. An empty range returns an empty Cord.
+absl::optional<Cord> MakeCordFromFile(
+    int fd, size_t offset, size_t length,
+    CordFileAccess access = CordFileAccess::kNormal);
+
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // defined(__unix__) || defined(__APPLE__)
+
+#endif  // ABSL_STRINGS_CORD_IO_H_
@@ -0,0 +1,189 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/strings/cord_io.h"
+
+#ifdef ABSL_HAVE_CORD_FD_IO
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdio>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "absl/strings/cord.h"
+#include "absl/strings/str_cat.h"
+
+namespace {
+
+// Returns a fragmented Cord of roughly `target_size` bytes built from many
+// small appends, so that it consists of many chunks.
+absl::Cord FragmentedCord(size_t target_size) {
+  absl::Cord cord;
+  int i = 0;
+  while (cord.size() < target_size) {
+    cord.Append(absl::StrCat("chunk-", i++, std::string(997, 'x')));
+  }
+  return cord;
+}
+
+class CordIoTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    FILE* file = tmpfile();
+    ASSERT_NE(file, nullptr);
+    file_ = file;
+    fd_ = fileno(file);
+  }
+  void TearDown() override { fclose(file_); }
+
+  FILE* file_;
+  int fd_;
+};
+
+TEST_F(CordIoTest, RoundTrip) {
+  absl::Cord cord = FragmentedCord(5 << 20);
+  EXPECT_EQ(absl::WriteCordToFd(fd_, cord), cord.size());
+  ASSERT_EQ(lseek(fd_, 0, SEEK_SET), 0);
+
+  absl::Cord read;
+  EXPECT_EQ(absl::ReadCordFromFd(fd_, cord.size(), &read), cord.size());
+  EXPECT_EQ(read, cord);
+  // At end of file another read appends nothing.
+  EXPECT_EQ(absl::ReadCordFromFd(fd_, 100, &read), 0);
+  EXPECT_EQ(read, cord);
+}
+
+TEST_F(CordIoTest, ReadLessThanAvailable) {
+  absl::Cord cord = FragmentedCord(1 << 20);
+  ASSERT_EQ(absl::WriteCordToFd(fd_, cord), cord.size());
+  ASSERT_EQ(lseek(fd_, 0, SEEK_SET), 0);
+
+  absl::Cord read;
+  EXPECT_EQ(absl::ReadCordFromFd(fd_, 12345, &read), 12345);
+  EXPECT_EQ(read, cord.Subcord(0, 12345));
+}
+
+TEST_F(CordIoTest, ReadMoreThanAvailable) {
+  absl::Cord cord("short contents");
+  ASSERT_EQ(absl::WriteCordToFd(fd_, cord), cord.size());
+  ASSERT_EQ(lseek(fd_, 0, SEEK_SET), 0);
+
+  absl::Cord read;
+  EXPECT_EQ(absl::ReadCordFromFd(fd_, 1 << 20, &read), cord.size());
+  EXPECT_EQ(read, cord);
+}
+
+TEST_F(CordIoTest, EmptyCord) {
+  absl::Cord cord;
+  EXPECT_EQ(absl::WriteCordToFd(fd_, cord), 0);
+}
+
+TEST_F(CordIoTest, AppendsToExistingCord) {
+  ASSERT_EQ(absl::WriteCordToFd(fd_, absl::Cord("-suffix")), 7);
+  ASSERT_EQ(lseek(fd_, 0, SEEK_SET), 0);
+
+  absl::Cord read("prefix");
+  EXPECT_EQ(absl::ReadCordFromFd(fd_, 100, &read), 7);
+  EXPECT_EQ(read, "prefix-suffix");
+}
+
+TEST_F(CordIoTest, MakeCordFromFileWholeFile) {
+  const std::string contents(1 << 20, 'a');
+  ASSERT_EQ(absl::WriteCordToFd(fd_, absl::Cord(contents)),
+            static_cast<int64_t>(contents.size()));
+
+  absl::optional<absl::Cord> cord =
+      absl::MakeCordFromFile(fd_, 0, contents.size());
+  ASSERT_TRUE(cord.has_value());
+  EXPECT_EQ(*cord, contents);
+
+  // The mapping is released with the last reference, not the first.
+  absl::Cord suffix = cord->Subcord(contents.size() - 10, 10);
+  cord.reset();
+  EXPECT_EQ(suffix, contents.substr(contents.size() - 10));
+}
+
+TEST_F(CordIoTest, MakeCordFromFileUnalignedOffset) {
+  std::string contents;
+  for (int i = 0; contents.size() < 100000; ++i) {
+    contents += absl::StrCat("line-", i, "\n");
+  }
+  ASSERT_EQ(absl::WriteCordToFd(fd_, absl::Cord(contents)),
+            static_cast<int64_t>(contents.size()));
+
+  absl::optional<absl::Cord> cord = absl::MakeCordFromFile(fd_, 12345, 6789);
+  ASSERT_TRUE(cord.has_value());
+  EXPECT_EQ(*cord, contents.substr(12345, 6789));
+}
+
+TEST_F(CordIoTest, MakeCordFromFileAccessHints) {
+  const std::string contents(100000, 'h');
+  ASSERT_EQ(absl::WriteCordToFd(fd_, absl::Cord(contents)),
+            static_cast<int64_t>(contents.size()));
+
+  for (auto access : {absl::CordFileAccess::kNormal,
+                      absl::CordFileAccess::kSequential,
+                      absl::CordFileAccess::kWillNeed}) {
+    absl::optional<absl::Cord> cord =
+        absl::MakeCordFromFile(fd_, 0, contents.size(), access);
+    ASSERT_TRUE(cord.has_value());
+    EXPECT_EQ(*cord, contents);
+  }
+}
+
+TEST_F(CordIoTest, MakeCordFromFileEmptyRange) {
+  absl::optional<absl::Cord> cord = absl::MakeCordFromFile(fd_, 0, 0);
+  ASSERT_TRUE(cord.has_value());
+  EXPECT_TRUE(cord->empty());
+}
+
+TEST_F(CordIoTest, MakeCordFromFileBeyondEofFails) {
+  ASSERT_EQ(absl::WriteCordToFd(fd_, absl::Cord("0123456789")), 10);
+
+  errno = 0;
+  EXPECT_FALSE(absl::MakeCordFromFile(fd_, 0, 11).has_value());
+  EXPECT_EQ(errno, EINVAL);
+
+  errno = 0;
+  EXPECT_FALSE(absl::MakeCordFromFile(fd_, 11, 1).has_value());
+  EXPECT_EQ(errno, EINVAL);
+
+  EXPECT_TRUE(absl::MakeCordFromFile(fd_, 0, 10).has_value());
+}
+
+TEST(CordIo, MakeCordFromFileBadFdFails) {
+  errno = 0;
+  EXPECT_FALSE(absl::MakeCordFromFile(-1, 0, 10).has_value());
+  EXPECT_EQ(errno, EBADF);
+}
+
+TEST(CordIo, ErrorsSetErrno) {
+  absl::Cord cord("payload");
+  errno = 0;
+  EXPECT_EQ(absl::WriteCordToFd(-1, cord), -1);
+  EXPECT_EQ(errno, EBADF);
+
+  absl::Cord read;
+  errno = 0;
+  EXPECT_EQ(absl::ReadCordFromFd(-1, 10, &read), -1);
+  EXPECT_EQ(errno, EBADF);
+  EXPECT_TRUE(read.empty());
+}
+
+}  // namespace
+
+#endif  // ABSL_HAVE_CORD_FD_IO
@@ -41,6 +41,7 @@
 #include "absl/base/no_destructor.h"
 #include "absl/base/options.h"
 #include "absl/container/fixed_array.h"
+#include "absl/crc/crc32c.h"
 #include "absl/functional/function_ref.h"
 #include "absl/hash/hash.h"
 #include "absl/hash/hash_testing.h"
@@ -280,8 +281,9 @@ TEST(CordRepFlat, AllFlatCapacities) {
   static_assert(absl::cord_internal::kFlatOverhead < 32, "");
   static_assert(absl::cord_internal::kMinFlatSize == 32, "");
   static_assert(absl::cord_internal::kMaxLargeFlatSize == 256 << 10, "");
+  static_assert(absl::cord_internal::kMaxHugeFlatSize == 2 << 20, "");
   EXPECT_EQ(absl::cord_internal::TagToAllocatedSize(FLAT), 32);
-  EXPECT_EQ(absl::cord_internal::TagToAllocatedSize(MAX_FLAT_TAG), 256 << 10);
+  EXPECT_EQ(absl::cord_internal::TagToAllocatedSize(MAX_FLAT_TAG), 2 << 20);
 
   // Verify all tags to map perfectly back and forth, and
   // that sizes are monotonically increasing.
@@ -313,6 +315,13 @@ TEST(CordRepFlat, AllFlatCapacities) {
     uint8_t tag = absl::cord_internal::AllocatedSizeToTag(size);
     ASSERT_EQ(absl::cord_internal::TagToAllocatedSize(tag), size);
   }
+
+  // All flat sizes from 256KB to 2MB are 256KB granularity
+  for (size_t size = 256 * 1024; size <= 2 * 1024 * 1024; size += 256 * 1024) {
+    ASSERT_EQ(absl::cord_internal::RoundUpForTag(size), size);
+    uint8_t tag = absl::cord_internal::AllocatedSizeToTag(size);
+    ASSERT_EQ(absl::cord_internal::TagToAllocatedSize(tag), size);
+  }
 }
 
 TEST(CordRepFlat, MaxFlatSize) {
@@ -332,11 +341,18 @@ TEST(CordRepFlat, MaxLargeFlatSize) {
   CordRep::Unref(flat);
 }
 
+TEST(CordRepFlat, MaxHugeFlatSize) {
+  const size_t size = 2 * 1024 * 1024 - kFlatOverhead;
+  CordRepFlat* flat = CordRepFlat::New(CordRepFlat::Huge(), size);
+  EXPECT_GE(flat->Capacity(), size);
+  CordRep::Unref(flat);
+}
+
 TEST(CordRepFlat, AllFlatSizes) {
-  const size_t kMaxSize = 256 * 1024;
+  const size_t kMaxSize = 2 * 1024 * 1024;
   for (size_t size = 32; size <= kMaxSize; size *=2) {
     const size_t length = size - kFlatOverhead - 1;
-    CordRepFlat* flat = CordRepFlat::New(CordRepFlat::Large(), length);
+    CordRepFlat* flat = CordRepFlat::New(CordRepFlat::Huge(), length);
     EXPECT_GE(flat->Capacity(), length);
     memset(flat->Data(), 0xCD, flat->Capacity());
     CordRep::Unref(flat);
@@ -589,6 +605,41 @@ TEST_P(CordTest, Find) {
       std::next(fragmented_haystack.char_begin(), 5));
 }
 
+TEST_P(CordTest, FindAcrossChunkBoundaries) {
+  // All bytes are distinct, so every substring occurs exactly once and every
+  // needle position, including those straddling one or more chunk boundaries,
+  // has a unique expected result.
+  auto haystack =
+      absl::MakeFragmentedCord({"ab", "cd", "efgh", "i", "j", "klmnop", "qrst"});
+  const absl::string_view flat = "abcdefghijklmnopqrst";
+  for (size_t pos = 0; pos < flat.size(); ++pos) {
+    for (size_t len = 1; len <= flat.size() - pos; ++len) {
+      EXPECT_EQ(haystack.Find(flat.substr(pos, len)),
+                std::next(haystack.char_begin(), static_cast<int>(pos)))
+          << "pos: " << pos << " len: " << len;
+    }
+  }
+  EXPECT_EQ(haystack.Find("ba"), haystack.char_end());
+  EXPECT_EQ(haystack.Find("abd"), haystack.char_end());
+  EXPECT_EQ(haystack.Find("tu"), haystack.char_end());
+}
+
+TEST_P(CordTest, FindLongNeedle) {
+  // A needle too long for the chunk boundary window, found straddling
+  // several chunk boundaries.
+  std::string needle(100, 'x');
+  needle[31] = 'y';
+  needle[73] = 'z';
+  auto haystack = absl::MakeFragmentedCord(
+      {"padding-", needle.substr(0, 40), needle.substr(40, 20),
+       needle.substr(60), "-trailer"});
+
+  EXPECT_EQ(haystack.Find(needle), std::next(haystack.char_begin(), 8));
+  EXPECT_TRUE(haystack.Contains(needle));
+  needle.back() = 'w';
+  EXPECT_EQ(haystack.Find(needle), haystack.char_end());
+}
+
 TEST_P(CordTest, Subcord) {
   RandomEngine rng(GTEST_FLAG_GET(random_seed));
   const std::string s = RandomLowercaseString(&rng, 1024);
@@ -849,6 +900,175 @@ TEST_P(CordTest, AppendLargeBuffer) {
   EXPECT_THAT(cord.Chunks(), ElementsAre(s1, s2));
 }
 
+TEST_P(CordTest, AppenderSmallFragments) {
+  absl::Cord cord;
+  std::string expected;
+  {
+    absl::Cord::Appender appender(&cord);
+    for (int i = 0; i < 1000; ++i) {
+      std::string fragment = absl::StrCat("fragment-", i, std::string(90, 'x'));
+      appender.Append(fragment);
+      expected += fragment;
+    }
+  }
+  EXPECT_EQ(cord, expected);
+
+  // The fragments must have been accumulated into full buffers, not appended
+  // as one chunk per fragment.
+  EXPECT_LE(static_cast<size_t>(
+                std::distance(cord.chunk_begin(), cord.chunk_end())),
+            expected.size() / absl::CordBuffer::MaximumPayload() + 2);
+}
+
+TEST_P(CordTest, AppenderFlush) {
+  absl::Cord cord("prefix-");
+  absl::Cord::Appender appender(&cord);
+  appender.Append("hello ");
+  appender.Append("world");
+  appender.Flush();
+  EXPECT_EQ(cord, "prefix-hello world");
+
+  // Flushing with nothing buffered is a no-op, and the appender remains
+  // usable after a flush.
+  appender.Flush();
+  appender.Append("!");
+  appender.Flush();
+  EXPECT_EQ(cord, "prefix-hello world!");
+}
+
+TEST_P(CordTest, AppenderLargeAppend) {
+  const std::string large(500000, 'L');
+  absl::Cord cord;
+  std::string expected;
+  {
+    absl::Cord::Appender appender(&cord);
+    appender.Append("small-");
+    appender.Append(large);
+    appender.Append("-small");
+    expected = absl::StrCat("small-", large, "-small");
+  }
+  EXPECT_EQ(cord, expected);
+}
+
+TEST_P(CordTest, AppenderNoData) {
+  absl::Cord cord("unchanged");
+  {
+    absl::Cord::Appender appender(&cord);
+    appender.Append("");
+  }
+  EXPECT_EQ(cord, "unchanged");
+}
+
+TEST_P(CordTest, MakeCordEmptyInputs) {
+  EXPECT_TRUE(absl::MakeCord(absl::Span<absl::Cord>()).empty());
+
+  std::vector<absl::Cord> cords(3);
+  EXPECT_TRUE(absl::MakeCord(absl::MakeSpan(cords)).empty());
+}
+
+TEST_P(CordTest, MakeCordSingleInput) {
+  const std::string data(5000, 'x');
+  std::vector<absl::Cord> cords = {MaybeHardened(absl::Cord(data))};
+  absl::Cord combined = absl::MakeCord(absl::MakeSpan(cords));
+  EXPECT_EQ(combined, data);
+  EXPECT_FALSE(combined.ExpectedChecksum().has_value());
+  EXPECT_TRUE(cords[0].empty());
+}
+
+TEST_P(CordTest, MakeCordCombinesInputsInOrder) {
+  RandomEngine rng(GTEST_FLAG_GET(random_seed));
+  std::string expected;
+  std::vector<absl::Cord> cords;
+  // Mix of empty, inlined and tree inputs.
+  for (size_t length : {0u, 5u, 100u, 3000u, 0u, 40000u, 7u}) {
+    std::string data = RandomLowercaseString(&rng, length);
+    expected += data;
+    cords.push_back(MaybeHardened(absl::Cord(data)));
+  }
+
+  absl::Cord combined = absl::MakeCord(absl::MakeSpan(cords));
+  EXPECT_EQ(combined, expected);
+  EXPECT_FALSE(combined.ExpectedChecksum().has_value());
+  for (const absl::Cord& cord : cords) {
+    EXPECT_TRUE(cord.empty());
+  }
+}
+
+TEST_P(CordTest, MakeCordManySmallInputs) {
+  std::string expected;
+  std::vector<absl::Cord> cords;
+  for (int i = 0; i < 1000; ++i) {
+    std::string data = absl::StrCat("chunk-", i, "-");
+    expected += data;
+    cords.push_back(MaybeHardened(absl::Cord(data)));
+  }
+
+  absl::Cord combined = absl::MakeCord(absl::MakeSpan(cords));
+  EXPECT_EQ(combined, expected);
+}
+
+namespace {
+
+size_t CountChunks(const absl::Cord& cord) {
+  size_t num_chunks = 0;
+  for (absl::string_view chunk : cord.Chunks()) {
+    static_cast<void>(chunk);
+    ++num_chunks;
+  }
+  return num_chunks;
+}
+
+}  // namespace
+
+TEST_P(CordTest, CompactInlinedCordIsNoop) {
+  absl::Cord cord("small");
+  cord.Compact();
+  EXPECT_EQ(cord, "small");
+}
+
+TEST_P(CordTest, CompactDenseCordIsNoop) {
+  const std::string data(100000, 'x');
+  absl::Cord cord = MaybeHardened(absl::Cord(data));
+  const size_t chunks_before = CountChunks(cord);
+  cord.Compact();
+  EXPECT_EQ(cord, data);
+  EXPECT_EQ(CountChunks(cord), chunks_before);
+  // A dense cord is not rewritten, so its expected checksum survives.
+  EXPECT_EQ(cord.ExpectedChecksum().has_value(), UseCrc());
+}
+
+TEST_P(CordTest, CompactFragmentedCord) {
+  RandomEngine rng(GTEST_FLAG_GET(random_seed));
+  const std::string data = RandomLowercaseString(&rng, 100000);
+
+  // Build a heavily fragmented cord by appending many small flat nodes.
+  absl::Cord cord;
+  for (size_t i = 0; i < data.size(); i += 600) {
+    const std::string fragment = data.substr(i, 600);
+    cord.Append(absl::Cord(fragment));
+  }
+  MaybeHarden(cord);
+  const size_t chunks_before = CountChunks(cord);
+  const size_t memory_before =
+      cord.EstimatedMemoryUsage(absl::CordMemoryAccounting::kTotalMorePrecise);
+
+  cord.Compact();
+
+  EXPECT_EQ(cord, data);
+  EXPECT_LT(CountChunks(cord), chunks_before / 4);
+  EXPECT_LT(
+      cord.EstimatedMemoryUsage(absl::CordMemoryAccounting::kTotalMorePrecise),
+      memory_before);
+  // Compacting rewrites the tree and discards any expected checksum.
+  EXPECT_EQ(cord.ExpectedChecksum(), absl::nullopt);
+
+  // Compacting an already compacted cord leaves it unchanged.
+  const size_t chunks_after = CountChunks(cord);
+  cord.Compact();
+  EXPECT_EQ(cord, data);
+  EXPECT_EQ(CountChunks(cord), chunks_after);
+}
+
 TEST_P(CordTest, PrependLargeBuffer) {
   absl::Cord cord;
 
@@ -1541,6 +1761,28 @@ TEST_P(CordTest, CompareAfterAssign) {
   EXPECT_FALSE(a < b);
 }
 
+TEST_P(CordTest, CompareSharedStructure) {
+  // Cords copied from one another share data edges, which the comparison
+  // recognizes as trivially equal without inspecting the bytes.
+  absl::Cord a;
+  for (int i = 0; i < 100; ++i) {
+    a.Append(std::string(1000, static_cast<char>('a' + i % 26)));
+  }
+  MaybeHarden(a);
+
+  absl::Cord b = a;
+  b.Append("tail");
+  absl::Cord c = a;
+  c.Append("tail");
+  EXPECT_EQ(b, c);
+  EXPECT_EQ(b.Compare(c), 0);
+
+  c = a;
+  c.Append("uail");
+  EXPECT_NE(b, c);
+  EXPECT_LT(b.Compare(c), 0);
+}
+
 // Test CompareTo() and ComparePrefix() against string and substring
 // comparison methods from basic_string.
 static void TestCompare(const absl::Cord& c, const absl::Cord& d,
@@ -2045,6 +2287,37 @@ TEST(CordTest, CordMemoryUsageBTree) {
                 rep2_size);
 }
 
+TEST(CordTest, CordMemoryUsageTotalFast) {
+  constexpr auto kTotalFast = absl::CordMemoryAccounting::kTotalFast;
+
+  // Exact for empty, inlined, and single-edge cords.
+  absl::Cord empty;
+  EXPECT_EQ(empty.EstimatedMemoryUsage(kTotalFast), sizeof(absl::Cord));
+  absl::Cord inlined("hello");
+  EXPECT_EQ(inlined.EstimatedMemoryUsage(kTotalFast), sizeof(absl::Cord));
+  absl::Cord flat = MakeCord(1000, 'a');
+  EXPECT_EQ(flat.EstimatedMemoryUsage(kTotalFast),
+            flat.EstimatedMemoryUsage());
+  flat.SetExpectedChecksum(1);
+  EXPECT_EQ(flat.EstimatedMemoryUsage(kTotalFast),
+            flat.EstimatedMemoryUsage());
+
+  // For btree cords built from equal-sized chunks, the extrapolated estimate
+  // must track the full kTotal walk closely.
+  absl::Cord cord;
+  for (int i = 0; i < 300; ++i) {
+    cord.Append(MakeCord(1000, 'a'));
+  }
+  if (!absl::CordTestPeer::Tree(cord)->IsBtree()) {
+    LOG(WARNING) << "Cord library code not respecting btree flag";
+    return;
+  }
+  const size_t total = cord.EstimatedMemoryUsage();
+  const size_t fast = cord.EstimatedMemoryUsage(kTotalFast);
+  EXPECT_GE(fast * 10, total * 9);
+  EXPECT_LE(fast * 10, total * 11);
+}
+
 TEST(CordTest, TestHashFragmentation) {
   // Make sure we hit these boundary cases precisely.
   EXPECT_EQ(1024, absl::hash_internal::PiecewiseChunkSize());
@@ -2065,6 +2338,21 @@ TEST(CordTest, TestHashFragmentation) {
   }));
 }
 
+TEST(CordTest, TestHashSmallFragmentedMatchesFlat) {
+  // Fragmented cords up to kMaxBytesToCopy take a stack-buffer fast path in
+  // AbslHashValue; the result must stay identical to hashing the flattened
+  // bytes, including at the boundary of the fast path.
+  for (size_t size : {size_t{2}, size_t{16}, size_t{100}, size_t{510},
+                      size_t{511}, size_t{512}, size_t{600}, size_t{2000}}) {
+    std::string flat(size, 'x');
+    for (size_t i = 0; i < size; ++i) flat[i] = static_cast<char>('a' + i % 26);
+    absl::Cord fragmented = absl::MakeFragmentedCord(
+        {flat.substr(0, size / 2), flat.substr(size / 2)});
+    EXPECT_EQ(absl::HashOf(fragmented), absl::HashOf(flat)) << size;
+    EXPECT_EQ(absl::HashOf(fragmented), absl::HashOf(absl::Cord(flat))) << size;
+  }
+}
+
 // Regtest for a change that had to be rolled back because it expanded out
 // of the InlineRep too soon, which was observable through MemoryUsage().
 TEST_P(CordTest, CordMemoryUsageInlineRep) {
@@ -3183,6 +3471,53 @@ TEST_P(CordTest, ExpectedChecksum) {
   }
 }
 
+TEST_P(CordTest, VerifyingChunkReader) {
+  auto read_all = [](absl::CordVerifyingChunkReader& reader) {
+    std::string read;
+    while (absl::optional<absl::string_view> chunk = reader.Next()) {
+      read.append(chunk->data(), chunk->size());
+    }
+    return read;
+  };
+
+  for (const PopulatedCordFactory& factory : cord_factories) {
+    SCOPED_TRACE(factory.Name());
+
+    absl::Cord cord = factory.Generate();
+    const std::string as_string(cord);
+    const uint32_t actual_crc =
+        static_cast<uint32_t>(absl::ComputeCrc32c(as_string));
+
+    // Without an expected checksum the reader yields all data, but there is
+    // nothing to verify against.
+    {
+      absl::CordVerifyingChunkReader reader(cord);
+      EXPECT_FALSE(reader.HasExpectedChecksum());
+      EXPECT_EQ(read_all(reader), as_string);
+      EXPECT_FALSE(reader.Verified());
+    }
+
+    // A matching checksum verifies after all data has been read, not before.
+    cord.SetExpectedChecksum(actual_crc);
+    {
+      absl::CordVerifyingChunkReader reader(cord);
+      EXPECT_TRUE(reader.HasExpectedChecksum());
+      EXPECT_FALSE(reader.Verified());
+      EXPECT_EQ(read_all(reader), as_string);
+      EXPECT_TRUE(reader.Verified());
+    }
+
+    // A mismatched checksum still yields all data but fails verification.
+    cord.SetExpectedChecksum(actual_crc + 1);
+    {
+      absl::CordVerifyingChunkReader reader(cord);
+      EXPECT_TRUE(reader.HasExpectedChecksum());
+      EXPECT_EQ(read_all(reader), as_string);
+      EXPECT_FALSE(reader.Verified());
+    }
+  }
+}
+
 // Test the special cases encountered with an empty checksummed cord.
 TEST_P(CordTest, ChecksummedEmptyCord) {
   absl::Cord c1;
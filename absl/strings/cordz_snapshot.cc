@@ -0,0 +1,115 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/strings/cordz_snapshot.h"
+
+#include <algorithm>
+#include <cstdint>
+
+#include "absl/base/config.h"
+#include "absl/base/macros.h"
+#include "absl/strings/internal/cordz_info.h"
+#include "absl/strings/internal/cordz_sample_token.h"
+#include "absl/strings/internal/cordz_statistics.h"
+#include "absl/strings/internal/cordz_update_tracker.h"
+#include "absl/strings/string_view.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+namespace {
+
+using ::absl::cord_internal::CordzUpdateTracker;
+
+// Human-readable names for CordzUpdateTracker::MethodIdentifier, in enum
+// order.
+constexpr absl::string_view kMethodNames[] = {
+    "Unknown",
+    "AppendCord",
+    "AppendCordBuffer",
+    "AppendExternalMemory",
+    "AppendString",
+    "AssignCord",
+    "AssignString",
+    "Clear",
+    "ConstructorCord",
+    "ConstructorString",
+    "CordReader",
+    "Flatten",
+    "GetAppendBuffer",
+    "GetAppendRegion",
+    "MakeCordFromExternal",
+    "MoveAppendCord",
+    "MoveAssignCord",
+    "MovePrependCord",
+    "PrependCord",
+    "PrependCordBuffer",
+    "PrependString",
+    "RemovePrefix",
+    "RemoveSuffix",
+    "SetExpectedChecksum",
+    "SubCord",
+};
+static_assert(ABSL_ARRAYSIZE(kMethodNames) == CordzUpdateTracker::kNumMethods,
+              "kMethodNames must cover every MethodIdentifier");
+
+}  // namespace
+
+CordzSnapshot GetCordzSnapshot() {
+  CordzSnapshot snapshot;
+  CordzUpdateTracker updates;
+
+  // The sample token guards lock-free traversal of the sampled cord list;
+  // CordzInfo objects discovered through it cannot be deleted while the token
+  // is alive.
+  cord_internal::CordzSampleToken token;
+  for (const cord_internal::CordzInfo& info : token) {
+    const cord_internal::CordzStatistics stats = info.GetCordzStatistics();
+    ++snapshot.cord_count;
+    snapshot.total_size += stats.size;
+    snapshot.max_size = (std::max)(snapshot.max_size, uint64_t{stats.size});
+    snapshot.total_estimated_memory_usage += stats.estimated_memory_usage;
+    snapshot.total_estimated_fair_share_memory_usage +=
+        stats.estimated_fair_share_memory_usage;
+    snapshot.total_node_count += stats.node_count;
+    snapshot.max_node_count =
+        (std::max)(snapshot.max_node_count, uint64_t{stats.node_count});
+
+    const auto& counts = stats.node_counts;
+    snapshot.node_counts.flat += counts.flat;
+    snapshot.node_counts.flat_64 += counts.flat_64;
+    snapshot.node_counts.flat_128 += counts.flat_128;
+    snapshot.node_counts.flat_256 += counts.flat_256;
+    snapshot.node_counts.flat_512 += counts.flat_512;
+    snapshot.node_counts.flat_1k += counts.flat_1k;
+    snapshot.node_counts.external += counts.external;
+    snapshot.node_counts.substring += counts.substring;
+    snapshot.node_counts.btree += counts.btree;
+    snapshot.node_counts.crc += counts.crc;
+
+    updates.LossyAdd(stats.update_tracker);
+  }
+
+  for (int i = 0; i < CordzUpdateTracker::kNumMethods; ++i) {
+    const int64_t count =
+        updates.Value(static_cast<CordzUpdateTracker::MethodIdentifier>(i));
+    if (count != 0) {
+      snapshot.update_counts.push_back({kMethodNames[i], count});
+    }
+  }
+  return snapshot;
+}
+
+ABSL_NAMESPACE_END
+}  // namespace absl
@@ -0,0 +1,111 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// -----------------------------------------------------------------------------
+// File: cordz_snapshot.h
+// -----------------------------------------------------------------------------
+//
+// This header defines `absl::GetCordzSnapshot()`, a supported way to consume
+// the statistics collected by Cordz, the Cord sampling framework. Cordz
+// samples a fraction of all Cord instances (controlled by the
+// `cordz_mean_interval` flag) and records their sizes, tree shapes, and
+// update-method counts. `GetCordzSnapshot()` aggregates the statistics of all
+// currently sampled cords into a plain struct suitable for exporting to
+// monitoring dashboards, without requiring internal headers or manual
+// traversal of the sample list.
+//
+// Taking a snapshot does not block cord mutations: the sample list is
+// traversed lock-free under a deletion guard, and per-cord statistics are
+// computed the same way the Cordz collection path computes them. In builds
+// where Cordz is disabled, the snapshot is empty.
+
+#ifndef ABSL_STRINGS_CORDZ_SNAPSHOT_H_
+#define ABSL_STRINGS_CORDZ_SNAPSHOT_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "absl/base/config.h"
+#include "absl/strings/string_view.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+// CordzSnapshot
+//
+// Aggregated statistics over all cords sampled by Cordz at the time of the
+// snapshot. All totals sum the per-cord values reported by the sampling
+// framework; sampled cords are a statistical sample of all live cords, so
+// fleet-wide values should be scaled by the sampling rate.
+struct CordzSnapshot {
+  // Counts of tree nodes by representation type, summed over all sampled
+  // cords. The `flat_*` fields bucket flat nodes by allocated size and are
+  // included in `flat`.
+  struct NodeCounts {
+    size_t flat = 0;
+    size_t flat_64 = 0;
+    size_t flat_128 = 0;
+    size_t flat_256 = 0;
+    size_t flat_512 = 0;
+    size_t flat_1k = 0;
+    size_t external = 0;
+    size_t substring = 0;
+    size_t btree = 0;
+    size_t crc = 0;
+  };
+
+  // The number of calls to a Cord update method, summed over all sampled
+  // cords. `method` is a stable human-readable name such as "AppendCord".
+  struct UpdateCount {
+    absl::string_view method;
+    int64_t count = 0;
+  };
+
+  // The number of cords sampled in this snapshot.
+  size_t cord_count = 0;
+
+  // Sum and maximum of `Cord::size()` over the sampled cords.
+  uint64_t total_size = 0;
+  uint64_t max_size = 0;
+
+  // Sum of per-cord memory estimates, matching the values reported by
+  // `Cord::EstimatedMemoryUsage()` with `kTotal` and `kFairShare` accounting.
+  uint64_t total_estimated_memory_usage = 0;
+  uint64_t total_estimated_fair_share_memory_usage = 0;
+
+  // Sum and maximum of the number of tree nodes per sampled cord. The maximum
+  // identifies pathologically deep or fragmented cords.
+  uint64_t total_node_count = 0;
+  uint64_t max_node_count = 0;
+
+  // Aggregated node counts by representation type.
+  NodeCounts node_counts;
+
+  // Update-method counts with non-zero totals, in no particular order.
+  std::vector<UpdateCount> update_counts;
+};
+
+// GetCordzSnapshot()
+//
+// Returns aggregated statistics for all currently sampled cords. Each sampled
+// cord's rep is briefly reference-acquired and analyzed off to the side, so
+// concurrent mutations are not blocked for the duration of the analysis. The
+// cost is proportional to the combined tree sizes of the sampled cords.
+CordzSnapshot GetCordzSnapshot();
+
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_STRINGS_CORDZ_SNAPSHOT_H_
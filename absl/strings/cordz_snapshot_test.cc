@@ -0,0 +1,79 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/strings/cordz_snapshot.h"
+
+#include <cstdint>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "absl/base/config.h"
+#include "absl/strings/cord.h"
+#include "absl/strings/cordz_test_helpers.h"
+#include "absl/strings/string_view.h"
+
+#ifdef ABSL_INTERNAL_CORDZ_ENABLED
+
+namespace {
+
+int64_t UpdateCountOf(const absl::CordzSnapshot& snapshot,
+                      absl::string_view method) {
+  for (const auto& update : snapshot.update_counts) {
+    if (update.method == method) return update.count;
+  }
+  return 0;
+}
+
+TEST(CordzSnapshotTest, AggregatesSampledCords) {
+  absl::CordzSamplingIntervalHelper sample_all(1);
+  // Pass const strings so the contents are copied into flat nodes rather
+  // than the string buffers being stolen.
+  const std::string str1(1000, 'x');
+  const std::string str2(2000, 'y');
+  absl::Cord cord1(str1);
+  absl::Cord cord2(str2);
+
+  const absl::CordzSnapshot snapshot = absl::GetCordzSnapshot();
+
+  // Other sampled cords may exist in this process, so all bounds are lower
+  // bounds.
+  EXPECT_GE(snapshot.cord_count, 2u);
+  EXPECT_GE(snapshot.total_size, 3000u);
+  EXPECT_GE(snapshot.max_size, 2000u);
+  EXPECT_GE(snapshot.total_estimated_memory_usage, snapshot.total_size);
+  EXPECT_GE(snapshot.total_estimated_fair_share_memory_usage,
+            snapshot.total_size);
+  EXPECT_GE(snapshot.total_node_count, 2u);
+  EXPECT_GE(snapshot.max_node_count, 1u);
+  EXPECT_GE(snapshot.node_counts.flat, 2u);
+  EXPECT_GE(UpdateCountOf(snapshot, "ConstructorString"), 2);
+}
+
+TEST(CordzSnapshotTest, SnapshotIsConsistent) {
+  absl::CordzSamplingIntervalHelper sample_all(1);
+  absl::Cord cord(std::string(5000, 'z'));
+
+  const absl::CordzSnapshot snapshot = absl::GetCordzSnapshot();
+
+  EXPECT_LE(snapshot.max_size, snapshot.total_size);
+  EXPECT_LE(snapshot.max_node_count, snapshot.total_node_count);
+  for (const auto& update : snapshot.update_counts) {
+    EXPECT_FALSE(update.method.empty());
+    EXPECT_GT(update.count, 0);
+  }
+}
+
+}  // namespace
+
+#endif  // ABSL_INTERNAL_CORDZ_ENABLED
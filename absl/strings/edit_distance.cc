@@ -0,0 +1,110 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/strings/edit_distance.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "absl/base/config.h"
+#include "absl/strings/string_view.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+// Computes the distance with the bit-parallel algorithm of Myers ("A fast
+// bit-vector algorithm for approximate string matching based on dynamic
+// programming", JACM 1999), in the multi-word formulation of Hyyrö. Each
+// column of the dynamic-programming matrix is represented by per-block
+// bit vectors VP/VN of vertical +1/-1 deltas; one column advances with a
+// constant number of word operations per 64 rows. The score of the bottom
+// cell is maintained incrementally, and since it can decrease by at most one
+// per remaining column, a pair whose distance exceeds the cutoff is abandoned
+// as soon as that becomes provable.
+size_t CappedLevenshteinDistance(absl::string_view s1, absl::string_view s2,
+                                 size_t cutoff) {
+  // Let s1 be the shorter string; the distance is symmetric and this
+  // minimizes the number of 64-row blocks.
+  if (s1.size() > s2.size()) std::swap(s1, s2);
+  if (s2.size() - s1.size() > cutoff) return cutoff + 1;
+
+  // A common prefix or suffix never contributes to the distance.
+  while (!s1.empty() && s1.front() == s2.front()) {
+    s1.remove_prefix(1);
+    s2.remove_prefix(1);
+  }
+  while (!s1.empty() && s1.back() == s2.back()) {
+    s1.remove_suffix(1);
+    s2.remove_suffix(1);
+  }
+  // Trimming preserves the length difference, so this is within the cutoff.
+  if (s1.empty()) return s2.size();
+
+  const size_t m = s1.size();  // Rows; one bit per row.
+  const size_t n = s2.size();  // Columns; processed one at a time.
+  const size_t blocks = (m + 63) / 64;
+
+  // peq[c * blocks + b] has bit i set iff s1[b * 64 + i] == c.
+  std::vector<uint64_t> peq(blocks * 256, 0);
+  for (size_t i = 0; i < m; ++i) {
+    peq[static_cast<unsigned char>(s1[i]) * blocks + i / 64] |= uint64_t{1}
+                                                                << (i % 64);
+  }
+
+  std::vector<uint64_t> vp(blocks, ~uint64_t{0});
+  std::vector<uint64_t> vn(blocks, 0);
+  // The bit of the last valid row in the final (possibly partial) block. Bits
+  // above it model rows below the matrix; no character matches there, and
+  // their values never propagate upward, so they are harmless.
+  const uint64_t last_row_bit = uint64_t{1} << ((m - 1) % 64);
+
+  size_t score = m;  // Bottom cell of the zeroth column.
+  for (size_t j = 0; j < n; ++j) {
+    const uint64_t* eq_col =
+        &peq[static_cast<unsigned char>(s2[j]) * blocks];
+    // Horizontal delta entering the top of the current block; +1 at row zero
+    // since the top boundary row of the matrix holds 0, 1, ..., n.
+    int hin = 1;
+    for (size_t b = 0; b < blocks; ++b) {
+      uint64_t eq = eq_col[b];
+      const uint64_t xv = eq | vn[b];
+      if (hin < 0) eq |= 1;
+      const uint64_t xh = (((eq & vp[b]) + vp[b]) ^ vp[b]) | eq;
+      uint64_t ph = vn[b] | ~(xh | vp[b]);
+      uint64_t mh = vp[b] & xh;
+      const uint64_t out_bit =
+          b + 1 == blocks ? last_row_bit : uint64_t{1} << 63;
+      const int hout = (ph & out_bit) ? 1 : (mh & out_bit) ? -1 : 0;
+      ph <<= 1;
+      mh <<= 1;
+      if (hin > 0) {
+        ph |= 1;
+      } else if (hin < 0) {
+        mh |= 1;
+      }
+      vp[b] = mh | ~(xv | ph);
+      vn[b] = ph & xv;
+      hin = hout;
+    }
+    score += static_cast<size_t>(hin);  // hin is the last block's hout.
+    // The bottom score decreases by at most one per remaining column.
+    if (score > cutoff + (n - j - 1)) return cutoff + 1;
+  }
+  return score;
+}
+
+ABSL_NAMESPACE_END
+}  // namespace absl
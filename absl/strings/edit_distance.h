@@ -0,0 +1,53 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// -----------------------------------------------------------------------------
+// File: edit_distance.h
+// -----------------------------------------------------------------------------
+//
+// This header file contains `absl::CappedLevenshteinDistance()`, a bounded
+// edit-distance computation suitable for fuzzy matching and deduplication of
+// large numbers of string pairs.
+
+#ifndef ABSL_STRINGS_EDIT_DISTANCE_H_
+#define ABSL_STRINGS_EDIT_DISTANCE_H_
+
+#include <cstddef>
+
+#include "absl/base/attributes.h"
+#include "absl/base/config.h"
+#include "absl/strings/string_view.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+// CappedLevenshteinDistance()
+//
+// Returns the Levenshtein distance between `s1` and `s2` — the minimum number
+// of single-character insertions, deletions, and substitutions converting one
+// into the other — or `cutoff + 1` if the distance exceeds `cutoff`.
+//
+// The computation is bit-parallel (Myers' algorithm, 64 rows per machine
+// word) and abandons a pair as soon as the distance provably exceeds the
+// cutoff, so checks with a small cutoff over long strings are cheap. There is
+// no restriction on string length. Strings are compared bytewise; `cutoff`
+// must be less than `SIZE_MAX`.
+ABSL_MUST_USE_RESULT size_t CappedLevenshteinDistance(absl::string_view s1,
+                                                      absl::string_view s2,
+                                                      size_t cutoff);
+
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_STRINGS_EDIT_DISTANCE_H_
@@ -0,0 +1,97 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/strings/edit_distance.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "absl/strings/string_view.h"
+
+namespace {
+
+// Textbook dynamic-programming Levenshtein distance, as a reference.
+size_t ReferenceDistance(absl::string_view s1, absl::string_view s2) {
+  std::vector<size_t> row(s2.size() + 1);
+  for (size_t j = 0; j <= s2.size(); ++j) row[j] = j;
+  for (size_t i = 1; i <= s1.size(); ++i) {
+    size_t diag = row[0];
+    row[0] = i;
+    for (size_t j = 1; j <= s2.size(); ++j) {
+      const size_t next_diag = row[j];
+      row[j] = std::min({row[j] + 1, row[j - 1] + 1,
+                         diag + (s1[i - 1] == s2[j - 1] ? 0 : 1)});
+      diag = next_diag;
+    }
+  }
+  return row[s2.size()];
+}
+
+TEST(CappedLevenshteinDistance, Basics) {
+  EXPECT_EQ(0, absl::CappedLevenshteinDistance("", "", 5));
+  EXPECT_EQ(0, absl::CappedLevenshteinDistance("same", "same", 5));
+  EXPECT_EQ(3, absl::CappedLevenshteinDistance("kitten", "sitting", 5));
+  EXPECT_EQ(2, absl::CappedLevenshteinDistance("flaw", "lawn", 5));
+  EXPECT_EQ(5, absl::CappedLevenshteinDistance("", "12345", 5));
+  EXPECT_EQ(1, absl::CappedLevenshteinDistance("abcdef", "abdef", 5));
+}
+
+TEST(CappedLevenshteinDistance, Cutoff) {
+  // Exceeding the cutoff returns cutoff + 1, including via the length
+  // difference alone.
+  EXPECT_EQ(3, absl::CappedLevenshteinDistance("kitten", "sitting", 2));
+  EXPECT_EQ(4, absl::CappedLevenshteinDistance("", "12345", 3));
+  EXPECT_EQ(1, absl::CappedLevenshteinDistance("abc", "xyz", 0));
+  EXPECT_EQ(0, absl::CappedLevenshteinDistance("abc", "abc", 0));
+  // A distance exactly equal to the cutoff is returned as is.
+  EXPECT_EQ(3, absl::CappedLevenshteinDistance("kitten", "sitting", 3));
+}
+
+TEST(CappedLevenshteinDistance, LongStrings) {
+  // No 100-character restriction: identical megabyte strings differ by their
+  // edits only.
+  std::string a(100000, 'x');
+  std::string b = a;
+  EXPECT_EQ(0, absl::CappedLevenshteinDistance(a, b, 10));
+  b[500] = 'y';
+  b[70000] = 'z';
+  b.insert(12345, "q");
+  EXPECT_EQ(3, absl::CappedLevenshteinDistance(a, b, 10));
+  EXPECT_EQ(3, absl::CappedLevenshteinDistance(a, b, 2));
+}
+
+TEST(CappedLevenshteinDistance, MatchesReference) {
+  // Randomized agreement with the quadratic reference across lengths that
+  // straddle the 64- and 128-row block boundaries, over a small alphabet to
+  // make all edit types common.
+  std::mt19937 rng(1234);
+  for (int iter = 0; iter < 2000; ++iter) {
+    const size_t len1 = rng() % 150;
+    const size_t len2 = rng() % 150;
+    std::string s1, s2;
+    for (size_t i = 0; i < len1; ++i) s1.push_back('a' + rng() % 4);
+    for (size_t i = 0; i < len2; ++i) s2.push_back('a' + rng() % 4);
+    const size_t expected = ReferenceDistance(s1, s2);
+    const size_t cutoff = rng() % 16;
+    const size_t capped = std::min(expected, cutoff + 1);
+    ASSERT_EQ(capped, absl::CappedLevenshteinDistance(s1, s2, cutoff))
+        << "s1=" << s1 << " s2=" << s2 << " cutoff=" << cutoff;
+  }
+}
+
+}  // namespace
@@ -36,6 +36,11 @@
 #include "absl/strings/str_cat.h"
 #include "absl/strings/string_view.h"
 
+#ifdef __SSSE3__
+#define ABSL_INTERNAL_ESCAPING_HAVE_SSSE3 1
+#include <tmmintrin.h>
+#endif
+
 namespace absl {
 ABSL_NAMESPACE_BEGIN
 namespace {
@@ -322,12 +327,56 @@ bool CUnescapeInternal(absl::string_view source, bool leave_nulls_escaped,
 //
 //    Escaped chars: \n, \r, \t, ", ', \, and !absl::ascii_isprint().
 // ----------------------------------------------------------------------
+// Returns true if no CEscape variant needs to escape `uc`. When `utf8_safe`
+// is true, bytes with the high bit set are also passed through verbatim.
+inline bool CEscapeIsCleanByte(unsigned char uc, bool utf8_safe) {
+  return (uc >= 0x20 && uc < 0x7f && uc != '"' && uc != '\'' && uc != '\\') ||
+         (utf8_safe && uc >= 0x80);
+}
+
+// Returns the length of the longest prefix of `src` in which every byte is
+// clean per CEscapeIsCleanByte(). Scans 32-byte chunks with a branch-free
+// inner loop that compilers vectorize, since typical inputs contain no
+// escapable bytes at all.
+inline size_t CEscapeCleanPrefixLength(absl::string_view src, bool utf8_safe) {
+  constexpr size_t kChunkSize = 32;
+  size_t i = 0;
+  while (i + kChunkSize <= src.size()) {
+    unsigned int dirty = 0;
+    for (size_t j = 0; j < kChunkSize; ++j) {
+      dirty |= static_cast<unsigned int>(!CEscapeIsCleanByte(
+          static_cast<unsigned char>(src[i + j]), utf8_safe));
+    }
+    if (dirty != 0) break;
+    i += kChunkSize;
+  }
+  while (i < src.size() &&
+         CEscapeIsCleanByte(static_cast<unsigned char>(src[i]), utf8_safe)) {
+    ++i;
+  }
+  return i;
+}
+
 std::string CEscapeInternal(absl::string_view src, bool use_hex,
                             bool utf8_safe) {
   std::string dest;
   bool last_hex_escape = false;  // true if last output char was \xNN.
 
-  for (char c : src) {
+  while (!src.empty()) {
+    // Bulk-copy the longest prefix with nothing to escape. After a hex escape
+    // a leading hex digit must itself be escaped, so let the per-character
+    // path below handle that byte.
+    if (!last_hex_escape || !absl::ascii_isxdigit(src.front())) {
+      size_t clean_len = CEscapeCleanPrefixLength(src, utf8_safe);
+      if (clean_len > 0) {
+        dest.append(src.data(), clean_len);
+        src.remove_prefix(clean_len);
+        last_hex_escape = false;
+        if (src.empty()) break;
+      }
+    }
+    char c = src.front();
+    src.remove_prefix(1);
     bool is_hex_escape = false;
     switch (c) {
       case '\n': dest.append("\\" "n"); break;
@@ -399,7 +448,13 @@ inline size_t CEscapedLength(absl::string_view src) {
       std::min<size_t>(src.size(), std::numeric_limits<size_t>::max() / 4);
   size_t i = 0;
   while (i < unchecked_limit) {
-    // Common case: No need to check for overflow.
+    // Common case: No need to check for overflow. Skip over clean runs
+    // wholesale; they contribute one output byte per input byte.
+    size_t clean_len = CEscapeCleanPrefixLength(
+        src.substr(i, unchecked_limit - i), /*utf8_safe=*/false);
+    i += clean_len;
+    escaped_len += clean_len;
+    if (i >= unchecked_limit) break;
     escaped_len += kCEscapedLen[static_cast<unsigned char>(src[i++])];
   }
   while (i < src.size()) {
@@ -429,7 +484,18 @@ void CEscapeAndAppendInternal(absl::string_view src,
                                                  cur_dest_len + escaped_len);
   char* append_ptr = &(*dest)[cur_dest_len];
 
-  for (char c : src) {
+  while (!src.empty()) {
+    // memcpy runs of bytes that escape to themselves; clean bytes per
+    // CEscapeCleanPrefixLength() are exactly those with kCEscapedLen == 1.
+    size_t clean_len = CEscapeCleanPrefixLength(src, /*utf8_safe=*/false);
+    if (clean_len > 0) {
+      memcpy(append_ptr, src.data(), clean_len);
+      append_ptr += clean_len;
+      src.remove_prefix(clean_len);
+      if (src.empty()) break;
+    }
+    char c = src.front();
+    src.remove_prefix(1);
     size_t char_len = kCEscapedLen[static_cast<unsigned char>(c)];
     if (char_len == 1) {
       *append_ptr++ = c;
@@ -469,6 +535,222 @@ void CEscapeAndAppendInternal(absl::string_view src,
   }
 }
 
+// ----------------------------------------------------------------------
+// JsonEscape()
+//    Escapes 'src' for embedding in a double-quoted JSON string
+//    (RFC 8259): '"', '\\', and the control characters below 0x20.
+//    Bytes with the high bit set are assumed to be UTF-8 and are passed
+//    through untouched. Structured the same way as CEscape above: a
+//    vectorizable prescan finds runs with nothing to escape, which are
+//    bulk-copied; only the (rare) escapable bytes take the scalar path.
+// ----------------------------------------------------------------------
+// Returns true if JSON escaping passes `uc` through verbatim.
+inline bool JsonEscapeIsCleanByte(unsigned char uc) {
+  return uc >= 0x20 && uc != '"' && uc != '\\';
+}
+
+// Returns the length of the longest prefix of `src` in which every byte is
+// clean per JsonEscapeIsCleanByte(). Same branch-free 32-byte chunk scan as
+// CEscapeCleanPrefixLength().
+inline size_t JsonEscapeCleanPrefixLength(absl::string_view src) {
+  constexpr size_t kChunkSize = 32;
+  size_t i = 0;
+  while (i + kChunkSize <= src.size()) {
+    unsigned int dirty = 0;
+    for (size_t j = 0; j < kChunkSize; ++j) {
+      dirty |= static_cast<unsigned int>(
+          !JsonEscapeIsCleanByte(static_cast<unsigned char>(src[i + j])));
+    }
+    if (dirty != 0) break;
+    i += kChunkSize;
+  }
+  while (i < src.size() &&
+         JsonEscapeIsCleanByte(static_cast<unsigned char>(src[i]))) {
+    ++i;
+  }
+  return i;
+}
+
+// Escaped output length per input byte: 1 for clean bytes, 2 for the
+// two-character escapes \b, \t, \n, \f, \r, \", and \\, and 6 (\u00XX) for
+// the remaining control characters.
+/* clang-format off */
+constexpr unsigned char kJsonEscapedLen[256] = {
+    6, 6, 6, 6, 6, 6, 6, 6, 2, 2, 2, 6, 2, 2, 6, 6,  // \b, \t, \n, \f, \r
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,  // "
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1,  // '\'
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+};
+/* clang-format on */
+
+// Calculates the length of the JSON-escaped version of 'src'.
+inline size_t JsonEscapedLength(absl::string_view src) {
+  size_t escaped_len = 0;
+  // The maximum value of kJsonEscapedLen[x] is 6, so we can escape any string
+  // of length size_t_max/6 without checking for overflow.
+  size_t unchecked_limit =
+      std::min<size_t>(src.size(), std::numeric_limits<size_t>::max() / 6);
+  size_t i = 0;
+  while (i < unchecked_limit) {
+    // Common case: no need to check for overflow. Clean runs contribute one
+    // output byte per input byte; skip over them wholesale.
+    size_t clean_len =
+        JsonEscapeCleanPrefixLength(src.substr(i, unchecked_limit - i));
+    i += clean_len;
+    escaped_len += clean_len;
+    if (i >= unchecked_limit) break;
+    escaped_len += kJsonEscapedLen[static_cast<unsigned char>(src[i++])];
+  }
+  while (i < src.size()) {
+    // Beyond unchecked_limit we need to check for overflow before adding.
+    size_t char_len = kJsonEscapedLen[static_cast<unsigned char>(src[i++])];
+    ABSL_INTERNAL_CHECK(
+        escaped_len <= std::numeric_limits<size_t>::max() - char_len,
+        "escaped_len overflow");
+    escaped_len += char_len;
+  }
+  return escaped_len;
+}
+
+void JsonEscapeAndAppendInternal(absl::string_view src,
+                                 absl::Nonnull<std::string*> dest) {
+  size_t escaped_len = JsonEscapedLength(src);
+  if (escaped_len == src.size()) {
+    dest->append(src.data(), src.size());
+    return;
+  }
+
+  size_t cur_dest_len = dest->size();
+  ABSL_INTERNAL_CHECK(
+      cur_dest_len <= std::numeric_limits<size_t>::max() - escaped_len,
+      "std::string size overflow");
+  strings_internal::STLStringResizeUninitialized(dest,
+                                                 cur_dest_len + escaped_len);
+  char* append_ptr = &(*dest)[cur_dest_len];
+
+  while (!src.empty()) {
+    // memcpy runs of bytes that escape to themselves; clean bytes per
+    // JsonEscapeCleanPrefixLength() are exactly those with
+    // kJsonEscapedLen == 1.
+    size_t clean_len = JsonEscapeCleanPrefixLength(src);
+    if (clean_len > 0) {
+      memcpy(append_ptr, src.data(), clean_len);
+      append_ptr += clean_len;
+      src.remove_prefix(clean_len);
+      if (src.empty()) break;
+    }
+    char c = src.front();
+    src.remove_prefix(1);
+    if (kJsonEscapedLen[static_cast<unsigned char>(c)] == 2) {
+      *append_ptr++ = '\\';
+      switch (c) {
+        case '\b': *append_ptr++ = 'b'; break;
+        case '\t': *append_ptr++ = 't'; break;
+        case '\n': *append_ptr++ = 'n'; break;
+        case '\f': *append_ptr++ = 'f'; break;
+        case '\r': *append_ptr++ = 'r'; break;
+        case '\"': *append_ptr++ = '\"'; break;
+        case '\\': *append_ptr++ = '\\'; break;
+      }
+    } else {
+      // The remaining control characters have no short form; JSON requires
+      // \u followed by four hex digits.
+      const unsigned char uc = static_cast<unsigned char>(c);
+      *append_ptr++ = '\\';
+      *append_ptr++ = 'u';
+      *append_ptr++ = '0';
+      *append_ptr++ = '0';
+      *append_ptr++ = numbers_internal::kHexChar[uc / 16];
+      *append_ptr++ = numbers_internal::kHexChar[uc % 16];
+    }
+  }
+}
+
+#ifdef ABSL_INTERNAL_ESCAPING_HAVE_SSSE3
+// Decodes the 16 base64 characters at `src` into 12 bytes at `dest`. Returns
+// false without writing anything if any of the 16 characters is not a data
+// character of the selected alphabet (whitespace, padding, or an illegal
+// byte); the caller falls back to the scalar decoder in that case.
+//
+// Character validation and translation use nibble-indexed shuffle lookups,
+// following Mula & Lemire, "Faster Base64 Encoding and Decoding Using AVX2
+// Instructions" (2018), restricted to the 128-bit instructions.
+inline bool Base64DecodeBlock(const unsigned char* src, bool web_safe,
+                              char* dest) {
+  const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+  // lut_hi assigns a bit to each 16-character row of the ASCII table; the
+  // corresponding lut_lo entry has that bit set for every column that is
+  // *not* a data character in that row. A character is valid iff the bits
+  // selected by its high and low nibbles do not intersect.
+  const __m128i lut_lo =
+      web_safe
+          ? _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                          0x11, 0x11, 0x13, 0x3B, 0x3B, 0x3A, 0x3B, 0x33)
+          : _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                          0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+  const __m128i lut_hi =
+      web_safe
+          ? _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x20,
+                          0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10)
+          : _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+                          0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+  const __m128i hi_nibbles =
+      _mm_and_si128(_mm_srli_epi32(in, 4), _mm_set1_epi8(0x0f));
+  const __m128i lo_nibbles = _mm_and_si128(in, _mm_set1_epi8(0x0f));
+  const __m128i lo = _mm_shuffle_epi8(lut_lo, lo_nibbles);
+  const __m128i hi = _mm_shuffle_epi8(lut_hi, hi_nibbles);
+  if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(lo, hi),
+                                       _mm_setzero_si128())) != 0xffff) {
+    return false;
+  }
+  // Translate each character to its 6-bit value by adding an offset selected
+  // by the character's high nibble.
+  __m128i roll;
+  if (web_safe) {
+    roll = _mm_shuffle_epi8(
+        _mm_setr_epi8(0, 0, 17, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0),
+        hi_nibbles);
+    // '_' (0x5f) shares a high nibble with 'P'..'Z' but needs a different
+    // offset: -65 + 33 == -32 maps it to 63.
+    roll = _mm_add_epi8(roll,
+                        _mm_and_si128(_mm_cmpeq_epi8(in, _mm_set1_epi8(0x5f)),
+                                      _mm_set1_epi8(33)));
+  } else {
+    // '/' (0x2f) shares a high nibble with '+' but needs a different offset;
+    // comparing against it shifts its lookup slot from 2 down to 1.
+    const __m128i eq_2f = _mm_cmpeq_epi8(in, _mm_set1_epi8(0x2f));
+    roll = _mm_shuffle_epi8(
+        _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0,
+                      0),
+        _mm_add_epi8(eq_2f, hi_nibbles));
+  }
+  const __m128i values = _mm_add_epi8(in, roll);
+  // Pack the four 6-bit values in each 32-bit lane into three bytes, and the
+  // four 3-byte groups into the low 12 bytes of the vector.
+  const __m128i merged = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+  const __m128i packed = _mm_madd_epi16(merged, _mm_set1_epi32(0x00011000));
+  const __m128i shuffled = _mm_shuffle_epi8(
+      packed,
+      _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+  char buf[16];
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(buf), shuffled);
+  memcpy(dest, buf, 12);
+  return true;
+}
+#endif  // ABSL_INTERNAL_ESCAPING_HAVE_SSSE3
+
 // Reverses the mapping in Base64EscapeInternal; see that method's
 // documentation for details of the mapping.
 bool Base64UnescapeInternal(absl::Nullable<const char*> src_param, size_t szsrc,
@@ -512,6 +794,20 @@ bool Base64UnescapeInternal(absl::Nullable<const char*> src_param, size_t szsrc,
   // outside it instead of in every iteration.
 
   if (dest) {
+#ifdef ABSL_INTERNAL_ESCAPING_HAVE_SSSE3
+    // Bulk-decode 16 characters into 12 bytes at a time while the input is
+    // all data characters. Base64DecodeBlock() rejects blocks containing
+    // whitespace, padding, or illegal characters without consuming them, so
+    // the scalar loop below resumes wherever this loop stops.
+    const bool web_safe = unbase64[static_cast<unsigned char>('-')] == 62;
+    while (szsrc >= 16 && destidx + 12 <= szdest) {
+      if (!Base64DecodeBlock(src, web_safe, dest + destidx)) break;
+      src += 16;
+      szsrc -= 16;
+      destidx += 12;
+    }
+#endif
+
     // This loop consumes 4 input bytes and produces 3 output bytes
     // per iteration.  We can't know at the start that there is enough
     // data left in the string for a full iteration, so the loop may
@@ -876,13 +1172,104 @@ constexpr signed char kHexValueStrict[256] = {
 };
 /* clang-format on */
 
+#ifdef ABSL_INTERNAL_ESCAPING_HAVE_SSSE3
+// Encodes the 16 bytes at `src` as 32 lowercase hex characters at `dest`
+// using nibble-indexed shuffle lookups.
+inline void HexEncodeBlock(absl::Nonnull<const unsigned char*> src,
+                           absl::Nonnull<char*> dest) {
+  const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+  const __m128i hex_digits =
+      _mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b',
+                    'c', 'd', 'e', 'f');
+  const __m128i hi_nibbles =
+      _mm_and_si128(_mm_srli_epi32(in, 4), _mm_set1_epi8(0x0f));
+  const __m128i lo_nibbles = _mm_and_si128(in, _mm_set1_epi8(0x0f));
+  const __m128i hi_chars = _mm_shuffle_epi8(hex_digits, hi_nibbles);
+  const __m128i lo_chars = _mm_shuffle_epi8(hex_digits, lo_nibbles);
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(dest),
+                   _mm_unpacklo_epi8(hi_chars, lo_chars));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + 16),
+                   _mm_unpackhi_epi8(hi_chars, lo_chars));
+}
+
+// Decodes the 32 hex characters at `src` into 16 bytes at `dest`. Returns
+// false without writing anything if any of the 32 characters is not a hex
+// digit; the caller falls back to the scalar decoder in that case.
+//
+// Validation uses the same row/column bit-intersection scheme as
+// Base64DecodeBlock() above: hex digits occupy row 3 ('0'..'9') and columns
+// 1..6 of rows 4 and 6 ('A'..'F', 'a'..'f') of the ASCII table.
+inline bool HexDecodeHalfBlock(const __m128i in,
+                               absl::Nonnull<__m128i*> nibbles) {
+  const __m128i lut_lo =
+      _mm_setr_epi8(0x0e, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0e, 0x0e,
+                    0x0e, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f);
+  const __m128i lut_hi =
+      _mm_setr_epi8(0x08, 0x08, 0x08, 0x01, 0x02, 0x08, 0x04, 0x08, 0x08,
+                    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08);
+  const __m128i hi_nibbles =
+      _mm_and_si128(_mm_srli_epi32(in, 4), _mm_set1_epi8(0x0f));
+  const __m128i lo_nibbles = _mm_and_si128(in, _mm_set1_epi8(0x0f));
+  const __m128i lo = _mm_shuffle_epi8(lut_lo, lo_nibbles);
+  const __m128i hi = _mm_shuffle_epi8(lut_hi, hi_nibbles);
+  if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(lo, hi),
+                                       _mm_setzero_si128())) != 0xffff) {
+    return false;
+  }
+  // Translate each digit to its value with an offset selected by the
+  // character's high nibble: -'0' for '0'..'9', -'A'+10 for 'A'..'F', and
+  // -'a'+10 for 'a'..'f'.
+  const __m128i roll = _mm_shuffle_epi8(
+      _mm_setr_epi8(0, 0, 0, -48, -55, 0, -87, 0, 0, 0, 0, 0, 0, 0, 0, 0),
+      hi_nibbles);
+  *nibbles = _mm_add_epi8(in, roll);
+  return true;
+}
+
+inline bool HexDecodeBlock(absl::Nonnull<const unsigned char*> src,
+                           absl::Nonnull<char*> dest) {
+  __m128i lo_values, hi_values;
+  if (!HexDecodeHalfBlock(
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(src)),
+          &lo_values) ||
+      !HexDecodeHalfBlock(
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 16)),
+          &hi_values)) {
+    return false;
+  }
+  // Combine adjacent digit values into bytes (first digit is the high
+  // nibble), then narrow the two vectors of 16-bit bytes into one.
+  const __m128i pair_weights = _mm_set1_epi16(0x0110);
+  const __m128i bytes =
+      _mm_packus_epi16(_mm_maddubs_epi16(lo_values, pair_weights),
+                       _mm_maddubs_epi16(hi_values, pair_weights));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(dest), bytes);
+  return true;
+}
+#endif  // ABSL_INTERNAL_ESCAPING_HAVE_SSSE3
+
 // This is a templated function so that T can be either a char*
 // or a string.  This works because we use the [] operator to access
 // individual characters at a time.
 template <typename T>
 void HexStringToBytesInternal(absl::Nullable<const char*> from, T to,
                               size_t num) {
-  for (size_t i = 0; i < num; i++) {
+  size_t i = 0;
+#ifdef ABSL_INTERNAL_ESCAPING_HAVE_SSSE3
+  // Bulk-decode while the input is all hex digits; HexDecodeBlock() rejects
+  // blocks containing other characters without consuming them, so the scalar
+  // loop below resumes wherever this loop stops and applies the lenient
+  // mapping to the offending bytes.
+  if (num >= 16) {
+    char* to_ptr = &to[0];
+    while (i + 16 <= num &&
+           HexDecodeBlock(reinterpret_cast<const unsigned char*>(from + i * 2),
+                          to_ptr + i)) {
+      i += 16;
+    }
+  }
+#endif
+  for (; i < num; i++) {
     to[i] = static_cast<char>(kHexValueLenient[from[i * 2] & 0xFF] << 4) +
             (kHexValueLenient[from[i * 2 + 1] & 0xFF]);
   }
@@ -894,7 +1281,14 @@ template <typename T>
 void BytesToHexStringInternal(absl::Nullable<const unsigned char*> src, T dest,
                               size_t num) {
   auto dest_ptr = &dest[0];
-  for (auto src_ptr = src; src_ptr != (src + num); ++src_ptr, dest_ptr += 2) {
+  auto src_ptr = src;
+  const auto src_end = src + num;
+#ifdef ABSL_INTERNAL_ESCAPING_HAVE_SSSE3
+  for (; src_end - src_ptr >= 16; src_ptr += 16, dest_ptr += 32) {
+    HexEncodeBlock(src_ptr, dest_ptr);
+  }
+#endif
+  for (; src_ptr != src_end; ++src_ptr, dest_ptr += 2) {
     const char* hex_p = &numbers_internal::kHexTable[*src_ptr * 2];
     std::copy(hex_p, hex_p + 2, dest_ptr);
   }
@@ -930,6 +1324,16 @@ std::string Utf8SafeCHexEscape(absl::string_view src) {
   return CEscapeInternal(src, true, true);
 }
 
+void JsonEscape(absl::string_view src, absl::Nonnull<std::string*> dest) {
+  JsonEscapeAndAppendInternal(src, dest);
+}
+
+std::string JsonEscape(absl::string_view src) {
+  std::string dest;
+  JsonEscapeAndAppendInternal(src, &dest);
+  return dest;
+}
+
 bool Base64Unescape(absl::string_view src, absl::Nonnull<std::string*> dest) {
   return Base64UnescapeInternal(src.data(), src.size(), dest, kUnBase64);
 }
@@ -979,7 +1383,19 @@ bool HexStringToBytes(absl::string_view hex,
 
   absl::strings_internal::STLStringResizeUninitialized(&output, num_bytes);
   auto hex_p = hex.cbegin();
-  for (std::string::iterator bin_p = output.begin(); bin_p != output.end();
+  std::string::iterator bin_start = output.begin();
+#ifdef ABSL_INTERNAL_ESCAPING_HAVE_SSSE3
+  // Bulk-decode while the input is all hex digits; HexDecodeBlock() rejects
+  // blocks containing other characters without consuming them, so the scalar
+  // loop below resumes wherever this loop stops and reports the error.
+  while (output.end() - bin_start >= 16 &&
+         HexDecodeBlock(reinterpret_cast<const unsigned char*>(&*hex_p),
+                        &*bin_start)) {
+    hex_p += 32;
+    bin_start += 16;
+  }
+#endif
+  for (std::string::iterator bin_p = bin_start; bin_p != output.end();
        ++bin_p) {
     int h1 = absl::kHexValueStrict[static_cast<size_t>(*hex_p++)];
     int h2 = absl::kHexValueStrict[static_cast<size_t>(*hex_p++)];
@@ -121,6 +121,24 @@ std::string Utf8SafeCEscape(absl::string_view src);
 // conversion.
 std::string Utf8SafeCHexEscape(absl::string_view src);
 
+// JsonEscape()
+//
+// Escapes a `src` string for embedding in a double-quoted JSON string
+// (RFC 8259), appending the result to `*dest`. The escape set is '"', '\\',
+// and the control characters below 0x20; the two-character escapes `\b`,
+// `\t`, `\n`, `\f`, `\r`, `\"`, and `\\` are used where JSON defines them
+// and `\u00XX` otherwise. Bytes with the high bit set are assumed to be
+// UTF-8 and are passed through unchanged; the surrounding quotation marks
+// are not added.
+//
+// Example:
+//
+//   std::string escaped;
+//   absl::JsonEscape("line1\nline2\t\"quoted\"", &escaped);
+//   EXPECT_EQ(escaped, "line1\\nline2\\t\\\"quoted\\\"");
+void JsonEscape(absl::string_view src, absl::Nonnull<std::string*> dest);
+std::string JsonEscape(absl::string_view src);
+
 // Base64Escape()
 //
 // Encodes a `src` string into a base64-encoded 'dest' string with padding
@@ -156,6 +156,75 @@ TEST(CEscape, BasicEscaping) {
   }
 }
 
+TEST(CEscape, LongStringsWithChunkedCleanRuns) {
+  // Exercises the bulk clean-run scan: clean strings much longer than the
+  // internal chunk size and escapable bytes placed near chunk boundaries.
+  std::string clean(1000, 'a');
+  EXPECT_EQ(absl::CEscape(clean), clean);
+  EXPECT_EQ(absl::CHexEscape(clean), clean);
+  EXPECT_EQ(absl::Utf8SafeCEscape(clean), clean);
+  EXPECT_EQ(absl::Utf8SafeCHexEscape(clean), clean);
+
+  for (size_t pos : {size_t{0}, size_t{31}, size_t{32}, size_t{33},
+                     size_t{63}, size_t{64}, size_t{999}}) {
+    std::string s = clean;
+    s[pos] = '\n';
+    std::string expected = clean;
+    expected.replace(pos, 1, "\\n");
+    EXPECT_EQ(absl::CEscape(s), expected);
+    EXPECT_EQ(absl::CHexEscape(s), expected);
+  }
+
+  // A hex digit directly after a hex escape must itself be escaped, even
+  // when it starts an otherwise clean run.
+  std::string hex_adjacent = std::string("\x01") + "f" + std::string(100, 'g');
+  EXPECT_EQ(absl::CHexEscape(hex_adjacent),
+            "\\x01\\x66" + std::string(100, 'g'));
+}
+
+TEST(JsonEscape, BasicEscaping) {
+  epair values[] = {
+      {"", ""},
+      {"hello world", "hello world"},
+      {"line1\\nline2\\t\\\"quoted\\\"", "line1\nline2\t\"quoted\""},
+      {"back\\\\slash", "back\\slash"},
+      {"\\b\\t\\n\\f\\r", "\b\t\n\f\r"},
+      // Control characters without a short form use \u00XX.
+      {"\\u0000\\u0001\\u001f", std::string("\0\x01\x1f", 3)},
+      // Single quotes and DEL are not in the JSON escape set.
+      {"it's \x7f", "it's \x7f"},
+      // High-bit bytes (UTF-8) pass through untouched.
+      {"\xe8\xb0\xb7\xe6\xad\x8c is Google's Chinese name",
+       "\xe8\xb0\xb7\xe6\xad\x8c is Google's Chinese name"},
+  };
+  for (const epair& val : values) {
+    EXPECT_EQ(absl::JsonEscape(val.unescaped), val.escaped);
+    std::string appended = "prefix:";
+    absl::JsonEscape(val.unescaped, &appended);
+    EXPECT_EQ(appended, std::string("prefix:") + val.escaped);
+  }
+}
+
+TEST(JsonEscape, LongStringsWithChunkedCleanRuns) {
+  // Exercises the bulk clean-run scan, as for CEscape above.
+  std::string clean(1000, 'a');
+  EXPECT_EQ(absl::JsonEscape(clean), clean);
+
+  for (size_t pos : {size_t{0}, size_t{31}, size_t{32}, size_t{33},
+                     size_t{63}, size_t{64}, size_t{999}}) {
+    std::string s = clean;
+    s[pos] = '"';
+    std::string expected = clean;
+    expected.replace(pos, 1, "\\\"");
+    EXPECT_EQ(absl::JsonEscape(s), expected);
+
+    s[pos] = '\x02';
+    expected = clean;
+    expected.replace(pos, 1, "\\u0002");
+    EXPECT_EQ(absl::JsonEscape(s), expected);
+  }
+}
+
 TEST(Unescape, BasicFunction) {
   epair tests[] =
     {{"", ""},
@@ -667,6 +736,37 @@ TEST(Base64, Padding) {
   }
 }
 
+TEST(Base64, LongStrings) {
+  // Round-trip inputs long enough to exercise the bulk (vectorized) encode
+  // and decode loops, at every length mod 3, for both alphabets.
+  std::string plaintext;
+  for (int i = 0; i < 256; ++i) {
+    plaintext.push_back(static_cast<char>(i * 89));
+
+    std::string encoded = absl::Base64Escape(plaintext);
+    std::string decoded;
+    EXPECT_TRUE(absl::Base64Unescape(encoded, &decoded));
+    EXPECT_EQ(decoded, plaintext);
+
+    encoded = absl::WebSafeBase64Escape(plaintext);
+    EXPECT_TRUE(absl::WebSafeBase64Unescape(encoded, &decoded));
+    EXPECT_EQ(decoded, plaintext);
+  }
+
+  // Whitespace inside a long input kicks decoding back to the slow path;
+  // it must still decode to the same bytes.
+  std::string encoded = absl::Base64Escape(plaintext);
+  encoded.insert(encoded.size() / 2, "\n \t");
+  std::string decoded;
+  EXPECT_TRUE(absl::Base64Unescape(encoded, &decoded));
+  EXPECT_EQ(decoded, plaintext);
+
+  // An illegal character far into a long input is still rejected.
+  encoded = absl::Base64Escape(plaintext);
+  encoded[encoded.size() - 2] = '*';
+  EXPECT_FALSE(absl::Base64Unescape(encoded, &decoded));
+}
+
 TEST(Base64, DISABLED_HugeData) {
   const size_t kSize = size_t(3) * 1000 * 1000 * 1000;
   static_assert(kSize % 3 == 0, "kSize must be divisible by 3");
@@ -725,6 +825,40 @@ TEST(Escaping, HexStringToBytesBackToHex) {
   EXPECT_EQ("", bytes);  // Results in empty output.
 }
 
+TEST(Escaping, HexRoundTripLongInputs) {
+  // Long inputs exercise the 16-byte block codecs; cover every byte value
+  // and lengths straddling the block boundary.
+  std::string bytes;
+  for (int i = 0; i < 256; ++i) {
+    bytes.push_back(static_cast<char>(i));
+
+    std::string hex = absl::BytesToHexString(bytes);
+    ASSERT_EQ(hex.size(), 2 * bytes.size());
+    std::string decoded;
+    ASSERT_TRUE(absl::HexStringToBytes(hex, &decoded));
+    ASSERT_EQ(decoded, bytes);
+  }
+
+  // An illegal character far into a long input is still rejected, whether it
+  // lands mid-block or in the scalar tail.
+  std::string hex = absl::BytesToHexString(bytes);
+  for (size_t pos : {size_t{0}, size_t{17}, size_t{32}, hex.size() - 1}) {
+    std::string bad = hex;
+    bad[pos] = 'g';
+    std::string decoded;
+    EXPECT_FALSE(absl::HexStringToBytes(bad, &decoded));
+  }
+
+  // The lenient deprecated overload treats illegal characters as zero
+  // digits; the block decoder must hand such bytes to the scalar path.
+  std::string mixed = hex;
+  mixed[40] = 'z';
+  std::string lenient = absl::HexStringToBytes(mixed);
+  std::string expected = bytes;
+  expected[20] = static_cast<char>(expected[20] & 0x0f);
+  EXPECT_EQ(lenient, expected);
+}
+
 TEST(HexAndBack, HexStringToBytes_and_BytesToHexString) {
   std::string hex_mixed = "0123456789abcdefABCDEF";
   std::string bytes_expected = "\x01\x23\x45\x67\x89\xab\xcd\xef\xAB\xCD\xEF";
@@ -1106,29 +1106,33 @@ template CordRepBtree* CordRepBtree::AddData<kBack>(CordRepBtree* tree,
                                                     absl::string_view data,
                                                     size_t extra);
 
+void CordRepBtree::RebuildAddEdge(CordRepBtree** stack, CordRep* edge) {
+  size_t height = 0;
+  size_t length = edge->length;
+  CordRepBtree* node = stack[0];
+  OpResult result = node->AddEdge<kBack>(true, edge, length);
+  while (result.action == CordRepBtree::kPopped) {
+    stack[height] = result.tree;
+    if (stack[++height] == nullptr) {
+      result.action = CordRepBtree::kSelf;
+      stack[height] = CordRepBtree::New(node, result.tree);
+    } else {
+      node = stack[height];
+      result = node->AddEdge<kBack>(true, result.tree, length);
+    }
+  }
+  while (stack[++height] != nullptr) {
+    stack[height]->length += length;
+  }
+}
+
 void CordRepBtree::Rebuild(CordRepBtree** stack, CordRepBtree* tree,
                            bool consume) {
   bool owned = consume && tree->refcount.IsOne();
   if (tree->height() == 0) {
     for (CordRep* edge : tree->Edges()) {
       if (!owned) edge = CordRep::Ref(edge);
-      size_t height = 0;
-      size_t length = edge->length;
-      CordRepBtree* node = stack[0];
-      OpResult result = node->AddEdge<kBack>(true, edge, length);
-      while (result.action == CordRepBtree::kPopped) {
-        stack[height] = result.tree;
-        if (stack[++height] == nullptr) {
-          result.action = CordRepBtree::kSelf;
-          stack[height] = CordRepBtree::New(node, result.tree);
-        } else {
-          node = stack[height];
-          result = node->AddEdge<kBack>(true, result.tree, length);
-        }
-      }
-      while (stack[++height] != nullptr) {
-        stack[height]->length += length;
-      }
+      RebuildAddEdge(stack, edge);
     }
   } else {
     for (CordRep* rep : tree->Edges()) {
@@ -1163,6 +1167,38 @@ CordRepBtree* CordRepBtree::Rebuild(CordRepBtree* tree) {
   return nullptr;
 }
 
+CordRepBtree* CordRepBtree::Create(absl::Span<CordRep* const> reps) {
+  assert(!reps.empty());
+
+  // Set up initial stack with empty leaf node.
+  CordRepBtree* node = CordRepBtree::New();
+  CordRepBtree* stack[CordRepBtree::kMaxDepth + 1] = {node};
+
+  // Append the data edges of each input in order, consuming all inputs. This
+  // builds the combined tree bottom-up in a single pass: edges are packed
+  // densely into leaves and parent nodes are only created as leaves fill up,
+  // the same way `Rebuild()` rebalances an over-tall tree.
+  for (CordRep* rep : reps) {
+    assert(rep->length > 0);
+    if (rep->IsBtree()) {
+      Rebuild(stack, rep->btree(), /* consume reference */ true);
+    } else {
+      assert(IsDataEdge(rep));
+      RebuildAddEdge(stack, rep);
+    }
+  }
+
+  // Return top most node
+  for (CordRepBtree* parent : stack) {
+    if (parent == nullptr) return node;
+    node = parent;
+  }
+
+  // Unreachable
+  assert(false);
+  return nullptr;
+}
+
 CordRepBtree::ExtractResult CordRepBtree::ExtractAppendBuffer(
     CordRepBtree* tree, size_t extra_capacity) {
   int depth = 0;
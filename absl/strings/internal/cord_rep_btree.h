@@ -169,6 +169,15 @@ class CordRepBtree : public CordRep {
   // tree, and the input is consumed and transformed into a btree().
   static CordRepBtree* Create(CordRep* rep);
 
+  // Creates a fully balanced btree containing the concatenated data edges of
+  // all `reps`, in order. Adopts a ref on each input rep. Each input must be
+  // either a btree or a valid data edge (see IsDataEdge()), with a non-zero
+  // length. The combined tree is built bottom-up in a single pass over all
+  // data edges, which packs leaf nodes fully and avoids the repeated node
+  // copies incurred by appending the inputs one at a time.
+  // Requires `!reps.empty()`.
+  static CordRepBtree* Create(absl::Span<CordRep* const> reps);
+
   // Destroys the provided tree. Should only be called by cord internal API's,
   // typically after a ref_count.Decrement() on the last reference count.
   static void Destroy(CordRepBtree* tree);
@@ -503,6 +512,11 @@ class CordRepBtree : public CordRep {
   // stack[0], and parent nodes above that, or null for 'top of tree'.
   static void Rebuild(CordRepBtree** stack, CordRepBtree* tree, bool consume);
 
+  // Adds the data edge `edge` to the back of the tree being built in `stack`,
+  // creating and popping parent nodes as leaves fill up. Adopts a ref on
+  // `edge`. `stack` is as described for `Rebuild()` above.
+  static void RebuildAddEdge(CordRepBtree** stack, CordRep* edge);
+
   // Aligns existing edges to start at index 0, to allow for a new edge to be
   // added to the back of the current edges.
   inline void AlignBegin();
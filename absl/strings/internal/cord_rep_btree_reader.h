@@ -155,6 +155,13 @@ class CordRepBtreeReader {
   absl::string_view Seek(size_t offset);
 
  private:
+  // The number of data edges following the current position whose headers are
+  // prefetched on sequential navigation. Sequential consumption of a btree is
+  // otherwise bound on the dependent loads navigating from one data edge to
+  // the next; prefetching the upcoming edges while the current chunk is being
+  // consumed hides that latency.
+  static constexpr size_t kPrefetchEdges = 4;
+
   size_t remaining_ = 0;
   CordRepBtreeNavigator navigator_;
 };
@@ -167,6 +174,7 @@ inline size_t CordRepBtreeReader::length() const {
 inline absl::string_view CordRepBtreeReader::Init(CordRepBtree* tree) {
   assert(tree != nullptr);
   const CordRep* edge = navigator_.InitFirst(tree);
+  navigator_.PrefetchNext(kPrefetchEdges);
   remaining_ = tree->length - edge->length;
   return EdgeData(edge);
 }
@@ -175,6 +183,7 @@ inline absl::string_view CordRepBtreeReader::Next() {
   if (remaining_ == 0) return {};
   const CordRep* edge = navigator_.Next();
   assert(edge != nullptr);
+  navigator_.PrefetchNext(kPrefetchEdges);
   remaining_ -= edge->length;
   return EdgeData(edge);
 }
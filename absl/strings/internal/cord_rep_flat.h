@@ -46,6 +46,8 @@ static constexpr size_t kMaxFlatLength = kMaxFlatSize - kFlatOverhead;
 static constexpr size_t kMinFlatLength = kMinFlatSize - kFlatOverhead;
 static constexpr size_t kMaxLargeFlatSize = 256 * 1024;
 static constexpr size_t kMaxLargeFlatLength = kMaxLargeFlatSize - kFlatOverhead;
+static constexpr size_t kMaxHugeFlatSize = 2 * 1024 * 1024;
+static constexpr size_t kMaxHugeFlatLength = kMaxHugeFlatSize - kFlatOverhead;
 
 // kTagBase should make the Size <--> Tag computation resilient
 // against changes to the value of FLAT when we add a new tag..
@@ -53,11 +55,15 @@ static constexpr uint8_t kTagBase = FLAT - 4;
 
 // Converts the provided rounded size to the corresponding tag
 constexpr uint8_t AllocatedSizeToTagUnchecked(size_t size) {
-  return static_cast<uint8_t>(size <= 512 ? kTagBase + size / 8
-                              : size <= 8192
-                                  ? kTagBase + 512 / 8 + size / 64 - 512 / 64
-                                  : kTagBase + 512 / 8 + ((8192 - 512) / 64) +
-                                        size / 4096 - 8192 / 4096);
+  return static_cast<uint8_t>(
+      size <= 512 ? kTagBase + size / 8
+      : size <= 8192
+          ? kTagBase + 512 / 8 + size / 64 - 512 / 64
+      : size <= 262144
+          ? kTagBase + 512 / 8 + ((8192 - 512) / 64) + size / 4096 -
+                8192 / 4096
+          : kTagBase + 512 / 8 + ((8192 - 512) / 64) +
+                ((262144 - 8192) / 4096) + size / 262144 - 262144 / 262144);
 }
 
 // Converts the provided tag to the corresponding allocated size
@@ -65,12 +71,18 @@ constexpr size_t TagToAllocatedSize(uint8_t tag) {
   return (tag <= kTagBase + 512 / 8) ? tag * 8 - kTagBase * 8
          : (tag <= kTagBase + (512 / 8) + ((8192 - 512) / 64))
              ? 512 + tag * 64 - kTagBase * 64 - 512 / 8 * 64
-             : 8192 + tag * 4096 - kTagBase * 4096 -
-                   ((512 / 8) + ((8192 - 512) / 64)) * 4096;
+         : (tag <= kTagBase + (512 / 8) + ((8192 - 512) / 64) +
+                        ((262144 - 8192) / 4096))
+             ? 8192 + tag * 4096 - kTagBase * 4096 -
+                   ((512 / 8) + ((8192 - 512) / 64)) * 4096
+             : 262144 + tag * 262144 - kTagBase * 262144 -
+                   ((512 / 8) + ((8192 - 512) / 64) +
+                    ((262144 - 8192) / 4096)) *
+                       262144;
 }
 
 static_assert(AllocatedSizeToTagUnchecked(kMinFlatSize) == FLAT, "");
-static_assert(AllocatedSizeToTagUnchecked(kMaxLargeFlatSize) == MAX_FLAT_TAG,
+static_assert(AllocatedSizeToTagUnchecked(kMaxHugeFlatSize) == MAX_FLAT_TAG,
               "");
 
 // RoundUp logically performs `((n + m - 1) / m) * m` to round up to the nearest
@@ -82,7 +94,10 @@ constexpr size_t RoundUp(size_t n, size_t m) {
 // Returns the size to the nearest equal or larger value that can be
 // expressed exactly as a tag value.
 inline size_t RoundUpForTag(size_t size) {
-  return RoundUp(size, (size <= 512) ? 8 : (size <= 8192 ? 64 : 4096));
+  return RoundUp(size, (size <= 512)      ? 8
+                       : (size <= 8192)   ? 64
+                       : (size <= 262144) ? 4096
+                                          : 262144);
 }
 
 // Converts the allocated size to a tag, rounding down if the size
@@ -100,14 +115,22 @@ constexpr size_t TagToLength(uint8_t tag) {
   return TagToAllocatedSize(tag) - kFlatOverhead;
 }
 
-// Enforce that kMaxFlatSize maps to a well-known exact tag value.
-static_assert(TagToAllocatedSize(MAX_FLAT_TAG) == kMaxLargeFlatSize,
+// Enforce that the boundary sizes map to well-known exact tag values.
+static_assert(TagToAllocatedSize(MAX_FLAT_TAG) == kMaxHugeFlatSize,
               "Bad tag logic");
+static_assert(
+    TagToAllocatedSize(AllocatedSizeToTagUnchecked(kMaxLargeFlatSize)) ==
+        kMaxLargeFlatSize,
+    "Bad tag logic");
 
 struct CordRepFlat : public CordRep {
   // Tag for explicit 'large flat' allocation
   struct Large {};
 
+  // Tag for explicit 'huge flat' allocation, for bulk data paths that want
+  // to minimize tree depth for multi-GB cords.
+  struct Huge {};
+
   // Creates a new flat node.
   template <size_t max_flat_size, typename... Args>
   static CordRepFlat* NewImpl(size_t len, Args... args ABSL_ATTRIBUTE_UNUSED) {
@@ -139,6 +162,10 @@ struct CordRepFlat : public CordRep {
     return NewImpl<kMaxLargeFlatSize>(len);
   }
 
+  static CordRepFlat* New(Huge, size_t len) {
+    return NewImpl<kMaxHugeFlatSize>(len);
+  }
+
   // Deletes a CordRepFlat instance created previously through a call to New().
   // Flat CordReps are allocated and constructed with raw ::operator new and
   // placement new, and must be destructed and deallocated accordingly.
@@ -14,7 +14,9 @@
 
 #include "absl/strings/internal/memutil.h"
 
+#include <cstdint>
 #include <cstdlib>
+#include <cstring>
 
 #include "absl/strings/ascii.h"
 
@@ -22,17 +24,32 @@ namespace absl {
 ABSL_NAMESPACE_BEGIN
 namespace strings_internal {
 
-int memcasecmp(const char* s1, const char* s2, size_t len) {
-  const unsigned char* us1 = reinterpret_cast<const unsigned char*>(s1);
-  const unsigned char* us2 = reinterpret_cast<const unsigned char*>(s2);
+namespace {
 
+// Converts 'A'-'Z' to 'a'-'z' in each lane of an eight-byte word, leaving all
+// other values (including bytes with the high bit set) unchanged.
+inline uint64_t CaseFoldWord(uint64_t v) {
+  constexpr uint64_t kHighBits = 0x8080808080808080;
+  constexpr uint64_t kOnes = 0x0101010101010101;
+  const uint64_t heptets = v & ~kHighBits;
+  // Per lane, the high bit of `ge_upper_a` is set iff the low seven bits are
+  // >= 'A', and of `gt_upper_z` iff they are > 'Z'.
+  const uint64_t ge_upper_a = heptets + (128 - 'A') * kOnes;
+  const uint64_t gt_upper_z = heptets + (127 - 'Z') * kOnes;
+  const uint64_t is_upper = ge_upper_a & ~gt_upper_z & ~v & kHighBits;
+  return v | (is_upper >> 2);  // 0x80 >> 2 == 0x20, the case bit.
+}
+
+// The byte-at-a-time comparison the eight-byte loop falls back to.
+// NOTE(b/308193381): We do not use `absl::ascii_tolower` here in order
+// to avoid its lookup table and improve performance.
+inline int memcasecmp_slow(const unsigned char* us1, const unsigned char* us2,
+                           size_t len) {
   for (size_t i = 0; i < len; i++) {
     unsigned char c1 = us1[i];
     unsigned char c2 = us2[i];
     // If bytes are the same, they will be the same when converted to lower.
     // So we only need to convert if bytes are not equal.
-    // NOTE(b/308193381): We do not use `absl::ascii_tolower` here in order
-    // to avoid its lookup table and improve performance.
     if (c1 != c2) {
       c1 = c1 >= 'A' && c1 <= 'Z' ? c1 - 'A' + 'a' : c1;
       c2 = c2 >= 'A' && c2 <= 'Z' ? c2 - 'A' + 'a' : c2;
@@ -43,6 +60,31 @@ int memcasecmp(const char* s1, const char* s2, size_t len) {
   return 0;
 }
 
+}  // namespace
+
+int memcasecmp(const char* s1, const char* s2, size_t len) {
+  const unsigned char* us1 = reinterpret_cast<const unsigned char*>(s1);
+  const unsigned char* us2 = reinterpret_cast<const unsigned char*>(s2);
+
+  // Compare eight bytes at a time, case-folding both sides. Equality of the
+  // folded words does not depend on byte order, so the loads need no endian
+  // conversion; the first mismatching word is rescanned bytewise to find the
+  // ordering.
+  while (len >= 8) {
+    uint64_t w1;
+    uint64_t w2;
+    memcpy(&w1, us1, 8);
+    memcpy(&w2, us2, 8);
+    if (CaseFoldWord(w1) != CaseFoldWord(w2)) {
+      return memcasecmp_slow(us1, us2, 8);
+    }
+    us1 += 8;
+    us2 += 8;
+    len -= 8;
+  }
+  return memcasecmp_slow(us1, us2, len);
+}
+
 }  // namespace strings_internal
 ABSL_NAMESPACE_END
 }  // namespace absl
@@ -17,8 +17,10 @@
 #include "absl/strings/internal/memutil.h"
 
 #include <cstdlib>
+#include <string>
 
 #include "gtest/gtest.h"
+#include "absl/strings/ascii.h"
 
 namespace {
 
@@ -38,4 +40,38 @@ TEST(MemUtil, memcasecmp) {
   EXPECT_EQ(absl::strings_internal::memcasecmp(a, "whatever", 0), 0);
 }
 
+TEST(MemUtil, memcasecmpFoldBoundaries) {
+  // The characters bracketing 'A'-'Z' in ASCII must not case-fold: '@' (0x40)
+  // and '[' (0x5B) are distinct from '`' (0x60) and '{' (0x7B).
+  EXPECT_NE(absl::strings_internal::memcasecmp("@", "`", 1), 0);
+  EXPECT_NE(absl::strings_internal::memcasecmp("[", "{", 1), 0);
+  // Bytes with the high bit set only compare equal to themselves, even when
+  // they differ exactly in the 0x20 bit.
+  EXPECT_NE(absl::strings_internal::memcasecmp("\xC1", "\xE1", 1), 0);
+  EXPECT_EQ(absl::strings_internal::memcasecmp("\xC1", "\xC1", 1), 0);
+}
+
+TEST(MemUtil, memcasecmpLong) {
+  // Exercise every alignment of a difference relative to the eight-byte
+  // blocks the implementation compares.
+  std::string lhs = "The Quick Brown Fox Jumps Over The Lazy Dog!";
+  std::string rhs = "tHE qUICK bROWN fOX jUMPS oVER tHE lAZY dOG!";
+  EXPECT_EQ(
+      absl::strings_internal::memcasecmp(lhs.data(), rhs.data(), lhs.size()),
+      0);
+  for (size_t i = 0; i < lhs.size(); ++i) {
+    std::string modified = rhs;
+    modified[i] = '|';  // Folds to neither case of any letter.
+    const int expected = absl::ascii_tolower(lhs[i]) < '|' ? -1 : 1;
+    EXPECT_EQ(absl::strings_internal::memcasecmp(lhs.data(), modified.data(),
+                                                 lhs.size()) < 0,
+              expected < 0)
+        << i;
+    EXPECT_EQ(absl::strings_internal::memcasecmp(modified.data(), lhs.data(),
+                                                 lhs.size()) < 0,
+              expected > 0)
+        << i;
+  }
+}
+
 }  // namespace
@@ -143,6 +143,9 @@ bool ConvertAll(const UntypedFormatSpecImpl format,
   if (format.has_parsed_conversion()) {
     return format.parsed_conversion()->ProcessFormat(
         ConverterConsumer<Converter>(converter, args));
+  } else if (format.has_compiled_format()) {
+    return format.compiled_format()->ProcessFormat(
+        ConverterConsumer<Converter>(converter, args));
   } else {
     return ParseFormatString(format.str(),
                              ConverterConsumer<Converter>(converter, args));
@@ -24,6 +24,7 @@
 #include "absl/container/inlined_vector.h"
 #include "absl/strings/internal/str_format/arg.h"
 #include "absl/strings/internal/str_format/checker.h"
+#include "absl/strings/internal/str_format/compiled_format.h"
 #include "absl/strings/internal/str_format/constexpr_parser.h"
 #include "absl/strings/internal/str_format/extension.h"
 #include "absl/strings/internal/str_format/parser.h"
@@ -57,17 +58,26 @@ class UntypedFormatSpecImpl {
   explicit UntypedFormatSpecImpl(
       const str_format_internal::ParsedFormatBase* pc)
       : data_(pc), size_(~size_t{}) {}
+  explicit UntypedFormatSpecImpl(
+      const str_format_internal::CompiledFormatSpan* cf)
+      : data_(cf), size_(~size_t{} - 1) {}
 
   bool has_parsed_conversion() const { return size_ == ~size_t{}; }
+  bool has_compiled_format() const { return size_ == ~size_t{} - 1; }
 
   string_view str() const {
     assert(!has_parsed_conversion());
+    assert(!has_compiled_format());
     return string_view(static_cast<const char*>(data_), size_);
   }
   const str_format_internal::ParsedFormatBase* parsed_conversion() const {
     assert(has_parsed_conversion());
     return static_cast<const str_format_internal::ParsedFormatBase*>(data_);
   }
+  const str_format_internal::CompiledFormatSpan* compiled_format() const {
+    assert(has_compiled_format());
+    return static_cast<const str_format_internal::CompiledFormatSpan*>(data_);
+  }
 
   template <typename T>
   static const UntypedFormatSpecImpl& Extract(const T& s) {
@@ -175,6 +185,13 @@ class FormatSpecTemplate
     CheckArity<sizeof...(C), sizeof...(Args)>();
     CheckMatches<C...>(absl::make_index_sequence<sizeof...(C)>{});
   }
+
+  template <FormatConversionCharSet... C>
+  FormatSpecTemplate(const ExtendedCompiledFormat<C...>& cf)  // NOLINT
+      : Base(&cf.span()) {
+    CheckArity<sizeof...(C), sizeof...(Args)>();
+    CheckMatches<C...>(absl::make_index_sequence<sizeof...(C)>{});
+  }
 };
 
 class Streamable {
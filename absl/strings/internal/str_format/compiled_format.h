@@ -0,0 +1,229 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef ABSL_STRINGS_INTERNAL_STR_FORMAT_COMPILED_FORMAT_H_
+#define ABSL_STRINGS_INTERNAL_STR_FORMAT_COMPILED_FORMAT_H_
+
+#include <stddef.h>
+
+#include <initializer_list>
+
+#include "absl/base/config.h"
+#include "absl/base/const_init.h"
+#include "absl/strings/internal/str_format/checker.h"
+#include "absl/strings/internal/str_format/constexpr_parser.h"
+#include "absl/strings/internal/str_format/extension.h"
+#include "absl/strings/internal/str_format/parser.h"
+#include "absl/strings/string_view.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+namespace str_format_internal {
+
+// A single element of a compiled format: either a run of literal text or one
+// conversion. This mirrors ParsedFormatBase::ConversionItem, except that the
+// text lives in a fixed-size in-object buffer instead of a heap allocation so
+// that the whole structure can be built in a constant expression.
+struct CompiledFormatItem {
+  bool is_conversion = false;
+  // Points to the past-the-end location of this element in the text buffer.
+  size_t text_end = 0;
+  UnboundConversion conv = UnboundConversion(absl::kConstInit);
+};
+
+// A type-erased, trivially-destructible view of a compiled format. The
+// formatting machinery consumes this instead of the ExtendedCompiledFormat
+// template so that bind.cc does not need to know the format's conversion
+// characters. The pointed-to data must outlive the view; for compiled formats
+// with static storage duration this holds trivially.
+struct CompiledFormatSpan {
+  const char* text = nullptr;
+  const CompiledFormatItem* items = nullptr;
+  size_t num_items = 0;
+  bool has_error = false;
+
+  // Replays the pre-parsed items into `consumer`, using the same protocol as
+  // ParseFormatString and ParsedFormatBase::ProcessFormat: text runs are
+  // passed to Consumer::Append(string_view) and conversions to
+  // Consumer::ConvertOne(UnboundConversion, string_view), where the
+  // string_view holds the conversion spec without the leading '%'.
+  template <typename Consumer>
+  bool ProcessFormat(Consumer consumer) const {
+    const char* const base = text;
+    string_view run(base, 0);
+    for (size_t i = 0; i < num_items; ++i) {
+      const CompiledFormatItem& item = items[i];
+      const char* const end = run.data() + run.size();
+      run = string_view(end, static_cast<size_t>((base + item.text_end) - end));
+      if (item.is_conversion) {
+        if (!consumer.ConvertOne(item.conv, run)) return false;
+      } else {
+        if (!consumer.Append(run)) return false;
+      }
+    }
+    return !has_error;
+  }
+};
+
+// A preparsed format whose parsing and validation happen in a constant
+// expression, so that formatting with it performs no parsing at all at
+// runtime. It is the constexpr counterpart of ExtendedParsedFormat: the
+// user specifies the conversions through the template arguments and the
+// format string is checked against them at compile time (or recorded in
+// has_error() where the compile-time checker is unavailable).
+//
+// Unlike ExtendedParsedFormat, the parsed representation is stored inline in
+// fixed-size arrays, so instances are best declared `static constexpr`; the
+// format string may be at most kMaxTextSize characters long.
+template <FormatConversionCharSet... C>
+class ExtendedCompiledFormat {
+ public:
+  // Maximum supported format string length, not counting the terminating NUL.
+  static constexpr size_t kMaxTextSize = 256;
+  // Upper bound on text runs plus conversions. Every conversion and every
+  // "%%" consumes at least two format characters, and text runs are maximal,
+  // so a format of kMaxTextSize characters can never exceed this.
+  static constexpr size_t kMaxItems = kMaxTextSize / 2 + 1;
+
+  template <size_t N>
+  explicit constexpr ExtendedCompiledFormat(const char (&format)[N])
+#ifdef ABSL_INTERNAL_ENABLE_FORMAT_CHECKER
+      __attribute__((
+          enable_if(str_format_internal::EnsureConstexpr(format),
+                    "Format string is not constexpr."),
+          enable_if(str_format_internal::ValidFormatImpl<C...>(format),
+                    "Format specified does not match the template arguments.")))
+#endif  // ABSL_INTERNAL_ENABLE_FORMAT_CHECKER
+      : text_{}, items_{}, num_items_(0), has_error_(false), span_() {
+    static_assert(N - 1 <= kMaxTextSize,
+                  "Format string is too long to be compiled; use "
+                  "ExtendedParsedFormat instead.");
+    Parse(format, format + N - 1);
+    has_error_ = has_error_ || !MatchesConversions();
+    span_ = CompiledFormatSpan{text_, items_, num_items_, has_error_};
+  }
+
+  // Copies must re-point the type-erased view at their own arrays.
+  constexpr ExtendedCompiledFormat(const ExtendedCompiledFormat& other)
+      : text_{}, items_{}, num_items_(other.num_items_),
+        has_error_(other.has_error_), span_() {
+    for (size_t i = 0; i < kMaxTextSize; ++i) text_[i] = other.text_[i];
+    for (size_t i = 0; i < num_items_; ++i) items_[i] = other.items_[i];
+    span_ = CompiledFormatSpan{text_, items_, num_items_, has_error_};
+  }
+
+  constexpr ExtendedCompiledFormat& operator=(
+      const ExtendedCompiledFormat& other) {
+    if (this == &other) return *this;
+    for (size_t i = 0; i < kMaxTextSize; ++i) text_[i] = other.text_[i];
+    for (size_t i = 0; i < other.num_items_; ++i) items_[i] = other.items_[i];
+    num_items_ = other.num_items_;
+    has_error_ = other.has_error_;
+    span_ = CompiledFormatSpan{text_, items_, num_items_, has_error_};
+    return *this;
+  }
+
+  constexpr bool has_error() const { return has_error_; }
+
+  // The view handed to the formatting machinery. Valid as long as this
+  // object is alive.
+  constexpr const CompiledFormatSpan& span() const { return span_; }
+
+ private:
+  constexpr void Parse(const char* p, const char* const end) {
+    int next_arg = 0;
+    size_t text_pos = 0;
+    while (p != end) {
+      const char* percent = p;
+      while (percent != end && *percent != '%') ++percent;
+      if (percent != p) {
+        for (const char* q = p; q != percent; ++q) text_[text_pos++] = *q;
+        if (!AddItem(false, text_pos)) return;
+      }
+      if (percent == end) return;
+      if (percent + 1 == end) {
+        has_error_ = true;
+        return;
+      }
+      if (percent[1] == '%') {
+        text_[text_pos++] = '%';
+        if (!AddItem(false, text_pos)) return;
+        p = percent + 2;
+        continue;
+      }
+      UnboundConversion conv(absl::kConstInit);
+      p = ConsumeUnboundConversion(percent + 1, end, &conv, &next_arg);
+      if (p == nullptr) {
+        has_error_ = true;
+        return;
+      }
+      for (const char* q = percent + 1; q != p; ++q) text_[text_pos++] = *q;
+      if (!AddItem(true, text_pos)) return;
+      items_[num_items_ - 1].conv = conv;
+    }
+  }
+
+  constexpr bool AddItem(bool is_conversion, size_t text_end) {
+    if (num_items_ == kMaxItems) {
+      has_error_ = true;
+      return false;
+    }
+    items_[num_items_].is_conversion = is_conversion;
+    items_[num_items_].text_end = text_end;
+    ++num_items_;
+    return true;
+  }
+
+  // Constexpr equivalent of ParsedFormatBase::MatchesConversions with
+  // allow_ignored == false: every conversion (including '*' width and
+  // precision arguments) must match the specified conversion sets, and every
+  // specified argument must be consumed by the format.
+  constexpr bool MatchesConversions() const {
+    constexpr FormatConversionCharSet
+        kConvs[(sizeof...(C) > 0 ? sizeof...(C) : 1)] = {C...};
+    constexpr int kNumArgs = sizeof...(C);
+    bool used[(sizeof...(C) > 0 ? sizeof...(C) : 1)]{};
+    for (size_t i = 0; i < num_items_; ++i) {
+      if (!items_[i].is_conversion) continue;
+      const UnboundConversion& conv = items_[i].conv;
+      if (conv.arg_position <= 0 || conv.arg_position > kNumArgs) return false;
+      if (!Contains(kConvs[conv.arg_position - 1], conv.conv)) return false;
+      used[conv.arg_position - 1] = true;
+      for (const UnboundConversion::InputValue extra :
+           {conv.width, conv.precision}) {
+        if (!extra.is_from_arg()) continue;
+        const int pos = extra.get_from_arg();
+        if (pos <= 0 || pos > kNumArgs) return false;
+        if (!Contains(kConvs[pos - 1], '*')) return false;
+        used[pos - 1] = true;
+      }
+    }
+    for (int i = 0; i < kNumArgs; ++i) {
+      if (!used[i]) return false;
+    }
+    return true;
+  }
+
+  char text_[kMaxTextSize];
+  CompiledFormatItem items_[kMaxItems];
+  size_t num_items_;
+  bool has_error_;
+  CompiledFormatSpan span_;
+};
+
+}  // namespace str_format_internal
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_STRINGS_INTERNAL_STR_FORMAT_COMPILED_FORMAT_H_
@@ -46,6 +46,7 @@
 #include "absl/base/internal/raw_logging.h"
 #include "absl/strings/internal/ostringstream.h"
 #include "absl/strings/internal/resize_uninitialized.h"
+#include "absl/strings/numbers.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/string_view.h"
 
@@ -269,6 +270,110 @@ std::string JoinAlgorithm(Iterator start, Iterator end, absl::string_view s,
   return result;
 }
 
+// An overload of JoinAlgorithm() above for a forward iterator range of char
+// pointers, which would otherwise take the generic AlphaNum path and grow the
+// result incrementally. The range is traversed twice, measuring each pointer
+// with strlen() in the sizing pass; null pointers contribute nothing, matching
+// AlphaNum's treatment of null c-strings.
+template <typename Iterator,
+          typename = typename std::enable_if<
+              std::is_convertible<
+                  typename std::iterator_traits<Iterator>::iterator_category,
+                  std::forward_iterator_tag>::value &&
+              std::is_pointer<
+                  typename std::iterator_traits<Iterator>::value_type>::value &&
+              std::is_same<typename std::remove_cv<typename std::remove_pointer<
+                               typename std::iterator_traits<
+                                   Iterator>::value_type>::type>::type,
+                           char>::value>::type>
+std::string JoinAlgorithm(Iterator start, Iterator end, absl::string_view s,
+                          AlphaNumFormatterImpl) {
+  const auto length = [](const char* value) -> uint64_t {
+    return value == nullptr ? 0 : strlen(value);
+  };
+  std::string result;
+  if (start != end) {
+    // Sums size. Use uint64_t to prevent size_t overflow; see the string-like
+    // overload above.
+    uint64_t result_size = length(*start);
+    for (Iterator it = start; ++it != end;) {
+      result_size += s.size();
+      result_size += length(*it);
+    }
+
+    if (result_size > 0) {
+      constexpr uint64_t kMaxSize =
+          uint64_t{(std::numeric_limits<size_t>::max)()};
+      ABSL_INTERNAL_CHECK(result_size <= kMaxSize, "size_t overflow");
+      STLStringResizeUninitialized(&result, static_cast<size_t>(result_size));
+
+      // Joins strings
+      char* result_buf = &*result.begin();
+
+      size_t value_size = length(*start);
+      if (value_size > 0) memcpy(result_buf, *start, value_size);
+      result_buf += value_size;
+      for (Iterator it = start; ++it != end;) {
+        memcpy(result_buf, s.data(), s.size());
+        result_buf += s.size();
+        value_size = length(*it);
+        if (value_size > 0) memcpy(result_buf, *it, value_size);
+        result_buf += value_size;
+      }
+    }
+  }
+
+  return result;
+}
+
+// An overload of JoinAlgorithm() above for a forward iterator range of
+// integers, which would otherwise format each element through AlphaNum and
+// grow the result incrementally. The output is presized from a worst-case
+// digit-count estimate, each value is written directly into the result with
+// FastIntToBuffer (which emits two digits at a time), and the string is
+// trimmed to the written length at the end.
+template <typename Iterator,
+          typename ValueType =
+              typename std::iterator_traits<Iterator>::value_type,
+          typename std::enable_if<
+              std::is_convertible<
+                  typename std::iterator_traits<Iterator>::iterator_category,
+                  std::forward_iterator_tag>::value &&
+                  std::is_integral<ValueType>::value &&
+                  !std::is_same<ValueType, bool>::value &&
+                  (sizeof(ValueType) > 1),
+              int>::type = 0>
+std::string JoinAlgorithm(Iterator start, Iterator end, absl::string_view s,
+                          AlphaNumFormatterImpl) {
+  std::string result;
+  if (start == end) return result;
+
+  uint64_t num_elements = 0;
+  for (Iterator it = start; it != end; ++it) ++num_elements;
+
+  // Presizes for the worst case of every element needing the maximum number
+  // of digits (plus a sign for signed types). Use uint64_t to prevent size_t
+  // overflow; see the string-like overload above.
+  constexpr uint64_t kMaxDigits = std::numeric_limits<ValueType>::digits10 +
+                                  1 + (std::is_signed<ValueType>::value ? 1 : 0);
+  const uint64_t estimated_size =
+      num_elements * kMaxDigits + (num_elements - 1) * s.size();
+  constexpr uint64_t kMaxSize = uint64_t{(std::numeric_limits<size_t>::max)()};
+  ABSL_INTERNAL_CHECK(estimated_size <= kMaxSize, "size_t overflow");
+  STLStringResizeUninitialized(&result, static_cast<size_t>(estimated_size));
+
+  // Joins numbers
+  char* result_buf = &*result.begin();
+  result_buf = numbers_internal::FastIntToBuffer(*start, result_buf);
+  for (Iterator it = start; ++it != end;) {
+    memcpy(result_buf, s.data(), s.size());
+    result_buf += s.size();
+    result_buf = numbers_internal::FastIntToBuffer(*it, result_buf);
+  }
+  result.erase(static_cast<size_t>(result_buf - &*result.begin()));
+  return result;
+}
+
 // JoinTupleLoop implements a loop over the elements of a std::tuple, which
 // are heterogeneous. The primary template matches the tuple interior case. It
 // continues the iteration after appending a separator (for nonzero indices)
@@ -42,6 +42,7 @@
 #include "absl/base/port.h"
 #include "absl/meta/type_traits.h"
 #include "absl/strings/string_view.h"
+#include "absl/types/span.h"
 
 #ifdef _GLIBCXX_DEBUG
 #include "absl/strings/internal/stl_type_traits.h"
@@ -163,6 +164,31 @@ class SplitIterator {
   typename Splitter::PredicateType predicate_;
 };
 
+// Splits `text` with `delimiter`, writing each piece accepted by `predicate`
+// into `out` in order and returning the number of pieces written. Splitting
+// stops as soon as `out` is full. This follows the same algorithm as
+// SplitIterator::operator++() above, including the legacy special treatment
+// of a `text` whose .data() is null (see the SplitIterator constructor), but
+// performs no allocation.
+template <typename Delimiter, typename Predicate>
+size_t SplitInto(absl::string_view text, const Delimiter& delimiter,
+                 const Predicate& predicate,
+                 absl::Span<absl::string_view> out) {
+  if (text.data() == nullptr) return 0;
+  size_t count = 0;
+  size_t pos = 0;
+  bool last = false;
+  while (count < out.size() && !last) {
+    const absl::string_view d = delimiter.Find(text, pos);
+    if (d.data() == text.data() + text.size()) last = true;
+    const absl::string_view piece =
+        text.substr(pos, static_cast<size_t>(d.data() - (text.data() + pos)));
+    pos += piece.size() + d.size();
+    if (predicate(piece)) out[count++] = piece;
+  }
+  return count;
+}
+
 // HasMappedType<T>::value is true iff there exists a type T::mapped_type.
 template <typename T, typename = void>
 struct HasMappedType : std::false_type {};
@@ -25,6 +25,15 @@
 #include "absl/strings/internal/memutil.h"
 #include "absl/strings/string_view.h"
 
+#ifdef __SSE2__
+#define ABSL_INTERNAL_MATCH_HAVE_SSE2 1
+#include <emmintrin.h>
+#endif
+#ifdef __AVX2__
+#define ABSL_INTERNAL_MATCH_HAVE_AVX2 1
+#include <immintrin.h>
+#endif
+
 namespace absl {
 ABSL_NAMESPACE_BEGIN
 
@@ -38,11 +47,30 @@ bool EqualsIgnoreCase(absl::string_view piece1,
 
 bool StrContainsIgnoreCase(absl::string_view haystack,
                            absl::string_view needle) noexcept {
-  while (haystack.size() >= needle.size()) {
-    if (StartsWithIgnoreCase(haystack, needle)) return true;
-    haystack.remove_prefix(1);
+  if (needle.empty()) return true;
+  if (needle.size() > haystack.size()) return false;
+  // Scan for positions whose byte case-folds equal to the needle's first
+  // character, and only run the full comparison there. This skips the
+  // non-candidate positions at find()/find_first_of() speed instead of
+  // starting a comparison at every offset.
+  const char lower_first =
+      absl::ascii_tolower(static_cast<unsigned char>(needle[0]));
+  const char upper_first =
+      absl::ascii_toupper(static_cast<unsigned char>(needle[0]));
+  const char both_first[3] = {lower_first, upper_first, '\0'};
+  const size_t last_pos = haystack.size() - needle.size();
+  size_t pos = 0;
+  while (true) {
+    const size_t found = lower_first == upper_first
+                             ? haystack.find(lower_first, pos)
+                             : haystack.find_first_of(both_first, pos);
+    if (found == absl::string_view::npos || found > last_pos) return false;
+    if (absl::strings_internal::memcasecmp(haystack.data() + found,
+                                           needle.data(), needle.size()) == 0) {
+      return true;
+    }
+    pos = found + 1;
   }
-  return false;
 }
 
 bool StrContainsIgnoreCase(absl::string_view haystack,
@@ -92,7 +120,41 @@ absl::string_view FindLongestCommonPrefix(absl::string_view a,
     return absl::string_view(pa, count);
   }
 
-  do {
+  // Wide-register flavors of the 64-bit SWAR loop below: compare a full
+  // vector at a time and locate the first differing byte with a
+  // count-trailing-zeros on the inverted equality mask.
+#ifdef ABSL_INTERNAL_MATCH_HAVE_AVX2
+  while (count + 32 <= limit) {
+    const __m256i va =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pa + count));
+    const __m256i vb =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pb + count));
+    const uint32_t ne = ~static_cast<uint32_t>(
+        _mm256_movemask_epi8(_mm256_cmpeq_epi8(va, vb)));
+    if (ABSL_PREDICT_FALSE(ne != 0)) {
+      count += static_cast<absl::string_view::size_type>(absl::countr_zero(ne));
+      return absl::string_view(pa, count);
+    }
+    count += 32;
+  }
+#endif
+#ifdef ABSL_INTERNAL_MATCH_HAVE_SSE2
+  while (count + 16 <= limit) {
+    const __m128i va =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(pa + count));
+    const __m128i vb =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(pb + count));
+    const uint32_t ne =
+        0xffffu ^ static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(va, vb)));
+    if (ABSL_PREDICT_FALSE(ne != 0)) {
+      count += static_cast<absl::string_view::size_type>(absl::countr_zero(ne));
+      return absl::string_view(pa, count);
+    }
+    count += 16;
+  }
+#endif
+
+  while (count + 8 <= limit) {
     uint64_t xor_bytes = absl::little_endian::Load64(pa + count) ^
                          absl::little_endian::Load64(pb + count);
     if (ABSL_PREDICT_FALSE(xor_bytes != 0)) {
@@ -100,16 +162,21 @@ absl::string_view FindLongestCommonPrefix(absl::string_view a,
       return absl::string_view(pa, count);
     }
     count += 8;
-  } while (ABSL_PREDICT_TRUE(count + 8 < limit));
+  }
 
-  count = limit - 8;
-  uint64_t xor_bytes = absl::little_endian::Load64(pa + count) ^
-                       absl::little_endian::Load64(pb + count);
-  if (ABSL_PREDICT_TRUE(xor_bytes != 0)) {
-    count += static_cast<uint64_t>(absl::countr_zero(xor_bytes) >> 3);
-    return absl::string_view(pa, count);
+  if (count < limit) {
+    // Fewer than 8 bytes remain; re-compare the final 8 bytes with an
+    // overlapping load. Bytes before `count` are already known equal, so
+    // any difference found lies at or past `count`.
+    const absl::string_view::size_type offset = limit - 8;
+    const uint64_t xor_bytes = absl::little_endian::Load64(pa + offset) ^
+                               absl::little_endian::Load64(pb + offset);
+    count = xor_bytes == 0
+                ? limit
+                : offset +
+                      static_cast<uint64_t>(absl::countr_zero(xor_bytes) >> 3);
   }
-  return absl::string_view(pa, limit);
+  return absl::string_view(pa, count);
 }
 
 absl::string_view FindLongestCommonSuffix(absl::string_view a,
@@ -117,16 +184,78 @@ absl::string_view FindLongestCommonSuffix(absl::string_view a,
   const absl::string_view::size_type limit = std::min(a.size(), b.size());
   if (limit == 0) return absl::string_view();
 
-  const char* pa = a.data() + a.size() - 1;
-  const char* pb = b.data() + b.size() - 1;
+  const char* const ea = a.data() + a.size();  // one past the last byte
+  const char* const eb = b.data() + b.size();
   absl::string_view::size_type count = (unsigned) 0;
-  while (count < limit && *pa == *pb) {
-    --pa;
-    --pb;
-    ++count;
+
+  if (ABSL_PREDICT_FALSE(limit < 8)) {
+    const char* pa = ea - 1;
+    const char* pb = eb - 1;
+    while (count < limit && *pa == *pb) {
+      --pa;
+      --pb;
+      ++count;
+    }
+    return absl::string_view(ea - count, count);
+  }
+
+  // Mirror images of the prefix loops above: blocks are taken from the tail
+  // inward, and the first differing byte is located from the high end of the
+  // block (a count-leading-zeros), since the byte nearest the already-matched
+  // suffix lands in the most significant position.
+#ifdef ABSL_INTERNAL_MATCH_HAVE_AVX2
+  while (count + 32 <= limit) {
+    const __m256i va = _mm256_loadu_si256(
+        reinterpret_cast<const __m256i*>(ea - count - 32));
+    const __m256i vb = _mm256_loadu_si256(
+        reinterpret_cast<const __m256i*>(eb - count - 32));
+    const uint32_t ne = ~static_cast<uint32_t>(
+        _mm256_movemask_epi8(_mm256_cmpeq_epi8(va, vb)));
+    if (ABSL_PREDICT_FALSE(ne != 0)) {
+      count += static_cast<absl::string_view::size_type>(absl::countl_zero(ne));
+      return absl::string_view(ea - count, count);
+    }
+    count += 32;
+  }
+#endif
+#ifdef ABSL_INTERNAL_MATCH_HAVE_SSE2
+  while (count + 16 <= limit) {
+    const __m128i va =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(ea - count - 16));
+    const __m128i vb =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(eb - count - 16));
+    const uint32_t ne =
+        0xffffu ^ static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(va, vb)));
+    if (ABSL_PREDICT_FALSE(ne != 0)) {
+      count += static_cast<absl::string_view::size_type>(
+          absl::countl_zero(ne << 16));
+      return absl::string_view(ea - count, count);
+    }
+    count += 16;
   }
+#endif
 
-  return absl::string_view(++pa, count);
+  while (count + 8 <= limit) {
+    uint64_t xor_bytes = absl::little_endian::Load64(ea - count - 8) ^
+                         absl::little_endian::Load64(eb - count - 8);
+    if (ABSL_PREDICT_FALSE(xor_bytes != 0)) {
+      count += static_cast<uint64_t>(absl::countl_zero(xor_bytes) >> 3);
+      return absl::string_view(ea - count, count);
+    }
+    count += 8;
+  }
+
+  if (count < limit) {
+    // Fewer than 8 bytes remain; re-compare the first 8 bytes of the common
+    // window with an overlapping load, as in the prefix case.
+    const uint64_t xor_bytes = absl::little_endian::Load64(ea - limit) ^
+                               absl::little_endian::Load64(eb - limit);
+    count = xor_bytes == 0
+                ? limit
+                : (limit - 8) +
+                      static_cast<uint64_t>(absl::countl_zero(xor_bytes) >> 3);
+  }
+  return absl::string_view(ea - count, count);
 }
 
 ABSL_NAMESPACE_END
@@ -139,6 +139,17 @@ TEST(MatchTest, ContainsIgnoreCase) {
   EXPECT_TRUE(absl::StrContainsIgnoreCase("", ""));
   EXPECT_TRUE(absl::StrContainsIgnoreCase("abc", ""));
   EXPECT_FALSE(absl::StrContainsIgnoreCase("", "a"));
+
+  // Candidate first characters that turn out to be partial matches must not
+  // end the search.
+  EXPECT_TRUE(absl::StrContainsIgnoreCase("aaAB", "Aab"));
+  EXPECT_TRUE(absl::StrContainsIgnoreCase("ababaBC", "AbC"));
+  EXPECT_FALSE(absl::StrContainsIgnoreCase("ababab", "aBc"));
+  // A match can not extend past the end of the haystack.
+  EXPECT_FALSE(absl::StrContainsIgnoreCase("xyzAB", "aBc"));
+  // Needles starting with a caseless character.
+  EXPECT_TRUE(absl::StrContainsIgnoreCase("one 2 THREE", "2 three"));
+  EXPECT_FALSE(absl::StrContainsIgnoreCase("one 2 THREE", "2 four"));
 }
 
 TEST(MatchTest, ContainsCharIgnoreCase) {
@@ -288,4 +299,34 @@ TEST(MatchTest, FindLongestCommonSuffix) {
             "cde");
 }
 
+TEST(MatchTest, FindLongestCommonPrefixWideBlockBoundaries) {
+  // Mismatches at and around the internal 8/16/32-byte block boundaries.
+  const std::string x1(200, 'x');
+  for (size_t pos : {size_t{0}, size_t{7}, size_t{8}, size_t{15}, size_t{16},
+                     size_t{17}, size_t{31}, size_t{32}, size_t{33}, size_t{63},
+                     size_t{64}, size_t{100}, size_t{199}}) {
+    std::string x2 = x1;
+    x2[pos] = '#';
+    EXPECT_EQ(absl::FindLongestCommonPrefix(x1, x2), x1.substr(0, pos));
+    EXPECT_EQ(absl::FindLongestCommonPrefix(x2, x1), x1.substr(0, pos));
+  }
+}
+
+TEST(MatchTest, FindLongestCommonSuffixWideBlockBoundaries) {
+  const std::string x1(200, 'x');
+  EXPECT_EQ(absl::FindLongestCommonSuffix(x1, x1), x1);
+  // A mismatch `pos` bytes from the end leaves a common suffix of `pos`.
+  for (size_t pos : {size_t{0}, size_t{7}, size_t{8}, size_t{15}, size_t{16},
+                     size_t{17}, size_t{31}, size_t{32}, size_t{33}, size_t{63},
+                     size_t{64}, size_t{100}, size_t{199}}) {
+    std::string x2 = x1;
+    x2[x2.size() - 1 - pos] = '#';
+    EXPECT_EQ(absl::FindLongestCommonSuffix(x1, x2), x1.substr(x1.size() - pos));
+    EXPECT_EQ(absl::FindLongestCommonSuffix(x2, x1), x1.substr(x1.size() - pos));
+  }
+  // Inputs of different lengths, fully matching over the shorter one.
+  EXPECT_EQ(absl::FindLongestCommonSuffix(x1, absl::string_view(x1).substr(50)),
+            absl::string_view(x1).substr(50));
+}
+
 }  // namespace
@@ -281,6 +281,48 @@ inline ABSL_ATTRIBUTE_ALWAYS_INLINE char* EncodeFullU64(uint64_t i,
   return buffer + sizeof(mod_result);
 }
 
+constexpr uint64_t kTenPow19 = 1000'0000'0000'0000'0000ull;
+
+// Writes `n`, which must be less than 10**19, as exactly nineteen digits with
+// leading zeros.
+inline char* EncodeNineteenDigits(uint64_t n, absl::Nonnull<char*> out_str) {
+  ABSL_ASSUME(n < kTenPow19);
+  const uint32_t top3 = static_cast<uint32_t>(n / 1'0000'0000'0000'0000ull);
+  const uint64_t bottom16 = n % 1'0000'0000'0000'0000ull;
+  *out_str++ = static_cast<char>('0' + top3 / 100);
+  numbers_internal::PutTwoDigits(top3 % 100, out_str);
+  out_str += 2;
+  little_endian::Store64(
+      out_str, PrepareEightDigits(static_cast<uint32_t>(
+                   bottom16 / 100'000'000ull)) + kEightZeroBytes);
+  out_str += 8;
+  little_endian::Store64(
+      out_str, PrepareEightDigits(static_cast<uint32_t>(
+                   bottom16 % 100'000'000ull)) + kEightZeroBytes);
+  return out_str + 8;
+}
+
+inline char* EncodeFullU128(uint128 i, absl::Nonnull<char*> buffer) {
+  if (Uint128High64(i) == 0) {
+    return EncodeFullU64(Uint128Low64(i), buffer);
+  }
+  // Split off the bottom nineteen digits; the divisions are multiply-shift
+  // sequences against a precomputed reciprocal of 10**19.
+  static const uint128_divisor kTenPow19Divisor(kTenPow19);
+  const uint128 high = i / kTenPow19Divisor;
+  const uint64_t low19 = Uint128Low64(i - high * kTenPow19);
+  if (Uint128High64(high) == 0) {
+    buffer = EncodeFullU64(Uint128Low64(high), buffer);
+  } else {
+    // At most one more leading digit: Uint128Max() has 39 digits.
+    const uint128 top = high / kTenPow19Divisor;
+    const uint64_t mid19 = Uint128Low64(high - top * kTenPow19);
+    buffer = EncodeFullU32(static_cast<uint32_t>(Uint128Low64(top)), buffer);
+    buffer = EncodeNineteenDigits(mid19, buffer);
+  }
+  return EncodeNineteenDigits(low19, buffer);
+}
+
 }  // namespace
 
 void numbers_internal::PutTwoDigits(uint32_t i, absl::Nonnull<char*> buf) {
@@ -336,6 +378,26 @@ absl::Nonnull<char*> numbers_internal::FastIntToBuffer(
   return buffer;
 }
 
+absl::Nonnull<char*> numbers_internal::FastIntToBuffer(
+    uint128 i, absl::Nonnull<char*> buffer) {
+  buffer = EncodeFullU128(i, buffer);
+  *buffer = '\0';
+  return buffer;
+}
+
+absl::Nonnull<char*> numbers_internal::FastIntToBuffer(
+    int128 i, absl::Nonnull<char*> buffer) {
+  uint128 u = static_cast<uint128>(i);
+  if (i < 0) {
+    *buffer++ = '-';
+    // Negate in modular arithmetic; this is well-defined for Int128Min().
+    u = 0 - u;
+  }
+  buffer = EncodeFullU128(u, buffer);
+  *buffer = '\0';
+  return buffer;
+}
+
 // Given a 128-bit number expressed as a pair of uint64_t, high half first,
 // return that number multiplied by the given 32-bit value.  If the result is
 // too large to fit in a 128-bit number, divide it by 2 until it fits.
@@ -1141,5 +1203,186 @@ bool safe_strtou128_base(absl::string_view text, absl::Nonnull<uint128*> value,
 }
 
 }  // namespace numbers_internal
+
+namespace {
+
+// Returns true if all eight bytes of `chunk` are ASCII digits ('0'..'9'):
+// every byte must have high nibble 3 and a low nibble that does not carry
+// into the high nibble when 6 is added.
+inline bool AreEightDigits(uint64_t chunk) {
+  const uint64_t high_nibbles = chunk & 0xF0F0F0F0F0F0F0F0u;
+  const uint64_t low_carries =
+      (chunk + 0x0606060606060606u) & 0xF0F0F0F0F0F0F0F0u;
+  return (high_nibbles | (low_carries >> 4)) == 0x3333333333333333u;
+}
+
+// Converts eight ASCII digits, least significant digit in the low byte as
+// produced by little_endian::Load64, to their numeric value. Each step
+// combines adjacent groups with a single multiply-shift.
+inline uint32_t EightDigitsToUint32(uint64_t chunk) {
+  chunk = (chunk & 0x0F0F0F0F0F0F0F0Fu) * 2561u >> 8;
+  chunk = (chunk & 0x00FF00FF00FF00FFu) * 6553601u >> 16;
+  return static_cast<uint32_t>((chunk & 0x0000FFFF0000FFFFu) *
+                               42949672960001u >>
+                               32);
+}
+
+}  // namespace
+
+size_t ParseInts(absl::string_view text, char delim, absl::Span<int64_t> out) {
+  const char* p = text.data();
+  const char* const end = p + text.size();
+  size_t count = 0;
+  while (count < out.size() && p != end) {
+    bool negative = false;
+    if (*p == '+' || *p == '-') {
+      negative = (*p == '-');
+      ++p;
+    }
+    const char* const field_begin = p;
+    // Skip leading zeros so the digit count below reflects the magnitude.
+    while (p != end && *p == '0') ++p;
+    const char* const digits_begin = p;
+    uint64_t value = 0;
+    // Consume eight validated digits at a time while the total stays within
+    // the 19 digits an int64_t can hold, so `value` cannot wrap here.
+    while (end - p >= 8 && p - digits_begin <= 11) {
+      const uint64_t chunk = little_endian::Load64(p);
+      if (!AreEightDigits(chunk)) break;
+      value = value * 100000000 + EightDigitsToUint32(chunk);
+      p += 8;
+    }
+    while (p != end && '0' <= *p && *p <= '9') {
+      value = value * 10 + static_cast<uint64_t>(*p - '0');
+      ++p;
+    }
+    if (p == field_begin) break;  // A field with no digits is malformed.
+    if (p != end && *p != delim) break;
+    const size_t num_digits = static_cast<size_t>(p - digits_begin);
+    const uint64_t limit =
+        negative ? uint64_t{1} << 63 : (uint64_t{1} << 63) - 1;
+    if (num_digits > 19 || value > limit) break;  // Out of int64_t range.
+    out[count++] = negative ? (value == limit
+                                   ? std::numeric_limits<int64_t>::min()
+                                   : -static_cast<int64_t>(value))
+                            : static_cast<int64_t>(value);
+    if (p != end) ++p;  // Skip the delimiter.
+  }
+  return count;
+}
+
+namespace {
+
+// Powers of ten that are exactly representable as a double. Scaling an
+// exactly representable mantissa by one of these is a single correctly
+// rounded operation.
+constexpr double kExactPowersOfTen[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+// Appends up to `limit` ASCII digits from [p, end) to the value accumulated
+// in `*mantissa`, eight validated digits at a time, then one at a time.
+// Returns the new parse position. `limit` must be small enough that
+// `*mantissa` cannot wrap (19 digits total for a uint64_t).
+inline const char* ConsumeDigits(const char* p, const char* end,
+                                 ptrdiff_t limit,
+                                 absl::Nonnull<uint64_t*> mantissa) {
+  const char* const begin = p;
+  while (end - p >= 8 && limit - (p - begin) >= 8) {
+    const uint64_t chunk = little_endian::Load64(p);
+    if (!AreEightDigits(chunk)) break;
+    *mantissa = *mantissa * 100000000 + EightDigitsToUint32(chunk);
+    p += 8;
+  }
+  while (p != end && p - begin < limit && '0' <= *p && *p <= '9') {
+    *mantissa = *mantissa * 10 + static_cast<uint64_t>(*p - '0');
+    ++p;
+  }
+  return p;
+}
+
+// Parses [p, end) as a decimal floating point number, handling only the
+// common easy cases: at most 19 mantissa digits and a scale within the
+// exactly representable powers of ten, so that the result is obtained with a
+// single correctly rounded multiply or divide (Clinger's fast path). Returns
+// false for anything else - long mantissas, extreme exponents, hex floats,
+// "inf"/"nan", or malformed input - leaving those to the full from_chars
+// implementation.
+inline bool ParseDoubleFast(absl::Nullable<const char*> p,
+                            absl::Nonnull<const char*> end,
+                            absl::Nonnull<double*> value) {
+  bool negative = false;
+  if (p != end && (*p == '+' || *p == '-')) {
+    negative = (*p == '-');
+    ++p;
+  }
+  uint64_t mantissa = 0;
+  const char* const int_begin = p;
+  p = ConsumeDigits(p, end, 19, &mantissa);
+  const ptrdiff_t int_digits = p - int_begin;
+  ptrdiff_t frac_digits = 0;
+  if (p != end && *p == '.') {
+    ++p;
+    const char* const frac_begin = p;
+    p = ConsumeDigits(p, end, 19 - int_digits, &mantissa);
+    frac_digits = p - frac_begin;
+    // Defer a bare trailing '.' to from_chars for the canonical verdict.
+    if (frac_digits == 0) return false;
+  }
+  if (int_digits + frac_digits == 0) return false;
+  // If more digits follow, the mantissa does not fit our 19 digit budget.
+  if (p != end && '0' <= *p && *p <= '9') return false;
+  int exp10 = static_cast<int>(-frac_digits);
+  if (p != end && (*p == 'e' || *p == 'E')) {
+    ++p;
+    bool exp_negative = false;
+    if (p != end && (*p == '+' || *p == '-')) {
+      exp_negative = (*p == '-');
+      ++p;
+    }
+    int exp_value = 0;
+    const char* const exp_begin = p;
+    while (p != end && '0' <= *p && *p <= '9' && exp_value < 1000) {
+      exp_value = exp_value * 10 + (*p - '0');
+      ++p;
+    }
+    if (p == exp_begin) return false;  // 'e' without digits.
+    exp10 += exp_negative ? -exp_value : exp_value;
+  }
+  if (p != end) return false;
+  if (mantissa > (uint64_t{1} << 53)) return false;
+  if (exp10 < -22 || exp10 > 22) return false;
+  double result = static_cast<double>(mantissa);
+  result = exp10 < 0 ? result / kExactPowersOfTen[-exp10]
+                     : result * kExactPowersOfTen[exp10];
+  *value = negative ? -result : result;
+  return true;
+}
+
+}  // namespace
+
+size_t ParseDoubles(absl::string_view text, char delim,
+                    absl::Span<double> out) {
+  const char* p = text.data();
+  const char* const end = p + text.size();
+  size_t count = 0;
+  while (count < out.size() && p != end) {
+    const char* field_end = static_cast<const char*>(
+        memchr(p, delim, static_cast<size_t>(end - p)));
+    if (field_end == nullptr) field_end = end;
+    double value;
+    if (!ParseDoubleFast(p, field_end, &value)) {
+      // Hard or unusual fields take the full from_chars path, including its
+      // arbitrary precision fallback for correctly rounding long inputs.
+      auto result = absl::from_chars(p, field_end, value);
+      if (result.ec != std::errc() || result.ptr != field_end) break;
+    }
+    out[count++] = value;
+    p = field_end;
+    if (p != end) ++p;  // Skip the delimiter.
+  }
+  return count;
+}
+
 ABSL_NAMESPACE_END
 }  // namespace absl
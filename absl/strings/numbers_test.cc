@@ -208,6 +208,24 @@ void CheckUInt64(uint64_t x) {
   EXPECT_EQ(expected, std::string(&buffer[1], my_actual)) << " Input " << x;
 }
 
+void CheckUInt128(absl::uint128 x) {
+  char buffer[absl::numbers_internal::kFastInt128ToBufferSize + 1];
+  char* actual = absl::numbers_internal::FastIntToBuffer(x, &buffer[1]);
+  std::string expected;
+  absl::strings_internal::OStringStream(&expected) << x;
+  EXPECT_EQ(expected, std::string(&buffer[1], actual)) << " Input " << x;
+  EXPECT_EQ(*actual, '\0');
+}
+
+void CheckInt128(absl::int128 x) {
+  char buffer[absl::numbers_internal::kFastInt128ToBufferSize + 1];
+  char* actual = absl::numbers_internal::FastIntToBuffer(x, &buffer[1]);
+  std::string expected;
+  absl::strings_internal::OStringStream(&expected) << x;
+  EXPECT_EQ(expected, std::string(&buffer[1], actual)) << " Input " << x;
+  EXPECT_EQ(*actual, '\0');
+}
+
 void CheckHex64(uint64_t v) {
   char expected[16 + 1];
   std::string actual = absl::StrCat(absl::Hex(v, absl::kZeroPad16));
@@ -252,6 +270,29 @@ TEST(Numbers, TestFastPrints) {
     CheckHex64(i);
   }
   CheckHex64(uint64_t{0x123456789abcdef0});
+
+  // 128-bit values, in particular around the 19- and 38-digit chunk
+  // boundaries and both extremes.
+  for (int i = -100; i <= 100; i++) {
+    CheckUInt128(absl::uint128(i + 100));
+    CheckInt128(absl::int128(i));
+    CheckUInt128(absl::Uint128Max() - static_cast<unsigned>(i + 100));
+    // Parenthesized so the intermediates stay in range: `Int128Max() - i`
+    // with i < 0 would overflow.
+    CheckInt128(absl::Int128Max() - (i + 100));
+    CheckInt128(absl::Int128Min() + (i + 100));
+  }
+  absl::uint128 power_of_ten = 1;
+  for (int i = 0; i < 39; ++i) {
+    CheckUInt128(power_of_ten - 1);
+    CheckUInt128(power_of_ten);
+    CheckUInt128(power_of_ten + 1);
+    CheckInt128(absl::int128(power_of_ten >> 1));
+    CheckInt128(-absl::int128(power_of_ten >> 1));
+    power_of_ten *= 10;
+  }
+  CheckUInt128(std::numeric_limits<uint64_t>::max());
+  CheckUInt128(absl::uint128(std::numeric_limits<uint64_t>::max()) + 1);
 }
 
 template <typename int_type, typename in_val_type>
@@ -816,6 +857,160 @@ TEST(NumbersTest, HexAtoi) {
   EXPECT_EQ(0x34234324, value);
 }
 
+TEST(NumbersTest, ParseInts) {
+  int64_t values[8];
+
+  // Basic delimited parsing, including signs.
+  EXPECT_EQ(absl::ParseInts("1,-2,+3,40", ',', absl::MakeSpan(values)), 4);
+  EXPECT_EQ(values[0], 1);
+  EXPECT_EQ(values[1], -2);
+  EXPECT_EQ(values[2], 3);
+  EXPECT_EQ(values[3], 40);
+
+  // Parsing stops once `out` is full; extra fields are left unread.
+  EXPECT_EQ(absl::ParseInts("5,6,7", ',', absl::MakeSpan(values, 2)), 2);
+  EXPECT_EQ(values[0], 5);
+  EXPECT_EQ(values[1], 6);
+
+  // Fields long enough to exercise the eight-digit chunks.
+  EXPECT_EQ(absl::ParseInts("123456789,1234567890123456789", ',',
+                            absl::MakeSpan(values)),
+            2);
+  EXPECT_EQ(values[0], 123456789);
+  EXPECT_EQ(values[1], 1234567890123456789);
+
+  // The full range of int64_t is accepted; one past either end is not.
+  EXPECT_EQ(absl::ParseInts("9223372036854775807,-9223372036854775808", ',',
+                            absl::MakeSpan(values)),
+            2);
+  EXPECT_EQ(values[0], std::numeric_limits<int64_t>::max());
+  EXPECT_EQ(values[1], std::numeric_limits<int64_t>::min());
+  EXPECT_EQ(
+      absl::ParseInts("9223372036854775808", ',', absl::MakeSpan(values)), 0);
+  EXPECT_EQ(
+      absl::ParseInts("-9223372036854775809", ',', absl::MakeSpan(values)), 0);
+
+  // Leading zeros do not count against the digit limit.
+  EXPECT_EQ(absl::ParseInts("000,00000000000000000000042", ',',
+                            absl::MakeSpan(values)),
+            2);
+  EXPECT_EQ(values[0], 0);
+  EXPECT_EQ(values[1], 42);
+
+  // Parsing stops at the first malformed field.
+  EXPECT_EQ(absl::ParseInts("1,x,3", ',', absl::MakeSpan(values)), 1);
+  EXPECT_EQ(absl::ParseInts("1,,3", ',', absl::MakeSpan(values)), 1);
+  EXPECT_EQ(absl::ParseInts("12 ,3", ',', absl::MakeSpan(values)), 0);
+  EXPECT_EQ(absl::ParseInts(" 1", ',', absl::MakeSpan(values)), 0);
+  EXPECT_EQ(absl::ParseInts("-", ',', absl::MakeSpan(values)), 0);
+  EXPECT_EQ(absl::ParseInts("", ',', absl::MakeSpan(values)), 0);
+
+  // A trailing delimiter simply ends the input.
+  EXPECT_EQ(absl::ParseInts("1,2,", ',', absl::MakeSpan(values)), 2);
+}
+
+TEST(NumbersTest, ParseIntsMatchesSimpleAtoi) {
+  absl::BitGen gen;
+  for (int round = 0; round < 1000; ++round) {
+    std::vector<int64_t> expected;
+    std::string text;
+    const int n = absl::Uniform(gen, 1, 8);
+    for (int i = 0; i < n; ++i) {
+      const int64_t v = absl::Uniform<int64_t>(
+          absl::IntervalClosed, gen, std::numeric_limits<int64_t>::min(),
+          std::numeric_limits<int64_t>::max());
+      expected.push_back(v);
+      absl::StrAppend(&text, i == 0 ? "" : "\t", v);
+    }
+    std::vector<int64_t> actual(expected.size());
+    ASSERT_EQ(absl::ParseInts(text, '\t', absl::MakeSpan(actual)),
+              expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+      int64_t simple;
+      ASSERT_TRUE(absl::SimpleAtoi(absl::StrCat(expected[i]), &simple));
+      EXPECT_EQ(actual[i], simple);
+      EXPECT_EQ(actual[i], expected[i]);
+    }
+  }
+}
+
+TEST(NumbersTest, ParseDoubles) {
+  double values[8];
+
+  // Basic delimited parsing, including signs and exponents.
+  EXPECT_EQ(absl::ParseDoubles("1.5,-2.25,+3e2,40", ',', absl::MakeSpan(values)),
+            4);
+  EXPECT_EQ(values[0], 1.5);
+  EXPECT_EQ(values[1], -2.25);
+  EXPECT_EQ(values[2], 300.0);
+  EXPECT_EQ(values[3], 40.0);
+
+  // Parsing stops once `out` is full; extra fields are left unread.
+  EXPECT_EQ(absl::ParseDoubles("5,6,7", ',', absl::MakeSpan(values, 2)), 2);
+  EXPECT_EQ(values[0], 5.0);
+  EXPECT_EQ(values[1], 6.0);
+
+  // Mantissas long enough to exercise the eight-digit chunks, and values
+  // beyond the fast path's 19 digit / 1e22 scale limits, which must be
+  // correctly rounded by the from_chars fallback.
+  EXPECT_EQ(absl::ParseDoubles(
+                "123456789.0123456789,0.1000000000000000055511151231257827,"
+                "1e308,1e-308,2.5e-324",
+                ',', absl::MakeSpan(values)),
+            5);
+  EXPECT_EQ(values[0], 123456789.0123456789);
+  EXPECT_EQ(values[1], 0.1);
+  EXPECT_EQ(values[2], 1e308);
+  EXPECT_EQ(values[3], 1e-308);
+  EXPECT_EQ(values[4], 5e-324);  // Subnormal, rounded from 2.5e-324.
+
+  // Infinities and NaNs are accepted, as with from_chars.
+  EXPECT_EQ(absl::ParseDoubles("inf,-inf,nan", ',', absl::MakeSpan(values)),
+            3);
+  EXPECT_EQ(values[0], std::numeric_limits<double>::infinity());
+  EXPECT_EQ(values[1], -std::numeric_limits<double>::infinity());
+  EXPECT_TRUE(std::isnan(values[2]));
+
+  // Parsing stops at the first malformed field.
+  EXPECT_EQ(absl::ParseDoubles("1.5,x,3", ',', absl::MakeSpan(values)), 1);
+  EXPECT_EQ(absl::ParseDoubles("1..5", ',', absl::MakeSpan(values)), 0);
+  EXPECT_EQ(absl::ParseDoubles("1,,3", ',', absl::MakeSpan(values)), 1);
+  EXPECT_EQ(absl::ParseDoubles(" 1.5", ',', absl::MakeSpan(values)), 0);
+  EXPECT_EQ(absl::ParseDoubles("1.5 ,3", ',', absl::MakeSpan(values)), 0);
+  EXPECT_EQ(absl::ParseDoubles("e5", ',', absl::MakeSpan(values)), 0);
+  EXPECT_EQ(absl::ParseDoubles("", ',', absl::MakeSpan(values)), 0);
+
+  // A trailing delimiter simply ends the input.
+  EXPECT_EQ(absl::ParseDoubles("1.5,2.5,", ',', absl::MakeSpan(values)), 2);
+}
+
+TEST(NumbersTest, ParseDoublesMatchesSimpleAtod) {
+  absl::BitGen gen;
+  for (int round = 0; round < 1000; ++round) {
+    std::vector<std::string> fields;
+    std::string text;
+    const int n = absl::Uniform(gen, 1, 8);
+    for (int i = 0; i < n; ++i) {
+      // Random decimal strings spanning the fast path and the fallback.
+      std::string field = absl::StrCat(
+          absl::Uniform(gen, 0, 2) ? "-" : "",
+          absl::Uniform<uint64_t>(gen), ".",
+          absl::Uniform<uint64_t>(gen), "e",
+          absl::Uniform(gen, -100, 101));
+      absl::StrAppend(&text, i == 0 ? "" : "\t", field);
+      fields.push_back(std::move(field));
+    }
+    std::vector<double> actual(fields.size());
+    ASSERT_EQ(absl::ParseDoubles(text, '\t', absl::MakeSpan(actual)),
+              fields.size());
+    for (size_t i = 0; i < fields.size(); ++i) {
+      double expected;
+      ASSERT_TRUE(absl::SimpleAtod(fields[i], &expected));
+      EXPECT_EQ(actual[i], expected) << fields[i];
+    }
+  }
+}
+
 TEST(stringtest, safe_strto32_base) {
   int32_t value;
   EXPECT_TRUE(safe_strto32_base("0x34234324", &value, 16));
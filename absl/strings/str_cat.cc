@@ -16,6 +16,7 @@
 
 #include <assert.h>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
@@ -28,6 +29,7 @@
 #include "absl/base/nullability.h"
 #include "absl/strings/internal/resize_uninitialized.h"
 #include "absl/strings/string_view.h"
+#include "absl/types/span.h"
 
 namespace absl {
 ABSL_NAMESPACE_BEGIN
@@ -150,6 +152,21 @@ std::string CatPieces(std::initializer_list<absl::string_view> pieces) {
   return result;
 }
 
+size_t CatPiecesInto(absl::Span<char> buf,
+                     std::initializer_list<absl::string_view> pieces) {
+  char* out = buf.data();
+  size_t remaining = buf.size();
+  for (absl::string_view piece : pieces) {
+    const size_t this_size = (std::min)(piece.size(), remaining);
+    if (this_size != 0) {
+      memcpy(out, piece.data(), this_size);
+      out += this_size;
+      remaining -= this_size;
+    }
+  }
+  return buf.size() - remaining;
+}
+
 // It's possible to call StrAppend with an absl::string_view that is itself a
 // fragment of the string we're appending to.  However the results of this are
 // random. Therefore, check for this in debug mode.  Use unsigned math so we
@@ -109,6 +109,7 @@
 #include "absl/strings/internal/stringify_sink.h"
 #include "absl/strings/numbers.h"
 #include "absl/strings/string_view.h"
+#include "absl/types/span.h"
 
 namespace absl {
 ABSL_NAMESPACE_BEGIN
@@ -453,6 +454,8 @@ namespace strings_internal {
 std::string CatPieces(std::initializer_list<absl::string_view> pieces);
 void AppendPieces(absl::Nonnull<std::string*> dest,
                   std::initializer_list<absl::string_view> pieces);
+size_t CatPiecesInto(absl::Span<char> buf,
+                     std::initializer_list<absl::string_view> pieces);
 
 template <typename Integer>
 std::string IntegerToString(Integer i) {
@@ -600,6 +603,62 @@ inline void StrAppend(absl::Nonnull<std::string*> dest, const AlphaNum& a,
              static_cast<const AlphaNum&>(args).Piece()...});
 }
 
+// -----------------------------------------------------------------------------
+// StrCatInto()
+// -----------------------------------------------------------------------------
+//
+// Concatenates a set of strings into a caller-provided buffer, in a similar
+// fashion to `StrCat()` but without allocating any memory. Returns the number
+// of bytes written. If the concatenation does not fit, the output is
+// truncated at exactly `buf.size()` bytes; a return value equal to
+// `buf.size()` therefore indicates possible truncation. The output is not
+// NUL-terminated.
+//
+// Example:
+//
+//   char buf[64];
+//   size_t n = absl::StrCatInto(absl::MakeSpan(buf), "iteration ", i);
+//   Write(absl::string_view(buf, n));
+//
+// WARNING: as with `StrAppend()`, none of the arguments may be a reference
+// into `buf`.
+
+inline size_t StrCatInto(absl::Span<char>) { return 0; }
+
+template <typename... AV>
+inline size_t StrCatInto(absl::Span<char> buf, const AlphaNum& a,
+                         const AV&... args) {
+  return strings_internal::CatPiecesInto(
+      buf, {a.Piece(), static_cast<const AlphaNum&>(args).Piece()...});
+}
+
+// -----------------------------------------------------------------------------
+// StrAppendInto()
+// -----------------------------------------------------------------------------
+//
+// Writes a set of strings to the front of `*buf` as `StrCatInto()` does, then
+// advances `*buf` past the written bytes so that successive calls append.
+// Returns the number of bytes written. Truncation behaves as in
+// `StrCatInto()`: once `*buf` is exhausted the output is cut short.
+//
+// Example:
+//
+//   char storage[128];
+//   absl::Span<char> buf = absl::MakeSpan(storage);
+//   absl::StrAppendInto(&buf, "x=", x);
+//   absl::StrAppendInto(&buf, " y=", y);
+//   absl::string_view result(storage, buf.data() - storage);
+
+inline size_t StrAppendInto(absl::Nonnull<absl::Span<char>*>) { return 0; }
+
+template <typename... AV>
+inline size_t StrAppendInto(absl::Nonnull<absl::Span<char>*> buf,
+                            const AlphaNum& a, const AV&... args) {
+  const size_t written = StrCatInto(*buf, a, args...);
+  buf->remove_prefix(written);
+  return written;
+}
+
 // Helper function for the future StrCat default floating-point format, %.6g
 // This is fast.
 inline strings_internal::AlphaNumBuffer<
@@ -487,6 +487,58 @@ TEST(StrAppend, CornerCasesNonEmptyAppend) {
   }
 }
 
+TEST(StrCatInto, Basics) {
+  char buf[64];
+  size_t n = absl::StrCatInto(absl::MakeSpan(buf), "iteration ", 42);
+  EXPECT_EQ(absl::string_view(buf, n), "iteration 42");
+
+  n = absl::StrCatInto(absl::MakeSpan(buf), "a", "b", "c", "d", "e", 1, 2.5);
+  EXPECT_EQ(absl::string_view(buf, n), "abcde12.5");
+
+  EXPECT_EQ(absl::StrCatInto(absl::MakeSpan(buf)), 0);
+  EXPECT_EQ(absl::StrCatInto(absl::MakeSpan(buf), "", "", ""), 0);
+}
+
+TEST(StrCatInto, Truncates) {
+  char buf[8];
+  size_t n = absl::StrCatInto(absl::MakeSpan(buf), "0123", "456789");
+  EXPECT_EQ(n, sizeof(buf));
+  EXPECT_EQ(absl::string_view(buf, n), "01234567");
+
+  // An empty buffer accepts nothing.
+  n = absl::StrCatInto(absl::Span<char>(), "anything");
+  EXPECT_EQ(n, 0);
+}
+
+TEST(StrCatInto, MatchesStrCat) {
+  char buf[128];
+  const double d = 1.5;
+  const size_t n =
+      absl::StrCatInto(absl::MakeSpan(buf), "d=", d, " hex=", absl::Hex(255),
+                       " neg=", -17, " bool=", true);
+  EXPECT_EQ(absl::string_view(buf, n),
+            absl::StrCat("d=", d, " hex=", absl::Hex(255), " neg=", -17,
+                         " bool=", true));
+}
+
+TEST(StrAppendInto, AdvancesBuffer) {
+  char storage[32];
+  absl::Span<char> buf = absl::MakeSpan(storage);
+  EXPECT_EQ(absl::StrAppendInto(&buf, "x=", 1), 3);
+  EXPECT_EQ(absl::StrAppendInto(&buf, " y=", 2), 4);
+  EXPECT_EQ(absl::StrAppendInto(&buf), 0);
+  EXPECT_EQ(absl::string_view(storage,
+                              static_cast<size_t>(buf.data() - storage)),
+            "x=1 y=2");
+
+  // Exhausting the buffer truncates and leaves it empty.
+  const std::string big(64, 'z');
+  absl::StrAppendInto(&buf, big);
+  EXPECT_TRUE(buf.empty());
+  EXPECT_EQ(absl::string_view(storage, sizeof(storage)),
+            absl::StrCat("x=1 y=2", big.substr(0, sizeof(storage) - 7)));
+}
+
 template <typename IntType>
 void CheckHex(IntType v, const char* nopad_format, const char* zeropad_format,
               const char* spacepad_format) {
@@ -114,6 +114,9 @@ class UntypedFormatSpec {
   explicit UntypedFormatSpec(
       absl::Nonnull<const str_format_internal::ParsedFormatBase*> pc)
       : spec_(pc) {}
+  explicit UntypedFormatSpec(
+      absl::Nonnull<const str_format_internal::CompiledFormatSpan*> cf)
+      : spec_(cf) {}
 
  private:
   friend str_format_internal::UntypedFormatSpecImpl;
@@ -336,6 +339,36 @@ using ParsedFormat = str_format_internal::ExtendedParsedFormat<
     absl::str_format_internal::ToFormatConversionCharSet(Conv)...>;
 #endif  // defined(__cpp_nontype_template_parameter_auto)
 
+// CompiledFormat
+//
+// A `CompiledFormat` is a `ParsedFormat` whose parsing happens entirely at
+// compile time: the format string is parsed and validated in a constant
+// expression and the result is stored in fixed-size arrays inside the object,
+// so formatting with it performs no format-string parsing at runtime. This is
+// the cheapest way to use a format string that is a compile-time constant in
+// a hot path.
+//
+// As with `ParsedFormat`, the template arguments specify the conversion
+// characters used within the format string, and they are checked at compile
+// time. Instances should normally be declared `static constexpr`; the format
+// string may be at most 256 characters long (use `ParsedFormat` for longer
+// formats or for formats only known at runtime).
+//
+// Example:
+//
+//   static constexpr absl::CompiledFormat<'s', 'd'> kFormat(
+//       "Welcome to %s, Number %d!");
+//   absl::StrFormat(kFormat, "TheVillage", 6);
+#if defined(__cpp_nontype_template_parameter_auto)
+template <auto... Conv>
+using CompiledFormat = str_format_internal::ExtendedCompiledFormat<
+    absl::str_format_internal::ToFormatConversionCharSet(Conv)...>;
+#else
+template <char... Conv>
+using CompiledFormat = str_format_internal::ExtendedCompiledFormat<
+    absl::str_format_internal::ToFormatConversionCharSet(Conv)...>;
+#endif  // defined(__cpp_nontype_template_parameter_auto)
+
 // StrFormat()
 //
 // Returns a `string` given a `printf()`-style format string and zero or more
@@ -1055,6 +1055,64 @@ TEST_F(ParsedFormatTest, DisallowModifiersWithV) {
   EXPECT_EQ(f, nullptr);
 }
 
+using CompiledFormatTest = ::testing::Test;
+
+template <typename CompiledFormatT>
+std::string SummarizeCompiledFormat(const CompiledFormatT& cf) {
+  std::string out;
+  if (!cf.span().ProcessFormat(SummarizeConsumer(&out))) out += "!";
+  return out;
+}
+
+TEST_F(CompiledFormatTest, ParsesAtCompileTime) {
+  static constexpr CompiledFormat<'d'> f1("ABC%dDEF");
+  static_assert(!f1.has_error(), "valid format");
+  EXPECT_EQ("[ABC]{d:1$d}[DEF]", SummarizeCompiledFormat(f1));
+
+  static constexpr CompiledFormat<'s', 'd', 'f'> f2("%sFFF%dZZZ%f");
+  EXPECT_EQ("{s:1$s}[FFF]{d:2$d}[ZZZ]{f:3$f}", SummarizeCompiledFormat(f2));
+
+  static constexpr CompiledFormat<'s', '*', 'd'> f3("%s %.*d");
+  EXPECT_EQ("{s:1$s}[ ]{.*d:3$.2$*d}", SummarizeCompiledFormat(f3));
+}
+
+TEST_F(CompiledFormatTest, FormatsLikeStrFormat) {
+  static constexpr CompiledFormat<'s', 'd'> format("Welcome to %s, Number %d!");
+  EXPECT_EQ(StrFormat(format, "TheVillage", 6),
+            "Welcome to TheVillage, Number 6!");
+
+  std::string out = "prefix: ";
+  StrAppendFormat(&out, format, "x", 1);
+  EXPECT_EQ(out, "prefix: Welcome to x, Number 1!");
+
+  std::ostringstream oss;
+  oss << StreamFormat(format, "y", 2);
+  EXPECT_EQ(oss.str(), "Welcome to y, Number 2!");
+}
+
+TEST_F(CompiledFormatTest, PercentLiteralsAndPositionalArgs) {
+  static constexpr CompiledFormat<'d'> pct("%d%%");
+  EXPECT_EQ(StrFormat(pct, 50), "50%");
+
+  static constexpr CompiledFormat<'s', 'd'> pos("%2$d-%1$s");
+  EXPECT_EQ(StrFormat(pos, "s", 7), "7-s");
+}
+
+TEST_F(CompiledFormatTest, WidthAndPrecisionFromArgs) {
+  static constexpr CompiledFormat<'*', 'd'> width("%*d");
+  EXPECT_EQ(StrFormat(width, 6, 42), "    42");
+
+  static constexpr CompiledFormat<'*', 'f'> precision("%.*f");
+  EXPECT_EQ(StrFormat(precision, 2, 3.14159), "3.14");
+}
+
+TEST_F(CompiledFormatTest, CopiesAreSelfContained) {
+  auto* original = new CompiledFormat<'d'>("x=%d");
+  CompiledFormat<'d'> copy(*original);
+  delete original;
+  EXPECT_EQ(StrFormat(copy, 5), "x=5");
+}
+
 using FormatWrapperTest = ::testing::Test;
 
 // Plain wrapper for StrFormat.
@@ -1084,6 +1142,11 @@ TEST_F(FormatWrapperTest, ParsedFormatWithV) {
   EXPECT_EQ(WrappedFormat(format, hello), "hello there");
 }
 
+TEST_F(FormatWrapperTest, CompiledFormat) {
+  static constexpr CompiledFormat<'s'> format("%s there");
+  EXPECT_EQ(WrappedFormat(format, "hello"), "hello there");
+}
+
 }  // namespace
 ABSL_NAMESPACE_END
 }  // namespace absl
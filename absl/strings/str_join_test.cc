@@ -428,6 +428,72 @@ TEST(StrJoin, InitializerList) {
   }
 }
 
+TEST(StrJoin, CharPointerRanges) {
+  // Ranges of char pointers take a presized two-pass path; make sure it
+  // agrees with the generic formatter on edge cases.
+  {
+    // Null pointers format as empty strings, like AlphaNum.
+    std::vector<const char*> v = {"foo", nullptr, "baz", nullptr};
+    EXPECT_EQ("foo--baz-", absl::StrJoin(v, "-"));
+  }
+
+  {
+    // All-empty input produces an empty result despite the separators.
+    std::vector<const char*> v = {"", "", ""};
+    EXPECT_EQ("--", absl::StrJoin(v, "-"));
+  }
+
+  {
+    // A large range still matches element-by-element concatenation.
+    std::vector<const char*> v(1000, "ab");
+    std::string expected = "ab";
+    for (size_t i = 1; i < v.size(); ++i) expected += ",ab";
+    EXPECT_EQ(expected, absl::StrJoin(v, ","));
+  }
+
+  {
+    // An explicitly-passed AlphaNumFormatter takes the same path.
+    std::vector<const char*> v = {"a", "b"};
+    EXPECT_EQ("a-b", absl::StrJoin(v, "-", absl::AlphaNumFormatter()));
+  }
+}
+
+TEST(StrJoin, IntegerRanges) {
+  // Ranges of integers take a presized direct-formatting path; make sure it
+  // agrees with the generic formatter across types and edge values.
+  {
+    std::vector<int> v = {0, -1, 1, std::numeric_limits<int>::min(),
+                          std::numeric_limits<int>::max()};
+    EXPECT_EQ("0,-1,1,-2147483648,2147483647", absl::StrJoin(v, ","));
+  }
+
+  {
+    std::vector<uint64_t> v = {0, std::numeric_limits<uint64_t>::max()};
+    EXPECT_EQ("0-18446744073709551615", absl::StrJoin(v, "-"));
+  }
+
+  {
+    // Single element: no separators.
+    std::vector<int64_t> v = {42};
+    EXPECT_EQ("42", absl::StrJoin(v, ","));
+  }
+
+  {
+    // A large range still matches element-by-element concatenation.
+    std::vector<int> v(1000);
+    for (size_t i = 0; i < v.size(); ++i) v[i] = static_cast<int>(i) - 500;
+    std::string expected = absl::StrCat(v[0]);
+    for (size_t i = 1; i < v.size(); ++i) absl::StrAppend(&expected, ";", v[i]);
+    EXPECT_EQ(expected, absl::StrJoin(v, ";"));
+  }
+
+  {
+    // An explicitly-passed AlphaNumFormatter takes the same path.
+    std::vector<int> v = {1, 2, 3};
+    EXPECT_EQ("1-2-3", absl::StrJoin(v, "-", absl::AlphaNumFormatter()));
+  }
+}
+
 TEST(StrJoin, StringViewInitializerList) {
   {
     // Tests initializer_list of string_views
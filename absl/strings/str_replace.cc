@@ -14,6 +14,7 @@
 
 #include "absl/strings/str_replace.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <initializer_list>
 #include <string>
@@ -87,5 +88,157 @@ int StrReplaceAll(strings_internal::FixedMapping replacements,
   return StrReplaceAll<strings_internal::FixedMapping>(replacements, target);
 }
 
+StrReplacer::StrReplacer(
+    std::initializer_list<std::pair<absl::string_view, absl::string_view>>
+        replacements) {
+  for (const auto& rep : replacements) {
+    AddPattern(rep.first, rep.second);
+  }
+  Compile();
+}
+
+void StrReplacer::AddPattern(absl::string_view pattern,
+                             absl::string_view replacement) {
+  // Ignore attempts to replace "", as StrReplaceAll() does.
+  if (pattern.empty()) return;
+
+  // Extend the trie with the pattern, one byte at a time.
+  int node = 0;
+  for (char ch : pattern) {
+    const unsigned char c = static_cast<unsigned char>(ch);
+    auto& edges = nodes_[static_cast<size_t>(node)].edges;
+    auto it = std::lower_bound(
+        edges.begin(), edges.end(), c,
+        [](const std::pair<unsigned char, int>& e, unsigned char value) {
+          return e.first < value;
+        });
+    if (it != edges.end() && it->first == c) {
+      node = it->second;
+    } else {
+      const int next = static_cast<int>(nodes_.size());
+      edges.insert(it, {c, next});  // invalidated below, so insert first
+      nodes_.emplace_back();
+      node = next;
+    }
+  }
+
+  // If the same pattern was given more than once, the first wins.
+  if (nodes_[static_cast<size_t>(node)].match >= 0) return;
+  nodes_[static_cast<size_t>(node)].match = static_cast<int>(patterns_.size());
+  patterns_.emplace_back(pattern);
+  replacements_.emplace_back(replacement);
+  max_pattern_len_ = (std::max)(max_pattern_len_, pattern.size());
+}
+
+void StrReplacer::Compile() {
+  // Breadth-first traversal computing failure links and propagating matches;
+  // a node visited after its failure link guarantees the link is final.
+  std::vector<int> queue;
+  queue.reserve(nodes_.size());
+  for (const auto& edge : nodes_[0].edges) {
+    root_next_[edge.first] = edge.second;
+    queue.push_back(edge.second);
+  }
+  for (size_t head = 0; head < queue.size(); ++head) {
+    const int node = queue[head];
+    for (const auto& edge : nodes_[static_cast<size_t>(node)].edges) {
+      Node& child = nodes_[static_cast<size_t>(edge.second)];
+      child.fail = Advance(nodes_[static_cast<size_t>(node)].fail, edge.first);
+      if (child.match < 0) {
+        // No pattern ends exactly here; the longest pattern ending here, if
+        // any, is the one ending at the longest matching suffix.
+        child.match = nodes_[static_cast<size_t>(child.fail)].match;
+      }
+      queue.push_back(edge.second);
+    }
+  }
+}
+
+int StrReplacer::Advance(int state, unsigned char c) const {
+  while (state != 0) {
+    const auto& edges = nodes_[static_cast<size_t>(state)].edges;
+    auto it = std::lower_bound(
+        edges.begin(), edges.end(), c,
+        [](const std::pair<unsigned char, int>& e, unsigned char value) {
+          return e.first < value;
+        });
+    if (it != edges.end() && it->first == c) return it->second;
+    state = nodes_[static_cast<size_t>(state)].fail;
+  }
+  return root_next_[c];
+}
+
+int StrReplacer::ReplaceInto(absl::string_view s,
+                             absl::Nonnull<std::string*> result) const {
+  int substitutions = 0;
+  size_t copied = 0;  // prefix of `s` already appended to `*result`
+  size_t i = 0;
+  int state = 0;
+  // The best match found so far but not yet applied: the automaton reports a
+  // match when its *end* is reached, so a short pattern surfaces before a
+  // longer one that starts earlier and ends later. A match is only applied
+  // once the scan is far enough along (`max_pattern_len_` past its start)
+  // that no match taking precedence over it can still be in progress.
+  int best = -1;
+  size_t best_start = 0;
+
+  const auto apply_best = [&] {
+    result->append(s.data() + copied, best_start - copied);
+    result->append(replacements_[static_cast<size_t>(best)]);
+    copied = best_start + patterns_[static_cast<size_t>(best)].size();
+    // The replaced text is not considered for further substitutions, so
+    // matching restarts from scratch after it; this also discards any
+    // overlapping matches found past the replaced region.
+    i = copied;
+    state = 0;
+    best = -1;
+    ++substitutions;
+  };
+
+  while (true) {
+    if (i >= s.size()) {
+      if (best >= 0) {
+        apply_best();
+        continue;  // rescan the text after the replaced region
+      }
+      break;
+    }
+    if (best >= 0 && i - best_start >= max_pattern_len_) {
+      apply_best();
+      continue;
+    }
+    state = Advance(state, static_cast<unsigned char>(s[i]));
+    const int match = nodes_[static_cast<size_t>(state)].match;
+    ++i;
+    if (match >= 0) {
+      const size_t start = i - patterns_[static_cast<size_t>(match)].size();
+      // Matches ending here and starting at `best_start` are longer than
+      // `best` (they end later), so `<=` implements both the earlier-match
+      // and the longer-match precedence rules.
+      if (best < 0 || start <= best_start) {
+        best = match;
+        best_start = start;
+      }
+    }
+  }
+  result->append(s.data() + copied, s.size() - copied);
+  return substitutions;
+}
+
+std::string StrReplacer::Replace(absl::string_view s) const {
+  std::string result;
+  result.reserve(s.size());
+  ReplaceInto(s, &result);
+  return result;
+}
+
+int StrReplacer::Replace(absl::Nonnull<std::string*> target) const {
+  std::string result;
+  result.reserve(target->size());
+  const int substitutions = ReplaceInto(*target, &result);
+  if (substitutions > 0) target->swap(result);
+  return substitutions;
+}
+
 ABSL_NAMESPACE_END
 }  // namespace absl
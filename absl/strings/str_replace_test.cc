@@ -343,3 +343,78 @@ TEST(StrReplaceAll, Inplace) {
   EXPECT_EQ(reps, 8);
   EXPECT_EQ(s, "pack my box with five dozen liquor jugs");
 }
+
+TEST(StrReplacer, MatchesStrReplaceAllSemantics) {
+  // The example from the StrReplaceAll documentation.
+  const absl::StrReplacer replacer({{"$count", absl::StrCat(5)},
+                                    {"$who", "Bob"},
+                                    {"#Noun", "Apples"}});
+  EXPECT_EQ("Bob bought 5 Apples. Thanks Bob!",
+            replacer.Replace("$who bought $count #Noun. Thanks $who!"));
+
+  // Earlier matches take precedence; longer matches win at the same
+  // position; replaced text is not reconsidered.
+  const absl::StrReplacer overlapping(
+      {{"abcd", "1"}, {"bc", "2"}, {"cde", "3"}});
+  EXPECT_EQ("1e", overlapping.Replace("abcde"));
+  EXPECT_EQ("x2de", overlapping.Replace("xbcde"));
+
+  const absl::StrReplacer recursive({{"aa", "a"}});
+  EXPECT_EQ("aa", recursive.Replace("aaaa"));
+
+  // Duplicate patterns: the first replacement wins.
+  const absl::StrReplacer duplicates({{"a", "x"}, {"a", "y"}});
+  EXPECT_EQ("xx", duplicates.Replace("aa"));
+
+  // Empty patterns are ignored.
+  const absl::StrReplacer empties({{"", "x"}, {"b", "y"}});
+  EXPECT_EQ("aya", empties.Replace("aba"));
+  EXPECT_EQ("", empties.Replace(""));
+}
+
+TEST(StrReplacer, FromContainer) {
+  std::map<absl::string_view, absl::string_view> replacements;
+  replacements["$who"] = "Bob";
+  replacements["$count"] = "5";
+  replacements["#Noun"] = "Apples";
+  const absl::StrReplacer replacer(replacements);
+  EXPECT_EQ("Bob bought 5 Apples. Thanks Bob!",
+            replacer.Replace("$who bought $count #Noun. Thanks $who!"));
+
+  // An empty replacer leaves subjects untouched.
+  const absl::StrReplacer empty(
+      std::vector<std::pair<std::string, std::string>>{});
+  EXPECT_EQ("abc", empty.Replace("abc"));
+}
+
+TEST(StrReplacer, Inplace) {
+  const absl::StrReplacer replacer({{"&", "&amp;"}, {"<", "&lt;"}});
+  std::string s = "if (ptr < &foo)";
+  EXPECT_EQ(2, replacer.Replace(&s));
+  EXPECT_EQ("if (ptr &lt; &amp;foo)", s);
+
+  std::string untouched = "nothing to do";
+  EXPECT_EQ(0, replacer.Replace(&untouched));
+  EXPECT_EQ("nothing to do", untouched);
+}
+
+// StrReplacer must produce byte-identical results to StrReplaceAll for any
+// pattern set; exercise that over a range of overlapping patterns and
+// subjects drawn from a small alphabet to force collisions.
+TEST(StrReplacer, AgreesWithStrReplaceAllOnSmallAlphabet) {
+  const std::vector<std::pair<std::string, std::string>> patterns = {
+      {"a", "<A>"},   {"ab", "<AB>"}, {"abab", "<ABAB>"}, {"bb", ""},
+      {"bab", "<->"}, {"aaa", "*"},
+  };
+  const absl::StrReplacer replacer(patterns);
+
+  std::string subject;
+  unsigned seed = 12345;
+  for (int i = 0; i < 2000; ++i) {
+    seed = seed * 1103515245 + 12345;
+    subject.push_back("ab"[(seed >> 16) % 2]);
+    EXPECT_EQ(absl::StrReplaceAll(subject, patterns),
+              replacer.Replace(subject))
+        << "subject: " << subject;
+  }
+}
@@ -48,6 +48,7 @@
 #include "absl/strings/internal/str_split_internal.h"
 #include "absl/strings/string_view.h"
 #include "absl/strings/strip.h"
+#include "absl/types/span.h"
 
 namespace absl {
 ABSL_NAMESPACE_BEGIN
@@ -559,6 +560,45 @@ StrSplit(StringType&& text, Delimiter d, Predicate p) {
       std::move(text), DelimiterType(d), std::move(p));
 }
 
+// StrSplitInto()
+//
+// Splits `text` like `StrSplit()`, but writes the resulting pieces into the
+// caller-provided array `out` instead of a container, performing no
+// allocation. Returns the number of pieces stored. Splitting stops as soon as
+// `out` is full, so a return value equal to `out.size()` may mean the input
+// contained more pieces than `out` had room for. The stored `string_view`s
+// point into `text`, which must outlive them; as with `StrSplit()`, passing a
+// temporary `std::string` is rejected at compile time.
+//
+// This is intended for hot paths that repeatedly split into a fixed number of
+// fields (e.g. parsing the columns of every line of a large log file), where
+// the container conversions of `StrSplit()` would allocate per call.
+//
+// Example:
+//
+//   absl::string_view fields[4];
+//   size_t n = absl::StrSplitInto("a,b,c", ',', absl::MakeSpan(fields));
+//   // n == 3, fields[0] == "a", fields[1] == "b", fields[2] == "c"
+template <typename Delimiter>
+size_t StrSplitInto(strings_internal::ConvertibleToStringView text, Delimiter d,
+                    absl::Span<absl::string_view> out) {
+  using DelimiterType =
+      typename strings_internal::SelectDelimiter<Delimiter>::type;
+  return strings_internal::SplitInto(text.value(), DelimiterType(std::move(d)),
+                                     AllowEmpty(), out);
+}
+
+// Overload of `StrSplitInto()` accepting an additional predicate, as
+// `StrSplit()` does (e.g. `absl::SkipEmpty()`).
+template <typename Delimiter, typename Predicate>
+size_t StrSplitInto(strings_internal::ConvertibleToStringView text, Delimiter d,
+                    Predicate p, absl::Span<absl::string_view> out) {
+  using DelimiterType =
+      typename strings_internal::SelectDelimiter<Delimiter>::type;
+  return strings_internal::SplitInto(text.value(), DelimiterType(std::move(d)),
+                                     std::move(p), out);
+}
+
 ABSL_NAMESPACE_END
 }  // namespace absl
 
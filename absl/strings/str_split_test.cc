@@ -36,6 +36,7 @@
 #include "absl/container/flat_hash_map.h"
 #include "absl/container/node_hash_map.h"
 #include "absl/strings/string_view.h"
+#include "absl/types/span.h"
 
 namespace {
 
@@ -1020,4 +1021,62 @@ TEST(SplitInternalTest, TypeTraits) {
                std::initializer_list<int>>::value));
 }
 
+TEST(StrSplitInto, Basics) {
+  absl::string_view fields[4];
+
+  EXPECT_EQ(3, absl::StrSplitInto("a,b,c", ',', absl::MakeSpan(fields)));
+  EXPECT_EQ("a", fields[0]);
+  EXPECT_EQ("b", fields[1]);
+  EXPECT_EQ("c", fields[2]);
+
+  // Empty pieces are kept, matching StrSplit.
+  EXPECT_EQ(4, absl::StrSplitInto(",b,,", ',', absl::MakeSpan(fields)));
+  EXPECT_EQ("", fields[0]);
+  EXPECT_EQ("b", fields[1]);
+  EXPECT_EQ("", fields[2]);
+  EXPECT_EQ("", fields[3]);
+
+  // Splitting stops once the output is full.
+  EXPECT_EQ(4, absl::StrSplitInto("a,b,c,d,e,f", ',', absl::MakeSpan(fields)));
+  EXPECT_EQ("d", fields[3]);
+
+  // Other delimiter types work too.
+  EXPECT_EQ(2, absl::StrSplitInto("a, b", absl::ByString(", "),
+                                  absl::MakeSpan(fields)));
+  EXPECT_EQ("a", fields[0]);
+  EXPECT_EQ("b", fields[1]);
+
+  // The legacy empty-vs-null distinction matches StrSplit.
+  EXPECT_EQ(1, absl::StrSplitInto(absl::string_view(""), ',',
+                                  absl::MakeSpan(fields)));
+  EXPECT_EQ(0, absl::StrSplitInto(absl::string_view(), ',',
+                                  absl::MakeSpan(fields)));
+
+  // An empty output span stores nothing.
+  EXPECT_EQ(0, absl::StrSplitInto("a,b", ',', absl::Span<absl::string_view>()));
+}
+
+TEST(StrSplitInto, Predicate) {
+  absl::string_view fields[4];
+  EXPECT_EQ(2, absl::StrSplitInto(",a,,b,", ',', absl::SkipEmpty(),
+                                  absl::MakeSpan(fields)));
+  EXPECT_EQ("a", fields[0]);
+  EXPECT_EQ("b", fields[1]);
+}
+
+TEST(StrSplitInto, MatchesStrSplit) {
+  absl::string_view fields[8];
+  const absl::string_view subjects[] = {"",       ",",     "a",    "a,",
+                                        ",a",     "a,b",   "a,,b", ",,",
+                                        "x,y,z,w", "one"};
+  for (absl::string_view subject : subjects) {
+    std::vector<absl::string_view> expected = absl::StrSplit(subject, ',');
+    size_t n = absl::StrSplitInto(subject, ',', absl::MakeSpan(fields));
+    ASSERT_EQ(expected.size(), n) << subject;
+    for (size_t i = 0; i < n; ++i) {
+      EXPECT_EQ(expected[i], fields[i]) << subject;
+    }
+  }
+}
+
 }  // namespace
@@ -0,0 +1,123 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// -----------------------------------------------------------------------------
+// File: string_builder.h
+// -----------------------------------------------------------------------------
+//
+// This header provides supported ways to grow a `std::string` without
+// zero-initializing the new bytes first: `absl::StrAppendUninitialized()` for
+// a single sized append, and `absl::StringBuilder` for serializers that
+// interleave reservation and incremental writes. Both write at memcpy speed
+// into storage that `std::string::resize()` would otherwise zero-fill, which
+// matters when producing multi-megabyte outputs.
+
+#ifndef ABSL_STRINGS_STRING_BUILDER_H_
+#define ABSL_STRINGS_STRING_BUILDER_H_
+
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <string>
+
+#include "absl/base/nullability.h"
+#include "absl/strings/internal/resize_uninitialized.h"
+#include "absl/strings/string_view.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+// StrAppendUninitialized()
+//
+// Extends `*dest` by `n` bytes whose contents are unspecified, and returns a
+// pointer to the first new byte. The caller must overwrite all `n` bytes
+// before reading them; growth is amortized, so repeated appends are linear.
+//
+// Example:
+//
+//   char* out = absl::StrAppendUninitialized(&s, src.size());
+//   memcpy(out, src.data(), src.size());
+inline absl::Nonnull<char*> StrAppendUninitialized(
+    absl::Nonnull<std::string*> dest, size_t n) {
+  const size_t old_size = dest->size();
+  strings_internal::STLStringResizeUninitializedAmortized(dest, old_size + n);
+  return &(*dest)[old_size];
+}
+
+// StringBuilder
+//
+// Appends to a caller-owned `std::string` through reserve/advance calls, for
+// serializers that write variable amounts into a buffer they size up front.
+// `Reserve()` makes room past the committed size without zero-filling it and
+// `Advance()` commits bytes actually written; the destructor trims the string
+// back to the committed size. The target string must not be accessed or
+// modified by other code while a `StringBuilder` is attached to it.
+//
+// Example:
+//
+//   std::string s;
+//   {
+//     absl::StringBuilder builder(&s);
+//     char* p = builder.Reserve(kMaxRecordSize);
+//     builder.Advance(SerializeRecord(record, p));
+//     builder.Append("\n");
+//   }
+//   // `s` now holds exactly the bytes committed above.
+class StringBuilder {
+ public:
+  explicit StringBuilder(absl::Nonnull<std::string*> dest)
+      : dest_(dest), size_(dest->size()) {}
+
+  StringBuilder(const StringBuilder&) = delete;
+  StringBuilder& operator=(const StringBuilder&) = delete;
+
+  ~StringBuilder() { dest_->erase(size_); }
+
+  // Ensures at least `n` writable bytes exist past the committed size and
+  // returns a pointer to the first of them. The pointer is invalidated by any
+  // later call on this object.
+  absl::Nonnull<char*> Reserve(size_t n) {
+    if (dest_->size() - size_ < n) {
+      strings_internal::STLStringResizeUninitializedAmortized(dest_,
+                                                              size_ + n);
+    }
+    return &(*dest_)[size_];
+  }
+
+  // Commits `n` bytes previously written through `Reserve()`.
+  void Advance(size_t n) {
+    assert(n <= dest_->size() - size_);
+    size_ += n;
+  }
+
+  // Copies `s` after the committed bytes and commits it.
+  void Append(absl::string_view s) {
+    char* out = Reserve(s.size());
+    if (!s.empty()) memcpy(out, s.data(), s.size());
+    size_ += s.size();
+  }
+
+  // The number of bytes committed so far, including those present in the
+  // target string when this object was constructed.
+  size_t size() const { return size_; }
+
+ private:
+  absl::Nonnull<std::string*> dest_;
+  size_t size_;  // Committed length of *dest_; dest_->size() may be larger.
+};
+
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_STRINGS_STRING_BUILDER_H_
@@ -0,0 +1,83 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/strings/string_builder.h"
+
+#include <cstring>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "absl/strings/string_view.h"
+
+namespace {
+
+TEST(StrAppendUninitialized, Basics) {
+  std::string s = "abc";
+  char* out = absl::StrAppendUninitialized(&s, 3);
+  memcpy(out, "def", 3);
+  EXPECT_EQ("abcdef", s);
+
+  // Zero-length appends are valid and leave the string unchanged.
+  absl::StrAppendUninitialized(&s, 0);
+  EXPECT_EQ("abcdef", s);
+
+  // Repeated appends are amortized; build a large string incrementally.
+  std::string big;
+  for (int i = 0; i < 1000; ++i) {
+    memcpy(absl::StrAppendUninitialized(&big, 4), "wxyz", 4);
+  }
+  EXPECT_EQ(4000, big.size());
+  EXPECT_EQ("wxyz", big.substr(3996));
+}
+
+TEST(StringBuilder, ReserveAdvance) {
+  std::string s;
+  {
+    absl::StringBuilder builder(&s);
+    char* p = builder.Reserve(16);
+    memcpy(p, "hello", 5);
+    builder.Advance(5);
+    EXPECT_EQ(5, builder.size());
+
+    // Over-reserving and committing less is the expected pattern.
+    p = builder.Reserve(64);
+    memcpy(p, ", world", 7);
+    builder.Advance(7);
+  }
+  // Destruction trims the uncommitted reservation.
+  EXPECT_EQ("hello, world", s);
+}
+
+TEST(StringBuilder, AppendAndExistingContents) {
+  std::string s = "prefix/";
+  {
+    absl::StringBuilder builder(&s);
+    EXPECT_EQ(7, builder.size());
+    builder.Append("one");
+    builder.Append("");
+    builder.Append("two");
+  }
+  EXPECT_EQ("prefix/onetwo", s);
+}
+
+TEST(StringBuilder, NothingCommitted) {
+  std::string s = "unchanged";
+  {
+    absl::StringBuilder builder(&s);
+    builder.Reserve(1024);
+  }
+  EXPECT_EQ("unchanged", s);
+}
+
+}  // namespace
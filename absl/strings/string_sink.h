@@ -0,0 +1,107 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// -----------------------------------------------------------------------------
+// File: string_sink.h
+// -----------------------------------------------------------------------------
+//
+// This header defines `absl::StringSink`, a lightweight append-only sink that
+// writes into a caller-owned `std::string`. It is a non-virtual alternative
+// to streaming into an `std::ostringstream`: every append is an inline call
+// on the underlying string, with none of the virtual dispatch, locale, or
+// sentry machinery of the iostreams hierarchy.
+//
+// `StringSink` satisfies the sink contract of the `AbslStringify()` protocol
+// and of `absl::Format()`, and its `operator<<` accepts anything `StrCat()`
+// accepts plus types implementing `AbslStringify()`, so code streaming into
+// an ostream can usually migrate by changing only the sink's type.
+
+#ifndef ABSL_STRINGS_STRING_SINK_H_
+#define ABSL_STRINGS_STRING_SINK_H_
+
+#include <cstddef>
+#include <string>
+#include <type_traits>
+
+#include "absl/base/nullability.h"
+#include "absl/strings/has_absl_stringify.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+// StringSink
+//
+// An append-only view of a caller-owned `std::string`. The sink holds a
+// pointer to the string, which must outlive it; copying the sink aliases the
+// same string.
+//
+// Example:
+//
+//   std::string out;
+//   absl::StringSink sink(&out);
+//   sink << "shard " << shard_index << " of " << num_shards;
+//   AbslStringify(sink, my_stringifiable_value);
+class StringSink {
+ public:
+  explicit StringSink(absl::Nonnull<std::string*> dest) : dest_(dest) {}
+
+  // StringSink::Append()
+  //
+  // Appends `v`, or `count` copies of `ch`. These two overloads form the
+  // sink contract required of `AbslStringify()` implementations.
+  void Append(absl::string_view v) { dest_->append(v.data(), v.size()); }
+  void Append(size_t count, char ch) { dest_->append(count, ch); }
+
+  // StringSink::operator<<()
+  //
+  // Streams a value into the sink. Accepts every type `StrCat()` accepts
+  // (strings, string_views, character pointers, numeric types) via the
+  // `AlphaNum` overload, single characters verbatim, and any type
+  // implementing `AbslStringify()`.
+  StringSink& operator<<(const AlphaNum& a) {
+    Append(a.Piece());
+    return *this;
+  }
+  // Templated on the deduced type so that numeric types convert through
+  // `AlphaNum` above instead of narrowing to `char`.
+  template <typename Char,
+            typename std::enable_if<std::is_same<Char, char>::value,
+                                    int>::type = 0>
+  StringSink& operator<<(Char c) {
+    dest_->push_back(c);
+    return *this;
+  }
+  template <typename T,
+            typename std::enable_if<HasAbslStringify<T>::value, int>::type = 0>
+  StringSink& operator<<(const T& v) {
+    AbslStringify(*this, v);
+    return *this;
+  }
+
+  // Support `absl::Format(&sink, format, args...)`.
+  friend void AbslFormatFlush(absl::Nonnull<StringSink*> sink,
+                              absl::string_view v) {
+    sink->Append(v);
+  }
+
+ private:
+  absl::Nonnull<std::string*> dest_;
+};
+
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_STRINGS_STRING_SINK_H_
@@ -0,0 +1,90 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/strings/string_sink.h"
+
+#include <string>
+
+#include "gtest/gtest.h"
+#include "absl/strings/str_format.h"
+#include "absl/strings/string_view.h"
+
+namespace {
+
+TEST(StringSink, AppendsToTheTargetString) {
+  std::string out = "head:";
+  absl::StringSink sink(&out);
+  sink.Append("foo");
+  sink.Append(3, '-');
+  sink.Append(absl::string_view("bar"));
+  EXPECT_EQ(out, "head:foo---bar");
+}
+
+TEST(StringSink, StreamsStrCatCompatibleTypes) {
+  std::string out;
+  absl::StringSink sink(&out);
+  sink << "x = " << 42 << ", y = " << 2.5 << ", id = " << uint64_t{1} << '!';
+  EXPECT_EQ(out, "x = 42, y = 2.5, id = 1!");
+}
+
+TEST(StringSink, StreamsSingleCharactersVerbatim) {
+  std::string out;
+  absl::StringSink sink(&out);
+  sink << 'a' << 'b' << 'c';
+  EXPECT_EQ(out, "abc");
+}
+
+struct Point {
+  int x;
+  int y;
+
+  template <typename Sink>
+  friend void AbslStringify(Sink& sink, const Point& p) {
+    sink.Append("(");
+    absl::Format(&sink, "%d, %d", p.x, p.y);
+    sink.Append(")");
+  }
+};
+
+TEST(StringSink, StreamsAbslStringifyTypes) {
+  std::string out;
+  absl::StringSink sink(&out);
+  sink << Point{3, 4} << " and " << Point{-1, 0};
+  EXPECT_EQ(out, "(3, 4) and (-1, 0)");
+}
+
+TEST(StringSink, SatisfiesTheStringifySinkContract) {
+  std::string out;
+  absl::StringSink sink(&out);
+  AbslStringify(sink, Point{7, 8});
+  EXPECT_EQ(out, "(7, 8)");
+}
+
+TEST(StringSink, WorksWithAbslFormat) {
+  std::string out;
+  absl::StringSink sink(&out);
+  absl::Format(&sink, "%08x", 0xdeadu);
+  EXPECT_EQ(out, "0000dead");
+}
+
+TEST(StringSink, CopiesAliasTheSameString) {
+  std::string out;
+  absl::StringSink sink(&out);
+  absl::StringSink alias = sink;
+  sink << "a";
+  alias << "b";
+  EXPECT_EQ(out, "ab");
+}
+
+}  // namespace
@@ -18,6 +18,7 @@
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <limits>
 #include <string>
 
@@ -182,5 +183,98 @@ Arg::Arg(Dec dec) {
 }
 
 }  // namespace substitute_internal
+
+SubstituteTemplate::SubstituteTemplate(absl::string_view format) {
+  literal_.reserve(format.size());
+  size_t literal_start = 0;  // Start of the current chunk within literal_.
+  for (size_t i = 0; i < format.size(); i++) {
+    if (format[i] != '$') {
+      literal_.push_back(format[i]);
+      continue;
+    }
+    if (i + 1 >= format.size()) {
+#ifndef NDEBUG
+      ABSL_RAW_LOG(FATAL,
+                   "Invalid absl::SubstituteTemplate() format string: \"%s\".",
+                   absl::CEscape(format).c_str());
+#endif
+      literal_.clear();
+      return;
+    } else if (absl::ascii_isdigit(static_cast<unsigned char>(format[i + 1]))) {
+      const int index = format[i + 1] - '0';
+      chunks_.push_back(
+          Chunk{literal_start, literal_.size() - literal_start, index});
+      literal_start = literal_.size();
+      required_args_ =
+          std::max(required_args_, static_cast<size_t>(index) + 1);
+      ++i;  // Skip next char.
+    } else if (format[i + 1] == '$') {
+      literal_.push_back('$');
+      ++i;  // Skip next char.
+    } else {
+#ifndef NDEBUG
+      ABSL_RAW_LOG(FATAL,
+                   "Invalid absl::SubstituteTemplate() format string: \"%s\".",
+                   absl::CEscape(format).c_str());
+#endif
+      literal_.clear();
+      chunks_.clear();
+      required_args_ = 0;
+      return;
+    }
+  }
+  chunks_.push_back(Chunk{literal_start, literal_.size() - literal_start, -1});
+  ok_ = true;
+}
+
+void SubstituteTemplate::AppendArray(
+    absl::Nonnull<std::string*> output,
+    absl::Nullable<const absl::string_view*> args_array,
+    size_t num_args) const {
+  if (!ok_) return;
+  if (num_args < required_args_) {
+#ifndef NDEBUG
+    ABSL_RAW_LOG(
+        FATAL,
+        "Invalid absl::SubstituteTemplate() use: asked for \"$%d\", but only "
+        "%d args were given.  Full format string was: \"%s\".",
+        static_cast<int>(required_args_) - 1, static_cast<int>(num_args),
+        absl::CEscape(literal_).c_str());
+#endif
+    return;
+  }
+
+  // Determine total size needed.
+  size_t size = literal_.size();
+  for (const Chunk& chunk : chunks_) {
+    if (chunk.arg >= 0) size += args_array[chunk.arg].size();
+  }
+  if (size == 0) return;
+
+  // Build the string.
+  size_t original_size = output->size();
+  ABSL_INTERNAL_CHECK(
+      size <= std::numeric_limits<size_t>::max() - original_size,
+      "size_t overflow");
+  strings_internal::STLStringResizeUninitializedAmortized(output,
+                                                          original_size + size);
+  char* target = &(*output)[original_size];
+  for (const Chunk& chunk : chunks_) {
+    if (chunk.literal_len != 0) {
+      memcpy(target, literal_.data() + chunk.literal_pos, chunk.literal_len);
+      target += chunk.literal_len;
+    }
+    if (chunk.arg >= 0) {
+      const absl::string_view src = args_array[chunk.arg];
+      if (!src.empty()) {
+        memcpy(target, src.data(), src.size());
+        target += src.size();
+      }
+    }
+  }
+
+  assert(target == output->data() + output->size());
+}
+
 ABSL_NAMESPACE_END
 }  // namespace absl
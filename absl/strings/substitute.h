@@ -761,6 +761,278 @@ std::string Substitute(
         "contains an unescaped $ character (use $$ instead)");
 #endif  // ABSL_BAD_CALL_IF
 
+// SubstituteTemplate
+//
+// Parses a `Substitute()` format string once so that it may be applied to many
+// argument sets without rescanning the format. Construction records the
+// positions of the `$N` placeholders and collapses `$$` escapes; each
+// subsequent substitution only sums the argument sizes and copies the
+// precomputed literal spans interleaved with the arguments. Prefer this class
+// over `Substitute()` when the same format string is used repeatedly, e.g. for
+// large templates applied per request.
+//
+// Example:
+//
+//   const absl::SubstituteTemplate tmpl("$1 purchased $0 $2. Thanks $1!");
+//   std::string s = tmpl.Substitute(5, "Bob", "Apples");
+//   EXPECT_EQ("Bob purchased 5 Apples. Thanks Bob!", s);
+//
+// Invalid format strings are diagnosed as for `Substitute()`: in debug builds
+// construction terminates the program, otherwise substitution returns an empty
+// string (or appends nothing). The same applies when fewer arguments are
+// supplied than the format string requires.
+//
+// The declarations of `Substitute()` and `SubstituteAndAppend()` below consist
+// of overloads for passing 0 to 10 arguments, respectively.
+class SubstituteTemplate {
+ public:
+  explicit SubstituteTemplate(absl::string_view format);
+
+  // Returns true if the format string parsed cleanly.
+  bool ok() const { return ok_; }
+
+  // The number of arguments the format string requires: one more than the
+  // highest `$N` placeholder it contains.
+  size_t required_args() const { return required_args_; }
+
+  // SubstituteTemplate::SubstituteAndAppend()
+  //
+  // Substitutes the given arguments into the parsed format string and appends
+  // the result to `output`.
+  void SubstituteAndAppend(absl::Nonnull<std::string*> output) const {
+    AppendArray(output, nullptr, 0);
+  }
+
+  void SubstituteAndAppend(absl::Nonnull<std::string*> output,
+                           const substitute_internal::Arg& a0) const {
+    const absl::string_view args[] = {a0.piece()};
+    AppendArray(output, args, ABSL_ARRAYSIZE(args));
+  }
+
+  void SubstituteAndAppend(absl::Nonnull<std::string*> output,
+                           const substitute_internal::Arg& a0,
+                           const substitute_internal::Arg& a1) const {
+    const absl::string_view args[] = {a0.piece(), a1.piece()};
+    AppendArray(output, args, ABSL_ARRAYSIZE(args));
+  }
+
+  void SubstituteAndAppend(absl::Nonnull<std::string*> output,
+                           const substitute_internal::Arg& a0,
+                           const substitute_internal::Arg& a1,
+                           const substitute_internal::Arg& a2) const {
+    const absl::string_view args[] = {a0.piece(), a1.piece(), a2.piece()};
+    AppendArray(output, args, ABSL_ARRAYSIZE(args));
+  }
+
+  void SubstituteAndAppend(absl::Nonnull<std::string*> output,
+                           const substitute_internal::Arg& a0,
+                           const substitute_internal::Arg& a1,
+                           const substitute_internal::Arg& a2,
+                           const substitute_internal::Arg& a3) const {
+    const absl::string_view args[] = {a0.piece(), a1.piece(), a2.piece(),
+                                      a3.piece()};
+    AppendArray(output, args, ABSL_ARRAYSIZE(args));
+  }
+
+  void SubstituteAndAppend(absl::Nonnull<std::string*> output,
+                           const substitute_internal::Arg& a0,
+                           const substitute_internal::Arg& a1,
+                           const substitute_internal::Arg& a2,
+                           const substitute_internal::Arg& a3,
+                           const substitute_internal::Arg& a4) const {
+    const absl::string_view args[] = {a0.piece(), a1.piece(), a2.piece(),
+                                      a3.piece(), a4.piece()};
+    AppendArray(output, args, ABSL_ARRAYSIZE(args));
+  }
+
+  void SubstituteAndAppend(absl::Nonnull<std::string*> output,
+                           const substitute_internal::Arg& a0,
+                           const substitute_internal::Arg& a1,
+                           const substitute_internal::Arg& a2,
+                           const substitute_internal::Arg& a3,
+                           const substitute_internal::Arg& a4,
+                           const substitute_internal::Arg& a5) const {
+    const absl::string_view args[] = {a0.piece(), a1.piece(), a2.piece(),
+                                      a3.piece(), a4.piece(), a5.piece()};
+    AppendArray(output, args, ABSL_ARRAYSIZE(args));
+  }
+
+  void SubstituteAndAppend(absl::Nonnull<std::string*> output,
+                           const substitute_internal::Arg& a0,
+                           const substitute_internal::Arg& a1,
+                           const substitute_internal::Arg& a2,
+                           const substitute_internal::Arg& a3,
+                           const substitute_internal::Arg& a4,
+                           const substitute_internal::Arg& a5,
+                           const substitute_internal::Arg& a6) const {
+    const absl::string_view args[] = {a0.piece(), a1.piece(), a2.piece(),
+                                      a3.piece(), a4.piece(), a5.piece(),
+                                      a6.piece()};
+    AppendArray(output, args, ABSL_ARRAYSIZE(args));
+  }
+
+  void SubstituteAndAppend(
+      absl::Nonnull<std::string*> output, const substitute_internal::Arg& a0,
+      const substitute_internal::Arg& a1, const substitute_internal::Arg& a2,
+      const substitute_internal::Arg& a3, const substitute_internal::Arg& a4,
+      const substitute_internal::Arg& a5, const substitute_internal::Arg& a6,
+      const substitute_internal::Arg& a7) const {
+    const absl::string_view args[] = {a0.piece(), a1.piece(), a2.piece(),
+                                      a3.piece(), a4.piece(), a5.piece(),
+                                      a6.piece(), a7.piece()};
+    AppendArray(output, args, ABSL_ARRAYSIZE(args));
+  }
+
+  void SubstituteAndAppend(
+      absl::Nonnull<std::string*> output, const substitute_internal::Arg& a0,
+      const substitute_internal::Arg& a1, const substitute_internal::Arg& a2,
+      const substitute_internal::Arg& a3, const substitute_internal::Arg& a4,
+      const substitute_internal::Arg& a5, const substitute_internal::Arg& a6,
+      const substitute_internal::Arg& a7,
+      const substitute_internal::Arg& a8) const {
+    const absl::string_view args[] = {a0.piece(), a1.piece(), a2.piece(),
+                                      a3.piece(), a4.piece(), a5.piece(),
+                                      a6.piece(), a7.piece(), a8.piece()};
+    AppendArray(output, args, ABSL_ARRAYSIZE(args));
+  }
+
+  void SubstituteAndAppend(
+      absl::Nonnull<std::string*> output, const substitute_internal::Arg& a0,
+      const substitute_internal::Arg& a1, const substitute_internal::Arg& a2,
+      const substitute_internal::Arg& a3, const substitute_internal::Arg& a4,
+      const substitute_internal::Arg& a5, const substitute_internal::Arg& a6,
+      const substitute_internal::Arg& a7, const substitute_internal::Arg& a8,
+      const substitute_internal::Arg& a9) const {
+    const absl::string_view args[] = {
+        a0.piece(), a1.piece(), a2.piece(), a3.piece(), a4.piece(),
+        a5.piece(), a6.piece(), a7.piece(), a8.piece(), a9.piece()};
+    AppendArray(output, args, ABSL_ARRAYSIZE(args));
+  }
+
+  // SubstituteTemplate::Substitute()
+  //
+  // Substitutes the given arguments into the parsed format string and returns
+  // the result.
+  ABSL_MUST_USE_RESULT std::string Substitute() const {
+    std::string result;
+    SubstituteAndAppend(&result);
+    return result;
+  }
+
+  ABSL_MUST_USE_RESULT std::string Substitute(
+      const substitute_internal::Arg& a0) const {
+    std::string result;
+    SubstituteAndAppend(&result, a0);
+    return result;
+  }
+
+  ABSL_MUST_USE_RESULT std::string Substitute(
+      const substitute_internal::Arg& a0,
+      const substitute_internal::Arg& a1) const {
+    std::string result;
+    SubstituteAndAppend(&result, a0, a1);
+    return result;
+  }
+
+  ABSL_MUST_USE_RESULT std::string Substitute(
+      const substitute_internal::Arg& a0, const substitute_internal::Arg& a1,
+      const substitute_internal::Arg& a2) const {
+    std::string result;
+    SubstituteAndAppend(&result, a0, a1, a2);
+    return result;
+  }
+
+  ABSL_MUST_USE_RESULT std::string Substitute(
+      const substitute_internal::Arg& a0, const substitute_internal::Arg& a1,
+      const substitute_internal::Arg& a2,
+      const substitute_internal::Arg& a3) const {
+    std::string result;
+    SubstituteAndAppend(&result, a0, a1, a2, a3);
+    return result;
+  }
+
+  ABSL_MUST_USE_RESULT std::string Substitute(
+      const substitute_internal::Arg& a0, const substitute_internal::Arg& a1,
+      const substitute_internal::Arg& a2, const substitute_internal::Arg& a3,
+      const substitute_internal::Arg& a4) const {
+    std::string result;
+    SubstituteAndAppend(&result, a0, a1, a2, a3, a4);
+    return result;
+  }
+
+  ABSL_MUST_USE_RESULT std::string Substitute(
+      const substitute_internal::Arg& a0, const substitute_internal::Arg& a1,
+      const substitute_internal::Arg& a2, const substitute_internal::Arg& a3,
+      const substitute_internal::Arg& a4,
+      const substitute_internal::Arg& a5) const {
+    std::string result;
+    SubstituteAndAppend(&result, a0, a1, a2, a3, a4, a5);
+    return result;
+  }
+
+  ABSL_MUST_USE_RESULT std::string Substitute(
+      const substitute_internal::Arg& a0, const substitute_internal::Arg& a1,
+      const substitute_internal::Arg& a2, const substitute_internal::Arg& a3,
+      const substitute_internal::Arg& a4, const substitute_internal::Arg& a5,
+      const substitute_internal::Arg& a6) const {
+    std::string result;
+    SubstituteAndAppend(&result, a0, a1, a2, a3, a4, a5, a6);
+    return result;
+  }
+
+  ABSL_MUST_USE_RESULT std::string Substitute(
+      const substitute_internal::Arg& a0, const substitute_internal::Arg& a1,
+      const substitute_internal::Arg& a2, const substitute_internal::Arg& a3,
+      const substitute_internal::Arg& a4, const substitute_internal::Arg& a5,
+      const substitute_internal::Arg& a6,
+      const substitute_internal::Arg& a7) const {
+    std::string result;
+    SubstituteAndAppend(&result, a0, a1, a2, a3, a4, a5, a6, a7);
+    return result;
+  }
+
+  ABSL_MUST_USE_RESULT std::string Substitute(
+      const substitute_internal::Arg& a0, const substitute_internal::Arg& a1,
+      const substitute_internal::Arg& a2, const substitute_internal::Arg& a3,
+      const substitute_internal::Arg& a4, const substitute_internal::Arg& a5,
+      const substitute_internal::Arg& a6, const substitute_internal::Arg& a7,
+      const substitute_internal::Arg& a8) const {
+    std::string result;
+    SubstituteAndAppend(&result, a0, a1, a2, a3, a4, a5, a6, a7, a8);
+    return result;
+  }
+
+  ABSL_MUST_USE_RESULT std::string Substitute(
+      const substitute_internal::Arg& a0, const substitute_internal::Arg& a1,
+      const substitute_internal::Arg& a2, const substitute_internal::Arg& a3,
+      const substitute_internal::Arg& a4, const substitute_internal::Arg& a5,
+      const substitute_internal::Arg& a6, const substitute_internal::Arg& a7,
+      const substitute_internal::Arg& a8,
+      const substitute_internal::Arg& a9) const {
+    std::string result;
+    SubstituteAndAppend(&result, a0, a1, a2, a3, a4, a5, a6, a7, a8, a9);
+    return result;
+  }
+
+ private:
+  // One literal span of the format string, followed by the argument to
+  // substitute after it (or no argument, for the final span).
+  struct Chunk {
+    size_t literal_pos;
+    size_t literal_len;
+    int arg;  // Index of the argument appended after the literal, or -1.
+  };
+
+  void AppendArray(absl::Nonnull<std::string*> output,
+                   absl::Nullable<const absl::string_view*> args_array,
+                   size_t num_args) const;
+
+  std::string literal_;  // Literal format text with "$$" collapsed to "$".
+  std::vector<Chunk> chunks_;
+  size_t required_args_ = 0;
+  bool ok_ = false;
+};
+
 ABSL_NAMESPACE_END
 }  // namespace absl
 
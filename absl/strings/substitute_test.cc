@@ -268,6 +268,60 @@ TEST(SubstituteTest, AbslStringifyWithEnum) {
   EXPECT_EQ(absl::Substitute("$0", e), "Choices");
 }
 
+TEST(SubstituteTemplateTest, MatchesSubstitute) {
+  const absl::SubstituteTemplate tmpl("$1 purchased $0 $2 for $$10. Thanks $1!");
+  EXPECT_TRUE(tmpl.ok());
+  EXPECT_EQ(3, tmpl.required_args());
+  EXPECT_EQ("Bob purchased 5 Apples for $10. Thanks Bob!",
+            tmpl.Substitute(5, "Bob", "Apples"));
+  // Repeated application with different argument sets.
+  EXPECT_EQ(absl::Substitute("$1 purchased $0 $2 for $$10. Thanks $1!", 7,
+                             "Eve", "Pears"),
+            tmpl.Substitute(7, "Eve", "Pears"));
+
+  // Boundary shapes: placeholders at the start, end, and adjacent.
+  EXPECT_EQ("ab", absl::SubstituteTemplate("$0$1").Substitute("a", "b"));
+  EXPECT_EQ("a-b", absl::SubstituteTemplate("$0-$1").Substitute("a", "b"));
+  EXPECT_EQ("aa", absl::SubstituteTemplate("$0$0").Substitute("a"));
+  EXPECT_EQ("", absl::SubstituteTemplate("").Substitute());
+  EXPECT_EQ("$", absl::SubstituteTemplate("$$").Substitute());
+  EXPECT_EQ("literal only", absl::SubstituteTemplate("literal only").Substitute());
+
+  // All ten arguments.
+  const absl::SubstituteTemplate all("$0-$1-$2-$3-$4-$5-$6-$7-$8-$9");
+  EXPECT_EQ(10, all.required_args());
+  EXPECT_EQ("a-b-c-d-e-f-g-h-i-j",
+            all.Substitute("a", "b", "c", "d", "e", "f", "g", "h", "i", "j"));
+}
+
+TEST(SubstituteTemplateTest, SubstituteAndAppend) {
+  const absl::SubstituteTemplate tmpl("$0 $1");
+  std::string str = "Hello";
+  tmpl.SubstituteAndAppend(&str, ",", "world!");
+  EXPECT_EQ("Hello, world!", str);
+
+  // Appending the empty result leaves the target untouched.
+  std::string empty_target = "keep";
+  absl::SubstituteTemplate("$0").SubstituteAndAppend(&empty_target, "");
+  EXPECT_EQ("keep", empty_target);
+}
+
+#if GTEST_HAS_DEATH_TEST
+
+TEST(SubstituteTemplateDeathTest, InvalidFormat) {
+  EXPECT_DEBUG_DEATH(absl::SubstituteTemplate(absl::string_view("-$z-")),
+                     "Invalid absl::SubstituteTemplate\\(\\) format string: "
+                     "\"-\\$z-\"");
+  EXPECT_DEBUG_DEATH(absl::SubstituteTemplate(absl::string_view("-$")),
+                     "Invalid absl::SubstituteTemplate\\(\\) format string: "
+                     "\"-\\$\"");
+  EXPECT_DEBUG_DEATH(
+      static_cast<void>(absl::SubstituteTemplate("-$2").Substitute("a", "b")),
+      "asked for \"\\$2\", but only 2 args were given.");
+}
+
+#endif  // GTEST_HAS_DEATH_TEST
+
 #if GTEST_HAS_DEATH_TEST
 
 TEST(SubstituteDeathTest, SubstituteDeath) {
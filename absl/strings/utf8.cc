@@ -0,0 +1,321 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/strings/utf8.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "absl/base/config.h"
+#include "absl/strings/internal/utf8.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+
+#ifdef __SSSE3__
+#include <tmmintrin.h>
+#define ABSL_INTERNAL_UTF8_HAVE_SSSE3 1
+#endif
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+namespace {
+
+constexpr char32_t kReplacementChar = 0xFFFD;
+
+// Decodes the code point whose encoding starts at `p` and stores it in `*cp`,
+// returning the number of bytes consumed (1 to 4). Returns 0 if the bytes at
+// `p` do not begin a well-formed sequence: a stray continuation byte, an
+// overlong encoding, a surrogate, a value above U+10FFFF, or a sequence
+// truncated by `end`.
+size_t DecodeCodePoint(const unsigned char* p, const unsigned char* end,
+                       char32_t* cp) {
+  const unsigned char b0 = p[0];
+  if (b0 < 0x80) {
+    *cp = b0;
+    return 1;
+  }
+  if (b0 < 0xC2) return 0;  // Continuation byte or overlong two-byte lead.
+  if (b0 < 0xE0) {
+    if (end - p < 2 || (p[1] & 0xC0) != 0x80) return 0;
+    *cp = (char32_t{b0} & 0x1F) << 6 | (p[1] & 0x3F);
+    return 2;
+  }
+  if (b0 < 0xF0) {
+    if (end - p < 3 || (p[1] & 0xC0) != 0x80 || (p[2] & 0xC0) != 0x80) {
+      return 0;
+    }
+    if (b0 == 0xE0 && p[1] < 0xA0) return 0;  // Overlong.
+    if (b0 == 0xED && p[1] > 0x9F) return 0;  // Surrogate.
+    *cp = (char32_t{b0} & 0x0F) << 12 | (char32_t{p[1]} & 0x3F) << 6 |
+          (p[2] & 0x3F);
+    return 3;
+  }
+  if (b0 < 0xF5) {
+    if (end - p < 4 || (p[1] & 0xC0) != 0x80 || (p[2] & 0xC0) != 0x80 ||
+        (p[3] & 0xC0) != 0x80) {
+      return 0;
+    }
+    if (b0 == 0xF0 && p[1] < 0x90) return 0;  // Overlong.
+    if (b0 == 0xF4 && p[1] > 0x8F) return 0;  // Above U+10FFFF.
+    *cp = (char32_t{b0} & 0x07) << 18 | (char32_t{p[1]} & 0x3F) << 12 |
+          (char32_t{p[2]} & 0x3F) << 6 | (p[3] & 0x3F);
+    return 4;
+  }
+  return 0;  // 0xF5..0xFF never appear in well-formed UTF-8.
+}
+
+#ifdef ABSL_INTERNAL_UTF8_HAVE_SSSE3
+
+// Vectorized validation using the nibble-lookup scheme of Keiser and Lemire,
+// "Validating UTF-8 In Less Than One Instruction Per Byte". Each pair of
+// adjacent bytes is classified by three PSHUFB lookups (high nibble of the
+// first byte, low nibble of the first byte, high nibble of the second byte);
+// the intersection of the three lookups is nonzero exactly for the two-byte
+// error patterns below. Continuations of three- and four-byte sequences are
+// checked separately by comparing the bytes two and three positions back
+// against the smallest three- and four-byte lead values.
+constexpr uint8_t kTooShort = 1 << 0;   // Lead byte not followed by a cont.
+constexpr uint8_t kTooLong = 1 << 1;    // ASCII followed by a continuation.
+constexpr uint8_t kOverlong3 = 1 << 2;  // E0 80..9F.
+constexpr uint8_t kTooLarge = 1 << 3;   // F4 90..BF or F5..FF lead.
+constexpr uint8_t kSurrogate = 1 << 4;  // ED A0..BF.
+constexpr uint8_t kOverlong2 = 1 << 5;  // C0/C1 lead.
+constexpr uint8_t kTooLarge2 = 1 << 6;  // F0..FF with a too-large second byte.
+constexpr uint8_t kOverlong4 = 1 << 6;  // F0 80..8F; shares a bit with
+                                        // kTooLarge2 (the patterns are
+                                        // disjoint in the second byte).
+constexpr uint8_t kTwoConts = 1 << 7;   // Two continuations in a row.
+// Bits that must be propagated for any first byte so that valid multi-byte
+// sequences (lead + continuation) do not themselves report an error.
+constexpr uint8_t kCarry = kTooShort | kTooLong | kTwoConts;
+
+// Returns the block shifted right by N bytes, with the vacated bytes filled
+// from the end of the previous block.
+template <int N>
+inline __m128i Prev(__m128i input, __m128i prev_input) {
+  return _mm_alignr_epi8(input, prev_input, 16 - N);
+}
+
+inline __m128i CheckSpecialCases(__m128i input, __m128i prev1) {
+  const __m128i byte_1_high_table = _mm_setr_epi8(
+      // 0xxxxxxx: ASCII may not be followed by a continuation.
+      kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong,
+      kTooLong,
+      // 10xxxxxx: a continuation may not follow a continuation...
+      kTwoConts, kTwoConts, kTwoConts, kTwoConts,
+      // ...and 110xxxxx/1110xxxx/1111xxxx leads must be followed by one.
+      kTooShort | kOverlong2, kTooShort,
+      kTooShort | kOverlong3 | kSurrogate,
+      kTooShort | kTooLarge | kTooLarge2 | kOverlong4);
+  const __m128i byte_1_low_table = _mm_setr_epi8(
+      kCarry | kOverlong3 | kOverlong2 | kOverlong4,  // ____0000: E0/C0/F0.
+      kCarry | kOverlong2,                            // ____0001: C1.
+      kCarry, kCarry,
+      kCarry | kTooLarge,               // ____0100: F4.
+      kCarry | kTooLarge | kTooLarge2,  // ____0101 and up: F5..FF.
+      kCarry | kTooLarge | kTooLarge2, kCarry | kTooLarge | kTooLarge2,
+      kCarry | kTooLarge | kTooLarge2, kCarry | kTooLarge | kTooLarge2,
+      kCarry | kTooLarge | kTooLarge2, kCarry | kTooLarge | kTooLarge2,
+      kCarry | kTooLarge | kTooLarge2,
+      kCarry | kTooLarge | kTooLarge2 | kSurrogate,  // ____1101: ED.
+      kCarry | kTooLarge | kTooLarge2, kCarry | kTooLarge | kTooLarge2);
+  const __m128i byte_2_high_table = _mm_setr_epi8(
+      // 0xxxxxxx: not a continuation, so any lead before it was too short.
+      kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort,
+      kTooShort, kTooShort,
+      // 1000xxxx..1011xxxx: continuations, with range-dependent error bits.
+      kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge2 | kOverlong4,
+      kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge,
+      kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+      kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+      // 11xxxxxx: not a continuation.
+      kTooShort, kTooShort, kTooShort, kTooShort);
+  const __m128i low_nibble_mask = _mm_set1_epi8(0x0F);
+  const __m128i byte_1_high = _mm_shuffle_epi8(
+      byte_1_high_table,
+      _mm_and_si128(_mm_srli_epi16(prev1, 4), low_nibble_mask));
+  const __m128i byte_1_low =
+      _mm_shuffle_epi8(byte_1_low_table, _mm_and_si128(prev1, low_nibble_mask));
+  const __m128i byte_2_high = _mm_shuffle_epi8(
+      byte_2_high_table,
+      _mm_and_si128(_mm_srli_epi16(input, 4), low_nibble_mask));
+  return _mm_and_si128(_mm_and_si128(byte_1_high, byte_1_low), byte_2_high);
+}
+
+// Flags bytes that must be the second or third continuation of a sequence,
+// and cancels the kTwoConts bit that CheckSpecialCases() reported for them.
+// Any mismatch between the two views of the block is an error.
+inline __m128i CheckMultibyteLengths(__m128i input, __m128i prev_input,
+                                     __m128i special_cases) {
+  const __m128i prev2 = Prev<2>(input, prev_input);
+  const __m128i prev3 = Prev<3>(input, prev_input);
+  // Nonzero iff the byte two back is a three-byte-or-longer lead (>= 0xE0),
+  // or the byte three back is a four-byte lead (>= 0xF0).
+  const __m128i is_third_byte =
+      _mm_subs_epu8(prev2, _mm_set1_epi8(static_cast<char>(0xE0 - 1)));
+  const __m128i is_fourth_byte =
+      _mm_subs_epu8(prev3, _mm_set1_epi8(static_cast<char>(0xF0 - 1)));
+  const __m128i must_be_continuation =
+      _mm_cmpgt_epi8(_mm_or_si128(is_third_byte, is_fourth_byte),
+                     _mm_setzero_si128());
+  const __m128i must_be_continuation_80 =
+      _mm_and_si128(must_be_continuation, _mm_set1_epi8(static_cast<char>(0x80)));
+  return _mm_xor_si128(must_be_continuation_80, special_cases);
+}
+
+// Nonzero in any byte that starts a sequence extending past the end of the
+// block: a lead in the last byte, a three-byte-or-longer lead in the
+// second-to-last, or a four-byte lead in the third-to-last.
+inline __m128i IsIncomplete(__m128i input) {
+  const __m128i max_value = _mm_setr_epi8(
+      '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+      '\xff', '\xff', '\xff', '\xff', static_cast<char>(0xF0 - 1),
+      static_cast<char>(0xE0 - 1), static_cast<char>(0xC0 - 1));
+  return _mm_subs_epu8(input, max_value);
+}
+
+bool Utf8IsValidSimd(const char* data, size_t size) {
+  __m128i error = _mm_setzero_si128();
+  __m128i prev_input = _mm_setzero_si128();
+  __m128i prev_incomplete = _mm_setzero_si128();
+  size_t i = 0;
+  for (; i + 16 <= size; i += 16) {
+    const __m128i input =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+    if (_mm_movemask_epi8(input) == 0) {
+      // All-ASCII block: the only possible error is a multi-byte sequence
+      // left dangling by the previous block.
+      error = _mm_or_si128(error, prev_incomplete);
+    } else {
+      const __m128i prev1 = Prev<1>(input, prev_input);
+      const __m128i special_cases = CheckSpecialCases(input, prev1);
+      error = _mm_or_si128(
+          error, CheckMultibyteLengths(input, prev_input, special_cases));
+    }
+    prev_incomplete = IsIncomplete(input);
+    prev_input = input;
+  }
+  // Process the remaining bytes as a zero-padded block. The padding is ASCII,
+  // so a sequence truncated by the end of input is reported as kTooShort; an
+  // empty tail still catches a sequence dangling out of the final full block.
+  {
+    char buf[16] = {0};
+    memcpy(buf, data + i, size - i);
+    const __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(buf));
+    const __m128i prev1 = Prev<1>(input, prev_input);
+    const __m128i special_cases = CheckSpecialCases(input, prev1);
+    error = _mm_or_si128(
+        error, CheckMultibyteLengths(input, prev_input, special_cases));
+  }
+  return _mm_movemask_epi8(_mm_cmpeq_epi8(error, _mm_setzero_si128())) ==
+         0xFFFF;
+}
+
+#endif  // ABSL_INTERNAL_UTF8_HAVE_SSSE3
+
+}  // namespace
+
+bool Utf8IsValid(absl::string_view s) {
+#ifdef ABSL_INTERNAL_UTF8_HAVE_SSSE3
+  return Utf8IsValidSimd(s.data(), s.size());
+#else
+  const unsigned char* p = reinterpret_cast<const unsigned char*>(s.data());
+  const unsigned char* end = p + s.size();
+  while (p < end) {
+    char32_t cp;
+    const size_t len = DecodeCodePoint(p, end, &cp);
+    if (len == 0) return false;
+    p += len;
+  }
+  return true;
+#endif
+}
+
+size_t Utf8ToUtf32(absl::string_view utf8, absl::Span<char32_t> utf32) {
+  const unsigned char* p = reinterpret_cast<const unsigned char*>(utf8.data());
+  const unsigned char* end = p + utf8.size();
+  size_t written = 0;
+  while (p < end && written < utf32.size()) {
+    char32_t cp;
+    size_t len = DecodeCodePoint(p, end, &cp);
+    if (len == 0) {
+      cp = kReplacementChar;
+      len = 1;
+    }
+    utf32[written++] = cp;
+    p += len;
+  }
+  return written;
+}
+
+size_t Utf8ToUtf16(absl::string_view utf8, absl::Span<char16_t> utf16) {
+  const unsigned char* p = reinterpret_cast<const unsigned char*>(utf8.data());
+  const unsigned char* end = p + utf8.size();
+  size_t written = 0;
+  while (p < end && written < utf16.size()) {
+    char32_t cp;
+    size_t len = DecodeCodePoint(p, end, &cp);
+    if (len == 0) {
+      cp = kReplacementChar;
+      len = 1;
+    }
+    if (cp <= 0xFFFF) {
+      utf16[written++] = static_cast<char16_t>(cp);
+    } else {
+      if (utf16.size() - written < 2) break;  // Don't split a surrogate pair.
+      cp -= 0x10000;
+      utf16[written++] = static_cast<char16_t>(0xD800 + (cp >> 10));
+      utf16[written++] = static_cast<char16_t>(0xDC00 + (cp & 0x3FF));
+    }
+    p += len;
+  }
+  return written;
+}
+
+size_t Utf32ToUtf8(absl::Span<const char32_t> utf32, absl::Span<char> utf8) {
+  size_t written = 0;
+  for (char32_t cp : utf32) {
+    if ((cp >= 0xD800 && cp <= 0xDFFF) || cp > 0x10FFFF) cp = kReplacementChar;
+    char buf[strings_internal::kMaxEncodedUTF8Size];
+    const size_t len = strings_internal::EncodeUTF8Char(buf, cp);
+    if (utf8.size() - written < len) break;
+    memcpy(utf8.data() + written, buf, len);
+    written += len;
+  }
+  return written;
+}
+
+size_t Utf16ToUtf8(absl::Span<const char16_t> utf16, absl::Span<char> utf8) {
+  size_t written = 0;
+  for (size_t i = 0; i < utf16.size(); ++i) {
+    char32_t cp = utf16[i];
+    if (cp >= 0xD800 && cp <= 0xDBFF && i + 1 < utf16.size() &&
+        utf16[i + 1] >= 0xDC00 && utf16[i + 1] <= 0xDFFF) {
+      cp = 0x10000 + ((cp - 0xD800) << 10) + (utf16[i + 1] - 0xDC00);
+      ++i;
+    } else if (cp >= 0xD800 && cp <= 0xDFFF) {
+      cp = kReplacementChar;  // Unpaired surrogate.
+    }
+    char buf[strings_internal::kMaxEncodedUTF8Size];
+    const size_t len = strings_internal::EncodeUTF8Char(buf, cp);
+    if (utf8.size() - written < len) break;
+    memcpy(utf8.data() + written, buf, len);
+    written += len;
+  }
+  return written;
+}
+
+ABSL_NAMESPACE_END
+}  // namespace absl
@@ -0,0 +1,82 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// -----------------------------------------------------------------------------
+// File: utf8.h
+// -----------------------------------------------------------------------------
+//
+// This header file contains functions for validating UTF-8 and for converting
+// between UTF-8 and the fixed-width Unicode encoding forms UTF-16 and UTF-32.
+//
+// Validation follows the Unicode standard exactly: overlong encodings,
+// encoded surrogate code points (U+D800..U+DFFF), and values above U+10FFFF
+// are all rejected. The transcoding functions never fail; ill-formed input is
+// replaced by U+FFFD REPLACEMENT CHARACTER so that the output is always
+// well-formed.
+
+#ifndef ABSL_STRINGS_UTF8_H_
+#define ABSL_STRINGS_UTF8_H_
+
+#include <cstddef>
+
+#include "absl/base/attributes.h"
+#include "absl/base/config.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+// Utf8IsValid()
+//
+// Returns true if `s` is a well-formed UTF-8 sequence: every byte is part of
+// a correctly encoded code point, no encoding is overlong, and no code point
+// is a surrogate or lies above U+10FFFF. The empty string is valid.
+ABSL_MUST_USE_RESULT bool Utf8IsValid(absl::string_view s);
+
+// Utf8ToUtf32()
+//
+// Decodes `utf8` into `utf32` and returns the number of code points written.
+// Each maximal ill-formed subsequence is replaced by one U+FFFD per rejected
+// byte. Decoding stops when `utf32` is full, so a return value equal to
+// `utf32.size()` may indicate truncated output. A buffer of `utf8.size()`
+// code points is always large enough.
+size_t Utf8ToUtf32(absl::string_view utf8, absl::Span<char32_t> utf32);
+
+// Utf8ToUtf16()
+//
+// Like `Utf8ToUtf32()` but produces UTF-16 code units; code points above
+// U+FFFF become surrogate pairs, which are never split across the end of
+// `utf16`. A buffer of `utf8.size()` code units is always large enough.
+size_t Utf8ToUtf16(absl::string_view utf8, absl::Span<char16_t> utf16);
+
+// Utf32ToUtf8()
+//
+// Encodes `utf32` as UTF-8 and returns the number of bytes written. Surrogate
+// code points and values above U+10FFFF are replaced by U+FFFD. Encoding
+// stops, without splitting a code point, when `utf8` is full. A buffer of
+// `4 * utf32.size()` bytes is always large enough.
+size_t Utf32ToUtf8(absl::Span<const char32_t> utf32, absl::Span<char> utf8);
+
+// Utf16ToUtf8()
+//
+// Encodes `utf16` as UTF-8 and returns the number of bytes written. Unpaired
+// surrogate code units are replaced by U+FFFD. A buffer of
+// `3 * utf16.size()` bytes is always large enough.
+size_t Utf16ToUtf8(absl::Span<const char16_t> utf16, absl::Span<char> utf8);
+
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_STRINGS_UTF8_H_
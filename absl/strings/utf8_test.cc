@@ -0,0 +1,177 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/strings/utf8.h"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "absl/strings/internal/utf8.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+
+namespace {
+
+TEST(Utf8IsValid, Basics) {
+  EXPECT_TRUE(absl::Utf8IsValid(""));
+  EXPECT_TRUE(absl::Utf8IsValid("plain ascii"));
+  EXPECT_TRUE(absl::Utf8IsValid("caf\xC3\xA9"));               // U+00E9
+  EXPECT_TRUE(absl::Utf8IsValid("\xE6\x97\xA5\xE6\x9C\xAC"));  // 日本
+  EXPECT_TRUE(absl::Utf8IsValid("\xF0\x9F\x98\x80"));          // U+1F600
+
+  EXPECT_FALSE(absl::Utf8IsValid("\x80"));              // Stray continuation.
+  EXPECT_FALSE(absl::Utf8IsValid("\xC0\xAF"));          // Overlong '/'.
+  EXPECT_FALSE(absl::Utf8IsValid("\xC1\xBF"));          // Overlong.
+  EXPECT_FALSE(absl::Utf8IsValid("\xE0\x80\x80"));      // Overlong.
+  EXPECT_FALSE(absl::Utf8IsValid("\xE0\x9F\xBF"));      // Overlong.
+  EXPECT_FALSE(absl::Utf8IsValid("\xED\xA0\x80"));      // Surrogate U+D800.
+  EXPECT_FALSE(absl::Utf8IsValid("\xF0\x8F\xBF\xBF"));  // Overlong.
+  EXPECT_FALSE(absl::Utf8IsValid("\xF4\x90\x80\x80"));  // Above U+10FFFF.
+  EXPECT_FALSE(absl::Utf8IsValid("\xF5\x80\x80\x80"));  // Invalid lead.
+  EXPECT_FALSE(absl::Utf8IsValid("\xFF"));              // Invalid lead.
+  EXPECT_FALSE(absl::Utf8IsValid("\xC2"));              // Truncated.
+  EXPECT_FALSE(absl::Utf8IsValid("\xE2\x82"));          // Truncated.
+  EXPECT_FALSE(absl::Utf8IsValid("\xF0\x9F\x98"));      // Truncated.
+  EXPECT_FALSE(absl::Utf8IsValid("ok until \xE2\x82the end"));
+}
+
+TEST(Utf8IsValid, EveryCodePoint) {
+  for (char32_t cp = 0; cp <= 0x10FFFF; ++cp) {
+    char buf[absl::strings_internal::kMaxEncodedUTF8Size];
+    const size_t len = absl::strings_internal::EncodeUTF8Char(buf, cp);
+    const absl::string_view encoded(buf, len);
+    const bool is_surrogate = cp >= 0xD800 && cp <= 0xDFFF;
+    ASSERT_EQ(!is_surrogate, absl::Utf8IsValid(encoded)) << cp;
+    if (is_surrogate) continue;
+    // Round-trips through the decoder.
+    char32_t decoded[1];
+    ASSERT_EQ(1, absl::Utf8ToUtf32(encoded, absl::MakeSpan(decoded)));
+    ASSERT_EQ(cp, decoded[0]);
+  }
+}
+
+TEST(Utf8IsValid, ErrorsAtEveryPosition) {
+  // Exercises every alignment of an error and of a multi-byte sequence within
+  // a longer string, including positions that straddle any internal block
+  // boundaries the implementation may use.
+  const std::string clean(64, 'a');
+  EXPECT_TRUE(absl::Utf8IsValid(clean));
+  for (size_t i = 0; i < clean.size(); ++i) {
+    std::string s = clean;
+    s[i] = '\xC2';  // Lead with no continuation.
+    EXPECT_FALSE(absl::Utf8IsValid(s)) << i;
+    s = clean;
+    s[i] = '\x80';  // Stray continuation.
+    EXPECT_FALSE(absl::Utf8IsValid(s)) << i;
+    s = clean;
+    s.replace(i, 1, "\xF0\x9F\x98\x80");  // Valid four-byte sequence.
+    EXPECT_TRUE(absl::Utf8IsValid(s)) << i;
+    s.resize(i + 3);  // Truncate it.
+    EXPECT_FALSE(absl::Utf8IsValid(s)) << i;
+  }
+}
+
+TEST(Utf8Transcode, ToUtf32) {
+  // "aé€😀" = U+0061 U+00E9 U+20AC U+1F600.
+  const absl::string_view utf8 = "a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80";
+  char32_t buf[8];
+  EXPECT_EQ(4, absl::Utf8ToUtf32(utf8, absl::MakeSpan(buf)));
+  EXPECT_EQ(U'a', buf[0]);
+  EXPECT_EQ(char32_t{0xE9}, buf[1]);
+  EXPECT_EQ(char32_t{0x20AC}, buf[2]);
+  EXPECT_EQ(char32_t{0x1F600}, buf[3]);
+
+  // Ill-formed bytes each decode to U+FFFD.
+  EXPECT_EQ(3, absl::Utf8ToUtf32("a\x80z", absl::MakeSpan(buf)));
+  EXPECT_EQ(char32_t{0xFFFD}, buf[1]);
+  EXPECT_EQ(U'z', buf[2]);
+
+  // A full output span stops decoding.
+  EXPECT_EQ(2, absl::Utf8ToUtf32(utf8, absl::MakeSpan(buf, 2)));
+}
+
+TEST(Utf8Transcode, ToUtf16) {
+  const absl::string_view utf8 = "a\xC3\xA9\xF0\x9F\x98\x80";  // a é 😀
+  char16_t buf[8];
+  EXPECT_EQ(4, absl::Utf8ToUtf16(utf8, absl::MakeSpan(buf)));
+  EXPECT_EQ(u'a', buf[0]);
+  EXPECT_EQ(char16_t{0xE9}, buf[1]);
+  EXPECT_EQ(char16_t{0xD83D}, buf[2]);  // High surrogate of U+1F600.
+  EXPECT_EQ(char16_t{0xDE00}, buf[3]);  // Low surrogate.
+
+  // A surrogate pair is never split: with room for only one more unit, the
+  // four-byte sequence is not consumed at all.
+  EXPECT_EQ(2, absl::Utf8ToUtf16(utf8, absl::MakeSpan(buf, 3)));
+}
+
+TEST(Utf8Transcode, FromUtf32) {
+  const char32_t utf32[] = {U'a', 0xE9, 0x20AC, 0x1F600};
+  char buf[16];
+  const size_t n = absl::Utf32ToUtf8(absl::MakeConstSpan(utf32), absl::MakeSpan(buf));
+  EXPECT_EQ("a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80",
+            absl::string_view(buf, n));
+
+  // Surrogates and out-of-range values are replaced by U+FFFD.
+  const char32_t bad[] = {0xD800, 0x110000};
+  const size_t bn = absl::Utf32ToUtf8(absl::MakeConstSpan(bad), absl::MakeSpan(buf));
+  EXPECT_EQ("\xEF\xBF\xBD\xEF\xBF\xBD", absl::string_view(buf, bn));
+
+  // Output is never split mid code point.
+  EXPECT_EQ(3, absl::Utf32ToUtf8(absl::MakeConstSpan(utf32),
+                                 absl::MakeSpan(buf, 5)));
+}
+
+TEST(Utf8Transcode, FromUtf16) {
+  const char16_t utf16[] = {u'a', 0xE9, 0xD83D, 0xDE00};
+  char buf[16];
+  const size_t n = absl::Utf16ToUtf8(absl::MakeConstSpan(utf16), absl::MakeSpan(buf));
+  EXPECT_EQ("a\xC3\xA9\xF0\x9F\x98\x80", absl::string_view(buf, n));
+
+  // An unpaired surrogate becomes U+FFFD.
+  const char16_t bad[] = {0xD83D, u'x'};
+  const size_t bn = absl::Utf16ToUtf8(absl::MakeConstSpan(bad), absl::MakeSpan(buf));
+  EXPECT_EQ("\xEF\xBF\xBDx", absl::string_view(buf, bn));
+}
+
+TEST(Utf8Transcode, RoundTripEveryCodePoint) {
+  std::string utf8;
+  std::vector<char32_t> expected;
+  for (char32_t cp = 0; cp <= 0x10FFFF; ++cp) {
+    if (cp >= 0xD800 && cp <= 0xDFFF) continue;
+    char buf[absl::strings_internal::kMaxEncodedUTF8Size];
+    utf8.append(buf, absl::strings_internal::EncodeUTF8Char(buf, cp));
+    expected.push_back(cp);
+  }
+  ASSERT_TRUE(absl::Utf8IsValid(utf8));
+
+  std::vector<char32_t> utf32(expected.size());
+  ASSERT_EQ(expected.size(), absl::Utf8ToUtf32(utf8, absl::MakeSpan(utf32)));
+  EXPECT_EQ(expected, utf32);
+
+  std::vector<char16_t> utf16(utf8.size());
+  const size_t utf16_len = absl::Utf8ToUtf16(utf8, absl::MakeSpan(utf16));
+  std::string back(utf8.size(), '\0');
+  const size_t back_len = absl::Utf16ToUtf8(
+      absl::MakeConstSpan(utf16.data(), utf16_len), absl::MakeSpan(back));
+  EXPECT_EQ(utf8, back.substr(0, back_len));
+
+  std::string back32(utf8.size(), '\0');
+  const size_t back32_len = absl::Utf32ToUtf8(absl::MakeConstSpan(utf32),
+                                              absl::MakeSpan(back32));
+  EXPECT_EQ(utf8, back32.substr(0, back32_len));
+}
+
+}  // namespace
@@ -0,0 +1,365 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// -----------------------------------------------------------------------------
+// bounded_queue.h
+// -----------------------------------------------------------------------------
+//
+// `absl::BoundedQueue<T>` is a fixed-capacity multi-producer multi-consumer
+// queue. Transfers go through a ring of slots, each with its own sequence
+// number, so concurrent producers and consumers synchronize per slot rather
+// than through one shared lock; uncontended pushes and pops are a couple of
+// atomic operations and never block each other. `Push()` on a full queue and
+// `Pop()` on an empty one park the calling thread until there is room; the
+// `Try` variants never block, and the `N` variants move several elements per
+// claim for batch-oriented pipelines.
+//
+// Example: a work queue drained by several consumers.
+//
+//   absl::BoundedQueue<Request> queue(1024);
+//
+//   // Producers:
+//   queue.Push(std::move(request));  // parks while the queue is full
+//
+//   // Consumers:
+//   Request r = queue.Pop();         // parks while the queue is empty
+//
+// The capacity is rounded up to a power of two. Elements popped by one
+// thread happened-after the push that produced them; no ordering is implied
+// between elements pushed by different producers.
+
+#ifndef ABSL_SYNCHRONIZATION_BOUNDED_QUEUE_H_
+#define ABSL_SYNCHRONIZATION_BOUNDED_QUEUE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+#include "absl/base/internal/raw_logging.h"
+#include "absl/base/optimization.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/types/span.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+// BoundedQueue<T>
+//
+// A bounded lock-free MPMC ring buffer with blocking push/pop wrappers.
+// `T` must be move-constructible and move-assignable.
+template <typename T>
+class BoundedQueue {
+ public:
+  // Creates a queue holding at least `min_capacity` (> 0) elements; the
+  // actual capacity is `min_capacity` rounded up to a power of two, and is
+  // at least 2 (the slot sequence scheme cannot represent a one-slot ring).
+  explicit BoundedQueue(size_t min_capacity) {
+    ABSL_RAW_CHECK(min_capacity > 0, "BoundedQueue capacity must be positive");
+    size_t capacity = 2;
+    while (capacity < min_capacity) capacity <<= 1;
+    mask_ = capacity - 1;
+    slots_.reset(new Slot[capacity]);
+    for (size_t i = 0; i < capacity; ++i) {
+      slots_[i].seq.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  BoundedQueue(const BoundedQueue&) = delete;
+  BoundedQueue& operator=(const BoundedQueue&) = delete;
+
+  // Destroys any elements still queued. No concurrent access may be in
+  // flight.
+  ~BoundedQueue() {
+    uint64_t pos;
+    Slot* slot;
+    while ((slot = TryClaimDequeueSlot(&pos)) != nullptr) {
+      slot->element()->~T();
+      slot->seq.store(pos + mask_ + 1, std::memory_order_relaxed);
+    }
+  }
+
+  size_t capacity() const { return mask_ + 1; }
+
+  // BoundedQueue::Push()
+  //
+  // Enqueues `value`, blocking while the queue is full.
+  void Push(T value) {
+    while (TryPushN(absl::MakeSpan(&value, 1)) == 0) ParkUntilNotFull();
+    WakeConsumers();
+  }
+
+  // BoundedQueue::Pop()
+  //
+  // Dequeues and returns the oldest element, blocking while the queue is
+  // empty.
+  T Pop() {
+    for (;;) {
+      uint64_t pos;
+      Slot* slot = TryClaimDequeueSlot(&pos);
+      if (ABSL_PREDICT_TRUE(slot != nullptr)) {
+        T value = std::move(*slot->element());
+        RetireDequeuedSlot(slot, pos);
+        WakeProducers();
+        return value;
+      }
+      ParkUntilNotEmpty();
+    }
+  }
+
+  // BoundedQueue::TryPush()
+  //
+  // Enqueues `value` if the queue is not full. Returns false (and discards
+  // `value`) otherwise; never blocks.
+  bool TryPush(T value) {
+    if (TryPushN(absl::MakeSpan(&value, 1)) == 0) return false;
+    WakeConsumers();
+    return true;
+  }
+
+  // BoundedQueue::TryPop()
+  //
+  // Dequeues the oldest element into `*out` if the queue is not empty.
+  // Returns false otherwise; never blocks.
+  bool TryPop(T* out) {
+    uint64_t pos;
+    Slot* slot = TryClaimDequeueSlot(&pos);
+    if (slot == nullptr) return false;
+    *out = std::move(*slot->element());
+    RetireDequeuedSlot(slot, pos);
+    WakeProducers();
+    return true;
+  }
+
+  // BoundedQueue::PushN()
+  //
+  // Enqueues every element of `values` (moving from them), blocking as
+  // needed. Elements are enqueued in order, possibly interleaved with other
+  // producers' elements.
+  void PushN(absl::Span<T> values) {
+    while (!values.empty()) {
+      size_t n = TryPushN(values);
+      if (n > 0) {
+        WakeConsumers();
+        values.remove_prefix(n);
+      } else {
+        ParkUntilNotFull();
+      }
+    }
+  }
+
+  // BoundedQueue::PopN()
+  //
+  // Dequeues up to `out.size()` elements into `out`, blocking until at least
+  // one is available. Returns the number dequeued.
+  size_t PopN(absl::Span<T> out) {
+    if (out.empty()) return 0;
+    for (;;) {
+      size_t n = TryPopN(out);
+      if (n > 0) {
+        WakeProducers();
+        return n;
+      }
+      ParkUntilNotEmpty();
+    }
+  }
+
+  // BoundedQueue::TryPushN()
+  //
+  // Enqueues a prefix of `values` (moving from those elements) without
+  // blocking, claiming as many consecutive free slots as are available.
+  // Returns the number enqueued; callers should follow a nonzero return
+  // with their own batching logic rather than assuming all were taken.
+  size_t TryPushN(absl::Span<T> values) {
+    if (values.empty()) return 0;
+    uint64_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+    size_t n;
+    for (;;) {
+      n = 0;
+      bool stale = false;
+      while (n < values.size()) {
+        const uint64_t seq =
+            slots_[(pos + n) & mask_].seq.load(std::memory_order_acquire);
+        const int64_t dif = static_cast<int64_t>(seq - (pos + n));
+        if (dif != 0) {
+          stale = dif > 0;  // another producer advanced enqueue_pos_
+          break;
+        }
+        ++n;
+      }
+      if (n == 0) {
+        if (!stale) return 0;  // full
+        pos = enqueue_pos_.load(std::memory_order_relaxed);
+        continue;
+      }
+      if (enqueue_pos_.compare_exchange_weak(pos, pos + n,
+                                             std::memory_order_relaxed)) {
+        break;
+      }
+      // `pos` was reloaded by the failed compare-exchange.
+    }
+    for (size_t i = 0; i < n; ++i) {
+      Slot& slot = slots_[(pos + i) & mask_];
+      ::new (static_cast<void*>(slot.storage)) T(std::move(values[i]));
+      slot.seq.store(pos + i + 1, std::memory_order_release);
+    }
+    return n;
+  }
+
+  // BoundedQueue::TryPopN()
+  //
+  // Dequeues up to `out.size()` elements into `out` without blocking.
+  // Returns the number dequeued.
+  size_t TryPopN(absl::Span<T> out) {
+    if (out.empty()) return 0;
+    uint64_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+    size_t n;
+    for (;;) {
+      n = 0;
+      bool stale = false;
+      while (n < out.size()) {
+        const uint64_t seq =
+            slots_[(pos + n) & mask_].seq.load(std::memory_order_acquire);
+        const int64_t dif = static_cast<int64_t>(seq - (pos + n + 1));
+        if (dif != 0) {
+          stale = dif > 0;  // another consumer advanced dequeue_pos_
+          break;
+        }
+        ++n;
+      }
+      if (n == 0) {
+        if (!stale) return 0;  // empty
+        pos = dequeue_pos_.load(std::memory_order_relaxed);
+        continue;
+      }
+      if (dequeue_pos_.compare_exchange_weak(pos, pos + n,
+                                             std::memory_order_relaxed)) {
+        break;
+      }
+    }
+    for (size_t i = 0; i < n; ++i) {
+      Slot& slot = slots_[(pos + i) & mask_];
+      out[i] = std::move(*slot.element());
+      RetireDequeuedSlot(&slot, pos + i);
+    }
+    WakeProducers();
+    return n;
+  }
+
+ private:
+  struct Slot {
+    std::atomic<uint64_t> seq;
+    alignas(T) unsigned char storage[sizeof(T)];
+
+    T* element() { return reinterpret_cast<T*>(storage); }
+  };
+
+  // Claims the slot at dequeue_pos_ if an element is ready, returning it
+  // (with its position in `*claimed_pos`) or nullptr if the queue is empty.
+  Slot* TryClaimDequeueSlot(uint64_t* claimed_pos) {
+    uint64_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+    for (;;) {
+      Slot& slot = slots_[pos & mask_];
+      const uint64_t seq = slot.seq.load(std::memory_order_acquire);
+      const int64_t dif = static_cast<int64_t>(seq - (pos + 1));
+      if (dif < 0) return nullptr;  // empty
+      if (dif > 0) {
+        pos = dequeue_pos_.load(std::memory_order_relaxed);
+        continue;
+      }
+      if (dequeue_pos_.compare_exchange_weak(pos, pos + 1,
+                                             std::memory_order_relaxed)) {
+        *claimed_pos = pos;
+        return &slot;
+      }
+    }
+  }
+
+  // Destroys the claimed slot's element and marks the slot free for the
+  // producer one lap ahead.
+  void RetireDequeuedSlot(Slot* slot, uint64_t pos) {
+    slot->element()->~T();
+    slot->seq.store(pos + mask_ + 1, std::memory_order_release);
+  }
+
+  // Condition functions for parked threads. They only read; a parked thread
+  // retries its claim after waking, so a stale true is harmless.
+  static bool SpaceAvailable(BoundedQueue* q) {
+    const uint64_t pos = q->enqueue_pos_.load(std::memory_order_relaxed);
+    const uint64_t seq =
+        q->slots_[pos & q->mask_].seq.load(std::memory_order_acquire);
+    return static_cast<int64_t>(seq - pos) >= 0;
+  }
+  static bool DataAvailable(BoundedQueue* q) {
+    const uint64_t pos = q->dequeue_pos_.load(std::memory_order_relaxed);
+    const uint64_t seq =
+        q->slots_[pos & q->mask_].seq.load(std::memory_order_acquire);
+    return static_cast<int64_t>(seq - (pos + 1)) >= 0;
+  }
+
+  // Parking and waking. The mutexes exist only to sleep on: fast paths never
+  // lock them, and a waker merely locks and unlocks to make sleepers
+  // re-evaluate their condition. The seq_cst fences close the classic race
+  // where a waker reads the waiter count before the waiter's increment while
+  // the waiter reads the slot state before the waker's update: one of the
+  // two observations is guaranteed to happen.
+  void ParkUntilNotFull() {
+    waiting_producers_.fetch_add(1, std::memory_order_seq_cst);
+    {
+      absl::MutexLock l(&not_full_mu_);
+      not_full_mu_.Await(absl::Condition(&BoundedQueue::SpaceAvailable, this));
+    }
+    waiting_producers_.fetch_sub(1, std::memory_order_relaxed);
+  }
+  void ParkUntilNotEmpty() {
+    waiting_consumers_.fetch_add(1, std::memory_order_seq_cst);
+    {
+      absl::MutexLock l(&not_empty_mu_);
+      not_empty_mu_.Await(absl::Condition(&BoundedQueue::DataAvailable, this));
+    }
+    waiting_consumers_.fetch_sub(1, std::memory_order_relaxed);
+  }
+  void WakeProducers() {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (ABSL_PREDICT_FALSE(
+            waiting_producers_.load(std::memory_order_relaxed) > 0)) {
+      absl::MutexLock l(&not_full_mu_);
+    }
+  }
+  void WakeConsumers() {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (ABSL_PREDICT_FALSE(
+            waiting_consumers_.load(std::memory_order_relaxed) > 0)) {
+      absl::MutexLock l(&not_empty_mu_);
+    }
+  }
+
+  std::unique_ptr<Slot[]> slots_;
+  uint64_t mask_;
+  // The two claim cursors and the waiter counts live on their own cache
+  // lines so producers and consumers do not false share.
+  alignas(ABSL_CACHELINE_SIZE) std::atomic<uint64_t> enqueue_pos_{0};
+  alignas(ABSL_CACHELINE_SIZE) std::atomic<uint64_t> dequeue_pos_{0};
+  alignas(ABSL_CACHELINE_SIZE) std::atomic<int64_t> waiting_producers_{0};
+  std::atomic<int64_t> waiting_consumers_{0};
+  absl::Mutex not_full_mu_;
+  absl::Mutex not_empty_mu_;
+};
+
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_SYNCHRONIZATION_BOUNDED_QUEUE_H_
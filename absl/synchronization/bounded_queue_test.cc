@@ -0,0 +1,159 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/synchronization/bounded_queue.h"
+
+#include <atomic>
+#include <memory>
+#include <thread>  // NOLINT(build/c++11)
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "absl/synchronization/notification.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+
+namespace {
+
+TEST(BoundedQueue, PushPopSingleThread) {
+  absl::BoundedQueue<int> queue(4);
+  EXPECT_EQ(queue.capacity(), 4);
+
+  queue.Push(1);
+  queue.Push(2);
+  queue.Push(3);
+  EXPECT_EQ(queue.Pop(), 1);
+  EXPECT_EQ(queue.Pop(), 2);
+  EXPECT_EQ(queue.Pop(), 3);
+
+  int out = -1;
+  EXPECT_FALSE(queue.TryPop(&out));
+}
+
+TEST(BoundedQueue, CapacityRoundsUpToPowerOfTwo) {
+  absl::BoundedQueue<int> rounded(5);
+  EXPECT_EQ(rounded.capacity(), 8);
+  absl::BoundedQueue<int> minimum(1);
+  EXPECT_EQ(minimum.capacity(), 2);
+}
+
+TEST(BoundedQueue, TryPushFailsWhenFull) {
+  absl::BoundedQueue<int> queue(2);
+  EXPECT_TRUE(queue.TryPush(1));
+  EXPECT_TRUE(queue.TryPush(2));
+  EXPECT_FALSE(queue.TryPush(3));
+  EXPECT_EQ(queue.Pop(), 1);
+  EXPECT_TRUE(queue.TryPush(3));
+}
+
+TEST(BoundedQueue, BatchedPushPop) {
+  absl::BoundedQueue<int> queue(8);
+  std::vector<int> in = {1, 2, 3, 4, 5};
+  queue.PushN(absl::MakeSpan(in));
+
+  std::vector<int> out(8, 0);
+  EXPECT_EQ(queue.TryPopN(absl::MakeSpan(out)), 5);
+  for (int i = 0; i < 5; ++i) EXPECT_EQ(out[i], i + 1);
+  EXPECT_EQ(queue.TryPopN(absl::MakeSpan(out)), 0);
+}
+
+TEST(BoundedQueue, PushBlocksWhileFull) {
+  absl::BoundedQueue<int> queue(2);
+  queue.Push(1);
+  queue.Push(2);
+  std::atomic<bool> pushed(false);
+
+  std::thread producer([&] {
+    queue.Push(3);
+    pushed.store(true);
+  });
+  absl::SleepFor(absl::Milliseconds(100));
+  EXPECT_FALSE(pushed.load());
+  EXPECT_EQ(queue.Pop(), 1);
+  producer.join();
+  EXPECT_TRUE(pushed.load());
+  EXPECT_EQ(queue.Pop(), 2);
+  EXPECT_EQ(queue.Pop(), 3);
+}
+
+TEST(BoundedQueue, PopBlocksWhileEmpty) {
+  absl::BoundedQueue<int> queue(4);
+  std::atomic<bool> popped(false);
+
+  std::thread consumer([&] {
+    EXPECT_EQ(queue.Pop(), 7);
+    popped.store(true);
+  });
+  absl::SleepFor(absl::Milliseconds(100));
+  EXPECT_FALSE(popped.load());
+  queue.Push(7);
+  consumer.join();
+  EXPECT_TRUE(popped.load());
+}
+
+TEST(BoundedQueue, DestructorDestroysRemainingElements) {
+  std::shared_ptr<int> tracked = std::make_shared<int>(42);
+  {
+    absl::BoundedQueue<std::shared_ptr<int>> queue(4);
+    queue.Push(tracked);
+    queue.Push(tracked);
+    EXPECT_EQ(tracked.use_count(), 3);
+  }
+  EXPECT_EQ(tracked.use_count(), 1);
+}
+
+TEST(BoundedQueue, StressManyProducersManyConsumers) {
+  // Every value pushed must be popped exactly once, across a queue small
+  // enough that both full and empty parking paths are exercised.
+  constexpr int kNumProducers = 4;
+  constexpr int kNumConsumers = 4;
+  constexpr int kPerProducer = 20000;
+  absl::BoundedQueue<int> queue(64);
+
+  std::vector<std::atomic<int>> seen(kNumProducers * kPerProducer);
+  for (auto& s : seen) s.store(0);
+  std::atomic<int> remaining(kNumProducers * kPerProducer);
+
+  std::vector<std::thread> threads;
+  for (int p = 0; p < kNumProducers; ++p) {
+    threads.push_back(std::thread([&, p] {
+      for (int i = 0; i < kPerProducer; ++i) {
+        queue.Push(p * kPerProducer + i);
+      }
+    }));
+  }
+  for (int c = 0; c < kNumConsumers; ++c) {
+    threads.push_back(std::thread([&] {
+      int batch[16];
+      while (remaining.load(std::memory_order_relaxed) > 0) {
+        size_t n = queue.TryPopN(absl::MakeSpan(batch, 16));
+        if (n == 0) {
+          int v;
+          if (!queue.TryPop(&v)) continue;
+          n = 1;
+          batch[0] = v;
+        }
+        for (size_t i = 0; i < n; ++i) {
+          seen[batch[i]].fetch_add(1, std::memory_order_relaxed);
+        }
+        remaining.fetch_sub(static_cast<int>(n), std::memory_order_relaxed);
+      }
+    }));
+  }
+  for (std::thread& t : threads) t.join();
+
+  for (const auto& s : seen) EXPECT_EQ(s.load(), 1);
+}
+
+}  // namespace
@@ -0,0 +1,105 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/synchronization/defer_destroy.h"
+
+#include <cstdint>
+#include <deque>
+#include <thread>  // NOLINT(build/c++11)
+
+#include "absl/base/config.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/synchronization/mutex.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+namespace synchronization_internal {
+namespace {
+
+struct PendingDestruction {
+  void* object;
+  void (*destroy)(void*);
+};
+
+// The queue feeding the reclamation thread. Leaked rather than destroyed so
+// that enqueues during static destruction remain safe; the thread itself is
+// detached and dies with the process.
+class ReclamationQueue {
+ public:
+  static ReclamationQueue& Instance() {
+    static ReclamationQueue* queue = new ReclamationQueue;
+    return *queue;
+  }
+
+  void Enqueue(void* object, void (*destroy)(void*)) {
+    absl::MutexLock lock(&mu_);
+    pending_.push_back(PendingDestruction{object, destroy});
+    ++enqueued_;
+    if (!worker_started_) {
+      worker_started_ = true;
+      std::thread(&ReclamationQueue::WorkerLoop, this).detach();
+    }
+  }
+
+  // Blocks until everything enqueued before the call has been destroyed.
+  void Flush() {
+    absl::MutexLock lock(&mu_);
+    const uint64_t target = enqueued_;
+    auto done = [this, target]() {
+      mu_.AssertReaderHeld();  // For annotalysis.
+      return destroyed_ >= target;
+    };
+    mu_.Await(absl::Condition(&done));
+  }
+
+ private:
+  ReclamationQueue() = default;
+
+  void WorkerLoop() {
+    while (true) {
+      mu_.LockWhen(absl::Condition(
+          +[](std::deque<PendingDestruction>* q) { return !q->empty(); },
+          &pending_));
+      PendingDestruction item = pending_.front();
+      pending_.pop_front();
+      mu_.Unlock();
+      // Destroy outside the lock: destructors of large containers run for a
+      // long time and may themselves call DeferDestroy().
+      item.destroy(item.object);
+      absl::MutexLock lock(&mu_);
+      ++destroyed_;
+    }
+  }
+
+  absl::Mutex mu_;
+  std::deque<PendingDestruction> pending_ ABSL_GUARDED_BY(mu_);
+  uint64_t enqueued_ ABSL_GUARDED_BY(mu_) = 0;
+  uint64_t destroyed_ ABSL_GUARDED_BY(mu_) = 0;
+  bool worker_started_ ABSL_GUARDED_BY(mu_) = false;
+};
+
+}  // namespace
+
+void EnqueueDeferredDestruction(void* object, void (*destroy)(void*)) {
+  ReclamationQueue::Instance().Enqueue(object, destroy);
+}
+
+}  // namespace synchronization_internal
+
+void FlushDeferredDestructions() {
+  synchronization_internal::ReclamationQueue::Instance().Flush();
+}
+
+ABSL_NAMESPACE_END
+}  // namespace absl
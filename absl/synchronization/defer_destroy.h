@@ -0,0 +1,91 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// -----------------------------------------------------------------------------
+// defer_destroy.h
+// -----------------------------------------------------------------------------
+//
+// `absl::DeferDestroy()` moves an object onto a shared background
+// reclamation thread to be destroyed there. Destroying a container with
+// millions of elements runs every element destructor and returns every
+// allocation inline, which can stall the destroying thread for hundreds of
+// milliseconds; code that swaps large snapshots at request or epoch
+// boundaries can hand the old snapshot to `DeferDestroy()` and return
+// immediately:
+//
+//   absl::flat_hash_map<uint64_t, Row> old = std::exchange(index_, fresh);
+//   absl::DeferDestroy(std::move(old));   // returns without destroying
+//
+// Deferred objects are destroyed one at a time, in order, on a single
+// detached background thread that is started on first use, so reclamation is
+// naturally rate limited and never runs concurrently with itself. The
+// trade-off is memory: an enqueued object stays fully allocated until the
+// background thread reaches it. Callers producing garbage faster than one
+// thread can free it should destroy inline instead — this facility shifts
+// destruction cost off the critical thread; it does not reduce it.
+//
+// At process exit the background thread is not joined; objects still queued
+// are reclaimed by the operating system without their destructors running.
+// Do not defer objects whose destructors have external effects (flushing
+// files, releasing remote leases). `FlushDeferredDestructions()` blocks
+// until everything enqueued so far has been destroyed, for callers who need
+// a barrier (for example before unloading state the destructors touch).
+
+#ifndef ABSL_SYNCHRONIZATION_DEFER_DESTROY_H_
+#define ABSL_SYNCHRONIZATION_DEFER_DESTROY_H_
+
+#include <type_traits>
+#include <utility>
+
+#include "absl/base/config.h"
+#include "absl/meta/type_traits.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+namespace synchronization_internal {
+
+// Moves the pointed-to object onto the background reclamation thread.
+// `destroy` must delete `object`.
+void EnqueueDeferredDestruction(void* object, void (*destroy)(void*));
+
+}  // namespace synchronization_internal
+
+// DeferDestroy()
+//
+// Moves `object` onto the background reclamation thread, returning as soon
+// as the (cheap) move completes. The moved-from `object` is left in its
+// type's usual moved-from state.
+template <typename T>
+void DeferDestroy(T&& object) {
+  using V = absl::decay_t<T>;
+  static_assert(std::is_rvalue_reference<T&&>::value,
+                "DeferDestroy takes ownership; pass std::move(object)");
+  static_assert(std::is_move_constructible<V>::value,
+                "DeferDestroy requires a move-constructible type");
+  synchronization_internal::EnqueueDeferredDestruction(
+      new V(std::move(object)),
+      [](void* p) { delete static_cast<V*>(p); });
+}
+
+// FlushDeferredDestructions()
+//
+// Blocks until every object passed to `DeferDestroy()` before this call has
+// been destroyed.
+void FlushDeferredDestructions();
+
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_SYNCHRONIZATION_DEFER_DESTROY_H_
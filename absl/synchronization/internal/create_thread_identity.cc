@@ -99,6 +99,7 @@ static void ResetThreadIdentityBetweenReuse(
   identity->ticker.store(0, std::memory_order_relaxed);
   identity->wait_start.store(0, std::memory_order_relaxed);
   identity->is_idle.store(false, std::memory_order_relaxed);
+  for (void*& slot : identity->user_slots) slot = nullptr;
   identity->next = nullptr;
 }
 
@@ -50,6 +50,10 @@
 
 #ifdef ABSL_INTERNAL_HAVE_FUTEX
 
+// Priority-inheritance futex operations (FUTEX_LOCK_PI et al.) have been
+// supported since Linux 2.6.18, which predates the operations required above.
+#define ABSL_INTERNAL_HAVE_FUTEX_PI
+
 namespace absl {
 ABSL_NAMESPACE_BEGIN
 namespace synchronization_internal {
@@ -72,6 +76,12 @@ namespace synchronization_internal {
 #ifndef FUTEX_BITSET_MATCH_ANY
 #define FUTEX_BITSET_MATCH_ANY 0xFFFFFFFF
 #endif
+#ifndef FUTEX_LOCK_PI
+#define FUTEX_LOCK_PI 6
+#endif
+#ifndef FUTEX_UNLOCK_PI
+#define FUTEX_UNLOCK_PI 7
+#endif
 #endif
 
 #if defined(__NR_futex_time64) && !defined(SYS_futex_time64)
@@ -135,6 +145,34 @@ class FutexImpl {
     return 0;
   }
 
+  // Acquires the priority-inheritance futex at `v`.  The futex word holds
+  // the TID of the owning thread, or zero when unlocked; callers take the
+  // uncontended lock with a compare-and-swap of zero to their own TID and
+  // call this only on contention.  While the caller sleeps, the kernel lends
+  // the caller's priority to the owner.  Returns 0 once the calling thread
+  // owns the lock, with the kernel having updated the futex word.
+  static int LockPi(std::atomic<int32_t>* v) {
+    auto err = syscall(SYS_futex, reinterpret_cast<int32_t*>(v),
+                       FUTEX_LOCK_PI | FUTEX_PRIVATE_FLAG, 0, nullptr);
+    if (err != 0) {
+      return -errno;
+    }
+    return 0;
+  }
+
+  // Releases the priority-inheritance futex at `v`, handing the lock to the
+  // highest-priority waiter.  Call this only when the kernel has flagged
+  // waiters in the futex word; an uncontended unlock is a compare-and-swap
+  // of the caller's TID back to zero.
+  static int UnlockPi(std::atomic<int32_t>* v) {
+    auto err = syscall(SYS_futex, reinterpret_cast<int32_t*>(v),
+                       FUTEX_UNLOCK_PI | FUTEX_PRIVATE_FLAG);
+    if (err != 0) {
+      return -errno;
+    }
+    return 0;
+  }
+
   // Wakes at most `count` waiters that have entered the sleep state on `v`.
   static int Wake(std::atomic<int32_t>* v, int32_t count) {
     auto err = syscall(SYS_futex, reinterpret_cast<int32_t*>(v),
@@ -19,6 +19,7 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>  // NOLINT(build/c++11)
 #include <cstdint>
 #include <cstdlib>
@@ -29,6 +30,7 @@
 #include "absl/base/attributes.h"
 #include "absl/base/call_once.h"
 #include "absl/base/config.h"
+#include "absl/base/optimization.h"
 #include "absl/time/time.h"
 
 namespace absl {
@@ -40,10 +42,34 @@ constexpr uint64_t KernelTimeout::kNoTimeout;
 constexpr int64_t KernelTimeout::kMaxNanos;
 #endif
 
+#if defined(CLOCK_MONOTONIC_COARSE)
+// See KernelTimeout::SetUseCoarseClock(). The coarse clock shares
+// CLOCK_MONOTONIC's epoch (it is a cached reading of it), so a timeout
+// converted with one clock and re-checked with the other is off by at most
+// one coarse tick.
+ABSL_CONST_INIT static std::atomic<bool> use_coarse_clock{false};
+#endif
+
+void KernelTimeout::SetUseCoarseClock(bool enabled) {
+#if defined(CLOCK_MONOTONIC_COARSE)
+  use_coarse_clock.store(enabled, std::memory_order_relaxed);
+#else
+  static_cast<void>(enabled);
+#endif
+}
+
 int64_t KernelTimeout::SteadyClockNow() {
   if (!SupportsSteadyClock()) {
     return absl::GetCurrentTimeNanos();
   }
+#if defined(CLOCK_MONOTONIC_COARSE)
+  if (ABSL_PREDICT_FALSE(use_coarse_clock.load(std::memory_order_relaxed))) {
+    struct timespec ts;
+    if (clock_gettime(CLOCK_MONOTONIC_COARSE, &ts) == 0) {
+      return int64_t{ts.tv_sec} * 1000 * 1000 * 1000 + ts.tv_nsec;
+    }
+  }
+#endif
   return std::chrono::duration_cast<std::chrono::nanoseconds>(
              std::chrono::steady_clock::now().time_since_epoch())
       .count();
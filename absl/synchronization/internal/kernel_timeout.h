@@ -133,6 +133,16 @@ class KernelTimeout {
   // thus requires we use the system (aka walltime) clock.
   static constexpr bool SupportsSteadyClock() { return true; }
 
+  // When enabled, relative timeouts read the kernel's coarse monotonic clock
+  // (CLOCK_MONOTONIC_COARSE, a cached value updated once per tick) instead of
+  // the precise one, so constructing and re-checking a timed wait performs no
+  // hardware clock read. Timeouts may then fire up to one tick (typically
+  // 1-10ms) early or late, which is a good trade for workloads issuing many
+  // timed waits with deadlines far coarser than that. No-op on platforms
+  // without a coarse clock. May be toggled at any time; timeouts in flight
+  // across a toggle are subject to the same one-tick skew.
+  static void SetUseCoarseClock(bool enabled);
+
  private:
   // Returns the current time, expressed as a count of nanoseconds since the
   // epoch used by an arbitrary clock. The implementation tries to use a steady
@@ -393,4 +393,31 @@ TEST(KernelTimeout, OverflowNanos) {
   EXPECT_GT(t.ToChronoDuration(), std::chrono::hours(100000));
 }
 
+TEST(KernelTimeout, CoarseClockMode) {
+  // With the coarse clock enabled, timeouts may be off by a kernel tick
+  // (typically up to 10ms) in addition to the usual timing slop.
+  const absl::Duration kCoarseBound = absl::Milliseconds(20) + kTimingBound;
+
+  KernelTimeout::SetUseCoarseClock(true);
+  KernelTimeout rel(absl::Milliseconds(100));
+  EXPECT_TRUE(rel.has_timeout());
+  EXPECT_TRUE(rel.is_relative_timeout());
+  EXPECT_LE(
+      absl::AbsDuration(absl::DurationFromTimespec(rel.MakeRelativeTimespec()) -
+                        absl::Milliseconds(100)),
+      kCoarseBound);
+  EXPECT_LE(absl::AbsDuration(absl::FromUnixNanos(rel.MakeAbsNanos()) -
+                              (absl::Now() + absl::Milliseconds(100))),
+            kCoarseBound);
+
+  // Absolute timeouts do not involve the steady clock at construction and
+  // must be unaffected.
+  KernelTimeout abs(absl::Now() + absl::Milliseconds(100));
+  EXPECT_TRUE(abs.is_absolute_timeout());
+  EXPECT_LE(absl::AbsDuration(absl::FromUnixNanos(abs.MakeAbsNanos()) -
+                              (absl::Now() + absl::Milliseconds(100))),
+            kCoarseBound);
+  KernelTimeout::SetUseCoarseClock(false);
+}
+
 }  // namespace
@@ -58,8 +58,21 @@
 #include "absl/debugging/symbolize.h"
 #include "absl/synchronization/internal/graphcycles.h"
 #include "absl/synchronization/internal/per_thread_sem.h"
+#include "absl/synchronization/mutex_contention_profile.h"
 #include "absl/time/time.h"
 
+// The callsite key for the built-in contention profile; see
+// mutex_contention_profile.h. Evaluated in Lock()/ReaderLock(), whose return
+// address is the user's acquisition site.
+#if defined(__GNUC__) || ABSL_HAVE_BUILTIN(__builtin_return_address)
+#define ABSL_MUTEX_PROFILE_CALLSITE() __builtin_return_address(0)
+#elif defined(_MSC_VER)
+#include <intrin.h>
+#define ABSL_MUTEX_PROFILE_CALLSITE() _ReturnAddress()
+#else
+#define ABSL_MUTEX_PROFILE_CALLSITE() static_cast<void*>(nullptr)
+#endif
+
 using absl::base_internal::CurrentThreadIdentityIfPresent;
 using absl::base_internal::CycleClock;
 using absl::base_internal::PerThreadSynch;
@@ -91,6 +104,9 @@ constexpr OnDeadlockCycle kDeadlockDetectionDefault = OnDeadlockCycle::kAbort;
 
 ABSL_CONST_INIT std::atomic<OnDeadlockCycle> synch_deadlock_detection(
     kDeadlockDetectionDefault);
+// Nonzero enables batched deadlock-graph updates; see
+// SetMutexDeadlockDetectionBatchSize().
+ABSL_CONST_INIT std::atomic<int> synch_deadlock_batch_size(0);
 ABSL_CONST_INIT std::atomic<bool> synch_check_invariants(false);
 
 ABSL_INTERNAL_ATOMIC_HOOK_ATTRIBUTES
@@ -790,6 +806,11 @@ void SetMutexDeadlockDetectionMode(OnDeadlockCycle mode) {
   synch_deadlock_detection.store(mode, std::memory_order_release);
 }
 
+void SetMutexDeadlockDetectionBatchSize(int batch_size) {
+  if (batch_size < 0) batch_size = 0;
+  synch_deadlock_batch_size.store(batch_size, std::memory_order_release);
+}
+
 // Return true iff threads x and y are part of the same equivalence
 // class of waiters. An equivalence class is defined as the set of
 // waiters with the same condition, type of lock, and thread priority.
@@ -1368,6 +1389,76 @@ struct ScopedDeadlockReportBuffers {
 int GetStack(void** stack, int max_depth) {
   return absl::GetStackTrace(stack, max_depth, 3);
 }
+
+#ifdef ABSL_HAVE_THREAD_LOCAL
+// Reports a cycle found while folding the buffered acquires-before edge
+// `from` -> `to` into the deadlock graph. Unlike the immediate-mode report
+// this runs at flush time, so the acquiring stack and held-lock list are no
+// longer available; the cycle's mutexes are still named.
+void ReportBatchedDeadlock(GraphId from, GraphId to)
+    ABSL_EXCLUSIVE_LOCKS_REQUIRED(deadlock_graph_mu) {
+  ScopedDeadlockReportBuffers scoped_buffers;
+  DeadlockReportBuffers* b = scoped_buffers.b;
+  ABSL_RAW_LOG(ERROR,
+               "Potential Mutex deadlock found in batched lock-ordering graph "
+               "update: mutex %p was acquired while holding %p; a cycle in "
+               "the historical lock ordering graph has been observed",
+               deadlock_graph->Ptr(to), deadlock_graph->Ptr(from));
+  ABSL_RAW_LOG(ERROR, "Cycle: ");
+  int path_len =
+      deadlock_graph->FindPath(to, from, ABSL_ARRAYSIZE(b->path), b->path);
+  for (int j = 0; j != path_len && j != ABSL_ARRAYSIZE(b->path); j++) {
+    Mutex* path_mu = static_cast<Mutex*>(deadlock_graph->Ptr(b->path[j]));
+    if (path_mu == nullptr) continue;
+    ABSL_RAW_LOG(ERROR, "mutex@%p", static_cast<void*>(path_mu));
+  }
+  if (path_len > static_cast<int>(ABSL_ARRAYSIZE(b->path))) {
+    ABSL_RAW_LOG(ERROR, "(long cycle; list truncated)");
+  }
+  if (synch_deadlock_detection.load(std::memory_order_acquire) ==
+      OnDeadlockCycle::kAbort) {
+    deadlock_graph_mu.Unlock();  // avoid deadlock in fatal sighandler
+    ABSL_RAW_LOG(FATAL, "dying due to potential deadlock");
+  }
+}
+
+// Thread-local buffer of acquires-before edges not yet folded into the
+// deadlock graph, used when SetMutexDeadlockDetectionBatchSize() has enabled
+// batched updates. The already-flushed prefix is retained as a deduplication
+// cache, so re-acquisitions in an already-recorded order touch no global
+// state at all.
+struct DeadlockEdgeBuffer {
+  static constexpr int kCapacity = 64;
+  int num_edges = 0;    // valid entries
+  int num_flushed = 0;  // prefix already inserted into the graph
+  GraphId from[kCapacity];
+  GraphId to[kCapacity];
+  ~DeadlockEdgeBuffer();
+};
+
+void FlushDeadlockEdges(DeadlockEdgeBuffer* buf)
+    ABSL_LOCKS_EXCLUDED(deadlock_graph_mu) {
+  if (buf->num_edges == buf->num_flushed) return;
+  deadlock_graph_mu.Lock();
+  if (deadlock_graph != nullptr) {
+    for (int i = buf->num_flushed; i != buf->num_edges; i++) {
+      // Expired ids (from since-destroyed mutexes) are tolerated and
+      // ignored by InsertEdge().
+      if (!deadlock_graph->InsertEdge(buf->from[i], buf->to[i])) {
+        ReportBatchedDeadlock(buf->from[i], buf->to[i]);  // may not return
+      }
+    }
+  }
+  deadlock_graph_mu.Unlock();
+  buf->num_flushed = buf->num_edges;
+}
+
+// Edges buffered by a thread that exits before its next flush still matter;
+// fold them in from the thread-local destructor.
+DeadlockEdgeBuffer::~DeadlockEdgeBuffer() { FlushDeadlockEdges(this); }
+
+thread_local DeadlockEdgeBuffer deadlock_edge_buffer;
+#endif  // ABSL_HAVE_THREAD_LOCAL
 }  // anonymous namespace
 
 // Called in debug mode when a thread is about to acquire a lock in a way that
@@ -1380,6 +1471,45 @@ static GraphId DeadlockCheck(Mutex* mu) {
 
   SynchLocksHeld* all_locks = Synch_GetAllLocks();
 
+#ifdef ABSL_HAVE_THREAD_LOCAL
+  const int batch_size =
+      synch_deadlock_batch_size.load(std::memory_order_acquire);
+  if (batch_size > 0) {
+    // Batched mode: record this acquisition's edges in the thread-local
+    // buffer instead of updating the graph under the global lock. The global
+    // lock is taken only briefly for the id lookup and, amortized, once per
+    // `batch_size` previously unseen edges.
+    const GraphId mu_id = GetGraphId(mu);
+    if (all_locks->n == 0) return mu_id;
+    DeadlockEdgeBuffer* buf = &deadlock_edge_buffer;
+    for (int i = 0; i != all_locks->n; i++) {
+      const GraphId other_node_id = all_locks->locks[i].id;
+      if (other_node_id == mu_id) continue;
+      bool buffered = false;
+      for (int j = 0; j != buf->num_edges; j++) {
+        if (buf->from[j] == other_node_id && buf->to[j] == mu_id) {
+          buffered = true;
+          break;
+        }
+      }
+      if (buffered) continue;
+      if (buf->num_edges == DeadlockEdgeBuffer::kCapacity) {
+        // Buffer full: fold everything in and restart the dedup cache.
+        FlushDeadlockEdges(buf);
+        buf->num_edges = 0;
+        buf->num_flushed = 0;
+      }
+      buf->from[buf->num_edges] = other_node_id;
+      buf->to[buf->num_edges] = mu_id;
+      buf->num_edges++;
+    }
+    if (buf->num_edges - buf->num_flushed >= batch_size) {
+      FlushDeadlockEdges(buf);
+    }
+    return mu_id;
+  }
+#endif  // ABSL_HAVE_THREAD_LOCAL
+
   absl::base_internal::SpinLockHolder lock(&deadlock_graph_mu);
   const GraphId mu_id = GetGraphIdLocked(mu);
 
@@ -1532,7 +1662,16 @@ void Mutex::Lock() {
           std::memory_order_relaxed))) {
     // try spin acquire, then slow loop
     if (ABSL_PREDICT_FALSE(!TryAcquireWithSpinning(&this->mu_))) {
-      this->LockSlow(kExclusive, nullptr, 0);
+      if (ABSL_PREDICT_FALSE(
+              synchronization_internal::ShouldSampleMutexContention())) {
+        const int64_t contention_start_cycles = CycleClock::Now();
+        this->LockSlow(kExclusive, nullptr, 0);
+        synchronization_internal::RecordMutexContentionSample(
+            ABSL_MUTEX_PROFILE_CALLSITE(),
+            CycleClock::Now() - contention_start_cycles);
+      } else {
+        this->LockSlow(kExclusive, nullptr, 0);
+      }
     }
   }
   DebugOnlyLockEnter(this, id);
@@ -1546,7 +1685,16 @@ void Mutex::ReaderLock() {
   for (;;) {
     // If there are non-readers holding the lock, use the slow loop.
     if (ABSL_PREDICT_FALSE(v & (kMuWriter | kMuWait | kMuEvent)) != 0) {
-      this->LockSlow(kShared, nullptr, 0);
+      if (ABSL_PREDICT_FALSE(
+              synchronization_internal::ShouldSampleMutexContention())) {
+        const int64_t contention_start_cycles = CycleClock::Now();
+        this->LockSlow(kShared, nullptr, 0);
+        synchronization_internal::RecordMutexContentionSample(
+            ABSL_MUTEX_PROFILE_CALLSITE(),
+            CycleClock::Now() - contention_start_cycles);
+      } else {
+        this->LockSlow(kShared, nullptr, 0);
+      }
       break;
     }
     // We can avoid the loop and only use the CAS when the lock is free or
@@ -2695,6 +2843,60 @@ void CondVar::Signal() {
   ABSL_TSAN_MUTEX_POST_SIGNAL(nullptr, 0);
 }
 
+void CondVar::SignalN(int n) {
+  if (n <= 0) {
+    return;
+  }
+  SchedulingGuard::ScopedDisable disable_rescheduling;
+  ABSL_TSAN_MUTEX_PRE_SIGNAL(nullptr, 0);
+  intptr_t v;
+  int c = 0;
+  for (v = cv_.load(std::memory_order_relaxed); v != 0;
+       v = cv_.load(std::memory_order_relaxed)) {
+    if ((v & kCvSpin) == 0 &&  // attempt to acquire spinlock
+        cv_.compare_exchange_strong(v, v | kCvSpin, std::memory_order_acquire,
+                                    std::memory_order_relaxed)) {
+      PerThreadSynch* h = reinterpret_cast<PerThreadSynch*>(v & ~kCvLow);
+      // Detach the first n waiters (h is the last waiter; h->next the first).
+      PerThreadSynch* first = nullptr;
+      PerThreadSynch* last = nullptr;
+      if (h != nullptr) {
+        first = h->next;
+        last = first;
+        for (int k = 1; last != h && k < n; ++k) {
+          last = last->next;
+        }
+        if (last == h) {
+          h = nullptr;  // took every waiter
+        } else {
+          h->next = last->next;
+        }
+      }
+      // release spinlock
+      cv_.store((v & kCvEvent) | reinterpret_cast<intptr_t>(h),
+                std::memory_order_release);
+      if (first != nullptr) {
+        PerThreadSynch* w;
+        PerThreadSynch* next = first;
+        do {  // wake each detached waiter
+          w = next;
+          next = next->next;  // read before Fer() reuses the link
+          w->waitp->cvmu->Fer(w);
+        } while (w != last);
+        cond_var_tracer("SignalN wakeup", this);
+      }
+      if ((v & kCvEvent) != 0) {
+        PostSynchEvent(this, SYNCH_EV_SIGNAL);
+      }
+      ABSL_TSAN_MUTEX_POST_SIGNAL(nullptr, 0);
+      return;
+    } else {
+      c = synchronization_internal::MutexDelay(c, GENTLE);
+    }
+  }
+  ABSL_TSAN_MUTEX_POST_SIGNAL(nullptr, 0);
+}
+
 void CondVar::SignalAll() {
   ABSL_TSAN_MUTEX_PRE_SIGNAL(nullptr, 0);
   intptr_t v;
@@ -967,6 +967,16 @@ class CondVar {
   // Signal this `CondVar`; wake at least one waiter if one exists.
   void Signal();
 
+  // CondVar::SignalN()
+  //
+  // Signal this `CondVar`; wake at least `n` waiters if that many exist,
+  // otherwise wake all waiters. Equivalent to calling `Signal()` `n` times,
+  // but removes the waiters under a single acquisition of the internal
+  // wait-list lock, so producers that know how many items arrived can avoid
+  // both the futile wakeups of `SignalAll()` and `n` separate lock rounds.
+  // `n <= 0` is a no-op.
+  void SignalN(int n);
+
   // CondVar::SignalAll()
   //
   // Signal this `CondVar`; wake all waiters.
@@ -1203,6 +1213,20 @@ enum class OnDeadlockCycle {
 // the manner chosen here.
 void SetMutexDeadlockDetectionMode(OnDeadlockCycle mode);
 
+// SetMutexDeadlockDetectionBatchSize()
+//
+// When deadlock detection is enabled, every acquisition normally updates the
+// global lock ordering graph under a single global lock, which makes the
+// detector too expensive to leave on in production. With a positive
+// `batch_size`, acquires-before edges are instead accumulated in thread-local
+// buffers and folded into the graph roughly every `batch_size` new edges (and
+// on thread exit); repeat acquisitions in an already-buffered order touch no
+// global state at all. The trade-offs: a cycle is reported when the buffered
+// edge reaches the graph rather than at the acquisition itself, and reports
+// omit per-mutex acquisition stacks. A `batch_size` of zero (the default)
+// restores immediate updates.
+void SetMutexDeadlockDetectionBatchSize(int batch_size);
+
 ABSL_NAMESPACE_END
 }  // namespace absl
 
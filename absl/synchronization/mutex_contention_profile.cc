@@ -0,0 +1,161 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/synchronization/mutex_contention_profile.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "absl/base/attributes.h"
+#include "absl/base/config.h"
+#include "absl/base/internal/cycleclock.h"
+#include "absl/base/optimization.h"
+#include "absl/profiling/internal/exponential_biased.h"
+#include "absl/time/time.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr int kNumBuckets = MutexContentionProfileEntry::kNumBuckets;
+
+// One aggregation slot per callsite. A slot is claimed by CASing `callsite`
+// from null; counters are updated with relaxed atomics since each is
+// independently meaningful. Samples are recorded while the sampled Mutex is
+// held, so nothing here may block or allocate.
+struct Site {
+  std::atomic<const void*> callsite;
+  std::atomic<int64_t> samples;
+  std::atomic<int64_t> total_wait_ns;
+  std::atomic<int64_t> buckets[kNumBuckets];
+};
+
+// Must be a power of two. The table lives in zero-initialized static storage
+// so an unused profile costs address space, not resident memory. Once all
+// slots are claimed, samples from new callsites are dropped; the hottest
+// sites are by construction the most likely to have claimed a slot early.
+constexpr size_t kMaxSites = 256;
+constexpr size_t kMaxProbes = 8;
+Site g_sites[kMaxSites];
+
+ABSL_CONST_INIT std::atomic<bool> g_profiling_enabled{false};
+ABSL_CONST_INIT std::atomic<int64_t> g_sample_period{64};
+ABSL_CONST_INIT std::atomic<int64_t> g_dropped_samples{0};
+
+#ifdef ABSL_HAVE_THREAD_LOCAL
+// Countdown of contended acquisitions on this thread until the next sample.
+thread_local int64_t sample_countdown = 0;
+thread_local absl::profiling_internal::ExponentialBiased
+    exponential_biased_generator;
+#endif
+
+Site* FindSite(const void* callsite) {
+  uintptr_t h = reinterpret_cast<uintptr_t>(callsite);
+  h = (h * uintptr_t{0x9ddfea08eb382d69}) >> 13;
+  for (size_t i = 0; i < kMaxProbes; ++i) {
+    Site* site = &g_sites[(h + i) % kMaxSites];
+    const void* seen = site->callsite.load(std::memory_order_acquire);
+    if (seen == callsite) return site;
+    if (seen == nullptr &&
+        site->callsite.compare_exchange_strong(seen, callsite,
+                                               std::memory_order_acq_rel)) {
+      return site;
+    }
+    // `seen` now holds the claimant; it may be our callsite if another thread
+    // claimed the slot for the same site between the load and the exchange.
+    if (seen == callsite) return site;
+  }
+  return nullptr;
+}
+
+}  // namespace
+
+void EnableMutexContentionProfiling() {
+  g_profiling_enabled.store(true, std::memory_order_release);
+}
+
+void DisableMutexContentionProfiling() {
+  g_profiling_enabled.store(false, std::memory_order_release);
+}
+
+void SetMutexContentionSamplePeriod(int64_t period) {
+  g_sample_period.store(period < 1 ? 1 : period, std::memory_order_relaxed);
+}
+
+std::vector<MutexContentionProfileEntry> MutexContentionProfile() {
+  std::vector<MutexContentionProfileEntry> profile;
+  for (Site& site : g_sites) {
+    const void* callsite = site.callsite.load(std::memory_order_acquire);
+    if (callsite == nullptr) continue;
+    MutexContentionProfileEntry entry;
+    entry.callsite = callsite;
+    entry.samples = site.samples.load(std::memory_order_relaxed);
+    entry.total_wait = absl::Nanoseconds(
+        site.total_wait_ns.load(std::memory_order_relaxed));
+    for (int i = 0; i < kNumBuckets; ++i) {
+      entry.wait_ns_buckets[i] = site.buckets[i].load(std::memory_order_relaxed);
+    }
+    profile.push_back(entry);
+  }
+  std::sort(profile.begin(), profile.end(),
+            [](const MutexContentionProfileEntry& a,
+               const MutexContentionProfileEntry& b) {
+              return a.total_wait > b.total_wait;
+            });
+  return profile;
+}
+
+namespace synchronization_internal {
+
+bool ShouldSampleMutexContention() {
+#ifdef ABSL_HAVE_THREAD_LOCAL
+  if (!g_profiling_enabled.load(std::memory_order_relaxed)) return false;
+  if (ABSL_PREDICT_TRUE(--sample_countdown > 0)) return false;
+  int64_t period = g_sample_period.load(std::memory_order_relaxed);
+  sample_countdown =
+      period <= 1 ? 1 : exponential_biased_generator.GetStride(period);
+  return true;
+#else
+  return false;
+#endif
+}
+
+void RecordMutexContentionSample(const void* callsite, int64_t wait_cycles) {
+  if (callsite == nullptr) return;
+  Site* site = FindSite(callsite);
+  if (site == nullptr) {
+    g_dropped_samples.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  int64_t wait_ns = 0;
+  if (wait_cycles > 0) {
+    wait_ns = static_cast<int64_t>(
+        static_cast<double>(wait_cycles) *
+        (1e9 / base_internal::CycleClock::Frequency()));
+  }
+  int bucket = 0;
+  while (bucket < kNumBuckets - 1 && (wait_ns >> (bucket + 1)) != 0) ++bucket;
+  site->samples.fetch_add(1, std::memory_order_relaxed);
+  site->total_wait_ns.fetch_add(wait_ns, std::memory_order_relaxed);
+  site->buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+}
+
+}  // namespace synchronization_internal
+
+ABSL_NAMESPACE_END
+}  // namespace absl
@@ -467,6 +467,61 @@ TEST(Mutex, CondVarWaitSignalsAwait) {
   state.release_mu.Unlock();
 }
 
+TEST(Mutex, CondVarSignalN) {
+  static constexpr int kThreads = 8;
+  struct State {
+    absl::Mutex mu;
+    absl::CondVar cv;
+    int sleepers ABSL_GUARDED_BY(mu) = 0;
+    int tokens ABSL_GUARDED_BY(mu) = 0;
+    int consumed ABSL_GUARDED_BY(mu) = 0;
+    int expected ABSL_GUARDED_BY(mu) = 0;
+    bool done ABSL_GUARDED_BY(mu) = false;
+  };
+  for (int wake : {1, 3, kThreads, kThreads + 100}) {
+    State s;
+    std::vector<std::thread> threads;
+    threads.reserve(kThreads);
+    for (int i = 0; i < kThreads; ++i) {
+      threads.emplace_back([&s] {
+        absl::MutexLock l(&s.mu);
+        ++s.sleepers;
+        while (!s.done && s.tokens == 0) {
+          s.cv.Wait(&s.mu);
+        }
+        if (s.tokens > 0) {
+          --s.tokens;
+          ++s.consumed;
+        }
+        while (!s.done) {
+          s.cv.Wait(&s.mu);
+        }
+      });
+    }
+    s.mu.LockWhen(absl::Condition(
+        +[](State* state) { return state->sleepers == kThreads; }, &s));
+    // All threads are blocked in Wait(). Publish min(wake, kThreads) work
+    // items and wake that many waiters; each woken thread consumes one item.
+    // If SignalN were to wake too few waiters, Await would hang.
+    s.expected = std::min(wake, kThreads);
+    s.tokens = s.expected;
+    s.cv.SignalN(wake);
+    s.mu.Await(absl::Condition(
+        +[](State* state) { return state->consumed == state->expected; }, &s));
+    EXPECT_EQ(s.tokens, 0);
+    s.done = true;
+    s.cv.SignalAll();
+    s.mu.Unlock();
+    for (auto& t : threads) t.join();
+  }
+
+  // SignalN without waiters, and with n <= 0, are harmless no-ops.
+  absl::CondVar cv;
+  cv.SignalN(3);
+  cv.SignalN(0);
+  cv.SignalN(-1);
+}
+
 // Test that a CondVar.WaitWithTimeout(&mutex) can un-block a call to
 // mutex.Await() in another thread.
 TEST(Mutex, CondVarWaitWithTimeoutSignalsAwait) {
@@ -1262,6 +1317,35 @@ TEST(Mutex, DeadlockDetectorBazelWarning) {
   absl::SetMutexDeadlockDetectionMode(absl::OnDeadlockCycle::kAbort);
 }
 
+#ifdef ABSL_HAVE_THREAD_SANITIZER
+// This test intentionally creates deadlocks to test the deadlock detector.
+TEST(Mutex, DISABLED_DeadlockDetectorBatchedUpdates) {
+#else
+TEST(Mutex, DeadlockDetectorBatchedUpdates) {
+#endif
+  absl::SetMutexDeadlockDetectionMode(absl::OnDeadlockCycle::kReport);
+  absl::SetMutexDeadlockDetectionBatchSize(1);
+
+  // Cause deadlock detection to detect something, if it's
+  // compiled in and enabled.  But turn off the bazel warning.
+  ScopedDisableBazelTestWarnings disable_bazel_test_warnings;
+
+  absl::Mutex mu0;
+  absl::Mutex mu1;
+  mu0.Lock();
+  mu1.Lock();  // acquire mu1 while holding mu0
+  mu1.Unlock();
+  mu0.Unlock();
+  mu1.Lock();
+  mu0.Lock();  // acquire mu0 while holding mu1; the inverted edge is
+               // reported when the batched buffer is flushed
+  mu0.Unlock();
+  mu1.Unlock();
+
+  absl::SetMutexDeadlockDetectionBatchSize(0);
+  absl::SetMutexDeadlockDetectionMode(absl::OnDeadlockCycle::kAbort);
+}
+
 TEST(Mutex, DeadlockDetectorLongCycle) {
   absl::SetMutexDeadlockDetectionMode(absl::OnDeadlockCycle::kReport);
 
@@ -15,14 +15,91 @@
 #include "absl/synchronization/notification.h"
 
 #include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
 
+#include "absl/base/internal/cycleclock.h"
 #include "absl/base/internal/raw_logging.h"
+#include "absl/base/internal/sysinfo.h"
 #include "absl/synchronization/mutex.h"
+#include "absl/time/clock.h"
 #include "absl/time/time.h"
+#include "absl/types/span.h"
 
 namespace absl {
 ABSL_NAMESPACE_BEGIN
 
+namespace synchronization_internal {
+
+// Shared state of one `WaitAny()` call, on the waiting thread's stack. It is
+// freed only after the call has deregistered from every notification, so
+// registered links never dangle.
+struct WaitAnyState {
+  Mutex mu;
+  int fired_index = -1;  // index of the first fired notification, under `mu`
+};
+
+// Links one `WaitAny()` call into one notification's waiter list.
+struct WaitAnyLink {
+  WaitAnyState* state;
+  int index;          // this notification's index in the caller's span
+  WaitAnyLink* next;  // next waiter on the same notification
+};
+
+}  // namespace synchronization_internal
+
+using synchronization_internal::WaitAnyLink;
+using synchronization_internal::WaitAnyState;
+
+namespace {
+
+// Spin policy for WaitForNotification(), in nanoseconds. `spin_budget_ns` is
+// the user-set ceiling (zero disables spinning); `spin_ns` is the current
+// adaptive bound, grown when a spin observes the notification and halved when
+// a spin times out and parks anyway, so waits that historically park spend
+// almost none of the budget polling first.
+std::atomic<int64_t> spin_budget_ns{0};
+std::atomic<int64_t> spin_ns{1000};
+
+constexpr int64_t kMinSpinNs = 256;
+
+// Polls `*notified_yet` for up to the adaptive spin bound. Returns true if
+// the notification arrived while polling.
+bool SpinForNotification(const std::atomic<bool>* notified_yet) {
+  const int64_t budget = spin_budget_ns.load(std::memory_order_relaxed);
+  if (budget <= 0 || base_internal::NumCPUs() <= 1) return false;
+  int64_t limit = spin_ns.load(std::memory_order_relaxed);
+  if (limit > budget) limit = budget;
+  if (limit < kMinSpinNs) limit = kMinSpinNs;
+  const int64_t limit_cycles = static_cast<int64_t>(
+      static_cast<double>(limit) * base_internal::CycleClock::Frequency() *
+      1e-9);
+  const int64_t start = base_internal::CycleClock::Now();
+  do {
+    if (notified_yet->load(std::memory_order_acquire)) {
+      const int64_t cur = spin_ns.load(std::memory_order_relaxed);
+      int64_t next = cur + cur / 4 + 64;
+      if (next > budget) next = budget;
+      spin_ns.store(next, std::memory_order_relaxed);
+      return true;
+    }
+  } while (base_internal::CycleClock::Now() - start < limit_cycles);
+  const int64_t cur = spin_ns.load(std::memory_order_relaxed);
+  int64_t next = cur / 2;
+  if (next < kMinSpinNs) next = kMinSpinNs;
+  spin_ns.store(next, std::memory_order_relaxed);
+  return false;
+}
+
+}  // namespace
+
+void Notification::SetSpinBudget(absl::Duration budget) {
+  int64_t ns = absl::ToInt64Nanoseconds(budget);
+  if (ns < 0) ns = 0;
+  spin_budget_ns.store(ns, std::memory_order_relaxed);
+}
+
 void Notification::Notify() {
   MutexLock l(&this->mutex_);
 
@@ -36,6 +113,14 @@ void Notification::Notify() {
 #endif
 
   notified_yet_.store(true, std::memory_order_release);
+
+  // Wake multi-waiters. Each waiter deregisters its links itself, so the
+  // list is left intact here.
+  for (WaitAnyLink* link = wait_any_waiters_; link != nullptr;
+       link = link->next) {
+    MutexLock waiter_lock(&link->state->mu);
+    if (link->state->fired_index < 0) link->state->fired_index = link->index;
+  }
 }
 
 Notification::~Notification() {
@@ -45,7 +130,8 @@ Notification::~Notification() {
 }
 
 void Notification::WaitForNotification() const {
-  if (!HasBeenNotifiedInternal(&this->notified_yet_)) {
+  if (!HasBeenNotifiedInternal(&this->notified_yet_) &&
+      !SpinForNotification(&this->notified_yet_)) {
     this->mutex_.LockWhen(Condition(&HasBeenNotifiedInternal,
                                     &this->notified_yet_));
     this->mutex_.Unlock();
@@ -73,5 +159,87 @@ bool Notification::WaitForNotificationWithDeadline(absl::Time deadline) const {
   return notified;
 }
 
+namespace {
+
+bool WaitAnyStateFired(WaitAnyState* state) { return state->fired_index >= 0; }
+
+}  // namespace
+
+int Notification::WaitAnyImpl(absl::Span<Notification* const> notifications,
+                              bool has_deadline, absl::Time deadline) {
+  // Fast path: nothing to register if a notification has already fired.
+  for (size_t i = 0; i < notifications.size(); ++i) {
+    if (notifications[i]->HasBeenNotified()) return static_cast<int>(i);
+  }
+  if (notifications.empty()) return -1;
+
+  WaitAnyState state;
+  std::unique_ptr<WaitAnyLink[]> links(
+      new WaitAnyLink[notifications.size()]);
+  size_t registered = 0;
+  int result = -1;
+  for (size_t i = 0; i < notifications.size(); ++i) {
+    Notification* n = notifications[i];
+    MutexLock lock(&n->mutex_);
+    // Re-check under the lock: a notification that fired after the fast
+    // path's scan would otherwise never signal `state`.
+    if (n->notified_yet_.load(std::memory_order_relaxed)) {
+      result = static_cast<int>(i);
+      break;
+    }
+    links[i] = WaitAnyLink{&state, static_cast<int>(i), n->wait_any_waiters_};
+    n->wait_any_waiters_ = &links[i];
+    ++registered;
+  }
+
+  if (result < 0) {
+    if (has_deadline) {
+      state.mu.LockWhenWithDeadline(Condition(&WaitAnyStateFired, &state),
+                                    deadline);
+    } else {
+      state.mu.LockWhen(Condition(&WaitAnyStateFired, &state));
+    }
+    state.mu.Unlock();
+  }
+
+  // Deregister from every notification before `state` and `links` leave
+  // scope. `Notify()` accesses a link only while holding the notification's
+  // mutex, so after this loop nothing can reach them.
+  for (size_t i = 0; i < registered; ++i) {
+    Notification* n = notifications[i];
+    MutexLock lock(&n->mutex_);
+    for (WaitAnyLink** p = &n->wait_any_waiters_; *p != nullptr;
+         p = &(*p)->next) {
+      if (*p == &links[i]) {
+        *p = links[i].next;
+        break;
+      }
+    }
+  }
+  if (result < 0) {
+    // A notification may have fired between the wait timing out and
+    // deregistration completing; report it rather than a spurious timeout.
+    MutexLock lock(&state.mu);
+    result = state.fired_index;
+  }
+  return result;
+}
+
+int WaitAny(absl::Span<Notification* const> notifications) {
+  return Notification::WaitAnyImpl(notifications, /*has_deadline=*/false,
+                                   absl::InfiniteFuture());
+}
+
+int WaitAnyWithTimeout(absl::Span<Notification* const> notifications,
+                       absl::Duration timeout) {
+  return WaitAnyWithDeadline(notifications, absl::Now() + timeout);
+}
+
+int WaitAnyWithDeadline(absl::Span<Notification* const> notifications,
+                        absl::Time deadline) {
+  return Notification::WaitAnyImpl(notifications, /*has_deadline=*/true,
+                                   deadline);
+}
+
 ABSL_NAMESPACE_END
 }  // namespace absl
@@ -55,10 +55,15 @@
 #include "absl/base/attributes.h"
 #include "absl/synchronization/mutex.h"
 #include "absl/time/time.h"
+#include "absl/types/span.h"
 
 namespace absl {
 ABSL_NAMESPACE_BEGIN
 
+namespace synchronization_internal {
+struct WaitAnyLink;
+}  // namespace synchronization_internal
+
 // -----------------------------------------------------------------------------
 // Notification
 // -----------------------------------------------------------------------------
@@ -107,16 +112,67 @@ class Notification {
   // results in undefined behavior.
   void Notify();
 
+  // Notification::SetSpinBudget()
+  //
+  // Sets a process-wide bound on how long `WaitForNotification()` may spin
+  // polling the "notified" state before parking the calling thread. The
+  // default budget is zero: waiters park immediately. Pipelines whose
+  // notify-to-wait latency is routinely shorter than a context switch can set
+  // a budget of a few microseconds to complete such handoffs without
+  // involving the scheduler. Within the budget the actual spin time adapts to
+  // recent wait times, so waits that historically park anyway spin only
+  // briefly first. Spinning is never used on single-CPU machines.
+  static void SetSpinBudget(absl::Duration budget);
+
  private:
+  friend int WaitAny(absl::Span<Notification* const> notifications);
+  friend int WaitAnyWithTimeout(absl::Span<Notification* const> notifications,
+                                absl::Duration timeout);
+  friend int WaitAnyWithDeadline(absl::Span<Notification* const> notifications,
+                                 absl::Time deadline);
+
   static inline bool HasBeenNotifiedInternal(
       const std::atomic<bool>* notified_yet) {
     return notified_yet->load(std::memory_order_acquire);
   }
 
+  static int WaitAnyImpl(absl::Span<Notification* const> notifications,
+                         bool has_deadline, absl::Time deadline);
+
   mutable Mutex mutex_;
   std::atomic<bool> notified_yet_;  // written under mutex_
+  // Intrusive list of `WaitAny()` calls currently waiting on this
+  // notification; guarded by `mutex_` and almost always null.
+  mutable synchronization_internal::WaitAnyLink* wait_any_waiters_ = nullptr;
 };
 
+// WaitAny()
+//
+// Blocks the calling thread until at least one of `notifications` has been
+// notified, and returns the index of a notified notification (the lowest
+// such index if several have fired). The calling thread parks once,
+// regardless of how many notifications are watched; no per-notification
+// watcher threads are involved. Returns -1 immediately if `notifications` is
+// empty.
+//
+// Every notification in the span must outlive the call. The memory-ordering
+// guarantee of `Notify()` (see above) extends to `WaitAny()`: actions taken
+// before `Notify()` on notification `i` are visible after `WaitAny()`
+// returns `i`.
+int WaitAny(absl::Span<Notification* const> notifications);
+
+// WaitAnyWithTimeout()
+//
+// Like `WaitAny()`, but gives up when `timeout` has elapsed, returning -1.
+int WaitAnyWithTimeout(absl::Span<Notification* const> notifications,
+                       absl::Duration timeout);
+
+// WaitAnyWithDeadline()
+//
+// Like `WaitAny()`, but gives up when `deadline` has passed, returning -1.
+int WaitAnyWithDeadline(absl::Span<Notification* const> notifications,
+                        absl::Time deadline);
+
 ABSL_NAMESPACE_END
 }  // namespace absl
 
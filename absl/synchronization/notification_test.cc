@@ -129,5 +129,80 @@ TEST(NotificationTest, SanityTest) {
   BasicTests(true, &local_notification2);
 }
 
+TEST(NotificationTest, WaitAnyEmptySpan) {
+  EXPECT_EQ(WaitAny({}), -1);
+}
+
+TEST(NotificationTest, WaitAnyAlreadyNotified) {
+  Notification a, b, c;
+  b.Notify();
+  EXPECT_EQ(WaitAny({&a, &b, &c}), 1);
+  // The lowest fired index is reported when several have fired.
+  a.Notify();
+  EXPECT_EQ(WaitAny({&a, &b, &c}), 0);
+}
+
+TEST(NotificationTest, WaitAnyWakesOnNotify) {
+  Notification a, b, c;
+  std::thread notifier([&b] { b.Notify(); });
+  EXPECT_EQ(WaitAny({&a, &b, &c}), 1);
+  notifier.join();
+  a.Notify();
+  c.Notify();
+}
+
+TEST(NotificationTest, WaitAnyTimesOut) {
+  Notification a, b;
+  EXPECT_EQ(WaitAnyWithTimeout({&a, &b}, absl::Milliseconds(10)), -1);
+  EXPECT_EQ(WaitAnyWithDeadline({&a, &b}, absl::Now() - absl::Seconds(1)),
+            -1);
+  b.Notify();
+  EXPECT_EQ(WaitAnyWithTimeout({&a, &b}, absl::InfiniteDuration()), 1);
+  EXPECT_EQ(WaitAnyWithDeadline({&a, &b}, absl::InfiniteFuture()), 1);
+  // Notifying after a timed-out wait must not touch the expired waiter.
+  a.Notify();
+}
+
+TEST(NotificationTest, WaitAnyMultipleWaiters) {
+  Notification notifications[4];
+  std::vector<std::thread> waiters;
+  ThreadSafeCounter woke_counter;
+  for (int i = 0; i < 8; ++i) {
+    waiters.emplace_back([&notifications, &woke_counter] {
+      const int index =
+          WaitAny({&notifications[0], &notifications[1], &notifications[2],
+                   &notifications[3]});
+      EXPECT_EQ(index, 2);
+      woke_counter.Increment();
+    });
+  }
+  notifications[2].Notify();
+  for (std::thread& waiter : waiters) waiter.join();
+  EXPECT_EQ(woke_counter.Get(), 8);
+}
+
+TEST(NotificationTest, WaitAnyMixedWithSingleWaiters) {
+  // Multi-waiters and plain WaitForNotification() waiters coexist on the
+  // same notification.
+  Notification a, b;
+  std::thread single_waiter([&b] { b.WaitForNotification(); });
+  std::thread multi_waiter([&a, &b] { EXPECT_EQ(WaitAny({&a, &b}), 1); });
+  b.Notify();
+  single_waiter.join();
+  multi_waiter.join();
+  a.Notify();
+}
+
+TEST(NotificationTest, SpinBudgetPreservesSemantics) {
+  // Waits must behave identically (modulo latency) with spinning enabled,
+  // whether the notification arrives during the spin phase or after parking.
+  Notification::SetSpinBudget(absl::Microseconds(100));
+  for (int i = 0; i < 10; ++i) {
+    Notification local_notification;
+    BasicTests(i % 2 == 0, &local_notification);
+  }
+  Notification::SetSpinBudget(absl::ZeroDuration());
+}
+
 ABSL_NAMESPACE_END
 }  // namespace absl
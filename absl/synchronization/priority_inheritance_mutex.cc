@@ -0,0 +1,99 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/synchronization/priority_inheritance_mutex.h"
+
+#include "absl/base/config.h"
+
+#if defined(ABSL_INTERNAL_HAVE_FUTEX_PI)
+#include <errno.h>
+
+#include "absl/base/internal/raw_logging.h"
+#include "absl/base/optimization.h"
+#include "absl/synchronization/internal/futex.h"
+#elif !defined(_WIN32)
+#include <pthread.h>
+#include <unistd.h>
+
+#include "absl/base/internal/raw_logging.h"
+#endif
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+#if defined(ABSL_INTERNAL_HAVE_FUTEX_PI)
+
+void PriorityInheritanceMutex::LockSlow() {
+  // The kernel flags the futex word with FUTEX_WAITERS, boosts the owner to
+  // the highest priority among the waiters, and returns once the calling
+  // thread has been made the owner.
+  while (true) {
+    const int err = synchronization_internal::Futex::LockPi(&word_);
+    if (ABSL_PREDICT_TRUE(err == 0)) return;
+    if (err != -EAGAIN) {
+      // EDEADLK means a recursive acquisition; ESRCH or EINVAL mean the
+      // futex word no longer holds a live owner TID (e.g. a stray write).
+      ABSL_RAW_LOG(FATAL, "FUTEX_LOCK_PI failed with errno %d", -err);
+    }
+    // EAGAIN: the owner is exiting and the kernel has not yet finished
+    // tearing down its state; retry.
+  }
+}
+
+void PriorityInheritanceMutex::UnlockSlow() {
+  const int err = synchronization_internal::Futex::UnlockPi(&word_);
+  if (ABSL_PREDICT_FALSE(err != 0)) {
+    // EPERM means the calling thread does not own the lock.
+    ABSL_RAW_LOG(FATAL, "FUTEX_UNLOCK_PI failed with errno %d", -err);
+  }
+}
+
+#elif !defined(_WIN32)
+
+PriorityInheritanceMutex::PriorityInheritanceMutex() {
+  pthread_mutexattr_t attr;
+  ABSL_RAW_CHECK(pthread_mutexattr_init(&attr) == 0,
+                 "pthread_mutexattr_init failed");
+#if defined(_POSIX_THREAD_PRIO_INHERIT) && _POSIX_THREAD_PRIO_INHERIT >= 0
+  // Best effort: the option may be compiled in yet unsupported at runtime,
+  // in which case the lock still works but does not convey priority.
+  pthread_mutexattr_setprotocol(&attr, PTHREAD_PRIO_INHERIT);
+#endif
+  ABSL_RAW_CHECK(pthread_mutex_init(&mutex_, &attr) == 0,
+                 "pthread_mutex_init failed");
+  pthread_mutexattr_destroy(&attr);
+}
+
+PriorityInheritanceMutex::~PriorityInheritanceMutex() {
+  ABSL_RAW_CHECK(pthread_mutex_destroy(&mutex_) == 0,
+                 "pthread_mutex_destroy failed");
+}
+
+void PriorityInheritanceMutex::Lock() {
+  ABSL_RAW_CHECK(pthread_mutex_lock(&mutex_) == 0, "pthread_mutex_lock failed");
+}
+
+bool PriorityInheritanceMutex::TryLock() {
+  return pthread_mutex_trylock(&mutex_) == 0;
+}
+
+void PriorityInheritanceMutex::Unlock() {
+  ABSL_RAW_CHECK(pthread_mutex_unlock(&mutex_) == 0,
+                 "pthread_mutex_unlock failed");
+}
+
+#endif
+
+ABSL_NAMESPACE_END
+}  // namespace absl
@@ -0,0 +1,149 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// -----------------------------------------------------------------------------
+// File: priority_inheritance_mutex.h
+// -----------------------------------------------------------------------------
+//
+// This header file defines `absl::PriorityInheritanceMutex`, a
+// mutual-exclusion lock for data shared between latency-critical and
+// background threads. When a high-priority thread blocks on the lock, the
+// kernel temporarily raises the priority of the current holder, so a
+// preempted low-priority holder cannot keep a real-time thread waiting
+// behind unrelated lower-priority work (a priority inversion).
+//
+// On Linux the lock is a priority-inheritance futex (`FUTEX_LOCK_PI`):
+// uncontended acquisition and release are a single atomic compare-and-swap
+// on the owner's thread ID and the kernel is involved only under contention.
+// On other POSIX systems it falls back to a `pthread_mutex_t` using the
+// `PTHREAD_PRIO_INHERIT` protocol where the platform provides it; elsewhere
+// it degrades to an ordinary mutex with no priority inheritance.
+//
+// Unlike `absl::Mutex`, this lock has no reader mode, conditional critical
+// sections, deadlock detection, or contention reporting. Use it only for
+// locks shared across scheduling priorities where inversion has been
+// measured to matter; everywhere else, prefer `absl::Mutex`. The lock is
+// not re-entrant.
+
+#ifndef ABSL_SYNCHRONIZATION_PRIORITY_INHERITANCE_MUTEX_H_
+#define ABSL_SYNCHRONIZATION_PRIORITY_INHERITANCE_MUTEX_H_
+
+#include "absl/base/config.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/synchronization/internal/futex.h"
+
+#if defined(ABSL_INTERNAL_HAVE_FUTEX_PI)
+#include <atomic>
+#include <cstdint>
+
+#include "absl/base/internal/sysinfo.h"
+#include "absl/base/optimization.h"
+#elif !defined(_WIN32)
+#include <pthread.h>
+#else
+#include <mutex>  // NOLINT(build/c++11)
+#endif
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+class ABSL_LOCKABLE PriorityInheritanceMutex {
+ public:
+#if defined(ABSL_INTERNAL_HAVE_FUTEX_PI)
+  constexpr PriorityInheritanceMutex() = default;
+#elif !defined(_WIN32)
+  PriorityInheritanceMutex();
+  ~PriorityInheritanceMutex();
+#else
+  PriorityInheritanceMutex() = default;
+#endif
+
+  PriorityInheritanceMutex(const PriorityInheritanceMutex&) = delete;
+  PriorityInheritanceMutex& operator=(const PriorityInheritanceMutex&) =
+      delete;
+
+  // PriorityInheritanceMutex::Lock()
+  //
+  // Blocks the calling thread, if necessary, until this mutex is free, and
+  // then acquires it exclusively. While the caller waits, its priority is
+  // lent to the holder.
+  void Lock() ABSL_EXCLUSIVE_LOCK_FUNCTION();
+
+  // PriorityInheritanceMutex::TryLock()
+  //
+  // Acquires the mutex if it is free; returns whether it was acquired.
+  // Never blocks and never boosts the holder.
+  bool TryLock() ABSL_EXCLUSIVE_TRYLOCK_FUNCTION(true);
+
+  // PriorityInheritanceMutex::Unlock()
+  //
+  // Releases the mutex, handing it to the highest-priority waiter, if any,
+  // and sheds any priority the caller was lent while holding it.
+  void Unlock() ABSL_UNLOCK_FUNCTION();
+
+ private:
+#if defined(ABSL_INTERNAL_HAVE_FUTEX_PI)
+  void LockSlow();
+  void UnlockSlow();
+
+  // Owner TID, or zero when unlocked. The kernel manages the FUTEX_WAITERS
+  // bit, which diverts the release onto the slow path.
+  std::atomic<int32_t> word_{0};
+#elif !defined(_WIN32)
+  pthread_mutex_t mutex_;
+#else
+  std::mutex mutex_;
+#endif
+};
+
+#if defined(ABSL_INTERNAL_HAVE_FUTEX_PI)
+
+inline void PriorityInheritanceMutex::Lock() {
+  int32_t unlocked = 0;
+  if (ABSL_PREDICT_FALSE(!word_.compare_exchange_strong(
+          unlocked, static_cast<int32_t>(base_internal::GetCachedTID()),
+          std::memory_order_acquire, std::memory_order_relaxed))) {
+    LockSlow();
+  }
+}
+
+inline bool PriorityInheritanceMutex::TryLock() {
+  int32_t unlocked = 0;
+  return word_.compare_exchange_strong(
+      unlocked, static_cast<int32_t>(base_internal::GetCachedTID()),
+      std::memory_order_acquire, std::memory_order_relaxed);
+}
+
+inline void PriorityInheritanceMutex::Unlock() {
+  int32_t tid = static_cast<int32_t>(base_internal::GetCachedTID());
+  if (ABSL_PREDICT_FALSE(!word_.compare_exchange_strong(
+          tid, 0, std::memory_order_release, std::memory_order_relaxed))) {
+    UnlockSlow();
+  }
+}
+
+#elif defined(_WIN32)
+
+inline void PriorityInheritanceMutex::Lock() { mutex_.lock(); }
+
+inline bool PriorityInheritanceMutex::TryLock() { return mutex_.try_lock(); }
+
+inline void PriorityInheritanceMutex::Unlock() { mutex_.unlock(); }
+
+#endif
+
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_SYNCHRONIZATION_PRIORITY_INHERITANCE_MUTEX_H_
@@ -0,0 +1,96 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/synchronization/priority_inheritance_mutex.h"
+
+#include <cstdint>
+#include <thread>  // NOLINT(build/c++11)
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "absl/synchronization/notification.h"
+
+namespace {
+
+TEST(PriorityInheritanceMutex, LocksAndUnlocks) {
+  absl::PriorityInheritanceMutex mu;
+  mu.Lock();
+  mu.Unlock();
+  mu.Lock();
+  mu.Unlock();
+}
+
+TEST(PriorityInheritanceMutex, TryLockSucceedsWhenFree) {
+  absl::PriorityInheritanceMutex mu;
+  EXPECT_TRUE(mu.TryLock());
+  mu.Unlock();
+  EXPECT_TRUE(mu.TryLock());
+  mu.Unlock();
+}
+
+TEST(PriorityInheritanceMutex, TryLockFailsWhenHeld) {
+  absl::PriorityInheritanceMutex mu;
+  mu.Lock();
+  absl::Notification done;
+  std::thread t([&mu, &done] {
+    EXPECT_FALSE(mu.TryLock());
+    done.Notify();
+  });
+  done.WaitForNotification();
+  t.join();
+  mu.Unlock();
+  EXPECT_TRUE(mu.TryLock());
+  mu.Unlock();
+}
+
+TEST(PriorityInheritanceMutex, BlocksUntilReleased) {
+  absl::PriorityInheritanceMutex mu;
+  mu.Lock();
+  absl::Notification started;
+  absl::Notification acquired;
+  std::thread t([&] {
+    started.Notify();
+    mu.Lock();
+    acquired.Notify();
+    mu.Unlock();
+  });
+  started.WaitForNotification();
+  EXPECT_FALSE(acquired.HasBeenNotified());
+  mu.Unlock();
+  acquired.WaitForNotification();
+  t.join();
+}
+
+TEST(PriorityInheritanceMutex, MutualExclusionUnderContention) {
+  static constexpr int kNumThreads = 8;
+  static constexpr int kIncrementsPerThread = 100000;
+  absl::PriorityInheritanceMutex mu;
+  int64_t counter = 0;
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads.push_back(std::thread([&mu, &counter] {
+      for (int j = 0; j < kIncrementsPerThread; ++j) {
+        mu.Lock();
+        ++counter;
+        mu.Unlock();
+      }
+    }));
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(counter, int64_t{kNumThreads} * kIncrementsPerThread);
+}
+
+}  // namespace
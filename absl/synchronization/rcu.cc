@@ -0,0 +1,248 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/synchronization/rcu.h"
+
+#include <atomic>
+#include <cstdint>
+
+#include "absl/base/internal/raw_logging.h"
+#include "absl/base/optimization.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+// Per-thread cache of (domain, record) bindings with the read-section nesting
+// depth, so the common ReadLock() is a couple of loads and stores. On thread
+// exit the destructor returns the records to their domains for reuse. The
+// cache is small and fixed; a thread using more domains concurrently falls
+// back to releasing and re-registering records, which is correct but slower.
+struct RcuThreadCleanup {
+  static constexpr int kMaxCachedDomains = 8;
+
+  struct Binding {
+    RcuDomain* domain = nullptr;
+    RcuDomain::ThreadRecord* record = nullptr;
+    uint64_t depth = 0;
+  };
+
+  Binding bindings[kMaxCachedDomains];
+
+  ~RcuThreadCleanup() {
+    for (Binding& b : bindings) {
+      if (b.record != nullptr) {
+        // A thread exiting inside a read section would leave the domain
+        // blocked forever; treat it as a usage error.
+        ABSL_RAW_CHECK(b.depth == 0,
+                       "thread exited inside an RcuDomain read section");
+        b.record->in_use.store(false, std::memory_order_release);
+        b.record->Unref();
+      }
+    }
+  }
+};
+
+namespace {
+
+thread_local RcuThreadCleanup rcu_tls;
+
+// Releases the record bound to `b` back to its domain (or frees it if the
+// domain is gone) and clears the binding.
+void ReleaseBinding(RcuThreadCleanup::Binding* b) {
+  b->record->in_use.store(false, std::memory_order_release);
+  b->record->Unref();
+  b->record = nullptr;
+  b->domain = nullptr;
+}
+
+RcuThreadCleanup::Binding* FindBinding(RcuDomain* domain) {
+  RcuThreadCleanup::Binding* free_binding = nullptr;
+  for (RcuThreadCleanup::Binding& b : rcu_tls.bindings) {
+    if (b.domain == domain) {
+      // The domain this binding was made for may have been destroyed and a
+      // new one constructed at the same address; the stale record is then
+      // marked orphaned and the binding must be remade.
+      if (b.record != nullptr &&
+          b.record->orphaned.load(std::memory_order_acquire)) {
+        ABSL_RAW_CHECK(b.depth == 0,
+                       "RcuDomain destroyed with an active read section");
+        ReleaseBinding(&b);
+        b.domain = domain;
+      }
+      return &b;
+    }
+    if (free_binding == nullptr && b.domain == nullptr) {
+      free_binding = &b;
+    }
+  }
+  if (free_binding == nullptr) {
+    // All cache slots bound to other domains; evict one that is not in an
+    // active read section and hand its record back to its domain.
+    for (RcuThreadCleanup::Binding& b : rcu_tls.bindings) {
+      if (b.depth == 0) {
+        ReleaseBinding(&b);
+        free_binding = &b;
+        break;
+      }
+    }
+    ABSL_RAW_CHECK(free_binding != nullptr,
+                   "too many RcuDomain read sections held by one thread");
+  }
+  free_binding->domain = domain;
+  free_binding->record = nullptr;
+  free_binding->depth = 0;
+  return free_binding;
+}
+
+}  // namespace
+
+void RcuDomain::ThreadRecord::Unref() {
+  if (refs.fetch_sub(1, std::memory_order_acq_rel) == 1) delete this;
+}
+
+RcuDomain::ThreadRecord* RcuDomain::RegisterThreadSlow() {
+  // Reuse a record abandoned by an exited thread if one exists; otherwise
+  // push a new one. Records are only ever appended, so Synchronize() can
+  // traverse the list without locking.
+  for (ThreadRecord* r = records_.load(std::memory_order_acquire);
+       r != nullptr; r = r->next) {
+    bool expected = false;
+    if (!r->in_use.load(std::memory_order_relaxed) &&
+        r->in_use.compare_exchange_strong(expected, true,
+                                          std::memory_order_acq_rel)) {
+      r->refs.fetch_add(1, std::memory_order_relaxed);
+      return r;
+    }
+  }
+  ThreadRecord* r = new ThreadRecord;
+  ThreadRecord* head = records_.load(std::memory_order_relaxed);
+  do {
+    r->next = head;
+  } while (!records_.compare_exchange_weak(head, r, std::memory_order_acq_rel,
+                                           std::memory_order_relaxed));
+  return r;
+}
+
+inline RcuDomain::ThreadRecord* RcuDomain::ThisThreadRecord() {
+  RcuThreadCleanup::Binding* binding = FindBinding(this);
+  if (ABSL_PREDICT_FALSE(binding->record == nullptr)) {
+    binding->record = RegisterThreadSlow();
+  }
+  ++binding->depth;
+  return binding->record;
+}
+
+void RcuDomain::ReadLock() {
+  ThreadRecord* record = ThisThreadRecord();
+  if (record->epoch.load(std::memory_order_relaxed) != 0) return;  // nested
+  record->epoch.store(epoch_.load(std::memory_order_relaxed),
+                      std::memory_order_relaxed);
+  // Order the epoch publication before the reads in the read section, against
+  // Synchronize()'s epoch bump and record scan. This fence is the entire
+  // shared-memory cost of a read section; the stores above touch only this
+  // thread's own record.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+void RcuDomain::ReadUnlock() {
+  RcuThreadCleanup::Binding* binding = FindBinding(this);
+  ABSL_RAW_CHECK(binding->record != nullptr && binding->depth != 0,
+                 "RcuDomain::ReadUnlock() without a matching ReadLock()");
+  if (--binding->depth == 0) {
+    binding->record->epoch.store(0, std::memory_order_release);
+  }
+}
+
+void RcuDomain::Retire(void (*fn)(void*), void* arg) {
+  RetiredCallback* cb = new RetiredCallback;
+  cb->fn = fn;
+  cb->arg = arg;
+  cb->epoch = epoch_.load(std::memory_order_acquire);
+  absl::MutexLock l(&retired_mu_);
+  cb->next = retired_;
+  retired_ = cb;
+}
+
+void RcuDomain::Synchronize() {
+  absl::MutexLock sync_lock(&synchronize_mu_);
+
+  // Steal the callbacks retired so far; anything retired after this point
+  // waits for the next Synchronize().
+  RetiredCallback* to_run;
+  {
+    absl::MutexLock l(&retired_mu_);
+    to_run = retired_;
+    retired_ = nullptr;
+  }
+
+  // Start a new epoch. Readers that enter afterwards observe the new epoch
+  // and, by the fence pairing with ReadLock(), also observe every store made
+  // before this call - in particular the unpublication of retired objects.
+  const uint64_t new_epoch =
+      epoch_.fetch_add(1, std::memory_order_seq_cst) + 1;
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  // Wait for every read section that began under an older epoch to end.
+  // Readers are typically short; back off to sleeping if one is not.
+  for (ThreadRecord* r = records_.load(std::memory_order_acquire); r != nullptr;
+       r = r->next) {
+    int spins = 0;
+    for (;;) {
+      uint64_t e = r->epoch.load(std::memory_order_acquire);
+      if (e == 0 || e >= new_epoch) break;
+      if (++spins < 1000) continue;
+      absl::SleepFor(absl::Microseconds(10));
+    }
+  }
+
+  while (to_run != nullptr) {
+    RetiredCallback* cb = to_run;
+    to_run = cb->next;
+    cb->fn(cb->arg);
+    delete cb;
+  }
+}
+
+RcuDomain::~RcuDomain() {
+  // By contract no read section is active, so pending callbacks are safe to
+  // run directly.
+  RetiredCallback* cb;
+  {
+    absl::MutexLock l(&retired_mu_);
+    cb = retired_;
+    retired_ = nullptr;
+  }
+  while (cb != nullptr) {
+    RetiredCallback* next = cb->next;
+    cb->fn(cb->arg);
+    delete cb;
+    cb = next;
+  }
+  // Threads that used this domain may still hold references to their
+  // records; mark the records orphaned and drop the domain's reference so
+  // that whichever side lets go last frees them.
+  ThreadRecord* r = records_.load(std::memory_order_acquire);
+  while (r != nullptr) {
+    ThreadRecord* next = r->next;
+    r->orphaned.store(true, std::memory_order_release);
+    r->Unref();
+    r = next;
+  }
+}
+
+ABSL_NAMESPACE_END
+}  // namespace absl
@@ -0,0 +1,195 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// -----------------------------------------------------------------------------
+// rcu.h
+// -----------------------------------------------------------------------------
+//
+// `absl::RcuDomain` is a read-copy-update (RCU) domain for read-mostly data,
+// such as configuration snapshots that are consulted on every request and
+// replaced a few times an hour. Guarding such data with
+// `absl::Mutex::ReaderLock()` pays an atomic read-modify-write on a shared
+// cache line per read; an RCU read section instead writes only a
+// thread-private epoch slot, so readers never contend with each other no
+// matter how many cores are reading.
+//
+// The usual pattern publishes immutable snapshots through an atomic pointer:
+//
+//   struct Config { ... };
+//   ABSL_CONST_INIT absl::RcuDomain config_rcu;
+//   std::atomic<const Config*> current_config;
+//
+//   // Reader (hot path):
+//   {
+//     absl::RcuReadLock lock(&config_rcu);
+//     const Config* config = current_config.load(std::memory_order_acquire);
+//     Use(*config);
+//   }  // `config` must not be used after the read section ends.
+//
+//   // Writer (rare):
+//   const Config* old =
+//       current_config.exchange(new Config(...), std::memory_order_acq_rel);
+//   config_rcu.Retire(old);      // deleted after all current readers leave
+//   config_rcu.Synchronize();    // wait for them and reclaim
+//
+// Readers are wait-free and never block writers directly; writers wait in
+// `Synchronize()` until every read section that might have seen the old
+// pointer has ended. Retired objects accumulate until `Synchronize()` runs
+// (or the domain is destroyed), so writers that call `Retire()` should call
+// `Synchronize()` at least occasionally.
+//
+// A thread may hold read sections on several domains at once and may nest
+// read sections on the same domain. Destroying a domain while any thread is
+// in one of its read sections is undefined behavior.
+
+#ifndef ABSL_SYNCHRONIZATION_RCU_H_
+#define ABSL_SYNCHRONIZATION_RCU_H_
+
+#include <atomic>
+#include <cstdint>
+
+#include "absl/base/attributes.h"
+#include "absl/base/config.h"
+#include "absl/synchronization/mutex.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+// RcuDomain
+//
+// A reclamation domain. Read sections and grace periods of distinct domains
+// are independent; most programs need only one domain per subsystem, created
+// with static storage duration:
+//
+//   ABSL_CONST_INIT absl::RcuDomain my_rcu;
+class RcuDomain {
+ public:
+  constexpr RcuDomain()
+      : epoch_(1),
+        records_(nullptr),
+        retired_(nullptr),
+        retired_mu_(absl::kConstInit),
+        synchronize_mu_(absl::kConstInit) {}
+
+  // Runs all pending `Retire()` callbacks (no read section may be active)
+  // and frees the per-thread reader records.
+  ~RcuDomain();
+
+  RcuDomain(const RcuDomain&) = delete;
+  RcuDomain& operator=(const RcuDomain&) = delete;
+
+  // RcuDomain::ReadLock()
+  //
+  // Enters a read section: objects reachable now will not be reclaimed until
+  // the matching `ReadUnlock()`. Read sections nest, are wait-free, and write
+  // no shared state - only this thread's own record. Prefer the
+  // `absl::RcuReadLock` RAII wrapper.
+  void ReadLock();
+
+  // RcuDomain::ReadUnlock()
+  //
+  // Leaves the innermost read section entered by this thread.
+  void ReadUnlock();
+
+  // RcuDomain::Retire()
+  //
+  // Schedules `absl::RcuDomain::Retire(fn, arg)` to run `fn(arg)`, or
+  // `Retire(ptr)` to run `delete ptr`, once every read section active at the
+  // time of the call has ended. The callback runs inside a later
+  // `Synchronize()` call (on whichever thread makes it) or in the domain's
+  // destructor. Call only after the object is unreachable to new readers.
+  void Retire(void (*fn)(void*), void* arg);
+  template <typename T>
+  void Retire(const T* ptr) {
+    Retire(
+        [](void* p) { delete static_cast<T*>(p); },
+        const_cast<void*>(static_cast<const void*>(ptr)));
+  }
+
+  // RcuDomain::Synchronize()
+  //
+  // Blocks until every read section that was active when this call started
+  // has ended, then runs the `Retire()` callbacks that became safe. Must not
+  // be called from within a read section of this domain. Concurrent calls
+  // are serialized.
+  void Synchronize();
+
+ private:
+  friend struct RcuThreadCleanup;
+
+  // One per (thread, domain) pair, linked into `records_` and reused by new
+  // threads after its owner exits. `epoch` is 0 outside read sections and
+  // the domain epoch observed on entry inside them. A record is referenced
+  // by the domain and by the thread bound to it, and since domains and
+  // threads die in either order it is freed by whichever reference drops
+  // last; `orphaned` marks records whose domain has been destroyed.
+  struct ThreadRecord {
+    std::atomic<uint64_t> epoch{0};
+    std::atomic<bool> in_use{true};
+    std::atomic<bool> orphaned{false};
+    std::atomic<int32_t> refs{2};  // the domain and the registering thread
+    ThreadRecord* next = nullptr;
+
+    // Drops one reference, freeing the record when none remain.
+    void Unref();
+  };
+
+  // A pending Retire() callback, safe to run once a grace period has started
+  // after `epoch`.
+  struct RetiredCallback {
+    void (*fn)(void*);
+    void* arg;
+    uint64_t epoch;
+    RetiredCallback* next;
+  };
+
+  // Returns this thread's record for this domain, registering one if needed.
+  ThreadRecord* ThisThreadRecord();
+  ThreadRecord* RegisterThreadSlow();
+
+  // The domain epoch: bumped by Synchronize(), copied by readers on entry.
+  // Epoch 0 is reserved for "not in a read section".
+  std::atomic<uint64_t> epoch_;
+  // Head of the reader record list; push-only, traversed by Synchronize().
+  std::atomic<ThreadRecord*> records_;
+  // Pending Retire() callbacks, guarded by retired_mu_.
+  RetiredCallback* retired_ ABSL_GUARDED_BY(retired_mu_);
+  absl::Mutex retired_mu_;
+  // Serializes Synchronize() calls.
+  absl::Mutex synchronize_mu_;
+};
+
+// RcuReadLock
+//
+// RAII wrapper entering a read section for its scope, analogous to
+// `absl::MutexLock`.
+class RcuReadLock {
+ public:
+  explicit RcuReadLock(RcuDomain* domain) : domain_(domain) {
+    domain_->ReadLock();
+  }
+
+  RcuReadLock(const RcuReadLock&) = delete;
+  RcuReadLock& operator=(const RcuReadLock&) = delete;
+
+  ~RcuReadLock() { domain_->ReadUnlock(); }
+
+ private:
+  RcuDomain* const domain_;
+};
+
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_SYNCHRONIZATION_RCU_H_
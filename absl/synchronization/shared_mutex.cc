@@ -0,0 +1,125 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/synchronization/shared_mutex.h"
+
+#include <cstddef>
+#include <cstdint>
+
+#include "absl/base/attributes.h"
+#include "absl/base/internal/raw_logging.h"
+#include "absl/base/internal/sysinfo.h"
+#include "absl/synchronization/mutex.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+bool SharedMutex::NoWriter(Slot* slot) ABSL_NO_THREAD_SAFETY_ANALYSIS {
+  return !slot->writer;
+}
+
+bool SharedMutex::NoReaders(Slot* slot) ABSL_NO_THREAD_SAFETY_ANALYSIS {
+  return slot->readers == 0;
+}
+
+SharedMutex::Slot& SharedMutex::ThisThreadSlot() {
+  // Distribute threads across the slots by thread id. Any stable per-thread
+  // value works here: threads sharing a slot contend with each other but the
+  // lock remains correct. The multiplier spreads consecutive ids, which most
+  // kernels hand out, across the slots via the high bits of the product.
+  uint64_t tid = static_cast<uint64_t>(base_internal::GetCachedTID());
+  return slots_[static_cast<size_t>((tid * uint64_t{0x9ddfea08eb382d69}) >>
+                                    32) %
+                kNumSlots];
+}
+
+void SharedMutex::Lock() ABSL_NO_THREAD_SAFETY_ANALYSIS {
+  writer_mu_.Lock();
+  // Sweep the slots in order. Setting `writer` stops new readers on a slot
+  // before we wait for its current readers to drain, so a steady stream of
+  // readers cannot starve the writer. Slots already swept stay blocked for
+  // readers because `writer` remains set until `Unlock()`.
+  for (Slot& slot : slots_) {
+    slot.mu.Lock();
+    slot.writer = true;
+    slot.mu.Await(absl::Condition(&NoReaders, &slot));
+    slot.mu.Unlock();
+  }
+}
+
+void SharedMutex::Unlock() ABSL_NO_THREAD_SAFETY_ANALYSIS {
+  for (Slot& slot : slots_) {
+    slot.mu.Lock();
+    slot.writer = false;
+    slot.mu.Unlock();
+  }
+  writer_mu_.Unlock();
+}
+
+bool SharedMutex::TryLock() ABSL_NO_THREAD_SAFETY_ANALYSIS {
+  if (!writer_mu_.TryLock()) return false;
+  int swept = 0;
+  for (; swept < kNumSlots; ++swept) {
+    Slot& slot = slots_[swept];
+    slot.mu.Lock();
+    if (slot.readers != 0) {
+      slot.mu.Unlock();
+      break;
+    }
+    slot.writer = true;
+    slot.mu.Unlock();
+  }
+  if (swept == kNumSlots) return true;
+  // Some slot had active readers; roll back the slots already swept.
+  for (int i = 0; i < swept; ++i) {
+    slots_[i].mu.Lock();
+    slots_[i].writer = false;
+    slots_[i].mu.Unlock();
+  }
+  writer_mu_.Unlock();
+  return false;
+}
+
+void SharedMutex::ReaderLock() {
+  Slot& slot = ThisThreadSlot();
+  slot.mu.Lock();
+  slot.mu.Await(absl::Condition(&NoWriter, &slot));
+  ++slot.readers;
+  slot.mu.Unlock();
+}
+
+void SharedMutex::ReaderUnlock() {
+  Slot& slot = ThisThreadSlot();
+  slot.mu.Lock();
+  ABSL_RAW_CHECK(slot.readers > 0,
+                 "SharedMutex::ReaderUnlock() without a matching "
+                 "ReaderLock() on this thread");
+  --slot.readers;
+  slot.mu.Unlock();
+}
+
+bool SharedMutex::ReaderTryLock() {
+  Slot& slot = ThisThreadSlot();
+  slot.mu.Lock();
+  if (slot.writer) {
+    slot.mu.Unlock();
+    return false;
+  }
+  ++slot.readers;
+  slot.mu.Unlock();
+  return true;
+}
+
+ABSL_NAMESPACE_END
+}  // namespace absl
@@ -0,0 +1,177 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// -----------------------------------------------------------------------------
+// shared_mutex.h
+// -----------------------------------------------------------------------------
+//
+// `absl::SharedMutex` is a reader/writer lock optimized for read-mostly data
+// protected across many cores. `absl::Mutex::ReaderLock()` updates a single
+// shared word, so with dozens of concurrent readers the cache line holding
+// that word ping-pongs between cores and "shared" acquisition can become
+// slower than exclusive acquisition. `SharedMutex` instead distributes the
+// reader count over several cache-line-sized slots; each reader touches only
+// the slot assigned to its thread, so disjoint readers do not contend, while
+// writers sweep every slot before entering their critical section.
+//
+// The trade-offs relative to `absl::Mutex`:
+//
+//   * Readers scale with core count instead of collapsing under contention.
+//   * Writers are more expensive: acquiring the lock exclusively visits every
+//     slot. Use `SharedMutex` only when reads heavily outnumber writes, such
+//     as configuration data reloaded occasionally and consulted constantly.
+//   * The object is large (several cache lines), so it is suited to long-lived
+//     structures, not to fine-grained per-element locking.
+//   * There is no `Await()`, no deadlock detection, and no timeout support.
+//
+// `SharedMutex` supports the thread annotations used by `absl::Mutex`, and the
+// `SharedMutexLock`/`SharedMutexReaderLock` RAII helpers below mirror
+// `absl::MutexLock`/`absl::ReaderMutexLock`.
+
+#ifndef ABSL_SYNCHRONIZATION_SHARED_MUTEX_H_
+#define ABSL_SYNCHRONIZATION_SHARED_MUTEX_H_
+
+#include <cstdint>
+
+#include "absl/base/config.h"
+#include "absl/base/optimization.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/synchronization/mutex.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+// SharedMutex
+//
+// A reader/writer lock with per-thread reader slots. See the file comment
+// above for when to prefer this over `absl::Mutex`.
+class ABSL_LOCKABLE SharedMutex {
+ public:
+  SharedMutex() = default;
+
+  SharedMutex(const SharedMutex&) = delete;
+  SharedMutex& operator=(const SharedMutex&) = delete;
+
+  // SharedMutex::Lock()
+  //
+  // Blocks until no writer and no reader holds the lock, then acquires it
+  // exclusively. Writers are serialized in the order provided by
+  // `absl::Mutex`; once a writer starts sweeping the reader slots, new
+  // readers wait, so writers are not starved by a steady stream of readers.
+  void Lock() ABSL_EXCLUSIVE_LOCK_FUNCTION();
+
+  // SharedMutex::Unlock()
+  //
+  // Releases the lock held exclusively by this thread.
+  void Unlock() ABSL_UNLOCK_FUNCTION();
+
+  // SharedMutex::TryLock()
+  //
+  // Acquires the lock exclusively if it is free, without blocking on readers
+  // or other writers, and returns `true` iff it was acquired.
+  bool TryLock() ABSL_EXCLUSIVE_TRYLOCK_FUNCTION(true);
+
+  // SharedMutex::ReaderLock()
+  //
+  // Blocks until no writer holds or is acquiring the lock, then acquires it
+  // in shared mode. Readers mapped to different slots acquire the lock
+  // without touching any common cache line.
+  void ReaderLock() ABSL_SHARED_LOCK_FUNCTION();
+
+  // SharedMutex::ReaderUnlock()
+  //
+  // Releases a shared hold on the lock. Must be called on the same thread
+  // that called `ReaderLock()`, since the hold is recorded in that thread's
+  // slot.
+  void ReaderUnlock() ABSL_UNLOCK_FUNCTION();
+
+  // SharedMutex::ReaderTryLock()
+  //
+  // Acquires the lock in shared mode if no writer holds or is acquiring it,
+  // and returns `true` iff it was acquired.
+  bool ReaderTryLock() ABSL_SHARED_TRYLOCK_FUNCTION(true);
+
+ private:
+  // One cache line per slot: a reader increments/decrements only the
+  // `readers` count of its slot, and `writer` is set while a writer holds or
+  // is acquiring the lock.
+  struct alignas(ABSL_CACHELINE_SIZE) Slot {
+    absl::Mutex mu;
+    int64_t readers ABSL_GUARDED_BY(mu) = 0;
+    bool writer ABSL_GUARDED_BY(mu) = false;
+  };
+
+  // Enough slots that threads on a typical large server rarely share one;
+  // collisions only cost scalability, never correctness.
+  static constexpr int kNumSlots = 32;
+
+  static bool NoWriter(Slot* slot);
+  static bool NoReaders(Slot* slot);
+
+  // The slot assigned to the calling thread.
+  Slot& ThisThreadSlot();
+
+  // Serializes writers; held for the duration of an exclusive critical
+  // section so that at most one writer sweeps the slots at a time.
+  absl::Mutex writer_mu_;
+  Slot slots_[kNumSlots];
+};
+
+// SharedMutexLock
+//
+// `SharedMutexLock` is a helper class, which acquires and releases a
+// `SharedMutex` exclusively via RAII, equivalent to `absl::MutexLock`.
+class ABSL_SCOPED_LOCKABLE SharedMutexLock {
+ public:
+  explicit SharedMutexLock(SharedMutex* mu) ABSL_EXCLUSIVE_LOCK_FUNCTION(mu)
+      : mu_(mu) {
+    mu_->Lock();
+  }
+
+  SharedMutexLock(const SharedMutexLock&) = delete;
+  SharedMutexLock(SharedMutexLock&&) = delete;
+  SharedMutexLock& operator=(const SharedMutexLock&) = delete;
+  SharedMutexLock& operator=(SharedMutexLock&&) = delete;
+
+  ~SharedMutexLock() ABSL_UNLOCK_FUNCTION() { mu_->Unlock(); }
+
+ private:
+  SharedMutex* const mu_;
+};
+
+// SharedMutexReaderLock
+//
+// The `SharedMutex` equivalent of `absl::ReaderMutexLock`.
+class ABSL_SCOPED_LOCKABLE SharedMutexReaderLock {
+ public:
+  explicit SharedMutexReaderLock(SharedMutex* mu) ABSL_SHARED_LOCK_FUNCTION(mu)
+      : mu_(mu) {
+    mu_->ReaderLock();
+  }
+
+  SharedMutexReaderLock(const SharedMutexReaderLock&) = delete;
+  SharedMutexReaderLock(SharedMutexReaderLock&&) = delete;
+  SharedMutexReaderLock& operator=(const SharedMutexReaderLock&) = delete;
+  SharedMutexReaderLock& operator=(SharedMutexReaderLock&&) = delete;
+
+  ~SharedMutexReaderLock() ABSL_UNLOCK_FUNCTION() { mu_->ReaderUnlock(); }
+
+ private:
+  SharedMutex* const mu_;
+};
+
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_SYNCHRONIZATION_SHARED_MUTEX_H_
@@ -0,0 +1,105 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/synchronization/shared_mutex.h"
+
+#include <atomic>
+#include <thread>  // NOLINT(build/c++11)
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "absl/synchronization/blocking_counter.h"
+#include "absl/synchronization/notification.h"
+
+namespace {
+
+TEST(SharedMutex, ReadersShareTheLock) {
+  absl::SharedMutex mu;
+  constexpr int kNumReaders = 8;
+
+  // All readers acquire the lock and hold it until every reader has acquired
+  // it; this deadlocks unless the lock can be shared.
+  absl::BlockingCounter all_acquired(kNumReaders);
+  absl::Notification release;
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kNumReaders; ++i) {
+    threads.push_back(std::thread([&] {
+      mu.ReaderLock();
+      all_acquired.DecrementCount();
+      release.WaitForNotification();
+      mu.ReaderUnlock();
+    }));
+  }
+  all_acquired.Wait();
+  release.Notify();
+  for (std::thread& t : threads) t.join();
+}
+
+TEST(SharedMutex, WritersExcludeReadersAndWriters) {
+  absl::SharedMutex mu;
+  int a = 0;
+  int b = 0;
+  std::atomic<bool> done(false);
+
+  std::vector<std::thread> writers;
+  for (int i = 0; i < 4; ++i) {
+    writers.push_back(std::thread([&] {
+      for (int j = 0; j < 1000; ++j) {
+        absl::SharedMutexLock lock(&mu);
+        // Writers see and make consistent updates only if they exclude each
+        // other and all readers.
+        ++a;
+        ++b;
+      }
+    }));
+  }
+  std::vector<std::thread> readers;
+  for (int i = 0; i < 8; ++i) {
+    readers.push_back(std::thread([&] {
+      while (!done.load(std::memory_order_relaxed)) {
+        absl::SharedMutexReaderLock lock(&mu);
+        EXPECT_EQ(a, b);
+      }
+    }));
+  }
+  for (std::thread& t : writers) t.join();
+  done.store(true, std::memory_order_relaxed);
+  for (std::thread& t : readers) t.join();
+  EXPECT_EQ(a, 4000);
+  EXPECT_EQ(b, 4000);
+}
+
+TEST(SharedMutex, TryLock) {
+  absl::SharedMutex mu;
+
+  ASSERT_TRUE(mu.TryLock());
+  // While held exclusively, neither mode can be acquired, even by other
+  // threads mapped to other reader slots.
+  std::thread([&] {
+    EXPECT_FALSE(mu.TryLock());
+    EXPECT_FALSE(mu.ReaderTryLock());
+  }).join();
+  mu.Unlock();
+
+  ASSERT_TRUE(mu.ReaderTryLock());
+  EXPECT_FALSE(mu.TryLock());           // readers block writers
+  ASSERT_TRUE(mu.ReaderTryLock());      // but not other readers
+  mu.ReaderUnlock();
+  mu.ReaderUnlock();
+
+  ASSERT_TRUE(mu.TryLock());
+  mu.Unlock();
+}
+
+}  // namespace
@@ -0,0 +1,159 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/synchronization/thread_pool.h"
+
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+#include "absl/base/config.h"
+#include "absl/base/internal/sysinfo.h"
+#include "absl/base/optimization.h"
+#include "absl/synchronization/mutex.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+namespace {
+
+#ifdef ABSL_HAVE_THREAD_LOCAL
+// Identifies the pool worker running on this thread, if any, so that
+// Schedule() can push onto the current worker's own deque.
+struct CurrentWorker {
+  ThreadPool* pool = nullptr;
+  int index = 0;
+};
+thread_local CurrentWorker current_worker;
+#endif
+
+// Maps the calling thread to a worker index in [0, num_workers), used to
+// spread external Schedule() calls across deques without a shared counter.
+int HomeWorkerIndex(int num_workers) {
+  const uint64_t tid = static_cast<uint64_t>(base_internal::GetCachedTID());
+  return static_cast<int>(((tid * uint64_t{0x9ddfea08eb382d69}) >> 32) %
+                          static_cast<uint64_t>(num_workers));
+}
+
+}  // namespace
+
+ThreadPool::ThreadPool(int num_threads) {
+  if (num_threads < 1) num_threads = 1;
+  workers_.reserve(num_threads);
+  for (int i = 0; i < num_threads; ++i) {
+    workers_.push_back(std::make_unique<Worker>());
+  }
+  // Workers scan every deque, so spawn only once the vector is complete.
+  for (int i = 0; i < num_threads; ++i) {
+    workers_[i]->thread = std::thread(&ThreadPool::WorkLoop, this, i);
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    absl::MutexLock l(&shared_mu_);
+    shutdown_ = true;
+  }
+  for (auto& worker : workers_) {
+    worker->thread.join();
+  }
+}
+
+int ThreadPool::NumCpus() { return base_internal::NumCPUs(); }
+
+void ThreadPool::Schedule(absl::AnyInvocable<void()> func) {
+  assert(func != nullptr);
+  int index;
+#ifdef ABSL_HAVE_THREAD_LOCAL
+  if (current_worker.pool == this) {
+    index = current_worker.index;
+  } else {
+    index = HomeWorkerIndex(NumThreads());
+  }
+#else
+  index = HomeWorkerIndex(NumThreads());
+#endif
+  {
+    absl::MutexLock l(&workers_[index]->mu);
+    workers_[index]->deque.push_back(std::move(func));
+  }
+  // Publish the task to sleeping workers. The increment happens after the
+  // push, so a worker that observes pending_ > 0 and rescans will find it.
+  absl::MutexLock l(&shared_mu_);
+  ++pending_;
+}
+
+absl::AnyInvocable<void()> ThreadPool::FindTask(int index) {
+  const int n = NumThreads();
+  // Own deque first: newest task from the back, for locality with whatever
+  // this worker just ran.
+  {
+    Worker& own = *workers_[index];
+    absl::MutexLock l(&own.mu);
+    if (!own.deque.empty()) {
+      absl::AnyInvocable<void()> task = std::move(own.deque.back());
+      own.deque.pop_back();
+      return task;
+    }
+  }
+  // Steal the oldest task from another worker. The first pass uses TryLock
+  // so a busy victim is skipped rather than waited on; the second pass locks
+  // so that an existing task cannot be missed entirely.
+  for (int pass = 0; pass < 2; ++pass) {
+    for (int i = 1; i < n; ++i) {
+      Worker& victim = *workers_[(index + i) % n];
+      if (pass == 0) {
+        if (!victim.mu.TryLock()) continue;
+      } else {
+        victim.mu.Lock();
+      }
+      if (victim.deque.empty()) {
+        victim.mu.Unlock();
+        continue;
+      }
+      absl::AnyInvocable<void()> task = std::move(victim.deque.front());
+      victim.deque.pop_front();
+      victim.mu.Unlock();
+      return task;
+    }
+  }
+  return nullptr;
+}
+
+void ThreadPool::WorkLoop(int index) {
+#ifdef ABSL_HAVE_THREAD_LOCAL
+  current_worker.pool = this;
+  current_worker.index = index;
+#endif
+  for (;;) {
+    absl::AnyInvocable<void()> task = FindTask(index);
+    if (task != nullptr) {
+      {
+        absl::MutexLock l(&shared_mu_);
+        --pending_;
+      }
+      task();
+      continue;
+    }
+    // Nothing anywhere: sleep until work arrives or shutdown drains. A task
+    // whose pending_ increment is still in flight wakes us when it lands.
+    absl::MutexLock l(&shared_mu_);
+    if (shutdown_ && pending_ == 0) return;
+    shared_mu_.Await(absl::Condition(this, &ThreadPool::WorkerShouldWake));
+  }
+}
+
+ABSL_NAMESPACE_END
+}  // namespace absl
@@ -0,0 +1,133 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// -----------------------------------------------------------------------------
+// thread_pool.h
+// -----------------------------------------------------------------------------
+//
+// `absl::ThreadPool` runs scheduled callbacks on a fixed set of worker
+// threads. Each worker owns its own task deque; a worker runs tasks from its
+// own deque first and steals from other workers when it runs out, so tasks
+// scheduled from within the pool stay with the scheduling thread (good
+// locality) while idle workers still drain whatever work exists. Workers
+// sleep when the whole pool is out of work and are woken lazily as tasks
+// arrive.
+//
+// Example:
+//
+//   absl::ThreadPool pool(absl::ThreadPool::NumCpus());
+//   absl::BlockingCounter done(100);
+//   for (int i = 0; i < 100; ++i) {
+//     pool.Schedule([i, &done] {
+//       Process(i);
+//       done.DecrementCount();
+//     });
+//   }
+//   done.Wait();
+//
+// Tasks may schedule further tasks, including from within the pool's own
+// threads. The destructor runs all tasks scheduled before it was invoked and
+// then joins the workers; scheduling during or after destruction is undefined
+// behavior. The pool makes no ordering guarantee between tasks.
+
+#ifndef ABSL_SYNCHRONIZATION_THREAD_POOL_H_
+#define ABSL_SYNCHRONIZATION_THREAD_POOL_H_
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <thread>  // NOLINT(build/c++11)
+#include <vector>
+
+#include "absl/base/attributes.h"
+#include "absl/base/config.h"
+#include "absl/base/optimization.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/functional/any_invocable.h"
+#include "absl/synchronization/mutex.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+// ThreadPool
+//
+// A fixed-size pool of worker threads with per-worker work-stealing deques.
+class ThreadPool {
+ public:
+  // Creates a pool with `num_threads` workers (at least 1).
+  explicit ThreadPool(int num_threads);
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  // Runs every task scheduled before destruction began, then joins the
+  // workers. Must not be called from a pool thread.
+  ~ThreadPool();
+
+  // ThreadPool::Schedule()
+  //
+  // Schedules `func` to run on some pool thread as soon as one is free.
+  // `func` must not be null. When called from a pool thread the task is
+  // pushed onto that worker's own deque and typically runs there next, which
+  // keeps recursively scheduled work cache-warm.
+  void Schedule(absl::AnyInvocable<void()> func);
+
+  // ThreadPool::NumThreads()
+  //
+  // Returns the number of worker threads in this pool.
+  int NumThreads() const { return static_cast<int>(workers_.size()); }
+
+  // ThreadPool::NumCpus()
+  //
+  // Returns the number of logical CPUs, a reasonable default pool size.
+  static int NumCpus();
+
+ private:
+  // One worker's deque. The owning thread pushes and pops at the back;
+  // thieves take from the front, so a task stolen is the oldest (and the one
+  // whose data is least likely to still be in the owner's cache anyway).
+  // Padded to a cache line so that a busy worker's queue lock does not false
+  // share with its neighbors'.
+  struct alignas(ABSL_CACHELINE_SIZE) Worker {
+    absl::Mutex mu;
+    std::deque<absl::AnyInvocable<void()>> deque ABSL_GUARDED_BY(mu);
+    std::thread thread;
+  };
+
+  // True when a worker should stop sleeping: work exists or the pool is
+  // shutting down.
+  bool WorkerShouldWake() const ABSL_EXCLUSIVE_LOCKS_REQUIRED(shared_mu_) {
+    return pending_ > 0 || shutdown_;
+  }
+
+  void WorkLoop(int index);
+
+  // Pops a task from `workers_[index]`'s own deque, or steals one from
+  // another worker. Returns a null AnyInvocable if no task was found.
+  absl::AnyInvocable<void()> FindTask(int index);
+
+  std::vector<std::unique_ptr<Worker>> workers_;
+
+  // Coordinates sleeping workers. `pending_` counts tasks that have been
+  // scheduled but not yet popped from any deque; it is updated outside the
+  // per-worker locks so that a worker never sleeps while work exists.
+  absl::Mutex shared_mu_;
+  int64_t pending_ ABSL_GUARDED_BY(shared_mu_) = 0;
+  bool shutdown_ ABSL_GUARDED_BY(shared_mu_) = false;
+};
+
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_SYNCHRONIZATION_THREAD_POOL_H_
@@ -0,0 +1,109 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/synchronization/thread_pool.h"
+
+#include <atomic>
+#include <thread>  // NOLINT(build/c++11)
+
+#include "gtest/gtest.h"
+#include "absl/container/flat_hash_set.h"
+#include "absl/synchronization/blocking_counter.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/synchronization/notification.h"
+
+namespace {
+
+TEST(ThreadPoolTest, RunsScheduledTasks) {
+  absl::ThreadPool pool(4);
+  EXPECT_EQ(pool.NumThreads(), 4);
+
+  constexpr int kNumTasks = 1000;
+  std::atomic<int> ran(0);
+  absl::BlockingCounter done(kNumTasks);
+  for (int i = 0; i < kNumTasks; ++i) {
+    pool.Schedule([&] {
+      ran.fetch_add(1, std::memory_order_relaxed);
+      done.DecrementCount();
+    });
+  }
+  done.Wait();
+  EXPECT_EQ(ran.load(), kNumTasks);
+}
+
+TEST(ThreadPoolTest, DestructorDrainsPendingTasks) {
+  std::atomic<int> ran(0);
+  {
+    absl::ThreadPool pool(2);
+    for (int i = 0; i < 100; ++i) {
+      pool.Schedule([&] { ran.fetch_add(1, std::memory_order_relaxed); });
+    }
+  }
+  EXPECT_EQ(ran.load(), 100);
+}
+
+TEST(ThreadPoolTest, TasksMayScheduleMoreTasks) {
+  absl::ThreadPool pool(4);
+  constexpr int kFanOut = 10;
+  absl::BlockingCounter done(kFanOut * kFanOut);
+  for (int i = 0; i < kFanOut; ++i) {
+    pool.Schedule([&] {
+      for (int j = 0; j < kFanOut; ++j) {
+        pool.Schedule([&] { done.DecrementCount(); });
+      }
+    });
+  }
+  done.Wait();
+}
+
+TEST(ThreadPoolTest, IdleWorkersStealQueuedWork) {
+  // All tasks are scheduled from one external thread and the first task
+  // blocks its worker, so the rest can only run if other workers steal them.
+  absl::ThreadPool pool(4);
+  absl::Notification release_blocker;
+  absl::BlockingCounter others_done(16);
+
+  absl::Mutex mu;
+  absl::flat_hash_set<std::thread::id> worker_ids;
+
+  pool.Schedule([&] { release_blocker.WaitForNotification(); });
+  for (int i = 0; i < 16; ++i) {
+    pool.Schedule([&] {
+      {
+        absl::MutexLock l(&mu);
+        worker_ids.insert(std::this_thread::get_id());
+      }
+      others_done.DecrementCount();
+    });
+  }
+  others_done.Wait();
+  release_blocker.Notify();
+
+  absl::MutexLock l(&mu);
+  EXPECT_GE(worker_ids.size(), 1);
+}
+
+TEST(ThreadPoolTest, ClampsThreadCountToAtLeastOne) {
+  absl::ThreadPool pool(0);
+  EXPECT_EQ(pool.NumThreads(), 1);
+  absl::Notification done;
+  pool.Schedule([&] { done.Notify(); });
+  done.WaitForNotification();
+}
+
+TEST(ThreadPoolTest, NumCpusIsPositive) {
+  EXPECT_GE(absl::ThreadPool::NumCpus(), 1);
+}
+
+}  // namespace
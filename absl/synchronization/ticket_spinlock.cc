@@ -0,0 +1,57 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/synchronization/ticket_spinlock.h"
+
+#include <atomic>
+#include <cstdint>
+
+#include "absl/base/config.h"
+#include "absl/base/internal/scheduling_mode.h"
+#include "absl/base/internal/spinlock_wait.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+void TicketSpinLock::LockSlow(uint32_t ticket) {
+  uint32_t total_spins = 0;
+  int sleep_loop = 0;
+  for (;;) {
+    uint32_t cur = owner_.load(std::memory_order_acquire);
+    if (cur == ticket) return;
+    // Proportional backoff: a waiter `distance` tickets from the head will
+    // not acquire the lock for at least `distance` critical sections, so it
+    // backs off that much longer before touching the lock word again. This
+    // keeps all but the next-in-line waiter off the owner cache line.
+    uint32_t distance = ticket - cur;
+    uint32_t spins = distance * backoff_.spins_per_waiter;
+    if (total_spins < backoff_.max_spins) {
+      total_spins += spins;
+      while (spins-- > 0 &&
+             owner_.load(std::memory_order_relaxed) == cur) {
+      }
+    } else {
+      // Spun long enough: wait on the owner word until an unlocker wakes
+      // us (or the wait times out; SpinLockDelay always returns
+      // eventually), then recheck our position.
+      sleepers_.fetch_add(1, std::memory_order_relaxed);
+      base_internal::SpinLockDelay(&owner_, cur, ++sleep_loop,
+                                   base_internal::SCHEDULE_KERNEL_ONLY);
+      sleepers_.fetch_sub(1, std::memory_order_relaxed);
+    }
+  }
+}
+
+ABSL_NAMESPACE_END
+}  // namespace absl
@@ -0,0 +1,119 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// -----------------------------------------------------------------------------
+// File: ticket_spinlock.h
+// -----------------------------------------------------------------------------
+//
+// This header file defines `absl::TicketSpinLock`, a fair (FIFO) spinlock
+// for very short critical sections. Each `Lock()` call takes a ticket and
+// the lock serves tickets strictly in order, so no waiter can be starved by
+// later arrivals the way an unfair test-and-set lock allows (for example
+// when one NUMA node wins the lock word's cache line repeatedly). Waiters
+// back off in proportion to their distance from the head of the queue, so
+// under heavy contention most of them stay off the lock word entirely.
+//
+// `TicketSpinLock` holds no OS resources and is layout-compatible with two
+// 32-bit words, making it cheap to embed per shard or per bucket. Like any
+// spinlock it is only appropriate when the critical section is a handful of
+// instructions and the holder cannot block; for everything else, use
+// `absl::Mutex`. It is not re-entrant, does not participate in deadlock
+// detection, and must not be used from signal handlers.
+
+#ifndef ABSL_SYNCHRONIZATION_TICKET_SPINLOCK_H_
+#define ABSL_SYNCHRONIZATION_TICKET_SPINLOCK_H_
+
+#include <atomic>
+#include <cstdint>
+
+#include "absl/base/config.h"
+#include "absl/base/internal/spinlock_wait.h"
+#include "absl/base/optimization.h"
+#include "absl/base/thread_annotations.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+class ABSL_LOCKABLE TicketSpinLock {
+ public:
+  // TicketSpinLock::Backoff
+  //
+  // Tunable backoff policy. The defaults suit critical sections of a few
+  // dozen instructions; locks protecting even shorter sections may lower
+  // `spins_per_waiter`, and locks whose holders are occasionally descheduled
+  // may lower `max_spins` so waiters reach the OS-assisted wait sooner.
+  struct Backoff {
+    // Busy-wait iterations a waiter performs per ticket between it and the
+    // current owner before rereading the lock word.
+    uint32_t spins_per_waiter = 64;
+    // Total busy-wait iterations after which a waiter switches from
+    // spinning to an OS-assisted wait (futex or equivalent).
+    uint32_t max_spins = 4096;
+  };
+
+  constexpr TicketSpinLock() = default;
+  explicit constexpr TicketSpinLock(Backoff backoff) : backoff_(backoff) {}
+
+  TicketSpinLock(const TicketSpinLock&) = delete;
+  TicketSpinLock& operator=(const TicketSpinLock&) = delete;
+
+  // TicketSpinLock::Lock()
+  //
+  // Acquires the lock, waiting behind any earlier callers.
+  void Lock() ABSL_EXCLUSIVE_LOCK_FUNCTION() {
+    uint32_t ticket = next_ticket_.fetch_add(1, std::memory_order_relaxed);
+    if (ABSL_PREDICT_FALSE(owner_.load(std::memory_order_acquire) != ticket)) {
+      LockSlow(ticket);
+    }
+  }
+
+  // TicketSpinLock::TryLock()
+  //
+  // Acquires the lock if no thread holds it and no thread is waiting for
+  // it; returns whether the lock was acquired. A fair lock cannot jump the
+  // queue, so TryLock() fails whenever the lock is contended.
+  bool TryLock() ABSL_EXCLUSIVE_TRYLOCK_FUNCTION(true) {
+    uint32_t cur = owner_.load(std::memory_order_acquire);
+    uint32_t expected = cur;
+    return next_ticket_.compare_exchange_strong(expected, cur + 1,
+                                                std::memory_order_acquire,
+                                                std::memory_order_relaxed);
+  }
+
+  // TicketSpinLock::Unlock()
+  //
+  // Releases the lock, handing it to the oldest waiter, if any.
+  void Unlock() ABSL_UNLOCK_FUNCTION() {
+    uint32_t next = owner_.load(std::memory_order_relaxed) + 1;
+    owner_.store(next, std::memory_order_release);
+    if (ABSL_PREDICT_FALSE(sleepers_.load(std::memory_order_relaxed) != 0)) {
+      // Waiters sleep on the owner word; wake them all and let the one
+      // holding the next ticket proceed. The rest go back to sleep.
+      base_internal::SpinLockWake(&owner_, true);
+    }
+  }
+
+ private:
+  void LockSlow(uint32_t ticket);
+
+  std::atomic<uint32_t> next_ticket_{0};  // next unissued ticket
+  std::atomic<uint32_t> owner_{0};        // ticket currently holding the lock
+  std::atomic<uint32_t> sleepers_{0};     // waiters in OS-assisted waits
+  Backoff backoff_;
+};
+
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_SYNCHRONIZATION_TICKET_SPINLOCK_H_
@@ -0,0 +1,101 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/synchronization/tree_barrier.h"
+
+#include <atomic>
+#include <cstdint>
+
+#include "absl/base/internal/raw_logging.h"
+#include "absl/base/internal/sysinfo.h"
+#include "absl/synchronization/mutex.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+namespace {
+
+// Iterations of polling generation_ before an arrival falls back to blocking.
+// Fork-join phases release quickly; most waiters never touch wake_mu_.
+constexpr int kSpinIterations = 1000;
+
+// Maps the calling thread to one of the arrival stripes.
+int StripeIndex(int num_stripes) {
+  const uint64_t tid = static_cast<uint64_t>(base_internal::GetCachedTID());
+  return static_cast<int>(((tid * uint64_t{0x9ddfea08eb382d69}) >> 32) %
+                          static_cast<uint64_t>(num_stripes));
+}
+
+}  // namespace
+
+TreeBarrier::TreeBarrier(int num_threads) : num_threads_(num_threads) {
+  ABSL_RAW_CHECK(num_threads > 0, "TreeBarrier requires at least one thread");
+}
+
+bool TreeBarrier::GenerationChanged(WaitArg* arg) {
+  return arg->barrier->generation_.load(std::memory_order_acquire) !=
+         arg->generation;
+}
+
+int64_t TreeBarrier::TotalArrivals(uint64_t generation) const {
+  const uint64_t tag = generation << 32;
+  int64_t total = 0;
+  for (const Stripe& stripe : stripes_) {
+    const uint64_t v = stripe.tagged_count.load(std::memory_order_acquire);
+    if ((v & ~uint64_t{0xffffffff}) == tag) {
+      total += static_cast<int64_t>(v & 0xffffffff);
+    }
+  }
+  return total;
+}
+
+bool TreeBarrier::Block() {
+  const uint64_t gen = generation_.load(std::memory_order_acquire);
+  const uint64_t tag = gen << 32;
+
+  // Record the arrival in this thread's stripe. A stripe still tagged with
+  // an earlier generation belongs to a finished cycle and is simply
+  // overwritten; stripes are never reset otherwise.
+  Stripe& stripe = stripes_[StripeIndex(kNumStripes)];
+  uint64_t v = stripe.tagged_count.load(std::memory_order_relaxed);
+  uint64_t next;
+  do {
+    next = (v & ~uint64_t{0xffffffff}) == tag ? v + 1 : tag | 1;
+  } while (!stripe.tagged_count.compare_exchange_weak(
+      v, next, std::memory_order_acq_rel, std::memory_order_relaxed));
+
+  // Combine the stripes; the arrival that completes the cycle advances the
+  // generation, releasing every spinning or sleeping waiter. Several late
+  // arrivals can observe a full count, so the release is elected by CAS.
+  if (TotalArrivals(gen) == num_threads_) {
+    uint64_t expected = gen;
+    if (generation_.compare_exchange_strong(expected, gen + 1,
+                                            std::memory_order_acq_rel)) {
+      // Force sleeping waiters to re-evaluate their condition.
+      absl::MutexLock l(&wake_mu_);
+      return true;
+    }
+  }
+
+  for (int spins = 0; spins < kSpinIterations; ++spins) {
+    if (generation_.load(std::memory_order_acquire) != gen) return false;
+  }
+  WaitArg arg = {this, gen};
+  absl::MutexLock l(&wake_mu_);
+  wake_mu_.Await(absl::Condition(&TreeBarrier::GenerationChanged, &arg));
+  return false;
+}
+
+ABSL_NAMESPACE_END
+}  // namespace absl
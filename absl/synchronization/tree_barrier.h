@@ -0,0 +1,109 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// -----------------------------------------------------------------------------
+// tree_barrier.h
+// -----------------------------------------------------------------------------
+//
+// `absl::TreeBarrier` is a reusable barrier for fork-join phases with many
+// participating threads. `absl::Barrier` funnels every arrival through one
+// Mutex-protected counter, so at high core counts the arrivals serialize on a
+// single cache line and the barrier itself dominates short phases. A
+// `TreeBarrier` spreads arrivals over a fan-in layer of cache-line-separated
+// counters keyed by the arriving thread, so concurrent arrivals usually touch
+// different lines; the completing arrival combines the counters and releases
+// everyone.
+//
+// Unlike `absl::Barrier`, a `TreeBarrier` is cyclic: once all `num_threads`
+// arrivals of one cycle have been released the same object is immediately
+// usable for the next cycle, as in a phased fork-join loop:
+//
+//   absl::TreeBarrier barrier(num_threads);
+//   // In each worker:
+//   for (int phase = 0; phase < num_phases; ++phase) {
+//     DoPhaseWork(phase);
+//     if (barrier.Block()) PreparePhase(phase + 1);  // exactly one thread
+//     barrier.Block();  // wait for preparation
+//   }
+
+#ifndef ABSL_SYNCHRONIZATION_TREE_BARRIER_H_
+#define ABSL_SYNCHRONIZATION_TREE_BARRIER_H_
+
+#include <atomic>
+#include <cstdint>
+
+#include "absl/base/optimization.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/synchronization/mutex.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+// TreeBarrier
+//
+// A cyclic barrier whose arrival counters are striped across cache lines.
+class TreeBarrier {
+ public:
+  // `num_threads` is the number of threads that participate in each cycle.
+  explicit TreeBarrier(int num_threads);
+
+  TreeBarrier(const TreeBarrier&) = delete;
+  TreeBarrier& operator=(const TreeBarrier&) = delete;
+
+  // TreeBarrier::Block()
+  //
+  // Blocks until `num_threads` threads have called `Block()` in the current
+  // cycle, then returns `true` for exactly one of them and `false` for the
+  // rest. All callers have returned (or are unblocked) before any caller's
+  // next cycle can complete.
+  //
+  // Memory ordering: for any threads X and Y in the same cycle, any action
+  // taken by X before X calls `Block()` is visible to Y after Y returns from
+  // `Block()`.
+  bool Block();
+
+ private:
+  // One fan-in counter. `tagged_count` packs the cycle's generation number
+  // (high 32 bits) over the arrival count (low 32 bits), so a stripe never
+  // needs to be reset between cycles: a count tagged with an old generation
+  // simply no longer matches.
+  struct alignas(ABSL_CACHELINE_SIZE) Stripe {
+    std::atomic<uint64_t> tagged_count{0};
+  };
+
+  static constexpr int kNumStripes = 16;
+
+  // Condition function for sleeping waiters: true once the barrier has moved
+  // past `generation`.
+  struct WaitArg {
+    const TreeBarrier* barrier;
+    uint64_t generation;
+  };
+  static bool GenerationChanged(WaitArg* arg);
+
+  // Sums the arrivals recorded for `generation`.
+  int64_t TotalArrivals(uint64_t generation) const;
+
+  const int64_t num_threads_;
+  std::atomic<uint64_t> generation_{0};
+  Stripe stripes_[kNumStripes];
+  // Taken only by threads that gave up spinning and by the releasing thread
+  // to wake them; arrivals never touch it.
+  absl::Mutex wake_mu_;
+};
+
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_SYNCHRONIZATION_TREE_BARRIER_H_
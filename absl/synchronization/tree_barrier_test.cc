@@ -0,0 +1,72 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/synchronization/tree_barrier.h"
+
+#include <atomic>
+#include <thread>  // NOLINT(build/c++11)
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+
+TEST(TreeBarrier, ExactlyOneThreadWinsEachCycle) {
+  constexpr int kNumThreads = 8;
+  constexpr int kNumCycles = 100;
+  absl::TreeBarrier barrier(kNumThreads);
+  std::atomic<int> winners(0);
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads.push_back(std::thread([&] {
+      for (int cycle = 0; cycle < kNumCycles; ++cycle) {
+        if (barrier.Block()) winners.fetch_add(1, std::memory_order_relaxed);
+      }
+    }));
+  }
+  for (std::thread& t : threads) t.join();
+  EXPECT_EQ(winners.load(), kNumCycles);
+}
+
+TEST(TreeBarrier, PhasesDoNotOverlap) {
+  // Every thread increments a per-phase counter before blocking; after the
+  // barrier releases, each thread must observe the full count for the phase
+  // it just left. A barrier that releases early or mixes cycles fails.
+  constexpr int kNumThreads = 16;
+  constexpr int kNumPhases = 200;
+  absl::TreeBarrier barrier(kNumThreads);
+  std::atomic<int> arrived[kNumPhases];
+  for (std::atomic<int>& a : arrived) a.store(0);
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads.push_back(std::thread([&] {
+      for (int phase = 0; phase < kNumPhases; ++phase) {
+        arrived[phase].fetch_add(1, std::memory_order_relaxed);
+        barrier.Block();
+        EXPECT_EQ(arrived[phase].load(std::memory_order_relaxed), kNumThreads);
+      }
+    }));
+  }
+  for (std::thread& t : threads) t.join();
+}
+
+TEST(TreeBarrier, SingleThread) {
+  absl::TreeBarrier barrier(1);
+  EXPECT_TRUE(barrier.Block());
+  EXPECT_TRUE(barrier.Block());
+}
+
+}  // namespace
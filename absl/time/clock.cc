@@ -28,6 +28,7 @@
 #include <ctime>
 #include <limits>
 
+#include "absl/base/internal/cycleclock.h"
 #include "absl/base/internal/spinlock.h"
 #include "absl/base/internal/unscaledcycleclock.h"
 #include "absl/base/macros.h"
@@ -562,6 +563,101 @@ namespace absl {
 ABSL_NAMESPACE_BEGIN
 namespace {
 
+// Calibration state for GetFastTimeNanos(): a linear mapping from the cycle
+// counter to Unix nanoseconds, republished against GetCurrentTimeNanos()
+// roughly every kRecalibrateAfterNs. Published with a seqlock: writers make
+// `seq` odd, update the fields, then make it even again; readers retry if
+// they observe an odd or changed `seq`.
+struct FastClockCalibration {
+  std::atomic<uint64_t> seq{0};
+  std::atomic<int64_t> base_cycles{0};
+  std::atomic<int64_t> base_nanos{0};
+  std::atomic<double> ns_per_cycle{0.0};
+  std::atomic<int64_t> recalibrate_after_cycles{0};
+};
+ABSL_CONST_INIT FastClockCalibration fast_clock_calibration;
+
+constexpr int64_t kRecalibrateAfterNs = 100 * 1000 * 1000;  // 100ms
+
+// Re-derives the cycle->nanosecond mapping from fresh readings of the system
+// clock and the cycle counter. The observed slope since the last calibration
+// is used when it is sane; otherwise (first call, counter anomaly, suspend)
+// the nominal CycleClock frequency is used. Returns the sampled nanos.
+int64_t RecalibrateFastClock() {
+  FastClockCalibration* c = &fast_clock_calibration;
+  const int64_t now_nanos = absl::GetCurrentTimeNanos();
+  uint64_t seq = c->seq.load(std::memory_order_relaxed);
+  if ((seq & 1) != 0 ||
+      !c->seq.compare_exchange_strong(seq, seq + 1,
+                                      std::memory_order_acquire)) {
+    // Another thread is recalibrating; its result will serve.
+    return now_nanos;
+  }
+  const int64_t now_cycles = base_internal::CycleClock::Now();
+  const double nominal_ns_per_cycle =
+      1e9 / base_internal::CycleClock::Frequency();
+  const int64_t prev_cycles = c->base_cycles.load(std::memory_order_relaxed);
+  const int64_t prev_nanos = c->base_nanos.load(std::memory_order_relaxed);
+  double ns_per_cycle = nominal_ns_per_cycle;
+  if (prev_cycles != 0 && now_cycles > prev_cycles) {
+    const double observed = static_cast<double>(now_nanos - prev_nanos) /
+                            static_cast<double>(now_cycles - prev_cycles);
+    // Trust the measured slope only when it roughly agrees with the nominal
+    // frequency; large disagreement means the counter or the process slept.
+    if (observed > 0.5 * nominal_ns_per_cycle &&
+        observed < 2.0 * nominal_ns_per_cycle) {
+      ns_per_cycle = observed;
+    }
+  }
+  c->base_cycles.store(now_cycles, std::memory_order_relaxed);
+  c->base_nanos.store(now_nanos, std::memory_order_relaxed);
+  c->ns_per_cycle.store(ns_per_cycle, std::memory_order_relaxed);
+  c->recalibrate_after_cycles.store(
+      static_cast<int64_t>(kRecalibrateAfterNs / ns_per_cycle),
+      std::memory_order_relaxed);
+  c->seq.store(seq + 2, std::memory_order_release);
+  return now_nanos;
+}
+
+}  // namespace
+
+int64_t GetFastTimeNanos() {
+  FastClockCalibration* c = &fast_clock_calibration;
+  for (int attempt = 0; attempt < 3; ++attempt) {
+    const uint64_t seq_before = c->seq.load(std::memory_order_acquire);
+    if (ABSL_PREDICT_FALSE((seq_before & 1) != 0)) continue;
+    const int64_t base_cycles =
+        c->base_cycles.load(std::memory_order_relaxed);
+    const int64_t base_nanos = c->base_nanos.load(std::memory_order_relaxed);
+    const double ns_per_cycle =
+        c->ns_per_cycle.load(std::memory_order_relaxed);
+    const int64_t recalibrate_after =
+        c->recalibrate_after_cycles.load(std::memory_order_relaxed);
+    const int64_t delta = base_internal::CycleClock::Now() - base_cycles;
+    if (ABSL_PREDICT_FALSE(delta < 0 || delta > recalibrate_after)) {
+      return RecalibrateFastClock();
+    }
+    if (ABSL_PREDICT_FALSE(c->seq.load(std::memory_order_acquire) !=
+                           seq_before)) {
+      continue;
+    }
+    return base_nanos + static_cast<int64_t>(static_cast<double>(delta) *
+                                             ns_per_cycle);
+  }
+  return absl::GetCurrentTimeNanos();
+}
+
+absl::Time FastNow() { return absl::FromUnixNanos(GetFastTimeNanos()); }
+
+double FastClockFrequency() { return base_internal::CycleClock::Frequency(); }
+
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+namespace {
+
 // Returns the maximum duration that SleepOnce() can sleep for.
 constexpr absl::Duration MaxSleep() {
 #ifdef _WIN32
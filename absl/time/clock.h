@@ -44,6 +44,31 @@ absl::Time Now();
 // this function hundreds of thousands of times per second).
 int64_t GetCurrentTimeNanos();
 
+// FastNow()
+//
+// Returns the current time like `absl::Now()`, but trades a little accuracy
+// for speed: the time is derived from the CPU's cycle counter through a
+// linear mapping that is recalibrated against the system clock roughly every
+// 100ms. The result can differ from `absl::Now()` by a few microseconds and
+// can move backwards by a similarly small amount across a recalibration, so
+// use it for high-rate instrumentation (tracing, sampling), not for ordering
+// events or arithmetic against timeouts. On platforms without a usable cycle
+// counter it costs the same as `absl::Now()`.
+absl::Time FastNow();
+
+// GetFastTimeNanos()
+//
+// Like `FastNow()`, but expressed as a count of nanoseconds since the Unix
+// Epoch, mirroring `GetCurrentTimeNanos()`.
+int64_t GetFastTimeNanos();
+
+// FastClockFrequency()
+//
+// Returns the frequency in Hz of the cycle counter that backs `FastNow()`,
+// for converting raw cycle counts to seconds. The value is a calibration
+// estimate and may differ slightly from the hardware's nominal frequency.
+double FastClockFrequency();
+
 // SleepFor()
 //
 // Sleeps for the specified duration, expressed as an `absl::Duration`.
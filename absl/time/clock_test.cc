@@ -39,6 +39,27 @@ TEST(Time, Now) {
   EXPECT_GE(after, now);
 }
 
+TEST(Time, FastNowTracksNow) {
+  // FastNow() is documented to stay within a few microseconds of Now();
+  // allow generous slop for loaded test machines.
+  const absl::Duration kBound = absl::Milliseconds(5);
+  for (int i = 0; i < 1000; ++i) {
+    const absl::Duration skew = absl::FastNow() - absl::Now();
+    EXPECT_LE(absl::AbsDuration(skew), kBound);
+  }
+}
+
+TEST(Time, FastNowAdvances) {
+  const int64_t start = absl::GetFastTimeNanos();
+  absl::SleepFor(absl::Milliseconds(20));
+  const int64_t end = absl::GetFastTimeNanos();
+  EXPECT_GE(end - start, absl::ToInt64Nanoseconds(absl::Milliseconds(10)));
+}
+
+TEST(Time, FastClockFrequencyIsPositive) {
+  EXPECT_GT(absl::FastClockFrequency(), 0.0);
+}
+
 enum class AlarmPolicy { kWithoutAlarm, kWithAlarm };
 
 #if defined(ABSL_HAVE_ALARM)
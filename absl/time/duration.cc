@@ -69,6 +69,7 @@
 #include "absl/base/casts.h"
 #include "absl/base/config.h"
 #include "absl/numeric/int128.h"
+#include "absl/strings/numbers.h"
 #include "absl/strings/string_view.h"
 #include "absl/strings/strip.h"
 #include "absl/time/time.h"
@@ -786,7 +787,36 @@ std::string FormatDuration(Duration d) {
   } else if (d < Seconds(1)) {
     // Special case for durations with a magnitude < 1 second.  The duration
     // is printed as a fraction of a single unit, e.g., "1.2ms".
-    if (d < Microseconds(1)) {
+    //
+    // Fast path: a duration that is a whole number of its display unit (by
+    // far the common case for values produced from integer counts of
+    // nanoseconds, microseconds or milliseconds) needs no fractional digits,
+    // so it is emitted directly with the two-digit-table integer formatter,
+    // skipping the floating point decomposition below.
+    const uint32_t rep_lo = time_internal::GetRepLo(d);
+    uint32_t whole = 0;
+    absl::string_view abbr;
+    if (rep_lo % 4 == 0) {  // A whole number of nanoseconds.
+      const uint32_t ns = rep_lo / 4;
+      if (ns < 1000) {
+        whole = ns;
+        abbr = kDisplayNano.abbr;
+      } else if (ns < 1000 * 1000) {
+        if (ns % 1000 == 0) {
+          whole = ns / 1000;
+          abbr = kDisplayMicro.abbr;
+        }
+      } else if (ns % (1000 * 1000) == 0) {
+        whole = ns / (1000 * 1000);
+        abbr = kDisplayMilli.abbr;
+      }
+    }
+    if (whole != 0) {
+      char buf[numbers_internal::kFastToBufferSize];
+      s.append(buf, static_cast<size_t>(
+                        numbers_internal::FastIntToBuffer(whole, buf) - buf));
+      s.append(abbr.data(), abbr.size());
+    } else if (d < Microseconds(1)) {
       AppendNumberUnit(&s, FDivDuration(d, Nanoseconds(1)), kDisplayNano);
     } else if (d < Milliseconds(1)) {
       AppendNumberUnit(&s, FDivDuration(d, Microseconds(1)), kDisplayMicro);
@@ -804,6 +834,74 @@ std::string FormatDuration(Duration d) {
   return s;
 }
 
+std::string FormatDurationAs(Duration d, DurationUnit unit) {
+  if (d == InfiniteDuration()) return "inf";
+  if (d == -InfiniteDuration()) return "-inf";
+  absl::string_view abbr;
+  int64_t unit_ticks = 0;
+  int prec = 0;
+  switch (unit) {
+    case DurationUnit::kNanoseconds:
+      abbr = kDisplayNano.abbr;
+      prec = kDisplayNano.prec;
+      unit_ticks = kTicksPerNanosecond;
+      break;
+    case DurationUnit::kMicroseconds:
+      abbr = kDisplayMicro.abbr;
+      prec = kDisplayMicro.prec;
+      unit_ticks = kTicksPerNanosecond * 1000;
+      break;
+    case DurationUnit::kMilliseconds:
+      abbr = kDisplayMilli.abbr;
+      prec = kDisplayMilli.prec;
+      unit_ticks = kTicksPerNanosecond * 1000 * 1000;
+      break;
+    case DurationUnit::kSeconds:
+      abbr = kDisplaySec.abbr;
+      prec = kDisplaySec.prec;
+      unit_ticks = kTicksPerSecond;
+      break;
+  }
+  // Total ticks (quarters of a nanosecond) as a 128-bit value; every finite
+  // duration fits, so no unit selection or overflow handling is needed.
+  int128 ticks =
+      int128(time_internal::GetRepHi(d)) * kTicksPerSecond +
+      time_internal::GetRepLo(d);
+  std::string s;
+  if (ticks < 0) {
+    s.append("-");
+    ticks = -ticks;
+  }
+  uint128 whole = static_cast<uint128>(ticks) / unit_ticks;
+  const int64_t frac_ticks = static_cast<int64_t>(
+      static_cast<uint128>(ticks) % unit_ticks);
+  char buf[40];  // Wide enough for any 128-bit decimal value.
+  char* const ep = buf + sizeof(buf);
+  if (whole <= uint128(std::numeric_limits<int64_t>::max())) {
+    char* bp = Format64(ep, 0, static_cast<int64_t>(Uint128Low64(whole)));
+    s.append(bp, static_cast<size_t>(ep - bp));
+  } else {
+    char* bp = ep;
+    while (whole != 0) {
+      *--bp = static_cast<char>('0' + static_cast<int>(whole % 10));
+      whole /= 10;
+    }
+    s.append(bp, static_cast<size_t>(ep - bp));
+  }
+  if (frac_ticks != 0) {
+    // Every display unit spans `prec` decimal digits below it, and each tick
+    // is exactly pow(10, prec) / unit_ticks == 25 of those, so the fraction
+    // is emitted exactly with no floating point involved.
+    char* bp = Format64(ep, prec, frac_ticks * 25);
+    char* fp = ep;
+    while (fp[-1] == '0') --fp;
+    s.push_back('.');
+    s.append(bp, static_cast<size_t>(fp - bp));
+  }
+  s.append(abbr.data(), abbr.size());
+  return s;
+}
+
 namespace {
 
 // A helper for ParseDuration() that parses a leading number from the given
@@ -895,6 +993,57 @@ bool ConsumeDurationUnit(const char** start, const char* end, Duration* unit) {
   }
 }
 
+// A fast path for ParseDuration() covering canonical inputs: a sequence of
+// integer or short-fraction fields with unit suffixes (e.g. "150ms", "2.5s",
+// "1h30m") whose total magnitude fits in int64 nanoseconds. Such inputs are
+// accumulated directly as a nanosecond count, skipping the per-field
+// Duration multiply/divide of the general parser. Returns false with *d
+// unmodified for anything else - huge values, fractions finer than a whole
+// number of nanoseconds, malformed input - deferring to the general parser.
+bool ParseDurationFast(const char* start, const char* end, int sign,
+                       Duration* d) {
+  int64_t total_ns = 0;
+  while (start != end) {
+    uint64_t int_part = 0;
+    int digits = 0;
+    for (; start != end; ++start) {
+      const int dig = *start - '0';  // contiguous digits
+      if (dig < 0 || 10 <= dig) break;
+      if (++digits > 15) return false;  // Let the slow path bounds-check.
+      int_part = int_part * 10 + static_cast<uint64_t>(dig);
+    }
+    uint64_t frac_part = 0;
+    uint64_t frac_scale = 1;
+    if (start != end && *start == '.') {
+      for (++start; start != end; ++start) {
+        const int dig = *start - '0';  // contiguous digits
+        if (dig < 0 || 10 <= dig) break;
+        if (frac_scale == 1000 * 1000 * 1000) return false;
+        frac_part = frac_part * 10 + static_cast<uint64_t>(dig);
+        frac_scale *= 10;
+      }
+    }
+    if (digits == 0 && frac_scale == 1) return false;
+    Duration unit;
+    if (!ConsumeDurationUnit(&start, end, &unit)) return false;
+    const uint64_t unit_ns =
+        static_cast<uint64_t>(time_internal::GetRepHi(unit)) * 1000000000 +
+        time_internal::GetRepLo(unit) / kTicksPerNanosecond;
+    // The fraction must name a whole number of nanoseconds; quarter-tick
+    // values such as "0.25ns" take the general path.
+    if (unit_ns % frac_scale != 0) return false;
+    const uint64_t frac_ns = frac_part * (unit_ns / frac_scale);
+    if (int_part > static_cast<uint64_t>(kint64max) / unit_ns) return false;
+    const uint64_t field_ns = int_part * unit_ns;
+    if (field_ns > static_cast<uint64_t>(kint64max) - frac_ns) return false;
+    const int64_t ns = static_cast<int64_t>(field_ns + frac_ns);
+    if (total_ns > kint64max - ns) return false;
+    total_ns += ns;
+  }
+  *d = sign * Nanoseconds(total_ns);
+  return true;
+}
+
 }  // namespace
 
 // From Go's doc at https://golang.org/pkg/time/#ParseDuration
@@ -925,6 +1074,8 @@ bool ParseDuration(absl::string_view dur_sv, Duration* d) {
   const char* start = dur_sv.data();
   const char* end = start + dur_sv.size();
 
+  if (ParseDurationFast(start, end, sign, d)) return true;
+
   Duration dur;
   while (start != end) {
     int64_t int_part;
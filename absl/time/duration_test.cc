@@ -1672,6 +1672,66 @@ TEST(Duration, FormatDuration) {
                 -huge_range - (absl::Seconds(1) - absl::Nanoseconds(1) / 4)));
 }
 
+TEST(Duration, FormatDurationAs) {
+  using absl::DurationUnit;
+
+  // Whole counts of the requested unit format as plain integers.
+  EXPECT_EQ("1ns", absl::FormatDurationAs(absl::Nanoseconds(1),
+                                          DurationUnit::kNanoseconds));
+  EXPECT_EQ("1us", absl::FormatDurationAs(absl::Microseconds(1),
+                                          DurationUnit::kMicroseconds));
+  EXPECT_EQ("1500ms", absl::FormatDurationAs(absl::Milliseconds(1500),
+                                             DurationUnit::kMilliseconds));
+  EXPECT_EQ("3600s",
+            absl::FormatDurationAs(absl::Hours(1), DurationUnit::kSeconds));
+  EXPECT_EQ("2000000000ns", absl::FormatDurationAs(
+                                absl::Seconds(2), DurationUnit::kNanoseconds));
+
+  // No unit selection: the same value in different units.
+  const absl::Duration d = absl::Milliseconds(1500);
+  EXPECT_EQ("1.5s", absl::FormatDurationAs(d, DurationUnit::kSeconds));
+  EXPECT_EQ("1500ms", absl::FormatDurationAs(d, DurationUnit::kMilliseconds));
+  EXPECT_EQ("1500000us",
+            absl::FormatDurationAs(d, DurationUnit::kMicroseconds));
+  EXPECT_EQ("1500000000ns",
+            absl::FormatDurationAs(d, DurationUnit::kNanoseconds));
+
+  // Fractions are exact decimals with trailing zeros removed.
+  EXPECT_EQ("0.001us", absl::FormatDurationAs(absl::Nanoseconds(1),
+                                              DurationUnit::kMicroseconds));
+  EXPECT_EQ("0.25ns", absl::FormatDurationAs(absl::Nanoseconds(1) / 4,
+                                             DurationUnit::kNanoseconds));
+  EXPECT_EQ("55.00000025ms",
+            absl::FormatDurationAs(
+                absl::Milliseconds(55) + absl::Nanoseconds(1) / 4,
+                DurationUnit::kMilliseconds));
+
+  // The zero duration keeps the requested unit.
+  EXPECT_EQ("0ms", absl::FormatDurationAs(absl::ZeroDuration(),
+                                          DurationUnit::kMilliseconds));
+
+  // Negative and infinite durations.
+  EXPECT_EQ("-2.5s", absl::FormatDurationAs(-absl::Milliseconds(2500),
+                                            DurationUnit::kSeconds));
+  EXPECT_EQ("-1ns", absl::FormatDurationAs(absl::Nanoseconds(-1),
+                                           DurationUnit::kNanoseconds));
+  EXPECT_EQ("inf", absl::FormatDurationAs(absl::InfiniteDuration(),
+                                          DurationUnit::kSeconds));
+  EXPECT_EQ("-inf", absl::FormatDurationAs(-absl::InfiniteDuration(),
+                                           DurationUnit::kSeconds));
+
+  // Extreme values, including counts that do not fit in 64 bits.
+  EXPECT_EQ("-9223372036854775808s",
+            absl::FormatDurationAs(absl::Seconds(kint64min),
+                                   DurationUnit::kSeconds));
+  EXPECT_EQ("-9223372036854775808000ms",
+            absl::FormatDurationAs(absl::Seconds(kint64min),
+                                   DurationUnit::kMilliseconds));
+  EXPECT_EQ("9223372036854775807000000000ns",
+            absl::FormatDurationAs(absl::Seconds(kint64max),
+                                   DurationUnit::kNanoseconds));
+}
+
 TEST(Duration, ParseDuration) {
   absl::Duration d;
 
@@ -1780,6 +1840,21 @@ TEST(Duration, ParseDuration) {
   EXPECT_FALSE(absl::ParseDuration("1h-2s", &d));
   EXPECT_FALSE(absl::ParseDuration("-1h-2s", &d));
   EXPECT_FALSE(absl::ParseDuration("-1h -2s", &d));
+
+  // Canonical multi-field forms.
+  EXPECT_TRUE(absl::ParseDuration("1h30m", &d));
+  EXPECT_EQ(absl::Hours(1) + absl::Minutes(30), d);
+  EXPECT_TRUE(absl::ParseDuration("-1h30m0.5s", &d));
+  EXPECT_EQ(-(absl::Hours(1) + absl::Minutes(30) + absl::Milliseconds(500)),
+            d);
+
+  // Values near the limits of the representation.
+  EXPECT_TRUE(absl::ParseDuration("9223372036854775807ns", &d));
+  EXPECT_EQ(absl::Nanoseconds(kint64max), d);
+  EXPECT_TRUE(absl::ParseDuration("2562047788015215h30m7.99999999975s", &d));
+  EXPECT_EQ(absl::Seconds(kint64max) + absl::Nanoseconds(999999999) +
+                absl::Nanoseconds(3) / 4,
+            d);
 }
 
 TEST(Duration, FormatParseRoundTrip) {
@@ -18,6 +18,7 @@
 #include <cstdint>
 #include <utility>
 
+#include "absl/strings/ascii.h"
 #include "absl/strings/match.h"
 #include "absl/strings/string_view.h"
 #include "absl/time/internal/cctz/include/cctz/time_zone.h"
@@ -71,6 +72,48 @@ absl::Time Join(const cctz_parts& parts) {
   return time_internal::FromUnixDuration(d);
 }
 
+// Powers of 10 up to the femtosecond resolution of an absl::Time.
+constexpr int64_t kPow10[16] = {int64_t{1},
+                                int64_t{10},
+                                int64_t{100},
+                                int64_t{1000},
+                                int64_t{10000},
+                                int64_t{100000},
+                                int64_t{1000000},
+                                int64_t{10000000},
+                                int64_t{100000000},
+                                int64_t{1000000000},
+                                int64_t{10000000000},
+                                int64_t{100000000000},
+                                int64_t{1000000000000},
+                                int64_t{10000000000000},
+                                int64_t{100000000000000},
+                                int64_t{1000000000000000}};
+
+// Appends `v` (which must be in [0:99]) as exactly two digits.
+void AppendTwoDigits(int v, std::string* out) {
+  out->push_back(static_cast<char>('0' + v / 10));
+  out->push_back(static_cast<char>('0' + v % 10));
+}
+
+// Appends `v` in decimal, zero padding to `width` characters (a leading
+// '-' counts toward the width, as with cctz's %E4Y).
+void AppendInt64(int64_t v, int width, std::string* out) {
+  char buf[24];
+  char* ep = buf + sizeof(buf);
+  const bool neg = v < 0;
+  // Negating in unsigned space avoids overflow on the minimum value.
+  uint64_t u = neg ? ~static_cast<uint64_t>(v) + 1 : static_cast<uint64_t>(v);
+  if (neg) --width;
+  do {
+    --width;
+    *--ep = static_cast<char>('0' + u % 10);
+  } while ((u /= 10) != 0);
+  while (--width >= 0) *--ep = '0';
+  if (neg) *--ep = '-';
+  out->append(ep, static_cast<size_t>(buf + sizeof(buf) - ep));
+}
+
 }  // namespace
 
 std::string FormatTime(absl::string_view format, absl::Time t,
@@ -90,6 +133,334 @@ std::string FormatTime(absl::Time t) {
   return absl::FormatTime(RFC3339_full, t, absl::LocalTimeZone());
 }
 
+TimeFormat::TimeFormat(absl::string_view format)
+    : pattern_(format), precompiled_(true) {
+  std::string literal;
+  auto flush_literal = [&]() {
+    if (!literal.empty()) {
+      Segment seg;
+      seg.literal.swap(literal);
+      segments_.push_back(std::move(seg));
+    }
+  };
+  while (precompiled_ && !format.empty()) {
+    if (format[0] != '%') {
+      literal.push_back(format[0]);
+      format.remove_prefix(1);
+      continue;
+    }
+    if (format.size() < 2) {
+      precompiled_ = false;  // trailing '%'
+      break;
+    }
+    Segment seg;
+    size_t len = 2;
+    switch (format[1]) {
+      case '%':
+        literal.push_back('%');
+        format.remove_prefix(2);
+        continue;
+      case 'Y':
+        seg.field = Segment::Field::kYear;
+        break;
+      case 'm':
+        seg.field = Segment::Field::kMonth;
+        break;
+      case 'd':
+        seg.field = Segment::Field::kDay;
+        break;
+      case 'H':
+        seg.field = Segment::Field::kHour;
+        break;
+      case 'M':
+        seg.field = Segment::Field::kMinute;
+        break;
+      case 'S':
+        seg.field = Segment::Field::kSecond;
+        break;
+      case 'z':
+        seg.field = Segment::Field::kOffsetHHMM;
+        break;
+      case 'Z':
+        seg.field = Segment::Field::kZoneAbbr;
+        break;
+      case 's':
+        seg.field = Segment::Field::kUnixSeconds;
+        break;
+      case 'E': {
+        if (format.size() >= 3 && format[2] == 'T') {
+          literal.push_back('T');
+          format.remove_prefix(3);
+          continue;
+        }
+        if (format.size() >= 3 && format[2] == 'z') {
+          seg.field = Segment::Field::kOffsetRFC;
+          len = 3;
+          break;
+        }
+        if (format.size() >= 4 && format[2] == '4' && format[3] == 'Y') {
+          seg.field = Segment::Field::kYear4;
+          len = 4;
+          break;
+        }
+        if (format.size() >= 4 && format[2] == '*' && format[3] == 'z') {
+          seg.field = Segment::Field::kOffsetFull;
+          len = 4;
+          break;
+        }
+        if (format.size() >= 4 && format[2] == '*' && format[3] == 'S') {
+          seg.field = Segment::Field::kSecond;
+          seg.precision = -1;
+          len = 4;
+          break;
+        }
+        int n = 0;
+        len = 2;
+        while (len < format.size() && absl::ascii_isdigit(format[len]) &&
+               n <= 15) {
+          n = n * 10 + (format[len] - '0');
+          ++len;
+        }
+        if (len > 2 && len < format.size() && format[len] == 'S' && n <= 15) {
+          seg.field = Segment::Field::kSecond;
+          seg.precision = n;
+          ++len;
+          break;
+        }
+        precompiled_ = false;
+        continue;
+      }
+      default:
+        precompiled_ = false;
+        continue;
+    }
+    flush_literal();
+    segments_.push_back(seg);
+    format.remove_prefix(len);
+  }
+  if (precompiled_) {
+    flush_literal();
+  } else {
+    segments_.clear();
+  }
+}
+
+void TimeFormat::AppendTo(std::string* out, absl::Time t,
+                          absl::TimeZone tz) const {
+  if (!precompiled_) {
+    out->append(absl::FormatTime(pattern_, t, tz));
+    return;
+  }
+  if (t == absl::InfiniteFuture()) {
+    out->append(kInfiniteFutureStr);
+    return;
+  }
+  if (t == absl::InfinitePast()) {
+    out->append(kInfinitePastStr);
+    return;
+  }
+  const cctz_parts parts = Split(t);
+  const cctz::time_zone::absolute_lookup al =
+      cctz::time_zone(tz).lookup(parts.sec);
+  const int64_t fem = parts.fem.count();
+  out->reserve(out->size() + pattern_.size() + 16);
+  for (const Segment& seg : segments_) {
+    switch (seg.field) {
+      case Segment::Field::kLiteral:
+        out->append(seg.literal);
+        break;
+      case Segment::Field::kYear:
+        AppendInt64(al.cs.year(), 0, out);
+        break;
+      case Segment::Field::kYear4:
+        AppendInt64(al.cs.year(), 4, out);
+        break;
+      case Segment::Field::kMonth:
+        AppendTwoDigits(al.cs.month(), out);
+        break;
+      case Segment::Field::kDay:
+        AppendTwoDigits(al.cs.day(), out);
+        break;
+      case Segment::Field::kHour:
+        AppendTwoDigits(al.cs.hour(), out);
+        break;
+      case Segment::Field::kMinute:
+        AppendTwoDigits(al.cs.minute(), out);
+        break;
+      case Segment::Field::kSecond: {
+        AppendTwoDigits(al.cs.second(), out);
+        if (seg.precision < 0) {
+          // Full precision: all nonzero trailing digits.
+          int digits = 15;
+          int64_t f = fem;
+          while (digits > 0 && f % 10 == 0) {
+            f /= 10;
+            --digits;
+          }
+          if (digits > 0) {
+            out->push_back('.');
+            AppendInt64(f, digits, out);
+          }
+        } else if (seg.precision > 0) {
+          out->push_back('.');
+          AppendInt64(fem / kPow10[15 - seg.precision], seg.precision, out);
+        }
+        break;
+      }
+      case Segment::Field::kOffsetHHMM:
+      case Segment::Field::kOffsetRFC:
+      case Segment::Field::kOffsetFull: {
+        int offset = al.offset;
+        char sign = '+';
+        if (offset < 0) {
+          offset = -offset;  // bounded by 24h so no overflow
+          sign = '-';
+        }
+        const int seconds = offset % 60;
+        const int minutes = (offset /= 60) % 60;
+        const int hours = offset /= 60;
+        // Sub-minute negative offsets get a positive sign unless the
+        // seconds are actually rendered (e.g., offset=-10s => "+00:00").
+        if (seg.field != Segment::Field::kOffsetFull && hours == 0 &&
+            minutes == 0) {
+          sign = '+';
+        }
+        out->push_back(sign);
+        AppendTwoDigits(hours, out);
+        if (seg.field != Segment::Field::kOffsetHHMM) out->push_back(':');
+        AppendTwoDigits(minutes, out);
+        if (seg.field == Segment::Field::kOffsetFull) {
+          out->push_back(':');
+          AppendTwoDigits(seconds, out);
+        }
+        break;
+      }
+      case Segment::Field::kZoneAbbr:
+        out->append(al.abbr);
+        break;
+      case Segment::Field::kUnixSeconds:
+        AppendInt64((parts.sec - unix_epoch()).count(), 0, out);
+        break;
+    }
+  }
+}
+
+std::string TimeFormat::Format(absl::Time t, absl::TimeZone tz) const {
+  std::string out;
+  AppendTo(&out, t, tz);
+  return out;
+}
+
+namespace {
+
+// Decodes the two ASCII digits at `p`, returning a negative value unless
+// both characters are digits.
+inline int ParseTwoDigits(const char* p) {
+  const unsigned d0 = static_cast<unsigned char>(p[0]) - '0';
+  const unsigned d1 = static_cast<unsigned char>(p[1]) - '0';
+  if ((d0 | d1) > 9) return -1;
+  return static_cast<int>(d0 * 10 + d1);
+}
+
+// SWAR test that the eight bytes at `p` are all ASCII digits.
+inline bool AreEightDigits(const char* p) {
+  uint64_t v;
+  memcpy(&v, p, sizeof(v));
+  v ^= 0x3030303030303030u;  // digits become 0x00 .. 0x09
+  return (((v + 0x7676767676767676u) | v) & 0x8080808080808080u) == 0;
+}
+
+// Parses timestamps in the fixed layout shared by the RFC3339_full and
+// RFC3339_sec formats ("2013-01-02T03:04:05[.678]+09:00", with 'Z' also
+// accepted as the offset). Machine-written inputs overwhelmingly take this
+// shape, so ParseTime() special-cases it with straight-line digit arithmetic
+// instead of the generic format-driven parser. Returns false (leaving *time
+// untouched) whenever the input does not obviously match; the caller then
+// falls back to the generic parser, which handles the laxer inputs these
+// formats also admit (signed or wide years, "+hhmm" offsets, ...) and
+// composes proper error messages.
+bool TryParseRFC3339(absl::string_view input, bool allow_subseconds,
+                     absl::Time* time) {
+  if (input.size() < 20) return false;  // "YYYY-MM-DDThh:mm:ssZ"
+  const char* const p = input.data();
+  const int y_hi = ParseTwoDigits(p);
+  const int y_lo = ParseTwoDigits(p + 2);
+  const int mo = ParseTwoDigits(p + 5);
+  const int d = ParseTwoDigits(p + 8);
+  const int h = ParseTwoDigits(p + 11);
+  const int mi = ParseTwoDigits(p + 14);
+  int s = ParseTwoDigits(p + 17);
+  if ((y_hi | y_lo | mo | d | h | mi | s) < 0) return false;
+  if (p[4] != '-' || p[7] != '-' || (p[10] != 'T' && p[10] != 't') ||
+      p[13] != ':' || p[16] != ':') {
+    return false;
+  }
+  // The same field bounds as the generic parser.
+  if (mo < 1 || mo > 12 || d < 1 || d > 31 || h > 23 || mi > 59 || s > 60) {
+    return false;
+  }
+
+  // The UTC offset is either 'Z'/'z' or "+hh:mm"/"-hh:mm" at the end;
+  // anything between it and the seconds is the subsecond field.
+  const char back = input[input.size() - 1];
+  int64_t offset = 0;
+  size_t subsec_end;
+  if (back == 'Z' || back == 'z') {
+    subsec_end = input.size() - 1;
+  } else if (input.size() >= 25 &&
+             (p[input.size() - 6] == '+' || p[input.size() - 6] == '-') &&
+             p[input.size() - 3] == ':') {
+    const int oh = ParseTwoDigits(p + input.size() - 5);
+    const int om = ParseTwoDigits(p + input.size() - 2);
+    if ((oh | om) < 0 || oh > 23 || om > 59) return false;
+    offset = int64_t{oh} * 60 * 60 + int64_t{om} * 60;
+    if (p[input.size() - 6] == '-') offset = -offset;
+    subsec_end = input.size() - 6;
+  } else {
+    return false;
+  }
+
+  int64_t fem = 0;
+  if (subsec_end != 19) {
+    // A '.' followed by 1 to 15 digits (more digits fall back).
+    const size_t digits = subsec_end - 20;
+    if (!allow_subseconds || subsec_end < 21 || digits > 15 || p[19] != '.') {
+      return false;
+    }
+    size_t pos = 20;
+    for (; pos + 8 <= subsec_end; pos += 8) {
+      if (!AreEightDigits(p + pos)) return false;
+    }
+    for (; pos != subsec_end; ++pos) {
+      if (!absl::ascii_isdigit(p[pos])) return false;
+    }
+    for (size_t i = 20; i != subsec_end; ++i) {
+      fem = fem * 10 + (p[i] - '0');
+    }
+    fem *= kPow10[15 - digits];
+  }
+
+  // A leap second of 60 normalizes forward to the following ":00", dropping
+  // any subseconds, exactly as in the generic parser.
+  if (s == 60) {
+    s = 59;
+    offset -= 1;
+    fem = 0;
+  }
+
+  const cctz::civil_second cs(y_hi * 100 + y_lo, mo, d, h, mi, s);
+  // The only normalization possible here is days rolling into months, which
+  // the generic parser treats as an error (e.g. "2013-09-31").
+  if (cs.day() != d || cs.month() != mo) return false;
+  const int64_t unix_sec =
+      (cs - cctz::civil_second(1970, 1, 1, 0, 0, 0)) - offset;
+  *time = Join({unix_epoch() + cctz::seconds(unix_sec),
+                cctz::detail::femtoseconds(fem)});
+  return true;
+}
+
+}  // namespace
+
 bool ParseTime(absl::string_view format, absl::string_view input,
                absl::Time* time, std::string* err) {
   return absl::ParseTime(format, input, absl::UTCTimeZone(), time, err);
@@ -129,6 +500,15 @@ bool ParseTime(absl::string_view format, absl::string_view input,
     }
   }
 
+  // Fast path for the RFC3339 formats, which dominate machine-to-machine
+  // parsing.
+  if (format == RFC3339_full || format == RFC3339_sec) {
+    if (TryParseRFC3339(input, /*allow_subseconds=*/format == RFC3339_full,
+                        time)) {
+      return true;
+    }
+  }
+
   std::string error;
   cctz_parts parts;
   const bool b =
@@ -125,6 +125,30 @@ TEST(FormatTime, RFC1123FormatPadsYear) {  // locale specific
             absl::FormatTime(absl::RFC1123_no_wday, t, tz));
 }
 
+TEST(FormatTime, RepeatedFormattingAcrossTransitions) {
+  // format() memoizes the transition interval of the previous lookup, per
+  // thread.  Walk second by second across a DST transition (2017-03-12
+  // 01:59:59 PST -> 03:00:00 PDT, i.e. 10:00:00 UTC), interleaving zones, and
+  // check that every call still sees the correct offset and abbreviation.
+  const absl::TimeZone la =
+      absl::time_internal::LoadTimeZone("America/Los_Angeles");
+  const absl::TimeZone utc = absl::UTCTimeZone();
+  const absl::Time trans =
+      absl::FromCivil(absl::CivilSecond(2017, 3, 12, 10, 0, 0), utc);
+  for (int i = -5; i < 5; ++i) {
+    const absl::Time t = trans + absl::Seconds(i);
+    const std::string expected =
+        i < 0 ? absl::FormatTime("2017-03-12 01:59:%S -0800 PST", t, utc)
+              : absl::FormatTime("2017-03-12 03:00:%S -0700 PDT", t, utc);
+    EXPECT_EQ(expected, absl::FormatTime("%Y-%m-%d %H:%M:%S %z %Z", t, la));
+    // Same instant, different zone: the memo must not leak across zones.
+    EXPECT_EQ(absl::FormatTime("%S +0000 UTC", t, utc),
+              absl::FormatTime("%S %z %Z", t, utc));
+    // Repeats of the same instant must be stable.
+    EXPECT_EQ(expected, absl::FormatTime("%Y-%m-%d %H:%M:%S %z %Z", t, la));
+  }
+}
+
 TEST(FormatTime, InfiniteTime) {
   absl::TimeZone tz = absl::time_internal::LoadTimeZone("America/Los_Angeles");
 
@@ -135,6 +159,49 @@ TEST(FormatTime, InfiniteTime) {
             absl::FormatTime("%H:%M blah", absl::InfinitePast(), tz));
 }
 
+//
+// Testing TimeFormat
+//
+
+TEST(TimeFormat, MatchesFormatTime) {
+  const absl::TimeZone la =
+      absl::time_internal::LoadTimeZone("America/Los_Angeles");
+  const absl::TimeZone utc = absl::UTCTimeZone();
+  absl::Time t = absl::FromCivil(absl::CivilSecond(2013, 1, 2, 3, 4, 5), la);
+  t += absl::Milliseconds(6) + absl::Microseconds(7) + absl::Nanoseconds(8);
+
+  // Patterns within the precompiled subset, patterns requiring the
+  // FormatTime() fallback (%a, %E16S, a trailing %), and edge cases.
+  const char* const kPatterns[] = {
+      absl::RFC3339_full, absl::RFC3339_sec,
+      absl::RFC1123_full, absl::RFC1123_no_wday,
+      "%Y-%m-%d %H:%M:%E6S", "%E4Y%m%d %z %Ez %E*z %Z %s",
+      "%Y-%m-%d %H:%M:%E*S", "%E0S %E1S %E15S", "100%% %%H %%%H",
+      "", " ", "xxx", "%a %b %e %E16S", "%",
+  };
+  for (const char* pattern : kPatterns) {
+    const absl::TimeFormat fmt(pattern);
+    EXPECT_EQ(fmt.pattern(), pattern);
+    for (const absl::TimeZone& tz : {la, utc}) {
+      for (const absl::Time when :
+           {t, absl::UnixEpoch(), absl::FromUnixMicros(-1),
+            absl::FromCivil(absl::CivilSecond(-77, 6, 28, 9, 8, 7), tz),
+            absl::InfiniteFuture(), absl::InfinitePast()}) {
+        EXPECT_EQ(absl::FormatTime(pattern, when, tz), fmt.Format(when, tz))
+            << "pattern: \"" << pattern << "\"";
+      }
+    }
+  }
+}
+
+TEST(TimeFormat, AppendTo) {
+  const absl::TimeZone utc = absl::UTCTimeZone();
+  const absl::TimeFormat fmt("%H:%M:%S");
+  std::string out = "at ";
+  fmt.AppendTo(&out, absl::UnixEpoch() + absl::Seconds(61), utc);
+  EXPECT_EQ("at 00:01:01", out);
+}
+
 //
 // Testing ParseTime()
 //
@@ -159,6 +226,65 @@ TEST(ParseTime, Basics) {
   EXPECT_EQ(absl::ZeroDuration(), ci.subsecond);
 }
 
+TEST(ParseTime, RFC3339FastPathMatchesGenericParser) {
+  // ParseTime() has a dedicated fast path for the RFC3339_full/RFC3339_sec
+  // formats.  "%Y-%m-%dT..." is semantically identical to RFC3339_full (a
+  // literal 'T' instead of %ET) but routes through the generic parser, so
+  // the two must agree on every input, including the ones the fast path
+  // hands back.
+  const char* const kGenericFull = "%Y-%m-%dT%H:%M:%E*S%Ez";
+  const char* const kInputs[] = {
+      "2013-06-28T19:08:09+00:00",      // canonical shape
+      "2013-06-28T19:08:09Z",           // Zulu offset
+      "2013-06-28T19:08:09z",           // lowercase Zulu offset
+      "2013-06-28T19:08:09-07:00",      // negative offset
+      "2013-06-28T19:08:09.1Z",         // short fraction
+      "2013-06-28T19:08:09.123456789+05:30",  // long fraction, odd offset
+      "2013-06-28T19:08:09.123456789012345Z",  // femtosecond precision
+      "2013-06-28T19:08:09.12345678901234567Z",  // beyond femtoseconds
+      "0000-01-01T00:00:00Z",           // minimum 4-digit year
+      "9999-12-31T23:59:59.999999-23:59",  // maximum 4-digit year
+      "2012-02-29T00:00:00Z",           // leap day
+      "2013-02-29T00:00:00Z",           // invalid leap day
+      "2012-06-30T23:59:60Z",           // leap second
+      "2012-06-30T23:59:60.5Z",         // leap second drops subseconds
+      "2013-09-31T00:00:00Z",           // day rolls into next month: error
+      "2013-13-28T19:08:09Z",           // out-of-range month
+      "2013-06-28T24:08:09Z",           // out-of-range hour
+      "2013-06-28T19:08:09+24:00",      // out-of-range offset
+      "2013-06-28T19:08:09+0000",       // unseparated offset
+      "2013-06-28T19:08:09",            // missing offset
+      "2013-06-28T19:08:09Z extra",     // trailing data
+      "213-06-28T19:08:09Z",            // three-digit year
+      "-2013-06-28T19:08:09Z",          // signed year
+  };
+  for (const char* input : kInputs) {
+    absl::Time fast, generic;
+    std::string fast_err, generic_err;
+    const bool fast_ok =
+        absl::ParseTime(absl::RFC3339_full, input, &fast, &fast_err);
+    const bool generic_ok =
+        absl::ParseTime(kGenericFull, input, &generic, &generic_err);
+    EXPECT_EQ(generic_ok, fast_ok) << input;
+    if (fast_ok && generic_ok) {
+      EXPECT_EQ(generic, fast) << input;
+    }
+    // RFC3339_sec rejects fractional seconds either way.
+    const bool has_fraction = std::string(input).find('.') != std::string::npos;
+    absl::Time sec_time;
+    EXPECT_EQ(generic_ok && !has_fraction,
+              absl::ParseTime(absl::RFC3339_sec, input, &sec_time, nullptr))
+        << input;
+  }
+
+  // %ET accepts a lowercase 't' separator, which the literal-'T' comparison
+  // format above does not, so check that case directly.
+  absl::Time t;
+  ASSERT_TRUE(
+      absl::ParseTime(absl::RFC3339_full, "2013-06-28t19:08:09z", &t, nullptr));
+  EXPECT_EQ(absl::FromUnixSeconds(1372446489), t);
+}
+
 TEST(ParseTime, NullErrorString) {
   absl::Time t;
   EXPECT_FALSE(absl::ParseTime("%Q", "invalid format", &t, nullptr));
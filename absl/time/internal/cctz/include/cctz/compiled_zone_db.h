@@ -0,0 +1,69 @@
+// Copyright 2026 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   https://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+#ifndef ABSL_TIME_INTERNAL_CCTZ_COMPILED_ZONE_DB_H_
+#define ABSL_TIME_INTERNAL_CCTZ_COMPILED_ZONE_DB_H_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "absl/base/config.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+namespace time_internal {
+namespace cctz {
+
+// Support for a compiled form of the zoneinfo database.
+//
+// A compiled database holds zones that have already been parsed into
+// their transition tables, so that binding a time_zone requires no file
+// access and no TZif parsing. The format is versioned, relocatable, and
+// position independent, making the data block suitable for embedding in
+// a data file that is mmap()ed read-only and shared between processes.
+// Processes that load many zones at startup can compile the database
+// once, offline, and then install the mapped block at process start.
+
+// Serializes the named zones into a compiled database written to *db.
+// Each name must be loadable through the normal zoneinfo mechanisms.
+// Returns false (leaving *db in an unspecified state) if any zone
+// cannot be loaded.
+bool CompileZoneDb(const std::vector<std::string>& names, std::string* db);
+
+// Installs a compiled database for use by subsequent zone loads. The
+// [data, data + size) block—typically an mmap()ed file produced with
+// CompileZoneDb()—must remain valid and unchanged for the remainder of
+// the process. Zones present in the database are bound directly from
+// their precompiled transition tables; all other names fall back to the
+// normal zoneinfo loading path. Returns false, installing nothing, if
+// the block is malformed or of an unsupported format version.
+bool UseCompiledZoneDb(const char* data, std::size_t size);
+
+// Removes any installed compiled database. Primarily for use in tests
+// and benchmarks that gauge the performance of loading/parsing the
+// time-zone data.
+void ClearCompiledZoneDbTestOnly();
+
+// Implementation detail: Returns the compiled record for the named zone
+// from the installed database, or nullptr if there is no installed
+// database or it does not contain the zone.
+const char* FindCompiledZone(const std::string& name, std::size_t* size);
+
+}  // namespace cctz
+}  // namespace time_internal
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_TIME_INTERNAL_CCTZ_COMPILED_ZONE_DB_H_
@@ -0,0 +1,317 @@
+// Copyright 2026 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   https://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+// A compiled database is a single relocatable block of bytes:
+//
+//   8 bytes   magic/version ("CCTZdb1\0")
+//   4 bytes   zone count (N)
+//   N index entries of 16 bytes each:
+//     4 bytes   zone-name offset (from the start of the block)
+//     4 bytes   zone-name length
+//     4 bytes   zone-record offset (from the start of the block)
+//     4 bytes   zone-record length
+//   ...the zone names and zone records...
+//
+// Index entries are sorted by zone name so lookups can binary search.
+// A zone record is the fully processed state of a TimeZoneInfo (the
+// transition and transition-type tables that TimeZoneInfo::Load()
+// normally computes from TZif data), so binding a record needs no
+// parsing, validation, or POSIX-spec transition generation. All
+// multi-byte fields are little-endian and unaligned; civil times are
+// stored by field so that no value can overflow in transit.
+
+#include "absl/time/internal/cctz/include/cctz/compiled_zone_db.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "absl/base/config.h"
+#include "absl/time/internal/cctz/include/cctz/civil_time.h"
+#include "time_zone_info.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+namespace time_internal {
+namespace cctz {
+
+namespace {
+
+const char kMagic[8] = {'C', 'C', 'T', 'Z', 'd', 'b', '1', '\0'};
+
+const std::size_t kHeaderSize = sizeof(kMagic) + 4;
+const std::size_t kIndexEntrySize = 4 * 4;
+
+// Encoded sizes of a civil_second (year + 5 smaller fields), a
+// transition type, and a transition. See the Append/Fetch functions.
+const std::size_t kCivilSize = 8 + 5;
+const std::size_t kTypeSize = 4 + 2 * kCivilSize + 1 + 1;
+const std::size_t kTransitionSize = 8 + 2 * kCivilSize + 1;
+
+// The encoded size of a zone record's fixed-size prefix: the table
+// counts plus the default-transition-type/extended/last-year fields.
+const std::size_t kRecordHeaderSize = 5 * 4 + 1 + 1 + 8;
+
+void Append32(std::uint_fast32_t v, std::string* out) {
+  for (int i = 0; i != 4; ++i) {
+    out->push_back(static_cast<char>(v & 0xff));
+    v >>= 8;
+  }
+}
+
+void Append64(std::uint_fast64_t v, std::string* out) {
+  for (int i = 0; i != 8; ++i) {
+    out->push_back(static_cast<char>(v & 0xff));
+    v >>= 8;
+  }
+}
+
+void AppendCivil(const civil_second& cs, std::string* out) {
+  Append64(static_cast<std::uint_fast64_t>(cs.year()), out);
+  out->push_back(static_cast<char>(cs.month()));
+  out->push_back(static_cast<char>(cs.day()));
+  out->push_back(static_cast<char>(cs.hour()));
+  out->push_back(static_cast<char>(cs.minute()));
+  out->push_back(static_cast<char>(cs.second()));
+}
+
+std::uint_fast8_t Fetch8(const char* p) {
+  return static_cast<std::uint_fast8_t>(*reinterpret_cast<const std::uint8_t*>(p));
+}
+
+std::uint_fast32_t Fetch32(const char* p) {
+  std::uint_fast32_t v = 0;
+  for (int i = 3; i >= 0; --i) v = (v << 8) | Fetch8(p + i);
+  return v;
+}
+
+std::uint_fast64_t Fetch64(const char* p) {
+  std::uint_fast64_t v = 0;
+  for (int i = 7; i >= 0; --i) v = (v << 8) | Fetch8(p + i);
+  return v;
+}
+
+std::int_fast64_t Fetch64s(const char* p) {
+  return static_cast<std::int_fast64_t>(
+      static_cast<std::int64_t>(static_cast<std::uint64_t>(Fetch64(p))));
+}
+
+civil_second FetchCivil(const char* p) {
+  return civil_second(static_cast<year_t>(Fetch64s(p)), Fetch8(p + 8),
+                      Fetch8(p + 9), Fetch8(p + 10), Fetch8(p + 11),
+                      Fetch8(p + 12));
+}
+
+// An installed compiled database: the caller-owned data block plus a
+// decoded copy of its index.
+struct CompiledZoneDb {
+  struct Entry {
+    std::string name;
+    const char* data;
+    std::size_t size;
+  };
+  std::vector<Entry> zones;  // sorted by name
+};
+
+std::atomic<const CompiledZoneDb*> compiled_zone_db{nullptr};
+
+}  // namespace
+
+// Appends this zone's compiled record to *out. The inverse of
+// MakeFromCompiledRecord().
+void TimeZoneInfo::AppendCompiledRecord(std::string* out) const {
+  Append32(static_cast<std::uint_fast32_t>(transitions_.size()), out);
+  Append32(static_cast<std::uint_fast32_t>(transition_types_.size()), out);
+  Append32(static_cast<std::uint_fast32_t>(abbreviations_.size()), out);
+  Append32(static_cast<std::uint_fast32_t>(version_.size()), out);
+  Append32(static_cast<std::uint_fast32_t>(future_spec_.size()), out);
+  out->push_back(static_cast<char>(default_transition_type_));
+  out->push_back(static_cast<char>(extended_ ? 1 : 0));
+  Append64(static_cast<std::uint_fast64_t>(extended_ ? last_year_ : 0), out);
+  for (const TransitionType& tt : transition_types_) {
+    Append32(static_cast<std::uint_fast32_t>(
+                 static_cast<std::uint32_t>(tt.utc_offset)),
+             out);
+    AppendCivil(tt.civil_max, out);
+    AppendCivil(tt.civil_min, out);
+    out->push_back(static_cast<char>(tt.is_dst ? 1 : 0));
+    out->push_back(static_cast<char>(tt.abbr_index));
+  }
+  for (const Transition& tr : transitions_) {
+    Append64(static_cast<std::uint_fast64_t>(tr.unix_time), out);
+    AppendCivil(tr.civil_sec, out);
+    AppendCivil(tr.prev_civil_sec, out);
+    out->push_back(static_cast<char>(tr.type_index));
+  }
+  out->append(abbreviations_);
+  out->append(version_);
+  out->append(future_spec_);
+}
+
+// Binds a TimeZoneInfo directly to a compiled record, bypassing the
+// TZif loading path entirely. Returns nullptr if the record is
+// malformed.
+std::unique_ptr<TimeZoneInfo> TimeZoneInfo::MakeFromCompiledRecord(
+    const char* data, std::size_t size) {
+  if (size < kRecordHeaderSize) return nullptr;
+  const std::size_t timecnt = Fetch32(data);
+  const std::size_t typecnt = Fetch32(data + 4);
+  const std::size_t charcnt = Fetch32(data + 8);
+  const std::size_t versionlen = Fetch32(data + 12);
+  const std::size_t speclen = Fetch32(data + 16);
+  const std::uint_fast8_t default_type = Fetch8(data + 20);
+  const bool extended = Fetch8(data + 21) != 0;
+  const year_t last_year = static_cast<year_t>(Fetch64s(data + 22));
+  if (timecnt == 0 || typecnt == 0 || charcnt == 0) return nullptr;
+  if (default_type >= typecnt) return nullptr;
+  if (size != kRecordHeaderSize + typecnt * kTypeSize +
+                  timecnt * kTransitionSize + charcnt + versionlen + speclen) {
+    return nullptr;
+  }
+  const char* bp = data + kRecordHeaderSize;
+
+  auto tz = std::unique_ptr<TimeZoneInfo>(new TimeZoneInfo);
+  tz->transition_types_.reserve(typecnt);
+  for (std::size_t i = 0; i != typecnt; ++i) {
+    TransitionType& tt(*tz->transition_types_.emplace(
+        tz->transition_types_.end()));
+    tt.utc_offset = static_cast<std::int_least32_t>(
+        static_cast<std::int32_t>(static_cast<std::uint32_t>(Fetch32(bp))));
+    tt.civil_max = FetchCivil(bp + 4);
+    tt.civil_min = FetchCivil(bp + 4 + kCivilSize);
+    tt.is_dst = Fetch8(bp + 4 + 2 * kCivilSize) != 0;
+    tt.abbr_index = Fetch8(bp + 4 + 2 * kCivilSize + 1);
+    if (tt.abbr_index >= charcnt) return nullptr;
+    bp += kTypeSize;
+  }
+  tz->transitions_.reserve(timecnt);
+  for (std::size_t i = 0; i != timecnt; ++i) {
+    Transition& tr(*tz->transitions_.emplace(tz->transitions_.end()));
+    tr.unix_time = Fetch64s(bp);
+    tr.civil_sec = FetchCivil(bp + 8);
+    tr.prev_civil_sec = FetchCivil(bp + 8 + kCivilSize);
+    tr.type_index = Fetch8(bp + 8 + 2 * kCivilSize);
+    if (tr.type_index >= typecnt) return nullptr;
+    if (i != 0) {
+      // The tables must be ordered (see TimeZoneInfo::Load()) as the
+      // lookup functions binary search them.
+      if (!Transition::ByUnixTime()(tz->transitions_[i - 1], tr))
+        return nullptr;
+      if (!Transition::ByCivilTime()(tz->transitions_[i - 1], tr))
+        return nullptr;
+    }
+    bp += kTransitionSize;
+  }
+  tz->default_transition_type_ = default_type;
+  tz->abbreviations_.assign(bp, charcnt);
+  if (tz->abbreviations_.back() != '\0') return nullptr;
+  bp += charcnt;
+  tz->version_.assign(bp, versionlen);
+  bp += versionlen;
+  tz->future_spec_.assign(bp, speclen);
+  tz->extended_ = extended;
+  tz->last_year_ = last_year;
+  return tz;
+}
+
+bool CompileZoneDb(const std::vector<std::string>& names, std::string* db) {
+  std::vector<std::string> sorted_names(names);
+  std::sort(sorted_names.begin(), sorted_names.end());
+  sorted_names.erase(std::unique(sorted_names.begin(), sorted_names.end()),
+                     sorted_names.end());
+
+  std::vector<std::string> records;
+  records.reserve(sorted_names.size());
+  for (const std::string& name : sorted_names) {
+    auto tz = TimeZoneInfo::Make(name);
+    if (tz == nullptr) return false;
+    records.emplace_back();
+    tz->AppendCompiledRecord(&records.back());
+  }
+
+  std::size_t names_size = 0;
+  for (const std::string& name : sorted_names) names_size += name.size();
+
+  db->clear();
+  db->append(kMagic, sizeof(kMagic));
+  Append32(static_cast<std::uint_fast32_t>(sorted_names.size()), db);
+  std::size_t name_off = kHeaderSize + kIndexEntrySize * sorted_names.size();
+  std::size_t rec_off = name_off + names_size;
+  for (std::size_t i = 0; i != sorted_names.size(); ++i) {
+    Append32(static_cast<std::uint_fast32_t>(name_off), db);
+    Append32(static_cast<std::uint_fast32_t>(sorted_names[i].size()), db);
+    Append32(static_cast<std::uint_fast32_t>(rec_off), db);
+    Append32(static_cast<std::uint_fast32_t>(records[i].size()), db);
+    name_off += sorted_names[i].size();
+    rec_off += records[i].size();
+  }
+  for (const std::string& name : sorted_names) db->append(name);
+  for (const std::string& record : records) db->append(record);
+  return true;
+}
+
+bool UseCompiledZoneDb(const char* data, std::size_t size) {
+  if (size < kHeaderSize) return false;
+  if (std::memcmp(data, kMagic, sizeof(kMagic)) != 0) return false;
+  const std::size_t count = Fetch32(data + sizeof(kMagic));
+  if (count > (size - kHeaderSize) / kIndexEntrySize) return false;
+
+  auto db = std::unique_ptr<CompiledZoneDb>(new CompiledZoneDb);
+  db->zones.reserve(count);
+  const char* entry = data + kHeaderSize;
+  for (std::size_t i = 0; i != count; ++i, entry += kIndexEntrySize) {
+    const std::size_t name_off = Fetch32(entry);
+    const std::size_t name_len = Fetch32(entry + 4);
+    const std::size_t rec_off = Fetch32(entry + 8);
+    const std::size_t rec_len = Fetch32(entry + 12);
+    if (name_off > size || name_len > size - name_off) return false;
+    if (rec_off > size || rec_len > size - rec_off) return false;
+    CompiledZoneDb::Entry zone;
+    zone.name.assign(data + name_off, name_len);
+    zone.data = data + rec_off;
+    zone.size = rec_len;
+    if (i != 0 && !(db->zones.back().name < zone.name)) return false;
+    db->zones.push_back(std::move(zone));
+  }
+
+  delete compiled_zone_db.exchange(db.release(), std::memory_order_acq_rel);
+  return true;
+}
+
+void ClearCompiledZoneDbTestOnly() {
+  delete compiled_zone_db.exchange(nullptr, std::memory_order_acq_rel);
+}
+
+const char* FindCompiledZone(const std::string& name, std::size_t* size) {
+  const CompiledZoneDb* db = compiled_zone_db.load(std::memory_order_acquire);
+  if (db == nullptr) return nullptr;
+  auto it = std::lower_bound(
+      db->zones.begin(), db->zones.end(), name,
+      [](const CompiledZoneDb::Entry& e, const std::string& n) {
+        return e.name < n;
+      });
+  if (it == db->zones.end() || it->name != name) return nullptr;
+  *size = it->size;
+  return it->data;
+}
+
+}  // namespace cctz
+}  // namespace time_internal
+ABSL_NAMESPACE_END
+}  // namespace absl
@@ -307,6 +307,64 @@ const std::int_fast64_t kExp10[kDigits10_64 + 1] = {
     1000000000000000000,
 };
 
+#ifdef ABSL_HAVE_THREAD_LOCAL
+// A per-thread memo of the most recent time_zone::lookup() performed by
+// format().  Times formatted back to back almost always fall within the
+// same UTC-offset interval (and frequently within the same second), so
+// remembering the bounds of that interval turns the common case into two
+// comparisons plus some fixed-offset civil-time arithmetic, instead of a
+// full transition lookup.
+struct FormatLookupMemo {
+  time_zone tz;                   // zone that produced the memo
+  time_point<seconds> lb;         // bounds of the interval containing
+  time_point<seconds> ub;         // tp, with a constant UTC offset: [lb, ub)
+  time_point<seconds> tp;         // most recent lookup time
+  time_zone::absolute_lookup al;  // lookup result for tp
+  bool valid = false;
+};
+thread_local FormatLookupMemo format_lookup_memo;  // trivially destructible
+#endif
+
+// A drop-in replacement for tz.lookup(tp) that memoizes, per thread, the
+// transition interval containing the result.  The al.abbr pointer remains
+// usable across calls because time_zone::Impl objects are never destroyed.
+time_zone::absolute_lookup MemoizedLookup(const time_point<seconds>& tp,
+                                          const time_zone& tz) {
+#ifdef ABSL_HAVE_THREAD_LOCAL
+  FormatLookupMemo& memo = format_lookup_memo;
+  if (memo.valid && tz == memo.tz && memo.lb <= tp && tp < memo.ub) {
+    if (tp != memo.tp) {
+      memo.al.cs += (tp - memo.tp).count();
+      memo.tp = tp;
+    }
+    return memo.al;
+  }
+  memo.valid = false;
+  memo.al = tz.lookup(tp);
+  if (tp <= time_point<seconds>::min() + seconds(1) ||
+      tp >= time_point<seconds>::max() - seconds(1)) {
+    return memo.al;  // too near the representable limits to bound an interval
+  }
+  memo.tz = tz;
+  memo.tp = tp;
+  time_zone::civil_transition trans;
+  // prev_transition() reports transitions strictly before its argument, so
+  // nudge the probe forward to cover a transition at tp itself.
+  memo.lb = tz.prev_transition(tp + seconds(1), &trans)
+                ? tz.lookup(trans.to).trans
+                : tp;
+  // When next_transition() reports nothing the zone may still change beyond
+  // the data in use (e.g., per a POSIX-style future specification), so only
+  // repeats within the same second are memoized.
+  memo.ub = tz.next_transition(tp, &trans) ? tz.lookup(trans.to).trans
+                                           : tp + seconds(1);
+  memo.valid = true;
+  return memo.al;
+#else
+  return tz.lookup(tp);
+#endif
+}
+
 }  // namespace
 
 // Uses strftime(3) to format the given Time.  The following extended format
@@ -334,7 +392,7 @@ std::string format(const std::string& format, const time_point<seconds>& tp,
                    const detail::femtoseconds& fs, const time_zone& tz) {
   std::string result;
   result.reserve(format.size());  // A reasonable guess for the result size.
-  const time_zone::absolute_lookup al = tz.lookup(tp);
+  const time_zone::absolute_lookup al = MemoizedLookup(tp, tz);
   const std::tm tm = ToTM(al);
 
   // Scratch buffer for internal conversions.
@@ -49,6 +49,7 @@
 
 #include "absl/base/config.h"
 #include "absl/time/internal/cctz/include/cctz/civil_time.h"
+#include "absl/time/internal/cctz/include/cctz/compiled_zone_db.h"
 #include "time_zone_fixed.h"
 #include "time_zone_posix.h"
 
@@ -833,6 +834,11 @@ std::unique_ptr<TimeZoneInfo> TimeZoneInfo::UTC() {
 }
 
 std::unique_ptr<TimeZoneInfo> TimeZoneInfo::Make(const std::string& name) {
+  // Prefer a precompiled form of the zone, if one is installed.
+  std::size_t size;
+  if (const char* data = FindCompiledZone(name, &size)) {
+    if (auto tz = MakeFromCompiledRecord(data, size)) return tz;
+  }
   auto tz = std::unique_ptr<TimeZoneInfo>(new TimeZoneInfo);
   if (!tz->Load(name)) tz.reset();  // fallback to UTC
   return tz;
@@ -69,6 +69,14 @@ class TimeZoneInfo : public TimeZoneIf {
   static std::unique_ptr<TimeZoneInfo> UTC();  // never fails
   static std::unique_ptr<TimeZoneInfo> Make(const std::string& name);
 
+  // Compiled-database support (see compiled_zone_db.h). A compiled
+  // record is the fully processed state of a TimeZoneInfo, so binding
+  // one requires no zoneinfo parsing. Returns nullptr if the record
+  // is malformed.
+  static std::unique_ptr<TimeZoneInfo> MakeFromCompiledRecord(
+      const char* data, std::size_t size);
+  void AppendCompiledRecord(std::string* out) const;
+
   // TimeZoneIf implementations.
   time_zone::absolute_lookup BreakTime(
       const time_point<seconds>& tp) const override;
@@ -22,7 +22,9 @@
 #include <vector>
 
 #include "absl/base/config.h"
+#include "absl/time/internal/cctz/include/cctz/compiled_zone_db.h"
 #include "absl/time/internal/cctz/include/cctz/time_zone.h"
+#include "time_zone_impl.h"
 #if defined(__linux__)
 #include <features.h>
 #endif
@@ -669,6 +671,57 @@ TEST(TimeZone, Failures) {
             convert(civil_second(1970, 1, 1, 0, 0, 0), tz));  // UTC
 }
 
+TEST(TimeZone, CompiledZoneDb) {
+  const std::vector<std::string> names = {"America/New_York",
+                                          "Australia/Lord_Howe", "UTC"};
+  std::string db;
+  ASSERT_TRUE(CompileZoneDb(names, &db));
+
+  // Compilation fails when a zone cannot be loaded.
+  std::string unused;
+  EXPECT_FALSE(CompileZoneDb({"Invalid/TimeZone"}, &unused));
+
+  // Malformed blocks are rejected and install nothing.
+  EXPECT_FALSE(UseCompiledZoneDb(db.data(), db.size() / 2));
+  std::string corrupt = db;
+  corrupt[0] = 'X';
+  EXPECT_FALSE(UseCompiledZoneDb(corrupt.data(), corrupt.size()));
+
+  const time_zone file_lhi = LoadZone("Australia/Lord_Howe");
+
+  ASSERT_TRUE(UseCompiledZoneDb(db.data(), db.size()));
+  time_zone::Impl::ClearTimeZoneMapTestOnly();
+
+  // The compiled zone should be indistinguishable from the file-parsed
+  // one across its transitions, including those generated from the
+  // zone's future specification.
+  const time_zone lhi = LoadZone("Australia/Lord_Howe");
+  EXPECT_EQ(file_lhi.name(), lhi.name());
+  EXPECT_EQ(file_lhi.version(), lhi.version());
+  time_zone::civil_transition file_trans, trans;
+  auto tp = chrono::system_clock::from_time_t(0);
+  for (int i = 0; i != 100; ++i) {
+    ASSERT_TRUE(file_lhi.next_transition(tp, &file_trans));
+    ASSERT_TRUE(lhi.next_transition(tp, &trans));
+    EXPECT_EQ(file_trans.from, trans.from);
+    EXPECT_EQ(file_trans.to, trans.to);
+    tp = convert(file_trans.to, file_lhi);
+    const auto file_al = file_lhi.lookup(tp);
+    const auto al = lhi.lookup(tp);
+    EXPECT_EQ(file_al.cs, al.cs);
+    EXPECT_EQ(file_al.offset, al.offset);
+    EXPECT_EQ(file_al.is_dst, al.is_dst);
+    EXPECT_STREQ(file_al.abbr, al.abbr);
+  }
+
+  // Zones absent from the database still load from zoneinfo data.
+  const time_zone la = LoadZone("America/Los_Angeles");
+  EXPECT_EQ("America/Los_Angeles", la.name());
+
+  ClearCompiledZoneDbTestOnly();
+  time_zone::Impl::ClearTimeZoneMapTestOnly();
+}
+
 TEST(TimeZone, Equality) {
   const time_zone a;
   const time_zone b;
@@ -37,10 +37,12 @@
 #include <winsock2.h>  // for timeval
 #endif
 
+#include <algorithm>
 #include <cstring>
 #include <ctime>
 #include <limits>
 
+#include "absl/base/internal/raw_logging.h"
 #include "absl/time/internal/cctz/include/cctz/civil_time.h"
 #include "absl/time/internal/cctz/include/cctz/time_zone.h"
 
@@ -401,6 +403,82 @@ bool TimeZone::PrevTransition(Time t, CivilTransition* trans) const {
   return FindTransition(cz_, &cctz::time_zone::prev_transition, t, trans);
 }
 
+void ToCivilDays(absl::Span<const Time> times, TimeZone tz,
+                 absl::Span<CivilDay> days) {
+  ABSL_RAW_CHECK(times.size() == days.size(),
+                 "output span must match input span size");
+
+  // Memoized state from the previous element: the civil day containing it
+  // with the absolute-time range [day_begin, day_end) mapping to that day,
+  // and the enclosing constant-UTC-offset interval [offset_begin,
+  // offset_end).  Runs of timestamps within the same day then cost two
+  // comparisons, runs within the same offset interval one day-number
+  // computation, and only a change of interval pays for full lookups.
+  CivilDay day;
+  Time day_begin = InfiniteFuture();  // empty ranges
+  Time day_end = InfinitePast();
+  Time offset_begin = InfiniteFuture();
+  Time offset_end = InfinitePast();
+  int64_t offset = 0;
+
+  // Timestamps this far from the epoch (roughly +/-100M years) risk
+  // overflowing the day-range arithmetic below; they take the full-lookup
+  // path every time.
+  constexpr int64_t kMaxMemoizedAbsSeconds = int64_t{4} << 50;
+
+  for (size_t i = 0; i < times.size(); ++i) {
+    const Time t = times[i];
+    if (day_begin <= t && t < day_end) {
+      days[i] = day;
+      continue;
+    }
+    int64_t day_number;
+    if (offset_begin <= t && t < offset_end) {
+      // Same UTC offset as the previous element: pure day-number arithmetic.
+      const int64_t local = ToUnixSeconds(t) + offset;
+      day_number = local / (24 * 60 * 60);
+      if (local % (24 * 60 * 60) < 0) --day_number;  // floor
+      day = CivilDay(1970, 1, 1) + day_number;
+    } else {
+      // New offset interval: resolve it with a full lookup.
+      const TimeZone::CivilInfo ci = tz.At(t);
+      day = CivilDay(ci.cs);
+      const int64_t unix_sec = ToUnixSeconds(t);
+      if (t == InfiniteFuture() || t == InfinitePast() ||
+          unix_sec > kMaxMemoizedAbsSeconds ||
+          unix_sec < -kMaxMemoizedAbsSeconds) {
+        days[i] = day;
+        day_begin = offset_begin = InfiniteFuture();
+        day_end = offset_end = InfinitePast();
+        continue;
+      }
+      offset = ci.offset;
+      day_number = day - CivilDay(1970, 1, 1);
+      TimeZone::CivilTransition trans;
+      const bool has_prev = tz.PrevTransition(t + Seconds(1), &trans);
+      offset_begin = has_prev ? tz.At(CivilSecond(trans.to)).trans : t;
+      // Beyond the last known transition the offset may still change (e.g.
+      // per a POSIX-style future specification), so extend no further than
+      // one second past `t`.
+      const bool has_next = tz.NextTransition(t, &trans);
+      offset_end =
+          has_next ? tz.At(CivilSecond(trans.to)).trans : t + Seconds(1);
+      if (!has_prev && !has_next) {
+        // No transitions on either side: a fixed-offset zone (e.g. UTC).
+        offset_begin = InfinitePast();
+        offset_end = InfiniteFuture();
+      }
+    }
+    days[i] = day;
+    // Clamp the day's absolute-time range to the offset interval; a civil
+    // day that straddles a transition has a different length there.
+    day_begin = std::max(offset_begin,
+                         FromUnixSeconds(day_number * (24 * 60 * 60) - offset));
+    day_end = std::min(
+        offset_end, FromUnixSeconds((day_number + 1) * (24 * 60 * 60) - offset));
+  }
+}
+
 //
 // Conversions involving time zones.
 //
@@ -29,6 +29,7 @@
 #include <iomanip>
 #include <limits>
 #include <string>
+#include <vector>
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
@@ -629,6 +630,40 @@ TEST(Time, Chrono128) {
             ts.time_since_epoch().count() % Timestamp::duration::period::den);
 }
 
+TEST(Time, ToCivilDaysBatch) {
+  const absl::TimeZone nyc =
+      absl::time_internal::LoadTimeZone("America/New_York");
+  const absl::TimeZone utc = absl::UTCTimeZone();
+
+  // Minute-by-minute coverage across the 2011 spring-forward and fall-back
+  // transitions, plus out-of-order jumps, day boundaries, subseconds, the
+  // epoch, pre-epoch times, and infinities.
+  std::vector<absl::Time> times;
+  const absl::Time spring =
+      absl::FromCivil(absl::CivilSecond(2011, 3, 13, 7, 0, 0), utc);
+  const absl::Time fall =
+      absl::FromCivil(absl::CivilSecond(2011, 11, 6, 6, 0, 0), utc);
+  for (int i = -180; i <= 180; i += 7) {
+    times.push_back(spring + absl::Minutes(i) + absl::Nanoseconds(i));
+    times.push_back(fall + absl::Minutes(i));
+  }
+  times.push_back(absl::UnixEpoch());
+  times.push_back(absl::UnixEpoch() - absl::Nanoseconds(1));
+  times.push_back(absl::FromUnixSeconds(-86400 * 1000));
+  times.push_back(absl::InfiniteFuture());
+  times.push_back(absl::InfinitePast());
+  times.push_back(spring);  // revisit after the memo moved elsewhere
+
+  for (const absl::TimeZone& tz : {nyc, utc}) {
+    std::vector<absl::CivilDay> days(times.size());
+    absl::ToCivilDays(absl::MakeConstSpan(times), tz, absl::MakeSpan(days));
+    for (size_t i = 0; i < times.size(); ++i) {
+      EXPECT_EQ(absl::ToCivilDay(times[i], tz), days[i])
+          << absl::FormatTime(times[i], utc) << " in zone " << tz.name();
+    }
+  }
+}
+
 TEST(Time, TimeZoneAt) {
   const absl::TimeZone nyc =
       absl::time_internal::LoadTimeZone("America/New_York");
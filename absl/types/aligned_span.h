@@ -0,0 +1,219 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// -----------------------------------------------------------------------------
+// aligned_span.h
+// -----------------------------------------------------------------------------
+//
+// This header file defines an `AlignedSpan<T, Alignment>` type: an
+// `absl::Span`-like reference to contiguous array data whose first element is
+// guaranteed to be aligned to `Alignment` bytes. The alignment guarantee is
+// part of the type, and `data()` communicates it to the compiler, so
+// vectorized kernels consuming an `AlignedSpan` can use aligned vector loads
+// without emitting runtime alignment checks or peeling prologues.
+//
+// An `AlignedSpan` is constructed either directly from a suitably aligned
+// pointer and length, or from an existing `absl::Span` via the explicit
+// converting constructor, which asserts the alignment in debug and hardened
+// builds. It converts implicitly to `absl::Span<T>`, so aligned-aware code
+// interoperates freely with code that takes ordinary spans.
+
+#ifndef ABSL_TYPES_ALIGNED_SPAN_H_
+#define ABSL_TYPES_ALIGNED_SPAN_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+
+#include "absl/base/config.h"
+#include "absl/base/macros.h"
+#include "absl/meta/type_traits.h"
+#include "absl/types/span.h"
+
+namespace absl {
+ABSL_NAMESPACE_BEGIN
+
+//------------------------------------------------------------------------------
+// AlignedSpan
+//------------------------------------------------------------------------------
+//
+// An `AlignedSpan<T, Alignment>` references the same data an
+// `absl::Span<T>` would, with the additional compile-time guarantee that
+// `data()` is aligned to `Alignment` bytes. `Alignment` must be a power of
+// two no smaller than `alignof(T)`.
+//
+// Like `Span`, an `AlignedSpan` does not own the data it references, which
+// must outlive the span.
+//
+// Example:
+//
+//   void SumKernel(absl::AlignedSpan<const float, 32> in) {
+//     // The compiler knows in.data() is 32-byte aligned and can emit
+//     // aligned vector loads with no peeling prologue.
+//     ...
+//   }
+//
+//   alignas(32) float buffer[1024];
+//   SumKernel(absl::AlignedSpan<const float, 32>(buffer, 1024));
+//
+// Only operations that preserve the alignment of the first element yield
+// another `AlignedSpan` (e.g. `first()`); arbitrary subspans are obtained by
+// converting to `Span`.
+template <typename T, size_t Alignment>
+class AlignedSpan {
+  static_assert(Alignment >= alignof(T),
+                "The alignment of an AlignedSpan must be at least the "
+                "alignment of its element type.");
+  static_assert((Alignment & (Alignment - 1)) == 0,
+                "The alignment of an AlignedSpan must be a power of two.");
+
+ public:
+  using element_type = T;
+  using value_type = absl::remove_cv_t<T>;
+  using pointer = T*;
+  using const_pointer = const T*;
+  using reference = T&;
+  using const_reference = const T&;
+  using iterator = pointer;
+  using const_iterator = const_pointer;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+  using size_type = size_t;
+  using difference_type = ptrdiff_t;
+
+  static constexpr size_t alignment = Alignment;
+
+  constexpr AlignedSpan() noexcept : ptr_(nullptr), len_(0) {}
+
+  // Constructs an `AlignedSpan` from a pointer and a length. The pointer must
+  // be aligned to `Alignment` bytes; this is asserted in debug and hardened
+  // builds.
+  AlignedSpan(pointer ptr, size_type length) noexcept
+      : ptr_(ptr), len_(length) {
+    ABSL_HARDENING_ASSERT(IsAligned(ptr));
+  }
+
+  // Constructs an `AlignedSpan` from a `Span` whose data is known by the
+  // caller to be suitably aligned. The alignment is asserted in debug and
+  // hardened builds; passing a misaligned span is undefined behavior.
+  explicit AlignedSpan(Span<T> span) noexcept
+      : AlignedSpan(span.data(), span.size()) {}
+
+  // Implicit conversion from an `AlignedSpan` with a stricter alignment.
+  template <size_t A, typename = absl::enable_if_t<(A > Alignment)>>
+  constexpr AlignedSpan(AlignedSpan<T, A> span) noexcept  // NOLINT
+      : ptr_(span.data()), len_(span.size()) {}
+
+  // Implicit conversion to the corresponding `Span`, dropping the alignment
+  // guarantee.
+  constexpr operator Span<T>() const noexcept {  // NOLINT
+    return Span<T>(ptr_, len_);
+  }
+
+  // AlignedSpan::data()
+  //
+  // Returns a pointer to the span's first element. The returned pointer
+  // carries the alignment guarantee, so dereferencing through it lets the
+  // compiler assume `Alignment`-byte alignment.
+  pointer data() const noexcept {
+#if ABSL_HAVE_BUILTIN(__builtin_assume_aligned) || defined(__GNUC__)
+    return static_cast<pointer>(
+        __builtin_assume_aligned(ptr_, Alignment));
+#else
+    return ptr_;
+#endif
+  }
+
+  // AlignedSpan::size()
+  //
+  // Returns the number of elements in the span.
+  constexpr size_type size() const noexcept { return len_; }
+
+  // AlignedSpan::empty()
+  //
+  // Returns whether the span is empty.
+  constexpr bool empty() const noexcept { return len_ == 0; }
+
+  // AlignedSpan::operator[]
+  //
+  // Returns a reference to the i'th element of the span.
+  reference operator[](size_type i) const noexcept {
+    return ABSL_HARDENING_ASSERT(i < size()), data()[i];
+  }
+
+  // AlignedSpan::front()
+  //
+  // Returns a reference to the first element of the span.
+  reference front() const noexcept {
+    return ABSL_HARDENING_ASSERT(size() > 0), *data();
+  }
+
+  // AlignedSpan::back()
+  //
+  // Returns a reference to the last element of the span.
+  reference back() const noexcept {
+    return ABSL_HARDENING_ASSERT(size() > 0), *(data() + size() - 1);
+  }
+
+  // AlignedSpan::begin()
+  //
+  // Returns an iterator to the first element of the span.
+  iterator begin() const noexcept { return data(); }
+
+  // AlignedSpan::end()
+  //
+  // Returns an iterator to the last element of the span.
+  iterator end() const noexcept { return data() + size(); }
+
+  // AlignedSpan::first()
+  //
+  // Returns a span of the first `length` elements. The first element is
+  // unchanged, so the result keeps the alignment guarantee.
+  AlignedSpan first(size_type length) const noexcept {
+    return ABSL_HARDENING_ASSERT(length <= size()),
+           AlignedSpan(ptr_, length);
+  }
+
+  // AlignedSpan::remove_suffix()
+  //
+  // Removes the last `n` elements from the span.
+  void remove_suffix(size_type n) noexcept {
+    ABSL_HARDENING_ASSERT(size() >= n);
+    len_ -= n;
+  }
+
+ private:
+  static bool IsAligned(const_pointer ptr) {
+    return reinterpret_cast<uintptr_t>(ptr) % Alignment == 0;
+  }
+
+  pointer ptr_;
+  size_type len_;
+};
+
+// MakeAlignedSpan()
+//
+// Constructs an `AlignedSpan<T, Alignment>` with deduced element type.  The
+// alignment must be given explicitly:
+//
+//   auto span = absl::MakeAlignedSpan<64>(ptr, len);
+template <size_t Alignment, typename T>
+AlignedSpan<T, Alignment> MakeAlignedSpan(T* ptr, size_t length) noexcept {
+  return AlignedSpan<T, Alignment>(ptr, length);
+}
+
+ABSL_NAMESPACE_END
+}  // namespace absl
+
+#endif  // ABSL_TYPES_ALIGNED_SPAN_H_
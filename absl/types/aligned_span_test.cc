@@ -0,0 +1,100 @@
+// Copyright 2026 The Abseil Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "absl/types/aligned_span.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "absl/types/span.h"
+
+namespace {
+
+using ::testing::ElementsAre;
+
+TEST(AlignedSpanTest, DefaultConstruction) {
+  absl::AlignedSpan<int, 64> span;
+  EXPECT_EQ(span.data(), nullptr);
+  EXPECT_EQ(span.size(), 0);
+  EXPECT_TRUE(span.empty());
+}
+
+TEST(AlignedSpanTest, PointerLengthConstruction) {
+  alignas(64) int buffer[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+  absl::AlignedSpan<int, 64> span(buffer, 8);
+  EXPECT_EQ(span.data(), buffer);
+  EXPECT_EQ(span.size(), 8);
+  EXPECT_EQ(span.front(), 1);
+  EXPECT_EQ(span.back(), 8);
+  EXPECT_EQ(span[3], 4);
+  EXPECT_THAT(span, ElementsAre(1, 2, 3, 4, 5, 6, 7, 8));
+}
+
+TEST(AlignedSpanTest, ConversionFromSpan) {
+  alignas(32) float buffer[4] = {1.0f, 2.0f, 3.0f, 4.0f};
+  absl::Span<float> plain(buffer, 4);
+  absl::AlignedSpan<float, 32> aligned(plain);
+  EXPECT_EQ(aligned.data(), plain.data());
+  EXPECT_EQ(aligned.size(), plain.size());
+}
+
+TEST(AlignedSpanTest, ConversionToSpan) {
+  alignas(32) int buffer[4] = {1, 2, 3, 4};
+  absl::AlignedSpan<int, 32> aligned(buffer, 4);
+  absl::Span<int> plain = aligned;
+  EXPECT_EQ(plain.data(), buffer);
+  EXPECT_EQ(plain.size(), 4);
+}
+
+TEST(AlignedSpanTest, ConversionFromStricterAlignment) {
+  alignas(64) int buffer[4] = {1, 2, 3, 4};
+  absl::AlignedSpan<int, 64> strict(buffer, 4);
+  absl::AlignedSpan<int, 16> relaxed = strict;
+  EXPECT_EQ(relaxed.data(), buffer);
+  EXPECT_EQ(relaxed.size(), 4);
+}
+
+TEST(AlignedSpanTest, FirstKeepsAlignment) {
+  alignas(64) int buffer[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+  absl::AlignedSpan<int, 64> span(buffer, 8);
+  absl::AlignedSpan<int, 64> prefix = span.first(3);
+  EXPECT_THAT(prefix, ElementsAre(1, 2, 3));
+}
+
+TEST(AlignedSpanTest, RemoveSuffix) {
+  alignas(64) int buffer[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+  absl::AlignedSpan<int, 64> span(buffer, 8);
+  span.remove_suffix(5);
+  EXPECT_THAT(span, ElementsAre(1, 2, 3));
+}
+
+TEST(AlignedSpanTest, MakeAlignedSpan) {
+  alignas(64) int buffer[8] = {};
+  auto span = absl::MakeAlignedSpan<64>(buffer, 8);
+  static_assert(
+      std::is_same<decltype(span), absl::AlignedSpan<int, 64>>::value, "");
+  EXPECT_EQ(span.data(), buffer);
+  EXPECT_EQ(span.size(), 8);
+}
+
+TEST(AlignedSpanTest, ConstElements) {
+  alignas(16) const int buffer[4] = {1, 2, 3, 4};
+  absl::AlignedSpan<const int, 16> span(buffer, 4);
+  EXPECT_EQ(std::accumulate(span.begin(), span.end(), 0), 10);
+}
+
+}  // namespace